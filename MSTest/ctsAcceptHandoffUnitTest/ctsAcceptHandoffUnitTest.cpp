@@ -0,0 +1,339 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for the lock-free handoff of accepted connections and the adaptive AcceptEx depth
+    - connections and requests are plain integers standing in for accepted sockets and ctsSocket requests
+    - the depth is driven from a simulated clock
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../ctsTraffic/ctsAcceptHandoff.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    constexpr int64_t c_clockStartUsec = 5000000;
+    constexpr uint32_t c_threadCount = 4;
+
+    // completes acceptCount accepts spread evenly across one depth sample interval, with plenty still pended
+    // - the last accept lands at the end of the interval, recalculating the depth
+    int64_t AcceptForOneInterval(ctsAcceptDepth& depth, int64_t nowUsec, uint32_t acceptCount)
+    {
+        for (uint32_t count = 1; count <= acceptCount; ++count)
+        {
+            depth.AcceptCompleted(nowUsec + ctsAcceptDepth::c_sampleIntervalUsec * count / acceptCount, 10);
+        }
+        return nowUsec + ctsAcceptDepth::c_sampleIntervalUsec;
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsAcceptHandoffUnitTest)
+    {
+    public:
+        TEST_METHOD(QueueIsFifoAndBounded)
+        {
+            ctsMpmcQueue<int> queue(3);
+            // rounded up to a power of 2
+            Assert::AreEqual(size_t{4}, queue.GetCapacity());
+
+            int value{};
+            Assert::IsFalse(queue.TryPop(value));
+            for (auto push = 1; push <= 4; ++push)
+            {
+                Assert::IsTrue(queue.TryPush(int{push}));
+            }
+            Assert::IsFalse(queue.TryPush(5));
+
+            // wraps around the cells
+            for (auto lap = 0; lap < 3; ++lap)
+            {
+                for (auto pop = 1; pop <= 4; ++pop)
+                {
+                    Assert::IsTrue(queue.TryPop(value));
+                    Assert::AreEqual(pop, value);
+                    Assert::IsTrue(queue.TryPush(int{pop}));
+                }
+            }
+        }
+
+        TEST_METHOD(QueueConcurrentProducersAndConsumers)
+        {
+            constexpr auto valuesPerProducer = 100000;
+            constexpr auto valueCount = valuesPerProducer * c_threadCount;
+            ctsMpmcQueue<int> queue(64);
+            const auto seen = std::make_unique<std::atomic<int>[]>(valueCount);
+            std::atomic<int> popped{0};
+
+            std::vector<std::thread> threads;
+            for (uint32_t producer = 0; producer < c_threadCount; ++producer)
+            {
+                threads.emplace_back([&, producer] {
+                    for (auto count = 0; count < valuesPerProducer; ++count)
+                    {
+                        auto value = static_cast<int>(producer) * valuesPerProducer + count;
+                        while (!queue.TryPush(std::move(value)))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+                threads.emplace_back([&] {
+                    while (popped < valueCount)
+                    {
+                        int value{};
+                        if (queue.TryPop(value))
+                        {
+                            seen[value].fetch_add(1);
+                            ++popped;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (auto value = 0; value < valueCount; ++value)
+            {
+                Assert::AreEqual(1, seen[value].load());
+            }
+        }
+
+        TEST_METHOD(HandoffMatchesWhicheverIsWaiting)
+        {
+            ctsAcceptHandoff<int, int> handoff(4, 4);
+            int request{};
+            int connection{};
+
+            // a connection with no request waiting is queued
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.OfferConnection(101, request));
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.OfferConnection(102, request));
+            Assert::AreEqual(2u, handoff.GetQueuedConnections());
+
+            // requests take the queued connections in order
+            Assert::IsTrue(ctsHandoffResult::Matched == handoff.RequestConnection(1, connection));
+            Assert::AreEqual(101, connection);
+            Assert::IsTrue(ctsHandoffResult::Matched == handoff.RequestConnection(2, connection));
+            Assert::AreEqual(102, connection);
+
+            // a request with no connection waiting is queued
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.RequestConnection(3, connection));
+            Assert::AreEqual(0u, handoff.GetQueuedConnections());
+            Assert::AreEqual(1u, handoff.GetQueuedRequests());
+
+            // and is handed the next connection
+            Assert::IsTrue(ctsHandoffResult::Matched == handoff.OfferConnection(103, request));
+            Assert::AreEqual(3, request);
+            Assert::AreEqual(0u, handoff.GetQueuedRequests());
+        }
+
+        TEST_METHOD(HandoffReportsFullQueues)
+        {
+            ctsAcceptHandoff<int, int> handoff(2, 2);
+            int request{};
+            int connection{};
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.OfferConnection(101, request));
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.OfferConnection(102, request));
+            Assert::IsTrue(ctsHandoffResult::Full == handoff.OfferConnection(103, request));
+
+            Assert::IsTrue(handoff.TryTakeConnection(connection));
+            Assert::AreEqual(101, connection);
+            Assert::IsTrue(handoff.TryTakeConnection(connection));
+            Assert::IsFalse(handoff.TryTakeConnection(connection));
+
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.RequestConnection(1, connection));
+            Assert::IsTrue(ctsHandoffResult::Queued == handoff.RequestConnection(2, connection));
+            Assert::IsTrue(ctsHandoffResult::Full == handoff.RequestConnection(3, connection));
+
+            // shutting down takes the waiting requests without a connection
+            Assert::IsTrue(handoff.TryTakeRequest(request));
+            Assert::AreEqual(1, request);
+            Assert::IsTrue(handoff.TryTakeRequest(request));
+            Assert::IsFalse(handoff.TryTakeRequest(request));
+        }
+
+        TEST_METHOD(HandoffDeliversEveryConnectionOnceUnderConcurrency)
+        {
+            constexpr auto connectionsPerThread = 50000;
+            constexpr auto connectionCount = connectionsPerThread * c_threadCount;
+            ctsAcceptHandoff<int, int> handoff(connectionCount, connectionCount);
+            // which request each connection was handed to, and how many connections each request was handed
+            const auto connectionRequest = std::make_unique<std::atomic<int>[]>(connectionCount);
+            const auto requestDeliveries = std::make_unique<std::atomic<int>[]>(connectionCount);
+            for (auto index = 0; index < connectionCount; ++index)
+            {
+                connectionRequest[index] = -1;
+            }
+
+            const auto deliver = [&](int connection, int request) {
+                Assert::AreEqual(-1, connectionRequest[connection].exchange(request));
+                requestDeliveries[request].fetch_add(1);
+            };
+
+            std::vector<std::thread> threads;
+            for (uint32_t thread = 0; thread < c_threadCount; ++thread)
+            {
+                // the IOCP callbacks offering accepted connections
+                threads.emplace_back([&, thread] {
+                    for (auto count = 0; count < connectionsPerThread; ++count)
+                    {
+                        const auto connection = static_cast<int>(thread) * connectionsPerThread + count;
+                        int request{};
+                        if (ctsHandoffResult::Matched == handoff.OfferConnection(int{connection}, request))
+                        {
+                            deliver(connection, request);
+                        }
+                    }
+                });
+                // the ctsSocketState objects requesting them
+                threads.emplace_back([&, thread] {
+                    for (auto count = 0; count < connectionsPerThread; ++count)
+                    {
+                        const auto request = static_cast<int>(thread) * connectionsPerThread + count;
+                        int connection{};
+                        if (ctsHandoffResult::Matched == handoff.RequestConnection(int{request}, connection))
+                        {
+                            deliver(connection, request);
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::AreEqual(0u, handoff.GetQueuedConnections());
+            Assert::AreEqual(0u, handoff.GetQueuedRequests());
+            for (auto index = 0; index < connectionCount; ++index)
+            {
+                Assert::IsTrue(connectionRequest[index] >= 0);
+                Assert::AreEqual(1, requestDeliveries[index].load());
+            }
+        }
+
+        TEST_METHOD(DepthStartsAtTheMinimum)
+        {
+            const ctsAcceptDepth depth(100, 1000, c_clockStartUsec);
+            Assert::AreEqual(100u, depth.GetTarget());
+
+            // a fixed depth
+            ctsAcceptDepth fixedDepth(100, 100, c_clockStartUsec);
+            auto nowUsec = c_clockStartUsec;
+            for (auto interval = 0; interval < 10; ++interval)
+            {
+                nowUsec = AcceptForOneInterval(fixedDepth, nowUsec, 5000);
+            }
+            fixedDepth.AcceptCompleted(nowUsec, 0);
+            Assert::AreEqual(100u, fixedDepth.GetTarget());
+        }
+
+        TEST_METHOD(DepthDoublesWhenExhausted)
+        {
+            ctsAcceptDepth depth(100, 1000, c_clockStartUsec);
+            depth.AcceptCompleted(c_clockStartUsec, 0);
+            Assert::AreEqual(200u, depth.GetTarget());
+            depth.AcceptCompleted(c_clockStartUsec, 0);
+            depth.AcceptCompleted(c_clockStartUsec, 0);
+            Assert::AreEqual(800u, depth.GetTarget());
+            depth.AcceptCompleted(c_clockStartUsec, 0);
+            Assert::AreEqual(1000u, depth.GetTarget());
+            Assert::AreEqual(4ull, depth.GetExhaustedCount());
+        }
+
+        TEST_METHOD(DepthFollowsTheAcceptRate)
+        {
+            ctsAcceptDepth depth(100, 1000, c_clockStartUsec);
+
+            // 300 accepts per interval: the depth covers 2 intervals' worth
+            auto nowUsec = AcceptForOneInterval(depth, c_clockStartUsec, 300);
+            nowUsec = AcceptForOneInterval(depth, nowUsec, 300);
+            Assert::AreEqual(600u, depth.GetTarget());
+
+            // never beyond the maximum
+            nowUsec = AcceptForOneInterval(depth, nowUsec, 5000);
+            nowUsec = AcceptForOneInterval(depth, nowUsec, 5000);
+            Assert::AreEqual(1000u, depth.GetTarget());
+
+            // shrinks by 1/8th of the difference each interval once the rate drops
+            nowUsec = AcceptForOneInterval(depth, nowUsec, 10);
+            Assert::AreEqual(887u, depth.GetTarget());
+            nowUsec = AcceptForOneInterval(depth, nowUsec, 10);
+            Assert::AreEqual(788u, depth.GetTarget());
+            for (auto interval = 0; interval < 100; ++interval)
+            {
+                nowUsec = AcceptForOneInterval(depth, nowUsec, 10);
+            }
+            Assert::AreEqual(100u, depth.GetTarget());
+        }
+
+        TEST_METHOD(DepthScalesAnIntervalThatRanLong)
+        {
+            ctsAcceptDepth depth(10, 1000, c_clockStartUsec);
+            // 400 accepts over 4 intervals is 100 per interval
+            for (auto count = 0; count < 399; ++count)
+            {
+                depth.AcceptCompleted(c_clockStartUsec + count, 10);
+            }
+            depth.AcceptCompleted(c_clockStartUsec + 4 * ctsAcceptDepth::c_sampleIntervalUsec, 10);
+            Assert::AreEqual(200u, depth.GetTarget());
+        }
+
+        TEST_METHOD(DepthIsSplitAcrossShards)
+        {
+            Assert::AreEqual(250u, ctsAcceptShardDepth(1000, 4));
+            // each share rounds up
+            Assert::AreEqual(334u, ctsAcceptShardDepth(1000, 3));
+            // each shard keeps at least one
+            Assert::AreEqual(1u, ctsAcceptShardDepth(2, 4));
+            Assert::AreEqual(1u, ctsAcceptShardDepth(0, 4));
+            // not sharded
+            Assert::AreEqual(100u, ctsAcceptShardDepth(100, 1));
+            Assert::AreEqual(100u, ctsAcceptShardDepth(100, 0));
+
+            // the shards keep at least the listener's depth, and at most shardCount - 1 more:
+            // ctsAcceptExImpl sizes the handoff queue on that bound
+            for (uint32_t shardCount = 1; shardCount <= 64; ++shardCount)
+            {
+                for (const uint32_t listenerDepth : {1u, 7u, 100u, 1000u, 1023u})
+                {
+                    const auto total = ctsAcceptShardDepth(listenerDepth, shardCount) * shardCount;
+                    Assert::IsTrue(total >= listenerDepth);
+                    Assert::IsTrue(total <= listenerDepth + shardCount - 1);
+                }
+            }
+        }
+    };
+}
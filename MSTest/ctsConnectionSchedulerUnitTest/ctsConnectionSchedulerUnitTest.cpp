@@ -0,0 +1,240 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for the -ConnectionRate schedule
+    - every test drives the scheduler from a simulated clock, so no test depends on timing
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "../../ctsTraffic/ctsConnectionScheduler.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    constexpr int64_t c_clockStartUsec = 5000000;
+    constexpr uint64_t c_seed = 0x5eed;
+
+    struct LatenessResults
+    {
+        uint64_t m_starts = 0;
+        int64_t m_maxLatenessUsec = 0;
+        int64_t m_totalLatenessUsec = 0;
+    };
+
+    // advances a simulated clock tickUsec at a time until endUsec,
+    // taking every due start at each tick as the broker does when its timer fires
+    LatenessResults RunSimulatedClock(ctsConnectionScheduler& scheduler, int64_t tickUsec, int64_t endUsec)
+    {
+        LatenessResults results;
+        for (auto nowUsec = c_clockStartUsec; nowUsec <= endUsec; nowUsec += tickUsec)
+        {
+            while (scheduler.IsDue(nowUsec))
+            {
+                const auto latenessUsec = nowUsec - scheduler.TakeStart();
+                Assert::IsTrue(latenessUsec >= 0);
+                ++results.m_starts;
+                results.m_totalLatenessUsec += latenessUsec;
+                if (latenessUsec > results.m_maxLatenessUsec)
+                {
+                    results.m_maxLatenessUsec = latenessUsec;
+                }
+            }
+        }
+        return results;
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsConnectionSchedulerUnitTest)
+    {
+    public:
+        TEST_METHOD(ConstantStartsAreEvenlySpaced)
+        {
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Constant, 1000.0, 0, c_seed);
+            scheduler.Start(c_clockStartUsec);
+
+            // the first start is due as the timeline begins
+            Assert::IsTrue(scheduler.IsDue(c_clockStartUsec));
+            for (int64_t count = 0; count < 10; ++count)
+            {
+                Assert::AreEqual(c_clockStartUsec + count * 1000, scheduler.NextStartUsec());
+                Assert::AreEqual(c_clockStartUsec + count * 1000, scheduler.TakeStart());
+            }
+            Assert::IsFalse(scheduler.IsDue(c_clockStartUsec + 9999));
+            Assert::IsTrue(scheduler.IsDue(c_clockStartUsec + 10000));
+            Assert::AreEqual(10ull, scheduler.GetStartsTaken());
+        }
+
+        TEST_METHOD(ConstantTimelineDoesNotDrift)
+        {
+            // 1/3 second between starts can't be represented exactly in microseconds
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Constant, 3.0, 0, c_seed);
+            scheduler.Start(c_clockStartUsec);
+            for (auto count = 0; count < 3000; ++count)
+            {
+                (void)scheduler.TakeStart();
+            }
+            Assert::AreEqual(c_clockStartUsec + 1000000000ll, scheduler.NextStartUsec());
+        }
+
+        TEST_METHOD(StalledStartsKeepTheirIntendedTimes)
+        {
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Constant, 1000.0, 0, c_seed);
+            scheduler.Start(c_clockStartUsec);
+
+            // nothing could be started for the first 50ms
+            const auto stallEndUsec = c_clockStartUsec + 50000;
+            Assert::AreEqual(51ull, scheduler.IntendedStartsBy(stallEndUsec));
+
+            // each start made after the stall is late by the time since it was intended,
+            // not by the time since the previous start was made
+            std::vector<int64_t> lateness;
+            while (scheduler.IsDue(stallEndUsec))
+            {
+                lateness.push_back(stallEndUsec - scheduler.TakeStart());
+            }
+            Assert::AreEqual(size_t{51}, lateness.size());
+            Assert::AreEqual(50000ll, lateness.front());
+            Assert::AreEqual(0ll, lateness.back());
+
+            // catching up doesn't shift the rest of the timeline
+            Assert::AreEqual(c_clockStartUsec + 51000, scheduler.NextStartUsec());
+        }
+
+        TEST_METHOD(TimerTicksAreMeasuredAsLateness)
+        {
+            // a timer firing every 15.6ms makes each start late by up to a tick, half a tick on average
+            constexpr int64_t tickUsec = 15600;
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Constant, 1000.0, 0, c_seed);
+            scheduler.Start(c_clockStartUsec);
+            const auto results = RunSimulatedClock(scheduler, tickUsec, c_clockStartUsec + 10 * 1000000);
+
+            Assert::AreEqual(scheduler.IntendedStartsBy(c_clockStartUsec + 10 * 1000000 - 10 * 1000000 % tickUsec), results.m_starts);
+            Assert::IsTrue(results.m_maxLatenessUsec < tickUsec);
+            const auto meanLatenessUsec = static_cast<double>(results.m_totalLatenessUsec) / static_cast<double>(results.m_starts);
+            Assert::IsTrue(std::abs(meanLatenessUsec - tickUsec / 2.0) < 500.0);
+        }
+
+        TEST_METHOD(PoissonStartsAverageTheRate)
+        {
+            constexpr auto startCount = 100000;
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Poisson, 1000.0, 0, c_seed);
+            scheduler.Start(c_clockStartUsec);
+
+            std::vector<double> intervals;
+            auto previousUsec = scheduler.TakeStart();
+            Assert::AreEqual(c_clockStartUsec, previousUsec);
+            for (auto count = 0; count < startCount; ++count)
+            {
+                const auto intendedUsec = scheduler.TakeStart();
+                Assert::IsTrue(intendedUsec >= previousUsec);
+                intervals.push_back(static_cast<double>(intendedUsec - previousUsec));
+                previousUsec = intendedUsec;
+            }
+
+            // exponentially distributed intervals: the standard deviation equals the mean
+            double sum = 0.0;
+            for (const auto interval : intervals)
+            {
+                sum += interval;
+            }
+            const auto mean = sum / startCount;
+            double squares = 0.0;
+            for (const auto interval : intervals)
+            {
+                squares += (interval - mean) * (interval - mean);
+            }
+            const auto standardDeviation = std::sqrt(squares / startCount);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(
+                L"Poisson intervals: mean %.1f usec, standard deviation %.1f usec\n", mean, standardDeviation).c_str());
+            Assert::IsTrue(std::abs(mean - 1000.0) < 20.0);
+            Assert::IsTrue(std::abs(standardDeviation - 1000.0) < 30.0);
+        }
+
+        TEST_METHOD(PoissonTimelineRepeatsWithTheSeed)
+        {
+            ctsConnectionScheduler first(ctsArrivalProcess::Poisson, 500.0, 0, c_seed);
+            ctsConnectionScheduler second(ctsArrivalProcess::Poisson, 500.0, 0, c_seed);
+            first.Start(c_clockStartUsec);
+            second.Start(c_clockStartUsec);
+            for (auto count = 0; count < 1000; ++count)
+            {
+                Assert::AreEqual(first.TakeStart(), second.TakeStart());
+            }
+        }
+
+        TEST_METHOD(RampGrowsToTheRate)
+        {
+            constexpr int64_t rampUsec = 10 * 1000000;
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Ramp, 1000.0, rampUsec, c_seed);
+            scheduler.Start(c_clockStartUsec);
+
+            // the rate starts at zero, so nothing is due as the timeline begins
+            Assert::IsFalse(scheduler.IsDue(c_clockStartUsec));
+            // a linear ramp to 1000/second over 10 seconds intends 5000 starts
+            Assert::AreEqual(5000ull, scheduler.IntendedStartsBy(c_clockStartUsec + rampUsec));
+
+            auto previousUsec = scheduler.TakeStart();
+            const auto firstIntervalUsec = [&] {
+                const auto nextUsec = scheduler.TakeStart();
+                const auto intervalUsec = nextUsec - previousUsec;
+                previousUsec = nextUsec;
+                return intervalUsec;
+            }();
+            while (scheduler.GetStartsTaken() < 5000)
+            {
+                const auto nextUsec = scheduler.TakeStart();
+                // starts only come closer together through the ramp
+                Assert::IsTrue(nextUsec - previousUsec <= firstIntervalUsec);
+                previousUsec = nextUsec;
+            }
+            // the last start of the ramp is at its end
+            Assert::IsTrue(std::abs(previousUsec - (c_clockStartUsec + rampUsec)) <= 1);
+
+            // past the ramp starts are evenly spaced at the rate
+            for (auto count = 0; count < 100; ++count)
+            {
+                const auto nextUsec = scheduler.TakeStart();
+                Assert::IsTrue(std::abs(nextUsec - previousUsec - 1000) <= 1);
+                previousUsec = nextUsec;
+            }
+        }
+
+        TEST_METHOD(RampLatenessIsMeasuredThroughTheRamp)
+        {
+            constexpr int64_t rampUsec = 2 * 1000000;
+            constexpr int64_t tickUsec = 1000;
+            ctsConnectionScheduler scheduler(ctsArrivalProcess::Ramp, 10000.0, rampUsec, c_seed);
+            scheduler.Start(c_clockStartUsec);
+            const auto results = RunSimulatedClock(scheduler, tickUsec, c_clockStartUsec + 2 * rampUsec);
+
+            // 10000 starts through the ramp, then 10000 per second for 2 more seconds
+            Assert::AreEqual(30000ull, results.m_starts);
+            Assert::IsTrue(results.m_maxLatenessUsec < tickUsec);
+        }
+    };
+}
@@ -0,0 +1,201 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for -conn:HappyEyeballs: the order targets are raced in, and deciding the race
+    - each attempt's connect result is driven by the test, as ctsHappyEyeballsConnect reports them from its ConnectEx completions
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "../../ctsTraffic/ctsHappyEyeballs.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+template <>
+inline std::wstring ToString<ctsHappyEyeballsRace::Outcome>(const ctsHappyEyeballsRace::Outcome& outcome)
+{
+    switch (outcome)
+    {
+        case ctsHappyEyeballsRace::Outcome::Racing:
+            return L"Racing";
+        case ctsHappyEyeballsRace::Outcome::Won:
+            return L"Won";
+        case ctsHappyEyeballsRace::Outcome::Lost:
+            return L"Lost";
+        case ctsHappyEyeballsRace::Outcome::Failed:
+            return L"Failed";
+    }
+    return L"Unknown";
+}
+}
+
+namespace
+{
+    // stands in for wil::network::socket_address: ordering only looks at the family
+    struct TestAddress
+    {
+        int m_family;
+
+        [[nodiscard]] int family() const noexcept
+        {
+            return m_family;
+        }
+    };
+
+    constexpr int c_ipv4 = 2;
+    constexpr int c_ipv6 = 23;
+    constexpr uint32_t c_connectionRefused = 10061;
+    constexpr uint32_t c_connectionAborted = 10053;
+    constexpr uint32_t c_timedOut = 10060;
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsHappyEyeballsUnitTest)
+    {
+    public:
+        TEST_METHOD(OrderAlternatesAddressFamilies)
+        {
+            const std::vector<TestAddress> targets{
+                {c_ipv4}, {c_ipv4}, {c_ipv6}, {c_ipv4}, {c_ipv6}, {c_ipv6}, {c_ipv6}};
+
+            // the socket was created for the IPv6 address at index 2: the other family follows it
+            const std::vector<uint32_t> expected{2, 0, 4, 1, 5, 3, 6};
+            Assert::IsTrue(expected == ctsHappyEyeballsOrder(targets, 2));
+
+            const std::vector<uint32_t> expectedFromIpv4{3, 2, 0, 4, 1, 5, 6};
+            Assert::IsTrue(expectedFromIpv4 == ctsHappyEyeballsOrder(targets, 3));
+        }
+
+        TEST_METHOD(OrderSingleFamily)
+        {
+            const std::vector<TestAddress> targets{{c_ipv4}, {c_ipv4}, {c_ipv4}};
+            const std::vector<uint32_t> expected{1, 0, 2};
+            Assert::IsTrue(expected == ctsHappyEyeballsOrder(targets, 1));
+
+            const std::vector<TestAddress> single{{c_ipv6}};
+            Assert::IsTrue(std::vector<uint32_t>{0} == ctsHappyEyeballsOrder(single, 0));
+        }
+
+        TEST_METHOD(FirstAttemptConnects)
+        {
+            ctsHappyEyeballsRace race(2);
+            Assert::AreEqual(0u, race.StartNextAttempt());
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Won, race.AttemptConnected(0));
+            Assert::AreEqual(0u, race.GetWinner());
+
+            // the second address is never tried
+            Assert::AreEqual(ctsHappyEyeballsRace::c_noAttempt, race.StartNextAttempt());
+            Assert::AreEqual(1u, race.GetStartedCount());
+            Assert::IsTrue(race.IsFinished());
+        }
+
+        TEST_METHOD(UnreachableAddressLosesToLiveListener)
+        {
+            // attempt 0 targets a black-holed address: its SYNs go unanswered
+            // attempt 1 targets a live listener
+            ctsHappyEyeballsRace race(2);
+            Assert::AreEqual(0u, race.StartNextAttempt());
+
+            // the connection attempt delay expires on attempt 0 - the next starts alongside it
+            Assert::IsTrue(race.IsNewestAttempt(0));
+            Assert::AreEqual(1u, race.StartNextAttempt());
+            Assert::IsFalse(race.IsNewestAttempt(0));
+            Assert::AreEqual(2u, race.GetInFlightCount());
+
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Won, race.AttemptConnected(1));
+            Assert::AreEqual(1u, race.GetWinner());
+            Assert::IsTrue(race.IsDecided());
+            // attempt 0 is closed by the caller, but its ConnectEx has yet to complete
+            Assert::IsFalse(race.IsFinished());
+
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Lost, race.AttemptFailed(c_connectionAborted));
+            Assert::IsTrue(race.IsFinished());
+            Assert::AreEqual(1u, race.GetWinner());
+        }
+
+        TEST_METHOD(RefusedAttemptStartsTheNextImmediately)
+        {
+            ctsHappyEyeballsRace race(3);
+            Assert::AreEqual(0u, race.StartNextAttempt());
+
+            // refused before the attempt delay: the race goes on without waiting for it
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Racing, race.AttemptFailed(c_connectionRefused));
+            Assert::AreEqual(1u, race.StartNextAttempt());
+            Assert::IsTrue(race.IsNewestAttempt(1));
+
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Won, race.AttemptConnected(1));
+            Assert::AreEqual(ctsHappyEyeballsRace::c_noAttempt, race.StartNextAttempt());
+            Assert::IsTrue(race.IsFinished());
+        }
+
+        TEST_METHOD(EveryAttemptFails)
+        {
+            ctsHappyEyeballsRace race(3);
+            Assert::AreEqual(0u, race.StartNextAttempt());
+            Assert::AreEqual(1u, race.StartNextAttempt());
+            Assert::AreEqual(2u, race.StartNextAttempt());
+            Assert::AreEqual(ctsHappyEyeballsRace::c_noAttempt, race.StartNextAttempt());
+
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Racing, race.AttemptFailed(c_connectionRefused));
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Racing, race.AttemptFailed(c_connectionRefused));
+            Assert::IsFalse(race.IsDecided());
+
+            // the connection fails with the error of the last attempt to fail
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Failed, race.AttemptFailed(c_timedOut));
+            Assert::AreEqual(c_timedOut, race.GetLastError());
+            Assert::AreEqual(ctsHappyEyeballsRace::c_noAttempt, race.GetWinner());
+            Assert::IsTrue(race.IsFinished());
+        }
+
+        TEST_METHOD(OnlyTheFirstToConnectWins)
+        {
+            ctsHappyEyeballsRace race(3);
+            Assert::AreEqual(0u, race.StartNextAttempt());
+            Assert::AreEqual(1u, race.StartNextAttempt());
+            Assert::AreEqual(2u, race.StartNextAttempt());
+
+            // attempts 2 and 0 both connect before either was closed
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Won, race.AttemptConnected(2));
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Lost, race.AttemptConnected(0));
+            Assert::IsFalse(race.IsFinished());
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Lost, race.AttemptFailed(c_connectionAborted));
+
+            Assert::AreEqual(2u, race.GetWinner());
+            Assert::IsTrue(race.IsFinished());
+        }
+
+        TEST_METHOD(AttemptFailingInlineWithAttemptsInFlight)
+        {
+            ctsHappyEyeballsRace race(3);
+            Assert::AreEqual(0u, race.StartNextAttempt());
+            Assert::AreEqual(1u, race.StartNextAttempt());
+            // attempt 1 fails as it is issued (e.g. its socket couldn't be created): attempt 0 is still connecting
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Racing, race.AttemptFailed(c_connectionRefused));
+            Assert::AreEqual(2u, race.StartNextAttempt());
+            Assert::AreEqual(2u, race.GetInFlightCount());
+
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Won, race.AttemptConnected(0));
+            Assert::AreEqual(ctsHappyEyeballsRace::Outcome::Lost, race.AttemptFailed(c_connectionAborted));
+            Assert::IsTrue(race.IsFinished());
+        }
+    };
+}
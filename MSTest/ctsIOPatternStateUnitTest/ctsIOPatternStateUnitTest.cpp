@@ -42,6 +42,10 @@ inline std::wstring ToString<ctsTraffic::ctsIoPatternType>(const ctsTraffic::cts
             return L"RecvCompletion";
         case ctsTraffic::ctsIoPatternType::SendCompletion:
             return L"SendCompletion";
+        case ctsTraffic::ctsIoPatternType::SendNextTransfer:
+            return L"SendNextTransfer";
+        case ctsTraffic::ctsIoPatternType::RecvNextTransfer:
+            return L"RecvNextTransfer";
         case ctsTraffic::ctsIoPatternType::GracefulShutdown:
             return L"GracefulShutdown";
         case ctsTraffic::ctsIoPatternType::HardShutdown:
@@ -90,7 +94,7 @@ void PrintConnectionResults(const wil::network::socket_address&, const wil::netw
 {
 }
 
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&) noexcept
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&, uint32_t) noexcept
 {
 }
 
@@ -163,9 +167,10 @@ private:
         Server
     };
 
-    void InitGracefulShutdownTest(uint64_t testTransferSize, Role _role = Client)
+    void InitGracefulShutdownTest(uint64_t testTransferSize, Role _role = Client, uint32_t transfersPerConnection = 1)
     {
         ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->TransfersPerConnection = transfersPerConnection;
         g_isListening = (Server == _role);
         g_transferSize = testTransferSize;
         m_ioPatternState = std::make_unique<ctsIoPatternState>();
@@ -177,6 +182,7 @@ private:
     void InitHardShutdownTest(uint64_t testTransferSize)
     {
         ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->TransfersPerConnection = 1;
         g_isListening = false; // client-only
         g_transferSize = testTransferSize;
         m_ioPatternState = std::make_unique<ctsIoPatternState>();
@@ -342,6 +348,62 @@ private:
         return testTask;
     }
 
+    [[nodiscard]] ctsTask RequestNextTransfer() const
+    {
+        const auto task = m_ioPatternState->GetNextPatternType();
+        if (g_isListening)
+        {
+            Assert::AreEqual(ctsIoPatternType::RecvNextTransfer, task);
+        }
+        else
+        {
+            Assert::AreEqual(ctsIoPatternType::SendNextTransfer, task);
+        }
+
+        ctsTask testTask;
+        if (g_isListening)
+        {
+            testTask.m_ioAction = ctsTaskAction::Recv;
+        }
+        else
+        {
+            testTask.m_ioAction = ctsTaskAction::Send;
+        }
+        testTask.m_trackIo = false;
+        testTask.m_bufferLength = ctsStatistics::ConnectionIdLength;
+
+        m_ioPatternState->NotifyNextTask(testTask);
+        Assert::IsFalse(m_ioPatternState->IsCompleted());
+
+        // no IO for the next transfer until the client has sent the connection id back
+        this->VerifyNoMoreIo();
+
+        return testTask;
+    }
+
+    // runs one transfer of a single IO through the exchange of the completion message
+    void RunOneTransfer(uint32_t transferSize) const
+    {
+        ctsTask testTask = this->RequestMoreIo(transferSize);
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, transferSize));
+        Assert::IsFalse(m_ioPatternState->IsCompleted());
+        Assert::AreEqual(static_cast<uint64_t>(0), m_ioPatternState->GetRemainingTransfer());
+
+        uint32_t status = NO_ERROR;
+        if (g_isListening)
+        {
+            testTask = this->RequestSendStatus(&status);
+        }
+        else
+        {
+            testTask = this->RequestRecvStatus(&status);
+            // write "DONE" in the message to complete it
+            memcpy_s(testTask.m_buffer, testTask.m_bufferLength, "DONE", 4);
+        }
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, 4));
+        Assert::IsFalse(m_ioPatternState->IsCompleted());
+    }
+
     void VerifyNoMoreIo() const
     {
         const auto noIoTask = m_ioPatternState->GetNextPatternType();
@@ -1235,5 +1297,110 @@ public:
         Assert::IsTrue(m_ioPatternState->IsCompleted());
         Assert::AreEqual(static_cast<uint64_t>(0), m_ioPatternState->GetRemainingTransfer());
     }
+
+    TEST_METHOD(TestClientMultipleTransfers)
+    {
+        this->InitGracefulShutdownTest(100, Client, 3);
+        ctsTask testTask = this->RequestConnectionId();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+
+        for (uint32_t transfer = 1; transfer <= 3; ++transfer)
+        {
+            Assert::AreEqual(transfer == 3, m_ioPatternState->IsFinalTransfer());
+            this->RunOneTransfer(100);
+            Assert::AreEqual(transfer, m_ioPatternState->GetCompletedTransfers());
+            if (transfer < 3)
+            {
+                // the next transfer starts from zero once the client sends the connection id back
+                Assert::AreEqual(static_cast<uint64_t>(100), m_ioPatternState->GetRemainingTransfer());
+                testTask = this->RequestNextTransfer();
+                Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+                Assert::IsFalse(m_ioPatternState->IsCompleted());
+            }
+        }
+
+        // only the last transfer shuts down the connection
+        testTask = this->RequestGracefulShutdown();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, 0));
+        testTask = this->RequestFin();
+        Assert::AreEqual(ctsIoPatternError::SuccessfullyCompleted, m_ioPatternState->CompletedTask(testTask, 0));
+        Assert::IsTrue(m_ioPatternState->IsCompleted());
+        this->VerifyNoMoreIo();
+    }
+
+    TEST_METHOD(TestServerMultipleTransfers)
+    {
+        this->InitGracefulShutdownTest(100, Server, 2);
+        ctsTask testTask = this->RequestConnectionId();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+
+        this->RunOneTransfer(100);
+        Assert::AreEqual(1u, m_ioPatternState->GetCompletedTransfers());
+        Assert::IsTrue(m_ioPatternState->IsFinalTransfer());
+        Assert::AreEqual(static_cast<uint64_t>(100), m_ioPatternState->GetRemainingTransfer());
+
+        // the server waits for the client to start the next transfer
+        testTask = this->RequestNextTransfer();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+
+        this->RunOneTransfer(100);
+        Assert::AreEqual(2u, m_ioPatternState->GetCompletedTransfers());
+
+        testTask = this->RequestFin();
+        Assert::AreEqual(ctsIoPatternError::SuccessfullyCompleted, m_ioPatternState->CompletedTask(testTask, 0));
+        Assert::IsTrue(m_ioPatternState->IsCompleted());
+        this->VerifyNoMoreIo();
+    }
+
+    TEST_METHOD(TestServerMultipleTransfersClientClosedEarly)
+    {
+        this->InitGracefulShutdownTest(100, Server, 2);
+        ctsTask testTask = this->RequestConnectionId();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+        this->RunOneTransfer(100);
+
+        // the client sent a FIN instead of starting the next transfer
+        testTask = this->RequestNextTransfer();
+        Assert::AreEqual(ctsIoPatternError::TooFewBytes, m_ioPatternState->CompletedTask(testTask, 0));
+        Assert::IsTrue(m_ioPatternState->IsCompleted());
+        this->VerifyNoMoreIo();
+    }
+
+    TEST_METHOD(TestClientMultipleTransfersOverlappingIo)
+    {
+        this->InitGracefulShutdownTest(100 * 2, Client, 2);
+        ctsTask testTask = this->RequestConnectionId();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+
+        for (uint32_t transfer = 1; transfer <= 2; ++transfer)
+        {
+            const ctsTask testTask1 = this->RequestMoreIo(100);
+            const ctsTask testTask2 = this->RequestMoreIo(100);
+            this->VerifyNoMoreIo();
+            Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask1, 100));
+            // the completion message isn't requested until all IO of the transfer has completed
+            this->VerifyNoMoreIo();
+            Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask2, 100));
+
+            uint32_t status = NO_ERROR;
+            testTask = this->RequestRecvStatus(&status);
+            memcpy_s(testTask.m_buffer, testTask.m_bufferLength, "DONE", 4);
+            Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, 4));
+            Assert::AreEqual(transfer, m_ioPatternState->GetCompletedTransfers());
+
+            if (1 == transfer)
+            {
+                testTask = this->RequestNextTransfer();
+                Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, ctsStatistics::ConnectionIdLength));
+                Assert::AreEqual(static_cast<uint64_t>(200), m_ioPatternState->GetRemainingTransfer());
+            }
+        }
+
+        testTask = this->RequestGracefulShutdown();
+        Assert::AreEqual(ctsIoPatternError::NoError, m_ioPatternState->CompletedTask(testTask, 0));
+        testTask = this->RequestFin();
+        Assert::AreEqual(ctsIoPatternError::SuccessfullyCompleted, m_ioPatternState->CompletedTask(testTask, 0));
+        Assert::IsTrue(m_ioPatternState->IsCompleted());
+    }
 };
 }
@@ -1,1870 +1,2221 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-#include <sdkddkver.h>
-#include "CppUnitTest.h"
-// cpp headers
-#include <memory>
-// OS headers
-#include <Windows.h>
-// ctl headers
-#include <ctTimer.hpp>
-#include <ctString.hpp>
-// project headers
-#include "ctsIOTask.hpp"
-#include "ctsConfig.h"
-#include "ctsIOPattern.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-
-using namespace Microsoft::VisualStudio::CppUnitTestFramework;
-using namespace std;
-
-namespace Microsoft::VisualStudio::CppUnitTestFramework
-{
-// Test writer must define specialization of ToString<const Q& q> types used in Assert
-template <>
-std::wstring ToString<ctsTraffic::ctsTask>(const ctsTraffic::ctsTask& task)
-{
-    return wil::str_printf<std::wstring>(
-        L"ctsIOTask:\n"
-        L"\tbuffer: 0x%p\n"
-        L"\tbuffer_length: %u\n"
-        L"\tbuffer_offset: %u\n"
-        L"\texpected_pattern_offset: %u\n"
-        L"\tioAction: %ws\n"
-        L"\trio_bufferid: %p\n"
-        L"\ttime_offset_milliseconds: %lld\n"
-        L"\tverify_io: %ws\n",
-        task.m_buffer,
-        task.m_bufferLength,
-        task.m_bufferOffset,
-        task.m_expectedPatternOffset,
-        ctsTraffic::ctsTask::PrintTaskAction(task.m_ioAction),
-        task.m_rioBufferid,
-        task.m_timeOffsetMilliseconds,
-        task.m_trackIo ? L"true" : L"false");
-}
-
-template <>
-std::wstring ToString<ctsTraffic::ctsTaskAction>(const ctsTraffic::ctsTaskAction& action)
-{
-    return ctsTraffic::ctsTask::PrintTaskAction(action);
-}
-
-template <>
-std::wstring ToString<ctsTraffic::ctsIoStatus>(const ctsTraffic::ctsIoStatus& status)
-{
-    switch (status)
-    {
-        case ctsTraffic::ctsIoStatus::ContinueIo:
-            return L"ContinueIo";
-        case ctsTraffic::ctsIoStatus::CompletedIo:
-            return L"CompletedIo";
-        case ctsTraffic::ctsIoStatus::FailedIo:
-            return L"FailedIo";
-    }
-    return L"Unknown_ctsIOStatus";
-}
-}
-
-
-///
-/// statics to return in the Fakes
-///
-int64_t g_tcpBytesPerSecond = 0LL;
-uint32_t g_MaxBufferSize = 0UL;
-uint32_t g_BufferSize = 0UL;
-uint64_t g_transferSize = 0ULL;
-bool g_IsListening = false;
-ctsTraffic::ctsConfig::MediaStreamSettings g_MediaStreamSettings;
-constexpr uint32_t g_TestRecvBufferLength = 1024;
-constexpr uint32_t g_TestBufferLength = 4;
-constexpr uint32_t g_TestErrorCode = 1;
-
-///
-/// Fakes
-///
-namespace ctsTraffic::ctsConfig
-{
-ctsConfigSettings* g_configSettings;
-
-void PrintConnectionResults(uint32_t) noexcept
-{
-}
-
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&) noexcept
-{
-}
-
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsUdpStatistics&) noexcept
-{
-}
-
-void PrintDebug(_In_ _Printf_format_string_ PCWSTR, ...) noexcept
-{
-}
-
-void PrintException(const std::exception&) noexcept
-{
-}
-
-void PrintJitterUpdate(const JitterFrameEntry&, const JitterFrameEntry&) noexcept
-{
-}
-
-void PrintErrorInfo(_In_ _Printf_format_string_ PCWSTR, ...) noexcept
-{
-}
-
-void PrintTcpDetails(const wil::network::socket_address&, const wil::network::socket_address&, SOCKET, const ctsTcpStatistics&) noexcept
-{
-}
-
-bool IsListening() noexcept
-{
-    return g_IsListening;
-}
-
-
-const MediaStreamSettings& GetMediaStream() noexcept
-{
-    return g_MediaStreamSettings;
-}
-
-int64_t GetTcpBytesPerSecond() noexcept
-{
-    return g_tcpBytesPerSecond;
-}
-
-uint32_t GetMaxBufferSize() noexcept
-{
-    return g_MaxBufferSize;
-}
-
-uint32_t GetMinBufferSize() noexcept
-{
-    return g_BufferSize;
-}
-
-uint32_t GetBufferSize() noexcept
-{
-    return g_BufferSize;
-}
-
-uint64_t GetTransferSize() noexcept
-{
-    return g_transferSize;
-}
-
-float GetStatusTimeStamp() noexcept
-{
-    return static_cast<float>((ctl::ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds) / 1000.0);
-}
-
-bool ShutdownCalled() noexcept
-{
-    return false;
-}
-
-uint32_t ConsoleVerbosity() noexcept
-{
-    return 0;
-}
-
-TcpShutdownType GetShutdownType() noexcept
-{
-    return g_configSettings->TcpShutdown;
-}
-}
-
-///
-/// End of Fakes
-///
-
-///
-/// ctsIoPattern references these global ctsConfig::Settings
-///   IoPattern
-///   TcpBytesPerSecondPeriod
-///   Protocol
-///   UseSharedBuffer
-///   ShouldVerifyBuffers
-///   PrePostRecvs
-///   PrePostSends
-///   PushBytes
-///   PullBytes
-///
-/// Must define these statics for returning relevant values to ctsIOPattern
-///   ctsSignedLongLong g_TcpBytesPerSecond
-///   uint32_t g_MaxBufferSize
-///   uint32_t g_BufferSize
-///   uint64_t g_TransferSize
-///   bool g_IsListening
-///
-
-using namespace ctsTraffic;
-
-namespace ctsUnitTest
-{
-TEST_CLASS(ctsIOPatternUnitTest_Client)
-{
-private:
-    enum TestRole : uint8_t
-    {
-        Client,
-        Server
-    };
-
-    enum TestShutdownMethod : uint8_t
-    {
-        Graceful,
-        Hard
-    };
-
-    static constexpr uint32_t DefaultTransferSize = 10UL;
-
-    void SetTestBaseClassDefaults(TestRole _role, TestShutdownMethod _shutdown = Graceful) const
-    {
-        if (Server == _role && Hard == _shutdown)
-        {
-            Assert::Fail(L"Servers only support the default Graceful shutdown");
-        }
-
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 8;
-        ctsConfig::g_configSettings->TcpShutdown = (Graceful == _shutdown) ? ctsConfig::TcpShutdownType::GracefulShutdown : ctsConfig::TcpShutdownType::HardShutdown;
-
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = DefaultTransferSize;
-        g_IsListening = (Server == _role);
-    }
-
-public:
-    TEST_CLASS_INITIALIZE(Setup)
-    {
-        ctsConfig::g_configSettings = new ctsConfig::ctsConfigSettings;
-
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 8;
-    }
-
-    TEST_CLASS_CLEANUP(Cleanup)
-    {
-        delete ctsConfig::g_configSettings;
-    }
-
-    TEST_METHOD(TestBaseClass_SuccessfulSend)
-    {
-        this->SetTestBaseClassDefaults(Client, Graceful);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        // wait for the server's FIN
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(TestBaseClass_SuccessfulMultipleSends)
-    {
-        this->SetTestBaseClassDefaults(Client, Graceful);
-        ctsConfig::g_configSettings->PrePostSends = 2;
-        g_BufferSize = DefaultTransferSize;
-        g_transferSize = DefaultTransferSize * 2;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task1 = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task1.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task1.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task1, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task1 = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task1.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task1.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task1).c_str());
-
-        const ctsTask test_task2 = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task2.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task2.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task2).c_str());
-
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task1, DefaultTransferSize, 0));
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task2, DefaultTransferSize, 0));
-
-        // recv server completion
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        // wait for the server's FIN
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(TestBaseClass_SuccessfulSend_HardShutdown)
-    {
-        this->SetTestBaseClassDefaults(Client, Hard);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate hard shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(TestBaseClass_ReceivedNoBytesWithServerStatus)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // receive server status
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(TestBaseClass_FailedReceivingServerStatus)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-    }
-
-    TEST_METHOD(TestBaseClass_FailSend)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailMultipleSends)
-    {
-        this->SetTestBaseClassDefaults(Client);
-        ctsConfig::g_configSettings->PrePostSends = 2;
-        g_BufferSize = DefaultTransferSize;
-        g_transferSize = DefaultTransferSize * 2;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task1 = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task1.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task1.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task1, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task1 = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task1.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task1.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task1).c_str());
-
-        const ctsTask test_task2 = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task2.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task2.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task2).c_str());
-
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task1, DefaultTransferSize, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task2, DefaultTransferSize, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailReceivingConnectionId)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        const ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailGracefulShutdownAfterSend)
-    {
-        this->SetTestBaseClassDefaults(Client, Graceful);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailHardShutdownAfterSend)
-    {
-        this->SetTestBaseClassDefaults(Client, Hard);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate hard shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailGracefulShutdownAFterRecv)
-    {
-        this->SetTestBaseClassDefaults(Client, Graceful);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailHardShutdownAFterRecv)
-    {
-        this->SetTestBaseClassDefaults(Client, Hard);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate hard shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestBaseClass_FailFINAfterSend)
-    {
-        this->SetTestBaseClassDefaults(Client, Graceful);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        // recv final fin
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestClientBaseClass_FailFINAfterRecv)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        // wait for the final FIN
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
-        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestClientBaseClass_TooManyBytesOnFINAfterSend)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        // recv the final FIN
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 1, 0));
-        Assert::AreEqual(static_cast<uint32_t>(c_statusErrorTooMuchDataTransferred), test_pattern->GetLastPatternError());
-    }
-
-    TEST_METHOD(TestClientBaseClass_TooManyBytesOnFINAfterRecv)
-    {
-        this->SetTestBaseClassDefaults(Client);
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        // initiate graceful shutdown
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        // recv the final FIN
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 1, 0));
-        Assert::AreEqual(static_cast<uint32_t>(c_statusErrorTooMuchDataTransferred), test_pattern->GetLastPatternError());
-    }
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///
-    ///
-    /// PushClient
-    ///
-    ///
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TEST_METHOD(PushClient_NotVerifyingBuffersNotUsingSharedBuffer_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_NotVerifyingBuffersNotUsingSharedBuffer_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_VerifyingBuffersNotUsingSharedBuffer_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_VerifyingBuffersNotUsingSharedBuffer_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_NotVerifyingBuffersUsingSharedBuffer_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = true;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_NotVerifyingBuffersUsingSharedBuffer_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = true;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_MultipleSendsWithISBEnabled)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 0;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        // ISB should indicate to keep 2 sends in flight
-        test_pattern->SetIdealSendBacklog(g_TestRecvBufferLength * 2);
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 5; ++io_count)
-        {
-            const ctsTask test_task_one = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task_one.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task_one.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_one).c_str()).c_str());
-
-            const ctsTask test_task_two = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task_two.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task_two.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_two).c_str()).c_str());
-
-            const ctsTask test_task_three = test_pattern->InitiateIo();
-            constexpr uint32_t ZeroBytes = 0;
-            Assert::AreEqual(ZeroBytes, test_task_three.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::None, test_task_three.m_ioAction);
-
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_one, g_TestRecvBufferLength, 0));
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_two, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_MultipleSendsWithISBEnabledInterleaving)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 0;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        // ISB should indicate to keep 2 sends in flight
-        test_pattern->SetIdealSendBacklog(g_TestRecvBufferLength * 2);
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 0, ToString<ctsTask>(test_task).c_str()).c_str());
-
-        for (uint32_t io_count = 1; io_count < 10; ++io_count)
-        {
-            const ctsTask test_task_one = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task_one.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task_one.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_one).c_str()).c_str());
-
-            const ctsTask test_task_three = test_pattern->InitiateIo();
-            constexpr uint32_t ZeroBytes = 0;
-            Assert::AreEqual(ZeroBytes, test_task_three.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::None, test_task_three.m_ioAction);
-
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_one, g_TestRecvBufferLength, 0));
-        }
-
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_LargeNumberOfSendsWithISBEnabled)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 0;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        // ISB should indicate to keep 2 sends in flight
-        test_pattern->SetIdealSendBacklog(static_cast<uint32_t>(g_transferSize));
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        std::vector<ctsTask> pended_tasks;
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-
-            pended_tasks.push_back(test_task);
-        }
-
-        // all are now pended, next should be empty
-        ctsTask testTaskEmpty = test_pattern->InitiateIo();
-        constexpr uint32_t ZeroBytes = 0;
-        Assert::AreEqual(ZeroBytes, testTaskEmpty.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::None, testTaskEmpty.m_ioAction);
-
-        for (uint32_t ioCount = 0; ioCount < 10; ++ioCount)
-        {
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(pended_tasks[ioCount], g_TestRecvBufferLength, 0));
-
-            // after the 10th completion, it will move to the below protocol
-            if (ioCount < 9)
-            {
-                testTaskEmpty = test_pattern->InitiateIo();
-                Assert::AreEqual(ZeroBytes, testTaskEmpty.m_bufferLength);
-                Assert::AreEqual(ctsTaskAction::None, testTaskEmpty.m_ioAction);
-            }
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_OneSendInFlightWithISBEnabledWhenISBIsSmallerThanBufferSize)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 0;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr testPattern(ctsIoPattern::MakeIoPattern());
-        // ISB should indicate to keep 1 send in flight because buffer is larger than ISB
-        testPattern->SetIdealSendBacklog(g_TestRecvBufferLength / 2);
-
-        ctsTask testTask = testPattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, testTask.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, testTask.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTask, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t ioCount = 0; ioCount < 10; ++ioCount)
-        {
-            const ctsTask testTaskLoop = testPattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, testTaskLoop.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, testTaskLoop.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", ioCount, ToString<ctsTask>(testTaskLoop).c_str()).c_str());
-
-            const ctsTask testTaskLoopTwo = testPattern->InitiateIo();
-            constexpr uint32_t ZeroBytes = 0;
-            Assert::AreEqual(ZeroBytes, testTaskLoopTwo.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::None, testTaskLoopTwo.m_ioAction);
-
-            Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTaskLoop, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        testTask = testPattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, testTask.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, testTask.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTask, 4, 0));
-
-        testTask = testPattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, testTask.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(testTask).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTask, 0, 0));
-
-        testTask = testPattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, testTask.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(testTask).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, testPattern->CompleteIo(testTask, 0, 0));
-    }
-
-    TEST_METHOD(PushClient_MultipleSendsWithISBEnabledOffsetFromBufferSize)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 0;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-        // ISB should indicate to keep 2 sends in flight
-        test_pattern->SetIdealSendBacklog(g_TestRecvBufferLength * 2 - 1);
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 5; ++io_count)
-        {
-            const ctsTask test_task_one = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task_one.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task_one.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_one).c_str()).c_str());
-
-            const ctsTask test_task_two = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task_two.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Send, test_task_two.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_two).c_str()).c_str());
-
-            const ctsTask test_task_three = test_pattern->InitiateIo();
-            constexpr uint32_t ZeroBytes = 0;
-            Assert::AreEqual(ZeroBytes, test_task_three.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::None, test_task_three.m_ioAction);
-
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_one, g_TestRecvBufferLength, 0));
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_two, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///
-    ///
-    /// PullClient
-    ///
-    ///
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength * 2;
-        g_BufferSize = g_TestRecvBufferLength * 2;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 9; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // the final recv is just 1024 bytes
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
-        // "recv" the correct bytes
-        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength * 2;
-        g_BufferSize = g_TestRecvBufferLength * 2;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 9; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // the final recv is just 1024 bytes
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
-        // "recv" the correct bytes
-        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength * 2;
-        g_BufferSize = g_TestRecvBufferLength * 2;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 9; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // the final recv is just 1024 bytes
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
-        // "recv" the correct bytes
-        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = false;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength * 2;
-        g_BufferSize = g_TestRecvBufferLength * 2;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 9; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // the final recv is just 1024 bytes
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
-        // "recv" the correct bytes
-        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_NotVerifyingBuffersUsingSharedBuffer_Graceful)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = true;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-
-    TEST_METHOD(PullClient_NotVerifyingBuffersUsingSharedBuffer_Rude)
-    {
-        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
-        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
-        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
-        ctsConfig::g_configSettings->UseSharedBuffer = true;
-        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        g_tcpBytesPerSecond = 0LL;
-        g_MaxBufferSize = g_TestRecvBufferLength;
-        g_BufferSize = g_TestRecvBufferLength;
-        g_transferSize = g_TestRecvBufferLength * 10;
-        g_IsListening = false;
-
-        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
-
-        ctsTask test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
-
-        for (uint32_t io_count = 0; io_count < 10; ++io_count)
-        {
-            test_task = test_pattern->InitiateIo();
-            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
-            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
-            // "recv" the correct bytes
-            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
-            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
-        }
-
-        // recv server completion
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
-        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
-        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
-
-        test_task = test_pattern->InitiateIo();
-        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
-        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
-        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
-    }
-};
-}
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+// cpp headers
+#include <memory>
+// OS headers
+#include <Windows.h>
+// ctl headers
+#include <ctTimer.hpp>
+#include <ctString.hpp>
+// project headers
+#include "ctsIOTask.hpp"
+#include "ctsConfig.h"
+#include "ctsIOPattern.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+// Test writer must define specialization of ToString<const Q& q> types used in Assert
+template <>
+std::wstring ToString<ctsTraffic::ctsTask>(const ctsTraffic::ctsTask& task)
+{
+    return wil::str_printf<std::wstring>(
+        L"ctsIOTask:\n"
+        L"\tbuffer: 0x%p\n"
+        L"\tbuffer_length: %u\n"
+        L"\tbuffer_offset: %u\n"
+        L"\texpected_pattern_offset: %u\n"
+        L"\tioAction: %ws\n"
+        L"\trio_bufferid: %p\n"
+        L"\ttime_offset_milliseconds: %lld\n"
+        L"\tverify_io: %ws\n",
+        task.m_buffer,
+        task.m_bufferLength,
+        task.m_bufferOffset,
+        task.m_expectedPatternOffset,
+        ctsTraffic::ctsTask::PrintTaskAction(task.m_ioAction),
+        task.m_rioBufferid,
+        task.m_timeOffsetMilliseconds,
+        task.m_trackIo ? L"true" : L"false");
+}
+
+template <>
+std::wstring ToString<ctsTraffic::ctsTaskAction>(const ctsTraffic::ctsTaskAction& action)
+{
+    return ctsTraffic::ctsTask::PrintTaskAction(action);
+}
+
+template <>
+std::wstring ToString<ctsTraffic::ctsIoStatus>(const ctsTraffic::ctsIoStatus& status)
+{
+    switch (status)
+    {
+        case ctsTraffic::ctsIoStatus::ContinueIo:
+            return L"ContinueIo";
+        case ctsTraffic::ctsIoStatus::CompletedIo:
+            return L"CompletedIo";
+        case ctsTraffic::ctsIoStatus::FailedIo:
+            return L"FailedIo";
+    }
+    return L"Unknown_ctsIOStatus";
+}
+}
+
+
+///
+/// statics to return in the Fakes
+///
+int64_t g_tcpBytesPerSecond = 0LL;
+uint32_t g_MaxBufferSize = 0UL;
+uint32_t g_BufferSize = 0UL;
+uint64_t g_transferSize = 0ULL;
+bool g_IsListening = false;
+ctsTraffic::ctsConfig::MediaStreamSettings g_MediaStreamSettings;
+constexpr uint32_t g_TestRecvBufferLength = 1024;
+constexpr uint32_t g_TestBufferLength = 4;
+constexpr uint32_t g_TestErrorCode = 1;
+
+///
+/// Fakes
+///
+namespace ctsTraffic::ctsConfig
+{
+ctsConfigSettings* g_configSettings;
+
+void PrintConnectionResults(uint32_t) noexcept
+{
+}
+
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&, uint32_t) noexcept
+{
+}
+
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsUdpStatistics&) noexcept
+{
+}
+
+void PrintDebug(_In_ _Printf_format_string_ PCWSTR, ...) noexcept
+{
+}
+
+void PrintException(const std::exception&) noexcept
+{
+}
+
+void PrintJitterUpdate(const JitterFrameEntry&, const JitterFrameEntry&) noexcept
+{
+}
+
+void PrintErrorInfo(_In_ _Printf_format_string_ PCWSTR, ...) noexcept
+{
+}
+
+void PrintTcpDetails(const wil::network::socket_address&, const wil::network::socket_address&, SOCKET, const ctsTcpStatistics&) noexcept
+{
+}
+
+bool IsListening() noexcept
+{
+    return g_IsListening;
+}
+
+
+const MediaStreamSettings& GetMediaStream() noexcept
+{
+    return g_MediaStreamSettings;
+}
+
+int64_t GetTcpBytesPerSecond() noexcept
+{
+    return g_tcpBytesPerSecond;
+}
+
+int64_t GetTcpBytesPerSecond(uint32_t) noexcept
+{
+    return g_tcpBytesPerSecond;
+}
+
+uint32_t GetMaxBufferSize() noexcept
+{
+    return g_MaxBufferSize;
+}
+
+uint32_t GetMinBufferSize() noexcept
+{
+    return g_BufferSize;
+}
+
+uint32_t GetBufferSize() noexcept
+{
+    return g_BufferSize;
+}
+
+uint32_t GetBufferSize(uint32_t) noexcept
+{
+    return g_BufferSize;
+}
+
+uint64_t GetTransferSize() noexcept
+{
+    return g_transferSize;
+}
+
+uint64_t GetTransferSize(uint32_t) noexcept
+{
+    return g_transferSize;
+}
+
+float GetStatusTimeStamp() noexcept
+{
+    return static_cast<float>((ctl::ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds) / 1000.0);
+}
+
+bool ShutdownCalled() noexcept
+{
+    return false;
+}
+
+uint32_t ConsoleVerbosity() noexcept
+{
+    return 0;
+}
+
+TcpShutdownType GetShutdownType() noexcept
+{
+    return g_configSettings->TcpShutdown;
+}
+}
+
+///
+/// End of Fakes
+///
+
+///
+/// ctsIoPattern references these global ctsConfig::Settings
+///   IoPattern
+///   TcpBytesPerSecondPeriod
+///   Protocol
+///   UseSharedBuffer
+///   ShouldVerifyBuffers
+///   PrePostRecvs
+///   PrePostSends
+///   PushBytes
+///   PullBytes
+///
+/// Must define these statics for returning relevant values to ctsIOPattern
+///   ctsSignedLongLong g_TcpBytesPerSecond
+///   uint32_t g_MaxBufferSize
+///   uint32_t g_BufferSize
+///   uint64_t g_TransferSize
+///   bool g_IsListening
+///
+
+using namespace ctsTraffic;
+
+namespace ctsUnitTest
+{
+TEST_CLASS(ctsIOPatternUnitTest_Client)
+{
+private:
+    enum TestRole : uint8_t
+    {
+        Client,
+        Server
+    };
+
+    enum TestShutdownMethod : uint8_t
+    {
+        Graceful,
+        Hard
+    };
+
+    static constexpr uint32_t DefaultTransferSize = 10UL;
+
+    void SetTestBaseClassDefaults(TestRole _role, TestShutdownMethod _shutdown = Graceful) const
+    {
+        if (Server == _role && Hard == _shutdown)
+        {
+            Assert::Fail(L"Servers only support the default Graceful shutdown");
+        }
+
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 8;
+        ctsConfig::g_configSettings->TcpShutdown = (Graceful == _shutdown) ? ctsConfig::TcpShutdownType::GracefulShutdown : ctsConfig::TcpShutdownType::HardShutdown;
+
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = DefaultTransferSize;
+        g_IsListening = (Server == _role);
+    }
+
+public:
+    TEST_CLASS_INITIALIZE(Setup)
+    {
+        ctsConfig::g_configSettings = new ctsConfig::ctsConfigSettings;
+
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 8;
+    }
+
+    TEST_CLASS_CLEANUP(Cleanup)
+    {
+        delete ctsConfig::g_configSettings;
+    }
+
+    TEST_METHOD(TestBaseClass_SuccessfulSend)
+    {
+        this->SetTestBaseClassDefaults(Client, Graceful);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        // wait for the server's FIN
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(TestBaseClass_TrafficClassStatisticsAreIsolated)
+    {
+        this->SetTestBaseClassDefaults(Client, Graceful);
+        ctsConfig::g_configSettings->TrafficClasses.emplace_back();
+        ctsConfig::g_configSettings->TrafficClasses.emplace_back();
+        const auto resetTrafficClasses = wil::scope_exit([&]() noexcept { ctsConfig::g_configSettings->TrafficClasses.clear(); });
+        auto& failingClass = ctsConfig::g_configSettings->TrafficClasses[0];
+        auto& succeedingClass = ctsConfig::g_configSettings->TrafficClasses[1];
+        failingClass.IoPattern = ctsConfig::IoPatternType::Push;
+        succeedingClass.IoPattern = ctsConfig::IoPatternType::Push;
+        const wil::network::socket_address testAddress{AF_INET};
+
+        // a connection in class 0 fails its send
+        const std::shared_ptr failing_pattern(ctsIoPattern::MakeIoPattern(0));
+        ctsTask test_task = failing_pattern->InitiateIo();
+        Assert::AreEqual(ctsIoStatus::ContinueIo, failing_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+        test_task = failing_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::FailedIo, failing_pattern->CompleteIo(test_task, DefaultTransferSize, g_TestErrorCode));
+        failing_pattern->PrintStatistics(testAddress, testAddress);
+
+        // a connection in class 1 completes its transfer
+        const std::shared_ptr succeeding_pattern(ctsIoPattern::MakeIoPattern(1));
+        Assert::AreEqual(1u, succeeding_pattern->GetTrafficClass());
+        test_task = succeeding_pattern->InitiateIo();
+        Assert::AreEqual(ctsIoStatus::ContinueIo, succeeding_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+        test_task = succeeding_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, succeeding_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+        test_task = succeeding_pattern->InitiateIo();
+        Assert::AreEqual(ctsIoStatus::ContinueIo, succeeding_pattern->CompleteIo(test_task, g_TestBufferLength, 0));
+        test_task = succeeding_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, succeeding_pattern->CompleteIo(test_task, 0, 0));
+        test_task = succeeding_pattern->InitiateIo();
+        Assert::AreEqual(ctsIoStatus::CompletedIo, succeeding_pattern->CompleteIo(test_task, 0, 0));
+        succeeding_pattern->PrintStatistics(testAddress, testAddress);
+
+        // each class only counts the bytes and completed connections of its own connections
+        Assert::AreEqual(0ll, failingClass.TcpStatusDetails.m_bytesSent.GetValue());
+        Assert::AreEqual(static_cast<int64_t>(ctsStatistics::ConnectionIdLength), failingClass.TcpStatusDetails.m_bytesRecv.GetValue());
+        Assert::AreEqual(0ll, failingClass.CompletedConnectionCount.GetValue());
+
+        Assert::AreEqual(static_cast<int64_t>(DefaultTransferSize), succeedingClass.TcpStatusDetails.m_bytesSent.GetValue());
+        Assert::AreEqual(static_cast<int64_t>(ctsStatistics::ConnectionIdLength + g_TestBufferLength), succeedingClass.TcpStatusDetails.m_bytesRecv.GetValue());
+        Assert::AreEqual(1ll, succeedingClass.CompletedConnectionCount.GetValue());
+    }
+
+    TEST_METHOD(TestBaseClass_SuccessfulMultipleSends)
+    {
+        this->SetTestBaseClassDefaults(Client, Graceful);
+        ctsConfig::g_configSettings->PrePostSends = 2;
+        g_BufferSize = DefaultTransferSize;
+        g_transferSize = DefaultTransferSize * 2;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task1 = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task1.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task1.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task1, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task1 = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task1.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task1.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task1).c_str());
+
+        const ctsTask test_task2 = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task2.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task2.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task2).c_str());
+
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task1, DefaultTransferSize, 0));
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task2, DefaultTransferSize, 0));
+
+        // recv server completion
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        // wait for the server's FIN
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(TestBaseClass_SuccessfulSend_HardShutdown)
+    {
+        this->SetTestBaseClassDefaults(Client, Hard);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate hard shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(TestBaseClass_ReceivedNoBytesWithServerStatus)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // receive server status
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(TestBaseClass_FailedReceivingServerStatus)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+    }
+
+    TEST_METHOD(TestBaseClass_FailSend)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailMultipleSends)
+    {
+        this->SetTestBaseClassDefaults(Client);
+        ctsConfig::g_configSettings->PrePostSends = 2;
+        g_BufferSize = DefaultTransferSize;
+        g_transferSize = DefaultTransferSize * 2;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task1 = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task1.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task1.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task1, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task1 = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task1.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task1.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task1).c_str());
+
+        const ctsTask test_task2 = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task2.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task2.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task2).c_str());
+
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task1, DefaultTransferSize, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task2, DefaultTransferSize, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailReceivingConnectionId)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        const ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailGracefulShutdownAfterSend)
+    {
+        this->SetTestBaseClassDefaults(Client, Graceful);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailHardShutdownAfterSend)
+    {
+        this->SetTestBaseClassDefaults(Client, Hard);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate hard shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailGracefulShutdownAFterRecv)
+    {
+        this->SetTestBaseClassDefaults(Client, Graceful);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailHardShutdownAFterRecv)
+    {
+        this->SetTestBaseClassDefaults(Client, Hard);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate hard shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestBaseClass_FailFINAfterSend)
+    {
+        this->SetTestBaseClassDefaults(Client, Graceful);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        // recv final fin
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestClientBaseClass_FailFINAfterRecv)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        // wait for the final FIN
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 0, 1));
+        Assert::AreEqual(g_TestErrorCode, test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestClientBaseClass_TooManyBytesOnFINAfterSend)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        // recv the final FIN
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 1, 0));
+        Assert::AreEqual(static_cast<uint32_t>(c_statusErrorTooMuchDataTransferred), test_pattern->GetLastPatternError());
+    }
+
+    TEST_METHOD(TestClientBaseClass_TooManyBytesOnFINAfterRecv)
+    {
+        this->SetTestBaseClassDefaults(Client);
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(DefaultTransferSize, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, DefaultTransferSize, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        // initiate graceful shutdown
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        // recv the final FIN
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(test_task, 1, 0));
+        Assert::AreEqual(static_cast<uint32_t>(c_statusErrorTooMuchDataTransferred), test_pattern->GetLastPatternError());
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// PushClient
+    ///
+    ///
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TEST_METHOD(PushClient_NotVerifyingBuffersNotUsingSharedBuffer_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_NotVerifyingBuffersNotUsingSharedBuffer_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_VerifyingBuffersNotUsingSharedBuffer_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_VerifyingBuffersNotUsingSharedBuffer_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_NotVerifyingBuffersUsingSharedBuffer_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = true;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_NotVerifyingBuffersUsingSharedBuffer_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = true;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_MultipleSendsWithISBEnabled)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 0;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        // ISB should indicate to keep 2 sends in flight
+        test_pattern->SetIdealSendBacklog(g_TestRecvBufferLength * 2);
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 5; ++io_count)
+        {
+            const ctsTask test_task_one = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task_one.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task_one.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_one).c_str()).c_str());
+
+            const ctsTask test_task_two = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task_two.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task_two.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_two).c_str()).c_str());
+
+            const ctsTask test_task_three = test_pattern->InitiateIo();
+            constexpr uint32_t ZeroBytes = 0;
+            Assert::AreEqual(ZeroBytes, test_task_three.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::None, test_task_three.m_ioAction);
+
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_one, g_TestRecvBufferLength, 0));
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_two, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_MultipleSendsWithISBEnabledInterleaving)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 0;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        // ISB should indicate to keep 2 sends in flight
+        test_pattern->SetIdealSendBacklog(g_TestRecvBufferLength * 2);
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 0, ToString<ctsTask>(test_task).c_str()).c_str());
+
+        for (uint32_t io_count = 1; io_count < 10; ++io_count)
+        {
+            const ctsTask test_task_one = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task_one.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task_one.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_one).c_str()).c_str());
+
+            const ctsTask test_task_three = test_pattern->InitiateIo();
+            constexpr uint32_t ZeroBytes = 0;
+            Assert::AreEqual(ZeroBytes, test_task_three.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::None, test_task_three.m_ioAction);
+
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_one, g_TestRecvBufferLength, 0));
+        }
+
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_LargeNumberOfSendsWithISBEnabled)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 0;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        // ISB should indicate to keep 2 sends in flight
+        test_pattern->SetIdealSendBacklog(static_cast<uint32_t>(g_transferSize));
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        std::vector<ctsTask> pended_tasks;
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+
+            pended_tasks.push_back(test_task);
+        }
+
+        // all are now pended, next should be empty
+        ctsTask testTaskEmpty = test_pattern->InitiateIo();
+        constexpr uint32_t ZeroBytes = 0;
+        Assert::AreEqual(ZeroBytes, testTaskEmpty.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::None, testTaskEmpty.m_ioAction);
+
+        for (uint32_t ioCount = 0; ioCount < 10; ++ioCount)
+        {
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(pended_tasks[ioCount], g_TestRecvBufferLength, 0));
+
+            // after the 10th completion, it will move to the below protocol
+            if (ioCount < 9)
+            {
+                testTaskEmpty = test_pattern->InitiateIo();
+                Assert::AreEqual(ZeroBytes, testTaskEmpty.m_bufferLength);
+                Assert::AreEqual(ctsTaskAction::None, testTaskEmpty.m_ioAction);
+            }
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_OneSendInFlightWithISBEnabledWhenISBIsSmallerThanBufferSize)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 0;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr testPattern(ctsIoPattern::MakeIoPattern());
+        // ISB should indicate to keep 1 send in flight because buffer is larger than ISB
+        testPattern->SetIdealSendBacklog(g_TestRecvBufferLength / 2);
+
+        ctsTask testTask = testPattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, testTask.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, testTask.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTask, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t ioCount = 0; ioCount < 10; ++ioCount)
+        {
+            const ctsTask testTaskLoop = testPattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, testTaskLoop.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, testTaskLoop.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", ioCount, ToString<ctsTask>(testTaskLoop).c_str()).c_str());
+
+            const ctsTask testTaskLoopTwo = testPattern->InitiateIo();
+            constexpr uint32_t ZeroBytes = 0;
+            Assert::AreEqual(ZeroBytes, testTaskLoopTwo.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::None, testTaskLoopTwo.m_ioAction);
+
+            Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTaskLoop, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        testTask = testPattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, testTask.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, testTask.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTask, 4, 0));
+
+        testTask = testPattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, testTask.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(testTask).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, testPattern->CompleteIo(testTask, 0, 0));
+
+        testTask = testPattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, testTask.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(testTask).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, testPattern->CompleteIo(testTask, 0, 0));
+    }
+
+    TEST_METHOD(PushClient_MultipleSendsWithISBEnabledOffsetFromBufferSize)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Push;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 0;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+        // ISB should indicate to keep 2 sends in flight
+        test_pattern->SetIdealSendBacklog(g_TestRecvBufferLength * 2 - 1);
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 5; ++io_count)
+        {
+            const ctsTask test_task_one = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task_one.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task_one.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_one).c_str()).c_str());
+
+            const ctsTask test_task_two = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task_two.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Send, test_task_two.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task_two).c_str()).c_str());
+
+            const ctsTask test_task_three = test_pattern->InitiateIo();
+            constexpr uint32_t ZeroBytes = 0;
+            Assert::AreEqual(ZeroBytes, test_task_three.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::None, test_task_three.m_ioAction);
+
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_one, g_TestRecvBufferLength, 0));
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task_two, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///
+    /// PullClient
+    ///
+    ///
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength * 2;
+        g_BufferSize = g_TestRecvBufferLength * 2;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 9; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // the final recv is just 1024 bytes
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
+        // "recv" the correct bytes
+        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_NotVerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength * 2;
+        g_BufferSize = g_TestRecvBufferLength * 2;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 9; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // the final recv is just 1024 bytes
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
+        // "recv" the correct bytes
+        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength * 2;
+        g_BufferSize = g_TestRecvBufferLength * 2;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 9; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // the final recv is just 1024 bytes
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
+        // "recv" the correct bytes
+        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_VerifyingBuffersNotUsingSharedBuffer_SmallRecvs_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength * 2;
+        g_BufferSize = g_TestRecvBufferLength * 2;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 9; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength * 2, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // the final recv is just 1024 bytes
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", 10, ToString<ctsTask>(test_task).c_str()).c_str());
+        // "recv" the correct bytes
+        memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_NotVerifyingBuffersUsingSharedBuffer_Graceful)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = true;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_NotVerifyingBuffersUsingSharedBuffer_Rude)
+    {
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = true;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t io_count = 0; io_count < 10; ++io_count)
+        {
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(g_TestRecvBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", io_count, ToString<ctsTask>(test_task).c_str()).c_str());
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, g_TestRecvBufferLength, 0));
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::HardShutdown, test_task.m_ioAction);
+        Logger::WriteMessage(ToString<ctsTask>(test_task).c_str());
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_MultipleRecvsReady_PartialCompletions)
+    {
+        // readiness-based IO (-IO:WSAPoll) keeps -PrePostRecvs tasks queued
+        // - and completes them in order, each with only the bytes a non-blocking recv returned
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 2;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 4;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        const ctsTask first_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, first_task.m_ioAction);
+        Assert::AreEqual(g_TestRecvBufferLength, first_task.m_bufferLength);
+        const ctsTask second_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, second_task.m_ioAction);
+        Assert::AreEqual(g_TestRecvBufferLength, second_task.m_bufferLength);
+        ctsTask empty_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::None, empty_task.m_ioAction);
+
+        // a partial read: the pattern asks for a new recv to replace the completed task
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(first_task, g_TestRecvBufferLength / 2, 0));
+        const ctsTask third_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, third_task.m_ioAction);
+        Assert::AreEqual(g_TestRecvBufferLength, third_task.m_bufferLength);
+        empty_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::None, empty_task.m_ioAction);
+
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(second_task, g_TestRecvBufferLength, 0));
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(third_task, g_TestRecvBufferLength, 0));
+
+        // 2.5 buffers were received: the last recv only asks for the remaining half buffer
+        const ctsTask fourth_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, fourth_task.m_ioAction);
+        Assert::AreEqual(g_TestRecvBufferLength, fourth_task.m_bufferLength);
+        const ctsTask fifth_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, fifth_task.m_ioAction);
+        Assert::AreEqual(g_TestRecvBufferLength / 2, fifth_task.m_bufferLength);
+        empty_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::None, empty_task.m_ioAction);
+
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(fourth_task, g_TestRecvBufferLength, 0));
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(fifth_task, g_TestRecvBufferLength / 2, 0));
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(PullClient_FINWhileRecvsReady)
+    {
+        // a non-blocking recv returning 0 before the transfer completes fails the connection
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::Pull;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = false;
+        ctsConfig::g_configSettings->PrePostRecvs = 2;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = g_TestRecvBufferLength;
+        g_BufferSize = g_TestRecvBufferLength;
+        g_transferSize = g_TestRecvBufferLength * 4;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        const ctsTask first_task = test_pattern->InitiateIo();
+        const ctsTask second_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, first_task.m_ioAction);
+        Assert::AreEqual(ctsTaskAction::Recv, second_task.m_ioAction);
+
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(first_task, g_TestRecvBufferLength / 2, 0));
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(second_task, 0, 0));
+    }
+
+    TEST_METHOD(IdleHoldClient_KeepAliveExchanges)
+    {
+        constexpr uint32_t keepAliveBytes = 16;
+        constexpr uint32_t keepAliveExchanges = 3;
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::IdleHold;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        ctsConfig::g_configSettings->IdleKeepAliveBytes = keepAliveBytes;
+        ctsConfig::g_configSettings->IdleKeepAliveIntervalMs = 60000;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = keepAliveBytes;
+        g_BufferSize = keepAliveBytes;
+        g_transferSize = keepAliveBytes * 2 * keepAliveExchanges;
+        g_IsListening = false;
+
+        const auto startingRoundTrips = ctsConfig::g_configSettings->KeepAliveRoundTripUsec.GetCount();
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t exchange = 0; exchange < keepAliveExchanges; ++exchange)
+        {
+            // the recv for the echo is posted before the keepalive is sent
+            ctsTask recv_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::Recv, recv_task.m_ioAction);
+            Assert::AreEqual(keepAliveBytes, recv_task.m_bufferLength);
+
+            const ctsTask send_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::Send, send_task.m_ioAction);
+            Assert::AreEqual(keepAliveBytes, send_task.m_bufferLength);
+            Logger::WriteMessage(wil::str_printf<std::wstring>(L"%u: %ws", exchange, ToString<ctsTask>(send_task).c_str()).c_str());
+            if (0 == exchange)
+            {
+                // the first keepalive is sent immediately
+                Assert::AreEqual(0LL, send_task.m_timeOffsetMilliseconds);
+            }
+            else
+            {
+                // later keepalives are paced by the keepalive interval
+                Assert::IsTrue(send_task.m_timeOffsetMilliseconds > 0);
+                Assert::IsTrue(send_task.m_timeOffsetMilliseconds <= 60000);
+            }
+
+            // only one exchange is in flight at a time
+            ctsTask empty_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::None, empty_task.m_ioAction);
+
+            // "recv" the correct bytes
+            memcpy(recv_task.m_buffer, ctsIoPattern::AccessSharedBuffer() + recv_task.m_expectedPatternOffset, recv_task.m_bufferLength);
+            if (1 == exchange)
+            {
+                // the echo completion can be processed before the send completion
+                Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(recv_task, keepAliveBytes, 0));
+                empty_task = test_pattern->InitiateIo();
+                Assert::AreEqual(ctsTaskAction::None, empty_task.m_ioAction);
+                Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(send_task, keepAliveBytes, 0));
+            }
+            else
+            {
+                Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(send_task, keepAliveBytes, 0));
+                Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(recv_task, keepAliveBytes, 0));
+            }
+
+            Assert::AreEqual(startingRoundTrips + exchange + 1, ctsConfig::g_configSettings->KeepAliveRoundTripUsec.GetCount());
+        }
+
+        // recv server completion
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+    }
+
+    TEST_METHOD(IdleHoldClient_ServerClosesBeforeEcho)
+    {
+        constexpr uint32_t keepAliveBytes = 16;
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::IdleHold;
+        ctsConfig::g_configSettings->Protocol = ctsConfig::ProtocolType::TCP;
+        ctsConfig::g_configSettings->TcpShutdown = ctsConfig::TcpShutdownType::GracefulShutdown;
+        ctsConfig::g_configSettings->UseSharedBuffer = false;
+        ctsConfig::g_configSettings->ShouldVerifyBuffers = true;
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        ctsConfig::g_configSettings->IdleKeepAliveBytes = keepAliveBytes;
+        ctsConfig::g_configSettings->IdleKeepAliveIntervalMs = 60000;
+        g_tcpBytesPerSecond = 0LL;
+        g_MaxBufferSize = keepAliveBytes;
+        g_BufferSize = keepAliveBytes;
+        g_transferSize = keepAliveBytes * 2 * 10;
+        g_IsListening = false;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        const ctsTask recv_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, recv_task.m_ioAction);
+        const ctsTask send_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Send, send_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(send_task, keepAliveBytes, 0));
+
+        // a FIN while holding the connection is a protocol failure
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(recv_task, 0, 0));
+    }
+
+    TEST_METHOD(PushPullClient_TransfersPerConnection_EachTransferStartsPushing)
+    {
+        constexpr uint32_t segmentBytes = 4;
+        this->SetTestBaseClassDefaults(Client, Graceful);
+        ctsConfig::g_configSettings->IoPattern = ctsConfig::IoPatternType::PushPull;
+        ctsConfig::g_configSettings->PushBytes = segmentBytes;
+        ctsConfig::g_configSettings->PullBytes = segmentBytes;
+        ctsConfig::g_configSettings->TransfersPerConnection = 2;
+        const auto resetTransfers = wil::scope_exit([] { ctsConfig::g_configSettings->TransfersPerConnection = 1; });
+        // each transfer ends part way into a push segment: push 4, pull 4, push 2
+        g_transferSize = segmentBytes * 2 + 2;
+
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        ctsTask test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+
+        for (uint32_t transfer = 0; transfer < 2; ++transfer)
+        {
+            if (transfer > 0)
+            {
+                // the client starts the next transfer by sending back the connection id
+                test_task = test_pattern->InitiateIo();
+                Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+                Assert::AreEqual(ctsStatistics::ConnectionIdLength, test_task.m_bufferLength);
+                Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, ctsStatistics::ConnectionIdLength, 0));
+            }
+
+            // a full push segment: not the rest of the segment the last transfer ended in
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Assert::AreEqual(segmentBytes, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, segmentBytes, 0));
+
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Assert::AreEqual(segmentBytes, test_task.m_bufferLength);
+            // "recv" the correct bytes
+            memcpy(test_task.m_buffer + test_task.m_bufferOffset, ctsIoPattern::AccessSharedBuffer() + test_task.m_expectedPatternOffset, segmentBytes);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, segmentBytes, 0));
+
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::Send, test_task.m_ioAction);
+            Assert::AreEqual(2u, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 2, 0));
+
+            // recv server completion
+            test_task = test_pattern->InitiateIo();
+            Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+            Assert::AreEqual(g_TestBufferLength, test_task.m_bufferLength);
+            Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 4, 0));
+        }
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::GracefulShutdown, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(test_task, 0, 0));
+
+        test_task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, test_task.m_ioAction);
+        Assert::AreEqual(ctsIoStatus::CompletedIo, test_pattern->CompleteIo(test_task, 0, 0));
+        Assert::AreEqual(0u, test_pattern->GetLastPatternError());
+    }
+};
+}
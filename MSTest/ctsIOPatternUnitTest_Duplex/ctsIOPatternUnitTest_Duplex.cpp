@@ -83,7 +83,7 @@ void PrintConnectionResults(uint32_t) noexcept
 {
 }
 
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&) noexcept
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&, uint32_t) noexcept
 {
 }
 
@@ -127,6 +127,11 @@ int64_t GetTcpBytesPerSecond() noexcept
     return g_tcpBytesPerSecond;
 }
 
+int64_t GetTcpBytesPerSecond(uint32_t) noexcept
+{
+    return g_tcpBytesPerSecond;
+}
+
 uint32_t GetMaxBufferSize() noexcept
 {
     return g_MaxBufferSize;
@@ -142,11 +147,21 @@ uint32_t GetBufferSize() noexcept
     return g_BufferSize;
 }
 
+uint32_t GetBufferSize(uint32_t) noexcept
+{
+    return g_BufferSize;
+}
+
 uint64_t GetTransferSize() noexcept
 {
     return g_transferSize;
 }
 
+uint64_t GetTransferSize(uint32_t) noexcept
+{
+    return g_transferSize;
+}
+
 float GetStatusTimeStamp() noexcept
 {
     return static_cast<float>((ctl::ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds) / 1000.0);
@@ -223,6 +238,7 @@ private:
         ctsConfig::g_configSettings->PrePostSends = 1;
         ctsConfig::g_configSettings->ConnectionLimit = 8;
         ctsConfig::g_configSettings->TcpShutdown = (Graceful == shutdown) ? ctsConfig::TcpShutdownType::GracefulShutdown : ctsConfig::TcpShutdownType::HardShutdown;
+        ctsConfig::g_configSettings->TransfersPerConnection = 1;
 
         g_tcpBytesPerSecond = 0LL;
         g_MaxBufferSize = g_TestRecvBufferLength;
@@ -464,6 +480,43 @@ private:
         }
     }
 
+    // ---- Multiple transfers per connection ----
+    //
+    // With -TransfersPerConnection the server sends 'DONE' at the end of each transfer, and the
+    // client starts the next one by sending the connection id back. The server receives that id
+    // into its own buffer and fails the connection if it isn't the id it sent.
+
+    // From the start of the server's first transfer: captures the connection id the server sends,
+    // completes the data phase and the 'DONE' send, then returns the pending recv of the id which
+    // starts the next transfer.
+    static ctsTask DriveServerToNextTransferId(const std::shared_ptr<ctsIoPattern>& pattern, std::vector<char>& connectionId)
+    {
+        ctsTask task = pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Send, task.m_ioAction);
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, task.m_bufferLength);
+        const char* connectionIdBuffer = task.m_buffer;
+        connectionId.assign(task.m_buffer, task.m_buffer + ctsStatistics::ConnectionIdLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, pattern->CompleteIo(task, ctsStatistics::ConnectionIdLength, NO_ERROR));
+
+        ctsTask recv_task;
+        ctsTask send_task;
+        GetPendedDataTasks(pattern, recv_task, send_task);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, CompleteDataRecv(pattern, recv_task, HalfTransferSize));
+        Assert::AreEqual(ctsIoStatus::ContinueIo, pattern->CompleteIo(send_task, HalfTransferSize, NO_ERROR));
+
+        task = pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Send, task.m_ioAction);
+        Assert::AreEqual(g_TestCompletionMessageLength, task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, pattern->CompleteIo(task, g_TestCompletionMessageLength, NO_ERROR));
+
+        task = pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, task.m_ioAction, L"server must request the id starting the next transfer");
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, task.m_bufferLength);
+        Assert::IsTrue(ctsTask::BufferType::TcpConnectionId == task.m_bufferType);
+        Assert::IsFalse(connectionIdBuffer == task.m_buffer, L"the id must not be received over the id this server sent");
+        return task;
+    }
+
 public:
     TEST_CLASS_INITIALIZE(Setup)
     {
@@ -1549,5 +1602,80 @@ public:
         CompleteSuccessfulShutdown(test_pattern, Server, Graceful);
         Assert::AreEqual(0u, test_pattern->GetLastPatternError());
     }
+
+    //
+    // ---- Multiple transfers per connection ----
+    //
+
+    // CLIENT: after 'DONE', the client sends the connection id back, and the next transfer
+    // again splits the transfer size into a send half and a recv half.
+    TEST_METHOD(Duplex_Client_TransfersPerConnection_EachTransferSendsAndRecvsHalf)
+    {
+        this->SetTestDuplexDefaults(Client, Graceful);
+        ctsConfig::g_configSettings->TransfersPerConnection = 2;
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        CompleteDataPhase(test_pattern, Client, true);
+
+        ctsTask task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Recv, task.m_ioAction);
+        Assert::AreEqual(g_TestCompletionMessageLength, task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(task, g_TestCompletionMessageLength, NO_ERROR));
+
+        task = test_pattern->InitiateIo();
+        Assert::AreEqual(ctsTaskAction::Send, task.m_ioAction, L"client must send the id starting the next transfer");
+        Assert::AreEqual(ctsStatistics::ConnectionIdLength, task.m_bufferLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(task, ctsStatistics::ConnectionIdLength, NO_ERROR));
+
+        // both halves were reset for the next transfer
+        ctsTask recv_task;
+        ctsTask send_task;
+        GetPendedDataTasks(test_pattern, recv_task, send_task);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(send_task, HalfTransferSize, NO_ERROR));
+        Assert::AreEqual(ctsIoStatus::ContinueIo, CompleteDataRecv(test_pattern, recv_task, HalfTransferSize));
+
+        CompleteSuccessfulShutdown(test_pattern, Client, Graceful);
+        Assert::AreEqual(0u, test_pattern->GetLastPatternError());
+    }
+
+    // SERVER: the id received to start the next transfer matches the id the server sent;
+    // it's received into its own buffer, then both halves are reset for the next transfer.
+    TEST_METHOD(Duplex_Server_TransfersPerConnection_NextTransferIdMatches)
+    {
+        this->SetTestDuplexDefaults(Server);
+        ctsConfig::g_configSettings->TransfersPerConnection = 2;
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        std::vector<char> connectionId;
+        const ctsTask id_task = DriveServerToNextTransferId(test_pattern, connectionId);
+        memcpy(id_task.m_buffer, connectionId.data(), ctsStatistics::ConnectionIdLength);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(id_task, ctsStatistics::ConnectionIdLength, NO_ERROR));
+
+        ctsTask recv_task;
+        ctsTask send_task;
+        GetPendedDataTasks(test_pattern, recv_task, send_task);
+        Assert::AreEqual(ctsIoStatus::ContinueIo, CompleteDataRecv(test_pattern, recv_task, HalfTransferSize));
+        Assert::AreEqual(ctsIoStatus::ContinueIo, test_pattern->CompleteIo(send_task, HalfTransferSize, NO_ERROR));
+
+        CompleteSuccessfulShutdown(test_pattern, Server, Graceful);
+        Assert::AreEqual(0u, test_pattern->GetLastPatternError());
+    }
+
+    // SERVER: a client sending back a different id fails the connection.
+    TEST_METHOD(Duplex_Server_TransfersPerConnection_NextTransferIdMismatchFails)
+    {
+        this->SetTestDuplexDefaults(Server);
+        ctsConfig::g_configSettings->TransfersPerConnection = 2;
+        const std::shared_ptr test_pattern(ctsIoPattern::MakeIoPattern());
+
+        std::vector<char> connectionId;
+        const ctsTask id_task = DriveServerToNextTransferId(test_pattern, connectionId);
+
+        std::vector<char> otherId(connectionId);
+        otherId[0] = connectionId[0] == 'x' ? 'y' : 'x';
+        memcpy(id_task.m_buffer, otherId.data(), ctsStatistics::ConnectionIdLength);
+        Assert::AreEqual(ctsIoStatus::FailedIo, test_pattern->CompleteIo(id_task, ctsStatistics::ConnectionIdLength, NO_ERROR));
+        Assert::AreEqual(static_cast<uint32_t>(c_statusErrorDataDidNotMatchBitPattern), test_pattern->GetLastPatternError());
+    }
 };
 }
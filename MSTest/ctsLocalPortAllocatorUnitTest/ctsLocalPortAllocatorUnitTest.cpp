@@ -0,0 +1,265 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for the -LocalPort:[low,high] bitmap allocator
+    - TIME_WAIT is driven from a simulated clock
+    - the exhaustion test compares against the probes the previous counter-modulo-and-retry bind would have made
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../ctsTraffic/ctsLocalPortAllocator.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    constexpr int64_t c_clockStartUsec = 5000000;
+    constexpr int64_t c_timeWaitUsec = 120000000;
+    constexpr uint16_t c_lowPort = 40000;
+    constexpr uint32_t c_threadCount = 4;
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsLocalPortAllocatorUnitTest)
+    {
+    public:
+        TEST_METHOD(EveryPortIsAllocatedOnce)
+        {
+            constexpr uint16_t highPort = c_lowPort + 999;
+            ctsLocalPortAllocator allocator(c_lowPort, highPort);
+            Assert::AreEqual(1000u, allocator.GetPortCount());
+            Assert::AreEqual(1000u, allocator.GetFreeCount());
+
+            std::vector<bool> allocated(1000);
+            for (uint32_t count = 0; count < 1000; ++count)
+            {
+                const auto port = allocator.Allocate(c_clockStartUsec);
+                Assert::IsTrue(port >= c_lowPort && port <= highPort);
+                Assert::IsFalse(allocated[port - c_lowPort]);
+                allocated[port - c_lowPort] = true;
+            }
+
+            Assert::AreEqual(0u, allocator.GetFreeCount());
+            Assert::AreEqual(static_cast<uint16_t>(0), allocator.Allocate(c_clockStartUsec));
+        }
+
+        TEST_METHOD(RangeNotAMultipleOfTheWordSize)
+        {
+            // 70 ports: one full word and 6 ports of the next
+            ctsLocalPortAllocator allocator(c_lowPort, c_lowPort + 69);
+            Assert::AreEqual(70u, allocator.GetFreeCount());
+
+            std::vector<bool> allocated(70);
+            for (uint32_t count = 0; count < 70; ++count)
+            {
+                const auto port = allocator.Allocate(c_clockStartUsec);
+                Assert::IsTrue(port >= c_lowPort && port <= c_lowPort + 69);
+                Assert::IsFalse(allocated[port - c_lowPort]);
+                allocated[port - c_lowPort] = true;
+            }
+            Assert::AreEqual(static_cast<uint16_t>(0), allocator.Allocate(c_clockStartUsec));
+
+            // a single port range
+            ctsLocalPortAllocator single(c_lowPort, c_lowPort);
+            Assert::AreEqual(c_lowPort, single.Allocate(c_clockStartUsec));
+            Assert::AreEqual(static_cast<uint16_t>(0), single.Allocate(c_clockStartUsec));
+        }
+
+        TEST_METHOD(ReleasedPortsAreReused)
+        {
+            ctsLocalPortAllocator allocator(c_lowPort, c_lowPort + 9);
+            for (uint32_t count = 0; count < 10; ++count)
+            {
+                Assert::AreNotEqual(static_cast<uint16_t>(0), allocator.Allocate(c_clockStartUsec));
+            }
+
+            // immediately reusable (e.g. the connection was reset)
+            allocator.Release(c_lowPort + 7, c_clockStartUsec);
+            Assert::AreEqual(1u, allocator.GetFreeCount());
+            Assert::AreEqual(static_cast<uint16_t>(c_lowPort + 7), allocator.Allocate(c_clockStartUsec));
+            Assert::AreEqual(static_cast<uint16_t>(0), allocator.Allocate(c_clockStartUsec));
+
+            // ports outside the range are ignored
+            allocator.Release(c_lowPort - 1, c_clockStartUsec);
+            allocator.Release(c_lowPort + 10, c_clockStartUsec);
+            Assert::AreEqual(0u, allocator.GetFreeCount());
+        }
+
+        TEST_METHOD(TimeWaitPortsAreHeldUntilReusable)
+        {
+            ctsLocalPortAllocator allocator(c_lowPort, c_lowPort + 1);
+            const auto first = allocator.Allocate(c_clockStartUsec);
+            const auto second = allocator.Allocate(c_clockStartUsec);
+            Assert::AreNotEqual(first, second);
+
+            // first closed gracefully - held in TIME_WAIT
+            allocator.Release(first, c_clockStartUsec + c_timeWaitUsec);
+            Assert::AreEqual(1u, allocator.GetFreeCount());
+            Assert::AreEqual(static_cast<uint16_t>(0), allocator.Allocate(c_clockStartUsec + 1));
+            Assert::AreEqual(static_cast<uint16_t>(0), allocator.Allocate(c_clockStartUsec + c_timeWaitUsec - 1));
+
+            // second was reset - a port out of TIME_WAIT is handed out ahead of one still in it
+            allocator.Release(second, c_clockStartUsec + 2);
+            Assert::AreEqual(second, allocator.Allocate(c_clockStartUsec + 2));
+
+            Assert::AreEqual(first, allocator.Allocate(c_clockStartUsec + c_timeWaitUsec));
+            Assert::AreEqual(0u, allocator.GetFreeCount());
+        }
+
+        TEST_METHOD(ConcurrentAllocateAndRelease)
+        {
+            // fewer ports than the threads hold at once, so the range is repeatedly exhausted
+            constexpr uint32_t portCount = 200;
+            constexpr uint32_t portsPerThread = 64;
+            constexpr uint32_t iterations = 20000;
+            ctsLocalPortAllocator allocator(c_lowPort, c_lowPort + portCount - 1);
+
+            // flags each port while a thread holds it, to catch a port handed out twice
+            const auto inUse = std::make_unique<std::atomic<bool>[]>(portCount);
+            std::atomic<uint32_t> doubleAllocations{0};
+            std::atomic<uint32_t> allocations{0};
+            std::atomic<uint32_t> exhausted{0};
+            std::atomic<uint32_t> started{0};
+
+            std::vector<std::thread> threads;
+            for (uint32_t thread = 0; thread < c_threadCount; ++thread)
+            {
+                threads.emplace_back([&] {
+                    // start together so the threads hold their ports at the same time
+                    started.fetch_add(1);
+                    while (started.load() < c_threadCount)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    std::vector<uint16_t> held;
+                    for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+                    {
+                        auto release = held.size() == portsPerThread;
+                        if (!release)
+                        {
+                            const auto port = allocator.Allocate(c_clockStartUsec);
+                            if (0 == port)
+                            {
+                                exhausted.fetch_add(1);
+                                // the other threads hold the rest of the range
+                                release = !held.empty();
+                            }
+                            else
+                            {
+                                if (inUse[port - c_lowPort].exchange(true))
+                                {
+                                    doubleAllocations.fetch_add(1);
+                                }
+                                allocations.fetch_add(1);
+                                held.push_back(port);
+                            }
+                        }
+
+                        if (release)
+                        {
+                            const auto port = held[iteration % held.size()];
+                            held[iteration % held.size()] = held.back();
+                            held.pop_back();
+                            inUse[port - c_lowPort].store(false);
+                            allocator.Release(port, c_clockStartUsec);
+                        }
+                    }
+
+                    for (const auto port : held)
+                    {
+                        inUse[port - c_lowPort].store(false);
+                        allocator.Release(port, c_clockStartUsec);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Logger::WriteMessage(wil::str_printf<std::wstring>(
+                L"%u allocations, %u found the range exhausted\n", allocations.load(), exhausted.load()).c_str());
+            Assert::AreEqual(0u, doubleAllocations.load());
+            Assert::AreEqual(portCount, allocator.GetFreeCount());
+        }
+
+        TEST_METHOD(ExhaustedRangeCost)
+        {
+            // a full 16K range held at 99% occupancy: each iteration frees one random port and allocates one
+            constexpr uint32_t portCount = 16384;
+            constexpr uint32_t held = portCount * 99 / 100;
+            constexpr uint32_t iterations = 100000;
+            ctsLocalPortAllocator allocator(c_lowPort, static_cast<uint16_t>(c_lowPort + portCount - 1));
+
+            std::vector<uint16_t> heldPorts;
+            std::vector<bool> inUse(portCount);
+            for (uint32_t count = 0; count < held; ++count)
+            {
+                const auto port = allocator.Allocate(c_clockStartUsec);
+                heldPorts.push_back(port);
+                inUse[port - c_lowPort] = true;
+            }
+
+            uint64_t moduloProbes = 0;
+            uint32_t portCounter = 0;
+            uint32_t random = 12345;
+            std::chrono::steady_clock::duration allocateTime{};
+            for (uint32_t iteration = 0; iteration < iterations; ++iteration)
+            {
+                random = random * 1103515245 + 12345;
+                const auto slot = (random >> 8) % held;
+                inUse[heldPorts[slot] - c_lowPort] = false;
+                allocator.Release(heldPorts[slot], c_clockStartUsec);
+
+                // the previous approach: the next port of a counter modulo the range, one bind attempt per port in use
+                do
+                {
+                    ++moduloProbes;
+                    ++portCounter;
+                } while (inUse[portCounter % portCount]);
+
+                const auto start = std::chrono::steady_clock::now();
+                const auto port = allocator.Allocate(c_clockStartUsec);
+                allocateTime += std::chrono::steady_clock::now() - start;
+
+                Assert::AreNotEqual(static_cast<uint16_t>(0), port);
+                Assert::IsFalse(inUse[port - c_lowPort]);
+                inUse[port - c_lowPort] = true;
+                heldPorts[slot] = port;
+            }
+
+            const auto nsPerAllocate = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(allocateTime).count()) / iterations;
+            Logger::WriteMessage(wil::str_printf<std::wstring>(
+                L"99%% of %u ports in use: %.1f ns per allocation; counter-modulo would average %.1f bind attempts per connection\n",
+                portCount, nsPerAllocate, static_cast<double>(moduloProbes) / iterations).c_str());
+            Assert::AreEqual(portCount - held, allocator.GetFreeCount());
+        }
+    };
+}
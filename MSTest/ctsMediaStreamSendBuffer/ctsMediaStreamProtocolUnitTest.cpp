@@ -15,6 +15,8 @@ See the Apache Version 2.0 License for specific language governing permissions a
 #include "CppUnitTest.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 #include <ctString.hpp>
 #include "ctsMediaStreamProtocol.hpp"
 
@@ -29,6 +31,10 @@ const ctsConfig::MediaStreamSettings& ctsConfig::GetMediaStream() noexcept
     return returnSettings;
 }
 
+void ctsConfig::PrintErrorInfo(_In_ _Printf_format_string_ PCWSTR, ...) noexcept
+{
+}
+
 template <>
 std::wstring __cdecl Microsoft::VisualStudio::CppUnitTestFramework::ToString<MediaStreamAction>(const MediaStreamAction& _message)
 {
@@ -172,7 +178,138 @@ public:
         Assert::AreEqual(MediaStreamAction::START, round_trip.m_action);
     }
 
+    TEST_METHOD(SegmentedSendRequestRoundTrip)
+    {
+        static constexpr uint32_t buffer_size = 3 * c_udpDatagramMaximumSizeBytes + 500;
+        const auto send_buffer = make_send_buffer(buffer_size);
+
+        ctsMediaStreamSendRequests testbuffer(buffer_size, SequenceNumber, send_buffer.data());
+        std::vector<char> segmented_buffer;
+        const auto segment_size = testbuffer.CopyToSegmentedBuffer(segmented_buffer);
+        Assert::AreEqual(static_cast<uint32_t>(c_udpDatagramMaximumSizeBytes), segment_size);
+        Assert::AreEqual(static_cast<size_t>(buffer_size), segmented_buffer.size());
+
+        const auto dgrams_returned = this->verify_received_datagrams(segmented_buffer, segment_size, send_buffer);
+        static constexpr uint32_t expected_datagram_count = 4;
+        Assert::AreEqual(expected_datagram_count, dgrams_returned);
+    }
+
+    TEST_METHOD(SegmentedSendRequestOneDatagram)
+    {
+        static constexpr uint32_t buffer_size = c_udpDatagramMaximumSizeBytes - 1;
+        const auto send_buffer = make_send_buffer(buffer_size);
+
+        ctsMediaStreamSendRequests testbuffer(buffer_size, SequenceNumber, send_buffer.data());
+        std::vector<char> segmented_buffer;
+        const auto segment_size = testbuffer.CopyToSegmentedBuffer(segmented_buffer);
+        Assert::AreEqual(buffer_size, segment_size);
+
+        const auto dgrams_returned = this->verify_received_datagrams(segmented_buffer, segment_size, send_buffer);
+        static constexpr uint32_t expected_datagram_count = 1;
+        Assert::AreEqual(expected_datagram_count, dgrams_returned);
+    }
+
+    TEST_METHOD(SegmentedSendRequestNonUniformDatagrams)
+    {
+        // the second datagram is shortened so the last datagram has room for the header and at least one byte
+        // - which can't be described with a single segment size
+        static constexpr uint32_t buffer_size = 2 * c_udpDatagramMaximumSizeBytes + 10;
+        const auto send_buffer = make_send_buffer(buffer_size);
+
+        ctsMediaStreamSendRequests testbuffer(buffer_size, SequenceNumber, send_buffer.data());
+        std::vector<char> segmented_buffer;
+        Assert::AreEqual(0UL, static_cast<unsigned long>(testbuffer.CopyToSegmentedBuffer(segmented_buffer)));
+    }
+
+    TEST_METHOD(CoalescedRecvUnevenTail)
+    {
+        static constexpr uint32_t segment_size = 1000;
+        static constexpr uint32_t completed_bytes = 2 * segment_size + 100;
+        static constexpr uint32_t buffer_offset = 16;
+        std::vector<char> recv_buffer(buffer_offset + completed_bytes);
+
+        ctsTask task;
+        task.m_ioAction = ctsTaskAction::Recv;
+        task.m_buffer = recv_buffer.data();
+        task.m_bufferOffset = buffer_offset;
+        task.m_bufferLength = completed_bytes;
+        task.m_coalescedSegmentSize = segment_size;
+
+        const auto datagrams = split_received_datagrams(task, completed_bytes);
+        Assert::AreEqual(static_cast<size_t>(3), datagrams.size());
+        for (uint32_t i = 0; i < datagrams.size(); ++i)
+        {
+            const auto& [datagram_task, datagram_bytes] = datagrams[i];
+            Assert::IsTrue(recv_buffer.data() + buffer_offset + i * segment_size == datagram_task.m_buffer);
+            Assert::AreEqual(0UL, static_cast<unsigned long>(datagram_task.m_bufferOffset));
+            Assert::AreEqual(0UL, static_cast<unsigned long>(datagram_task.m_coalescedSegmentSize));
+            Assert::AreEqual(i < 2 ? segment_size : 100UL, static_cast<unsigned long>(datagram_bytes));
+        }
+
+        // returning false stops at that datagram
+        uint32_t datagrams_seen = 0;
+        Assert::IsFalse(ctsMediaStreamMessage::ForEachReceivedDatagram(
+            task,
+            completed_bytes,
+            [&](const ctsTask&, uint32_t) noexcept {
+                ++datagrams_seen;
+                return false;
+            }));
+        Assert::AreEqual(1UL, static_cast<unsigned long>(datagrams_seen));
+    }
+
 private:
+    static std::vector<char> make_send_buffer(uint32_t _buffer_size)
+    {
+        std::vector<char> send_buffer(_buffer_size);
+        for (size_t i = 0; i < send_buffer.size(); ++i)
+        {
+            send_buffer[i] = static_cast<char>(i % 251);
+        }
+        return send_buffer;
+    }
+
+    // splits the segmented buffer as a coalesced receive would, verifying each datagram's header and data
+    uint32_t verify_received_datagrams(std::vector<char>& _segmented_buffer, uint32_t _segment_size, const std::vector<char>& _send_buffer) const
+    {
+        ctsTask task;
+        task.m_ioAction = ctsTaskAction::Recv;
+        task.m_buffer = _segmented_buffer.data();
+        task.m_bufferLength = static_cast<uint32_t>(_segmented_buffer.size());
+        task.m_coalescedSegmentSize = _segment_size;
+
+        uint32_t total_bytes = 0;
+        const auto datagrams = split_received_datagrams(task, task.m_bufferLength);
+        for (const auto& [datagram_task, datagram_bytes] : datagrams)
+        {
+            Assert::IsTrue(ctsMediaStreamMessage::ValidateBufferLengthFromTask(datagram_task, datagram_bytes));
+            Assert::AreEqual(c_udpDatagramProtocolHeaderFlagData, ctsMediaStreamMessage::GetProtocolHeaderFromTask(datagram_task));
+            Assert::AreEqual(SequenceNumber, ctsMediaStreamMessage::GetSequenceNumberFromTask(datagram_task));
+            // every datagram carries its data from the start of the send buffer
+            Assert::AreEqual(0, memcmp(
+                datagram_task.m_buffer + c_udpDatagramDataHeaderLength,
+                _send_buffer.data(),
+                datagram_bytes - c_udpDatagramDataHeaderLength));
+            total_bytes += datagram_bytes;
+        }
+
+        Assert::AreEqual(static_cast<uint32_t>(_segmented_buffer.size()), total_bytes);
+        return static_cast<uint32_t>(datagrams.size());
+    }
+
+    static std::vector<std::pair<ctsTask, uint32_t>> split_received_datagrams(const ctsTask& _task, uint32_t _completed_bytes)
+    {
+        std::vector<std::pair<ctsTask, uint32_t>> datagrams;
+        Assert::IsTrue(ctsMediaStreamMessage::ForEachReceivedDatagram(
+            _task,
+            _completed_bytes,
+            [&](const ctsTask& datagram_task, uint32_t datagram_bytes) noexcept {
+                datagrams.emplace_back(datagram_task, datagram_bytes);
+                return true;
+            }));
+        return datagrams;
+    }
+
     void verify_protocol_header(ctsMediaStreamSendRequests& _testbuffer) const
     {
         for (auto& buffer_array : _testbuffer)
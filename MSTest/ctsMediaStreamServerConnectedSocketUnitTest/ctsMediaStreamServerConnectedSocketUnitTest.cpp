@@ -74,7 +74,7 @@ namespace ctsConfig
     {
     }
 
-    void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&) noexcept
+    void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&, uint32_t) noexcept
     {
     }
 
@@ -242,7 +242,9 @@ public:
 };
 
 // ctsSocketState fakes
-ctsSocketState::ctsSocketState(std::weak_ptr<ctsSocketBroker>)
+ctsSocketState::ctsSocketState(std::weak_ptr<ctsSocketBroker>, uint32_t trafficClass, uint32_t brokerSlot) :
+    m_trafficClass(trafficClass),
+    m_brokerSlot(brokerSlot)
 {
 }
 
@@ -251,7 +253,8 @@ ctsSocketState::~ctsSocketState() noexcept
 }
 
 // ctsSocket fakes
-ctsSocket::ctsSocket(std::weak_ptr<ctsSocketState>) noexcept
+ctsSocket::ctsSocket(std::weak_ptr<ctsSocketState>, uint32_t trafficClass) noexcept :
+    m_trafficClass(trafficClass)
 {
     m_pattern = std::make_shared<ctsMediaStreamServerUnitTestIOPattern>();
 }
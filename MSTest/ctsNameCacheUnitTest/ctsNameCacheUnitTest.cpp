@@ -0,0 +1,213 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for -conn:ConnectByName's name cache: TTLs, coalescing lookups, and caching failures
+    - names are resolved by a mock resolver standing in for DnsQueryEx, completing each query when the test chooses
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../../ctsTraffic/ctsNameCache.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+// the waiters are connection ids
+using TestNameCache = ctsNameCache<std::wstring, uint32_t>;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+template <>
+inline std::wstring ToString<TestNameCache::LookupResult>(const TestNameCache::LookupResult& result)
+{
+    switch (result)
+    {
+        case TestNameCache::LookupResult::Hit:
+            return L"Hit";
+        case TestNameCache::LookupResult::Coalesced:
+            return L"Coalesced";
+        case TestNameCache::LookupResult::Resolve:
+            return L"Resolve";
+    }
+    return L"Unknown";
+}
+}
+
+namespace
+{
+    constexpr int64_t c_secondUsec = 1'000'000;
+    constexpr uint32_t c_hostNotFound = 11001;
+
+    // stands in for DnsQueryEx: answers from a table of records, as from a hosts file
+    class MockResolver
+    {
+    public:
+        struct Record
+        {
+            std::vector<std::wstring> m_addresses;
+            int64_t m_ttlUsec = 0;
+            uint32_t m_error = 0;
+        };
+
+        void AddName(const std::wstring& name, Record record)
+        {
+            m_records[name] = std::move(record);
+        }
+
+        // completes the query for the name, returning the waiters to continue
+        std::vector<uint32_t> CompleteQuery(TestNameCache& cache, const std::wstring& name, int64_t nowUsec)
+        {
+            ++m_queryCount;
+            const auto& record = m_records.at(name);
+            TestNameCache::Resolution resolution;
+            resolution.Addresses = record.m_addresses;
+            resolution.Error = record.m_error;
+            return cache.Complete(name, nowUsec, std::move(resolution), record.m_ttlUsec);
+        }
+
+        [[nodiscard]] uint32_t GetQueryCount() const noexcept
+        {
+            return m_queryCount;
+        }
+
+    private:
+        std::map<std::wstring, Record> m_records;
+        uint32_t m_queryCount = 0;
+    };
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsNameCacheUnitTest)
+    {
+    public:
+        TEST_METHOD(ResolvedNameIsCachedForItsTtl)
+        {
+            MockResolver resolver;
+            resolver.AddName(L"server.test", {{L"::ffff:192.0.2.1", L"2001:db8::1"}, 30 * c_secondUsec, 0});
+
+            TestNameCache cache;
+            TestNameCache::Resolution resolution;
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 0, 1, resolution));
+            const auto waiters = resolver.CompleteQuery(cache, L"server.test", 5 * c_secondUsec);
+            Assert::IsTrue(std::vector<uint32_t>{1} == waiters);
+
+            // the TTL runs from the query completing
+            Assert::AreEqual(TestNameCache::LookupResult::Hit, cache.Lookup(L"server.test", 34 * c_secondUsec, 2, resolution));
+            Assert::AreEqual(0u, resolution.Error);
+            Assert::IsTrue(std::vector<std::wstring>{L"::ffff:192.0.2.1", L"2001:db8::1"} == resolution.Addresses);
+
+            // expired: the name is queried again
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 35 * c_secondUsec, 3, resolution));
+            Assert::IsTrue(std::vector<uint32_t>{3} == resolver.CompleteQuery(cache, L"server.test", 36 * c_secondUsec));
+            Assert::AreEqual(2u, resolver.GetQueryCount());
+        }
+
+        TEST_METHOD(ConcurrentLookupsShareOneQuery)
+        {
+            MockResolver resolver;
+            resolver.AddName(L"server.test", {{L"2001:db8::1"}, 60 * c_secondUsec, 0});
+
+            TestNameCache cache;
+            TestNameCache::Resolution resolution;
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 0, 1, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Coalesced, cache.Lookup(L"server.test", 10, 2, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Coalesced, cache.Lookup(L"server.test", 20, 3, resolution));
+
+            // every connection waiting on the name continues from the one query, in the order they looked it up
+            const std::vector<uint32_t> expected{1, 2, 3};
+            Assert::IsTrue(expected == resolver.CompleteQuery(cache, L"server.test", 100));
+            Assert::AreEqual(1u, resolver.GetQueryCount());
+
+            Assert::AreEqual(TestNameCache::LookupResult::Hit, cache.Lookup(L"server.test", 200, 4, resolution));
+        }
+
+        TEST_METHOD(ExpiredNameCoalescesWhileRequeried)
+        {
+            MockResolver resolver;
+            resolver.AddName(L"server.test", {{L"2001:db8::1"}, c_secondUsec, 0});
+
+            TestNameCache cache;
+            TestNameCache::Resolution resolution;
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 0, 1, resolution));
+            resolver.CompleteQuery(cache, L"server.test", 0);
+
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 2 * c_secondUsec, 2, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Coalesced, cache.Lookup(L"server.test", 2 * c_secondUsec, 3, resolution));
+            const std::vector<uint32_t> expected{2, 3};
+            Assert::IsTrue(expected == resolver.CompleteQuery(cache, L"server.test", 3 * c_secondUsec));
+        }
+
+        TEST_METHOD(ZeroTtlIsNotCached)
+        {
+            MockResolver resolver;
+            resolver.AddName(L"server.test", {{L"2001:db8::1"}, 0, 0});
+
+            TestNameCache cache;
+            TestNameCache::Resolution resolution;
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 0, 1, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Coalesced, cache.Lookup(L"server.test", 0, 2, resolution));
+            Assert::AreEqual(size_t{2}, resolver.CompleteQuery(cache, L"server.test", 10).size());
+
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"server.test", 10, 3, resolution));
+        }
+
+        TEST_METHOD(FailedResolutionIsCachedBriefly)
+        {
+            MockResolver resolver;
+            resolver.AddName(L"missing.test", {{}, 300 * c_secondUsec, c_hostNotFound});
+
+            TestNameCache cache;
+            TestNameCache::Resolution resolution;
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"missing.test", 0, 1, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Coalesced, cache.Lookup(L"missing.test", 0, 2, resolution));
+            Assert::AreEqual(size_t{2}, resolver.CompleteQuery(cache, L"missing.test", 0).size());
+
+            // connections fail from the cache rather than each querying the name
+            Assert::AreEqual(TestNameCache::LookupResult::Hit, cache.Lookup(L"missing.test", TestNameCache::c_failedResolutionUsec - 1, 3, resolution));
+            Assert::AreEqual(c_hostNotFound, resolution.Error);
+            Assert::IsTrue(resolution.Addresses.empty());
+
+            // failures are kept for c_failedResolutionUsec, not the TTL the resolver reported
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"missing.test", TestNameCache::c_failedResolutionUsec, 4, resolution));
+        }
+
+        TEST_METHOD(NamesAreCachedIndependently)
+        {
+            MockResolver resolver;
+            resolver.AddName(L"first.test", {{L"2001:db8::1"}, 60 * c_secondUsec, 0});
+            resolver.AddName(L"second.test", {{L"::ffff:192.0.2.2"}, 60 * c_secondUsec, 0});
+
+            TestNameCache cache;
+            TestNameCache::Resolution resolution;
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"first.test", 0, 1, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Resolve, cache.Lookup(L"second.test", 0, 2, resolution));
+            Assert::IsTrue(std::vector<uint32_t>{2} == resolver.CompleteQuery(cache, L"second.test", 10));
+
+            // first.test is still being resolved
+            Assert::AreEqual(TestNameCache::LookupResult::Coalesced, cache.Lookup(L"first.test", 20, 3, resolution));
+            Assert::AreEqual(TestNameCache::LookupResult::Hit, cache.Lookup(L"second.test", 20, 4, resolution));
+            Assert::IsTrue(std::vector<std::wstring>{L"::ffff:192.0.2.2"} == resolution.Addresses);
+
+            const std::vector<uint32_t> expected{1, 3};
+            Assert::IsTrue(expected == resolver.CompleteQuery(cache, L"first.test", 30));
+        }
+    };
+}
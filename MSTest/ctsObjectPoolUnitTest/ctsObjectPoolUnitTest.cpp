@@ -0,0 +1,323 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for the ctsObjectPool pools
+    - the connection lifecycle test drives the pools the way ctsSocketState, ctsSocket and ctsIoPattern do,
+      with mock objects in place of the sockets
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <array>
+#include <future>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "../../ctsTraffic/ctsObjectPool.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    // stand-ins for the per-connection objects: each a distinct size, as the real objects are
+    struct MockSocketState : std::enable_shared_from_this<MockSocketState>
+    {
+        std::array<char, 200> m_state{};
+    };
+
+    struct MockSocket
+    {
+        std::shared_ptr<MockSocketState> m_parent;
+        std::array<char, 500> m_socket{};
+    };
+
+    struct MockIoPattern
+    {
+        std::array<char, 1000> m_pattern{};
+    };
+
+    struct WorkContext
+    {
+        wil::unique_event m_completed{wil::EventOptions::None};
+        void* m_lastContext = nullptr;
+    };
+
+    WorkContext g_workContext;
+
+    VOID NTAPI MockWorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK) noexcept
+    {
+        g_workContext.m_lastContext = context;
+        g_workContext.m_completed.SetEvent();
+    }
+
+    // the block and buffer pools are per-thread: running each test on a new thread starts it with empty pools
+    template <typename T>
+    void RunOnNewThread(T&& test)
+    {
+        std::async(std::launch::async, std::forward<T>(test)).get();
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsObjectPoolUnitTest)
+    {
+    public:
+        TEST_METHOD_INITIALIZE(MethodSetup)
+        {
+            ctsObjectPoolStatistics::Reset();
+        }
+
+        TEST_METHOD(AllocateSharedReusesFreedBlocks)
+        {
+            RunOnNewThread([] {
+                auto first = std::allocate_shared<MockIoPattern>(ctsPoolAllocator<MockIoPattern>{});
+                const void* const firstAddress = first.get();
+                first.reset();
+                Assert::AreEqual(1ll, ctsObjectPoolStatistics::GetHeapAllocations());
+
+                const auto second = std::allocate_shared<MockIoPattern>(ctsPoolAllocator<MockIoPattern>{});
+                Assert::IsTrue(firstAddress == second.get());
+                Assert::AreEqual(1ll, ctsObjectPoolStatistics::GetHeapAllocations());
+                Assert::AreEqual(1ll, ctsObjectPoolStatistics::GetReused());
+            });
+        }
+
+        TEST_METHOD(EnableSharedFromThisWorksWithPooledObjects)
+        {
+            const auto state = std::allocate_shared<MockSocketState>(ctsPoolAllocator<MockSocketState>{});
+            const auto sharedState = state->shared_from_this();
+            Assert::IsTrue(state.get() == sharedState.get());
+            Assert::AreEqual(2l, state.use_count());
+        }
+
+        TEST_METHOD(FreeBlocksAreBounded)
+        {
+            RunOnNewThread([] {
+                using Blocks = ctsPooledBlocks<64>;
+                std::vector<void*> blocks;
+                for (uint32_t count = 0; count < Blocks::c_maxFreeBlocks + 10; ++count)
+                {
+                    blocks.push_back(Blocks::Allocate());
+                }
+                Assert::AreEqual(0u, Blocks::GetFreeCount());
+
+                const auto overflowCount = Blocks::GetOverflowCount();
+                for (auto* block : blocks)
+                {
+                    Blocks::Free(block);
+                }
+                // blocks freed beyond the bound go to the overflow list
+                Assert::IsTrue(Blocks::GetFreeCount() <= Blocks::c_maxFreeBlocks);
+                Assert::AreEqual(
+                    static_cast<uint32_t>(blocks.size()),
+                    Blocks::GetFreeCount() + Blocks::GetOverflowCount() - overflowCount);
+
+                // which is bounded as well: beyond it they go back to the heap
+                for (uint32_t count = 0; count < Blocks::c_maxOverflowBlocks + Blocks::c_maxFreeBlocks; ++count)
+                {
+                    Blocks::Free(::operator new(64));
+                }
+                Assert::IsTrue(Blocks::GetOverflowCount() <= Blocks::c_maxOverflowBlocks);
+            });
+        }
+
+        TEST_METHOD(RecycledBuffersAreMatchedBySize)
+        {
+            RunOnNewThread([] {
+                auto buffer = ctsRecycledBuffers::Acquire(4096);
+                Assert::AreEqual(size_t{4096}, buffer.size());
+                const auto* const bufferData = buffer.data();
+                ctsRecycledBuffers::Release(std::move(buffer));
+                Assert::AreEqual(size_t{1}, ctsRecycledBuffers::GetFreeCount());
+
+                // a different size can't use it
+                const auto otherBuffer = ctsRecycledBuffers::Acquire(8192);
+                Assert::AreEqual(size_t{8192}, otherBuffer.size());
+                Assert::AreEqual(size_t{1}, ctsRecycledBuffers::GetFreeCount());
+
+                const auto recycledBuffer = ctsRecycledBuffers::Acquire(4096);
+                Assert::IsTrue(bufferData == recycledBuffer.data());
+                Assert::AreEqual(size_t{0}, ctsRecycledBuffers::GetFreeCount());
+                Assert::AreEqual(2ll, ctsObjectPoolStatistics::GetHeapAllocations());
+                Assert::AreEqual(1ll, ctsObjectPoolStatistics::GetReused());
+            });
+        }
+
+        TEST_METHOD(RecycledBuffersAreBounded)
+        {
+            RunOnNewThread([] {
+                std::vector<std::vector<char>> buffers;
+                for (size_t count = 0; count < ctsRecycledBuffers::c_maxFreeBuffers + 10; ++count)
+                {
+                    buffers.emplace_back(ctsRecycledBuffers::Acquire(100));
+                }
+                const auto overflowCount = ctsRecycledBuffers::GetOverflowCount();
+                for (auto& buffer : buffers)
+                {
+                    ctsRecycledBuffers::Release(std::move(buffer));
+                }
+                Assert::AreEqual(ctsRecycledBuffers::c_maxFreeBuffers, ctsRecycledBuffers::GetFreeCount());
+                Assert::AreEqual(size_t{10}, ctsRecycledBuffers::GetOverflowCount() - overflowCount);
+
+                // the thread's own buffers are taken first, then those in the overflow list
+                // - all are taken back before the thread exits, so the overflow list is left as the test found it
+                for (auto& buffer : buffers)
+                {
+                    buffer = ctsRecycledBuffers::Acquire(100);
+                }
+                Assert::AreEqual(size_t{0}, ctsRecycledBuffers::GetFreeCount());
+                Assert::AreEqual(overflowCount, ctsRecycledBuffers::GetOverflowCount());
+            });
+        }
+
+        TEST_METHOD(ObjectsFreedOnAnotherThreadAreReused)
+        {
+            // e.g. connections created on one thread and closed on another
+            using Blocks = ctsPooledBlocks<48>;
+            constexpr uint32_t blockCount = Blocks::c_maxFreeBlocks * 2;
+            constexpr size_t bufferCount = ctsRecycledBuffers::c_maxFreeBuffers * 2;
+            constexpr size_t bufferSize = 3000;
+
+            std::vector<void*> blocks;
+            std::vector<std::vector<char>> buffers;
+            RunOnNewThread([&] {
+                for (uint32_t count = 0; count < blockCount; ++count)
+                {
+                    blocks.push_back(Blocks::Allocate());
+                }
+                for (size_t count = 0; count < bufferCount; ++count)
+                {
+                    buffers.emplace_back(ctsRecycledBuffers::Acquire(bufferSize));
+                }
+            });
+
+            uint32_t freedBlocksKept = 0;
+            RunOnNewThread([&] {
+                for (auto* block : blocks)
+                {
+                    Blocks::Free(block);
+                }
+                for (auto& buffer : buffers)
+                {
+                    ctsRecycledBuffers::Release(std::move(buffer));
+                }
+                freedBlocksKept = Blocks::GetFreeCount();
+            });
+            // what the freeing thread could not keep went to the overflow list
+            Assert::AreEqual(blockCount - freedBlocksKept, Blocks::GetOverflowCount());
+            Assert::AreEqual(ctsRecycledBuffers::c_maxFreeBuffers, ctsRecycledBuffers::GetOverflowCount());
+
+            ctsObjectPoolStatistics::Reset();
+            RunOnNewThread([&] {
+                const std::set<void*> freedBlocks(blocks.begin(), blocks.end());
+                const auto overflowCount = Blocks::GetOverflowCount();
+                for (uint32_t count = 0; count < overflowCount; ++count)
+                {
+                    blocks[count] = Blocks::Allocate();
+                    Assert::IsTrue(freedBlocks.contains(blocks[count]));
+                }
+                Assert::AreEqual(0u, Blocks::GetOverflowCount());
+                for (uint32_t count = 0; count < overflowCount; ++count)
+                {
+                    Blocks::Free(blocks[count]);
+                }
+
+                for (size_t count = 0; count < ctsRecycledBuffers::c_maxFreeBuffers; ++count)
+                {
+                    buffers[count] = ctsRecycledBuffers::Acquire(bufferSize);
+                }
+                Assert::AreEqual(size_t{0}, ctsRecycledBuffers::GetOverflowCount());
+            });
+            Assert::AreEqual(0ll, ctsObjectPoolStatistics::GetHeapAllocations());
+            Assert::AreEqual(
+                static_cast<int64_t>(blockCount - freedBlocksKept + ctsRecycledBuffers::c_maxFreeBuffers),
+                ctsObjectPoolStatistics::GetReused());
+        }
+
+        TEST_METHOD(ThreadpoolWorkIsReusedWithNewContext)
+        {
+            int firstContext{};
+            int secondContext{};
+
+            PTP_WORK firstWork{};
+            {
+                ctsPooledThreadpoolWork work(MockWorkCallback, &firstContext, nullptr);
+                firstWork = work.get();
+                SubmitThreadpoolWork(work.get());
+                Assert::IsTrue(g_workContext.m_completed.wait(5000));
+                Assert::IsTrue(&firstContext == g_workContext.m_lastContext);
+            }
+
+            // the work pool is process-wide: the first work object may also have come from an earlier test
+            ctsPooledThreadpoolWork work(MockWorkCallback, &secondContext, nullptr);
+            Assert::IsTrue(firstWork == work.get());
+            SubmitThreadpoolWork(work.get());
+            Assert::IsTrue(g_workContext.m_completed.wait(5000));
+            Assert::IsTrue(&secondContext == g_workContext.m_lastContext);
+            Assert::AreEqual(2ll, ctsObjectPoolStatistics::GetHeapAllocations() + ctsObjectPoolStatistics::GetReused());
+            Assert::IsTrue(ctsObjectPoolStatistics::GetReused() >= 1);
+        }
+
+        TEST_METHOD(ConnectionLifecycleStopsAllocating)
+        {
+            RunOnNewThread([] {
+                constexpr auto connectionCount = 100000;
+                constexpr size_t recvBufferSize = 64 * 1024;
+
+                const auto runConnection = [] {
+                    const auto state = std::allocate_shared<MockSocketState>(ctsPoolAllocator<MockSocketState>{});
+                    ctsPooledThreadpoolWork work(MockWorkCallback, state.get(), nullptr);
+                    const auto socket = std::allocate_shared<MockSocket>(ctsPoolAllocator<MockSocket>{});
+                    socket->m_parent = state;
+                    const auto pattern = std::allocate_shared<MockIoPattern>(ctsPoolAllocator<MockIoPattern>{});
+                    auto recvBuffer = ctsRecycledBuffers::Acquire(recvBufferSize);
+                    recvBuffer[0] = 1;
+                    ctsRecycledBuffers::Release(std::move(recvBuffer));
+                };
+
+                // the first connection allocates everything but the threadpool work, which earlier tests may have pooled
+                runConnection();
+                const auto firstConnectionAllocations = ctsObjectPoolStatistics::GetHeapAllocations();
+                const auto firstConnectionReused = ctsObjectPoolStatistics::GetReused();
+                Assert::IsTrue(firstConnectionAllocations >= 4 && firstConnectionAllocations <= 5);
+                Assert::AreEqual(5ll, firstConnectionAllocations + firstConnectionReused);
+
+                const auto startTime = GetTickCount64();
+                for (auto count = 0; count < connectionCount; ++count)
+                {
+                    runConnection();
+                }
+                const auto elapsedMs = GetTickCount64() - startTime;
+
+                // every later connection reuses what the one before it released
+                Assert::AreEqual(firstConnectionAllocations, ctsObjectPoolStatistics::GetHeapAllocations());
+                Assert::AreEqual(firstConnectionReused + 5ll * connectionCount, ctsObjectPoolStatistics::GetReused());
+                Logger::WriteMessage(wil::str_printf<std::wstring>(
+                    L"%d connection lifecycles in %llu ms (%.0f per second), %.4f heap allocations per connection\n",
+                    connectionCount,
+                    elapsedMs,
+                    elapsedMs > 0 ? connectionCount * 1000.0 / static_cast<double>(elapsedMs) : 0.0,
+                    static_cast<double>(ctsObjectPoolStatistics::GetHeapAllocations()) / (connectionCount + 1)).c_str());
+            });
+        }
+    };
+}
@@ -0,0 +1,309 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for -IO:Quic streams: assigning client streams to connections, accepting peer streams,
+    and completing send and recv tasks
+    - the data MsQuic would indicate on a stream is built by the test, in memory
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../ctsTraffic/ctsQuicStream.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    // stands in for QUIC_BUFFER
+    struct TestBuffer
+    {
+        uint32_t Length;
+        uint8_t* Buffer;
+    };
+
+    // stands in for ctsTask: only the buffer fields are used
+    struct TestTask
+    {
+        char* m_buffer = nullptr;
+        uint32_t m_bufferOffset = 0;
+        uint32_t m_bufferLength = 0;
+    };
+
+    struct TestSocket
+    {
+        uint32_t m_id = 0;
+    };
+
+    struct TestStream
+    {
+        uint32_t m_id = 0;
+    };
+
+    using TestReceiveQueue = ctsQuicReceiveQueue<TestBuffer, TestTask>;
+    using TestAcceptQueue = ctsQuicAcceptQueue<TestSocket, TestStream>;
+
+    constexpr uint32_t c_connectionAborted = 10053;
+    constexpr uint32_t c_connectionReset = 10054;
+
+    // the buffers of one RECEIVE indication, built from strings
+    class Indication
+    {
+    public:
+        explicit Indication(const std::vector<std::string>& segments)
+        {
+            m_segments.reserve(segments.size());
+            for (const auto& segment : segments)
+            {
+                m_segments.emplace_back(segment.begin(), segment.end());
+                m_buffers.push_back({static_cast<uint32_t>(segment.size()), m_segments.back().data()});
+                m_totalLength += segment.size();
+            }
+        }
+
+        void HoldIn(TestReceiveQueue& queue) const
+        {
+            queue.Hold(m_buffers.data(), static_cast<uint32_t>(m_buffers.size()), m_totalLength);
+        }
+
+        [[nodiscard]] uint64_t GetTotalLength() const noexcept
+        {
+            return m_totalLength;
+        }
+
+    private:
+        std::vector<std::vector<uint8_t>> m_segments;
+        std::vector<TestBuffer> m_buffers;
+        uint64_t m_totalLength = 0;
+    };
+
+    struct Completion
+    {
+        TestTask m_task;
+        uint32_t m_transferred = 0;
+        uint32_t m_error = 0;
+    };
+
+    std::vector<Completion> CompleteAvailable(TestReceiveQueue& queue)
+    {
+        std::vector<Completion> completions;
+        Completion completion;
+        while (queue.CompleteNext(completion.m_task, completion.m_transferred, completion.m_error))
+        {
+            completions.push_back(completion);
+        }
+        return completions;
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsQuicStreamUnitTest)
+    {
+    public:
+        TEST_METHOD(ClientStreamsShareAConnectionUntilItIsFull)
+        {
+            ctsQuicStreamSlots slots(3);
+            Assert::IsTrue(slots.TryAssign());
+            Assert::IsTrue(slots.TryAssign());
+            Assert::IsTrue(slots.TryAssign());
+            // the next stream opens a new connection
+            Assert::IsFalse(slots.TryAssign());
+            Assert::AreEqual(3u, slots.GetAssignedCount());
+
+            // the connection is shut down once its last stream closes
+            Assert::IsFalse(slots.Close());
+            Assert::IsFalse(slots.Close());
+            Assert::IsTrue(slots.Close());
+        }
+
+        TEST_METHOD(ConnectionStaysOpenForStreamsNotYetAssigned)
+        {
+            ctsQuicStreamSlots slots(3);
+            Assert::IsTrue(slots.TryAssign());
+            Assert::IsFalse(slots.Close());
+
+            // later streams still open on the same connection
+            Assert::IsTrue(slots.TryAssign());
+            Assert::IsTrue(slots.TryAssign());
+            Assert::IsFalse(slots.Close());
+            Assert::IsTrue(slots.Close());
+        }
+
+        TEST_METHOD(PeerStreamsWaitForAcceptsInOrder)
+        {
+            TestAcceptQueue queue;
+            const auto first = std::make_shared<TestStream>(TestStream{1});
+            const auto second = std::make_shared<TestStream>(TestStream{2});
+            Assert::IsNull(queue.StreamStarted(first).get());
+            Assert::IsNull(queue.StreamStarted(second).get());
+            Assert::AreEqual(size_t{2}, queue.GetPendingStreamCount());
+
+            const auto socket = std::make_shared<TestSocket>(TestSocket{10});
+            Assert::AreEqual(1u, queue.Accept(socket)->m_id);
+            Assert::AreEqual(2u, queue.Accept(socket)->m_id);
+            Assert::AreEqual(size_t{0}, queue.GetPendingStreamCount());
+            Assert::AreEqual(size_t{0}, queue.GetPendingAcceptCount());
+        }
+
+        TEST_METHOD(AcceptsWaitForPeerStreamsSkippingClosedSockets)
+        {
+            TestAcceptQueue queue;
+            auto closedSocket = std::make_shared<TestSocket>(TestSocket{10});
+            const auto openSocket = std::make_shared<TestSocket>(TestSocket{11});
+            Assert::IsNull(queue.Accept(closedSocket).get());
+            Assert::IsNull(queue.Accept(openSocket).get());
+            Assert::AreEqual(size_t{2}, queue.GetPendingAcceptCount());
+            closedSocket.reset();
+
+            // the stream goes to the first accept whose socket is still open
+            const auto accepting = queue.StreamStarted(std::make_shared<TestStream>(TestStream{1}));
+            Assert::IsNotNull(accepting.get());
+            Assert::AreEqual(11u, accepting->m_id);
+            Assert::AreEqual(size_t{0}, queue.GetPendingAcceptCount());
+
+            // no accepts remain: the next stream waits
+            Assert::IsNull(queue.StreamStarted(std::make_shared<TestStream>(TestStream{2})).get());
+            Assert::AreEqual(size_t{1}, queue.GetPendingStreamCount());
+        }
+
+        TEST_METHOD(RecvWaitsForData)
+        {
+            TestReceiveQueue queue;
+            char buffer[8]{};
+            queue.AddTask({buffer, 0, sizeof buffer});
+            Assert::IsTrue(CompleteAvailable(queue).empty());
+            Assert::AreEqual(size_t{1}, queue.GetTaskCount());
+
+            const Indication indication({"abc"});
+            indication.HoldIn(queue);
+            const auto completions = CompleteAvailable(queue);
+            // completes with what was received, as a TCP recv would
+            Assert::AreEqual(size_t{1}, completions.size());
+            Assert::AreEqual(3u, completions[0].m_transferred);
+            Assert::AreEqual(0u, completions[0].m_error);
+            Assert::AreEqual(0, memcmp(buffer, "abc", 3));
+            Assert::IsFalse(queue.IsHoldingData());
+            Assert::AreEqual(indication.GetTotalLength(), queue.ReleaseHeld());
+        }
+
+        TEST_METHOD(IndicatedBuffersSpanRecvTasks)
+        {
+            TestReceiveQueue queue;
+            char first[4]{};
+            char second[16]{};
+            queue.AddTask({first, 0, sizeof first});
+            queue.AddTask({second, 2, 10});
+
+            const Indication indication({"abc", "defgh", "ij"});
+            indication.HoldIn(queue);
+            const auto completions = CompleteAvailable(queue);
+
+            Assert::AreEqual(size_t{2}, completions.size());
+            Assert::IsTrue(first == completions[0].m_task.m_buffer);
+            Assert::AreEqual(4u, completions[0].m_transferred);
+            Assert::AreEqual(0, memcmp(first, "abcd", 4));
+            // copied from the task's offset into its buffer
+            Assert::IsTrue(second == completions[1].m_task.m_buffer);
+            Assert::AreEqual(6u, completions[1].m_transferred);
+            Assert::AreEqual(0, memcmp(second + 2, "efghij", 6));
+
+            // MsQuic is returned the whole indication once it was all copied out
+            Assert::IsFalse(queue.IsHoldingData());
+            Assert::AreEqual(uint64_t{10}, queue.ReleaseHeld());
+        }
+
+        TEST_METHOD(DataIsHeldUntilRecvsArePosted)
+        {
+            TestReceiveQueue queue;
+            // e.g. a server stream receiving data before it was accepted
+            const Indication indication({"abcdef"});
+            indication.HoldIn(queue);
+            Assert::IsTrue(CompleteAvailable(queue).empty());
+            Assert::IsTrue(queue.IsHoldingData());
+
+            char buffer[4]{};
+            queue.AddTask({buffer, 0, sizeof buffer});
+            auto completions = CompleteAvailable(queue);
+            Assert::AreEqual(size_t{1}, completions.size());
+            Assert::AreEqual(4u, completions[0].m_transferred);
+            // the rest is still held for the next recv
+            Assert::IsTrue(queue.IsHoldingData());
+
+            queue.AddTask({buffer, 0, sizeof buffer});
+            completions = CompleteAvailable(queue);
+            Assert::AreEqual(size_t{1}, completions.size());
+            Assert::AreEqual(2u, completions[0].m_transferred);
+            Assert::AreEqual(0, memcmp(buffer, "ef", 2));
+            Assert::IsFalse(queue.IsHoldingData());
+        }
+
+        TEST_METHOD(FinCompletesRecvsWithZeroBytesOnceDataIsConsumed)
+        {
+            TestReceiveQueue queue;
+            const Indication indication({"abc"});
+            indication.HoldIn(queue);
+            queue.Finish(0);
+
+            char first[8]{};
+            char second[8]{};
+            queue.AddTask({first, 0, sizeof first});
+            queue.AddTask({second, 0, sizeof second});
+            const auto completions = CompleteAvailable(queue);
+
+            // the data received before the FIN is completed first
+            Assert::AreEqual(size_t{2}, completions.size());
+            Assert::AreEqual(3u, completions[0].m_transferred);
+            Assert::AreEqual(0u, completions[1].m_transferred);
+            Assert::AreEqual(0u, completions[1].m_error);
+        }
+
+        TEST_METHOD(AbortCompletesRecvsWithTheFirstError)
+        {
+            TestReceiveQueue queue;
+            char buffer[8]{};
+            queue.AddTask({buffer, 0, sizeof buffer});
+            queue.Finish(c_connectionReset);
+            // e.g. the stream then shuts down
+            queue.Finish(c_connectionAborted);
+
+            const auto completions = CompleteAvailable(queue);
+            Assert::AreEqual(size_t{1}, completions.size());
+            Assert::AreEqual(0u, completions[0].m_transferred);
+            Assert::AreEqual(c_connectionReset, completions[0].m_error);
+            Assert::AreEqual(c_connectionReset, queue.GetError());
+        }
+
+        TEST_METHOD(SendCompletesWithItsFullLengthUnlessCanceled)
+        {
+            char buffer[32]{};
+            const TestTask task{buffer, 8, 24};
+
+            const auto sent = ctsQuicCompleteSend(task, false, c_connectionAborted);
+            Assert::AreEqual(24u, sent.m_transferred);
+            Assert::AreEqual(0u, sent.m_error);
+
+            const auto canceled = ctsQuicCompleteSend(task, true, c_connectionAborted);
+            Assert::AreEqual(0u, canceled.m_transferred);
+            Assert::AreEqual(c_connectionAborted, canceled.m_error);
+        }
+    };
+}
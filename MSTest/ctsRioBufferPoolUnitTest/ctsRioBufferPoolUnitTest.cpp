@@ -0,0 +1,290 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for ctsRioBufferPool, driven by a mock RIO function table
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../../ctsTraffic/ctsRioBufferPool.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    // every registration gets a new fake RIO_BUFFERID, tracking the memory it registered
+    std::map<RIO_BUFFERID, std::pair<PCHAR, DWORD>> g_registeredBuffers;
+    std::set<RIO_BUFFERID> g_deregisteredBuffers;
+    ULONG_PTR g_nextBufferId = 1;
+    bool g_failRegister = false;
+
+    RIO_BUFFERID PASCAL MockRIORegisterBuffer(PCHAR dataBuffer, DWORD dataLength)
+    {
+        if (g_failRegister)
+        {
+            WSASetLastError(WSAENOBUFS);
+            return RIO_INVALID_BUFFERID;
+        }
+
+        const auto bufferId = reinterpret_cast<RIO_BUFFERID>(g_nextBufferId++); // NOLINT(performance-no-int-to-ptr)
+        g_registeredBuffers[bufferId] = std::make_pair(dataBuffer, dataLength);
+        return bufferId;
+    }
+
+    VOID PASCAL MockRIODeregisterBuffer(RIO_BUFFERID bufferId)
+    {
+        Assert::IsTrue(g_registeredBuffers.contains(bufferId));
+        Assert::IsTrue(g_deregisteredBuffers.insert(bufferId).second);
+    }
+
+    RIO_EXTENSION_FUNCTION_TABLE MakeMockRioFunctionTable() noexcept
+    {
+        RIO_EXTENSION_FUNCTION_TABLE rioFunctions{};
+        rioFunctions.cbSize = sizeof rioFunctions;
+        rioFunctions.RIORegisterBuffer = MockRIORegisterBuffer;
+        rioFunctions.RIODeregisterBuffer = MockRIODeregisterBuffer;
+        return rioFunctions;
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsRioBufferPoolUnitTest)
+    {
+    private:
+        RIO_EXTENSION_FUNCTION_TABLE m_rioFunctions = MakeMockRioFunctionTable();
+
+    public:
+        TEST_METHOD_INITIALIZE(Setup)
+        {
+            g_registeredBuffers.clear();
+            g_deregisteredBuffers.clear();
+            g_nextBufferId = 1;
+            g_failRegister = false;
+        }
+
+        TEST_METHOD(SharedBufferPoolRegistersTheSharedBuffer)
+        {
+            char sharedBuffer[64]{};
+            ctsRioBufferPool pool(m_rioFunctions, sharedBuffer, sizeof sharedBuffer);
+
+            bool newlyRegistered{};
+            const auto first = pool.Acquire(&newlyRegistered);
+            Assert::IsTrue(newlyRegistered);
+            const auto second = pool.Acquire(&newlyRegistered);
+            Assert::IsTrue(newlyRegistered);
+
+            // each acquire gets its own RIO_BUFFERID over the same memory
+            Assert::IsTrue(first.m_bufferId != second.m_bufferId);
+            Assert::IsTrue(sharedBuffer == first.m_buffer);
+            Assert::IsTrue(sharedBuffer == second.m_buffer);
+            Assert::IsTrue(sharedBuffer == g_registeredBuffers[first.m_bufferId].first);
+            Assert::AreEqual(DWORD{sizeof sharedBuffer}, g_registeredBuffers[first.m_bufferId].second);
+            Assert::AreEqual(size_t{2}, pool.GetRegisteredCount());
+            Assert::AreEqual(size_t{0}, pool.GetSlabCount());
+
+            pool.Release(first);
+            pool.Release(second);
+        }
+
+        TEST_METHOD(ReleasedBuffersAreRecycledWithoutRegistering)
+        {
+            char sharedBuffer[64]{};
+            ctsRioBufferPool pool(m_rioFunctions, sharedBuffer, sizeof sharedBuffer);
+
+            const auto first = pool.Acquire();
+            pool.Release(first);
+            Assert::AreEqual(size_t{1}, pool.GetFreeCount());
+
+            // churning connections through the pool registers nothing more
+            for (auto connection = 0; connection < 1000; ++connection)
+            {
+                bool newlyRegistered{true};
+                const auto buffer = pool.Acquire(&newlyRegistered);
+                Assert::IsFalse(newlyRegistered);
+                Assert::IsTrue(first.m_bufferId == buffer.m_bufferId);
+                pool.Release(buffer);
+            }
+            Assert::AreEqual(size_t{1}, g_registeredBuffers.size());
+            Assert::AreEqual(size_t{1}, pool.GetRegisteredCount());
+            Assert::IsTrue(g_deregisteredBuffers.empty());
+        }
+
+        TEST_METHOD(SlabPoolCarvesDistinctBuffersFromSlabs)
+        {
+            constexpr uint32_t bufferSize = 100;
+            ctsRioBufferPool pool(m_rioFunctions, bufferSize, 4);
+
+            std::vector<ctsRioBufferPool::RegisteredBuffer> buffers;
+            for (auto count = 0; count < 10; ++count)
+            {
+                buffers.push_back(pool.Acquire());
+                Assert::IsTrue(buffers.back().m_bufferId != RIO_INVALID_BUFFERID);
+            }
+            // 10 buffers at 4 per slab
+            Assert::AreEqual(size_t{3}, pool.GetSlabCount());
+            Assert::AreEqual(size_t{10}, pool.GetBufferCount());
+
+            // buffers carved from the same slab are adjacent, and no buffers overlap
+            Assert::IsTrue(buffers[0].m_buffer + bufferSize == buffers[1].m_buffer);
+            for (size_t lhs = 0; lhs < buffers.size(); ++lhs)
+            {
+                for (size_t rhs = lhs + 1; rhs < buffers.size(); ++rhs)
+                {
+                    Assert::IsTrue(
+                        buffers[lhs].m_buffer + bufferSize <= buffers[rhs].m_buffer ||
+                        buffers[rhs].m_buffer + bufferSize <= buffers[lhs].m_buffer);
+                }
+            }
+
+            // the memory is writable end to end
+            for (const auto& buffer : buffers)
+            {
+                memset(buffer.m_buffer, 0xff, bufferSize);
+                pool.Release(buffer);
+            }
+            Assert::AreEqual(size_t{10}, pool.GetFreeCount());
+        }
+
+        TEST_METHOD(SlabIsRegisteredOnceWithBuffersAtOffsets)
+        {
+            constexpr uint32_t bufferSize = 100;
+            constexpr uint32_t buffersPerSlab = 4;
+            ctsRioBufferPool pool(m_rioFunctions, bufferSize, buffersPerSlab);
+
+            std::vector<ctsRioBufferPool::RegisteredBuffer> buffers;
+            std::vector<bool> registrations;
+            for (auto count = 0; count < 6; ++count)
+            {
+                bool newlyRegistered{};
+                buffers.push_back(pool.Acquire(&newlyRegistered));
+                registrations.push_back(newlyRegistered);
+            }
+
+            // one registration per slab, covering the whole slab
+            Assert::AreEqual(size_t{2}, g_registeredBuffers.size());
+            Assert::AreEqual(size_t{2}, pool.GetRegisteredCount());
+            const std::vector<bool> expectedRegistrations{true, false, false, false, true, false};
+            Assert::IsTrue(expectedRegistrations == registrations);
+
+            for (size_t count = 0; count < buffers.size(); ++count)
+            {
+                const auto& buffer = buffers[count];
+                const auto& slab = buffers[count - count % buffersPerSlab];
+                // each buffer is its slab's RIO_BUFFERID at the buffer's offset into the slab
+                Assert::IsTrue(slab.m_bufferId == buffer.m_bufferId);
+                Assert::AreEqual(static_cast<uint32_t>(count % buffersPerSlab) * bufferSize, buffer.m_offset);
+                Assert::IsTrue(g_registeredBuffers[buffer.m_bufferId].first + buffer.m_offset == buffer.m_buffer);
+                Assert::AreEqual(DWORD{bufferSize * buffersPerSlab}, g_registeredBuffers[buffer.m_bufferId].second);
+            }
+            Assert::IsTrue(buffers[0].m_bufferId != buffers[4].m_bufferId);
+
+            // released buffers keep their offsets when recycled
+            pool.Release(buffers[2]);
+            bool newlyRegistered{true};
+            const auto recycled = pool.Acquire(&newlyRegistered);
+            Assert::IsFalse(newlyRegistered);
+            Assert::IsTrue(buffers[2].m_buffer == recycled.m_buffer);
+            Assert::IsTrue(buffers[2].m_bufferId == recycled.m_bufferId);
+            Assert::AreEqual(buffers[2].m_offset, recycled.m_offset);
+        }
+
+        TEST_METHOD(SlabRegistrationFailureIsRetried)
+        {
+            ctsRioBufferPool pool(m_rioFunctions, 100, 2);
+
+            const auto first = pool.Acquire();
+            const auto second = pool.Acquire();
+            g_failRegister = true;
+            bool newlyRegistered{true};
+            const auto failed = pool.Acquire(&newlyRegistered);
+            Assert::IsTrue(RIO_INVALID_BUFFERID == failed.m_bufferId);
+            Assert::IsNull(failed.m_buffer);
+            Assert::IsFalse(newlyRegistered);
+            Assert::AreEqual(WSAENOBUFS, WSAGetLastError());
+            Assert::AreEqual(size_t{1}, pool.GetSlabCount());
+
+            // the next Acquire registers a new slab
+            g_failRegister = false;
+            const auto third = pool.Acquire(&newlyRegistered);
+            Assert::IsTrue(newlyRegistered);
+            Assert::IsTrue(third.m_bufferId != first.m_bufferId);
+            Assert::AreEqual(0u, third.m_offset);
+            Assert::AreEqual(size_t{2}, pool.GetSlabCount());
+            Assert::AreEqual(size_t{3}, pool.GetBufferCount());
+
+            pool.Release(first);
+            pool.Release(second);
+            pool.Release(third);
+        }
+
+        TEST_METHOD(DestructorDeregistersFreeBuffers)
+        {
+            char sharedBuffer[64]{};
+            std::vector<ctsRioBufferPool::RegisteredBuffer> buffers;
+            {
+                ctsRioBufferPool pool(m_rioFunctions, sharedBuffer, sizeof sharedBuffer);
+                for (auto count = 0; count < 3; ++count)
+                {
+                    buffers.push_back(pool.Acquire());
+                }
+                for (const auto& buffer : buffers)
+                {
+                    pool.Release(buffer);
+                }
+                Assert::IsTrue(g_deregisteredBuffers.empty());
+            }
+
+            Assert::AreEqual(size_t{3}, g_deregisteredBuffers.size());
+            for (const auto& buffer : buffers)
+            {
+                Assert::IsTrue(g_deregisteredBuffers.contains(buffer.m_bufferId));
+            }
+        }
+
+        TEST_METHOD(DestructorDeregistersEachSlabOnce)
+        {
+            std::vector<ctsRioBufferPool::RegisteredBuffer> buffers;
+            {
+                ctsRioBufferPool pool(m_rioFunctions, 64, 4);
+                for (auto count = 0; count < 6; ++count)
+                {
+                    buffers.push_back(pool.Acquire());
+                }
+                // a buffer still held when the pool is destroyed is freed with its slab
+                for (size_t count = 1; count < buffers.size(); ++count)
+                {
+                    pool.Release(buffers[count]);
+                }
+                Assert::IsTrue(g_deregisteredBuffers.empty());
+            }
+
+            Assert::AreEqual(size_t{2}, g_deregisteredBuffers.size());
+            Assert::IsTrue(g_deregisteredBuffers.contains(buffers[0].m_bufferId));
+            Assert::IsTrue(g_deregisteredBuffers.contains(buffers[4].m_bufferId));
+        }
+    };
+}
@@ -0,0 +1,368 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for ctsRioCompletionQueues, driven by a mock RIO function table
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "../../ctsTraffic/ctsRioCompletionQueues.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    //
+    // in-memory RIO CQ
+    // - completions are queued with MockComplete
+    // - an armed notification is posted to the IOCP once a completion is queued, as RIO does
+    //
+    struct MockCompletionQueue
+    {
+        DWORD m_size = 0;
+        PRIO_NOTIFICATION_COMPLETION m_notification = nullptr;
+        std::deque<RIORESULT> m_results;
+        bool m_notifyArmed = false;
+        bool m_closed = false;
+    };
+
+    std::vector<std::unique_ptr<MockCompletionQueue>> g_mockCompletionQueues;
+    // fail the create call made after this many CQs were created
+    size_t g_failCreateAfter = SIZE_MAX;
+    bool g_failResize = false;
+    uint32_t g_resizeCalls = 0;
+
+    MockCompletionQueue* FromRioCq(RIO_CQ cq) noexcept
+    {
+        return reinterpret_cast<MockCompletionQueue*>(cq);
+    }
+
+    void PostNotification(MockCompletionQueue* mockCq) noexcept
+    {
+        mockCq->m_notifyArmed = false;
+        PostQueuedCompletionStatus(
+            mockCq->m_notification->Iocp.IocpHandle,
+            0,
+            reinterpret_cast<ULONG_PTR>(mockCq->m_notification->Iocp.CompletionKey),
+            static_cast<OVERLAPPED*>(mockCq->m_notification->Iocp.Overlapped));
+    }
+
+    RIO_CQ PASCAL MockRIOCreateCompletionQueue(DWORD queueSize, PRIO_NOTIFICATION_COMPLETION notification)
+    {
+        if (g_mockCompletionQueues.size() >= g_failCreateAfter)
+        {
+            WSASetLastError(WSAENOBUFS);
+            return RIO_INVALID_CQ;
+        }
+
+        auto mockCq = std::make_unique<MockCompletionQueue>();
+        mockCq->m_size = queueSize;
+        mockCq->m_notification = notification;
+        g_mockCompletionQueues.emplace_back(std::move(mockCq));
+        return reinterpret_cast<RIO_CQ>(g_mockCompletionQueues.back().get());
+    }
+
+    BOOL PASCAL MockRIOResizeCompletionQueue(RIO_CQ cq, DWORD queueSize)
+    {
+        ++g_resizeCalls;
+        if (g_failResize)
+        {
+            WSASetLastError(WSAENOBUFS);
+            return FALSE;
+        }
+        FromRioCq(cq)->m_size = queueSize;
+        return TRUE;
+    }
+
+    VOID PASCAL MockRIOCloseCompletionQueue(RIO_CQ cq)
+    {
+        FromRioCq(cq)->m_closed = true;
+    }
+
+    INT PASCAL MockRIONotify(RIO_CQ cq)
+    {
+        auto* const mockCq = FromRioCq(cq);
+        if (mockCq->m_notifyArmed)
+        {
+            return WSAEALREADY;
+        }
+
+        mockCq->m_notifyArmed = true;
+        if (!mockCq->m_results.empty())
+        {
+            PostNotification(mockCq);
+        }
+        return NO_ERROR;
+    }
+
+    ULONG PASCAL MockRIODequeueCompletion(RIO_CQ cq, PRIORESULT array, ULONG arraySize)
+    {
+        auto* const mockCq = FromRioCq(cq);
+        ULONG dequeued = 0;
+        while (dequeued < arraySize && !mockCq->m_results.empty())
+        {
+            array[dequeued] = mockCq->m_results.front();
+            mockCq->m_results.pop_front();
+            ++dequeued;
+        }
+        return dequeued;
+    }
+
+    void MockComplete(RIO_CQ cq, ULONGLONG requestContext) noexcept
+    {
+        auto* const mockCq = FromRioCq(cq);
+        RIORESULT result{};
+        result.BytesTransferred = 1;
+        result.RequestContext = requestContext;
+        mockCq->m_results.push_back(result);
+        if (mockCq->m_notifyArmed)
+        {
+            PostNotification(mockCq);
+        }
+    }
+
+    RIO_EXTENSION_FUNCTION_TABLE MakeMockRioFunctionTable() noexcept
+    {
+        RIO_EXTENSION_FUNCTION_TABLE rioFunctions{};
+        rioFunctions.cbSize = sizeof rioFunctions;
+        rioFunctions.RIOCreateCompletionQueue = MockRIOCreateCompletionQueue;
+        rioFunctions.RIOResizeCompletionQueue = MockRIOResizeCompletionQueue;
+        rioFunctions.RIOCloseCompletionQueue = MockRIOCloseCompletionQueue;
+        rioFunctions.RIONotify = MockRIONotify;
+        rioFunctions.RIODequeueCompletion = MockRIODequeueCompletion;
+        return rioFunctions;
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsRioCompletionQueuesUnitTest)
+    {
+    private:
+        RIO_EXTENSION_FUNCTION_TABLE m_rioFunctions = MakeMockRioFunctionTable();
+        wil::unique_handle m_iocp;
+
+    public:
+        TEST_METHOD_INITIALIZE(Setup)
+        {
+            g_mockCompletionQueues.clear();
+            g_failCreateAfter = SIZE_MAX;
+            g_failResize = false;
+            g_resizeCalls = 0;
+
+            m_iocp.reset(CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 0));
+            Assert::IsNotNull(m_iocp.get());
+        }
+
+        TEST_METHOD(CreatesOneCompletionQueuePerShard)
+        {
+            const ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 4, 100);
+
+            Assert::AreEqual(4u, completionQueues.GetShardCount());
+            Assert::AreEqual(size_t{4}, g_mockCompletionQueues.size());
+            for (uint32_t shard = 0; shard < 4; ++shard)
+            {
+                const auto* const mockCq = g_mockCompletionQueues[shard].get();
+                Assert::IsTrue(reinterpret_cast<RIO_CQ>(g_mockCompletionQueues[shard].get()) == completionQueues.GetCompletionQueue(shard));
+                Assert::AreEqual(DWORD{100}, mockCq->m_size);
+                Assert::AreEqual(100ul, completionQueues.GetCompletionQueueSize(shard));
+                Assert::AreEqual(0ul, completionQueues.GetCompletionQueueUsed(shard));
+
+                // every shard notifies the same IOCP with its own key and OVERLAPPED
+                Assert::IsTrue(RIO_IOCP_COMPLETION == mockCq->m_notification->Type);
+                Assert::IsTrue(m_iocp.get() == mockCq->m_notification->Iocp.IocpHandle);
+                Assert::AreEqual(shard, ctsRioCompletionQueues::GetShardFromCompletionKey(reinterpret_cast<ULONG_PTR>(mockCq->m_notification->Iocp.CompletionKey)));
+                for (uint32_t otherShard = 0; otherShard < shard; ++otherShard)
+                {
+                    Assert::IsTrue(mockCq->m_notification->Iocp.Overlapped != g_mockCompletionQueues[otherShard]->m_notification->Iocp.Overlapped);
+                }
+            }
+        }
+
+        TEST_METHOD(ClosesEveryCompletionQueueOnDestruction)
+        {
+            {
+                const ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 3, 100);
+                for (const auto& mockCq : g_mockCompletionQueues)
+                {
+                    Assert::IsFalse(mockCq->m_closed);
+                }
+            }
+
+            for (const auto& mockCq : g_mockCompletionQueues)
+            {
+                Assert::IsTrue(mockCq->m_closed);
+            }
+        }
+
+        TEST_METHOD(ConstructorFailureClosesCreatedCompletionQueues)
+        {
+            g_failCreateAfter = 2;
+            try
+            {
+                const ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 4, 100);
+                Assert::Fail(L"Expected the constructor to throw");
+            }
+            catch (const wil::ResultException& e)
+            {
+                Assert::AreEqual(HRESULT_FROM_WIN32(WSAENOBUFS), e.GetErrorCode());
+            }
+
+            Assert::AreEqual(size_t{2}, g_mockCompletionQueues.size());
+            for (const auto& mockCq : g_mockCompletionQueues)
+            {
+                Assert::IsTrue(mockCq->m_closed);
+            }
+        }
+
+        TEST_METHOD(AssignsShardsRoundRobin)
+        {
+            ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 3, 100);
+
+            for (uint32_t loop = 0; loop < 9; ++loop)
+            {
+                Assert::AreEqual(loop % 3, completionQueues.AssignShard());
+            }
+        }
+
+        TEST_METHOD(MakeRoomResizesOnlyItsShard)
+        {
+            ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 2, 8);
+
+            // fills shard 1 without resizing
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(1, 4));
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(1, 4));
+            Assert::AreEqual(0u, g_resizeCalls);
+            Assert::AreEqual(8ul, completionQueues.GetCompletionQueueUsed(1));
+
+            // grows shard 1 to 1.25x the slots used
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(1, 4));
+            Assert::AreEqual(1u, g_resizeCalls);
+            Assert::AreEqual(12ul, completionQueues.GetCompletionQueueUsed(1));
+            Assert::AreEqual(15ul, completionQueues.GetCompletionQueueSize(1));
+            Assert::AreEqual(DWORD{15}, g_mockCompletionQueues[1]->m_size);
+
+            // shard 0 is untouched
+            Assert::AreEqual(0ul, completionQueues.GetCompletionQueueUsed(0));
+            Assert::AreEqual(8ul, completionQueues.GetCompletionQueueSize(0));
+            Assert::AreEqual(DWORD{8}, g_mockCompletionQueues[0]->m_size);
+        }
+
+        TEST_METHOD(MakeRoomResizeFailureLeavesShardUnchanged)
+        {
+            ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 1, 8);
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(0, 8));
+
+            g_failResize = true;
+            Assert::AreEqual(DWORD{WSAENOBUFS}, completionQueues.MakeRoom(0, 4));
+            Assert::AreEqual(8ul, completionQueues.GetCompletionQueueUsed(0));
+            Assert::AreEqual(8ul, completionQueues.GetCompletionQueueSize(0));
+
+            g_failResize = false;
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(0, 4));
+            Assert::AreEqual(12ul, completionQueues.GetCompletionQueueUsed(0));
+        }
+
+        TEST_METHOD(ReleaseRoomKeepsTheCompletionQueueSize)
+        {
+            ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 1, 8);
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(0, 12));
+            Assert::AreEqual(15ul, completionQueues.GetCompletionQueueSize(0));
+
+            completionQueues.ReleaseRoom(0, 8);
+            Assert::AreEqual(4ul, completionQueues.GetCompletionQueueUsed(0));
+            Assert::AreEqual(15ul, completionQueues.GetCompletionQueueSize(0));
+
+            // the released slots are reused without resizing again
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.MakeRoom(0, 8));
+            Assert::AreEqual(1u, g_resizeCalls);
+        }
+
+        TEST_METHOD(DequeueDispatchesTheNotifiedShard)
+        {
+            ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 4, 100);
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.NotifyAll());
+            for (const auto& mockCq : g_mockCompletionQueues)
+            {
+                Assert::IsTrue(mockCq->m_notifyArmed);
+            }
+
+            MockComplete(completionQueues.GetCompletionQueue(2), 0x22);
+            MockComplete(completionQueues.GetCompletionQueue(2), 0x23);
+
+            DWORD transferred{};
+            ULONG_PTR completionKey{};
+            OVERLAPPED* pOverlapped{};
+            Assert::IsTrue(!!GetQueuedCompletionStatus(m_iocp.get(), &transferred, &completionKey, &pOverlapped, 0));
+            Assert::AreEqual(2u, ctsRioCompletionQueues::GetShardFromCompletionKey(completionKey));
+            // only the notified shard has been disarmed
+            Assert::IsFalse(g_mockCompletionQueues[2]->m_notifyArmed);
+            Assert::IsTrue(g_mockCompletionQueues[1]->m_notifyArmed);
+
+            RIORESULT results[8]{};
+            Assert::AreEqual(2ul, completionQueues.Dequeue(2, results, 8));
+            Assert::AreEqual(ULONGLONG{0x22}, results[0].RequestContext);
+            Assert::AreEqual(ULONGLONG{0x23}, results[1].RequestContext);
+
+            // Dequeue re-armed the shard, and no other notification is queued
+            Assert::IsTrue(g_mockCompletionQueues[2]->m_notifyArmed);
+            Assert::IsFalse(!!GetQueuedCompletionStatus(m_iocp.get(), &transferred, &completionKey, &pOverlapped, 0));
+        }
+
+        TEST_METHOD(ShardsAreNotifiedIndependently)
+        {
+            ctsRioCompletionQueues completionQueues(m_rioFunctions, m_iocp.get(), 2, 100);
+            Assert::AreEqual(DWORD{NO_ERROR}, completionQueues.NotifyAll());
+
+            MockComplete(completionQueues.GetCompletionQueue(0), 0x10);
+            MockComplete(completionQueues.GetCompletionQueue(1), 0x11);
+
+            std::vector<uint32_t> notifiedShards;
+            for (auto loop = 0; loop < 2; ++loop)
+            {
+                DWORD transferred{};
+                ULONG_PTR completionKey{};
+                OVERLAPPED* pOverlapped{};
+                Assert::IsTrue(!!GetQueuedCompletionStatus(m_iocp.get(), &transferred, &completionKey, &pOverlapped, 0));
+                const auto shard = ctsRioCompletionQueues::GetShardFromCompletionKey(completionKey);
+                notifiedShards.push_back(shard);
+
+                RIORESULT results[8]{};
+                Assert::AreEqual(1ul, completionQueues.Dequeue(shard, results, 8));
+                Assert::AreEqual(ULONGLONG{0x10} + shard, results[0].RequestContext);
+            }
+            Assert::AreEqual(0u, notifiedShards[0]);
+            Assert::AreEqual(1u, notifiedShards[1]);
+
+            // a completion queued after Dequeue re-armed the shard notifies it again
+            MockComplete(completionQueues.GetCompletionQueue(1), 0x11);
+            DWORD transferred{};
+            ULONG_PTR completionKey{};
+            OVERLAPPED* pOverlapped{};
+            Assert::IsTrue(!!GetQueuedCompletionStatus(m_iocp.get(), &transferred, &completionKey, &pOverlapped, 0));
+            Assert::AreEqual(1u, ctsRioCompletionQueues::GetShardFromCompletionKey(completionKey));
+        }
+    };
+}
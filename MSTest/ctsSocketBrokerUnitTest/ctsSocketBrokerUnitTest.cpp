@@ -1,1295 +1,1545 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-#include <sdkddkver.h>
-#include "CppUnitTest.h"
-
-// cpp headers
-#include <vector>
-#include <memory>
-#include <algorithm>
-// os headers
-#include <Windows.h>
-// project headers
-#include "ctsSocketBroker.h"
-#include "ctsSocketState.h"
-#include "ctsConfig.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-
-using namespace Microsoft::VisualStudio::CppUnitTestFramework;
-
-///
-/// Fakes
-///
-namespace ctsTraffic::ctsConfig
-{
-ctsConfigSettings* g_configSettings;
-
-void PrintDebug(PCWSTR text, ...) noexcept
-{
-    va_list args;
-    va_start(args, text);
-    std::wstring outputString;
-    wil::details::str_vprintf_nothrow<std::wstring>(outputString, text, args);
-    Logger::WriteMessage(wil::str_printf<std::wstring>(L"PrintDebug: %ws\n", outputString.c_str()).c_str());
-
-    va_end(args);
-}
-
-unsigned long PrintThrownException() noexcept
-{
-    Logger::WriteMessage(L"ctsConfig::PrintThrownException\n");
-    return 0;
-}
-
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t) noexcept
-{
-    Logger::WriteMessage(L"ctsConfig::PrintConnectionResults(error)\n");
-}
-
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&) noexcept
-{
-    Logger::WriteMessage(L"ctsConfig::PrintConnectionResults(ctsTcpStatistics)\n");
-}
-
-void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsUdpStatistics&) noexcept
-{
-    Logger::WriteMessage(L"ctsConfig::PrintConnectionResults(ctsUdpStatistics)\n");
-}
-
-bool ShutdownCalled() noexcept
-{
-    return false;
-}
-
-uint32_t ConsoleVerbosity() noexcept
-{
-    return 0;
-}
-}
-
-///
-/// End of Fakes
-///
-
-
-using namespace ctsTraffic;
-
-///
-/// Broker contains logic processing these ctsConfig global settings
-/// to control the quotas involved in initiating new socket connections
-///
-
-// ctsConfig::Settings::AcceptFunction
-// ctsConfig::Settings::ServerExitLimit
-// ctsConfig::Settings::Iterations
-// ctsConfig::Settings::ConnectionLimit
-// ctsConfig::Settings::ConnectionThrottleLimit
-// ctsConfig::Settings::CtrlCHandle
-
-
-/// class used to communicate between the test and the created ctsSocketState objects
-class SocketStatePool
-{
-public:
-    SocketStatePool() = default;
-    ~SocketStatePool() noexcept = default;
-
-    /// Add/remove ctsSocketState objects
-    void add_object(const std::shared_ptr<ctsSocketState>& stateObject)
-    {
-        m_work.QueueAdd(stateObject);
-    }
-
-    void remove_deleted_objects() noexcept
-    {
-        const auto holdLock = m_lock.lock();
-
-        std::erase_if(m_stateObjects, [&](const std::weak_ptr<ctsSocketState>& weakPtr) {
-            return weakPtr.expired();
-        });
-    }
-
-    void print_objects() noexcept
-    {
-        const auto holdLock = m_lock.lock();
-
-        const auto creatingObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
-            if (const auto sharedState = object.lock(); sharedState)
-            {
-                return sharedState->GetCurrentState() == ctsSocketState::InternalState::Creating;
-            }
-            return false;
-        });
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool Creating objects : %ld\n", creatingObjects).c_str());
-
-        const auto initiatingIoObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
-            if (const auto sharedState = object.lock(); sharedState)
-            {
-                return sharedState->GetCurrentState() == ctsSocketState::InternalState::InitiatingIo;
-            }
-            return false;
-        });
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool InitiatingIo objects : %ld\n", initiatingIoObjects).c_str());
-
-        const auto closedObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
-            if (const auto sharedState = object.lock(); sharedState)
-            {
-                return sharedState->GetCurrentState() == ctsSocketState::InternalState::Closed;
-            }
-            return false;
-        });
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool Closed objects : %ld\n", closedObjects).c_str());
-
-        const auto nullObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
-            return object.expired();
-        });
-        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool null objects : %ld\n", nullObjects).c_str());
-    }
-
-    void reset() noexcept
-    {
-        const auto holdLock = m_lock.lock();
-        m_stateObjects.clear();
-    }
-
-    /// Interact with states of contained ctsSocketState objects
-    void complete_state(DWORD errorCode)
-    {
-        const auto holdLock = m_lock.lock();
-        for (auto& socketState : m_stateObjects)
-        {
-            if (const auto sharedState = socketState.lock())
-            {
-                sharedState->CompleteState(errorCode);
-            }
-        }
-    }
-
-    void validate_expected_count(size_t count)
-    {
-        size_t matchedState = 0;
-
-        for (auto i = 0; i < 250; ++i)
-        {
-            // wait outside the lock
-            Sleep(25);
-            const auto holdLock = m_lock.lock();
-
-            matchedState = m_stateObjects.size();
-            if (count == matchedState)
-            {
-                break;
-            }
-
-            if (matchedState > count)
-            {
-                print_objects();
-            }
-            Assert::IsTrue(matchedState < count);
-        }
-
-        if (count != m_stateObjects.size())
-        {
-            print_objects();
-        }
-        Assert::AreEqual(count, m_stateObjects.size());
-    }
-
-    void validate_expected_count(size_t count, ctsSocketState::InternalState state)
-    {
-        size_t matchedState = 0;
-
-        for (auto i = 0; i < 250; ++i)
-        {
-            // wait outside the lock
-            Sleep(25);
-            const auto holdLock = m_lock.lock();
-
-            matchedState = 0;
-            for (auto& socketState : m_stateObjects)
-            {
-                if (const auto sharedState = socketState.lock())
-                {
-                    if (state == sharedState->GetCurrentState())
-                    {
-                        ++matchedState;
-                    }
-                }
-                    else
-                    {
-                        if (state == ctsSocketState::InternalState::Closed)
-                        {
-                            // closed objects get removed in the threadpool thread - treat them equivalent
-                            ++matchedState;
-                        }
-                    }
-            }
-
-            if (count == matchedState)
-            {
-                break;
-            }
-
-            if (matchedState > count)
-            {
-                print_objects();
-            }
-            Assert::IsTrue(matchedState < count);
-        }
-
-        if (count != matchedState)
-        {
-            print_objects();
-        }
-        Assert::AreEqual(count, matchedState);
-    }
-
-    void wait_for_start(size_t count)
-    {
-        size_t matchedState = 0;
-        for (auto i = 0; i < 250; ++i)
-        {
-            // wait outside the lock
-            Sleep(25);
-            const auto holdLock = m_lock.lock();
-
-            matchedState = 0;
-            for (auto& socketState : m_stateObjects)
-            {
-                auto sharedState(socketState.lock());
-                Assert::IsNotNull(sharedState.get());
-                if (sharedState->GetCurrentState() == ctsSocketState::InternalState::Creating)
-                {
-                    ++matchedState;
-                }
-            }
-
-            if (count == matchedState)
-            {
-                break;
-            }
-
-            if (matchedState > count)
-            {
-                print_objects();
-            }
-            Assert::IsTrue(matchedState < count);
-        }
-
-        if (count != matchedState)
-        {
-            print_objects();
-        }
-        Assert::AreEqual(count, matchedState);
-    }
-
-    // non-copyable
-    SocketStatePool(const SocketStatePool&) = delete;
-    SocketStatePool& operator=(const SocketStatePool&) = delete;
-    SocketStatePool(SocketStatePool&&) = delete;
-    SocketStatePool& operator=(SocketStatePool&&) = delete;
-
-private:
-    wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
-    std::vector<std::weak_ptr<ctsSocketState>> m_stateObjects;
-
-    struct AsyncAddObject
-    {
-        SocketStatePool& m_parent;
-        wil::critical_section m_workLock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
-        std::vector<std::shared_ptr<ctsSocketState>> m_stateObjectsToAdd;
-        wil::shared_threadpool_work m_tpWork;
-
-        explicit AsyncAddObject(SocketStatePool& parent) :
-            m_parent(parent)
-        {
-            m_tpWork.reset(CreateThreadpoolWork(WorkCallback, this, nullptr));
-        }
-
-        void QueueAdd(const std::shared_ptr<ctsSocketState>& newObject)
-        {
-            const auto lock = m_workLock.lock();
-            m_stateObjectsToAdd.push_back(newObject);
-            SubmitThreadpoolWork(m_tpWork.get());
-        }
-
-        static VOID CALLBACK WorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK) noexcept
-        {
-            auto* pThis = static_cast<AsyncAddObject*>(context);
-
-            std::shared_ptr<ctsSocketState> objectToAdd;
-            {
-                const auto holdLock = pThis->m_workLock.lock();
-                if (!pThis->m_stateObjectsToAdd.empty())
-                {
-                    objectToAdd = *pThis->m_stateObjectsToAdd.rbegin();
-                    pThis->m_stateObjectsToAdd.pop_back();
-                }
-            }
-
-            const auto parentLock = pThis->m_parent.m_lock.lock();
-            pThis->m_parent.m_stateObjects.push_back(objectToAdd);
-        }
-    } m_work{*this};
-};
-
-SocketStatePool* g_socketPool;
-
-
-///
-/// Faking the ctsSocketState that the broker instantiates based off of quota
-/// - don't need to actually do any work - just need to control indications back to the broker
-/// - but we do need to track all instances created so we can control each socketstate
-///
-ctsSocketState::ctsSocketState(std::weak_ptr<ctsSocketBroker> broker) :
-    m_broker(std::move(broker))
-{
-}
-
-ctsSocketState::~ctsSocketState() noexcept
-{
-}
-
-void ctsSocketState::Start() noexcept
-{
-    g_socketPool->add_object(this->shared_from_this());
-}
-
-void ctsSocketState::CompleteState(DWORD error) noexcept
-{
-    if (NO_ERROR == error)
-    {
-        // walk states from Creating -> InitiatingIO -> Closed
-        switch (m_state)
-        {
-            // Skipping Connecting, since that state doesn't affect ctsSocketBroker
-
-            case InternalState::Creating:
-            {
-                m_state = InternalState::InitiatingIo;
-                const auto parent = m_broker.lock();
-                parent->InitiatingIo();
-                break;
-            }
-            case InternalState::InitiatingIo:
-            {
-                m_state = InternalState::Closed;
-                const auto parent = m_broker.lock();
-                parent->Closing(true);
-                break;
-            }
-
-            default:
-                Assert::Fail(
-                    wil::str_printf<std::wstring>(L"Unexpected ctsSocketState: 0x%x\n", m_state).c_str());
-        }
-    }
-    else
-    {
-        // move straight to Closed
-        const auto wasActive = InternalState::InitiatingIo == m_state;
-        m_state = InternalState::Closed;
-
-        const auto parent = m_broker.lock();
-        parent->Closing(wasActive);
-    }
-}
-
-ctsSocketState::InternalState ctsSocketState::GetCurrentState() const noexcept
-{
-    return m_state;
-}
-
-
-namespace ctsUnitTest
-{
-TEST_CLASS(ctsSocketBrokerUnitTest)
-{
-public:
-    TEST_CLASS_INITIALIZE(Setup)
-    {
-        g_socketPool = new SocketStatePool;
-
-        ctsConfig::g_configSettings = new ctsConfig::ctsConfigSettings;
-        ctsConfig::g_configSettings->CtrlCHandle = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
-        ctsConfig::g_configSettings->PrePostRecvs = 1;
-        ctsConfig::g_configSettings->PrePostSends = 1;
-        Assert::AreNotEqual(static_cast<HANDLE>(nullptr), ctsConfig::g_configSettings->CtrlCHandle);
-    }
-
-    TEST_CLASS_CLEANUP(Cleanup)
-    {
-        delete ctsConfig::g_configSettings;
-        delete g_socketPool;
-    }
-
-    TEST_METHOD_INITIALIZE(MethodSetup)
-    {
-    }
-
-    TEST_METHOD_CLEANUP(MethodCleanup)
-    {
-        // drain the Timer
-        Sleep(250);
-    }
-
-    TEST_METHOD(OneSuccessfulClientConnection)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 1;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 1;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Closing sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ManySuccessfulClientConnection)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 100;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 100;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        g_socketPool->print_objects();
-
-        Logger::WriteMessage(L"Closing sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(OneSuccessfulServerConnectionWithExit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 1;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->AcceptLimit = 1;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Closing sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ManySuccessfulServerConnectionWithExit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 100;
-        ctsConfig::g_configSettings->Iterations = 100;
-        ctsConfig::g_configSettings->AcceptLimit = 100;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Closing sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(OneSuccessfulServerConnectionWithoutExit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = MAXULONGLONG;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->AcceptLimit = 1;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Closing sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
-
-        Assert::IsFalse(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(2);
-    }
-
-    TEST_METHOD(ManySuccessfulServerConnectionWithoutExit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = MAXULONGLONG;
-        ctsConfig::g_configSettings->Iterations = 100;
-        ctsConfig::g_configSettings->AcceptLimit = 100;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-        auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-        g_socketPool->print_objects();
-
-        Logger::WriteMessage(L"Starting IO on 100 sockets - letting 100 more be created\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        // more are being accepted while we complete these - wait for that to be done
-        g_socketPool->wait_for_start(100);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Creating);
-
-        g_socketPool->print_objects();
-
-        Logger::WriteMessage(L"Closing 100 sockets - letting 100 move to initatingIo\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Sleeping to let the callbacks cleanup closed sockets\n");
-        Sleep(500);
-
-        g_socketPool->print_objects();
-
-        Logger::WriteMessage(L"Removing deleted objects\n");
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        g_socketPool->print_objects();
-        g_socketPool->validate_expected_count(200);
-
-        testBroker.reset();
-
-        // should create the next socket to accept on the next Timer callback
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(OneFailedClientConnection_FailedConnect)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 1;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 1;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Connecting sockets\n");
-        g_socketPool->complete_state(WSAECONNREFUSED);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ManyFailedClientConnection_FailedConnect)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 100;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 100;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-
-        Logger::WriteMessage(L"Connecting sockets\n");
-        g_socketPool->complete_state(WSAECONNREFUSED);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(OneFailedServerConnectionWithExit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 1;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->AcceptLimit = 1;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Connecting sockets\n");
-        g_socketPool->complete_state(WSAECONNREFUSED);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ManyFailedServerConnectionWithExit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 100;
-        ctsConfig::g_configSettings->Iterations = 100;
-        ctsConfig::g_configSettings->AcceptLimit = 100;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-
-        Logger::WriteMessage(L"Connecting sockets\n");
-        g_socketPool->complete_state(WSAECONNREFUSED);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(OneFailedClientConnection_FailedIO)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 1;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 1;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Failing IO on sockets\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ManyFailedClientConnection_FailedIO)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 100;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 100;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-
-        Logger::WriteMessage(L"Starting IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Failing IO on sockets\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(OneFailedServerConnectionWithExit_FailedIO)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 1;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->AcceptLimit = 1;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"Initiating IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Failing IO on sockets\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ManyFailedServerConnectionWithExit_FailedIO)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 100;
-        ctsConfig::g_configSettings->Iterations = 100;
-        ctsConfig::g_configSettings->AcceptLimit = 100;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(100);
-
-        Logger::WriteMessage(L"Initiating IO on sockets\n");
-        g_socketPool->complete_state(NO_ERROR);
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"Failing IO on sockets\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(MoreSuccessfulClientConnectionsThanConnectionThrottleLimit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 15;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-
-        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(5);
-
-        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 5 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"3. Expecting 5 creating, 5 initiating IO, 5 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"4. Expecting 5 initiating IO, 10 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"6. Expecting 15 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(MoreFailedClientConnectionsThanConnectionThrottleLimit_FailedConnect)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 15;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-
-        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(5);
-
-        Logger::WriteMessage(L"2. Expecting 5 creating, 5 waiting, 5 closed\n");
-        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-
-        Logger::WriteMessage(L"3. Expecting 5 creating, 10 closed\n");
-        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
-
-        g_socketPool->validate_expected_count(10, ctsSocketState::InternalState::Closed);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-
-        Logger::WriteMessage(L"4. Expecting 15 closed\n");
-        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
-
-        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(MoreFailedClientConnectionsThanConnectionThrottleLimit_FailedIO)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 1;
-        ctsConfig::g_configSettings->ConnectionLimit = 15;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-
-        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(5);
-
-        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 5 waiting\n");
-        g_socketPool->complete_state(NO_ERROR); // successful connect
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"3. Expecting 5 creating, 10 closed\n");
-        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-
-        Logger::WriteMessage(L"4. Expecting 15 closed\n");
-        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
-
-        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(MoreSuccessfulServerConnectionsThanAcceptLimit)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 15;
-        ctsConfig::g_configSettings->Iterations = 15;
-        ctsConfig::g_configSettings->AcceptLimit = 5;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-
-        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(5);
-
-        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 5 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"3. Expecting 5 creating, 5 initiating IO, 5 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"4. Expecting 5 initiating IO, 10 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"6. Expecting 15 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-    TEST_METHOD(ServerExitLimitShouldOverrideIterations)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // not a client (connecting), a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
-        };
-        ctsConfig::g_configSettings->ServerExitLimit = 1;
-        ctsConfig::g_configSettings->Iterations = 15;
-        ctsConfig::g_configSettings->AcceptLimit = 5;
-        // these are not applicable to server
-        ctsConfig::g_configSettings->ConnectionLimit = 0;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-
-        Logger::WriteMessage(L"1. Expecting 1 creating\n");
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(1);
-
-        Logger::WriteMessage(L"2. Expecting 1 initiating IO\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"3. Expecting 1 completed\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-
-
-    TEST_METHOD(ManySuccessfulClientConnectionsMixingIterationsAndConnections)
-    {
-        g_socketPool->reset();
-
-        // Initialize config for this test
-        // a client (connecting), not a server (accepting)
-        ctsConfig::g_configSettings->AcceptFunction = nullptr;
-        ctsConfig::g_configSettings->Iterations = 10;
-        ctsConfig::g_configSettings->ConnectionLimit = 10;
-        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
-        // these are not applicable to client
-        ctsConfig::g_configSettings->ServerExitLimit = 0;
-        ctsConfig::g_configSettings->AcceptLimit = 0;
-
-        const auto testBroker(std::make_shared<ctsSocketBroker>());
-        testBroker->Start();
-
-        Logger::WriteMessage(L"1. Expecting 5 creating, 95 waiting\n");
-        // wait for all to be started as this is async
-        g_socketPool->wait_for_start(5);
-        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 90 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"3. Expecting 5 creating, 5 initiating IO, 85 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"4. Expecting 5 creating, 5 initiating IO, 80 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"5. Failing all sockets: 5 creating, 75 waiting\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"6. Expecting 5 creating, 5 initiating IO, 70 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"7. Expecting 5 creating, 5 initiating IO, 65 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"8. Failing all sockets: 5 creating, 60 waiting\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"9. Expecting 10 creating, 10 initiating IO, 55 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"10. Expecting 10 creating, 10 initiating IO, 50 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"11. Expecting 10 creating, 10 initiating IO, 45 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"12. Failing all sockets: 5 creating, 40 waiting\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"13. Expecting 10 creating, 10 initiating IO, 35 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"14. Expecting 10 creating, 10 initiating IO, 30 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"15. Expecting 10 creating, 10 initiating IO, 25 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"16. Expecting 10 creating, 10 initiating IO, 20 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"17. Failing all sockets: 5 creating, 15 waiting\n");
-        g_socketPool->complete_state(WSAENOBUFS);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"18. Expecting 10 creating, 10 initiating IO, 10 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"19. Expecting 10 creating, 10 initiating IO, 5 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"20. Expecting 5 creating, 5 initiating IO, 0 waiting\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"21. Expecting 5 initiating IO\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
-
-        Logger::WriteMessage(L"22. Expecting all done\n");
-        g_socketPool->complete_state(NO_ERROR);
-
-        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
-
-        Assert::IsTrue(testBroker->Wait(250));
-        g_socketPool->remove_deleted_objects();
-        g_socketPool->validate_expected_count(0);
-    }
-};
-}
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+// cpp headers
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <set>
+// os headers
+#include <Windows.h>
+// project headers
+#include "ctsSocketBroker.h"
+#include "ctsSocketState.h"
+#include "ctsConfig.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+///
+/// Fakes
+///
+namespace ctsTraffic::ctsConfig
+{
+ctsConfigSettings* g_configSettings;
+
+void PrintDebug(PCWSTR text, ...) noexcept
+{
+    va_list args;
+    va_start(args, text);
+    std::wstring outputString;
+    wil::details::str_vprintf_nothrow<std::wstring>(outputString, text, args);
+    Logger::WriteMessage(wil::str_printf<std::wstring>(L"PrintDebug: %ws\n", outputString.c_str()).c_str());
+
+    va_end(args);
+}
+
+unsigned long PrintThrownException() noexcept
+{
+    Logger::WriteMessage(L"ctsConfig::PrintThrownException\n");
+    return 0;
+}
+
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t) noexcept
+{
+    Logger::WriteMessage(L"ctsConfig::PrintConnectionResults(error)\n");
+}
+
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsTcpStatistics&, uint32_t) noexcept
+{
+    Logger::WriteMessage(L"ctsConfig::PrintConnectionResults(ctsTcpStatistics)\n");
+}
+
+void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t, const ctsUdpStatistics&) noexcept
+{
+    Logger::WriteMessage(L"ctsConfig::PrintConnectionResults(ctsUdpStatistics)\n");
+}
+
+bool ShutdownCalled() noexcept
+{
+    return false;
+}
+
+uint32_t ConsoleVerbosity() noexcept
+{
+    return 0;
+}
+}
+
+///
+/// End of Fakes
+///
+
+
+using namespace ctsTraffic;
+
+///
+/// Broker contains logic processing these ctsConfig global settings
+/// to control the quotas involved in initiating new socket connections
+///
+
+// ctsConfig::Settings::AcceptFunction
+// ctsConfig::Settings::ServerExitLimit
+// ctsConfig::Settings::Iterations
+// ctsConfig::Settings::ConnectionLimit
+// ctsConfig::Settings::ConnectionThrottleLimit
+// ctsConfig::Settings::CtrlCHandle
+
+
+/// class used to communicate between the test and the created ctsSocketState objects
+class SocketStatePool
+{
+public:
+    SocketStatePool() = default;
+    ~SocketStatePool() noexcept = default;
+
+    /// Add/remove ctsSocketState objects
+    void add_object(const std::shared_ptr<ctsSocketState>& stateObject)
+    {
+        m_work.QueueAdd(stateObject);
+    }
+
+    void remove_deleted_objects() noexcept
+    {
+        const auto holdLock = m_lock.lock();
+
+        std::erase_if(m_stateObjects, [&](const std::weak_ptr<ctsSocketState>& weakPtr) {
+            return weakPtr.expired();
+        });
+    }
+
+    void print_objects() noexcept
+    {
+        const auto holdLock = m_lock.lock();
+
+        const auto creatingObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
+            if (const auto sharedState = object.lock(); sharedState)
+            {
+                return sharedState->GetCurrentState() == ctsSocketState::InternalState::Creating;
+            }
+            return false;
+        });
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool Creating objects : %ld\n", creatingObjects).c_str());
+
+        const auto initiatingIoObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
+            if (const auto sharedState = object.lock(); sharedState)
+            {
+                return sharedState->GetCurrentState() == ctsSocketState::InternalState::InitiatingIo;
+            }
+            return false;
+        });
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool InitiatingIo objects : %ld\n", initiatingIoObjects).c_str());
+
+        const auto closedObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
+            if (const auto sharedState = object.lock(); sharedState)
+            {
+                return sharedState->GetCurrentState() == ctsSocketState::InternalState::Closed;
+            }
+            return false;
+        });
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool Closed objects : %ld\n", closedObjects).c_str());
+
+        const auto nullObjects = std::ranges::count_if(m_stateObjects, [](const auto& object) {
+            return object.expired();
+        });
+        Logger::WriteMessage(wil::str_printf<std::wstring>(L"\tSocketStatePool null objects : %ld\n", nullObjects).c_str());
+    }
+
+    void reset() noexcept
+    {
+        const auto holdLock = m_lock.lock();
+        m_stateObjects.clear();
+    }
+
+    /// Interact with states of contained ctsSocketState objects
+    void complete_state(DWORD errorCode)
+    {
+        const auto holdLock = m_lock.lock();
+        for (auto& socketState : m_stateObjects)
+        {
+            if (const auto sharedState = socketState.lock())
+            {
+                sharedState->CompleteState(errorCode);
+            }
+        }
+    }
+
+    void complete_state(DWORD errorCode, uint32_t trafficClass)
+    {
+        const auto holdLock = m_lock.lock();
+        for (auto& socketState : m_stateObjects)
+        {
+            if (const auto sharedState = socketState.lock())
+            {
+                if (sharedState->GetTrafficClass() == trafficClass &&
+                    sharedState->GetCurrentState() != ctsSocketState::InternalState::Closed)
+                {
+                    sharedState->CompleteState(errorCode);
+                }
+            }
+        }
+    }
+
+    /// the broker slots of the contained objects which are not yet closed
+    std::set<uint32_t> get_open_broker_slots()
+    {
+        const auto holdLock = m_lock.lock();
+        std::set<uint32_t> brokerSlots;
+        for (auto& socketState : m_stateObjects)
+        {
+            if (const auto sharedState = socketState.lock())
+            {
+                if (sharedState->GetCurrentState() != ctsSocketState::InternalState::Closed)
+                {
+                    brokerSlots.insert(sharedState->GetBrokerSlot());
+                }
+            }
+        }
+        return brokerSlots;
+    }
+
+    void validate_expected_count(size_t count, ctsSocketState::InternalState state, uint32_t trafficClass)
+    {
+        size_t matchedState = 0;
+
+        for (auto i = 0; i < 250; ++i)
+        {
+            // wait outside the lock
+            Sleep(25);
+            const auto holdLock = m_lock.lock();
+
+            matchedState = std::ranges::count_if(m_stateObjects, [&](const auto& object) {
+                if (const auto sharedState = object.lock(); sharedState)
+                {
+                    return sharedState->GetTrafficClass() == trafficClass && sharedState->GetCurrentState() == state;
+                }
+                return false;
+            });
+            if (count == matchedState)
+            {
+                break;
+            }
+
+            if (matchedState > count)
+            {
+                print_objects();
+            }
+            Assert::IsTrue(matchedState < count);
+        }
+
+        if (count != matchedState)
+        {
+            print_objects();
+        }
+        Assert::AreEqual(count, matchedState);
+    }
+
+    void validate_expected_count(size_t count)
+    {
+        size_t matchedState = 0;
+
+        for (auto i = 0; i < 250; ++i)
+        {
+            // wait outside the lock
+            Sleep(25);
+            const auto holdLock = m_lock.lock();
+
+            matchedState = m_stateObjects.size();
+            if (count == matchedState)
+            {
+                break;
+            }
+
+            if (matchedState > count)
+            {
+                print_objects();
+            }
+            Assert::IsTrue(matchedState < count);
+        }
+
+        if (count != m_stateObjects.size())
+        {
+            print_objects();
+        }
+        Assert::AreEqual(count, m_stateObjects.size());
+    }
+
+    void validate_expected_count(size_t count, ctsSocketState::InternalState state)
+    {
+        size_t matchedState = 0;
+
+        for (auto i = 0; i < 250; ++i)
+        {
+            // wait outside the lock
+            Sleep(25);
+            const auto holdLock = m_lock.lock();
+
+            matchedState = 0;
+            for (auto& socketState : m_stateObjects)
+            {
+                if (const auto sharedState = socketState.lock())
+                {
+                    if (state == sharedState->GetCurrentState())
+                    {
+                        ++matchedState;
+                    }
+                }
+                    else
+                    {
+                        if (state == ctsSocketState::InternalState::Closed)
+                        {
+                            // closed objects get removed in the threadpool thread - treat them equivalent
+                            ++matchedState;
+                        }
+                    }
+            }
+
+            if (count == matchedState)
+            {
+                break;
+            }
+
+            if (matchedState > count)
+            {
+                print_objects();
+            }
+            Assert::IsTrue(matchedState < count);
+        }
+
+        if (count != matchedState)
+        {
+            print_objects();
+        }
+        Assert::AreEqual(count, matchedState);
+    }
+
+    void wait_for_start(size_t count)
+    {
+        size_t matchedState = 0;
+        for (auto i = 0; i < 250; ++i)
+        {
+            // wait outside the lock
+            Sleep(25);
+            const auto holdLock = m_lock.lock();
+
+            matchedState = 0;
+            for (auto& socketState : m_stateObjects)
+            {
+                auto sharedState(socketState.lock());
+                Assert::IsNotNull(sharedState.get());
+                if (sharedState->GetCurrentState() == ctsSocketState::InternalState::Creating)
+                {
+                    ++matchedState;
+                }
+            }
+
+            if (count == matchedState)
+            {
+                break;
+            }
+
+            if (matchedState > count)
+            {
+                print_objects();
+            }
+            Assert::IsTrue(matchedState < count);
+        }
+
+        if (count != matchedState)
+        {
+            print_objects();
+        }
+        Assert::AreEqual(count, matchedState);
+    }
+
+    // non-copyable
+    SocketStatePool(const SocketStatePool&) = delete;
+    SocketStatePool& operator=(const SocketStatePool&) = delete;
+    SocketStatePool(SocketStatePool&&) = delete;
+    SocketStatePool& operator=(SocketStatePool&&) = delete;
+
+private:
+    wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+    std::vector<std::weak_ptr<ctsSocketState>> m_stateObjects;
+
+    struct AsyncAddObject
+    {
+        SocketStatePool& m_parent;
+        wil::critical_section m_workLock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        std::vector<std::shared_ptr<ctsSocketState>> m_stateObjectsToAdd;
+        wil::shared_threadpool_work m_tpWork;
+
+        explicit AsyncAddObject(SocketStatePool& parent) :
+            m_parent(parent)
+        {
+            m_tpWork.reset(CreateThreadpoolWork(WorkCallback, this, nullptr));
+        }
+
+        void QueueAdd(const std::shared_ptr<ctsSocketState>& newObject)
+        {
+            const auto lock = m_workLock.lock();
+            m_stateObjectsToAdd.push_back(newObject);
+            SubmitThreadpoolWork(m_tpWork.get());
+        }
+
+        static VOID CALLBACK WorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK) noexcept
+        {
+            auto* pThis = static_cast<AsyncAddObject*>(context);
+
+            std::shared_ptr<ctsSocketState> objectToAdd;
+            {
+                const auto holdLock = pThis->m_workLock.lock();
+                if (!pThis->m_stateObjectsToAdd.empty())
+                {
+                    objectToAdd = *pThis->m_stateObjectsToAdd.rbegin();
+                    pThis->m_stateObjectsToAdd.pop_back();
+                }
+            }
+
+            const auto parentLock = pThis->m_parent.m_lock.lock();
+            pThis->m_parent.m_stateObjects.push_back(objectToAdd);
+        }
+    } m_work{*this};
+};
+
+SocketStatePool* g_socketPool;
+
+
+///
+/// Faking the ctsSocketState that the broker instantiates based off of quota
+/// - don't need to actually do any work - just need to control indications back to the broker
+/// - but we do need to track all instances created so we can control each socketstate
+///
+ctsSocketState::ctsSocketState(std::weak_ptr<ctsSocketBroker> broker, uint32_t trafficClass, uint32_t brokerSlot) :
+    m_broker(std::move(broker)),
+    m_trafficClass(trafficClass),
+    m_brokerSlot(brokerSlot)
+{
+}
+
+ctsSocketState::~ctsSocketState() noexcept
+{
+}
+
+void ctsSocketState::Start() noexcept
+{
+    g_socketPool->add_object(this->shared_from_this());
+}
+
+void ctsSocketState::CompleteState(DWORD error) noexcept
+{
+    if (NO_ERROR == error)
+    {
+        // walk states from Creating -> InitiatingIO -> Closed
+        switch (m_state)
+        {
+            // Skipping Connecting, since that state doesn't affect ctsSocketBroker
+
+            case InternalState::Creating:
+            {
+                m_state = InternalState::InitiatingIo;
+                const auto parent = m_broker.lock();
+                parent->InitiatingIo(m_trafficClass);
+                break;
+            }
+            case InternalState::InitiatingIo:
+            {
+                m_state = InternalState::Closed;
+                const auto parent = m_broker.lock();
+                parent->Closing(m_trafficClass, true, m_brokerSlot);
+                break;
+            }
+
+            default:
+                Assert::Fail(
+                    wil::str_printf<std::wstring>(L"Unexpected ctsSocketState: 0x%x\n", m_state).c_str());
+        }
+    }
+    else
+    {
+        // move straight to Closed
+        const auto wasActive = InternalState::InitiatingIo == m_state;
+        m_state = InternalState::Closed;
+
+        const auto parent = m_broker.lock();
+        parent->Closing(m_trafficClass, wasActive, m_brokerSlot);
+    }
+}
+
+ctsSocketState::InternalState ctsSocketState::GetCurrentState() const noexcept
+{
+    return m_state;
+}
+
+
+namespace ctsUnitTest
+{
+TEST_CLASS(ctsSocketBrokerUnitTest)
+{
+public:
+    TEST_CLASS_INITIALIZE(Setup)
+    {
+        g_socketPool = new SocketStatePool;
+
+        ctsConfig::g_configSettings = new ctsConfig::ctsConfigSettings;
+        ctsConfig::g_configSettings->CtrlCHandle = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+        ctsConfig::g_configSettings->PrePostRecvs = 1;
+        ctsConfig::g_configSettings->PrePostSends = 1;
+        Assert::AreNotEqual(static_cast<HANDLE>(nullptr), ctsConfig::g_configSettings->CtrlCHandle);
+    }
+
+    TEST_CLASS_CLEANUP(Cleanup)
+    {
+        delete ctsConfig::g_configSettings;
+        delete g_socketPool;
+    }
+
+    TEST_METHOD_INITIALIZE(MethodSetup)
+    {
+    }
+
+    TEST_METHOD_CLEANUP(MethodCleanup)
+    {
+        // drain the Timer
+        Sleep(250);
+    }
+
+    TEST_METHOD(OneSuccessfulClientConnection)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 1;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 1;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Closing sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ManySuccessfulClientConnection)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 100;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 100;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        g_socketPool->print_objects();
+
+        Logger::WriteMessage(L"Closing sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(OneSuccessfulServerConnectionWithExit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 1;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->AcceptLimit = 1;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Closing sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ManySuccessfulServerConnectionWithExit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 100;
+        ctsConfig::g_configSettings->Iterations = 100;
+        ctsConfig::g_configSettings->AcceptLimit = 100;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Closing sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(OneSuccessfulServerConnectionWithoutExit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = MAXULONGLONG;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->AcceptLimit = 1;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Closing sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
+
+        Assert::IsFalse(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(2);
+    }
+
+    TEST_METHOD(ManySuccessfulServerConnectionWithoutExit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = MAXULONGLONG;
+        ctsConfig::g_configSettings->Iterations = 100;
+        ctsConfig::g_configSettings->AcceptLimit = 100;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+        auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+        g_socketPool->print_objects();
+
+        Logger::WriteMessage(L"Starting IO on 100 sockets - letting 100 more be created\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        // more are being accepted while we complete these - wait for that to be done
+        g_socketPool->wait_for_start(100);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Creating);
+
+        g_socketPool->print_objects();
+
+        Logger::WriteMessage(L"Closing 100 sockets - letting 100 move to initatingIo\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Sleeping to let the callbacks cleanup closed sockets\n");
+        Sleep(500);
+
+        g_socketPool->print_objects();
+
+        Logger::WriteMessage(L"Removing deleted objects\n");
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        g_socketPool->print_objects();
+        g_socketPool->validate_expected_count(200);
+
+        testBroker.reset();
+
+        // should create the next socket to accept on the next Timer callback
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(OneFailedClientConnection_FailedConnect)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 1;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 1;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Connecting sockets\n");
+        g_socketPool->complete_state(WSAECONNREFUSED);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ManyFailedClientConnection_FailedConnect)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 100;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 100;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+
+        Logger::WriteMessage(L"Connecting sockets\n");
+        g_socketPool->complete_state(WSAECONNREFUSED);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(OneFailedServerConnectionWithExit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 1;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->AcceptLimit = 1;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Connecting sockets\n");
+        g_socketPool->complete_state(WSAECONNREFUSED);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ManyFailedServerConnectionWithExit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 100;
+        ctsConfig::g_configSettings->Iterations = 100;
+        ctsConfig::g_configSettings->AcceptLimit = 100;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+
+        Logger::WriteMessage(L"Connecting sockets\n");
+        g_socketPool->complete_state(WSAECONNREFUSED);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(OneFailedClientConnection_FailedIO)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 1;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 1;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Failing IO on sockets\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ManyFailedClientConnection_FailedIO)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 100;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 100;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Failing IO on sockets\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(OneFailedServerConnectionWithExit_FailedIO)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 1;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->AcceptLimit = 1;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"Initiating IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Failing IO on sockets\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ManyFailedServerConnectionWithExit_FailedIO)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 100;
+        ctsConfig::g_configSettings->Iterations = 100;
+        ctsConfig::g_configSettings->AcceptLimit = 100;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(100);
+
+        Logger::WriteMessage(L"Initiating IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"Failing IO on sockets\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(MoreSuccessfulClientConnectionsThanConnectionThrottleLimit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 15;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+
+        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(5);
+
+        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 5 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"3. Expecting 5 creating, 5 initiating IO, 5 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"4. Expecting 5 initiating IO, 10 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"6. Expecting 15 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(MoreFailedClientConnectionsThanConnectionThrottleLimit_FailedConnect)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 15;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+
+        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(5);
+
+        Logger::WriteMessage(L"2. Expecting 5 creating, 5 waiting, 5 closed\n");
+        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+
+        Logger::WriteMessage(L"3. Expecting 5 creating, 10 closed\n");
+        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
+
+        g_socketPool->validate_expected_count(10, ctsSocketState::InternalState::Closed);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+
+        Logger::WriteMessage(L"4. Expecting 15 closed\n");
+        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
+
+        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(MoreFailedClientConnectionsThanConnectionThrottleLimit_FailedIO)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 15;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+
+        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(5);
+
+        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 5 waiting\n");
+        g_socketPool->complete_state(NO_ERROR); // successful connect
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"3. Expecting 5 creating, 10 closed\n");
+        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+
+        Logger::WriteMessage(L"4. Expecting 15 closed\n");
+        g_socketPool->complete_state(WSAECONNREFUSED); // fail connect
+
+        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(MoreSuccessfulServerConnectionsThanAcceptLimit)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 15;
+        ctsConfig::g_configSettings->Iterations = 15;
+        ctsConfig::g_configSettings->AcceptLimit = 5;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+
+        Logger::WriteMessage(L"1. Expecting 5 creating, 10 waiting\n");
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(5);
+
+        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 5 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"3. Expecting 5 creating, 5 initiating IO, 5 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"4. Expecting 5 initiating IO, 10 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"6. Expecting 15 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(15, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ServerExitLimitShouldOverrideIterations)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // not a client (connecting), a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = [](std::weak_ptr<ctsSocket>) {
+        };
+        ctsConfig::g_configSettings->ServerExitLimit = 1;
+        ctsConfig::g_configSettings->Iterations = 15;
+        ctsConfig::g_configSettings->AcceptLimit = 5;
+        // these are not applicable to server
+        ctsConfig::g_configSettings->ConnectionLimit = 0;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 0;
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+
+        Logger::WriteMessage(L"1. Expecting 1 creating\n");
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(1);
+
+        Logger::WriteMessage(L"2. Expecting 1 initiating IO\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"3. Expecting 1 completed\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+
+    TEST_METHOD(ManySuccessfulClientConnectionsMixingIterationsAndConnections)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 10;
+        ctsConfig::g_configSettings->ConnectionLimit = 10;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+
+        Logger::WriteMessage(L"1. Expecting 5 creating, 95 waiting\n");
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(5);
+        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"2. Expecting 5 creating, 5 initiating IO, 90 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"3. Expecting 5 creating, 5 initiating IO, 85 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"4. Expecting 5 creating, 5 initiating IO, 80 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"5. Failing all sockets: 5 creating, 75 waiting\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"6. Expecting 5 creating, 5 initiating IO, 70 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"7. Expecting 5 creating, 5 initiating IO, 65 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"8. Failing all sockets: 5 creating, 60 waiting\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"9. Expecting 10 creating, 10 initiating IO, 55 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"10. Expecting 10 creating, 10 initiating IO, 50 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"11. Expecting 10 creating, 10 initiating IO, 45 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"12. Failing all sockets: 5 creating, 40 waiting\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"13. Expecting 10 creating, 10 initiating IO, 35 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"14. Expecting 10 creating, 10 initiating IO, 30 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"15. Expecting 10 creating, 10 initiating IO, 25 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"16. Expecting 10 creating, 10 initiating IO, 20 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"17. Failing all sockets: 5 creating, 15 waiting\n");
+        g_socketPool->complete_state(WSAENOBUFS);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"18. Expecting 10 creating, 10 initiating IO, 10 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"19. Expecting 10 creating, 10 initiating IO, 5 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"20. Expecting 5 creating, 5 initiating IO, 0 waiting\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Creating);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"21. Expecting 5 initiating IO\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::InitiatingIo);
+
+        Logger::WriteMessage(L"22. Expecting all done\n");
+        g_socketPool->complete_state(NO_ERROR);
+
+        g_socketPool->validate_expected_count(100, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ClientConnectionsFilledPerTrafficClass)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        // - 2 traffic classes with 2 and 3 connections each
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 1;
+        ctsConfig::g_configSettings->ConnectionLimit = 5;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 5;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        ctsConfig::g_configSettings->TrafficClasses.emplace_back();
+        ctsConfig::g_configSettings->TrafficClasses.rbegin()->ConnectionLimit = 2;
+        ctsConfig::g_configSettings->TrafficClasses.emplace_back();
+        ctsConfig::g_configSettings->TrafficClasses.rbegin()->ConnectionLimit = 3;
+        const auto resetTrafficClasses = wil::scope_exit([&]() noexcept { ctsConfig::g_configSettings->TrafficClasses.clear(); });
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        // wait for all to be started as this is async
+        g_socketPool->wait_for_start(5);
+        g_socketPool->validate_expected_count(2, ctsSocketState::InternalState::Creating, 0);
+        g_socketPool->validate_expected_count(3, ctsSocketState::InternalState::Creating, 1);
+
+        Logger::WriteMessage(L"Starting IO on sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(2, ctsSocketState::InternalState::InitiatingIo, 0);
+        g_socketPool->validate_expected_count(3, ctsSocketState::InternalState::InitiatingIo, 1);
+
+        Logger::WriteMessage(L"Closing sockets\n");
+        g_socketPool->complete_state(NO_ERROR);
+        g_socketPool->validate_expected_count(5, ctsSocketState::InternalState::Closed);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ClosedConnectionRefilledInSameTrafficClass)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        // - 2 traffic classes with 1 connection each, run for 2 iterations
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = 2;
+        ctsConfig::g_configSettings->ConnectionLimit = 2;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = 2;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        ctsConfig::g_configSettings->TrafficClasses.emplace_back();
+        ctsConfig::g_configSettings->TrafficClasses.rbegin()->ConnectionLimit = 1;
+        ctsConfig::g_configSettings->TrafficClasses.emplace_back();
+        ctsConfig::g_configSettings->TrafficClasses.rbegin()->ConnectionLimit = 1;
+        const auto resetTrafficClasses = wil::scope_exit([&]() noexcept { ctsConfig::g_configSettings->TrafficClasses.clear(); });
+
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        g_socketPool->wait_for_start(2);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating, 0);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating, 1);
+
+        Logger::WriteMessage(L"Starting IO on the first class only\n");
+        g_socketPool->complete_state(NO_ERROR, 0);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo, 0);
+
+        Logger::WriteMessage(L"Closing the first class - its slot must be refilled by the same class\n");
+        g_socketPool->complete_state(NO_ERROR, 0);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating, 0);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating, 1);
+
+        Logger::WriteMessage(L"Failing the first class - it has no connections remaining so it must not be refilled\n");
+        g_socketPool->complete_state(WSAECONNREFUSED, 0);
+        g_socketPool->validate_expected_count(0, ctsSocketState::InternalState::Creating, 0);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating, 1);
+
+        Logger::WriteMessage(L"Completing both iterations of the second class\n");
+        g_socketPool->complete_state(NO_ERROR, 1);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo, 1);
+        g_socketPool->complete_state(NO_ERROR, 1);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::Creating, 1);
+        g_socketPool->complete_state(NO_ERROR, 1);
+        g_socketPool->validate_expected_count(1, ctsSocketState::InternalState::InitiatingIo, 1);
+        g_socketPool->complete_state(NO_ERROR, 1);
+
+        Assert::IsTrue(testBroker->Wait(250));
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(ConnectionChurnReusesBrokerSlots)
+    {
+        g_socketPool->reset();
+
+        // Initialize config for this test
+        // a client (connecting), not a server (accepting)
+        // - every round closes all connections at once, so each slot is handed back and refilled
+        constexpr uint32_t connectionCount = 50;
+        constexpr uint32_t roundCount = 20;
+        ctsConfig::g_configSettings->AcceptFunction = nullptr;
+        ctsConfig::g_configSettings->Iterations = roundCount;
+        ctsConfig::g_configSettings->ConnectionLimit = connectionCount;
+        ctsConfig::g_configSettings->ConnectionThrottleLimit = connectionCount;
+        // these are not applicable to client
+        ctsConfig::g_configSettings->ServerExitLimit = 0;
+        ctsConfig::g_configSettings->AcceptLimit = 0;
+
+        // every round's connections must be given the same slots: the slot table never grows past the connection limit
+        std::set<uint32_t> expectedSlots;
+        for (uint32_t slot = 0; slot < connectionCount; ++slot)
+        {
+            expectedSlots.insert(slot);
+        }
+
+        const auto startTime = GetTickCount64();
+        const auto testBroker(std::make_shared<ctsSocketBroker>());
+        testBroker->Start();
+        g_socketPool->wait_for_start(connectionCount);
+
+        for (uint32_t round = 0; round < roundCount; ++round)
+        {
+            // completing by traffic class skips closed objects the broker has not yet deleted
+            g_socketPool->validate_expected_count(connectionCount, ctsSocketState::InternalState::Creating, ctsConfig::c_defaultTrafficClass);
+            Assert::IsTrue(expectedSlots == g_socketPool->get_open_broker_slots(), L"a connection was not given a reused broker slot");
+            g_socketPool->complete_state(NO_ERROR, ctsConfig::c_defaultTrafficClass);
+            g_socketPool->validate_expected_count(connectionCount, ctsSocketState::InternalState::InitiatingIo, ctsConfig::c_defaultTrafficClass);
+            g_socketPool->complete_state(NO_ERROR, ctsConfig::c_defaultTrafficClass);
+            g_socketPool->remove_deleted_objects();
+        }
+
+        Assert::IsTrue(testBroker->Wait(1000));
+        Logger::WriteMessage(wil::str_printf<std::wstring>(
+            L"%u connections churned through %u broker slots in %llu ms\n",
+            connectionCount * roundCount, connectionCount, GetTickCount64() - startTime).c_str());
+        g_socketPool->remove_deleted_objects();
+        g_socketPool->validate_expected_count(0);
+    }
+
+    TEST_METHOD(TrafficClassDifferingFromServerNeedsTarget)
+    {
+        constexpr uint64_t serverTransfer = 0x100000;
+        ctsConfig::ctsTrafficClass trafficClass;
+        trafficClass.ConnectionLimit = 1;
+
+        // fields not specified use the server's settings
+        Assert::IsNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, 0));
+
+        trafficClass.IoPattern = ctsConfig::IoPatternType::Push;
+        trafficClass.TransferSizeLow = serverTransfer;
+        Assert::IsNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, 0));
+
+        trafficClass.IoPattern = ctsConfig::IoPatternType::PushPull;
+        Assert::IsNotNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, 0));
+
+        trafficClass.IoPattern = ctsConfig::IoPatternType::Push;
+        trafficClass.TransferSizeLow = serverTransfer * 2;
+        Assert::IsNotNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, 0));
+
+        // a range must match the server's range
+        trafficClass.TransferSizeLow = serverTransfer;
+        trafficClass.TransferSizeHigh = serverTransfer * 2;
+        Assert::IsNotNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, 0));
+        Assert::IsNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, serverTransfer * 2));
+
+        // a class with its own Target runs against its own server
+        trafficClass.IoPattern = ctsConfig::IoPatternType::PushPull;
+        trafficClass.TargetAddresses.emplace_back(AF_INET6);
+        Assert::IsNull(trafficClass.CheckServerSettings(ctsConfig::IoPatternType::Push, serverTransfer, 0));
+    }
+};
+}
@@ -40,7 +40,7 @@ void PrintConnectionResults(const wil::network::socket_address&, const wil::netw
 }
 
 void PrintConnectionResults(const wil::network::socket_address&, const wil::network::socket_address&, uint32_t,
-    const ctsTcpStatistics&) noexcept
+    const ctsTcpStatistics&, uint32_t) noexcept
 {
 }
 
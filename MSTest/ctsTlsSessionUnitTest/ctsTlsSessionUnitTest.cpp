@@ -0,0 +1,261 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for ctsTlsSession, exchanging tokens in memory between a client and server session
+    - the server uses a self-signed certificate generated for the test run
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "../../ctsTraffic/ctsTlsSession.hpp"
+
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace
+{
+    std::unique_ptr<ctsTlsSelfSignedCertificate> g_certificate;
+    std::unique_ptr<ctsTlsCredential> g_serverCredential;
+    std::unique_ptr<ctsTlsCredential> g_clientCredential;
+
+    // hands bytes sent by one session to its peer, up to chunkSize bytes at a time
+    void Deliver(const std::vector<char>& sent, ctsTlsSession& peer, size_t chunkSize, std::vector<char>& peerOutput)
+    {
+        for (size_t offset = 0; offset < sent.size(); offset += chunkSize)
+        {
+            const auto length = static_cast<uint32_t>(std::min(chunkSize, sent.size() - offset));
+            memcpy(peer.GetReceiveBuffer(length), sent.data() + offset, length);
+            peer.CommitReceived(length);
+            if (peer.IsHandshakeComplete())
+            {
+                Assert::AreEqual(SEC_E_OK, peer.Decrypt(peerOutput));
+            }
+        }
+    }
+
+    void CompleteHandshake(ctsTlsSession& client, ctsTlsSession& server)
+    {
+        std::vector<char> clientToken;
+        auto clientStatus = client.Handshake(clientToken);
+        Assert::AreEqual(SEC_I_CONTINUE_NEEDED, clientStatus);
+
+        // TLS 1.2 and 1.3 both complete within a few round trips
+        for (auto roundTrip = 0; roundTrip < 8 && !(client.IsHandshakeComplete() && server.IsHandshakeComplete()); ++roundTrip)
+        {
+            std::vector<char> serverToken;
+            if (!clientToken.empty())
+            {
+                memcpy(server.GetReceiveBuffer(static_cast<uint32_t>(clientToken.size())), clientToken.data(), clientToken.size());
+                server.CommitReceived(static_cast<uint32_t>(clientToken.size()));
+                clientToken.clear();
+                const auto serverStatus = server.IsHandshakeComplete() ? server.Decrypt(serverToken) : server.Handshake(serverToken);
+                Assert::IsTrue(SEC_E_OK == serverStatus || SEC_I_CONTINUE_NEEDED == serverStatus || SEC_E_INCOMPLETE_MESSAGE == serverStatus);
+            }
+
+            if (!serverToken.empty())
+            {
+                memcpy(client.GetReceiveBuffer(static_cast<uint32_t>(serverToken.size())), serverToken.data(), serverToken.size());
+                client.CommitReceived(static_cast<uint32_t>(serverToken.size()));
+                clientStatus = client.IsHandshakeComplete() ? client.Decrypt(clientToken) : client.Handshake(clientToken);
+                Assert::IsTrue(SEC_E_OK == clientStatus || SEC_I_CONTINUE_NEEDED == clientStatus || SEC_E_INCOMPLETE_MESSAGE == clientStatus);
+            }
+        }
+
+        Assert::IsTrue(client.IsHandshakeComplete());
+        Assert::IsTrue(server.IsHandshakeComplete());
+    }
+
+    std::vector<char> MakePattern(size_t length)
+    {
+        std::vector<char> pattern(length);
+        for (size_t offset = 0; offset < length; ++offset)
+        {
+            pattern[offset] = static_cast<char>(offset % 251);
+        }
+        return pattern;
+    }
+
+    std::vector<char> ReadAll(ctsTlsSession& session)
+    {
+        std::vector<char> plaintext(session.GetPlaintextLength());
+        Assert::AreEqual(static_cast<uint32_t>(plaintext.size()), session.ReadPlaintext(plaintext.data(), static_cast<uint32_t>(plaintext.size())));
+        return plaintext;
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsTlsSessionUnitTest)
+    {
+    public:
+        TEST_CLASS_INITIALIZE(Setup)
+        {
+            g_certificate = std::make_unique<ctsTlsSelfSignedCertificate>();
+            g_serverCredential = std::make_unique<ctsTlsCredential>(g_certificate->Get());
+            g_clientCredential = std::make_unique<ctsTlsCredential>(nullptr);
+        }
+
+        TEST_CLASS_CLEANUP(Cleanup)
+        {
+            g_clientCredential.reset();
+            g_serverCredential.reset();
+            g_certificate.reset();
+        }
+
+        TEST_METHOD(HandshakeCompletes)
+        {
+            ctsTlsSession client(*g_clientCredential, 0);
+            ctsTlsSession server(*g_serverCredential, 0);
+            Assert::IsFalse(client.IsHandshakeComplete());
+            Assert::IsFalse(server.IsHandshakeComplete());
+
+            CompleteHandshake(client, server);
+            Assert::IsTrue(client.GetMaxRecordSize() > 0);
+            Assert::IsTrue(client.GetMaxRecordSize() <= 16384);
+            Assert::IsFalse(client.IsShutdownReceived());
+            Assert::IsFalse(server.IsShutdownReceived());
+        }
+
+        TEST_METHOD(ServerWaitsForTheClientHello)
+        {
+            ctsTlsSession server(*g_serverCredential, 0);
+            std::vector<char> serverToken;
+            Assert::AreEqual(SEC_E_INCOMPLETE_MESSAGE, server.Handshake(serverToken));
+            Assert::IsTrue(serverToken.empty());
+        }
+
+        TEST_METHOD(EncryptedDataRoundTrips)
+        {
+            ctsTlsSession client(*g_clientCredential, 0);
+            ctsTlsSession server(*g_serverCredential, 0);
+            CompleteHandshake(client, server);
+
+            const auto sent = MakePattern(64 * 1024);
+            std::vector<char> ciphertext;
+            uint32_t recordCount{};
+            Assert::AreEqual(SEC_E_OK, client.Encrypt(sent.data(), static_cast<uint32_t>(sent.size()), ciphertext, &recordCount));
+            Assert::IsTrue(recordCount >= 4);
+            Assert::IsTrue(ciphertext.size() > sent.size());
+
+            std::vector<char> serverOutput;
+            Deliver(ciphertext, server, ciphertext.size(), serverOutput);
+            Assert::IsTrue(ReadAll(server) == sent);
+
+            // and back the other way
+            ciphertext.clear();
+            Assert::AreEqual(SEC_E_OK, server.Encrypt(sent.data(), static_cast<uint32_t>(sent.size()), ciphertext, &recordCount));
+            std::vector<char> clientOutput;
+            Deliver(ciphertext, client, ciphertext.size(), clientOutput);
+            Assert::IsTrue(ReadAll(client) == sent);
+        }
+
+        TEST_METHOD(PartialRecordsAreKeptUntilComplete)
+        {
+            ctsTlsSession client(*g_clientCredential, 0);
+            ctsTlsSession server(*g_serverCredential, 0);
+            CompleteHandshake(client, server);
+
+            const auto sent = MakePattern(10000);
+            std::vector<char> ciphertext;
+            uint32_t recordCount{};
+            Assert::AreEqual(SEC_E_OK, client.Encrypt(sent.data(), static_cast<uint32_t>(sent.size()), ciphertext, &recordCount));
+
+            // ciphertext trickles in a few bytes at a time, splitting headers and records
+            std::vector<char> serverOutput;
+            Deliver(ciphertext, server, 7, serverOutput);
+            Assert::IsTrue(ReadAll(server) == sent);
+            Assert::AreEqual(size_t{0}, server.GetPlaintextLength());
+        }
+
+        TEST_METHOD(RecordSizeLimitsPlaintextPerRecord)
+        {
+            ctsTlsSession client(*g_clientCredential, 1000);
+            ctsTlsSession server(*g_serverCredential, 0);
+            CompleteHandshake(client, server);
+            Assert::AreEqual(1000u, client.GetMaxRecordSize());
+
+            const auto sent = MakePattern(100 * 1000);
+            std::vector<char> ciphertext;
+            uint32_t recordCount{};
+            Assert::AreEqual(SEC_E_OK, client.Encrypt(sent.data(), static_cast<uint32_t>(sent.size()), ciphertext, &recordCount));
+            Assert::AreEqual(100u, recordCount);
+
+            // the partial last record counts as a record
+            std::vector<char> tail;
+            Assert::AreEqual(SEC_E_OK, client.Encrypt(sent.data(), 1001, tail, &recordCount));
+            Assert::AreEqual(2u, recordCount);
+
+            std::vector<char> serverOutput;
+            Deliver(ciphertext, server, ciphertext.size(), serverOutput);
+            Assert::IsTrue(ReadAll(server) == sent);
+        }
+
+        TEST_METHOD(ReadPlaintextReturnsPartialReads)
+        {
+            ctsTlsSession client(*g_clientCredential, 0);
+            ctsTlsSession server(*g_serverCredential, 0);
+            CompleteHandshake(client, server);
+
+            const auto sent = MakePattern(300);
+            std::vector<char> ciphertext;
+            uint32_t recordCount{};
+            Assert::AreEqual(SEC_E_OK, client.Encrypt(sent.data(), static_cast<uint32_t>(sent.size()), ciphertext, &recordCount));
+            std::vector<char> serverOutput;
+            Deliver(ciphertext, server, ciphertext.size(), serverOutput);
+
+            std::vector<char> received(sent.size());
+            Assert::AreEqual(100u, server.ReadPlaintext(received.data(), 100));
+            Assert::AreEqual(size_t{200}, server.GetPlaintextLength());
+            Assert::AreEqual(200u, server.ReadPlaintext(received.data() + 100, 1000));
+            Assert::AreEqual(size_t{0}, server.GetPlaintextLength());
+            Assert::IsTrue(received == sent);
+        }
+
+        TEST_METHOD(ShutdownSendsCloseNotify)
+        {
+            ctsTlsSession client(*g_clientCredential, 0);
+            ctsTlsSession server(*g_serverCredential, 0);
+            CompleteHandshake(client, server);
+
+            // data sent before close_notify is still delivered
+            const auto sent = MakePattern(500);
+            std::vector<char> ciphertext;
+            uint32_t recordCount{};
+            Assert::AreEqual(SEC_E_OK, client.Encrypt(sent.data(), static_cast<uint32_t>(sent.size()), ciphertext, &recordCount));
+            Assert::AreEqual(SEC_E_OK, client.Shutdown(ciphertext));
+
+            std::vector<char> serverOutput;
+            Deliver(ciphertext, server, ciphertext.size(), serverOutput);
+            Assert::IsTrue(server.IsShutdownReceived());
+            Assert::IsTrue(ReadAll(server) == sent);
+
+            // and the server can shut down its side in reply
+            std::vector<char> serverShutdown;
+            Assert::AreEqual(SEC_E_OK, server.Shutdown(serverShutdown));
+            Assert::IsFalse(serverShutdown.empty());
+            std::vector<char> clientOutput;
+            Deliver(serverShutdown, client, serverShutdown.size(), clientOutput);
+            Assert::IsTrue(client.IsShutdownReceived());
+        }
+    };
+}
@@ -0,0 +1,262 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+/*
+    Unit tests for -IO:WSAPoll sending queued tasks: partial sends, would-block, failures, and the per-pass budget
+    - each non-blocking send's result is scripted by the test, as ::send would return them
+*/
+
+#include <sdkddkver.h>
+#include "CppUnitTest.h"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "../../ctsTraffic/ctsWSAPollSend.hpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace ctsTraffic;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+template <>
+inline std::wstring ToString<ctsWSAPollSendStatus>(const ctsWSAPollSendStatus& status)
+{
+    switch (status)
+    {
+        case ctsWSAPollSendStatus::Drained:
+            return L"Drained";
+        case ctsWSAPollSendStatus::WouldBlock:
+            return L"WouldBlock";
+        case ctsWSAPollSendStatus::BudgetSpent:
+            return L"BudgetSpent";
+        case ctsWSAPollSendStatus::ConnectionDone:
+            return L"ConnectionDone";
+    }
+    return L"Unknown";
+}
+}
+
+namespace
+{
+    // stands in for ctsTask: only the buffer fields are used
+    struct TestTask
+    {
+        char* m_buffer = nullptr;
+        uint32_t m_bufferOffset = 0;
+        uint32_t m_bufferLength = 0;
+    };
+
+    constexpr uint32_t c_connectionReset = 10054;
+
+    struct SendCall
+    {
+        const char* m_buffer;
+        uint32_t m_length;
+    };
+
+    struct Completion
+    {
+        const char* m_buffer;
+        uint32_t m_transferred;
+        uint32_t m_error;
+    };
+
+    // returns the scripted results in order, recording each call
+    class ScriptedSocket
+    {
+    public:
+        explicit ScriptedSocket(std::vector<ctsNonBlockingSendResult> results) :
+            m_results(std::move(results))
+        {
+        }
+
+        ctsNonBlockingSendResult Send(const char* buffer, uint32_t length)
+        {
+            m_calls.push_back({buffer, length});
+            Assert::IsTrue(m_nextResult < m_results.size(), L"more sends than the test scripted");
+            return m_results[m_nextResult++];
+        }
+
+        std::vector<SendCall> m_calls;
+
+    private:
+        std::vector<ctsNonBlockingSendResult> m_results;
+        size_t m_nextResult = 0;
+    };
+
+    ctsNonBlockingSendResult Sent(uint32_t bytes)
+    {
+        return {bytes, 0, false};
+    }
+
+    ctsNonBlockingSendResult WouldBlock()
+    {
+        return {0, 0, true};
+    }
+
+    ctsNonBlockingSendResult Failed(uint32_t error)
+    {
+        return {0, error, false};
+    }
+}
+
+namespace ctsUnitTest
+{
+    TEST_CLASS(ctsWSAPollSendUnitTest)
+    {
+    public:
+        TEST_METHOD(PartialSendsCompleteTheTaskOnce)
+        {
+            char buffer[10]{};
+            std::deque<TestTask> tasks{{buffer, 0, 10}};
+            uint32_t partialSendBytes = 0;
+            uint32_t budget = 16;
+            ScriptedSocket socket({Sent(3), Sent(3), Sent(4)});
+            std::vector<Completion> completions;
+
+            const auto status = ctsWSAPollSendTasks(
+                tasks, partialSendBytes, budget,
+                [&](const char* sendBuffer, uint32_t length) { return socket.Send(sendBuffer, length); },
+                [&](const TestTask& task, uint32_t transferred, uint32_t error) {
+                    completions.push_back({task.m_buffer, transferred, error});
+                    return false;
+                });
+
+            Assert::AreEqual(ctsWSAPollSendStatus::Drained, status);
+            // each send continues from the bytes already accepted
+            Assert::AreEqual(size_t{3}, socket.m_calls.size());
+            Assert::IsTrue(buffer == socket.m_calls[0].m_buffer);
+            Assert::AreEqual(10u, socket.m_calls[0].m_length);
+            Assert::IsTrue(buffer + 3 == socket.m_calls[1].m_buffer);
+            Assert::AreEqual(7u, socket.m_calls[1].m_length);
+            Assert::IsTrue(buffer + 6 == socket.m_calls[2].m_buffer);
+            Assert::AreEqual(4u, socket.m_calls[2].m_length);
+
+            // completed once, with the full length - as CompleteIo expects of an overlapped WSASend
+            Assert::AreEqual(size_t{1}, completions.size());
+            Assert::AreEqual(10u, completions[0].m_transferred);
+            Assert::AreEqual(0u, completions[0].m_error);
+            Assert::AreEqual(0u, partialSendBytes);
+            Assert::AreEqual(13u, budget);
+        }
+
+        TEST_METHOD(WouldBlockKeepsThePartialSend)
+        {
+            char buffer[20]{};
+            std::deque<TestTask> tasks{{buffer, 4, 8}};
+            uint32_t partialSendBytes = 0;
+            uint32_t budget = 16;
+            std::vector<Completion> completions;
+            const auto complete = [&](const TestTask& task, uint32_t transferred, uint32_t error) {
+                completions.push_back({task.m_buffer, transferred, error});
+                return false;
+            };
+
+            ScriptedSocket firstPass({Sent(5), WouldBlock()});
+            Assert::AreEqual(
+                ctsWSAPollSendStatus::WouldBlock,
+                ctsWSAPollSendTasks(tasks, partialSendBytes, budget, [&](const char* b, uint32_t l) { return firstPass.Send(b, l); }, complete));
+            Assert::IsTrue(completions.empty());
+            Assert::AreEqual(5u, partialSendBytes);
+            Assert::AreEqual(size_t{1}, tasks.size());
+
+            // once writable, the rest of the task is sent from where it left off
+            ScriptedSocket secondPass({Sent(3)});
+            Assert::AreEqual(
+                ctsWSAPollSendStatus::Drained,
+                ctsWSAPollSendTasks(tasks, partialSendBytes, budget, [&](const char* b, uint32_t l) { return secondPass.Send(b, l); }, complete));
+            Assert::IsTrue(buffer + 4 + 5 == secondPass.m_calls[0].m_buffer);
+            Assert::AreEqual(3u, secondPass.m_calls[0].m_length);
+            Assert::AreEqual(size_t{1}, completions.size());
+            Assert::AreEqual(8u, completions[0].m_transferred);
+        }
+
+        TEST_METHOD(FailedSendCompletesWithTheError)
+        {
+            char first[8]{};
+            char second[8]{};
+            std::deque<TestTask> tasks{{first, 0, 8}, {second, 0, 8}};
+            uint32_t partialSendBytes = 0;
+            uint32_t budget = 16;
+            ScriptedSocket socket({Sent(2), Failed(c_connectionReset), Sent(8)});
+            std::vector<Completion> completions;
+
+            const auto status = ctsWSAPollSendTasks(
+                tasks, partialSendBytes, budget,
+                [&](const char* b, uint32_t l) { return socket.Send(b, l); },
+                [&](const TestTask& task, uint32_t transferred, uint32_t error) {
+                    completions.push_back({task.m_buffer, transferred, error});
+                    return false;
+                });
+
+            // the pattern chose to continue: the next task starts from its own first byte
+            Assert::AreEqual(ctsWSAPollSendStatus::Drained, status);
+            Assert::AreEqual(size_t{2}, completions.size());
+            Assert::IsTrue(first == completions[0].m_buffer);
+            Assert::AreEqual(0u, completions[0].m_transferred);
+            Assert::AreEqual(c_connectionReset, completions[0].m_error);
+            Assert::IsTrue(second == socket.m_calls[2].m_buffer);
+            Assert::AreEqual(8u, completions[1].m_transferred);
+        }
+
+        TEST_METHOD(CompletionEndingTheConnectionStopsSending)
+        {
+            char buffer[8]{};
+            std::deque<TestTask> tasks{{buffer, 0, 4}, {buffer, 4, 4}};
+            uint32_t partialSendBytes = 0;
+            uint32_t budget = 16;
+            ScriptedSocket socket({Failed(c_connectionReset)});
+
+            const auto status = ctsWSAPollSendTasks(
+                tasks, partialSendBytes, budget,
+                [&](const char* b, uint32_t l) { return socket.Send(b, l); },
+                [&](const TestTask&, uint32_t, uint32_t) { return true; });
+
+            // the remaining task is left queued for the caller to complete as aborted
+            Assert::AreEqual(ctsWSAPollSendStatus::ConnectionDone, status);
+            Assert::AreEqual(size_t{1}, tasks.size());
+            Assert::AreEqual(4u, tasks.front().m_bufferOffset);
+        }
+
+        TEST_METHOD(BudgetLimitsSendsPerPass)
+        {
+            char buffer[12]{};
+            std::deque<TestTask> tasks{{buffer, 0, 4}, {buffer, 4, 4}, {buffer, 8, 4}};
+            uint32_t partialSendBytes = 0;
+            uint32_t budget = 3;
+            ScriptedSocket socket({Sent(4), Sent(2), Sent(2), Sent(4)});
+            uint32_t completed = 0;
+            const auto complete = [&](const TestTask&, uint32_t, uint32_t) {
+                ++completed;
+                return false;
+            };
+
+            Assert::AreEqual(
+                ctsWSAPollSendStatus::BudgetSpent,
+                ctsWSAPollSendTasks(tasks, partialSendBytes, budget, [&](const char* b, uint32_t l) { return socket.Send(b, l); }, complete));
+            Assert::AreEqual(2u, completed);
+            Assert::AreEqual(0u, budget);
+            Assert::AreEqual(size_t{1}, tasks.size());
+
+            // the next pass picks up the last task
+            budget = 3;
+            Assert::AreEqual(
+                ctsWSAPollSendStatus::Drained,
+                ctsWSAPollSendTasks(tasks, partialSendBytes, budget, [&](const char* b, uint32_t l) { return socket.Send(b, l); }, complete));
+            Assert::AreEqual(3u, completed);
+            Assert::AreEqual(2u, budget);
+        }
+    };
+}
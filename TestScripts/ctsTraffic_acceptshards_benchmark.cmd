@@ -0,0 +1,51 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark measures the server's accept rate over loopback with and without -AcceptShards
+echo .
+echo Every connection pushes 4KB and closes, so the rate is bound by connection setup
+echo  ... without shards the listener's AcceptEx completions are processed on the threadpool
+echo  ... with shards they are processed by that many IOCP workers on the listener's completion port
+echo .
+echo Compare Connections/sec in each server summary, and the accepts reported for each of the AcceptEx Shards
+echo .
+echo Status is written to acceptshards_benchmark_[run].csv for each server run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set ListenOptions= -listen:* -pattern:push -transfer:0x1000 -buffer:0x1000 -AcceptDepth:[100,1000]
+set ConnectOptions= -pattern:push -transfer:0x1000 -buffer:0x1000 -connections:256 -iterations:500 -ThrottleConnections:256
+set ServerExitLimit=128000
+
+echo .
+echo ----- without -AcceptShards -----
+start /b ctsTraffic.exe %ListenOptions% -ServerExitLimit:%ServerExitLimit% -ConsoleVerbosity:1 -StatusFilename:acceptshards_benchmark_noshards.csv
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost %ConnectOptions% -ConsoleVerbosity:0
+REM the server prints its summary once it has accepted ServerExitLimit connections
+timeout /t 5 /nobreak >nul
+
+for %%s in (2 4) do (
+  echo .
+  echo ----- -AcceptShards:%%s -----
+  start /b ctsTraffic.exe %ListenOptions% -AcceptShards:%%s -ServerExitLimit:%ServerExitLimit% -ConsoleVerbosity:1 -StatusFilename:acceptshards_benchmark_shards%%s.csv
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %ConnectOptions% -ConsoleVerbosity:0
+  timeout /t 5 /nobreak >nul
+)
+
+:exit
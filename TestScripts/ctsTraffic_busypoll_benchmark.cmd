@@ -0,0 +1,47 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares -IO:RioIocp with and without -BusyPoll over loopback
+echo .
+echo Each run uses 64 byte buffers with one IO posted at a time, so every IO waits on the previous completion
+echo  ... compare the time to complete and the CPU usage of each run
+echo  ... -BusyPoll reports the time spent spinning versus processing completions,
+echo      how many notifications were dequeued while spinning versus after blocking,
+echo      and the percentiles of how long workers waited for each notification
+echo .
+echo Status is written to busypoll_benchmark_[usec].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=4
+set LatencyOptions= -IO:RioIocp -pattern:pushpull -pushbytes:64 -pullbytes:64 -buffer:64 -transfer:0x400000 -verify:connection
+
+for %%u in (0 10 50 200) do (
+  echo .
+  echo ----- -IO:RioIocp -BusyPoll:%%u -----
+  if %%u==0 (
+    start /b ctsTraffic.exe -listen:* %LatencyOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+    timeout /t 2 /nobreak >nul
+    ctsTraffic.exe -target:localhost %LatencyOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:busypoll_benchmark_off.csv
+  ) else (
+    start /b ctsTraffic.exe -listen:* %LatencyOptions% -BusyPoll:%%u -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+    timeout /t 2 /nobreak >nul
+    ctsTraffic.exe -target:localhost %LatencyOptions% -BusyPoll:%%u -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:busypoll_benchmark_%%u.csv
+  )
+)
+
+:exit
@@ -0,0 +1,61 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares sending from memory with sending from a file over loopback, all with -IO:iocp
+echo .
+echo Send runs: the server pulls 1GB to each connection from memory, then from a generated 4GB file with a warm and a cold cache
+echo  ... the cold run purges the file from the system cache first: on machines with more than 4GB free it only starts cold
+echo Receive runs: the client writes all data received to a file, buffered and then unbuffered
+echo  ... the summary reports the network throughput, the file + network throughput, and the CPU cycles per file byte
+echo .
+echo Pass a directory for the files on the disk to measure (default is the current directory)
+echo .
+echo Status is written to file_benchmark_[run].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set FileDirectory=.
+if not "%1"=="" set FileDirectory=%1
+
+set PullOptions= -IO:iocp -pattern:pull -buffer:0x40000 -transfer:0x40000000 -verify:data
+set Connections=8
+
+echo .
+echo ----- from memory -----
+start /b ctsTraffic.exe -listen:* %PullOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost %PullOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:file_benchmark_memory.csv
+
+for %%c in (warm cold) do (
+  echo .
+  echo ----- -SendFile -SendFileCache:%%c -----
+  start /b ctsTraffic.exe -listen:* %PullOptions% -SendFile:%FileDirectory%\ctsTraffic_send.dat -SendFileSize:0x100000000 -SendFileCache:%%c -ServerExitLimit:%Connections% -ConsoleVerbosity:1
+  timeout /t 30 /nobreak >nul
+  ctsTraffic.exe -target:localhost %PullOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:file_benchmark_send_%%c.csv
+)
+
+for %%m in (buffered unbuffered) do (
+  echo .
+  echo ----- -RecvFile -RecvFileMode:%%m -----
+  start /b ctsTraffic.exe -listen:* %PullOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %PullOptions% -RecvFile:%FileDirectory%\ctsTraffic_recv.dat -RecvFileMode:%%m -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:file_benchmark_recv_%%m.csv
+)
+
+del %FileDirectory%\ctsTraffic_send.dat %FileDirectory%\ctsTraffic_recv.dat
+
+:exit
@@ -0,0 +1,71 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares the TCP send/recv IO engines over loopback (-IO:iocp, -IO:ReadWriteFile, -IO:RioIocp, -IO:WSAPoll)
+echo .
+echo Each engine is run twice:
+echo  ... throughput : 64KB buffers, 1GB per connection - compare the total Bits/sec in the summary
+echo  ... operations : 64 byte buffers, 16MB per connection - compare the time to complete (262,144 IO per connection)
+echo .
+echo -PrePostRecvs and -PrePostSends are set so each engine has multiple IO requests to submit at once
+echo  ... -IO:RioIocp submits all IO offered together as one batch
+echo  ... -IO:WSAPoll also reports the total syscalls and syscalls per GB in the summary
+echo .
+echo -IO:RioIocp is then run with 1,000 and 10,000 connections, with and without -SubmitBatchSize
+echo  ... -SubmitBatchSize reports the requests per submission and the submission delay in the summary
+echo .
+echo Status is written to io_benchmark_[engine]_[run].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=8
+set ThroughputOptions= -pattern:duplex -buffer:65536 -transfer:0x40000000 -PrePostRecvs:4 -PrePostSends:4 -verify:connection
+set OperationsOptions= -pattern:duplex -buffer:64 -transfer:0x1000000 -PrePostRecvs:4 -PrePostSends:4 -verify:connection
+
+for %%e in (iocp ReadWriteFile RioIocp WSAPoll) do (
+  echo .
+  echo ----- -IO:%%e throughput -----
+  start /b ctsTraffic.exe -listen:* -IO:%%e %ThroughputOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost -IO:%%e %ThroughputOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:io_benchmark_%%e_throughput.csv
+
+  echo .
+  echo ----- -IO:%%e operations -----
+  start /b ctsTraffic.exe -listen:* -IO:%%e %OperationsOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost -IO:%%e %OperationsOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:io_benchmark_%%e_operations.csv
+)
+
+set ScaleOptions= -IO:RioIocp -pattern:duplex -buffer:1024 -transfer:0x100000 -PrePostRecvs:2 -PrePostSends:2 -verify:connection
+
+for %%c in (1000 10000) do (
+  for %%b in (0 64) do (
+    echo .
+    echo ----- -IO:RioIocp %%c connections -SubmitBatchSize:%%b -----
+    if %%b==0 (
+      start /b ctsTraffic.exe -listen:* %ScaleOptions% -ServerExitLimit:%%c -ConsoleVerbosity:0
+      timeout /t 2 /nobreak >nul
+      ctsTraffic.exe -target:localhost %ScaleOptions% -connections:%%c -iterations:1 -ConsoleVerbosity:1 -StatusFilename:io_benchmark_RioIocp_%%c_nobatch.csv
+    ) else (
+      start /b ctsTraffic.exe -listen:* %ScaleOptions% -SubmitBatchSize:%%b -ServerExitLimit:%%c -ConsoleVerbosity:0
+      timeout /t 2 /nobreak >nul
+      ctsTraffic.exe -target:localhost %ScaleOptions% -SubmitBatchSize:%%b -connections:%%c -iterations:1 -ConsoleVerbosity:1 -StatusFilename:io_benchmark_RioIocp_%%c_batch%%b.csv
+    )
+  )
+)
+
+:exit
@@ -0,0 +1,66 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares -IO:iocp over TCP with -IO:Quic over loopback
+echo   msquic.dll must be alongside ctsTraffic.exe (from the Microsoft.Native.Quic.MsQuic.Schannel NuGet package)
+echo .
+echo Bulk runs: each connection transfers 1GB, repeated with -QuicStreams of 1, 4 and 16 streams per QUIC connection
+echo  ... compare the throughput and CPU of each run against the -IO:iocp baseline
+echo  ... the summary reports the QUIC goodput and the stream start time percentiles
+echo .
+echo Handshake run: short connections each transferring only 1KB with a QUIC connection per stream, so the handshake dominates the run
+echo  ... the summary reports QUIC handshakes per second and the handshake time percentiles
+echo .
+echo By default the server creates a self-signed certificate for the run
+echo  ... pass a certificate thumbprint from the CurrentUser or LocalMachine My store to use that certificate instead
+echo .
+echo Status is written to quic_benchmark_[run].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set CertificateOption=
+if not "%1"=="" set CertificateOption= -TlsCertificate:%1
+
+set BulkOptions= -pattern:push -buffer:0x10000 -transfer:0x40000000 -verify:connection
+set Connections=16
+
+echo .
+echo ----- -IO:iocp baseline -----
+start /b ctsTraffic.exe -listen:* -IO:iocp %BulkOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost -IO:iocp %BulkOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:quic_benchmark_iocp.csv
+
+for %%s in (1 4 16) do (
+  echo .
+  echo ----- -IO:Quic -QuicStreams:%%s -----
+  start /b ctsTraffic.exe -listen:* -IO:Quic %BulkOptions%%CertificateOption% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost -IO:Quic %BulkOptions% -QuicStreams:%%s -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:quic_benchmark_%%s.csv
+)
+
+set HandshakeConnections=50
+set HandshakeIterations=100
+set /a TotalHandshakes=%HandshakeConnections% * %HandshakeIterations%
+set HandshakeOptions= -IO:Quic -pattern:duplex -buffer:1024 -transfer:1024 -verify:connection
+
+echo .
+echo ----- -IO:Quic handshakes : %TotalHandshakes% connections -----
+start /b ctsTraffic.exe -listen:* %HandshakeOptions%%CertificateOption% -ServerExitLimit:%TotalHandshakes% -ConsoleVerbosity:0
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost %HandshakeOptions% -connections:%HandshakeConnections% -iterations:%HandshakeIterations% -ConsoleVerbosity:1 -StatusFilename:quic_benchmark_handshakes.csv
+
+:exit
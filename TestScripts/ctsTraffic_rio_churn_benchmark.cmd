@@ -0,0 +1,44 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark churns short -IO:RioIocp connections over loopback to measure RIO buffer registrations per connection
+echo .
+echo Each connection transfers only 64KB, so connection setup and teardown dominate the run
+echo  ... the summary reports the total RIO Buffer Registrations and the registrations per connection
+echo  ... registered buffers are pooled across connections, so registrations per connection should fall
+echo      toward the 2 each connection still registers (its connection ID and completion message) as the run goes on
+echo .
+echo Each run is repeated with 1 and 8 -PrePostRecvs / -PrePostSends to vary the buffers each connection needs
+echo .
+echo Status is written to rio_churn_benchmark_[prepost].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=100
+set Iterations=100
+set /a TotalConnections=%Connections% * %Iterations%
+set ChurnOptions= -IO:RioIocp -pattern:duplex -buffer:4096 -transfer:0x10000 -verify:connection
+
+for %%p in (1 8) do (
+  echo .
+  echo ----- -IO:RioIocp -PrePostRecvs:%%p -PrePostSends:%%p : %TotalConnections% connections -----
+  start /b ctsTraffic.exe -listen:* %ChurnOptions% -PrePostRecvs:%%p -PrePostSends:%%p -ServerExitLimit:%TotalConnections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %ChurnOptions% -PrePostRecvs:%%p -PrePostSends:%%p -connections:%Connections% -iterations:%Iterations% -ConsoleVerbosity:1 -StatusFilename:rio_churn_benchmark_%%p.csv
+)
+
+:exit
@@ -0,0 +1,47 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark measures the connection rate over loopback with and without -SocketPool
+echo .
+echo Every connection pushes 4KB and closes, so the rate is bound by connection setup
+echo  ... without the pool each connection creates, configures and binds its socket before connecting
+echo  ... with the pool connections take sockets created in the background, only stalling when the pool is empty
+echo .
+echo Compare Connections/sec in each summary, and the Socket Pool stalls with the pool
+echo .
+echo Status is written to socketpool_benchmark_[run].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set ConnectOptions= -pattern:push -transfer:0x1000 -buffer:0x1000 -connections:64 -iterations:2000 -ThrottleConnections:64
+set ServerExitLimit=128000
+
+echo .
+echo ----- without -SocketPool -----
+start /b ctsTraffic.exe -listen:* -pattern:push -transfer:0x1000 -buffer:0x1000 -ServerExitLimit:%ServerExitLimit% -ConsoleVerbosity:0
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost %ConnectOptions% -ConsoleVerbosity:1 -StatusFilename:socketpool_benchmark_nopool.csv
+
+for %%p in (256 1024) do (
+  echo .
+  echo ----- -SocketPool:%%p -----
+  start /b ctsTraffic.exe -listen:* -pattern:push -transfer:0x1000 -buffer:0x1000 -ServerExitLimit:%ServerExitLimit% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %ConnectOptions% -SocketPool:%%p -ConsoleVerbosity:1 -StatusFilename:socketpool_benchmark_pool%%p.csv
+)
+
+:exit
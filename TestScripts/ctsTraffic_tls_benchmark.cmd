@@ -0,0 +1,66 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares plaintext -IO:iocp with -IO:Tls over loopback
+echo .
+echo Bulk runs: each connection transfers 1GB, repeated with -TlsRecordSize of 1024, 4096 and 16384 bytes
+echo  ... compare the throughput and CPU of each run against the -IO:iocp baseline
+echo  ... the summary reports the TLS records sent, the record overhead and the encrypt / decrypt time per byte
+echo .
+echo Handshake run: short connections each transferring only 1KB, so the TLS handshake dominates the run
+echo  ... the summary reports TLS handshakes per second and the handshake time percentiles
+echo .
+echo By default the server creates a self-signed certificate for the run
+echo  ... pass a certificate thumbprint from the CurrentUser or LocalMachine My store to use that certificate instead
+echo      e.g. from PowerShell: (New-SelfSignedCertificate -DnsName localhost -CertStoreLocation Cert:\CurrentUser\My).Thumbprint
+echo .
+echo Status is written to tls_benchmark_[run].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set CertificateOption=
+if not "%1"=="" set CertificateOption= -TlsCertificate:%1
+
+set BulkOptions= -pattern:push -buffer:0x10000 -transfer:0x40000000 -verify:connection
+set Connections=8
+
+echo .
+echo ----- -IO:iocp baseline -----
+start /b ctsTraffic.exe -listen:* -IO:iocp %BulkOptions% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost -IO:iocp %BulkOptions% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:tls_benchmark_iocp.csv
+
+for %%r in (1024 4096 16384) do (
+  echo .
+  echo ----- -IO:Tls -TlsRecordSize:%%r -----
+  start /b ctsTraffic.exe -listen:* -IO:Tls %BulkOptions% -TlsRecordSize:%%r%CertificateOption% -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost -IO:Tls %BulkOptions% -TlsRecordSize:%%r -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:tls_benchmark_%%r.csv
+)
+
+set HandshakeConnections=50
+set HandshakeIterations=100
+set /a TotalHandshakes=%HandshakeConnections% * %HandshakeIterations%
+set HandshakeOptions= -IO:Tls -pattern:duplex -buffer:1024 -transfer:1024 -verify:connection
+
+echo .
+echo ----- -IO:Tls handshakes : %TotalHandshakes% connections -----
+start /b ctsTraffic.exe -listen:* %HandshakeOptions%%CertificateOption% -ServerExitLimit:%TotalHandshakes% -ConsoleVerbosity:0
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost %HandshakeOptions% -connections:%HandshakeConnections% -iterations:%HandshakeIterations% -ConsoleVerbosity:1 -StatusFilename:tls_benchmark_handshakes.csv
+
+:exit
@@ -0,0 +1,49 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark runs 1,000 concurrent UDP media streams over loopback comparing -DatagramBatchSize and -UdpOffload
+echo .
+echo Each stream is 10Mbps at 100 frames per second for 30 seconds - each configuration is run once:
+echo  ... batch1          : -DatagramBatchSize:1 (one receive posted per listening socket, the default receives per stream)
+echo  ... batch32         : -DatagramBatchSize:32 (a batch of receives kept posted on every datagram socket)
+echo  ... batch32_offload : -DatagramBatchSize:32 -UdpOffload:on (segmented sends and coalesced receives)
+echo .
+echo Compare the summary across runs:
+echo  ... server : Total Send Calls (per second), Datagrams Per Send Call, and CPU Cycles Per Gbit
+echo  ... client : Total Recv Calls (per second), Datagrams Per Recv Call, CPU Cycles Per Gbit, and Frame Jitter
+echo .
+echo Status is written to udp_batch_[configuration].csv and jitter to udp_batch_[configuration]_jitter.csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=1000
+set Options= -protocol:udp -BitsPerSecond:10000000 -FrameRate:100 -StreamLength:30 -BufferDepth:2 -verify:connection
+
+call :run batch1 -DatagramBatchSize:1
+call :run batch32 -DatagramBatchSize:32
+call :run batch32_offload -DatagramBatchSize:32 -UdpOffload:on
+goto :exit
+
+:run
+echo .
+echo ----- %1 -----
+start /b ctsTraffic.exe -listen:* %Options% %2 %3 -ServerExitLimit:%Connections% -ConsoleVerbosity:1
+timeout /t 2 /nobreak >nul
+ctsTraffic.exe -target:localhost %Options% %2 %3 -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:udp_batch_%1.csv -JitterFilename:udp_batch_%1_jitter.csv
+goto :eof
+
+:exit
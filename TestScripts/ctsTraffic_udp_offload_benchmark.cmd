@@ -0,0 +1,50 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares the UDP media stream with and without -UdpOffload:on over loopback
+echo .
+echo Each bit rate (1Gbps, 10Gbps) is run twice, streaming for 30 seconds on each connection:
+echo  ... datagram : one WSASendTo per datagram on the server, one WSARecvFrom per datagram on the client
+echo  ... offload  : -UdpOffload:on (one segmented send per frame, multiple datagrams coalesced into each receive)
+echo .
+echo Compare the summary across runs:
+echo  ... server : Total Send Calls (per second) and CPU Cycles Per Gbit
+echo  ... client : Total Recv Calls (per second), Datagrams Per Recv Call, and CPU Cycles Per Gbit
+echo  ... client : Dropped and Error Frames must remain unchanged - every datagram is verified after being split back out
+echo .
+echo Status is written to udp_offload_[bitrate]_[mode].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=8
+set Options= -protocol:udp -FrameRate:100 -StreamLength:30 -BufferDepth:2
+
+for %%r in (1000000000 10000000000) do (
+  echo .
+  echo ----- -BitsPerSecond:%%r datagram -----
+  start /b ctsTraffic.exe -listen:* %Options% -BitsPerSecond:%%r -ServerExitLimit:%Connections% -ConsoleVerbosity:1
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %Options% -BitsPerSecond:%%r -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:udp_offload_%%r_datagram.csv
+
+  echo .
+  echo ----- -BitsPerSecond:%%r offload -----
+  start /b ctsTraffic.exe -listen:* %Options% -BitsPerSecond:%%r -UdpOffload:on -ServerExitLimit:%Connections% -ConsoleVerbosity:1
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %Options% -BitsPerSecond:%%r -UdpOffload:on -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:udp_offload_%%r_offload.csv
+)
+
+:exit
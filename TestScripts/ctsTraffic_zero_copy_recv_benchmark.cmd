@@ -0,0 +1,52 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares buffered receives with -ZeroCopyRecv:on (SO_RCVBUF=0) over loopback using -IO:iocp
+echo .
+echo The client receives 4GB on each connection (-pattern:pull), with each verification mode run twice:
+echo  ... -verify:connection : 4 receives kept posted on each connection (all connections share one receive buffer)
+echo  ... -verify:data       : 1 receive kept posted on each connection (every byte is verified)
+echo .
+echo Compare the client's summary across runs:
+echo  ... CPU Cycles Per Byte
+echo  ... Zero-Copy Recv Bytes / Copied By The Stack : the bytes which arrived before a receive was posted
+echo .
+echo Status is written to zero_copy_recv_[verify]_[mode].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=4
+set Options= -IO:iocp -pattern:pull -buffer:262144 -transfer:0x100000000
+
+for %%v in (connection data) do (
+  if %%v==connection (set VerifyOptions= -verify:connection -PrePostRecvs:4) else (set VerifyOptions= -verify:data -PrePostRecvs:1)
+
+  echo .
+  echo ----- -verify:%%v buffered -----
+  start /b ctsTraffic.exe -listen:* %Options% -verify:%%v -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  call ctsTraffic.exe -target:localhost %Options% %%VerifyOptions%% -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:zero_copy_recv_%%v_buffered.csv
+
+  echo .
+  echo ----- -verify:%%v zerocopy -----
+  start /b ctsTraffic.exe -listen:* %Options% -verify:%%v -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  call ctsTraffic.exe -target:localhost %Options% %%VerifyOptions%% -ZeroCopyRecv:on -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:zero_copy_recv_%%v_zerocopy.csv
+)
+
+:exit
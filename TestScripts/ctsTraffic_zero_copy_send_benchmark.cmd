@@ -0,0 +1,50 @@
+@echo off
+
+REM
+REM
+REM Copyright (c) Microsoft Corporation
+REM All rights reserved.
+REM
+REM Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+REM
+REM THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+REM
+REM See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+REM
+REM
+
+
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo This benchmark compares copied sends with -ZeroCopySend:on (SO_SNDBUF=0) over loopback using -IO:iocp
+echo .
+echo Each buffer size (64KB, 256KB, 1MB) is run twice, pushing 4GB on each connection:
+echo  ... copy      : the default send buffering (the stack copies each send buffer)
+echo  ... zerocopy  : -ZeroCopySend:on (the stack sends directly from the shared send buffer)
+echo .
+echo Compare the client's summary across runs:
+echo  ... CPU Cycles Per Byte
+echo  ... Zero-Copy Sends / Copied By The Stack : the ratio of sends which still completed before being acknowledged
+echo .
+echo Status is written to zero_copy_send_[buffer]_[mode].csv for each run
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+echo ----------------------------------------------------------------------------------------------------------------------------------------
+
+set Connections=4
+set Options= -IO:iocp -pattern:push -transfer:0x100000000 -PrePostSends:4 -verify:connection
+
+for %%b in (65536 262144 1048576) do (
+  echo .
+  echo ----- -buffer:%%b copy -----
+  start /b ctsTraffic.exe -listen:* %Options% -buffer:%%b -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %Options% -buffer:%%b -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:zero_copy_send_%%b_copy.csv
+
+  echo .
+  echo ----- -buffer:%%b zerocopy -----
+  start /b ctsTraffic.exe -listen:* %Options% -buffer:%%b -ServerExitLimit:%Connections% -ConsoleVerbosity:0
+  timeout /t 2 /nobreak >nul
+  ctsTraffic.exe -target:localhost %Options% -buffer:%%b -ZeroCopySend:on -connections:%Connections% -iterations:1 -ConsoleVerbosity:1 -StatusFilename:zero_copy_send_%%b_zerocopy.csv
+)
+
+:exit
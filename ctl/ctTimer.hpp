@@ -57,6 +57,11 @@ namespace ctl {namespace ctTimer { namespace Details
         {
             return g_unitTestQpcTimeMs;
         }
+
+        inline int64_t snap_qpc_as_usec() noexcept
+        {
+            return g_unitTestQpcTimeMs * 1000LL;
+        }
 #else
         inline int64_t snap_qpc_as_msec() noexcept
         {
@@ -66,6 +71,17 @@ namespace ctl {namespace ctTimer { namespace Details
             // multiplying by 1000 as (qpc / qpf) == seconds
             return qpc.QuadPart * 1000LL / Details::g_qpf.QuadPart;
         }
+
+        inline int64_t snap_qpc_as_usec() noexcept
+        {
+            InitOnceExecuteOnce(&Details::g_qpfInitOnce, Details::QpfInitOnceCallback, nullptr, nullptr);
+            LARGE_INTEGER qpc;
+            QueryPerformanceCounter(&qpc);
+            // splitting the seconds from the remainder so multiplying by 1000000 can't overflow
+            const auto seconds = qpc.QuadPart / Details::g_qpf.QuadPart;
+            const auto remainder = qpc.QuadPart % Details::g_qpf.QuadPart;
+            return seconds * 1000000LL + remainder * 1000000LL / Details::g_qpf.QuadPart;
+        }
 #endif
     } // namespace ctTimer
 } // namespace ctl
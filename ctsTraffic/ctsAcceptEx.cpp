@@ -1,588 +1,811 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// cpp headers
-#include <memory>
-#include <utility>
-#include <vector>
-#include <queue>
-// os headers
-#include <Windows.h>
-// ctl headers
-#include <ctThreadIocp.hpp>
-// project headers
-#include "ctsSocket.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-#include <wil/resource.h>
-
-using ctsTraffic::ctsConfig::g_configSettings;
-
-namespace ctsTraffic
-{
-	//
-	// Requirements:
-	// - must be able to accept a connection from all listening sockets (cannot round-robin listeners)
-	// - must return one accepted socket only after operator() is invoked
-	//
-	// General Algorithm
-	// - initiate an AcceptEx on every address at startup (after posting a listen)
-	// - a common "accept handler" routine is invoked directly from both:
-	// --- operator()
-	// --- the IOCP callback function
-	//
-	// The 'accept handler' manages the interaction between returning connections and posting more AcceptEx calls:
-	//
-	// - if operator() is called and a connection is ready,
-	// --- set_socket() and complete() are invoked
-	// --- a new AcceptEx call is posted on that listening socket
-	//
-	// - if operator() is called and no connection is ready,
-	// --- a counter is incremented to reflect a request arrived
-	//
-	// - if the callback is called and the counter reflects a request for a new socket is pending,
-	// --- set_socket() and complete() are invoked
-	// --- decrement the counter tracking requests
-	// --- a new AcceptEx call is posted on that listening socket
-	// - if the callback is called and the counter reflects no request arrived yet,
-	// --- the new connection is added to a queue and AcceptEx is not reposted
-	//
-	namespace details
-	{
-		// constant defining how many AcceptEx requests we want maintained per listener
-		constexpr uint32_t c_pendedAcceptRequests = 100;
-
-		// necessary forward declarations of internal classes
-		struct ctsAcceptExImpl;
-		class ctsAcceptSocketInfo;
-
-		static void ctsAcceptExIoCompletionCallback(OVERLAPPED*, _In_ ctsAcceptSocketInfo* acceptInfo) noexcept;
-
-		// struct to capture relevant details of an accepted connection
-		struct ctsAcceptedConnection
-		{
-			wil::unique_socket m_acceptSocket;
-			wil::network::socket_address m_localAddr;
-			wil::network::socket_address m_remoteAddr;
-			DWORD m_lastError = 0;
-		};
-
-		// Struct to track listening sockets
-		// - must have a unique IOCP class for each listener
-		struct ctsListenSocketInfo
-		{
-			// constructor throws a wil::ResultException or bad_alloc on failure
-			explicit ctsListenSocketInfo(const wil::network::socket_address& addr) : m_sockaddr(addr)
-			{
-				wil::unique_socket tempSocket(
-					ctsConfig::CreateSocket(m_sockaddr.family(), SOCK_STREAM, IPPROTO_TCP, g_configSettings->SocketFlags));
-
-				auto error = ctsConfig::SetPreBindOptions(tempSocket.get(), m_sockaddr);
-				if (error != 0)
-				{
-					THROW_WIN32_MSG(error, "ctsConfig::SetPreBindOptions (ctsAcceptEx)");
-				}
-
-				if (SOCKET_ERROR == bind(tempSocket.get(), m_sockaddr.sockaddr(), m_sockaddr.size()))
-				{
-					error = WSAGetLastError();
-					wil::network::socket_address_string addrBuffer{};
-					m_sockaddr.format_complete_address_nothrow(addrBuffer);
-					THROW_WIN32_MSG(error, "bind %hs (ctsAcceptEx)", addrBuffer);
-				}
-
-				if (SOCKET_ERROR == listen(tempSocket.get(), ctsConfig::GetListenBacklog()))
-				{
-					error = WSAGetLastError();
-					THROW_WIN32_MSG(error, "listen (ctsAcceptEx)");
-				}
-
-				m_iocp = std::make_unique<ctl::ctThreadIocp>(tempSocket.get(), g_configSettings->pTpEnvironment);
-
-				// now save the socket after everything succeeded
-				m_listenSocket = std::move(tempSocket);
-			}
-
-			~ctsListenSocketInfo() noexcept
-			{
-				// close the socket then wait for all IO to stop
-				m_listenSocket.reset();
-				m_iocp.reset();
-			}
-
-			ctsListenSocketInfo(const ctsListenSocketInfo&) = delete;
-			ctsListenSocketInfo& operator=(const ctsListenSocketInfo&) = delete;
-			ctsListenSocketInfo(ctsListenSocketInfo&&) = delete;
-			ctsListenSocketInfo& operator=(ctsListenSocketInfo&&) = delete;
-
-			wil::unique_socket m_listenSocket;
-			std::unique_ptr<ctl::ctThreadIocp> m_iocp;
-			std::vector<std::shared_ptr<ctsAcceptSocketInfo>> m_acceptSocketInfo;
-			wil::network::socket_address m_sockaddr;
-		};
-
-		// struct to track accepted sockets
-		// - tracks the 'parent' listen socket structure
-		// - pre-allocates the buffer to use for AcceptEx calls
-		class ctsAcceptSocketInfo
-		{
-		public:
-			// constructor throws wil::ResultException on failure
-			explicit ctsAcceptSocketInfo(const std::shared_ptr<ctsListenSocketInfo>& listenSocket) noexcept :
-				m_listeningSocketInfo(listenSocket)
-			{}
-
-			~ctsAcceptSocketInfo() noexcept = default;
-
-			// attempts to post a new AcceptEx - internally tracks if succeeds or fails
-			void InitiateAcceptEx();
-
-			// returns a ctsAcceptedConnection struct describing the result of an AcceptEx call
-			// - must be called only after the previous AcceptEx call has completed its OVERLAPPED call
-			ctsAcceptedConnection GetAcceptedSocket() noexcept;
-
-			// non-copyable
-			ctsAcceptSocketInfo(const ctsAcceptSocketInfo&) = delete;
-			ctsAcceptSocketInfo& operator=(const ctsAcceptSocketInfo&) = delete;
-			ctsAcceptSocketInfo(ctsAcceptSocketInfo&&) = delete;
-			ctsAcceptSocketInfo& operator=(ctsAcceptSocketInfo&&) = delete;
-
-		private:
-			static constexpr size_t c_singleOutputBufferSize = sizeof(SOCKADDR_INET) + 16;
-
-			// the lock to guard access to the SOCKET
-			wil::critical_section m_lock{ ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock };
-			wil::unique_socket m_acceptSocket;
-			// the raw (non-owning) OVERLAPPED* for the AcceptEx request
-			OVERLAPPED* m_pOverlapped = nullptr;
-			// a weak reference back to the parent listening object
-			const std::weak_ptr<ctsListenSocketInfo> m_listeningSocketInfo;
-			// the buffer to supply to AcceptEx to capture the address information
-			char m_outputBuffer[c_singleOutputBufferSize * 2]{};
-		};
-
-		//
-		// Impl object to carry around the real member data of ctsAcceptEx
-		// - the shared_ptr to the Impl allows an instance of ctsAcceptEx to be copyable
-		//
-		struct ctsAcceptExImpl
-		{
-			// must guard access to internal containers
-			wil::critical_section m_lock{ ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock };
-			std::vector<std::shared_ptr<ctsListenSocketInfo>> m_listeners;
-			std::queue<std::weak_ptr<ctsSocket>> m_pendedAcceptRequests;
-			std::queue<ctsAcceptedConnection> m_acceptedConnections;
-			bool m_shuttingDown = false;
-
-			//
-			// ctsAcceptExImpl constructor
-			// - start listening on all addresses specified tracked in ctsListenSocketInfo objects
-			// - create ctsAcceptSocketInfo object to manage attempts to accept new connections
-			// --- one object per accept socket
-			//
-			ctsAcceptExImpl() = default;
-
-			void Start()
-			{
-				// swap in the listen vector only if fully created
-				// - if anything fails, this temp vector will go out of scope and safely be destroyed
-				std::vector<std::shared_ptr<ctsListenSocketInfo>> tempListeners;
-
-				// listen to each address
-				for (const auto& addr : g_configSettings->ListenAddresses)
-				{
-					try
-					{
-						// Make the structures for the listener and its accept sockets
-						auto listenSocketInfo(std::make_shared<ctsListenSocketInfo>(addr));
-						PRINT_DEBUG_INFO(L"\t\tListening to %ws\n", addr.format_complete_address().c_str());
-						//
-						// Add PendedAcceptRequests pended AcceptEx objects per listener
-						//
-						for (auto acceptCounter = 0ul; acceptCounter < c_pendedAcceptRequests; ++acceptCounter)
-						{
-							auto acceptSocketInfo = std::make_shared<ctsAcceptSocketInfo>(listenSocketInfo);
-							listenSocketInfo->m_acceptSocketInfo.push_back(acceptSocketInfo);
-							// post AcceptEx on this socket once we have successfully added it to the listener's vector
-							acceptSocketInfo->InitiateAcceptEx();
-						}
-
-						// all successful - save this listen socket
-						tempListeners.push_back(listenSocketInfo);
-					}
-					catch (...)
-					{
-						ctsConfig::PrintThrownException();
-					}
-				}
-
-				if (tempListeners.empty())
-				{
-					throw std::exception("ctsAcceptEx invoked with no listening sockets successfully created");
-				}
-
-				// everything succeeded - safely save the listen queue
-				m_listeners.swap(tempListeners);
-			}
-
-			~ctsAcceptExImpl() noexcept
-			{
-				// remove anything pended under lock since the IOCP callbacks still might be invoked
-				{
-					const auto lock = m_lock.lock();
-					m_shuttingDown = true;
-
-					// close out all caller requests for new accepted sockets
-					while (!m_pendedAcceptRequests.empty())
-					{
-						auto weakSocket = m_pendedAcceptRequests.front();
-
-						if (const auto sharedSocket = weakSocket.lock())
-						{
-							sharedSocket->CompleteState(WSAECONNABORTED);
-						}
-
-						m_pendedAcceptRequests.pop();
-					}
-
-					while (!m_acceptedConnections.empty())
-					{
-						m_acceptedConnections.pop();
-					}
-				}
-
-				// now stop the listeners and accepted sockets
-				m_listeners.clear();
-			}
-
-			// non-copyable
-			ctsAcceptExImpl(const ctsAcceptExImpl&) = delete;
-			ctsAcceptExImpl& operator=(const ctsAcceptExImpl&) = delete;
-			ctsAcceptExImpl(ctsAcceptExImpl&&) = delete;
-			ctsAcceptExImpl& operator=(ctsAcceptExImpl&&) = delete;
-		};
-
-		void ctsAcceptSocketInfo::InitiateAcceptEx()
-		{
-			const auto listeningSocketObject = m_listeningSocketInfo.lock();
-			if (!listeningSocketObject)
-			{
-				return;
-			}
-
-			const auto lock = m_lock.lock();
-
-			if (m_acceptSocket.get() != INVALID_SOCKET)
-			{
-				return;
-			}
-
-			wil::unique_socket newAcceptedSocket(
-				ctsConfig::CreateSocket(
-					listeningSocketObject->m_sockaddr.family(),
-					SOCK_STREAM,
-					IPPROTO_TCP,
-					g_configSettings->SocketFlags));
-
-			// since not inheriting from the listening socket, must explicitly set options on the accept socket
-			// - passing the listening address since that will be the local address of this accepted socket
-			auto error = ctsConfig::SetPreBindOptions(newAcceptedSocket.get(), listeningSocketObject->m_sockaddr);
-			if (error != 0)
-			{
-				THROW_WIN32_MSG(error, "SetPreBindOptions (ctsAcceptEx)");
-			}
-
-			m_pOverlapped = listeningSocketObject->m_iocp->new_request(
-				[this](OVERLAPPED* pCallbackOverlapped) noexcept { ctsAcceptExIoCompletionCallback(pCallbackOverlapped, this); });
-
-			::ZeroMemory(m_outputBuffer, c_singleOutputBufferSize * 2);
-			DWORD bytesReceived{};
-			if (!g_configSettings->winsockFunctions->AcceptEx(
-				listeningSocketObject->m_listenSocket.get(),
-				newAcceptedSocket.get(),
-				m_outputBuffer,
-				0, c_singleOutputBufferSize, c_singleOutputBufferSize,
-				&bytesReceived,
-				m_pOverlapped))
-			{
-				error = WSAGetLastError();
-				if (ERROR_IO_PENDING != error)
-				{
-					// a real failure - must abort the IO
-					listeningSocketObject->m_iocp->cancel_request(m_pOverlapped);
-					m_pOverlapped = nullptr;
-					ctsConfig::PrintErrorIfFailed("AcceptEx", error);
-					return;
-				}
-			}
-			else if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
-			{
-				// AcceptEx completed inline - directly invoke the callback to handle the completion
-				// - after canceling the TP request
-				listeningSocketObject->m_iocp->cancel_request(m_pOverlapped);
-				m_pOverlapped = nullptr;
-				ctsAcceptExIoCompletionCallback(nullptr, this);
-			}
-
-			// no failures - store the socket
-			m_acceptSocket = std::move(newAcceptedSocket);
-		}
-
-		ctsAcceptedConnection ctsAcceptSocketInfo::GetAcceptedSocket() noexcept
-		{
-			ctsAcceptedConnection returnDetails;
-
-			const auto listeningSocketObject = m_listeningSocketInfo.lock();
-			if (!listeningSocketObject)
-			{
-				returnDetails.m_lastError = WSAECONNABORTED;
-				m_acceptSocket.reset();
-				// return empty/failed details object
-				return returnDetails;
-			}
-			const auto listeningSocket = listeningSocketObject->m_listenSocket.get();
-
-			const auto lock = m_lock.lock();
-
-			// if the OVERLAPPED* is null, it means it completed inline (no OVERLAPPED async completion)
-			// - thus we know it already succeeded
-			if (m_pOverlapped)
-			{
-				DWORD transferred{};
-				DWORD flags{};
-				if (!WSAGetOverlappedResult(
-					listeningSocket,
-					m_pOverlapped,
-					&transferred,
-					FALSE,
-					&flags))
-				{
-					returnDetails.m_lastError = WSAGetLastError();
-					ctsConfig::PrintErrorIfFailed("AcceptEx", returnDetails.m_lastError);
-					m_acceptSocket.reset();
-					// return empty/failed details object
-					return returnDetails;
-				}
-			}
-
-			// if successful, update the socket context
-			// this should never fail - break if it does to debug it
-			const auto err = setsockopt(
-				m_acceptSocket.get(),
-				SOL_SOCKET,
-				SO_UPDATE_ACCEPT_CONTEXT,
-				reinterpret_cast<const char*>(&listeningSocket),
-				sizeof listeningSocket);
-			FAIL_FAST_IF_MSG(
-				err != 0,
-				"setsockopt(SO_UPDATE_ACCEPT_CONTEXT) failed [%d], accept socket [%zu], listen socket [%zu]",
-				WSAGetLastError(), m_acceptSocket.get(), listeningSocket);
-
-			SOCKADDR_INET* localAddr{};
-			auto localAddrLen = static_cast<int>(sizeof SOCKADDR_INET);
-			SOCKADDR_INET* remoteAddr{};
-			auto remoteAddrLen = static_cast<int>(sizeof SOCKADDR_INET);
-
-			g_configSettings->winsockFunctions->GetAcceptExSockaddrs(
-				m_outputBuffer,
-				0,
-				c_singleOutputBufferSize,
-				c_singleOutputBufferSize,
-				reinterpret_cast<sockaddr**>(&localAddr),
-				&localAddrLen,
-				reinterpret_cast<sockaddr**>(&remoteAddr),
-				&remoteAddrLen);
-
-			// transfer ownership of the SOCKET to the caller
-			returnDetails.m_acceptSocket = std::move(m_acceptSocket);
-			returnDetails.m_lastError = 0;
-			returnDetails.m_localAddr.reset(localAddr);
-			returnDetails.m_remoteAddr.reset(remoteAddr);
-
-			return returnDetails;
-		}
-
-		static ctsAcceptExImpl g_acceptExImpl; // NOLINT(clang-diagnostic-exit-time-destructors)
-		// ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
-		static INIT_ONCE g_acceptExImplInitOnce = INIT_ONCE_STATIC_INIT;
-
-		static BOOL CALLBACK ctsAcceptExImplInitFn(PINIT_ONCE, PVOID pError, PVOID*) noexcept try
-		{
-			g_acceptExImpl.Start();
-			return TRUE;
-		}
-		catch (...)
-		{
-			*static_cast<DWORD*>(pError) = ctsConfig::PrintThrownException();
-			return FALSE;
-		}
-
-		static void ctsAcceptExIoCompletionCallback(OVERLAPPED*, _In_ ctsAcceptSocketInfo* acceptInfo) noexcept try
-		{
-			ctsAcceptedConnection acceptedSocket = acceptInfo->GetAcceptedSocket();
-
-			const auto lock = g_acceptExImpl.m_lock.lock();
-			if (g_acceptExImpl.m_shuttingDown)
-			{
-				return;
-			}
-
-			if (!g_acceptExImpl.m_pendedAcceptRequests.empty())
-			{
-				//
-				// we have unfulfilled requests for more connections
-				// return a previously accepted socket
-				//
-				const auto weakSocket = g_acceptExImpl.m_pendedAcceptRequests.front();
-				g_acceptExImpl.m_pendedAcceptRequests.pop();
-
-				if (const auto sharedSocket = weakSocket.lock())
-				{
-					ctsConfig::PrintErrorIfFailed("AcceptEx", acceptedSocket.m_lastError);
-
-					if (0 == acceptedSocket.m_lastError)
-					{
-						// set the local addr
-						wil::network::socket_address localAddr;
-						int localAddrLen = localAddr.size();
-						if (0 == getsockname(acceptedSocket.m_acceptSocket.get(), localAddr.sockaddr(), &localAddrLen))
-						{
-							sharedSocket->SetLocalSockaddr(localAddr);
-						}
-
-						ctsConfig::SetPostConnectOptions(acceptedSocket.m_acceptSocket.get(), acceptedSocket.m_remoteAddr);
-
-						// socket ownership was successfully transferred
-						sharedSocket->SetSocket(acceptedSocket.m_acceptSocket.release());
-						sharedSocket->SetRemoteSockaddr(acceptedSocket.m_remoteAddr);
-						sharedSocket->CompleteState(0);
-
-						ctsConfig::PrintNewConnection(localAddr, acceptedSocket.m_remoteAddr);
-					}
-					else
-					{
-						sharedSocket->CompleteState(acceptedSocket.m_lastError);
-					}
-				}
-				else
-				{
-					// socket was closed from beneath us
-					ctsConfig::PrintErrorIfFailed("AcceptEx", WSAECONNABORTED);
-				}
-			}
-			else
-			{
-				//
-				// else, we have no requests for another connection,
-				// - queue this one for when a request comes in
-				//
-				g_acceptExImpl.m_acceptedConnections.push(std::move(acceptedSocket));
-			}
-
-			//
-			// always attempt another AcceptEx
-			//
-			acceptInfo->InitiateAcceptEx();
-		}
-		catch (...)
-		{
-			ctsConfig::PrintThrownException();
-		}
-	} // namespace details
-
-	//
-	//
-	// An accepted socket is being requested
-	// - if there is one queued, return that
-	// - else store the weak_ptr<ctsSocket> to be fulfilled later
-	//
-	//
-	void ctsAcceptEx(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
-	{
-		DWORD error = 0;
-		if (!InitOnceExecuteOnce(&details::g_acceptExImplInitOnce, details::ctsAcceptExImplInitFn, &error, nullptr))
-		{
-			if (const auto sharedSocket = weakSocket.lock())
-			{
-				sharedSocket->CompleteState(error);
-			}
-			return;
-		}
-
-		auto sharedSocket(weakSocket.lock());
-		if (!sharedSocket)
-		{
-			return;
-		}
-
-		details::ctsAcceptedConnection acceptedConnection;
-
-		// scoped to the auto-release CS object
-		{
-			const auto lock = details::g_acceptExImpl.m_lock.lock();
-			// guard access to internal queues
-			if (details::g_acceptExImpl.m_acceptedConnections.empty())
-			{
-				// no accepted connections yet -- save the weak_ptr, *not* the shared_ptr
-				try { details::g_acceptExImpl.m_pendedAcceptRequests.push(weakSocket); }
-				catch (...)
-				{
-					// fail the caller if we can't save this request
-					error = WSAENOBUFS;
-				}
-			}
-			else
-			{
-				// pull the next connection off the queue
-				acceptedConnection = std::move(details::g_acceptExImpl.m_acceptedConnections.front());
-				details::g_acceptExImpl.m_acceptedConnections.pop();
-				error = acceptedConnection.m_lastError;
-			}
-		}
-
-		//
-		// complete this socket state if something failed
-		//
-		ctsConfig::PrintErrorIfFailed("AcceptEx", error);
-		if (error != 0)
-		{
-			sharedSocket->CompleteState(error);
-			return;
-		}
-
-		//
-		// if did not defer the accept request, and we have a new accepted socket,
-		// complete this socket state
-		//
-		if (acceptedConnection.m_acceptSocket.get() != INVALID_SOCKET)
-		{
-			// set the local addr
-			wil::network::socket_address localAddr;
-			auto localAddrLen = localAddr.size();
-			if (0 == getsockname(acceptedConnection.m_acceptSocket.get(), localAddr.sockaddr(), &localAddrLen))
-			{
-				sharedSocket->SetLocalSockaddr(localAddr);
-			}
-
-			ctsConfig::SetPostConnectOptions(acceptedConnection.m_acceptSocket.get(), acceptedConnection.m_remoteAddr);
-
-			// transferring ownership to the ctsSocket
-			sharedSocket->SetSocket(acceptedConnection.m_acceptSocket.release());
-			sharedSocket->SetRemoteSockaddr(acceptedConnection.m_remoteAddr);
-			sharedSocket->CompleteState(0);
-
-			ctsConfig::PrintNewConnection(localAddr, acceptedConnection.m_remoteAddr);
-		}
-	}
-} // namespace
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctCpuAffinity.hpp>
+#include <ctThreadIocp.hpp>
+#include <ctThreadIocp_shard.hpp>
+#include <ctTimer.hpp>
+// project headers
+#include "ctsAcceptHandoff.hpp"
+#include "ctsSocket.h"
+#include "ctsTCPFunctions.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+namespace ctsTraffic
+{
+	//
+	// Requirements:
+	// - must be able to accept a connection from all listening sockets (cannot round-robin listeners)
+	// - must return one accepted socket only after operator() is invoked
+	//
+	// General Algorithm
+	// - initiate an AcceptEx on every address at startup (after posting a listen)
+	// - a common "accept handler" routine is invoked directly from both:
+	// --- operator()
+	// --- the IOCP callback function
+	//
+	// The 'accept handler' manages the interaction between returning connections and posting more AcceptEx calls:
+	//
+	// - if operator() is called and a connection is ready,
+	// --- set_socket() and complete() are invoked
+	// --- a new AcceptEx call is posted on that listening socket
+	//
+	// - if operator() is called and no connection is ready,
+	// --- a counter is incremented to reflect a request arrived
+	//
+	// - if the callback is called and the counter reflects a request for a new socket is pending,
+	// --- set_socket() and complete() are invoked
+	// --- decrement the counter tracking requests
+	// --- a new AcceptEx call is posted on that listening socket
+	// - if the callback is called and the counter reflects no request arrived yet,
+	// --- the new connection is added to a queue and AcceptEx is not reposted
+	//
+	// Accepted connections and requests for them meet in a ctsAcceptHandoff - matching them takes no lock
+	//
+	// The number of AcceptEx requests pended per listener adapts to the rate connections are accepted (ctsAcceptDepth)
+	// - within the -AcceptDepth bounds
+	// - an AcceptEx that completes while the listener has more than its depth pended, or while more connections
+	//   than the depth are waiting to be picked up, is not reposted until the depth calls for it again
+	//
+	// -AcceptShards splits the AcceptEx requests of each listener across shards
+	// - each shard pends, reposts, and sizes its own AcceptEx requests, so the shards never contend for a lock
+	// - a socket can be associated with only one completion port: the listener's completions are processed by
+	//   -AcceptShards worker threads on that port, and any worker can process the completion of any shard's AcceptEx
+	// - the workers are not pinned to CPUs: IO on an accepted connection runs on that connection's own
+	//   ctThreadIocp, so there is no CPU locality between a shard, its worker, and its connections to keep
+	// - Windows has no SO_REUSEPORT balancing for TCP listeners: the kernel still queues connections
+	//   on one listening socket per address, completing whichever AcceptEx was pended first
+	//
+	namespace details
+	{
+		// necessary forward declarations of internal classes
+		struct ctsAcceptExImpl;
+		class ctsAcceptSocketInfo;
+
+		static void ctsAcceptExIoCompletionCallback(OVERLAPPED*, _In_ ctsAcceptSocketInfo* acceptInfo) noexcept;
+
+		// struct to capture relevant details of an accepted connection
+		struct ctsAcceptedConnection
+		{
+			wil::unique_socket m_acceptSocket;
+			wil::network::socket_address m_localAddr;
+			wil::network::socket_address m_remoteAddr;
+			DWORD m_lastError = 0;
+			// when the AcceptEx completed (the handshake had completed)
+			int64_t m_acceptedUsec = 0;
+		};
+
+		// the AcceptEx requests of one shard of a listener (one shard unless -AcceptShards)
+		struct ctsAcceptShard
+		{
+			ctsAcceptShard(uint32_t shardIndex, uint32_t minimumDepth, uint32_t maximumDepth) noexcept :
+				m_shardIndex(shardIndex),
+				m_acceptDepth(minimumDepth, maximumDepth, ctl::ctTimer::snap_qpc_as_usec())
+			{
+			}
+
+			~ctsAcceptShard() noexcept = default;
+
+			ctsAcceptShard(const ctsAcceptShard&) = delete;
+			ctsAcceptShard& operator=(const ctsAcceptShard&) = delete;
+			ctsAcceptShard(ctsAcceptShard&&) = delete;
+			ctsAcceptShard& operator=(ctsAcceptShard&&) = delete;
+
+			const uint32_t m_shardIndex;
+			// AcceptEx requests this shard currently has pended on the listening socket
+			std::atomic<uint32_t> m_pendedAccepts{0};
+			ctsAcceptDepth m_acceptDepth;
+			// for the summary
+			std::atomic<uint64_t> m_accepts{0};
+			std::atomic<uint32_t> m_peakPended{0};
+
+			// guards creating accept objects, and the list of those without an AcceptEx pended
+			wil::critical_section m_lock{ ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock };
+			std::vector<std::shared_ptr<ctsAcceptSocketInfo>> m_acceptSocketInfo;
+			std::vector<ctsAcceptSocketInfo*> m_idleAcceptSocketInfo;
+		};
+
+		// Struct to track listening sockets
+		// - must have a unique IOCP class for each listener
+		struct ctsListenSocketInfo : std::enable_shared_from_this<ctsListenSocketInfo>
+		{
+			// constructor throws a wil::ResultException or bad_alloc on failure
+			explicit ctsListenSocketInfo(const wil::network::socket_address& addr) :
+				m_sockaddr(addr)
+			{
+				// the -AcceptDepth bounds are per listener: each shard keeps its share
+				const auto shardCount = std::max(g_configSettings->AcceptShards, 1u);
+				for (auto shardIndex = 0u; shardIndex < shardCount; ++shardIndex)
+				{
+					m_shards.push_back(std::make_unique<ctsAcceptShard>(
+						shardIndex,
+						ctsAcceptShardDepth(g_configSettings->AcceptDepthLow, shardCount),
+						ctsAcceptShardDepth(g_configSettings->AcceptDepthHigh, shardCount)));
+				}
+
+				wil::unique_socket tempSocket(
+					ctsConfig::CreateSocket(m_sockaddr.family(), SOCK_STREAM, IPPROTO_TCP, g_configSettings->SocketFlags));
+
+				auto error = ctsConfig::SetPreBindOptions(tempSocket.get(), m_sockaddr);
+				if (error != 0)
+				{
+					THROW_WIN32_MSG(error, "ctsConfig::SetPreBindOptions (ctsAcceptEx)");
+				}
+
+				if (SOCKET_ERROR == bind(tempSocket.get(), m_sockaddr.sockaddr(), m_sockaddr.size()))
+				{
+					error = WSAGetLastError();
+					wil::network::socket_address_string addrBuffer{};
+					m_sockaddr.format_complete_address_nothrow(addrBuffer);
+					THROW_WIN32_MSG(error, "bind %hs (ctsAcceptEx)", addrBuffer);
+				}
+
+				if (SOCKET_ERROR == listen(tempSocket.get(), ctsConfig::GetListenBacklog()))
+				{
+					error = WSAGetLastError();
+					THROW_WIN32_MSG(error, "listen (ctsAcceptEx)");
+				}
+
+				if (g_configSettings->AcceptShards > 0)
+				{
+					// as many (unpinned) workers as shards on the listener's one completion port
+					m_iocp = std::make_unique<ctl::ctThreadIocp_shard>(
+						tempSocket.get(),
+						static_cast<size_t>(g_configSettings->AcceptShards),
+						std::vector<ctl::GroupAffinity>{},
+						static_cast<size_t>(g_configSettings->IocpBatchSize));
+				}
+				else
+				{
+					m_iocp = std::make_unique<ctl::ctThreadIocp>(tempSocket.get(), g_configSettings->pTpEnvironment);
+				}
+
+				// now save the socket after everything succeeded
+				m_listenSocket = std::move(tempSocket);
+			}
+
+			~ctsListenSocketInfo() noexcept
+			{
+				// close the socket then wait for all IO to stop
+				m_listenSocket.reset();
+				m_iocp.reset();
+			}
+
+			ctsListenSocketInfo(const ctsListenSocketInfo&) = delete;
+			ctsListenSocketInfo& operator=(const ctsListenSocketInfo&) = delete;
+			ctsListenSocketInfo(ctsListenSocketInfo&&) = delete;
+			ctsListenSocketInfo& operator=(ctsListenSocketInfo&&) = delete;
+
+			// pends AcceptEx requests until every shard has as many pended as its depth calls for
+			// - can throw under low resource conditions
+			void PendAcceptRequests();
+			void PendAcceptRequests(ctsAcceptShard& shard);
+			// reposts the AcceptEx request that just completed if its shard's depth still calls for it
+			void RepostAcceptRequest(_In_ ctsAcceptSocketInfo* acceptInfo);
+
+			// the AcceptEx requests pended across all shards
+			uint32_t GetPendedAccepts() const noexcept
+			{
+				uint32_t pendedAccepts = 0;
+				for (const auto& shard : m_shards)
+				{
+					pendedAccepts += shard->m_pendedAccepts.load();
+				}
+				return pendedAccepts;
+			}
+
+			wil::unique_socket m_listenSocket;
+			std::unique_ptr<ctl::ctThreadIocp_base> m_iocp;
+			wil::network::socket_address m_sockaddr;
+			// only written in the constructor
+			std::vector<std::unique_ptr<ctsAcceptShard>> m_shards;
+		};
+
+		// struct to track accepted sockets
+		// - tracks the 'parent' listen socket structure
+		// - pre-allocates the buffer to use for AcceptEx calls
+		class ctsAcceptSocketInfo
+		{
+		public:
+			// constructor throws wil::ResultException on failure
+			explicit ctsAcceptSocketInfo(const std::shared_ptr<ctsListenSocketInfo>& listenSocket, ctsAcceptShard& shard) noexcept :
+				m_listeningSocketInfo(listenSocket),
+				m_shard(shard)
+			{}
+
+			~ctsAcceptSocketInfo() noexcept = default;
+
+			// attempts to post a new AcceptEx - returns false if one could not be pended
+			bool InitiateAcceptEx();
+
+			std::shared_ptr<ctsListenSocketInfo> GetListenSocketInfo() const noexcept
+			{
+				return m_listeningSocketInfo.lock();
+			}
+
+			// the shard is owned by the listener, which outlives its accept objects
+			ctsAcceptShard& GetShard() const noexcept
+			{
+				return m_shard;
+			}
+
+			// returns a ctsAcceptedConnection struct describing the result of an AcceptEx call
+			// - must be called only after the previous AcceptEx call has completed its OVERLAPPED call
+			ctsAcceptedConnection GetAcceptedSocket() noexcept;
+
+			// non-copyable
+			ctsAcceptSocketInfo(const ctsAcceptSocketInfo&) = delete;
+			ctsAcceptSocketInfo& operator=(const ctsAcceptSocketInfo&) = delete;
+			ctsAcceptSocketInfo(ctsAcceptSocketInfo&&) = delete;
+			ctsAcceptSocketInfo& operator=(ctsAcceptSocketInfo&&) = delete;
+
+		private:
+			static constexpr size_t c_singleOutputBufferSize = sizeof(SOCKADDR_INET) + 16;
+
+			// the lock to guard access to the SOCKET
+			wil::critical_section m_lock{ ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock };
+			wil::unique_socket m_acceptSocket;
+			// the raw (non-owning) OVERLAPPED* for the AcceptEx request
+			OVERLAPPED* m_pOverlapped = nullptr;
+			// a weak reference back to the parent listening object
+			const std::weak_ptr<ctsListenSocketInfo> m_listeningSocketInfo;
+			ctsAcceptShard& m_shard;
+			// the buffer to supply to AcceptEx to capture the address information
+			char m_outputBuffer[c_singleOutputBufferSize * 2]{};
+		};
+
+		//
+		// Impl object to carry around the real member data of ctsAcceptEx
+		// - the shared_ptr to the Impl allows an instance of ctsAcceptEx to be copyable
+		//
+		struct ctsAcceptExImpl
+		{
+			// only written in Start, before any AcceptEx is pended
+			std::vector<std::shared_ptr<ctsListenSocketInfo>> m_listeners;
+			// matches the caller requests for new accepted sockets with accepted connections
+			std::unique_ptr<ctsAcceptHandoff<std::weak_ptr<ctsSocket>, ctsAcceptedConnection>> m_handoff;
+			std::atomic<bool> m_shuttingDown{false};
+
+			//
+			// ctsAcceptExImpl constructor
+			// - start listening on all addresses specified tracked in ctsListenSocketInfo objects
+			// - create ctsAcceptSocketInfo object to manage attempts to accept new connections
+			// --- one object per accept socket
+			//
+			ctsAcceptExImpl() = default;
+
+			void Start()
+			{
+				// pended requests are bounded by the broker's accept limit
+				// - accepted connections are held back once the depth's worth are queued,
+				//   so those queued can't exceed what every listener could have pended on top of that
+				// - each shard rounds its share of the depth up
+				const auto listenerCount = static_cast<uint32_t>(g_configSettings->ListenAddresses.size());
+				m_handoff = std::make_unique<ctsAcceptHandoff<std::weak_ptr<ctsSocket>, ctsAcceptedConnection>>(
+					g_configSettings->AcceptLimit,
+					static_cast<size_t>(g_configSettings->AcceptDepthHigh + g_configSettings->AcceptShards) * (listenerCount + 1));
+
+				// swap in the listen vector only if fully created
+				// - if anything fails, this temp vector will go out of scope and safely be destroyed
+				std::vector<std::shared_ptr<ctsListenSocketInfo>> tempListeners;
+
+				// listen to each address
+				for (const auto& addr : g_configSettings->ListenAddresses)
+				{
+					try
+					{
+						// Make the structures for the listener and its accept sockets
+						auto listenSocketInfo(std::make_shared<ctsListenSocketInfo>(addr));
+						PRINT_DEBUG_INFO(L"\t\tListening to %ws\n", addr.format_complete_address().c_str());
+						//
+						// pend the initial (-AcceptDepth low) AcceptEx requests on the listener
+						//
+						listenSocketInfo->PendAcceptRequests();
+
+						// all successful - save this listen socket
+						tempListeners.push_back(listenSocketInfo);
+					}
+					catch (...)
+					{
+						ctsConfig::PrintThrownException();
+					}
+				}
+
+				if (tempListeners.empty())
+				{
+					throw std::exception("ctsAcceptEx invoked with no listening sockets successfully created");
+				}
+
+				// everything succeeded - safely save the listen queue
+				m_listeners.swap(tempListeners);
+			}
+
+			~ctsAcceptExImpl() noexcept
+			{
+				// IOCP callbacks still might be invoked: they stop handing off connections once shutting down
+				m_shuttingDown = true;
+
+				if (m_handoff)
+				{
+					// close out all caller requests for new accepted sockets
+					std::weak_ptr<ctsSocket> weakSocket;
+					while (m_handoff->TryTakeRequest(weakSocket))
+					{
+						if (const auto sharedSocket = weakSocket.lock())
+						{
+							sharedSocket->CompleteState(WSAECONNABORTED);
+						}
+					}
+
+					ctsAcceptedConnection acceptedConnection;
+					while (m_handoff->TryTakeConnection(acceptedConnection))
+					{
+						acceptedConnection.m_acceptSocket.reset();
+					}
+				}
+
+				// now stop the listeners and accepted sockets
+				m_listeners.clear();
+			}
+
+			// non-copyable
+			ctsAcceptExImpl(const ctsAcceptExImpl&) = delete;
+			ctsAcceptExImpl& operator=(const ctsAcceptExImpl&) = delete;
+			ctsAcceptExImpl(ctsAcceptExImpl&&) = delete;
+			ctsAcceptExImpl& operator=(ctsAcceptExImpl&&) = delete;
+		};
+
+		bool ctsAcceptSocketInfo::InitiateAcceptEx()
+		{
+			const auto listeningSocketObject = m_listeningSocketInfo.lock();
+			if (!listeningSocketObject)
+			{
+				return false;
+			}
+
+			const auto lock = m_lock.lock();
+
+			if (m_acceptSocket.get() != INVALID_SOCKET)
+			{
+				return false;
+			}
+
+			wil::unique_socket newAcceptedSocket(
+				ctsConfig::CreateSocket(
+					listeningSocketObject->m_sockaddr.family(),
+					SOCK_STREAM,
+					IPPROTO_TCP,
+					g_configSettings->SocketFlags));
+
+			// since not inheriting from the listening socket, must explicitly set options on the accept socket
+			// - passing the listening address since that will be the local address of this accepted socket
+			auto error = ctsConfig::SetPreBindOptions(newAcceptedSocket.get(), listeningSocketObject->m_sockaddr);
+			if (error != 0)
+			{
+				THROW_WIN32_MSG(error, "SetPreBindOptions (ctsAcceptEx)");
+			}
+
+			m_pOverlapped = listeningSocketObject->m_iocp->new_request(
+				[this](OVERLAPPED* pCallbackOverlapped) noexcept { ctsAcceptExIoCompletionCallback(pCallbackOverlapped, this); });
+
+			// store the socket and count the request as pended before calling AcceptEx
+			// - an inline completion reads the socket, and any completion decrements the pended count
+			m_acceptSocket = std::move(newAcceptedSocket);
+			++m_shard.m_pendedAccepts;
+
+			::ZeroMemory(m_outputBuffer, c_singleOutputBufferSize * 2);
+			DWORD bytesReceived{};
+			if (!g_configSettings->winsockFunctions->AcceptEx(
+				listeningSocketObject->m_listenSocket.get(),
+				m_acceptSocket.get(),
+				m_outputBuffer,
+				0, c_singleOutputBufferSize, c_singleOutputBufferSize,
+				&bytesReceived,
+				m_pOverlapped))
+			{
+				error = WSAGetLastError();
+				if (ERROR_IO_PENDING != error)
+				{
+					// a real failure - must abort the IO
+					listeningSocketObject->m_iocp->cancel_request(m_pOverlapped);
+					m_pOverlapped = nullptr;
+					m_acceptSocket.reset();
+					--m_shard.m_pendedAccepts;
+					ctsConfig::PrintErrorIfFailed("AcceptEx", error);
+					return false;
+				}
+			}
+			else if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
+			{
+				// AcceptEx completed inline - directly invoke the callback to handle the completion
+				// - after canceling the TP request
+				listeningSocketObject->m_iocp->cancel_request(m_pOverlapped);
+				m_pOverlapped = nullptr;
+				ctsAcceptExIoCompletionCallback(nullptr, this);
+			}
+
+			return true;
+		}
+
+		ctsAcceptedConnection ctsAcceptSocketInfo::GetAcceptedSocket() noexcept
+		{
+			ctsAcceptedConnection returnDetails;
+
+			const auto listeningSocketObject = m_listeningSocketInfo.lock();
+			if (!listeningSocketObject)
+			{
+				returnDetails.m_lastError = WSAECONNABORTED;
+				m_acceptSocket.reset();
+				// return empty/failed details object
+				return returnDetails;
+			}
+			const auto listeningSocket = listeningSocketObject->m_listenSocket.get();
+
+			const auto lock = m_lock.lock();
+
+			// if the OVERLAPPED* is null, it means it completed inline (no OVERLAPPED async completion)
+			// - thus we know it already succeeded
+			if (m_pOverlapped)
+			{
+				DWORD transferred{};
+				DWORD flags{};
+				if (!WSAGetOverlappedResult(
+					listeningSocket,
+					m_pOverlapped,
+					&transferred,
+					FALSE,
+					&flags))
+				{
+					returnDetails.m_lastError = WSAGetLastError();
+					ctsConfig::PrintErrorIfFailed("AcceptEx", returnDetails.m_lastError);
+					m_acceptSocket.reset();
+					// return empty/failed details object
+					return returnDetails;
+				}
+			}
+
+			// if successful, update the socket context
+			// this should never fail - break if it does to debug it
+			const auto err = setsockopt(
+				m_acceptSocket.get(),
+				SOL_SOCKET,
+				SO_UPDATE_ACCEPT_CONTEXT,
+				reinterpret_cast<const char*>(&listeningSocket),
+				sizeof listeningSocket);
+			FAIL_FAST_IF_MSG(
+				err != 0,
+				"setsockopt(SO_UPDATE_ACCEPT_CONTEXT) failed [%d], accept socket [%zu], listen socket [%zu]",
+				WSAGetLastError(), m_acceptSocket.get(), listeningSocket);
+
+			SOCKADDR_INET* localAddr{};
+			auto localAddrLen = static_cast<int>(sizeof SOCKADDR_INET);
+			SOCKADDR_INET* remoteAddr{};
+			auto remoteAddrLen = static_cast<int>(sizeof SOCKADDR_INET);
+
+			g_configSettings->winsockFunctions->GetAcceptExSockaddrs(
+				m_outputBuffer,
+				0,
+				c_singleOutputBufferSize,
+				c_singleOutputBufferSize,
+				reinterpret_cast<sockaddr**>(&localAddr),
+				&localAddrLen,
+				reinterpret_cast<sockaddr**>(&remoteAddr),
+				&remoteAddrLen);
+
+			// transfer ownership of the SOCKET to the caller
+			returnDetails.m_acceptSocket = std::move(m_acceptSocket);
+			returnDetails.m_lastError = 0;
+			returnDetails.m_localAddr.reset(localAddr);
+			returnDetails.m_remoteAddr.reset(remoteAddr);
+
+			return returnDetails;
+		}
+
+		static ctsAcceptExImpl g_acceptExImpl; // NOLINT(clang-diagnostic-exit-time-destructors)
+		// ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+		static INIT_ONCE g_acceptExImplInitOnce = INIT_ONCE_STATIC_INIT;
+
+		static BOOL CALLBACK ctsAcceptExImplInitFn(PINIT_ONCE, PVOID pError, PVOID*) noexcept try
+		{
+			g_acceptExImpl.Start();
+			return TRUE;
+		}
+		catch (...)
+		{
+			*static_cast<DWORD*>(pError) = ctsConfig::PrintThrownException();
+			return FALSE;
+		}
+
+		void ctsListenSocketInfo::PendAcceptRequests()
+		{
+			for (const auto& shard : m_shards)
+			{
+				if (shard->m_pendedAccepts < shard->m_acceptDepth.GetTarget())
+				{
+					PendAcceptRequests(*shard);
+				}
+			}
+		}
+
+		void ctsListenSocketInfo::PendAcceptRequests(ctsAcceptShard& shard)
+		{
+			const auto lock = shard.m_lock.lock();
+			while (!g_acceptExImpl.m_shuttingDown &&
+				shard.m_pendedAccepts < shard.m_acceptDepth.GetTarget() &&
+				g_acceptExImpl.m_handoff->GetQueuedConnections() < shard.m_acceptDepth.GetTarget())
+			{
+				ctsAcceptSocketInfo* acceptSocketInfo{};
+				if (shard.m_idleAcceptSocketInfo.empty())
+				{
+					auto newAcceptSocketInfo = std::make_shared<ctsAcceptSocketInfo>(shared_from_this(), shard);
+					shard.m_acceptSocketInfo.push_back(newAcceptSocketInfo);
+					acceptSocketInfo = newAcceptSocketInfo.get();
+				}
+				else
+				{
+					acceptSocketInfo = shard.m_idleAcceptSocketInfo.back();
+					shard.m_idleAcceptSocketInfo.pop_back();
+				}
+
+				auto pended = false;
+				try
+				{
+					pended = acceptSocketInfo->InitiateAcceptEx();
+				}
+				catch (...)
+				{
+					shard.m_idleAcceptSocketInfo.push_back(acceptSocketInfo);
+					throw;
+				}
+				if (!pended)
+				{
+					shard.m_idleAcceptSocketInfo.push_back(acceptSocketInfo);
+					break;
+				}
+			}
+
+			const auto shardPended = shard.m_pendedAccepts.load();
+			if (shardPended > shard.m_peakPended)
+			{
+				shard.m_peakPended = shardPended;
+			}
+			const auto pendedAccepts = static_cast<int64_t>(GetPendedAccepts());
+			if (pendedAccepts > g_configSettings->AcceptExPeakDepth.GetValue())
+			{
+				g_configSettings->AcceptExPeakDepth.SetValue(pendedAccepts);
+			}
+		}
+
+		void ctsListenSocketInfo::RepostAcceptRequest(_In_ ctsAcceptSocketInfo* acceptInfo)
+		{
+			if (g_acceptExImpl.m_shuttingDown)
+			{
+				return;
+			}
+
+			// the common case reposts without taking the shard lock
+			auto& shard = acceptInfo->GetShard();
+			const auto targetDepth = shard.m_acceptDepth.GetTarget();
+			if (shard.m_pendedAccepts < targetDepth &&
+				g_acceptExImpl.m_handoff->GetQueuedConnections() < targetDepth &&
+				acceptInfo->InitiateAcceptEx())
+			{
+				if (shard.m_pendedAccepts < shard.m_acceptDepth.GetTarget())
+				{
+					// the depth grew
+					PendAcceptRequests(shard);
+				}
+				return;
+			}
+
+			// the depth shrank, or connections are waiting to be picked up: leave this one idle until it's needed
+			const auto lock = shard.m_lock.lock();
+			shard.m_idleAcceptSocketInfo.push_back(acceptInfo);
+		}
+
+		// hands the accepted connection to the socket that requested it
+		static void ctsCompleteAcceptedConnection(const std::shared_ptr<ctsSocket>& sharedSocket, ctsAcceptedConnection& acceptedConnection) noexcept
+		{
+			ctsConfig::PrintErrorIfFailed("AcceptEx", acceptedConnection.m_lastError);
+			if (acceptedConnection.m_lastError != 0)
+			{
+				sharedSocket->CompleteState(acceptedConnection.m_lastError);
+				return;
+			}
+
+			g_configSettings->AcceptExPickupUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - acceptedConnection.m_acceptedUsec);
+
+			// set the local addr
+			wil::network::socket_address localAddr;
+			auto localAddrLen = localAddr.size();
+			if (0 == getsockname(acceptedConnection.m_acceptSocket.get(), localAddr.sockaddr(), &localAddrLen))
+			{
+				sharedSocket->SetLocalSockaddr(localAddr);
+			}
+
+			ctsConfig::SetPostConnectOptions(acceptedConnection.m_acceptSocket.get(), acceptedConnection.m_remoteAddr);
+
+			// transferring ownership to the ctsSocket
+			sharedSocket->SetSocket(acceptedConnection.m_acceptSocket.release());
+			sharedSocket->SetRemoteSockaddr(acceptedConnection.m_remoteAddr);
+			sharedSocket->CompleteState(0);
+
+			ctsConfig::PrintNewConnection(localAddr, acceptedConnection.m_remoteAddr);
+		}
+
+		static void ctsAcceptExIoCompletionCallback(OVERLAPPED*, _In_ ctsAcceptSocketInfo* acceptInfo) noexcept try
+		{
+			const auto listenSocketInfo = acceptInfo->GetListenSocketInfo();
+			if (!listenSocketInfo)
+			{
+				return;
+			}
+
+			auto& shard = acceptInfo->GetShard();
+			const auto acceptedUsec = ctl::ctTimer::snap_qpc_as_usec();
+			const auto stillPended = --shard.m_pendedAccepts;
+			if (0 == stillPended && 0 == listenSocketInfo->GetPendedAccepts())
+			{
+				// connections arriving now wait in the listen backlog until another AcceptEx is pended
+				g_configSettings->AcceptExBacklogExhausted.Increment();
+			}
+			shard.m_acceptDepth.AcceptCompleted(acceptedUsec, stillPended);
+
+			ctsAcceptedConnection acceptedSocket = acceptInfo->GetAcceptedSocket();
+			acceptedSocket.m_acceptedUsec = acceptedUsec;
+			if (0 == acceptedSocket.m_lastError)
+			{
+				++shard.m_accepts;
+			}
+
+			if (g_acceptExImpl.m_shuttingDown)
+			{
+				return;
+			}
+
+			for (;;)
+			{
+				std::weak_ptr<ctsSocket> weakSocket;
+				const auto handoffResult = g_acceptExImpl.m_handoff->OfferConnection(std::move(acceptedSocket), weakSocket);
+				if (ctsHandoffResult::Queued == handoffResult)
+				{
+					// no requests for another connection - queued for when a request comes in
+					break;
+				}
+				if (ctsHandoffResult::Full == handoffResult)
+				{
+					// the connection is closed as acceptedSocket goes out of scope
+					ctsConfig::PrintErrorIfFailed("AcceptEx", WSAENOBUFS);
+					break;
+				}
+
+				// we had an unfulfilled request for more connections
+				if (const auto sharedSocket = weakSocket.lock())
+				{
+					ctsCompleteAcceptedConnection(sharedSocket, acceptedSocket);
+					break;
+				}
+				// the socket that requested was closed from beneath us - offer the connection to the next request
+			}
+
+			//
+			// attempt another AcceptEx if the depth calls for it
+			//
+			listenSocketInfo->RepostAcceptRequest(acceptInfo);
+		}
+		catch (...)
+		{
+			ctsConfig::PrintThrownException();
+		}
+	} // namespace details
+
+	//
+	//
+	// An accepted socket is being requested
+	// - if there is one queued, return that
+	// - else store the weak_ptr<ctsSocket> to be fulfilled later
+	//
+	//
+	void ctsAcceptEx(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+	{
+		DWORD error = 0;
+		if (!InitOnceExecuteOnce(&details::g_acceptExImplInitOnce, details::ctsAcceptExImplInitFn, &error, nullptr))
+		{
+			if (const auto sharedSocket = weakSocket.lock())
+			{
+				sharedSocket->CompleteState(error);
+			}
+			return;
+		}
+
+		auto sharedSocket(weakSocket.lock());
+		if (!sharedSocket)
+		{
+			return;
+		}
+
+		details::ctsAcceptedConnection acceptedConnection;
+		// take a queued connection, or queue this request for the next one -- save the weak_ptr, *not* the shared_ptr
+		switch (details::g_acceptExImpl.m_handoff->RequestConnection(std::weak_ptr(weakSocket), acceptedConnection))
+		{
+			case ctsHandoffResult::Queued:
+				// completed when the next connection is accepted
+				return;
+
+			case ctsHandoffResult::Full:
+				// fail the caller if we can't save this request
+				ctsConfig::PrintErrorIfFailed("AcceptEx", WSAENOBUFS);
+				sharedSocket->CompleteState(WSAENOBUFS);
+				return;
+
+			case ctsHandoffResult::Matched:
+				break;
+		}
+
+		// a queued connection was taken - AcceptEx requests held back while connections were queued can be pended again
+		try
+		{
+			for (const auto& listenSocketInfo : details::g_acceptExImpl.m_listeners)
+			{
+				listenSocketInfo->PendAcceptRequests();
+			}
+		}
+		catch (...)
+		{
+			ctsConfig::PrintThrownException();
+		}
+
+		details::ctsCompleteAcceptedConnection(sharedSocket, acceptedConnection);
+	}
+
+	std::vector<ctsAcceptShardInfo> ctsAcceptExShardInfos() noexcept
+	{
+		std::vector<ctsAcceptShardInfo> infos;
+		try
+		{
+			for (const auto& listenSocketInfo : details::g_acceptExImpl.m_listeners)
+			{
+				for (const auto& shard : listenSocketInfo->m_shards)
+				{
+					infos.push_back(ctsAcceptShardInfo{
+						.ListeningAddress = listenSocketInfo->m_sockaddr,
+						.ShardIndex = shard->m_shardIndex,
+						.Accepts = shard->m_accepts.load(),
+						.PeakPended = shard->m_peakPended.load(),
+						.BacklogExhausted = shard->m_acceptDepth.GetExhaustedCount()
+					});
+				}
+			}
+		}
+		catch (...)
+		{
+			// the summary groups the shards by listener: report none rather than part of them
+			ctsConfig::PrintThrownException();
+			infos.clear();
+		}
+		return infos;
+	}
+} // namespace
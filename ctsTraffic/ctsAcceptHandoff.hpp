@@ -0,0 +1,381 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+// - nor any OS headers: this header is portable, so the queue and sizing logic can be tested on any platform
+
+namespace ctsTraffic
+{
+//
+// ctsMpmcQueue
+//
+// Bounded lock-free multi-producer multi-consumer FIFO queue
+// - each cell carries a sequence number telling producers and consumers whose turn it is to use the cell,
+//   so a push or a pop is one compare-exchange on the shared position plus one store to the cell
+// - the capacity is rounded up to a power of 2
+//
+template <typename T>
+class ctsMpmcQueue
+{
+public:
+    explicit ctsMpmcQueue(size_t capacity) :
+        m_mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+        m_cells(std::make_unique<Cell[]>(m_mask + 1))
+    {
+        for (size_t index = 0; index <= m_mask; ++index)
+        {
+            m_cells[index].m_sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    // returns false if the queue is full - value is only moved from when returning true
+    bool TryPush(T&& value) noexcept
+    {
+        auto position = m_pushPosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& cell = m_cells[position & m_mask];
+            const auto sequence = cell.m_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (0 == difference)
+            {
+                if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    cell.m_value = std::move(value);
+                    cell.m_sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // the cell still holds the value pushed one lap ago
+                return false;
+            }
+            else
+            {
+                position = m_pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // returns false if the queue is empty
+    bool TryPop(T& value) noexcept
+    {
+        auto position = m_popPosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto& cell = m_cells[position & m_mask];
+            const auto sequence = cell.m_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (0 == difference)
+            {
+                if (m_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = std::move(cell.m_value);
+                    cell.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // nothing has been pushed to the cell yet
+                return false;
+            }
+            else
+            {
+                position = m_popPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] size_t GetCapacity() const noexcept
+    {
+        return m_mask + 1;
+    }
+
+    ctsMpmcQueue(const ctsMpmcQueue&) = delete;
+    ctsMpmcQueue& operator=(const ctsMpmcQueue&) = delete;
+    ctsMpmcQueue(ctsMpmcQueue&&) = delete;
+    ctsMpmcQueue& operator=(ctsMpmcQueue&&) = delete;
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> m_sequence{0};
+        T m_value{};
+    };
+
+    const size_t m_mask;
+    const std::unique_ptr<Cell[]> m_cells;
+    // producers and consumers each update their own position: keep them on separate cache lines
+    alignas(64) std::atomic<size_t> m_pushPosition{0};
+    alignas(64) std::atomic<size_t> m_popPosition{0};
+};
+
+enum class ctsHandoffResult
+{
+    // handed directly to a waiting counterpart
+    Matched,
+    // no counterpart was waiting: queued for the next one
+    Queued,
+    // no counterpart was waiting and the queue is at capacity
+    Full
+};
+
+//
+// ctsAcceptHandoff
+//
+// Matches accepted connections with the requests for them without a lock
+// - a connection finding a request waiting is handed to it, otherwise the connection waits in a queue
+// - a request finding a connection waiting takes it, otherwise the request waits in a queue
+// - one atomic balance decides which: positive counts waiting connections, negative counts waiting requests
+//   so only one of the two queues ever holds anything
+// - a connection or request counted in the balance may not yet be in its queue, so the one claiming it spins
+//   the few instructions until it is
+//
+template <typename Request, typename Connection>
+class ctsAcceptHandoff
+{
+public:
+    ctsAcceptHandoff(size_t requestCapacity, size_t connectionCapacity) :
+        m_requests(requestCapacity),
+        m_connections(connectionCapacity),
+        m_requestLimit(static_cast<int64_t>(m_requests.GetCapacity())),
+        m_connectionLimit(static_cast<int64_t>(m_connections.GetCapacity()))
+    {
+    }
+
+    // Matched: request was set to a waiting request, and connection was not moved from
+    ctsHandoffResult OfferConnection(Connection&& connection, Request& request) noexcept
+    {
+        auto balance = m_balance.load();
+        do
+        {
+            if (balance >= m_connectionLimit)
+            {
+                return ctsHandoffResult::Full;
+            }
+        } while (!m_balance.compare_exchange_weak(balance, balance + 1));
+
+        if (balance < 0)
+        {
+            while (!m_requests.TryPop(request))
+            {
+                std::this_thread::yield();
+            }
+            return ctsHandoffResult::Matched;
+        }
+
+        while (!m_connections.TryPush(std::move(connection)))
+        {
+            std::this_thread::yield();
+        }
+        return ctsHandoffResult::Queued;
+    }
+
+    // Matched: connection was set to a waiting connection, and request was not moved from
+    ctsHandoffResult RequestConnection(Request&& request, Connection& connection) noexcept
+    {
+        auto balance = m_balance.load();
+        do
+        {
+            if (balance <= -m_requestLimit)
+            {
+                return ctsHandoffResult::Full;
+            }
+        } while (!m_balance.compare_exchange_weak(balance, balance - 1));
+
+        if (balance > 0)
+        {
+            while (!m_connections.TryPop(connection))
+            {
+                std::this_thread::yield();
+            }
+            return ctsHandoffResult::Matched;
+        }
+
+        while (!m_requests.TryPush(std::move(request)))
+        {
+            std::this_thread::yield();
+        }
+        return ctsHandoffResult::Queued;
+    }
+
+    // takes a waiting request without offering a connection (to fail the requests when shutting down)
+    bool TryTakeRequest(Request& request) noexcept
+    {
+        auto balance = m_balance.load();
+        do
+        {
+            if (balance >= 0)
+            {
+                return false;
+            }
+        } while (!m_balance.compare_exchange_weak(balance, balance + 1));
+
+        while (!m_requests.TryPop(request))
+        {
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // takes a waiting connection without a request (to close the connections when shutting down)
+    bool TryTakeConnection(Connection& connection) noexcept
+    {
+        auto balance = m_balance.load();
+        do
+        {
+            if (balance <= 0)
+            {
+                return false;
+            }
+        } while (!m_balance.compare_exchange_weak(balance, balance - 1));
+
+        while (!m_connections.TryPop(connection))
+        {
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    [[nodiscard]] uint32_t GetQueuedConnections() const noexcept
+    {
+        const auto balance = m_balance.load();
+        return balance > 0 ? static_cast<uint32_t>(balance) : 0;
+    }
+
+    [[nodiscard]] uint32_t GetQueuedRequests() const noexcept
+    {
+        const auto balance = m_balance.load();
+        return balance < 0 ? static_cast<uint32_t>(-balance) : 0;
+    }
+
+    ctsAcceptHandoff(const ctsAcceptHandoff&) = delete;
+    ctsAcceptHandoff& operator=(const ctsAcceptHandoff&) = delete;
+    ctsAcceptHandoff(ctsAcceptHandoff&&) = delete;
+    ctsAcceptHandoff& operator=(ctsAcceptHandoff&&) = delete;
+
+private:
+    ctsMpmcQueue<Request> m_requests;
+    ctsMpmcQueue<Connection> m_connections;
+    const int64_t m_requestLimit;
+    const int64_t m_connectionLimit;
+    alignas(64) std::atomic<int64_t> m_balance{0};
+};
+
+//
+// ctsAcceptDepth
+//
+// The number of AcceptEx requests a listener should keep pended, adapting to the rate connections are accepted
+// - every c_sampleIntervalUsec the depth is set to cover c_coverageIntervals intervals of accepts at the rate just seen,
+//   growing at once but shrinking by only 1/8th of the difference each interval, so a lull doesn't drop the depth a burst needs
+// - whenever an accept completes with no other accepts left pended, the depth doubles:
+//   connections arriving then wait in the listen backlog until another accept is pended
+// - always within [minimumDepth, maximumDepth]
+// - times are microseconds on the caller's clock; safe to call from any number of threads
+//
+class ctsAcceptDepth
+{
+public:
+    static constexpr int64_t c_sampleIntervalUsec = 100000;
+    static constexpr uint32_t c_coverageIntervals = 2;
+
+    ctsAcceptDepth(uint32_t minimumDepth, uint32_t maximumDepth, int64_t nowUsec) noexcept :
+        m_minimumDepth(std::max(minimumDepth, 1u)),
+        m_maximumDepth(std::max(maximumDepth, std::max(minimumDepth, 1u))),
+        m_targetDepth(m_minimumDepth),
+        m_intervalStartUsec(nowUsec)
+    {
+    }
+
+    [[nodiscard]] uint32_t GetTarget() const noexcept
+    {
+        return m_targetDepth.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t GetExhaustedCount() const noexcept
+    {
+        return m_exhaustedCount.load(std::memory_order_relaxed);
+    }
+
+    // stillPended: the accepts the listener had pended after this one completed
+    void AcceptCompleted(int64_t nowUsec, uint32_t stillPended) noexcept
+    {
+        m_intervalAccepts.fetch_add(1, std::memory_order_relaxed);
+
+        if (0 == stillPended)
+        {
+            m_exhaustedCount.fetch_add(1, std::memory_order_relaxed);
+            auto target = m_targetDepth.load(std::memory_order_relaxed);
+            while (target < m_maximumDepth &&
+                   !m_targetDepth.compare_exchange_weak(target, std::min(target * 2, m_maximumDepth), std::memory_order_relaxed))
+            {
+            }
+        }
+
+        // only the one thread that moves the interval forward recalculates the depth
+        auto intervalStartUsec = m_intervalStartUsec.load(std::memory_order_relaxed);
+        if (nowUsec - intervalStartUsec < c_sampleIntervalUsec ||
+            !m_intervalStartUsec.compare_exchange_strong(intervalStartUsec, nowUsec, std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        const auto accepts = m_intervalAccepts.exchange(0, std::memory_order_relaxed);
+        // scale to accepts per interval when the interval ran long
+        const auto intervalAccepts = accepts * static_cast<uint64_t>(c_sampleIntervalUsec) / static_cast<uint64_t>(nowUsec - intervalStartUsec);
+        const auto wantedDepth = static_cast<uint32_t>(std::clamp<uint64_t>(intervalAccepts * c_coverageIntervals, m_minimumDepth, m_maximumDepth));
+
+        auto target = m_targetDepth.load(std::memory_order_relaxed);
+        uint32_t newTarget;
+        do
+        {
+            newTarget = wantedDepth >= target ? wantedDepth : target - (target - wantedDepth + 7) / 8;
+        } while (!m_targetDepth.compare_exchange_weak(target, newTarget, std::memory_order_relaxed));
+    }
+
+    ctsAcceptDepth(const ctsAcceptDepth&) = delete;
+    ctsAcceptDepth& operator=(const ctsAcceptDepth&) = delete;
+    ctsAcceptDepth(ctsAcceptDepth&&) = delete;
+    ctsAcceptDepth& operator=(ctsAcceptDepth&&) = delete;
+
+private:
+    const uint32_t m_minimumDepth;
+    const uint32_t m_maximumDepth;
+    std::atomic<uint32_t> m_targetDepth;
+    std::atomic<int64_t> m_intervalStartUsec;
+    std::atomic<uint64_t> m_intervalAccepts{0};
+    std::atomic<uint64_t> m_exhaustedCount{0};
+};
+
+// the share of a listener's -AcceptDepth bound which each of its shards keeps
+// - rounded up, and never less than 1, so the shards together keep at least the listener's depth
+//   and at most shardCount - 1 more
+constexpr uint32_t ctsAcceptShardDepth(uint32_t listenerDepth, uint32_t shardCount) noexcept
+{
+    shardCount = std::max(shardCount, 1u);
+    return std::max((listenerDepth + shardCount - 1) / shardCount, 1u);
+}
+} // namespace ctsTraffic
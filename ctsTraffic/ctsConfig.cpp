@@ -1,5648 +1,7365 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// cpp headers
-// ReSharper disable CppClangTidyCppcoreguidelinesInterfacesGlobalInit
-// ReSharper disable CppClangTidyClangDiagnosticExitTimeDestructors
-#include <vector>
-#include <string>
-#include <algorithm>
-// os headers
-#include <Windows.h>
-#include <qos2.h>
-// multimedia timer
-#include <mmsystem.h>
-// ctl headers
-#include <ctString.hpp>
-#include <ctNetAdapterAddresses.hpp>
-#include <ctTimer.hpp>
-#include <ctRandom.hpp>
-#include <ctWmiInstance.hpp>
-// project headers
-#include "ctsConfig.h"
-#include "ctsLogger.hpp"
-#include "ctsIOPattern.h"
-#include "ctsPrintStatus.hpp"
-#include "ctsTCPFunctions.h"
-#include "ctsMediaStreamClient.h"
-#include "ctsMediaStreamServer.h"
-#include "ctsWinsockLayer.h"
-#include <ctCpuAffinity.hpp>
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-#include <wil/resource.h>
-
-using namespace std;
-using namespace ctl;
-
-namespace ctsTraffic::ctsConfig
-{
-	ctsConfigSettings* g_configSettings;
-
-	// Resolves a name (or address literal) to the list of matching socket_address results, throwing on failure.
-	static std::vector<wil::network::socket_address> ResolveNameToAddresses(_In_ PCWSTR name)
-	{
-		std::vector<wil::network::socket_address> returnAddresses;
-		const auto addrResults = wil::network::resolve_name(name);
-		for (const auto& address : wil::network::addr_info_iterator{ addrResults.get() })
-		{
-			returnAddresses.push_back(address);
-		}
-		return returnAddresses;
-	}
-
-	//
-	// Hiding the details of the raw data in an unnamed namespace to make it completely private
-	// Free functions below provide proper access to this information
-	// This design avoids having to pass a "config" object all over to share this information
-	//
-	static wil::critical_section g_statusUpdateLock{ ctsConfigSettings::c_CriticalSectionSpinlock };
-	static wil::critical_section g_shutdownLock{ ctsConfigSettings::c_CriticalSectionSpinlock };
-
-	constexpr WORD c_defaultPort = 4444;
-
-	constexpr uint64_t c_defaultTransfer = 0x40000000; // 1Gbyte
-
-	constexpr uint32_t c_defaultBufferSize = 0x10000; // 64kbyte
-	constexpr uint32_t c_defaultAcceptLimit = 10;
-	constexpr uint32_t c_defaultAcceptExLimit = 100;
-	constexpr uint32_t c_defaultTcpConnectionLimit = 8;
-	constexpr uint32_t c_defaultUdpConnectionLimit = 1;
-	constexpr uint32_t c_defaultConnectionThrottleLimit = 1000;
-	constexpr uint32_t c_maxIocpBatchSize = 256U;
-
-	static PTP_POOL g_threadPool = nullptr;
-	static TP_CALLBACK_ENVIRON g_threadPoolEnvironment;
-	static uint32_t g_threadPoolThreadCount = 0;
-
-	static const wchar_t* g_createFunctionName = nullptr;
-	static const wchar_t* g_connectFunctionName = nullptr;
-	static const wchar_t* g_acceptFunctionName = nullptr;
-	static const wchar_t* g_ioFunctionName = nullptr;
-
-	// connection info + error info
-	static uint32_t g_consoleVerbosity = 4;
-	static uint32_t g_bufferSizeLow = 0;
-	static uint32_t g_bufferSizeHigh = 0;
-	static int64_t g_rateLimitLow = 0;
-	static int64_t g_rateLimitHigh = 0;
-	static uint64_t g_transferSizeLow = c_defaultTransfer;
-	static uint64_t g_transferSizeHigh = 0;
-
-	constexpr uint32_t c_defaultPushBytes = 0x100000;
-	constexpr uint32_t c_defaultPullBytes = 0x100000;
-
-	constexpr uint32_t c_udpDatagramMaximumSizeBytes = 1400UL;
-
-	static uint32_t g_timePeriodRefCount{};
-
-	static int64_t g_previousPrintTimeSlice{};
-	static int64_t g_printTimeSliceCount{};
-
-	static NET_IF_COMPARTMENT_ID g_compartmentId = NET_IF_COMPARTMENT_ID_UNSPECIFIED;
-	static ctNetAdapterAddresses* g_netAdapterAddresses = nullptr;
-
-	static MediaStreamSettings g_mediaStreamSettings;
-	static ctRandomTwister g_randomTwister;
-
-	static HANDLE g_qosHandle = nullptr;
-	static uint32_t g_qosDscpValue = 0;
-
-	// default to 5 seconds
-	constexpr uint32_t c_defaultStatusUpdateFrequency = 5000;
-	static shared_ptr<ctsStatusInformation> g_printStatusInformation;
-	static shared_ptr<ctsLogger> g_connectionLogger;
-	static shared_ptr<ctsLogger> g_statusLogger;
-	static shared_ptr<ctsLogger> g_errorLogger;
-	static shared_ptr<ctsLogger> g_jitterLogger;
-	static shared_ptr<ctsLogger> g_tcpInfoLogger;
-
-	static bool g_isRssEnabledOnAnyProcessor = false;
-
-	static bool g_breakOnError = false;
-	static ExitProcessType g_processStatus = ExitProcessType::Running;
-
-	static INIT_ONCE g_configInitImpl = INIT_ONCE_STATIC_INIT;
-	static BOOL CALLBACK InitOnceConfigImpl(PINIT_ONCE, PVOID, PVOID*)
-	{
-		g_configSettings = new ctsConfigSettings;
-		g_configSettings->Port = c_defaultPort;
-		WI_SetAllFlags(g_configSettings->SocketFlags, WSA_FLAG_OVERLAPPED | WSA_FLAG_NO_HANDLE_INHERIT);
-		g_configSettings->Iterations = MAXULONGLONG;
-		g_configSettings->ConnectionLimit = 1;
-		g_configSettings->AcceptLimit = c_defaultAcceptLimit;
-		g_configSettings->ConnectionThrottleLimit = c_defaultConnectionThrottleLimit;
-		g_configSettings->ServerExitLimit = MAXULONGLONG;
-		g_configSettings->StatusUpdateFrequencyMilliseconds = c_defaultStatusUpdateFrequency;
-		// defaulting to verifying - therefore not using a shared buffer
-		g_configSettings->ShouldVerifyBuffers = true;
-		g_configSettings->UseSharedBuffer = false;
-
-		// sharded receive defaults
-		g_configSettings->EnableRecvSharding = false;
-		// default shard count to number of logical processors when 0
-		g_configSettings->ShardCount = 0;
-		g_configSettings->ShardWorkerCount = 1;
-		g_configSettings->ShardAffinityPolicy = AffinityPolicy::PerCpu;
-
-		g_previousPrintTimeSlice = 0LL;
-		g_printTimeSliceCount = 0LL;
-		return TRUE;
-	}
-	static void ctsConfigInitOnce() noexcept
-	{
-		FAIL_FAST_IF(!InitOnceExecuteOnce(&g_configInitImpl, InitOnceConfigImpl, nullptr, nullptr));
-	}
-
-	//
-	// parses the configuration of the local system for options dependent on deployments
-	//
-	static void CheckReuseUnicastPort() noexcept try
-	{
-		// Windows 10+ exposes a new socket option: SO_REUSE_UNICASTPORT
-		// - this allows for much greater reuse of local ports, but also requires
-		//   the system having been deliberately configured to take advantage of it
-		// - looking for corresponding the WMI class property, which only exists in Win10+
-		for (const auto& instance : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetTCPSetting"))
-		{
-			wil::unique_variant varValue;
-			instance.get(L"AutoReusePortRangeNumberOfPorts", varValue.addressof());
-			if (V_VT(varValue.addressof()) == VT_I4)
-			{
-				if (V_I4(varValue.addressof()) != 0)
-				{
-					g_configSettings->Options |= ReuseUnicastPort;
-					break;
-				}
-			}
-		}
-	}
-	catch (...)
-	{
-		// will assume is not configured if any exception is thrown
-		// - could be the class doesn't exist (Win7)
-		//   or the property doesn't exist (Win8 and 8.1)
-		PRINT_DEBUG_INFO(
-			L"\t\tNot using SO_REUSE_UNICASTPORT as AutoReusePortRangeNumberOfPorts is not supported or not configured\n");
-	}
-
-	constexpr auto* EnabledString = L"Enabled";
-	constexpr auto* NotEnabledString = L"NOT-ENABLED";
-	static std::wstring CheckOffloadRsc(const std::wstring& inputInterfaceDescription) noexcept try
-	{
-		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterRscSettingData"))
-		{
-			std::wstring interfaceDescription;
-			setting.get(L"InterfaceDescription", &interfaceDescription);
-			if (interfaceDescription != inputInterfaceDescription)
-			{
-				continue;
-			}
-
-			bool ipv4Enabled = false;
-			setting.get(L"IPv4Enabled", &ipv4Enabled);
-			bool ipv6Enabled = false;
-			setting.get(L"IPv6Enabled", &ipv6Enabled);
-			return wil::str_printf<std::wstring>(
-				L"RSC:IPv4 %ws IPv6 %ws",
-				ipv4Enabled ? EnabledString : NotEnabledString, ipv6Enabled ? EnabledString : NotEnabledString);
-		}
-
-		return wil::str_printf<std::wstring>(L"RSC:IPv4 %ws,IPv6 %ws", NotEnabledString, NotEnabledString);
-	}
-	catch (...)
-	{
-		PRINT_DEBUG_INFO(
-			L"\t\tQuerying for NetAdapterRsc failed : 0x%lx\n", wil::ResultFromCaughtException());
-		return {};
-	}
-
-	static std::wstring CheckOffloadLso(const std::wstring& inputInterfaceDescription) noexcept try
-	{
-		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterLsoSettingData"))
-		{
-			std::wstring interfaceDescription;
-			setting.get(L"InterfaceDescription", &interfaceDescription);
-			if (interfaceDescription != inputInterfaceDescription)
-			{
-				continue;
-			}
-
-			bool ipv4Enabled = false;
-			setting.get(L"IPv4Enabled", &ipv4Enabled);
-			bool ipv6Enabled = false;
-			setting.get(L"IPv6Enabled", &ipv6Enabled);
-			return wil::str_printf<std::wstring>(
-				L"LSO:IPv4 %ws IPv6 %ws",
-				ipv4Enabled ? EnabledString : NotEnabledString, ipv6Enabled ? EnabledString : NotEnabledString);
-		}
-
-		return wil::str_printf<std::wstring>(L"LSO:IPv4 %ws,IPv6 %ws", NotEnabledString, NotEnabledString);
-	}
-	catch (...)
-	{
-		PRINT_DEBUG_INFO(
-			L"\t\tQuerying for NetAdapterLso failed : 0x%lx\n", wil::ResultFromCaughtException());
-		return {};
-	}
-
-	static std::wstring CheckOffloadRss(const std::wstring& inputInterfaceDescription) noexcept try
-	{
-		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterRssSettingData"))
-		{
-			std::wstring interfaceDescription;
-			setting.get(L"InterfaceDescription", &interfaceDescription);
-			if (interfaceDescription != inputInterfaceDescription)
-			{
-				continue;
-			}
-
-			bool enabled = false;
-			setting.get(L"Enabled", &enabled);
-			if (enabled)
-			{
-			    g_isRssEnabledOnAnyProcessor = true;
-			}
-			return wil::str_printf<std::wstring>(
-				L"RSS:%ws", enabled ? EnabledString : NotEnabledString);
-		}
-		return wil::str_printf<std::wstring>(L"RSS:%ws", NotEnabledString);
-	}
-	catch (...)
-	{
-		PRINT_DEBUG_INFO(
-			L"\t\tQuerying for NetAdapterRss failed : 0x%lx\n", wil::ResultFromCaughtException());
-		return {};
-	}
-
-	static std::wstring PrintPhysicalAdapter(const std::wstring& inputInterfaceDescription) noexcept try
-	{
-		std::wstring returnString;
-
-		// the first query is to find the PCI link speed
-		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterHardwareInfoSettingData"))
-		{
-			std::wstring interfaceDescription;
-			setting.get(L"InterfaceDescription", &interfaceDescription);
-			if (!ctString::iordinal_equals(interfaceDescription, inputInterfaceDescription))
-			{
-				continue;
-			}
-
-			// filter the returned string to just the Bus information - e.g. a return value could look like "PCI bus 8, device 0, function 0"
-			std::wstring locationInformationString;
-			setting.get(L"LocationInformationString", &locationInformationString);
-			const auto foundLocation = locationInformationString.find(L',');
-			if (foundLocation != std::wstring::npos)
-			{
-				locationInformationString.erase(locationInformationString.begin() + foundLocation, locationInformationString.end());
-			}
-
-			if (locationInformationString.starts_with(L"PCI"))
-			{
-				uint32_t pciExpressCurrentLinkSpeedEncoded = 0;
-				setting.get(L"PciExpressCurrentLinkSpeedEncoded", &pciExpressCurrentLinkSpeedEncoded);
-				std::wstring pciExpressCurrentLinkSpeed;
-				if (pciExpressCurrentLinkSpeedEncoded == 1)
-				{
-					pciExpressCurrentLinkSpeed = L"2.5 Gbps";
-				}
-				if (pciExpressCurrentLinkSpeedEncoded == 2)
-				{
-					pciExpressCurrentLinkSpeed = L"5.0 Gbps";
-				}
-
-				returnString = wil::str_printf<std::wstring>(L"Bus:%ws [PCI Link Speed %ws]",
-					locationInformationString.c_str(), pciExpressCurrentLinkSpeed.c_str());
-			}
-			else
-			{
-				returnString = wil::str_printf<std::wstring>(L"Bus:%ws", locationInformationString.c_str());
-			}
-
-			break;
-		}
-
-		// the second query is to find a custom adapter property describing buffers available on the adapter
-		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterAdvancedPropertySettingData"))
-		{
-			std::wstring interfaceDescription;
-			setting.get(L"InterfaceDescription", &interfaceDescription);
-			if (interfaceDescription != inputInterfaceDescription)
-			{
-				continue;
-			}
-
-			// convert the 'DisplayName' string from the adapter to lower-case
-			// this only works if it's ascii -- i.e., only if it's in English
-			std::wstring displayName;
-			if (!setting.get(L"DisplayName", &displayName))
-			{
-				continue;
-			}
-
-			for (auto& letter : displayName)
-			{
-				if (!iswascii(letter))
-				{
-					continue;
-				}
-
-				letter = towlower(letter);
-			}
-
-			if (displayName.find(L"buffer") == std::wstring::npos)
-			{
-				continue;
-			}
-
-			std::wstring displayValue;
-			if (!setting.get(L"DisplayValue", &displayValue))
-			{
-				continue;
-			}
-
-			if (!returnString.empty())
-			{
-				returnString += L" ";
-			}
-			returnString += wil::str_printf<std::wstring>(L"[%ws = %ws]", displayName.c_str(), displayValue.c_str());
-		}
-
-		if (returnString.empty())
-		{
-			returnString = L"(No hardware information available)";
-		}
-
-		returnString += L"\n";
-		return returnString;
-	}
-	catch (...)
-	{
-		PRINT_DEBUG_INFO(
-			L"\t\tQuerying for MSFT_NetAdapterHardwareInfo failed : 0x%lx\n", wil::ResultFromCaughtException());
-		return {};
-	}
-
-	//
-	// parses the input argument to determine if it matches the expected parameter
-	// if so, it returns a ptr to the corresponding parameter value
-	// otherwise, returns nullptr
-	//
-	// throws invalid_parameter if something is obviously wrong 
-	//
-	static const wchar_t* ParseArgument(_In_z_ const wchar_t* inputArgument, _In_z_ const wchar_t* expectedParam)
-	{
-		const wchar_t* paramEnd = inputArgument + wcslen(inputArgument);
-		const wchar_t* paramDelimiter = find(inputArgument, paramEnd, L':');
-		if (!(paramEnd > paramDelimiter + 1))
-		{
-			throw invalid_argument(ctString::convert_to_string(inputArgument));
-		}
-		// temporarily null-terminate it at the delimiter to do a string compare
-		*const_cast<wchar_t*>(paramDelimiter) = L'\0';
-		const wchar_t* returnValue = nullptr;
-		if (ctString::iordinal_equals(expectedParam, inputArgument))
-		{
-			returnValue = paramDelimiter + 1;
-		}
-		*const_cast<wchar_t*>(paramDelimiter) = L':';
-		return returnValue;
-	}
-
-	//
-	// ConvertToIntegral(wstring)
-	//
-	// Directly converts the *entire* contents of the passed in string to a numeric value
-	// - the type of that numeric value being the template type specified
-	//
-	// e.g.
-	// auto a = ConvertToIntegral<long>(L"-1");
-	// auto b = ConvertToIntegral<uint32_t>(L"0xa");
-	// auto a = ConvertToIntegral<int64_t>(L"0x123456789abcdef");
-	// auto a = ConvertToIntegral<uint64_t>(L"999999999999999999");
-	// 
-	// NOTE:
-	// - will *only* assume a string starting with "0x" to be converted as hexadecimal
-	//   if it does not start with "0x", will assume as base-10
-	// - if an unsigned type is specified in the template and a negative number is entered,
-	//   will convert that to the "unsigned" version of that set of bits
-	//   e.g.
-	//       uint64_t test = ConvertToIntegral<uint64_t>(L"-1");
-	//       // test == 0xffffffffffffffff
-	//
-	static int64_t ConvertToIntegralSigned(const wstring& inputString)
-	{
-		auto returnValue = 0ll;
-		size_t firstUnconvertedOffset = 0;
-		if (inputString.find(L'x') != wstring::npos || inputString.find(L'X') != wstring::npos)
-		{
-			returnValue = stoll(inputString, &firstUnconvertedOffset, 16);
-		}
-		else
-		{
-			returnValue = stoll(inputString, &firstUnconvertedOffset, 10);
-		}
-
-		if (firstUnconvertedOffset != inputString.size())
-		{
-			throw invalid_argument(ctString::convert_to_string(inputString));
-		}
-		return returnValue;
-	}
-
-	static uint64_t ConvertToIntegralUnsigned(const wstring& inputString)
-	{
-		auto returnValue = 0ull;
-		size_t firstUnconvertedOffset = 0;
-		if (inputString.find(L'x') != wstring::npos || inputString.find(L'X') != wstring::npos)
-		{
-			returnValue = stoull(inputString, &firstUnconvertedOffset, 16);
-		}
-		else
-		{
-			returnValue = stoull(inputString, &firstUnconvertedOffset, 10);
-		}
-
-		if (firstUnconvertedOffset != inputString.size())
-		{
-			throw invalid_argument(ctString::convert_to_string(inputString));
-		}
-		return returnValue;
-	}
-
-	template <typename T>
-	T ConvertToIntegral(const wstring& inputString);
-
-	template <>
-	int16_t ConvertToIntegral<int16_t>(const wstring& inputString)
-	{
-		const auto returnValue = ConvertToIntegralSigned(inputString);
-		if (returnValue > INT16_MAX || returnValue < INT16_MIN)
-		{
-			throw invalid_argument(ctString::convert_to_string(inputString));
-		}
-		return static_cast<int16_t>(returnValue);
-	}
-
-	template <>
-	uint16_t ConvertToIntegral<uint16_t>(const wstring& inputString)
-	{
-		const auto returnValue = ConvertToIntegralUnsigned(inputString);
-		if (returnValue > UINT16_MAX)
-		{
-			throw invalid_argument(ctString::convert_to_string(inputString));
-		}
-		return static_cast<uint16_t>(returnValue);
-	}
-
-	template <>
-	int32_t ConvertToIntegral<int32_t>(const wstring& inputString)
-	{
-		const auto returnValue = ConvertToIntegralSigned(inputString);
-		if (returnValue < INT32_MIN || returnValue > INT32_MAX)
-		{
-			throw invalid_argument(ctString::convert_to_string(inputString));
-		}
-		return static_cast<int32_t>(returnValue);
-	}
-
-	template <>
-	uint32_t ConvertToIntegral<uint32_t>(const wstring& inputString)
-	{
-		const auto returnValue = ConvertToIntegralUnsigned(inputString);
-		if (returnValue > UINT32_MAX)
-		{
-			throw invalid_argument(ctString::convert_to_string(inputString));
-		}
-		return static_cast<uint32_t>(returnValue);
-	}
-
-	template <>
-	int64_t ConvertToIntegral<int64_t>(const wstring& inputString)
-	{
-		return ConvertToIntegralSigned(inputString);
-	}
-
-	template <>
-	uint64_t ConvertToIntegral<uint64_t>(const wstring& inputString)
-	{
-		return ConvertToIntegralUnsigned(inputString);
-	}
-
-	//
-	// Parses for the connect function to use
-	//
-	static void ParseForCreate(const vector<const wchar_t*>&)
-	{
-		if (nullptr == g_configSettings->CreateFunction)
-		{
-			g_configSettings->CreateFunction = ctsWSASocket;
-			g_createFunctionName = L"WSASocket";
-		}
-	}
-
-	//
-	// Parses for the connect function to use
-	//
-	// -conn:connect
-	// -conn:ConnectByName
-	// -conn:ConnectEx  (*default)
-	//
-	static void ParseForConnect(vector<const wchar_t*>& args)
-	{
-		auto connectSpecified = false;
-		const auto foundArg = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-conn");
-				return value != nullptr;
-			});
-		if (foundArg != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-conn (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundArg, L"-conn");
-			if (ctString::iordinal_equals(L"ConnectEx", value))
-			{
-				g_configSettings->ConnectFunction = ctsConnectEx;
-				g_connectFunctionName = L"ConnectEx";
-			}
-			else if (ctString::iordinal_equals(L"connect", value))
-			{
-				g_configSettings->ConnectFunction = ctsSimpleConnect;
-				g_connectFunctionName = L"connect";
-			}
-			else if (ctString::iordinal_equals(L"ConnectByName", value))
-			{
-				g_configSettings->ConnectFunction = ctsConnectByName;
-				g_connectFunctionName = L"WSAConnectByName";
-			}
-			else
-			{
-				throw invalid_argument("-conn");
-			}
-			connectSpecified = true;
-			// always remove the arg from our vector
-			args.erase(foundArg);
-		}
-		else
-		{
-			if (g_configSettings->IoPattern != IoPatternType::MediaStream)
-			{
-				g_configSettings->ConnectFunction = ctsConnectEx;
-				g_connectFunctionName = L"ConnectEx";
-			}
-			else
-			{
-				g_configSettings->ConnectFunction = ctsMediaStreamClientConnect;
-				g_connectFunctionName = L"MediaStream Client Connect";
-			}
-		}
-
-		if (IoPatternType::MediaStream == g_configSettings->IoPattern && connectSpecified)
-		{
-			throw invalid_argument("-conn (MediaStream has its own internal connection handler)");
-		}
-	}
-
-	//
-	// Parses for the accept function to use
-	//
-	// -acc:accept
-	// -acc:acceptex  (*default)
-	//
-	static void ParseForAccept(vector<const wchar_t*>& args)
-	{
-		g_configSettings->AcceptLimit = c_defaultAcceptExLimit;
-
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-acc");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-acc (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundArgument, L"-acc");
-			if (ctString::iordinal_equals(L"accept", value))
-			{
-				g_configSettings->AcceptFunction = ctsSimpleAccept;
-				g_acceptFunctionName = L"accept";
-			}
-			else if (ctString::iordinal_equals(L"AcceptEx", value))
-			{
-				g_configSettings->AcceptFunction = ctsAcceptEx;
-				g_acceptFunctionName = L"AcceptEx";
-			}
-			else
-			{
-				throw invalid_argument("-acc");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else if (!g_configSettings->ListenAddresses.empty())
-		{
-			if (IoPatternType::MediaStream != g_configSettings->IoPattern)
-			{
-				// only default an Accept function if listening
-				g_configSettings->AcceptFunction = ctsAcceptEx;
-				g_acceptFunctionName = L"AcceptEx";
-			}
-			else
-			{
-				g_configSettings->AcceptFunction = ctsMediaStreamServerListener;
-				g_acceptFunctionName = L"MediaStream Server Listener";
-			}
-		}
-	}
-
-	//
-	// Parses for the IO (read/write) function to use
-	// -- only applicable to TCP
-	//
-	// -io:blocking
-	// -io:nonblocking
-	// -io:event
-	// -io:iocp (*default)
-	// -io:wsapoll
-	// -io:rioiocp
-	//
-	static void ParseForIoFunction(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-io");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-io (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundArgument, L"-io");
-			if (ctString::iordinal_equals(L"iocp", value))
-			{
-				g_configSettings->IoFunction = ctsSendRecvIocp;
-				g_configSettings->Options |= HandleInlineIocp;
-				g_ioFunctionName = L"Iocp (WSASend/WSARecv using IOCP)";
-			}
-			else if (ctString::iordinal_equals(L"ReadWriteFile", value))
-			{
-				g_configSettings->IoFunction = ctsReadWriteIocp;
-				g_ioFunctionName = L"ReadWriteFile (ReadFile/WriteFile using IOCP)";
-			}
-			else if (ctString::iordinal_equals(L"rioiocp", value))
-			{
-				g_configSettings->IoFunction = ctsRioIocp;
-				WI_SetFlag(g_configSettings->SocketFlags, WSA_FLAG_REGISTERED_IO);
-				g_ioFunctionName = L"RioIocp (RIO using IOCP notifications)";
-			}
-			else
-			{
-				throw invalid_argument("-io");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			if (ProtocolType::TCP == g_configSettings->Protocol)
-			{
-				// Default for TCP is WSASend/WSARecv using IOCP
-				g_configSettings->IoFunction = ctsSendRecvIocp;
-				g_configSettings->Options |= HandleInlineIocp;
-				g_ioFunctionName = L"Iocp (WSASend/WSARecv using IOCP)";
-			}
-			else
-			{
-				if (IsListening())
-				{
-					g_configSettings->IoFunction = ctsMediaStreamServerIo;
-					// server also has a closing function to remove the closed socket
-					g_configSettings->ClosingFunction = ctsMediaStreamServerClose;
-					g_ioFunctionName = L"MediaStream Server";
-				}
-				else
-				{
-					constexpr auto udpRecvBuff = 1048576ul; // 1 MB
-					g_configSettings->IoFunction = ctsMediaStreamClient;
-					g_configSettings->Options |= SetRecvBuf;
-					g_configSettings->RecvBufValue = udpRecvBuff;
-					g_configSettings->Options |= HandleInlineIocp;
-					g_configSettings->Options |= EnableCircularQueueing;
-					g_ioFunctionName = L"MediaStream Client";
-				}
-			}
-		}
-	}
-
-	//
-	// Parses for the InlineCompletions setting to use
-	//
-	// -InlineCompletions:on
-	// -InlineCompletions:off
-	//
-	static void ParseForInlineCompletions(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-inlinecompletions");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-inlinecompletions");
-			if (ctString::iordinal_equals(L"on", value))
-			{
-				g_configSettings->Options |= HandleInlineIocp;
-			}
-			else if (ctString::iordinal_equals(L"off", value))
-			{
-				g_configSettings->Options &= ~HandleInlineIocp;
-			}
-			else
-			{
-				throw invalid_argument("-inlinecompletions");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the MsgWaitAll setting to use
-	//
-	// -MsgWaitAll:on
-	// -MsgWaitAll:off
-	//
-	static void ParseForMsgWaitAll(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-msgwaitall");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-msgwaitall");
-			if (ctString::iordinal_equals(L"on", value))
-			{
-				g_configSettings->Options |= MsgWaitAll;
-			}
-			else if (ctString::iordinal_equals(L"off", value))
-			{
-				g_configSettings->Options &= ~MsgWaitAll;
-			}
-			else
-			{
-				throw invalid_argument("-msgwaitall");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		{
-			// default to enable msgwaitall
-			g_configSettings->Options |= MsgWaitAll;
-		}
-	}
-
-	//
-	// Parses for the L4 Protocol to limit to usage
-	//
-	// -Protocol:tcp
-	// -Protocol:udp
-	//
-	static void ParseForProtocol(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-Protocol");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-Protocol");
-			if (ctString::iordinal_equals(L"tcp", value))
-			{
-				g_configSettings->Protocol = ProtocolType::TCP;
-			}
-			else if (ctString::iordinal_equals(L"udp", value))
-			{
-				g_configSettings->Protocol = ProtocolType::UDP;
-			}
-			else
-			{
-				throw invalid_argument("-Protocol");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			// default to TCP
-			g_configSettings->Protocol = ProtocolType::TCP;
-		}
-	}
-
-	//
-	// Parses for socket Options
-	// - allows for more than one option to be set
-	// -Options:<keepalive,tcpfastpath [-Options:<...>] [-Options:<...>]
-	//
-	static void ParseForOptions(vector<const wchar_t*>& args)
-	{
-		for (;;)
-		{
-			// loop until cannot fine -Options
-			const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-				{
-					const auto* const value = ParseArgument(parameter, L"-Options");
-					return value != nullptr;
-				});
-
-			if (foundArgument != end(args))
-			{
-				const auto* const value = ParseArgument(*foundArgument, L"-Options");
-				if (ctString::iordinal_equals(L"keepalive", value))
-				{
-					if (ProtocolType::TCP == g_configSettings->Protocol)
-					{
-						g_configSettings->Options |= KeepAlive;
-					}
-					else
-					{
-						throw invalid_argument("-Options (keepalive only allowed with TCP sockets)");
-					}
-				}
-				else if (ctString::iordinal_equals(L"tcpfastpath", value))
-				{
-					if (ProtocolType::TCP == g_configSettings->Protocol)
-					{
-						g_configSettings->Options |= LoopbackFastPath;
-					}
-					else
-					{
-						throw invalid_argument("-Options (tcpfastpath only allowed with TCP sockets)");
-					}
-				}
-				else
-				{
-					throw invalid_argument("-Options");
-				}
-
-				// always remove the arg from our vector
-				args.erase(foundArgument);
-			}
-			else
-			{
-				// didn't find -Options
-				break;
-			}
-		}
-	}
-
-	//////////////////////////////////////////////////////////////////////////////////////////
-	///
-	/// Parses for a specified DSCP value
-	/// -QosDscpValue:#### [-Options:<...>]
-	///
-	//////////////////////////////////////////////////////////////////////////////////////////
-	static void ParseForDscpValue(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool {
-			const auto* const value = ParseArgument(parameter, L"-QosDscpValue");
-			return value != nullptr;
-			});
-
-		if (foundArgument != end(args))
-		{
-			const auto value = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-QosDscpValue"));
-			if (value > 63)
-			{
-				throw invalid_argument("Invalid QosDscpValue");
-			}
-
-			// verify we can load QoS
-			QOS_VERSION QosVersion{.MajorVersion = 1, .MinorVersion = 0 };
-			THROW_IF_WIN32_BOOL_FALSE_MSG(QOSCreateHandle(&QosVersion, &g_qosHandle), "QOSCreateHandle failed");
-
-			g_qosDscpValue = value;
-
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//////////////////////////////////////////////////////////////////////////////////////////
-	///
-	/// Parses the optional -KeepAliveValue:####
-	///
-	//////////////////////////////////////////////////////////////////////////////////////////
-	static void ParseForKeepAlive(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool {
-			const auto* const value = ParseArgument(parameter, L"-keepalivevalue");
-			return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (ProtocolType::TCP == g_configSettings->Protocol)
-			{
-				g_configSettings->KeepAliveValue = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-keepalivevalue"));
-				if (0 == g_configSettings->KeepAliveValue)
-				{
-					throw invalid_argument("Invalid KeepAliveValue");
-				}
-			}
-			else
-			{
-				throw invalid_argument("-KeepAliveValue is only allowed with TCP sockets");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the wire-Protocol to use
-	// --- these only apply to TCP
-	//
-	// -pattern:push
-	// -pattern:pull
-	// -pattern:pushpull
-	// -pattern:duplex
-	//
-	static void ParseForIoPattern(vector<const wchar_t*>& args)
-	{
-		auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-pattern");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-pattern (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundArgument, L"-pattern");
-			if (ctString::iordinal_equals(L"push", value))
-			{
-				g_configSettings->IoPattern = IoPatternType::Push;
-			}
-			else if (ctString::iordinal_equals(L"pull", value))
-			{
-				g_configSettings->IoPattern = IoPatternType::Pull;
-			}
-			else if (ctString::iordinal_equals(L"pushpull", value))
-			{
-				g_configSettings->IoPattern = IoPatternType::PushPull;
-			}
-			else if (ctString::iordinal_equals(L"flood", value) || ctString::iordinal_equals(L"duplex", value))
-			{
-				// the old name for this was 'flood'
-				g_configSettings->IoPattern = IoPatternType::Duplex;
-			}
-			else
-			{
-				throw invalid_argument("-pattern");
-			}
-
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			if (g_configSettings->Protocol == ProtocolType::UDP)
-			{
-				g_configSettings->IoPattern = IoPatternType::MediaStream;
-			}
-			else
-			{
-				// default the TCP pattern to Push
-				g_configSettings->IoPattern = IoPatternType::Push;
-			}
-		}
-
-		// Now look for options tightly coupled to Protocol
-		const auto foundPushbytes = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-pushbytes");
-				return value != nullptr;
-			});
-		if (foundPushbytes != end(args))
-		{
-			if (g_configSettings->IoPattern != IoPatternType::PushPull)
-			{
-				throw invalid_argument("-PushBytes can only be set with -Pattern:PushPull");
-			}
-			g_configSettings->PushBytes = ConvertToIntegral<uint32_t>(ParseArgument(*foundPushbytes, L"-pushbytes"));
-			// always remove the arg from our vector
-			args.erase(foundPushbytes);
-		}
-		else
-		{
-			g_configSettings->PushBytes = c_defaultPushBytes;
-		}
-
-		const auto foundPullbytes = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-pullbytes");
-				return value != nullptr;
-			});
-		if (foundPullbytes != end(args))
-		{
-			if (g_configSettings->IoPattern != IoPatternType::PushPull)
-			{
-				throw invalid_argument("-PullBytes can only be set with -Pattern:PushPull");
-			}
-			g_configSettings->PullBytes = ConvertToIntegral<uint32_t>(ParseArgument(*foundPullbytes, L"-pullbytes"));
-			// always remove the arg from our vector
-			args.erase(foundPullbytes);
-		}
-		else
-		{
-			g_configSettings->PullBytes = c_defaultPullBytes;
-		}
-
-		const auto foundBurstCount = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-burstcount");
-				return value != nullptr;
-			});
-		if (foundBurstCount != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-BurstCount requires -Protocol:TCP");
-			}
-
-			g_configSettings->BurstCount = ConvertToIntegral<uint32_t>(ParseArgument(*foundBurstCount, L"-burstcount"));
-			if (g_configSettings->BurstCount == 0ul)
-			{
-				throw invalid_argument("-BurstCount requires a non-zero value");
-			}
-			// always remove the arg from our vector
-			args.erase(foundBurstCount);
-		}
-
-		const auto foundBurstDelay = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-burstdelay");
-				return value != nullptr;
-			});
-		if (foundBurstDelay != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-BurstDelay requires -Protocol:TCP");
-			}
-
-			g_configSettings->BurstDelay = ConvertToIntegral<uint32_t>(ParseArgument(*foundBurstDelay, L"-burstdelay"));
-			if (g_configSettings->BurstDelay == 0ul)
-			{
-				throw invalid_argument("-BurstDelay requires a non-zero value");
-			}
-			// always remove the arg from our vector
-			args.erase(foundBurstDelay);
-		}
-
-		// ReSharper disable CppRedundantParentheses
-		if ((g_configSettings->BurstCount.has_value() && !g_configSettings->BurstDelay.has_value()) ||
-			(!g_configSettings->BurstCount.has_value() && g_configSettings->BurstDelay.has_value()))
-		{
-			throw invalid_argument("-BurstCount and -BurstDelay must both be set if either are set");
-		}
-		// ReSharper restore CppRedundantParentheses
-
-		//
-		// Options for the UDP protocol
-		//
-		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-BitsPerSecond");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::UDP)
-			{
-				throw invalid_argument("-BitsPerSecond requires -Protocol:UDP");
-			}
-			g_mediaStreamSettings.BitsPerSecond = ConvertToIntegral<int64_t>(
-				ParseArgument(*foundArgument, L"-BitsPerSecond"));
-			// BitsPerSecond must align on a byte-boundary
-			if (g_mediaStreamSettings.BitsPerSecond % 8 != 0)
-			{
-				g_mediaStreamSettings.BitsPerSecond -= g_mediaStreamSettings.BitsPerSecond % 8;
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-
-		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-FrameRate");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::UDP)
-			{
-				throw invalid_argument("-FrameRate requires -Protocol:UDP");
-			}
-			g_mediaStreamSettings.FramesPerSecond = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-FrameRate"));
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-
-		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-BufferDepth");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::UDP)
-			{
-				throw invalid_argument("-BufferDepth requires -Protocol:UDP");
-			}
-			g_mediaStreamSettings.BufferDepthSeconds = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-BufferDepth"));
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			// default buffer depth to 1
-			g_mediaStreamSettings.BufferDepthSeconds = 1;
-		}
-
-		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-StreamLength");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::UDP)
-			{
-				throw invalid_argument("-StreamLength requires -Protocol:UDP");
-			}
-			g_mediaStreamSettings.StreamLengthSeconds = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-StreamLength"));
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-
-		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-DatagramByteSize");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::UDP)
-			{
-				throw invalid_argument("-DatagramByteSize requires -Protocol:UDP");
-			}
-			g_mediaStreamSettings.DatagramMaxSize = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-DatagramByteSize"));
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			// else set the default value
-			g_mediaStreamSettings.DatagramMaxSize = c_udpDatagramMaximumSizeBytes;
-		}
-
-		// validate and resolve the UDP protocol options
-		if (ProtocolType::UDP == g_configSettings->Protocol)
-		{
-			if (0 == g_mediaStreamSettings.BitsPerSecond)
-			{
-				throw invalid_argument("-BitsPerSecond is required");
-			}
-			if (0 == g_mediaStreamSettings.FramesPerSecond)
-			{
-				throw invalid_argument("-FrameRate is required");
-			}
-			if (0 == g_mediaStreamSettings.StreamLengthSeconds)
-			{
-				throw invalid_argument("-StreamLength is required");
-			}
-
-			// finally calculate the total stream length after all settings are captured from the user
-			g_transferSizeLow = g_mediaStreamSettings.CalculateTransferSize();
-		}
-	}
-
-	//
-	// Parses for IP address or machine name target to use
-	// Can be comma-delimited if more than one
-	//
-	// 3 different parameters read address/name settings:
-	// Supports specifying the parameter multiple times:
-	//   e.g. -target:machine-a -target:machine-b
-	//
-	// -listen: (address to listen on)
-	//   - specifying * == listen to all addresses
-	// -target: (address to connect to)
-	// -bind:   (address to bind before connecting)
-	//   - specifying * == bind to all addresses (default)
-	//
-	static void ParseForAddress(vector<const wchar_t*>& args)
-	{
-		// -listen:<addr> 
-		auto foundListen = begin(args);
-		while (foundListen != end(args))
-		{
-			foundListen = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-				{
-					const auto* const value = ParseArgument(parameter, L"-listen");
-					return value != nullptr;
-				});
-			if (foundListen != end(args))
-			{
-				const auto* const value = ParseArgument(*foundListen, L"-listen");
-				if (ctString::iordinal_equals(L"*", value))
-				{
-					// add both v4 and v6
-					wil::network::socket_address listenAddr(AF_INET);
-					g_configSettings->ListenAddresses.push_back(listenAddr);
-					listenAddr.reset(AF_INET6);
-					g_configSettings->ListenAddresses.push_back(listenAddr);
-				}
-				else
-				{
-					auto tempAddresses(ResolveNameToAddresses(value));
-					if (tempAddresses.empty())
-					{
-						throw invalid_argument("-listen value did not resolve to an IP address");
-					}
-					g_configSettings->ListenAddresses.insert(end(g_configSettings->ListenAddresses),
-						begin(tempAddresses), end(tempAddresses));
-				}
-				// always remove the arg from our vector
-				args.erase(foundListen);
-				// found_listen is now invalidated since we just erased what it's pointing to
-				// - reset it to begin() since we know it's not end()
-				foundListen = args.begin();
-			}
-		}
-
-		// -target:<addr> 
-		auto foundTarget = begin(args);
-		while (foundTarget != end(args))
-		{
-			foundTarget = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-				{
-					const auto* const value = ParseArgument(parameter, L"-target");
-					return value != nullptr;
-				});
-			if (foundTarget != end(args))
-			{
-				if (!g_configSettings->ListenAddresses.empty())
-				{
-					throw invalid_argument("cannot specify both -Listen and -Target");
-				}
-
-				const auto* const value = ParseArgument(*foundTarget, L"-target");
-				g_configSettings->TargetAddressStrings.emplace_back(value);
-
-				auto tempAddresses(ResolveNameToAddresses(value));
-				if (!tempAddresses.empty())
-				{
-					g_configSettings->TargetAddresses.insert(end(g_configSettings->TargetAddresses),
-						begin(tempAddresses), end(tempAddresses));
-				}
-
-				// always remove the arg from our vector
-				args.erase(foundTarget);
-				// found_target is now invalidated since we just erased what it's pointing to
-				// - reset it to begin() since we know it's not end()
-				foundTarget = args.begin();
-			}
-		}
-
-		// -bind:<addr> 
-		auto foundBind = begin(args);
-		while (foundBind != end(args))
-		{
-			foundBind = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-				{
-					const auto* const value = ParseArgument(parameter, L"-bind");
-					return value != nullptr;
-				});
-			if (foundBind != end(args))
-			{
-				const auto* const value = ParseArgument(*foundBind, L"-bind");
-				// check for a comma-delimited list of IP Addresses
-				if (ctString::iordinal_equals(L"*", value))
-				{
-					// add both v4 and v6
-					wil::network::socket_address bindAddr(AF_INET);
-					g_configSettings->BindAddresses.push_back(bindAddr);
-					bindAddr.reset(AF_INET6);
-					g_configSettings->BindAddresses.push_back(bindAddr);
-				}
-				else
-				{
-					auto tempAddresses(ResolveNameToAddresses(value));
-					if (tempAddresses.empty())
-					{
-						throw invalid_argument("-bind value did not resolve to an IP address");
-					}
-					g_configSettings->BindAddresses.insert(end(g_configSettings->BindAddresses), begin(tempAddresses),
-						end(tempAddresses));
-				}
-				// always remove the arg from our vector
-				args.erase(foundBind);
-				// found_bind is now invalidated since we just erased what it's pointing to
-				// - reset it to begin() since we know it's not end()
-				foundBind = args.begin();
-			}
-		}
-
-		if (!g_configSettings->ListenAddresses.empty() && !g_configSettings->TargetAddresses.empty())
-		{
-			throw invalid_argument("cannot specify both -target and -listen");
-		}
-		if (!g_configSettings->ListenAddresses.empty() && !g_configSettings->BindAddresses.empty())
-		{
-			throw invalid_argument("cannot specify both -bind and -listen");
-		}
-		if (g_configSettings->ListenAddresses.empty() && g_configSettings->TargetAddresses.empty())
-		{
-			throw invalid_argument("must specify either -target or -listen");
-		}
-
-		// default bind addresses if not listening and did not exclusively want to bind
-		if (g_configSettings->ListenAddresses.empty() && g_configSettings->BindAddresses.empty())
-		{
-			wil::network::socket_address defaultAddr(AF_INET);
-			g_configSettings->BindAddresses.push_back(defaultAddr);
-			defaultAddr.reset(AF_INET6);
-			g_configSettings->BindAddresses.push_back(defaultAddr);
-		}
-
-		if (!g_configSettings->TargetAddresses.empty())
-		{
-			//
-			// guarantee that BindAddresses and TargetAddresses families can match
-			// - can't allow a bind address to be chosen if there are no TargetAddresses with the same family
-			//
-			uint32_t bindV4 = 0;
-			uint32_t bindV6 = 0;
-			uint32_t targetV4 = 0;
-			uint32_t targetV6 = 0;
-			for (const auto& addr : g_configSettings->BindAddresses)
-			{
-				if (addr.family() == AF_INET)
-				{
-					++bindV4;
-				}
-				else
-				{
-					++bindV6;
-				}
-			}
-			for (const auto& addr : g_configSettings->TargetAddresses)
-			{
-				if (addr.family() == AF_INET)
-				{
-					++targetV4;
-				}
-				else
-				{
-					++targetV6;
-				}
-			}
-			//
-			// if either bind or target has zero of either family, remove those addresses from the other vector
-			//
-			if (0 == bindV4)
-			{
-				std::erase_if(
-					g_configSettings->TargetAddresses,
-					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET; }
-				);
-			}
-			else if (0 == targetV4)
-			{
-				std::erase_if(
-					g_configSettings->BindAddresses,
-					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET; }
-				);
-			}
-
-			if (0 == bindV6)
-			{
-				std::erase_if(
-					g_configSettings->TargetAddresses,
-					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET6; }
-				);
-			}
-			else if (0 == targetV6)
-			{
-				std::erase_if(
-					g_configSettings->BindAddresses,
-					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET6; }
-				);
-			}
-			//
-			// now if either are of size zero, the user specified addresses which didn't align
-			//
-			if (g_configSettings->BindAddresses.empty() || g_configSettings->TargetAddresses.empty())
-			{
-				throw invalid_argument("-bind addresses and target addresses must match families");
-			}
-		}
-	}
-
-	//
-	// Parses for the Port # to listen to/connect to
-	//
-	// -Port:##
-	//
-	static void ParseForPort(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-Port");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			g_configSettings->Port = ConvertToIntegral<uint16_t>(ParseArgument(*foundArgument, L"-Port"));
-			if (0 == g_configSettings->Port)
-			{
-				throw invalid_argument("-Port");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the Port # to listen to/connect to
-	//
-	// -PortScalability:<on,off>
-	//
-	static void ParseForPortScalability(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-PortScalability");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-PortScalability");
-			if (ctString::iordinal_equals(L"on", value))
-			{
-				if (g_configSettings->Options & ReuseUnicastPort)
-				{
-					// should only set PortScalability if ReuseUnicastPort has not already been set
-					// ReuseUnicastPort is the preferred socket option over PortScalability
-				}
-				else
-				{
-					g_configSettings->Options |= PortScalability;
-				}
-			}
-			else if (ctString::iordinal_equals(L"off", value))
-			{
-				// no need to update anything
-			}
-			else
-			{
-				throw invalid_argument("-PortScalability");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the connection limit [max number of connections to maintain]
-	//
-	// -connections:####
-	//
-	static void ParseForConnections(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-connections");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (IsListening())
-			{
-				throw invalid_argument("-Connections is only supported when running as a client");
-			}
-			g_configSettings->ConnectionLimit = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-connections"));
-			if (0 == g_configSettings->ConnectionLimit)
-			{
-				throw invalid_argument("-connections");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the server limit [max number of connections before the server exits]
-	//
-	// -ServerExitLimit:####
-	//
-	static void ParseForServerExitLimit(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ServerExitLimit");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (!IsListening())
-			{
-				throw invalid_argument("-ServerExitLimit is only supported when running as a client");
-			}
-			g_configSettings->ServerExitLimit = ConvertToIntegral<uint64_t>(
-				ParseArgument(*foundArgument, L"-ServerExitLimit"));
-			if (0 == g_configSettings->ServerExitLimit)
-			{
-				// zero indicates no exit
-				g_configSettings->ServerExitLimit = MAXULONGLONG;
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the connection limit [max number of connections to maintain]
-	//
-	// -ThrottleConnections:####
-	//
-	static void ParseForThrottleConnections(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ThrottleConnections");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (IsListening())
-			{
-				throw invalid_argument("-ThrottleConnections is only supported when running as a client");
-			}
-			g_configSettings->ConnectionThrottleLimit = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-ThrottleConnections"));
-			if (0 == g_configSettings->ConnectionThrottleLimit)
-			{
-				// zero means no limit
-				g_configSettings->ConnectionThrottleLimit = MAXUINT32;
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	template <typename T>
-	static void ReadRangeValues(_In_z_ const wchar_t* value, T& outLow, T& outHigh)
-	{
-		// a range was specified
-		// - find the ',' the '[', and the ']'
-		const auto valueLength = wcslen(value);
-		const auto* const valueEnd = value + valueLength;
-		if (valueLength < 5 || value[0] != L'[' || value[valueLength - 1] != L']')
-		{
-			throw invalid_argument("range value [###,###]");
-		}
-		const auto* const commaDelimiter = find(value, valueEnd, L',');
-		if (!(valueEnd > commaDelimiter + 1))
-		{
-			throw invalid_argument("range value [###,###]");
-		}
-
-		// null-terminate the first number at the delimiter to do a string -> int conversion
-		*const_cast<wchar_t*>(commaDelimiter) = L'\0';
-		const auto* const valueLow = value + 1; // move past the '['
-		outLow = ConvertToIntegral<T>(valueLow);
-
-		// null-terminate for the 2nd number over the last ']' to doa string -> int conversion
-		const_cast<wchar_t*>(value)[valueLength - 1] = L'\0';
-		const auto* const valueHigh = commaDelimiter + 1;
-		outHigh = ConvertToIntegral<T>(valueHigh);
-
-		// validate buffer values
-		if (outHigh < outLow)
-		{
-			throw invalid_argument("range value [###,###]");
-		}
-	}
-
-	//
-	// Parses for the buffer size to push down per IO
-	//
-	// -buffer:####
-	//        :[low,high]
-	//
-	static void ParseForBuffer(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-buffer");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-buffer (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundArgument, L"-buffer");
-			if (value[0] == L'[')
-			{
-				ReadRangeValues(value, g_bufferSizeLow, g_bufferSizeHigh);
-			}
-			else
-			{
-				// singe values are written to g_BufferSizeLow, with g_BufferSizeHigh left at zero
-				g_bufferSizeLow = ConvertToIntegral<uint32_t>(value);
-			}
-			if (0 == g_bufferSizeLow)
-			{
-				throw invalid_argument("-buffer");
-			}
-
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			g_bufferSizeLow = c_defaultBufferSize;
-			g_bufferSizeHigh = 0;
-		}
-	}
-
-	//
-	// Parses for the total transfer size in bytes per connection
-	//
-	// -transfer:####
-	//          :[low,high]
-	//
-	static void ParseForTransfer(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-transfer");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-transfer (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundArgument, L"-transfer");
-			if (value[0] == L'[')
-			{
-				ReadRangeValues(value, g_transferSizeLow, g_transferSizeHigh);
-			}
-			else
-			{
-				// singe values are written to g_TransferSizeLow, with g_TransferSizeHigh left at zero
-				g_transferSizeLow = ConvertToIntegral<uint64_t>(value);
-			}
-			if (0 == g_transferSizeLow)
-			{
-				throw invalid_argument("-transfer");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the LocalPort # to bind for local connect
-	// 
-	// -LocalPort:##
-	//
-	static void ParseForLocalPort(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-LocalPort");
-				return value != nullptr;
-			});
-
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-LocalPort");
-			if (value[0] == L'[')
-			{
-				ReadRangeValues(value, g_configSettings->LocalPortLow, g_configSettings->LocalPortHigh);
-			}
-			else
-			{
-				// single value are written to LocalPortLow with LocalPortHigh left at zero
-				g_configSettings->LocalPortHigh = 0;
-				g_configSettings->LocalPortLow = ConvertToIntegral<uint16_t>(value);
-			}
-			if (0 == g_configSettings->LocalPortLow)
-			{
-				throw invalid_argument("-LocalPort");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for an explicitly specified interface index for outgoing connections
-	// 
-	// -IfIndex:##
-	//
-	static void ParseForIfIndex(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-IfIndex");
-				return value != nullptr;
-			});
-
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-IfIndex");
-			g_configSettings->OutgoingIfIndex = ConvertToIntegral<uint32_t>(value);
-
-			if (0 == g_configSettings->OutgoingIfIndex)
-			{
-				throw invalid_argument("-IfIndex");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for Tcp throttling parameters
-	//
-	// -RateLimit:####
-	//           :[low,high]
-	// -RateLimitPeriod:####
-	//
-	static void ParseForRateLimit(vector<const wchar_t*>& args)
-	{
-		const auto foundRateLimit = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-RateLimit");
-				return value != nullptr;
-			});
-		if (foundRateLimit != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-RateLimit (only applicable to TCP)");
-			}
-
-			const auto* const value = ParseArgument(*foundRateLimit, L"-RateLimit");
-			if (value[0] == L'[')
-			{
-				ReadRangeValues(value, g_rateLimitLow, g_rateLimitLow);
-			}
-			else
-			{
-				// singe values are written to g_BufferSizeLow, with g_BufferSizeHigh left at zero
-				g_rateLimitLow = ConvertToIntegral<int64_t>(ParseArgument(*foundRateLimit, L"-RateLimit"));
-			}
-			if (0LL == g_rateLimitLow)
-			{
-				throw invalid_argument("-RateLimit");
-			}
-			// always remove the arg from our vector
-			args.erase(foundRateLimit);
-		}
-
-		const auto foundRateLimitPeriod = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-RateLimitPeriod");
-				return value != nullptr;
-			});
-		if (foundRateLimitPeriod != end(args))
-		{
-			if (g_configSettings->Protocol != ProtocolType::TCP)
-			{
-				throw invalid_argument("-RateLimitPeriod (only applicable to TCP)");
-			}
-			if (0LL == g_rateLimitLow)
-			{
-				throw invalid_argument("-RateLimitPeriod requires specifying -RateLimit");
-			}
-			g_configSettings->TcpBytesPerSecondPeriod = ConvertToIntegral<int64_t>(
-				ParseArgument(*foundRateLimitPeriod, L"-RateLimitPeriod"));
-			// always remove the arg from our vector
-			args.erase(foundRateLimitPeriod);
-		}
-	}
-
-	//
-	// Parses for the total # of iterations
-	//
-	// -Iterations:####
-	//
-	static void ParseForIterations(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-Iterations");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (IsListening())
-			{
-				throw invalid_argument("-Iterations is only supported when running as a client");
-			}
-			g_configSettings->Iterations = ConvertToIntegral<uint64_t>(ParseArgument(*foundArgument, L"-Iterations"));
-			if (0 == g_configSettings->Iterations)
-			{
-				g_configSettings->Iterations = MAXULONGLONG;
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the verbosity level
-	//
-	// -ConsoleVerbosity:## <0-6>
-	// -StatusUpdate:####
-	//
-	static void ParseForLogging(vector<const wchar_t*>& args)
-	{
-		const auto foundVerbosity = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ConsoleVerbosity");
-				return value != nullptr;
-			});
-		if (foundVerbosity != end(args))
-		{
-			g_consoleVerbosity = ConvertToIntegral<uint32_t>(ParseArgument(*foundVerbosity, L"-ConsoleVerbosity"));
-			if (g_consoleVerbosity > 6)
-			{
-				throw invalid_argument("-ConsoleVerbosity");
-			}
-			// always remove the arg from our vector
-			args.erase(foundVerbosity);
-		}
-
-		const auto foundStatusUpdate = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-StatusUpdate");
-				return value != nullptr;
-			});
-		if (foundStatusUpdate != end(args))
-		{
-			g_configSettings->StatusUpdateFrequencyMilliseconds = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundStatusUpdate, L"-StatusUpdate"));
-			if (0 == g_configSettings->StatusUpdateFrequencyMilliseconds)
-			{
-				throw invalid_argument("-StatusUpdate");
-			}
-			// always remove the arg from our vector
-			args.erase(foundStatusUpdate);
-		}
-
-		wstring connectionFilename;
-		wstring errorFilename;
-		wstring statusFilename;
-		wstring jitterFilename;
-		wstring tcpInfoFilename;
-
-		const auto foundConnectionFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ConnectionFilename");
-				return value != nullptr;
-			});
-		if (foundConnectionFilename != end(args))
-		{
-			connectionFilename = ParseArgument(*foundConnectionFilename, L"-ConnectionFilename");
-			// always remove the arg from our vector
-			args.erase(foundConnectionFilename);
-		}
-
-		const auto foundErrorFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ErrorFilename");
-				return value != nullptr;
-			});
-		if (foundErrorFilename != end(args))
-		{
-			errorFilename = ParseArgument(*foundErrorFilename, L"-ErrorFilename");
-			// always remove the arg from our vector
-			args.erase(foundErrorFilename);
-		}
-
-		const auto foundStatusFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-StatusFilename");
-				return value != nullptr;
-			});
-		if (foundStatusFilename != end(args))
-		{
-			statusFilename = ParseArgument(*foundStatusFilename, L"-StatusFilename");
-			// always remove the arg from our vector
-			args.erase(foundStatusFilename);
-		}
-
-		const auto foundJitterFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-JitterFilename");
-				return value != nullptr;
-			});
-		if (foundJitterFilename != end(args))
-		{
-			jitterFilename = ParseArgument(*foundJitterFilename, L"-JitterFilename");
-			// always remove the arg from our vector
-			args.erase(foundJitterFilename);
-		}
-
-		const auto foundTcpInfoFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-TcpInfoFilename");
-				return value != nullptr;
-			});
-		if (foundTcpInfoFilename != end(args))
-		{
-			tcpInfoFilename = ParseArgument(*foundTcpInfoFilename, L"-TcpInfoFilename");
-			// always remove the arg from our vector
-			args.erase(foundTcpInfoFilename);
-		}
-
-		// since CSV files each have their own header, we cannot allow the same CSV filename to be used
-		// for different loggers, as opposed to txt files, which can be shared across different loggers
-
-		if (!connectionFilename.empty())
-		{
-			if (ctString::iends_with(connectionFilename, L".csv"))
-			{
-				g_connectionLogger = make_shared<ctsTextLogger>(connectionFilename.c_str(), StatusFormatting::Csv);
-			}
-			else
-			{
-				g_connectionLogger = make_shared<
-					ctsTextLogger>(connectionFilename.c_str(), StatusFormatting::ClearText);
-			}
-		}
-
-		if (!errorFilename.empty())
-		{
-			if (ctString::iordinal_equals(connectionFilename, errorFilename))
-			{
-				if (g_connectionLogger->IsCsvFormat())
-				{
-					throw invalid_argument("The error logfile cannot be of csv format");
-				}
-				g_errorLogger = g_connectionLogger;
-			}
-			else
-			{
-				if (ctString::iends_with(errorFilename, L".csv"))
-				{
-					throw invalid_argument("The error logfile cannot be of csv format");
-				}
-				g_errorLogger = make_shared<ctsTextLogger>(errorFilename.c_str(), StatusFormatting::ClearText);
-			}
-		}
-
-		if (!statusFilename.empty())
-		{
-			if (ctString::iordinal_equals(connectionFilename, statusFilename))
-			{
-				if (g_connectionLogger->IsCsvFormat())
-				{
-					throw invalid_argument("The same csv filename cannot be used for different loggers");
-				}
-				g_statusLogger = g_connectionLogger;
-			}
-			else if (ctString::iordinal_equals(errorFilename, statusFilename))
-			{
-				if (g_errorLogger->IsCsvFormat())
-				{
-					throw invalid_argument("The same csv filename cannot be used for different loggers");
-				}
-				g_statusLogger = g_errorLogger;
-			}
-			else
-			{
-				if (ctString::iends_with(statusFilename, L".csv"))
-				{
-					g_statusLogger = make_shared<ctsTextLogger>(statusFilename.c_str(), StatusFormatting::Csv);
-				}
-				else
-				{
-					g_statusLogger = make_shared<ctsTextLogger>(statusFilename.c_str(), StatusFormatting::ClearText);
-				}
-			}
-		}
-
-		if (!jitterFilename.empty())
-		{
-			if (ctString::iends_with(jitterFilename, L".csv"))
-			{
-				if (ctString::iordinal_equals(connectionFilename, jitterFilename) ||
-					ctString::iordinal_equals(errorFilename, jitterFilename) ||
-					ctString::iordinal_equals(statusFilename, jitterFilename))
-				{
-					throw invalid_argument("The same csv filename cannot be used for different loggers");
-				}
-				g_jitterLogger = make_shared<ctsTextLogger>(jitterFilename.c_str(), StatusFormatting::Csv);
-			}
-			else
-			{
-				throw invalid_argument("Jitter can only be logged using a csv format");
-			}
-		}
-
-		if (!tcpInfoFilename.empty())
-		{
-			if (ctString::iends_with(tcpInfoFilename, L".csv"))
-			{
-				if (ctString::iordinal_equals(connectionFilename, tcpInfoFilename) ||
-					ctString::iordinal_equals(errorFilename, tcpInfoFilename) ||
-					ctString::iordinal_equals(statusFilename, tcpInfoFilename) ||
-					ctString::iordinal_equals(jitterFilename, tcpInfoFilename))
-				{
-					throw invalid_argument("The same csv filename cannot be used for different loggers");
-				}
-				g_tcpInfoLogger = make_shared<ctsTextLogger>(tcpInfoFilename.c_str(), StatusFormatting::Csv);
-			}
-			else
-			{
-				throw invalid_argument("TCP Info can only be logged using a csv format");
-			}
-		}
-	}
-
-	//
-	// Sets error policy
-	//
-	// -OnError:<log,break>
-	//
-	static void ParseForError(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-OnError");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-OnError");
-			if (ctString::iordinal_equals(L"log", value))
-			{
-				g_breakOnError = false;
-			}
-			else if (ctString::iordinal_equals(L"break", value))
-			{
-				g_breakOnError = true;
-			}
-			else
-			{
-				throw invalid_argument("-OnError");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Sets optional PrePostRecvs value
-	//
-	// -PrePostRecvs:#####
-	//
-	static void ParseForPrePostRecvs(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-PrePostRecvs");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			g_configSettings->PrePostRecvs = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-PrePostRecvs"));
-			if (0 == g_configSettings->PrePostRecvs)
-			{
-				throw invalid_argument("-PrePostRecvs");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			g_configSettings->PrePostRecvs = ProtocolType::TCP == g_configSettings->Protocol ? 1 : 2;
-		}
-	}
-
-	//
-	// Sets optional PrePostSends value
-	//
-	// -PrePostSends:#####
-	//
-	static void ParseForPrePostSends(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-PrePostSends");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			g_configSettings->PrePostSends = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-PrePostSends"));
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-		else
-		{
-			g_configSettings->PrePostSends = 1;
-			if (WI_IsFlagSet(g_configSettings->SocketFlags, WSA_FLAG_REGISTERED_IO))
-			{
-				// 0 PrePostSends == rely on ISB
-				g_configSettings->PrePostSends = 0;
-			}
-		}
-	}
-
-	//
-	// Sets optional SO_RCVBUF value
-	//
-	// -RecvBufValue:#####
-	//
-	static void ParseForRecvBufValue(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-RecvBufValue");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			g_configSettings->RecvBufValue = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-RecvBufValue"));
-			g_configSettings->Options |= SetRecvBuf;
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Sets optional SO_SNDBUF value
-	//
-	// -SendBufValue:#####
-	//
-	static void ParseForSendBufValue(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-SendBufValue");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			g_configSettings->SendBufValue = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundArgument, L"-SendBufValue"));
-			g_configSettings->Options |= SetSendBuf;
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	// Parses sharded receive options
-	// -EnableRecvSharding[:on|:off]
-	// -ShardCount:###
-	// -ShardWorkerCount:###
-	// -IocpBatchSize:###
-	// -AffinityPolicy:<PerCpu|PerGroup|RssAligned|Manual>
-	static void ParseForRecvSharding(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-EnableRecvSharding");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* value = ParseArgument(*foundArgument, L"-EnableRecvSharding");
-
-			if (ctString::iordinal_equals(value, L"on"))
-			{
-				g_configSettings->EnableRecvSharding = true;
-			}
-			else if (ctString::iordinal_equals(value, L"off"))
-			{
-				g_configSettings->EnableRecvSharding = false;
-			}
-			else
-			{
-				const auto err = std::string("Invalid -EnableRecvSharding value: ") + ctString::convert_to_string(value);
-				throw std::invalid_argument(err);
-			}
-			args.erase(foundArgument);
-		}
-
-		if (!g_configSettings->EnableRecvSharding)
-		{
-			// no further parsing needed
-			return;
-		}
-
-		const auto foundShardCount = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ShardCount");
-				return value != nullptr;
-			});
-		if (foundShardCount != end(args))
-		{
-			const auto val = ConvertToIntegral<uint32_t>(ParseArgument(*foundShardCount, L"-ShardCount"));
-			// 0 is a valid sentinel meaning "default to logical processor count"
-			g_configSettings->ShardCount = val;
-			args.erase(foundShardCount);
-		}
-
-		const auto foundWorker = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-ShardWorkerCount");
-				return value != nullptr;
-			});
-		if (foundWorker != end(args))
-		{
-			const auto val = ConvertToIntegral<uint32_t>(ParseArgument(*foundWorker, L"-ShardWorkerCount"));
-			if (val == 0)
-			{
-				throw invalid_argument("-ShardWorkerCount");
-			}
-			g_configSettings->ShardWorkerCount = val;
-			args.erase(foundWorker);
-		}
-
-		// Parse IOCP batch size for sharded receive (optional)
-		const auto foundBatch = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-IocpBatchSize");
-				return value != nullptr;
-			});
-		if (foundBatch != end(args))
-		{
-			const auto val = ConvertToIntegral<uint32_t>(ParseArgument(*foundBatch, L"-IocpBatchSize"));
-			if (val == 0)
-			{
-				throw invalid_argument("-IocpBatchSize");
-			}
-			if (val > c_maxIocpBatchSize)
-			{
-				throw invalid_argument(std::string("-IocpBatchSize : exceeds maximum size of ") + std::to_string(c_maxIocpBatchSize));
-			}
-			// clamp to a reasonable upper bound to avoid excessive allocations
-			g_configSettings->IocpBatchSize = std::min<uint32_t>(val, c_maxIocpBatchSize);
-			args.erase(foundBatch);
-		}
-
-		const auto foundAffinity = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-AffinityPolicy");
-				return value != nullptr;
-			});
-		if (foundAffinity != end(args))
-		{
-			const auto* const value = ParseArgument(*foundAffinity, L"-AffinityPolicy");
-			if (ctString::iordinal_equals(value, L"PerCpu"))
-			{
-				g_configSettings->ShardAffinityPolicy = AffinityPolicy::PerCpu;
-			}
-			else if (ctString::iordinal_equals(value, L"PerGroup"))
-			{
-				g_configSettings->ShardAffinityPolicy = AffinityPolicy::PerGroup;
-			}
-			else if (ctString::iordinal_equals(value, L"RssAligned"))
-			{
-				g_configSettings->ShardAffinityPolicy = AffinityPolicy::RssAligned;
-			}
-			else if (ctString::iordinal_equals(value, L"Manual"))
-			{
-				g_configSettings->ShardAffinityPolicy = AffinityPolicy::Manual;
-			}
-			else
-			{
-				throw invalid_argument("-AffinityPolicy");
-			}
-			args.erase(foundAffinity);
-		}
-
-		// Post-parse validations
-		if (g_configSettings->EnableRecvSharding)
-		{
-			// Sharded receive mode currently only supported for UDP servers
-			if (g_configSettings->Protocol != ProtocolType::UDP)
-			{
-				throw invalid_argument("-EnableRecvSharding (only valid with -Protocol:udp)");
-			}
-
-			// Must be in listening/server mode (at least one -Listen provided)
-			if (g_configSettings->ListenAddresses.empty())
-			{
-				throw invalid_argument("-EnableRecvSharding (requires the server to be listening; specify -Listen:<addr>)");
-			}
-
-			// numeric ranges already validated above for zero; additional range checks could be added here
-			if (g_configSettings->ShardWorkerCount == 0)
-			{
-				throw invalid_argument("-ShardWorkerCount");
-			}
-		}
-	}
-
-	//
-	// Sets an IP Compartment (routing domain)
-	//
-	// -Compartment:<ifalias>
-	//
-	static void ParseForCompartment(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-Compartment");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			// delay-load IPHLPAPI.DLL
-			const auto* const value = ParseArgument(*foundArgument, L"-Compartment");
-			g_netAdapterAddresses = new ctNetAdapterAddresses(AF_UNSPEC, GAA_FLAG_INCLUDE_ALL_COMPARTMENTS);
-			const auto foundInterface = ranges::find_if(
-				*g_netAdapterAddresses,
-				[&value](const IP_ADAPTER_ADDRESSES& adapterAddress)
-				{
-					return ctString::iordinal_equals(
-						value, adapterAddress.FriendlyName);
-				});
-			THROW_HR_IF_MSG(
-				HRESULT_FROM_WIN32(ERROR_NOT_FOUND),
-				foundInterface == g_netAdapterAddresses->end(),
-				"GetAdaptersAddresses could not find the interface alias '%ws'",
-				value);
-
-			g_compartmentId = foundInterface->CompartmentId;
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Sets a threadpool environment for TP APIs to consume
-	//
-	// Configuring for max threads == number of processors * 2
-	//
-	// currently not exposing this as a command-line parameter
-	//
-	static void ParseForThreadpool(vector<const wchar_t*>& args)
-	{
-		auto setRunsLong = false;
-
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-threadpool");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-threadpool");
-			if (ctString::iordinal_equals(L"default", value))
-			{
-				setRunsLong = false;
-			}
-			else if (ctString::iordinal_equals(L"runslong", value))
-			{
-				setRunsLong = true;
-			}
-
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-
-		SYSTEM_INFO systemInfo;
-		GetSystemInfo(&systemInfo);
-		g_threadPoolThreadCount = systemInfo.dwNumberOfProcessors;
-		if (g_threadPoolThreadCount < 48)
-		{
-			g_threadPoolThreadCount = static_cast<uint32_t>(static_cast<float>(g_threadPoolThreadCount) * 1.25f);
-		}
-		if (g_threadPoolThreadCount > 96)
-		{
-			g_threadPoolThreadCount = static_cast<uint32_t>(static_cast<float>(g_threadPoolThreadCount) / 1.25f);
-		}
-
-		g_threadPool = CreateThreadpool(nullptr);
-		if (!g_threadPool)
-		{
-			THROW_WIN32_MSG(GetLastError(), "CreateThreadPool");
-		}
-		SetThreadpoolThreadMaximum(g_threadPool, g_threadPoolThreadCount);
-
-		InitializeThreadpoolEnvironment(&g_threadPoolEnvironment);
-		if (setRunsLong)
-		{
-			SetThreadpoolCallbackRunsLong(&g_threadPoolEnvironment);
-		}
-		SetThreadpoolCallbackPool(&g_threadPoolEnvironment, g_threadPool);
-
-		g_configSettings->pTpEnvironment = &g_threadPoolEnvironment;
-	}
-
-	//
-	// Parses for whether to verify buffer contents on receiver
-	//
-	// -verify:<connection,data>
-	// (the old options were <always,never>)
-	//
-	// Note this controls if using a SharedBuffer across all IO or unique buffers
-	// - if not validating data, won't waste memory creating buffers for every connection
-	// - if validating data, must create buffers for every connection
-	//
-	static void ParseForShouldVerifyBuffers(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-verify");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			const auto* const value = ParseArgument(*foundArgument, L"-verify");
-			if (ctString::iordinal_equals(L"always", value) || ctString::iordinal_equals(L"data", value))
-			{
-				g_configSettings->ShouldVerifyBuffers = true;
-				g_configSettings->UseSharedBuffer = false;
-			}
-			else if (ctString::iordinal_equals(L"never", value) || ctString::iordinal_equals(L"connection", value))
-			{
-				g_configSettings->ShouldVerifyBuffers = false;
-				g_configSettings->UseSharedBuffer = true;
-			}
-			else
-			{
-				throw invalid_argument("-verify");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for how the client should close the connection with the server
-	//
-	// -shutdown:<graceful,rude,random>
-	//
-	static void ParseForShutdown(vector<const wchar_t*>& args)
-	{
-		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-shutdown");
-				return value != nullptr;
-			});
-		if (foundArgument != end(args))
-		{
-			if (IsListening())
-			{
-				throw invalid_argument("-shutdown is a client-only option");
-			}
-
-			const auto* const value = ParseArgument(*foundArgument, L"-shutdown");
-			if (ctString::iordinal_equals(L"graceful", value))
-			{
-				g_configSettings->TcpShutdown = TcpShutdownType::GracefulShutdown;
-			}
-			else if (ctString::iordinal_equals(L"rude", value))
-			{
-				g_configSettings->TcpShutdown = TcpShutdownType::HardShutdown;
-			}
-			else if (ctString::iordinal_equals(L"random", value))
-			{
-				g_configSettings->TcpShutdown = TcpShutdownType::Random;
-			}
-			else
-			{
-				throw invalid_argument("-shutdown");
-			}
-			// always remove the arg from our vector
-			args.erase(foundArgument);
-		}
-	}
-
-	//
-	// Parses for the optional maximum time to run
-	//
-	// -TimeLimit:##
-	// -PauseAtEnd:##
-	//
-	static void ParseForTimeLimit(vector<const wchar_t*>& args)
-	{
-		const auto foundTimeLimitArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-TimeLimit");
-				return value != nullptr;
-			});
-		if (foundTimeLimitArgument != end(args))
-		{
-			g_configSettings->TimeLimit = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundTimeLimitArgument, L"-TimeLimit"));
-			if (0 == g_configSettings->TimeLimit)
-			{
-				throw invalid_argument("-TimeLimit");
-			}
-			// always remove the arg from our vector
-			args.erase(foundTimeLimitArgument);
-		}
-
-		const auto foundPauseAtEndArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-PauseAtEnd");
-				return value != nullptr;
-			});
-		if (foundPauseAtEndArgument != end(args))
-		{
-			g_configSettings->PauseAtEnd = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundPauseAtEndArgument, L"-PauseAtEnd"));
-			if (0 == g_configSettings->PauseAtEnd)
-			{
-				throw invalid_argument("-PauseAtEnd");
-			}
-			// always remove the arg from our vector
-			args.erase(foundPauseAtEndArgument);
-		}
-	}
-
-	//
-	// Parses for the optional CPU Group ID to set affinity
-	//
-	// -CpuSetGroupId:##
-	//
-	static void ParseForCpuSets(vector<const wchar_t*>& args)
-	{
-		const auto foundCpuGroupIdArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
-			{
-				const auto* const value = ParseArgument(parameter, L"-CpuSetGroupId");
-				return value != nullptr;
-			});
-		if (foundCpuGroupIdArgument != end(args))
-		{
-			g_configSettings->CpuGroupId = ConvertToIntegral<uint32_t>(
-				ParseArgument(*foundCpuGroupIdArgument, L"-CpuSetGroupId"));
-			// always remove the arg from our vector
-			args.erase(foundCpuGroupIdArgument);
-		}
-		else
-		{
-			// default to group zero
-			g_configSettings->CpuGroupId = 0;
-		}
-	}
-
-	//
-	// Members within the ctsConfig namespace that can be accessed anywhere within ctsTraffic
-	//
-	void PrintUsage(PrintUsageOption option)
-	{
-		ctsConfigInitOnce();
-
-		wstring usage;
-
-		switch (option)
-		{
-		case PrintUsageOption::Default:
-			usage.append(L"\n"
-				L"ctsTraffic is a utility to generate and validate the integrity of network traffic. It is a client / server application "
-				L"with the ability to send and receive traffic in a variety of protocol patterns, utilizing a variety of API calling patterns.\n"
-				L"\n"
-				L"Getting started: using the default parameters (ctrl-c or ctrl-break will cleanly shutdown the client or server)\n"
-				L"   server:\n"
-				L"     ctsTraffic.exe -Listen:*\n"
-				L"   client:\n"
-				L"     ctsTraffic.exe -Target:<server name or address>\n"
-				L"\n"
-				L"The above default options do the following:\n"
-				L"   - the server will listen on port 4444 on all addresses for any # of inbound client connections\n"
-				L"     (controlled with -Port)\n"
-				L"   - the server will listen for connections indefinitely\n"
-				L"     (controlled with -ServerExitLimit)\n"
-				L"   - the client will establish 8 concurrently connected TCP connections to the server\n"
-				L"     (controlled with -Connections)\n"
-				L"   - the client will indefinitely create new connections as existing connections close\n"
-				L"     (controlled with -Iterations)\n"
-				L"   - the client and server will default to the 'push' IO pattern - client sends data, server receives data\n"
-				L"     (controlled with -Pattern)\n"
-				L"   - both client and server send and recv data using 64KB buffers\n"
-				L"     (controlled with -Buffer)\n"
-				L"   - as data is received by either side, the entire data buffer is checked for data integrity\n"
-				L"     (controlled with -Verify)\n"
-				L"\n"
-				L"The server-side and client-side may have independent settings *except* for the following\n"
-				L"   (these *must* match exactly on both the client and the server)\n"
-				L"   -Port:######  (defaults to 4444)\n"
-				L"   -Protocol:<tcp,udp>  (defaults to TCP)\n"
-				L"   -Verify:<data,connection>  (defaults to 'data' - verifies all data transferred)\n"
-				L"   -Pattern:<push,pull,pushpull,duplex>  (TCP only - defaults to push)\n"
-				L"   -Transfer:######  (TCP only - defaults to 1GB of data)\n"
-				L"   -BitsPerSecond:######  (required for UDP)\n"
-				L"   -FrameRate:######  (required for UDP)\n"
-				L"   -StreamLength:######  (required for UDP)\n"
-				L"   -DatagramByteSize:###### (optional for UDP - but must match if supplied)\n"
-				L"                    : if set, the client side value must be >= server value\n"
-			);
-			break;
-
-		case PrintUsageOption::Tcp:
-			usage.append(L"\n"
-				L"----------------------------------------------------------------------\n"
-				L"                    TCP usage options                                 \n"
-				L"----------------------------------------------------------------------\n"
-				L"-Buffer:#####\n"
-				L"   - the # of bytes in the buffer used for each send/recv IO\n"
-				L"     <default> == 65536  (each send or recv will post a 64KB buffer)\n"
-				L"   - supports range : [low,high]  (each connection will randomly choose a buffer size from within this range)\n"
-				L"-Pattern:<push,pull,pushpull,duplex>\n"
-				L"   - the protocol pattern to send & recv over the TCP connection\n"
-				L"     <default> == push\n"
-				L"   - push : client pushes data to the server (client sends, server receives)\n"
-				L"   - pull : client pulls data from the server (server sends, client receives)\n"
-				L"   - pushpull : client/server alternates sending/receiving data\n"
-				L"                PushBytes and PullBytes can further customize this option (see help:advanced)\n"
-				L"   - duplex : client/server sends and receives concurrently throughout the entire connection\n"
-				L"-RateLimit:#####\n"
-				L"   - rate limits the number of bytes/sec being sent and received on each individual connection\n"
-				L"     <default> == 0 (no rate limits)\n"
-				L"   - supports range : [low,high]  (each connection will randomly choose a rate limit setting from within this range)\n"
-				L"-Transfer:#####\n"
-				L"   - the total bytes to transfer per TCP connection\n"
-				L"     <default> == 1073741824  (each connection will transfer a sum total of 1GB)\n"
-				L"   - supports range : [low,high]  (each connection will randomly choose a total transfer size send across)\n"
-				L"     note : specifying a range *will* create failures (used to test TCP failures paths)\n"
-				L"-Verify:<data,connection>\n"
-				L"   - controls if received buffers should be verified for data integrity/data corruption\n"
-				L"     <default> == data\n"
-				L"   - connection : the integrity of every connection is verified - the expected # of bytes sent and received\n"
-				L"   - data : the integrity of every received data buffer is verified against the an expected bit-pattern\n"
-				L"     note : data is a super-set of connection for the level of validation provided\n"
-				L"\n"
-				L"----------------------------------------------------------------------\n"
-				L"                    TCP client-only usage options                     \n"
-				L"----------------------------------------------------------------------\n"
-				L"-Connections:#####\n"
-				L"   - the # of active concurrent connections a client should maintain to indicated servers\n"
-				L"     <default> == 8\n"
-				L"     note : this is only applicable to clients - servers accept any # of connections\n"
-				L"          : as a connection closes, another is immediately connected to maintain the target count\n"
-				L"          : the total # of connections to be made before exit == Iterations * Connections\n"
-				L"-Iterations:####\n"
-				L"   - the number of times to iterate across the number of '-Connections'\n"
-				L"     <default> == 0  (infinite)\n"
-				L"     note : the total # of connections to be made before exit == Iterations * Connections\n"
-				L"-Shutdown:<graceful,rude>\n"
-				L"   - controls how clients terminate the TCP connection\n"
-				L"     <default> == graceful\n"
-				L"   - graceful : client will initiate a 4-way FIN with the server and wait for the server's FIN\n"
-				L"   - rude : client will immediately close the connection once it receives the 'done' response from the server\n"
-				L"          : this will deliberately tell TCP to linger for zero seconds and close the socket\n"
-				L"          : this may result in a RST instead of a FIN\n"
-				L"-Target:<address or name>\n"
-				L"   - the IP Address, FQDN, or hostname of the server to connect\n"
-				L"     note : given a FQDN or hostname, all resolved addresses (both IPv4 and IPv6) will be used\n"
-				L"          : one can specify multiple targets by providing -Target for each address or name\n"
-				L"          : one can specify '-Target:localhost' when client and server are both local\n"
-				L"----------------------------------------------------------------------\n"
-				L"                    TCP server-only usage options                     \n"
-				L"----------------------------------------------------------------------\n"
-				L"-Listen:<address or *> [-Listen:<addr> -Listen:<addr>]\n"
-				L"   - the specific IP Address for the server-side to listen, or '*' for all IP Addresses\n"
-				L"     note : can specify multiple addresses by providing -Listen for each address\n"
-				L"-ServerExitLimit:####\n"
-				L"   - the total # of accepted connections before server gracefully exits\n"
-				L"     <default> == 0  (infinite)\n"
-			);
-			break;
-
-		case PrintUsageOption::Udp:
-			usage.append(L"\n"
-				L"----------------------------------------------------------------------\n"
-				L"                        UDP usage options                             \n"
-				L"  * requires the -Protocol:UDP option to be specified                 \n"
-				L"  * UDP datagrams are streamed in a controlled pattern                \n"
-				L"    similar to audio/video streaming solutions                        \n"
-				L"  * In all cases, the client-side receives and server-side sends      \n"
-				L"    at a fixed bit-rate and frame-size                                \n"
-				L"----------------------------------------------------------------------\n"
-				L"-BitsPerSecond:####\n"
-				L"   - the number of bits per second to stream split across '-FrameRate' # of frames\n"
-				L"   - <required>\n"
-				L"-FrameRate:####\n"
-				L"   - the number of frames per second being streamed\n"
-				L"   - <required>\n"
-				L"     note : for server-side this is the specific frequency that datagrams are sent\n"
-				L"          : for client-side this is the frequency that frames are processed and verified\n"
-				L"-StreamLength:####\n"
-				L"   - the total number of seconds to run the entire stream\n"
-				L"   - <required>\n"
-				L"-BufferDepth:####\n"
-				L"   - the number of seconds to buffer before processing the stream\n"
-				L"     <default> = 1 (second)\n"
-				L"     note : this affects the client-side buffering of frames\n"
-				L"          : this also affects how far the client-side will peek at frames to resend if missing\n"
-				L"          : the client will look ahead at 1/2 the buffer depth to request a resend if missing\n"
-				L"----------------------------------------------------------------------\n"
-				L"                    UDP client-only usage options                     \n"
-				L"----------------------------------------------------------------------\n"
-				L"-Connections:#####\n"
-				L"   - the # of active concurrent connections a client should maintain to indicated servers\n"
-				L"     <default> == 8\n"
-				L"     note : this is only applicable to clients - servers accept any # of connections\n"
-				L"          : as a connection closes, another is immediately connected to maintain the target count\n"
-				L"          : the total # of connections to be made before exit == Iterations * Connections\n"
-				L"-Iterations:####\n"
-				L"   - the number of times to iterate across the number of '-Connections'\n"
-				L"     <default> == 0  (infinite)\n"
-				L"     note : the total # of connections to be made before exit == Iterations * Connections\n"
-				L"-Target:<address or name>\n"
-				L"   - the IP Address, FQDN, or hostname of the server to connect\n"
-				L"     note : given a FQDN or hostname, all resolved addresses (both IPv4 and IPv6) will be used\n"
-				L"          : one can specify multiple targets by providing -Target for each address or name\n"
-				L"          : one can specify '-Target:localhost' when client and server are both local\n"
-				L"----------------------------------------------------------------------\n"
-				L"                    UDP server-only usage options                     \n"
-				L"----------------------------------------------------------------------\n"
-				L"-Listen:<address or *> [-Listen:<addr> -Listen:<addr>]\n"
-				L"   - the specific IP Address for the server-side to listen, or '*' for all IP Addresses\n"
-				L"     note : can specify multiple addresses by providing -Listen for each address\n"
-				L"-DatagramByteSize:####\n"
-				L"   - (optional) the maximum size for each datagram to be sent\n"
-				L"     <default> = 1400 bytes\n"
-				L"     note : this affects how each Frame is split into individual calls to WSASendTo\n"
-				L"          : this may need to be made within one MTU for some network deployments\n"
-				L"     note : this is an optional parameter, but if specified on the server\n"
-				L"          : then the client must have a value set that is equal-to or greater-than that of the server\n"
-				L"     note : will generally have a ceiling around 65500 bytes\n"
-				L"-ServerExitLimit:####\n"
-				L"   - the total # of accepted connections before server gracefully exits\n"
-				L"     <default> == 0  (infinite)\n"
-				L"\n"
-				L"  UDP server-only: Sharded receive options\n"
-				L"    (applies to UDP servers only)\n"
-				L"-EnableRecvSharding[:on|:off]\n"
-				L"   - opt-in receive sharding mode. When enabled, ctsTraffic will create one\n"
-				L"     UDP socket and one IOCP per shard and run dedicated worker threads.\n"
-				L"     <default> == off\n"
-				L"-ShardCount:###\n"
-				L"   - number of receive shards to create\n"
-				L"     <default> == 0 (defaults to logical processor count)\n"
-				/* OutstandingReceives removed: no longer a configurable option */
-				L"-ShardWorkerCount:###\n"
-				L"   - number of worker threads to run per shard\n"
-				L"     <default> == 1\n"
-				L"-IocpBatchSize:###\n"
-				L"   - number of completions to process per worker loop iteration\n"
-				L"     <default> == 64\n"
-				L"-AffinityPolicy:<PerCpu|PerGroup|RssAligned|Manual>\n"
-				L"   - how to assign CPU affinity to shards when supported\n"
-				L"     <default> == PerCpu  (infinite)\n"
-			);
-			break;
-
-		case PrintUsageOption::Logging:
-			usage.append(L"\n"
-				L"----------------------------------------------------------------------\n"
-				L"                    Logging options                                   \n"
-				L"----------------------------------------------------------------------\n"
-				L"Logging in ctsTraffic:\n"
-				L"Information available to be logged is grouped into 4 basic buckets:\n"
-				L"  - Connection information : this will write a data point for every successful connection established\n"
-				L"                             -ConnectionFilename specifies the file written with this data\n"
-				L"                             the IP address and port tuples for the source and destination will be written\n"
-				L"                             this will also write a data point at the point of every connection completion\n"
-				L"                             information unique to the protocol that was used will be included on success\n"
-				L"  - Error information      : this will write error strings at the point of failure of any connection\n"
-				L"                             -ErrorFilename specifies the file written with this data\n"
-				L"                             error information will include the specific point of failure (function that failed)\n"
-				L"                             as well as which connection the failure occurred (based off of IP address and port)\n"
-				L"  - Status information     : this will write out status information as applicable to the protocol being used\n"
-				L"                             -StatusFilename specifies the file written with this data\n"
-				L"                             the status information will be printed at a frequency set by -StatusUpdate\n"
-				L"                             the details printed are aggregate values from all connections for that time slice\n"
-				L"  - Jitter information     : for UDP-patterns only, the jitter logging information will write out data per-datagram\n"
-				L"                             -JitterFilename specifies the file written with this data\n"
-				L"                             this information is formatted specifically to calculate jitter between packets\n"
-				L"                             it follows the same format used with the published tool ntttcp.exe:\n"
-				L"                             [frame#],[sender.qpc],[sender.qpf],[receiver.qpc],[receiver.qpf]\n"
-				L"                             - qpc is the result of QueryPerformanceCounter\n"
-				L"                             - qpf is the result of QueryPerformanceFrequency\n"
-				L"                             the algorithm to apply to this data can be found on this site under 'Performance Metrics'\n"
-				L"                             http://msdn.microsoft.com/en-us/library/windows/hardware/dn247504.aspx \n"
-				L"  - TCP_INFO information   : for TCP-patterns only, the TcpInfo logging captures information from TCP_INFO_* structs\n"
-				L"                             -TcpInfoFilename specifies the file written with this data\n"
-				L"                             this information is captured at the end of each TCP connection and written to csv\n"
-				L"                             note this is only available on Windows 10 RS2 and later\n"
-				L"\n"
-				L"The format in which the above data is logged is based off of the file extension of the filename specified above\n"
-				L"  - There are 2 possible file types:\n"
-				L"    - txt : plain text format is used with the file extension .txt, or for an unrecognized file extension\n"
-				L"            text output is formatted as one would see it printed to the console in UTF8 format\n"
-				L"    - csv : comma-separated value format is used with the file extension .csv\n"
-				L"            information is separated into columns separated by a comma for easier post-processing\n"
-				L"            the column layout of the data is specific to the type of output and protocol being used\n"
-				L"            NOTE: csv formatting will only apply to status updates and jitter, not connection or error information\n"
-				L"\n"
-				L"\n"
-				L"-ConsoleVerbosity:<0-5>\n"
-				L"    - logging verbosity for all information to be written to the console\n"
-				L"      <default> == 4\n"
-				L"      0 : off (nothing written to the console)\n"
-				L"      1 : status updates\n"
-				L"      2 : error information + status updates\n"
-				L"      3 : connection information only\n"
-				L"      4 : connection information + error information\n"
-				L"      5 : connection information + error information + status updates\n"
-				// L"      6 : above + debug output\n" // Not exposing debug information to users
-				L"-ConnectionFilename:<filename with/without path>\n"
-				L"      <default> == not written to a log file\n"
-				L"-ErrorFilename:<filename with/without path>\n"
-				L"      <default> == not written to a log file\n"
-				L"-StatusFilename:<filename with/without path>\n"
-				L"      <default> == not written to a log file\n"
-				L"-JitterFilename:<filename with/without path>\n"
-				L"      <default> == not written to a log file\n"
-				L"-TcpInfoFilename:<filename with/without path>\n"
-				L"      <default> == not written to a log file\n"
-				L"-StatusUpdate:####\n"
-				L"    - the millisecond frequency which real-time status updates are written\n"
-				L"      <default> == 5000 (milliseconds)\n"
-			);
-			break;
-
-		case PrintUsageOption::Advanced:
-			usage.append(L"\n"
-				L"----------------------------------------------------------------------\n"
-				L"                        Advanced Options                              \n"
-				L"                                                                      \n"
-				L"  * these options target specific scenario requirements               \n"
-				L"----------------------------------------------------------------------\n"
-				L"-Acc:<accept,AcceptEx>\n"
-				L"   - specifies the Winsock API to process accepting inbound connections\n"
-				L"     the default is appropriate unless deliberately needing to test other APIs\n"
-				L"     <default> == AcceptEx\n"
-				L"   - AcceptEx : uses OVERLAPPED AcceptEx with IO Completion ports\n"
-				L"   - accept : uses blocking calls to accept\n"
-				L"            : be careful using this as it will not scale out well as each call blocks a thread\n"
-				L"-Bind:<IP-address or *>\n"
-				L"   - a client-side option used to control what IP address is used for outgoing connections\n"
-				L"     <default> == *  (will implicitly bind to the correct IP to connect to the target IP)\n"
-				L"     note : this is typically only necessary when wanting to distribute traffic\n"
-				L"            over a specific interface for multi-homed configurations\n"
-				L"     note : can specify multiple addresses by providing -Bind for each address\n"
-				L"-BurstCount:####\n"
-				L"   - optional parameter\n"
-				L"   - applies to any TCP IO Pattern\n"
-				L"   - the number of sends() to send -buffer:#### in a tight loop before triggering a delay\n"
-				L"     note : this is a required field when using BurstDelay\n"
-				L"-BurstDelay:####\n"
-				L"   - optional parameter\n"
-				L"   - applies to any TCP IO Pattern\n"
-				L"   - the number of milliseconds to delay after completing -BurstCount sends\n"
-				L"     note : this is a required field when using BurstCount\n"
-				L"-Compartment:<ifAlias>\n"
-				L"   - specifies the interface alias of the compartment to use for all sockets\n"
-				L"     this is most commonly appropriate for servers configured with IP Compartments\n"
-				L"     <default> == using the default IP compartment\n"
-				L"     note : all systems use the default compartment unless explicitly configured otherwise\n"
-				L"          : the IP addresses specified through -Bind (for clients) and -Listen (for servers)\n"
-				L"            will be directly affected by this Compartment value, including specifying '*'\n"
-				L"-Conn:<connect,ConnectEx,ConnectByName>\n"
-				L"   - specifies the Winsock API to establish outbound connections\n"
-				L"     the default is appropriate unless deliberately needing to test other APIs\n"
-				L"     <default> == ConnectEx  (appropriate unless explicitly wanting to test other APIs)\n"
-				L"   - ConnectEx : uses OVERLAPPED ConnectEx with IO Completion ports\n"
-				L"   - connect : uses blocking calls to connect\n"
-				L"   - ConnectByName: uses blocking calls to WSAConnectByName to connect\n"
-				L"             : be careful using blocking options as it will not scale out as well as each call blocks a thread\n"
-				L"-CpuSetGroupId:####\n"
-				L"   - specifies the CPU Set Group ID that ctsTraffic should affinitize\n"
-				L"     will call GetSystemCpuSetInformation to find the matching Group ID\n"
-				L"     and pass that list of CPU IDs to SetProcessDefaultCpuSets\n"
-				L"     <default> == (not set)\n"
-				L"-IfIndex:####\n"
-				L"   - the interface index which to use for outbound connectivity\n"
-				L"     assigns the interface with IP_UNICAST_IF / IPV6_UNICAST_IF\n"
-				L"     <default> == not set (will not restrict binding to any specific interface)\n"
-				L"-InlineCompletions:<on,off>\n"
-				L"   - will set the below option on all SOCKETS for OVERLAPPED I/O calls so inline successful\n"
-				L"     completions will not be queued to the completion handler\n"
-				L"     SetFileCompletionNotificationModes(FILE_SKIP_COMPLETION_PORT_ON_SUCCESS)\n"
-				L"     <default> == on for TCP -IO:iocp\n"
-				L"                  on for UDP clients\n"
-				L"                  off for all other TCP -IO options\n"
-				L"-IO:<iocp,RioIocp,ReadWriteFile>\n"
-				L"   - the API set and usage for processing the protocol pattern\n"
-				L"     <default> == iocp\n"
-				L"   - iocp : leverages WSARecv/WSASend using IOCP for async completions\n"
-				L"   - RioIocp : registered i/o using an overlapped IOCP for completion notification\n"
-				L"   - ReadWriteFile : leverages ReadFile/WriteFile using IOCP for async completions\n"
-				L"-KeepAliveValue:####\n"
-				L"   - the # of milliseconds to set KeepAlive for TCP connections\n"
-				L"     <default> == not set\n"
-				L"     note : This setting is a more specific setting than -Options:keepalive\n"
-				L"            as -Options:keepalive will use the system default values for keep-alive timers\n"
-				L"-LocalPort:####\n"
-				L"   - the local port to bind to when initiating a connection\n"
-				L"     <default> == 0  (an ephemeral port will be chosen when making a connection)\n"
-				L"   - supports range : [low,high] each new connection will sequentially choose a port within this range\n"
-				L"     note : You must provide a sufficiently large range to support the number of connections\n"
-				L"          : Be very careful when using with TCP connections, as port values will not be immediately\n"
-				L"            reusable; TCP will hold an closed IP:port in a TIME_WAIT statue for a period of time\n"
-				L"            only after which will it be able to be reused (default is 4 minutes)\n"
-				L"-MsgWaitAll:<on,off>\n"
-				L"   - sets the MSG_WAITALL flag when calling WSARecv for receiving data over TCP connections\n"
-				L"     this flag instructs TCP to not complete the receive request until the entire buffer is full\n"
-				L"     <default> == on\n"
-				L"     note : the default behavior when not specified is for TCP to indicate data up to the app per RFC\n"
-				L"            thus apps generally only set this when they know precisely the number of bytes they are expecting\n"
-				L"-OnError:<log,break>\n"
-				L"   - policy to control how errors are handled at runtime\n"
-				L"     <default> == log \n"
-				L"   - log : log error information only\n"
-				L"   - break : break into the debugger with error information\n"
-				L"             useful when live-troubleshooting difficult failures\n"
-				L"-Options:<keepalive,tcpfastpath>  [-Options:<...>] [-Options:<...>]\n"
-				L"   - additional socket options and IOCTLS available to be set on connected sockets\n"
-				L"     <default> == None\n"
-				L"   - keepalive : only for TCP sockets - enables default timeout Keep-Alive probes\n"
-				L"               : ctsTraffic servers have this enabled by default\n"
-				L"   - tcpfastpath : a new option for Windows 8, only for TCP sockets over loopback\n"
-				L"                 : the firewall must be disabled for the option to take effect\n"
-				L"-PauseAtEnd:####\n"
-				L"   - specifies the number of milliseconds to pause before finally exiting the process after all work is done\n"
-				L"     this is useful for automation when one needs the process to not exit immediately\n"
-				L"     <default> == None (will exit once all work is done)\n"
-				L"-PortScalability:<on,off>\n"
-				L"  - specifies if the socket option SO_PORT_SCALABILITY should be set on each socket created\n"
-				L"     <default> == off\n"
-				L"     note : SO_REUSE_UNICASTPORT will be set instead of SO_PORT_SCALABILITY if the system is configured for it\n"
-				L"            SO_REUSE_UNICASTPORT will be used if AutoReusePortRangeNumberOfPorts is set in any MSFT_NetTCPSetting\n"
-				L"            This can be set in Powershell with the Set-NetTCPSetting Powershell command-let\n"
-				L"-PrePostRecvs:#####\n"
-				L"   - specifies the number of recv requests to issue concurrently within an IO Pattern\n"
-				L"   - for example, with the default -pattern:pull, the client will post recv calls \n"
-				L"        one after another, immediately posting a recv after the prior completed.\n"
-				L"        with -pattern:pull -PrePostRecvs:2, clients will keep 2 recv calls in-flight at all times.\n"
-				L"     <default> == 1 for TCP (one recv request at a time)\n"
-				L"     <default> == 2 for UDP (two recv requests kept in-flight)\n"
-				L"     note : with TCP patterns, -verify:connection must be specified in order to specify\n"
-				L"            more than one -PrePostRecvs (UDP can always support any number)\n"
-				L"-PrePostSends:#####\n"
-				L"   - specifies the number of send requests to issue concurrently within an IO Pattern\n"
-				L"   - for example, with the default -pattern:pull, the servers will post send calls \n"
-				L"        one after another, immediately posting a send after the prior completed.\n"
-				L"        With -pattern:pull -PrePostSends:2, servers will keep 2 send calls in-flight at all times.\n"
-				L"   - The value of '0' has special meaning: it indicates for ctsTraffic to keep as many sends\n"
-				L"        in flight as indicated by the Ideal Send Backlog (ISB) indicated by TCP. In this\n"
-				L"        configuration, ctsTraffic will maintain send calls until the number of bytes being sent\n"
-				L"        equals the number of byes indicates by ISB for that TCP connection.\n"
-				L"     <default> == 1 for non-RIO TCP (Winsock will adjust automatically according to ISB)\n"
-				L"     <default> == 0 (ISB) for RIO TCP (RIO doesn't user send buffers so callers must track ISB)\n"
-				L"     <default> == 1 for UDP (one send request on each timer tick)\n"
-				L"-PullBytes:#####\n"
-				L"   - applied only with -Pattern:PushPull - the number of bytes to 'pull'\n"
-				L"     <default> == 1048576 (1MB)\n"
-				L"     note : pullbytes are the bytes received on the client and sent from the server\n"
-				L"-PushBytes:#####\n"
-				L"   - applied only with -Pattern:PushPull - the number of bytes to 'push'\n"
-				L"     <default> == 1048576 (1MB)\n"
-				L"     note : pushbytes are the bytes sent from the client and received on the server\n"
-				L"-QosDscpValue:#####\n"
-				L"   - specifies an outgoing DSCP value for all connected sockets\n"
-				L"     <default> == no DSCP value\n"
-				L"     note: the value must be from 0 to 63 inclusive\n"
-				L"-RateLimitPeriod:#####\n"
-				L"   - the # of milliseconds describing the granularity by which -RateLimit bytes/second is enforced\n"
-				L"        the -RateLimit bytes/second will be evenly split across -RateLimitPeriod milliseconds\n"
-				L"        For example, -RateLimit:1000 -RateLimitPeriod:50 will limit send rates to 100 bytes every 20 ms\n"
-				L"     <default> == 100 (-RateLimit bytes/second will be split out across 100 ms. time slices)\n"
-				L"     note : only applicable to TCP connections\n"
-				L"          : only applicable is -RateLimit is set (default is not to rate limit)\n"
-				L"-RecvBufValue:#####\n"
-				L"   - specifies the value to pass to the SO_RCVBUF socket option\n"
-				L"     <default> == <not set>\n"
-				L"     note : this is only necessary to specify in carefully considered scenarios\n"
-				L"          : the default receive buffering is optimal for the majority of scenarios\n"
-				L"-SendBufValue:#####\n"
-				L"   - specifies the value to pass to the SO_SNDBUF socket option\n"
-				L"     <default> == <not set>\n"
-				L"     note : this is only necessary to specify in carefully considered scenarios\n"
-				L"          : the default send buffering is optimal for the majority of scenarios\n"
-				L"-ThrottleConnections:####\n"
-				L"   - gates currently pended connection attempts\n"
-				L"     <default> == 1000  (there will be at most 1000 sockets trying to connect at any one time)\n"
-				L"     note : zero means no throttling  (will immediately try to connect all '-Connections')\n"
-				L"          : this is a client-only option\n"
-				L"-Threadpool:<default,runslong>\n"
-				L"   - sets options on the NT threadpool used for IO and work items\n"
-				L"     <default> == default\n"
-				L"   - default : uses the default TP_CALLBACK_ENVIRON from InitializeThreadpoolEnvironment\n"
-				L"               this is recommended for must use cases unless we see work not well distributed\n"
-				L"               between different CPUs - usually only at very high throughput rates\n"
-				L"   - runslong : calls SetThreadpoolCallbackRunsLong on the TP_CALLBACK_ENVIRON\n"
-				L"-TimeLimit:#####\n"
-				L"   - the maximum number of milliseconds to run before the application is aborted and terminated\n"
-				L"     <default> == <no time limit>\n"
-				L"     note : this is to be used only to cap the maximum time to run, as this will log an error\n"
-				L"            if this TimeLimit is exceeded; predictable results should have the scenario finish\n"
-				L"            before this time limit is hit\n"
-			);
-			break;
-		}
-
-		(void)fwprintf_s(stdout, L"%ws", usage.c_str());
-	}
-
-	// forward declare this function called by Startup, but implemented later in this function
-	static bool SetProcessDefaultCpuSets();
-	bool Startup(int argc, _In_reads_(argc) const wchar_t** argv)
-	{
-		ctsConfigInitOnce();
-
-		if (argc < 2)
-		{
-			PrintUsage();
-			return false;
-		}
-
-		const auto com = wil::CoInitializeEx();
-
-		// ignore the first argv... the exe itself
-		const wchar_t** argBegin = argv + 1;
-		const wchar_t** argEnd = argv + argc;
-		vector args(argBegin, argEnd);
-
-		//
-		// First:
-		// check of they asked for help text
-		//
-		const auto foundHelp = ranges::find_if(
-			args,
-			[](const wchar_t* arg) -> bool
-			{
-				return ctString::istarts_with(arg, L"-Help") ||
-					ctString::iordinal_equals(arg, L"-?");
-			});
-		if (foundHelp != end(args))
-		{
-			const auto* helpString = *foundHelp;
-			if (ctString::iordinal_equals(helpString, L"-Help:Advanced"))
-			{
-				PrintUsage(PrintUsageOption::Advanced);
-				return false;
-			}
-			if (ctString::iordinal_equals(helpString, L"-Help:Tcp"))
-			{
-				PrintUsage(PrintUsageOption::Tcp);
-				return false;
-			}
-			if (ctString::iordinal_equals(helpString, L"-Help:Udp"))
-			{
-				PrintUsage(PrintUsageOption::Udp);
-				return false;
-			}
-			if (ctString::iordinal_equals(helpString, L"-Help:Logging"))
-			{
-				PrintUsage(PrintUsageOption::Logging);
-				return false;
-			}
-
-			PrintUsage();
-			return false;
-		}
-
-		// create the handle for ctrl-c
-		g_configSettings->CtrlCHandle = CreateEventW(nullptr, TRUE, FALSE, nullptr);
-		if (!g_configSettings->CtrlCHandle)
-		{
-			THROW_WIN32_MSG(GetLastError(), "CreateEvent");
-		}
-
-		// Many of the below settings must be made in a specified order - comments below help to explain this reasoning
-		// note: the IO function definitions must come after *all* other settings
-		//       since instantiations of those IO functions might reference global Settings values
-
-		//
-		// Next:
-		// Establish logging settings including verbosity levels and error policies before any functional settings
-		// Create the threadpool before instantiating any other object
-		//
-		ParseForError(args);
-		ParseForLogging(args);
-
-		// right after logging is configured, set process affinity if specified
-		ParseForCpuSets(args);
-		if (!SetProcessDefaultCpuSets())
-		{
-			// if we can't set the cpu id, clear it so we won't print it later
-			g_configSettings->CpuGroupId.reset();
-		}
-
-		//
-		// Next: check for static machine configuration
-		// - note these are checking system settings, not user arguments
-		//
-		CheckReuseUnicastPort();
-
-		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapter"))
-		{
-			std::wstring interfaceDescription;
-			if (setting.get(L"InterfaceDescription", &interfaceDescription))
-			{
-				uint32_t operationalStatus{};
-				setting.get(L"InterfaceOperationalStatus", &operationalStatus);
-				std::wstring adapterInfo =
-					wil::str_printf<std::wstring>(L"Adapter %ws (%ws)\n\t", interfaceDescription.c_str(), operationalStatus == 1 ? L"Up" : L"NOT-UP");
-
-				constexpr auto* comma_space{ L", " };
-				adapterInfo += CheckOffloadRsc(interfaceDescription) + comma_space;
-				adapterInfo += CheckOffloadLso(interfaceDescription) + comma_space;
-				adapterInfo += CheckOffloadRss(interfaceDescription) + comma_space;
-				adapterInfo += PrintPhysicalAdapter(interfaceDescription) + L"\n";
-				PrintSummary(adapterInfo.c_str());
-			}
-		}
-
-		//
-		// Next: establish the address and port # to be used
-		//
-		ParseForAddress(args);
-		ParseForPort(args);
-		ParseForPortScalability(args);
-		ParseForLocalPort(args);
-		ParseForIfIndex(args);
-
-		//
-		// ensure a Port is assigned to all listening addresses and target addresses
-		//
-		for (auto& addr : g_configSettings->ListenAddresses)
-		{
-			if (addr.port() == 0x0000)
-			{
-				addr.set_port(g_configSettings->Port);
-			}
-		}
-		for (auto& addr : g_configSettings->TargetAddresses)
-		{
-			if (addr.port() == 0x0000)
-			{
-				addr.set_port(g_configSettings->Port);
-			}
-		}
-
-		if (g_configSettings->OutgoingIfIndex != 0 && !g_configSettings->ListenAddresses.empty())
-		{
-			throw invalid_argument("-IfIndex can only be used for outgoing connections, not listening sockets");
-		}
-
-		//
-		// Next: gather the protocol and Pattern to be used
-		// - set the threadpool value after identifying the pattern
-		ParseForProtocol(args);
-		// default to keep-alive on TCP servers
-		if (ProtocolType::TCP == g_configSettings->Protocol && !g_configSettings->ListenAddresses.empty())
-		{
-			g_configSettings->Options |= KeepAlive;
-		}
-
-		ParseForIoPattern(args);
-		ParseForThreadpool(args);
-		// validate protocol & pattern combinations
-		if (ProtocolType::UDP == g_configSettings->Protocol &&
-			IoPatternType::MediaStream != g_configSettings->IoPattern)
-		{
-			throw invalid_argument("UDP only supports the MediaStream IO Pattern");
-		}
-		if (ProtocolType::TCP == g_configSettings->Protocol &&
-			IoPatternType::MediaStream == g_configSettings->IoPattern)
-		{
-			throw invalid_argument("TCP does not support the MediaStream IO Pattern");
-		}
-		// set appropriate defaults for # of connections for TCP vs. UDP
-		if (ProtocolType::UDP == g_configSettings->Protocol)
-		{
-			g_configSettings->ConnectionLimit = c_defaultUdpConnectionLimit;
-		}
-		else
-		{
-			g_configSettings->ConnectionLimit = c_defaultTcpConnectionLimit;
-		}
-
-		//
-		// Next, set the ctsStatusInformation to be used to print status updates for this protocol
-		// - this must be called after both set_logging and set_protocol
-		//
-		if (ProtocolType::TCP == g_configSettings->Protocol)
-		{
-			g_printStatusInformation = make_shared<ctsTcpStatusInformation>();
-		}
-		else
-		{
-			g_printStatusInformation = make_shared<ctsUdpStatusInformation>();
-		}
-
-		//
-		// Next: capture other various settings which do not have explicit dependencies
-		//
-		ParseForOptions(args);
-		ParseForDscpValue(args);
-		ParseForKeepAlive(args);
-		ParseForCompartment(args);
-		ParseForConnections(args);
-		ParseForThrottleConnections(args);
-		ParseForBuffer(args);
-		ParseForTransfer(args);
-		ParseForIterations(args);
-		ParseForServerExitLimit(args);
-
-		ParseForRateLimit(args);
-		ParseForTimeLimit(args);
-
-		if (g_rateLimitLow > 0LL && g_configSettings->BurstDelay.has_value())
-		{
-			throw invalid_argument("-RateLimit and -BurstDelay cannot be used concurrently");
-		}
-
-		const auto ratePerPeriod = g_rateLimitLow * g_configSettings->TcpBytesPerSecondPeriod / 1000LL;
-		if (g_configSettings->Protocol == ProtocolType::TCP && g_rateLimitLow > 0 && ratePerPeriod < 1)
-		{
-			throw invalid_argument(
-				"RateLimit * RateLimitPeriod / 1000 must be greater than zero - meaning every period should send at least 1 byte");
-		}
-
-		//
-		// verify jitter logging requirements
-		//
-		if (g_jitterLogger && g_configSettings->Protocol != ProtocolType::UDP)
-		{
-			throw invalid_argument("Jitter can only be logged using UDP");
-		}
-		if (g_jitterLogger && !g_configSettings->ListenAddresses.empty())
-		{
-			throw invalid_argument("Jitter can only be logged on the client");
-		}
-		if (g_jitterLogger && g_configSettings->ConnectionLimit != 1)
-		{
-			throw invalid_argument("Jitter can only be logged for a single UDP connection");
-		}
-
-		if (g_mediaStreamSettings.FrameSizeBytes > 0)
-		{
-			// the bufferSize is now effectively the frame size
-			g_bufferSizeHigh = 0;
-			g_bufferSizeLow = g_mediaStreamSettings.FrameSizeBytes;
-			if (g_bufferSizeLow < 20)
-			{
-				throw invalid_argument("The media stream frame size (buffer) must be at least 20 bytes");
-			}
-		}
-
-		// validate LocalPort usage
-		if (!g_configSettings->ListenAddresses.empty() && g_configSettings->LocalPortLow != 0)
-		{
-			throw invalid_argument(
-				"Cannot specify both -listen and -LocalPort. To listen on a specific port, use -Port:####");
-		}
-		if (g_configSettings->LocalPortLow != 0)
-		{
-			const USHORT numberOfPorts =
-				g_configSettings->LocalPortHigh == 0
-				? 1
-				: static_cast<USHORT>(g_configSettings->LocalPortHigh - g_configSettings->LocalPortLow + 1);
-
-			if (numberOfPorts < g_configSettings->ConnectionLimit)
-			{
-				throw invalid_argument(
-					"Cannot specify more connections than specified local ports. "
-					"Reduce the number of connections or increase the range of local ports.");
-			}
-		}
-
-		//
-		// Set the default buffer values as these settings are optional
-		//
-		g_configSettings->ShouldVerifyBuffers = true;
-		g_configSettings->UseSharedBuffer = false;
-		ParseForShouldVerifyBuffers(args);
-		if (ProtocolType::UDP == g_configSettings->Protocol)
-		{
-			// UDP clients can never recv into the same shared buffer since it uses it for seq. numbers, etc
-			if (!IsListening())
-			{
-				g_configSettings->UseSharedBuffer = false;
-			}
-		}
-
-		//
-		// finally set the functions to use once all other settings are established
-		// set_ioFunction changes global options for socket operation for instance WSA_FLAG_REGISTERED_IO flag
-		// - hence it is requirement to invoke it prior to any socket operation
-		//
-		ParseForIoFunction(args);
-		ParseForInlineCompletions(args);
-		ParseForMsgWaitAll(args);
-		ParseForCreate(args);
-		ParseForConnect(args);
-		ParseForAccept(args);
-
-		if (!g_configSettings->ListenAddresses.empty())
-		{
-			// servers 'create' connections when they accept them
-			g_configSettings->CreateFunction = g_configSettings->AcceptFunction;
-			g_configSettings->ConnectFunction = nullptr;
-			g_configSettings->TargetAddresses.clear();
-			g_configSettings->TargetAddressStrings.clear();
-		}
-		else if (std::wstring(g_connectFunctionName) == L"WSAConnectByName")
-		{
-			// in this case, we can only use the string names, not the remote addresses
-			g_configSettings->TargetAddresses.clear();
-			if (g_configSettings->TargetAddressStrings.empty())
-			{
-				throw invalid_argument("Must specify a target address");
-			}
-		}
-		else
-		{
-			// in this case, we can only use the remote addresses, not the string names
-			g_configSettings->TargetAddressStrings.clear();
-			if (g_configSettings->TargetAddresses.empty())
-			{
-				throw invalid_argument("Must specify a target address");
-			}
-		}
-
-		g_configSettings->TcpShutdown = TcpShutdownType::GracefulShutdown;
-		ParseForShutdown(args);
-		// calling shutdown on connections made by WSAConnectByName fails with WSAENOTCONN
-		// thus forcing those configurations to use a 'rude' shutdown
-		if (!g_configSettings->TargetAddressStrings.empty())
-		{
-			if (g_configSettings->TcpShutdown != TcpShutdownType::HardShutdown)
-			{
-				PRINT_DEBUG_INFO(L"\t\tctsConfig: overriding -shutdown to be 'rude'\n");
-				g_configSettings->TcpShutdown = TcpShutdownType::HardShutdown;
-			}
-		}
-
-		ParseForPrePostRecvs(args);
-		if (ProtocolType::TCP == g_configSettings->Protocol &&
-			g_configSettings->ShouldVerifyBuffers &&
-			g_configSettings->PrePostRecvs > 1)
-		{
-			throw invalid_argument("-PrePostRecvs > 1 requires -Verify:connection when using TCP");
-		}
-		ParseForPrePostSends(args);
-		ParseForRecvBufValue(args);
-		ParseForSendBufValue(args);
-		ParseForRecvSharding(args);
-
-		// if sharding is enabled, there must be at least one adapter with RSS enabled
-		// else they will get really poor performance since all recv completions will be on one CPU
-		if (g_configSettings->EnableRecvSharding && !g_isRssEnabledOnAnyProcessor)
-		{
-			throw invalid_argument("-EnableRecvSharding requires at least one network adapter to have RSS enabled");
-		}
-
-		if (!args.empty())
-		{
-			wstring errorString;
-			for (const auto& argString : args)
-			{
-				errorString.append(L" ");
-				errorString.append(argString);
-			}
-			errorString.append(L"\n");
-			PrintErrorInfoOverride(errorString.c_str());
-			throw invalid_argument(ctString::convert_to_string(errorString).c_str());
-		}
-
-		if (ProtocolType::UDP == g_configSettings->Protocol)
-		{
-			if (const auto timerResult = timeBeginPeriod(1); timerResult != TIMERR_NOERROR)
-			{
-				THROW_WIN32_MSG(timerResult, "timeBeginPeriod");
-			}
-			++g_timePeriodRefCount;
-		}
-
-		return true;
-	}
-
-	void Shutdown(ExitProcessType type) noexcept
-	{
-		ctsConfigInitOnce();
-
-		const auto lock = g_shutdownLock.lock();
-
-		// never overwrite a rude shutdown status
-		if (g_processStatus != ExitProcessType::Rude)
-		{
-			g_processStatus = type;
-		}
-
-		if (g_configSettings->CtrlCHandle)
-		{
-			if (!SetEvent(g_configSettings->CtrlCHandle))
-			{
-				FAIL_FAST_MSG(
-					"SetEvent(%p) failed [%lu] when trying to shutdown",
-					g_configSettings->CtrlCHandle, GetLastError());
-			}
-		}
-
-		delete g_netAdapterAddresses;
-		g_netAdapterAddresses = nullptr;
-
-		while (g_timePeriodRefCount > 0)
-		{
-			(void)timeEndPeriod(1);
-			--g_timePeriodRefCount;
-		}
-	}
-
-	// the Legend is to explain the fields for status updates
-	// - only print if status updates are going to be provided
-	void PrintLegend() noexcept
-	{
-		ctsConfigInitOnce();
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-		case 1: // status updates
-		case 2: // error info + status updates
-			// case 3: // connection info
-			// case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		if (g_printStatusInformation)
-		{
-			if (writeToConsole)
-			{
-				if (const auto* legend = g_printStatusInformation->PrintLegend(StatusFormatting::ConsoleOutput))
-				{
-					(void)fwprintf_s(stdout, L"%ws\n", legend);
-				}
-				if (const auto* header = g_printStatusInformation->PrintHeader(StatusFormatting::ConsoleOutput))
-				{
-					(void)fwprintf_s(stdout, L"%ws\n", header);
-				}
-			}
-
-			if (g_statusLogger)
-			{
-				g_statusLogger->LogLegend(g_printStatusInformation);
-				g_statusLogger->LogHeader(g_printStatusInformation);
-			}
-		}
-
-		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
-		{
-			if (ProtocolType::UDP == g_configSettings->Protocol)
-			{
-				g_connectionLogger->LogMessage(
-					L"TimeSlice,LocalAddress,RemoteAddress,Bits/Sec,Completed,Dropped,Repeated,Errors,Result,ConnectionId\r\n");
-			}
-			else
-			{
-				// TCP
-				g_connectionLogger->LogMessage(
-					L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId\r\n");
-			}
-		}
-
-		if (g_jitterLogger && g_jitterLogger->IsCsvFormat())
-		{
-			g_jitterLogger->LogMessage(
-				L"SequenceNumber,SenderQpc,SenderQpf,ReceiverQpc,ReceiverQpf,RelativeInFlightTimeMs,PrevToCurrentInFlightTimeJitter\r\n");
-		}
-
-		if (g_tcpInfoLogger && g_tcpInfoLogger->IsCsvFormat())
-		{
-			g_tcpInfoLogger->LogMessage(
-				L"TimeSlice,LocalAddress,RemoteAddress,ConnectionId,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,BytesReordered,BytesRetransmitted,SynRetransmitted,DupAcksIn,MinRttUs,Mss,TimeoutEpisodes,FastRetransmit,SndLimBytesCwnd,SndLimBytesRwin,SndLimBytesSnd\r\n");
-		}
-	}
-
-	// Always print to console if override
-	void PrintExceptionOverride(_In_ PCSTR exceptionText) noexcept
-	{
-		ctsConfigInitOnce();
-
-		FAIL_FAST_IF_MSG(g_breakOnError, "[ctsTraffic] >> exception - %hs\n", exceptionText);
-
-		try
-		{
-			const auto formattedString(
-				wil::str_printf<std::wstring>(
-					L"[%.3f] %hs",
-					GetStatusTimeStamp(),
-					exceptionText));
-			(void)fwprintf_s(stderr, L"%ws\n", formattedString.c_str());
-
-			if (g_errorLogger)
-			{
-				g_errorLogger->LogError(
-					wil::str_printf<std::wstring>(L"%ws\r\n", formattedString.c_str()).c_str());
-			}
-		}
-		catch (...)
-		{
-			(void)fwprintf_s(stderr, L"Error : failed to allocate memory\n");
-			if (g_errorLogger)
-			{
-				g_errorLogger->LogError(L"Error : failed to allocate memory\r\n");
-			}
-		}
-	}
-
-	//
-	// Print* functions
-	// - tracks what level of -verbose was specified
-	//   and prints to console accordingly
-	//
-	static void PrintException(const wil::ResultException& e) noexcept
-	{
-		ctsConfigInitOnce();
-
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		WCHAR errorString[1024]{};
-		GetFailureLogString(errorString, 1024, e.GetFailureInfo());
-		if (g_breakOnError)
-		{
-			FAIL_FAST_MSG(
-				"Fatal exception: %ws", errorString);
-		}
-
-		PrintErrorInfo(errorString);
-	}
-
-	static void PrintException(const std::exception& e) noexcept
-	{
-		ctsConfigInitOnce();
-
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		try
-		{
-			PrintErrorInfo(ctString::convert_to_wstring(e.what()).c_str());
-		}
-		catch (...)
-		{
-			const auto hr = wil::ResultFromCaughtException();
-			if (g_breakOnError)
-			{
-				FAIL_FAST_MSG("Fatal exception: 0x%lx", hr);
-			}
-
-			// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-			switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-			{
-				// case 0: // nothing
-				// case 1: // status updates
-			case 2: // error info + status updates
-				// case 3: // connection info
-			case 4: // connection info + error info
-			case 5: // connection info + error info + status updates
-			case 6: // above + debug info
-				(void)fwprintf_s(stderr, L"[%.3f] Exception thrown: %hs\n", GetStatusTimeStamp(), e.what());
-			}
-		}
-	}
-
-	DWORD PrintThrownException() noexcept
-	{
-		try
-		{
-			throw;
-		}
-		catch (const wil::ResultException& e)
-		{
-			PrintException(e);
-			return Win32FromHresult(e.GetErrorCode());
-		}
-		catch (const std::exception& e)
-		{
-			PrintException(e);
-			return WSAENOBUFS;
-		}
-		catch (...)
-		{
-			FAIL_FAST();
-		}
-	}
-
-	void PrintException(DWORD why, _In_ PCWSTR what, _In_ PCWSTR where) noexcept try
-	{
-		const auto translation = ctString::format_message(why);
-		const auto formattedString = wil::str_printf<std::wstring>(
-			L"[exception] %ws%ws%ws%ws [%u / 0x%lx - %ws]",
-			what ? L" " : L"",
-			what ? what : L"",
-			where ? L" at " : L"",
-			where ? where : L"",
-			why,
-			why,
-			!translation.empty() ? translation.c_str() : L"unknown error");
-		PrintErrorInfo(formattedString.c_str());
-	}
-	catch (...)
-	{
-		PrintErrorInfo(L"[exception] out of memory");
-	}
-
-	// Always print to console if override
-	void PrintErrorInfoOverride(_In_ PCWSTR text) noexcept try
-	{
-		ctsConfigInitOnce();
-
-		if (g_breakOnError)
-		{
-			FAIL_FAST_MSG("%ws", text);
-		}
-
-		(void)fwprintf_s(stderr, L"%ws\n", text);
-
-		if (g_errorLogger)
-		{
-			g_errorLogger->LogError(
-				wil::str_printf<std::wstring>(
-					L"[%.3f] %ws\r\n",
-					GetStatusTimeStamp(), text).c_str());
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void PrintErrorIfFailed(_In_ PCSTR what, uint32_t why) noexcept try
-	{
-		ctsConfigInitOnce();
-
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		if (why == 0)
-		{
-			return;
-		}
-
-		if (g_breakOnError)
-		{
-			FAIL_FAST_MSG("%hs failed (%u)\n", what, why);
-		}
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-			// case 1: // status updates
-		case 2: // error info + status updates
-			// case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		if (!writeToConsole && !g_errorLogger)
-		{
-			return;
-		}
-
-		wstring errorString;
-		if (ctsIoPattern::IsProtocolError(why))
-		{
-			errorString = wil::str_printf<std::wstring>(
-				L"[%.3f] Connection aborted due to the protocol error %ws",
-				GetStatusTimeStamp(),
-				ctsIoPattern::BuildProtocolErrorString(why));
-		}
-		else
-		{
-			errorString = wil::str_printf<std::wstring>(
-				L"[%.3f] %hs failed (%u) %ws",
-				GetStatusTimeStamp(),
-				what,
-				why,
-				ctString::format_message(why).c_str());
-		}
-
-		if (writeToConsole)
-		{
-			(void)fwprintf_s(stderr, L"%ws\n", errorString.c_str());
-		}
-
-		if (g_errorLogger)
-		{
-			g_errorLogger->LogError(
-				wil::str_printf<std::wstring>(L"%ws\r\n", errorString.c_str()).c_str());
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void PrintStatusUpdate() noexcept
-	{
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		if (!g_printStatusInformation)
-		{
-			return;
-		}
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-		case 1: // status updates
-		case 2: // error info + status updates
-			// case 3: // connection info
-			// case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		if (!writeToConsole && !g_statusLogger)
-		{
-			return;
-		}
-
-		if (const auto lock = g_statusUpdateLock.try_lock())
-		{
-			// capture the timeSlices
-			const auto lPreviousTimeSlice = g_previousPrintTimeSlice;
-			const auto lCurrentTimeSlice = ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds;
-
-			if (lCurrentTimeSlice > lPreviousTimeSlice)
-			{
-				// write out the header to the console every 40 updates 
-				if (writeToConsole)
-				{
-					if (g_printTimeSliceCount != 0 && 0 == g_printTimeSliceCount % 40)
-					{
-						if (const auto* header = g_printStatusInformation->PrintHeader(
-							StatusFormatting::ConsoleOutput))
-						{
-							(void)fwprintf_s(stdout, L"%ws", header);
-						}
-					}
-				}
-
-				// need to indicate either print_status() or LogStatus() to reset the status info,
-				// - the data *must* be reset once and *only once* in this function
-
-				auto statusCount = 0;
-				if (writeToConsole)
-				{
-					++statusCount;
-				}
-				if (g_statusLogger)
-				{
-					++statusCount;
-				}
-
-				if (writeToConsole)
-				{
-					--statusCount;
-					const bool clearStatus = 0 == statusCount;
-					if (const auto* printString = g_printStatusInformation->PrintStatus(
-						StatusFormatting::ConsoleOutput, lCurrentTimeSlice, clearStatus))
-					{
-						(void)fwprintf_s(stdout, L"%ws", printString);
-					}
-				}
-
-				if (g_statusLogger)
-				{
-					--statusCount;
-					const bool clearStatus = 0 == statusCount;
-					g_statusLogger->LogStatus(g_printStatusInformation, lCurrentTimeSlice, clearStatus);
-				}
-
-				// update tracking values
-				g_previousPrintTimeSlice = lCurrentTimeSlice;
-				++g_printTimeSliceCount;
-			}
-		}
-	}
-
-	void PrintJitterUpdate(const JitterFrameEntry& currentFrame, const JitterFrameEntry& previousFrame) noexcept
-	{
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		if (g_jitterLogger)
-		{
-			const auto jitter = std::abs(
-				previousFrame.m_estimatedTimeInFlightMs - currentFrame.m_estimatedTimeInFlightMs);
-			// int64_t ~= up to 20 characters long, 10 for each float, plus 10 for commas & CR
-			constexpr size_t formattedTextLength = 20 * 5 + 10 * 2 + 10;
-			wchar_t formattedText[formattedTextLength]{};
-			const auto converted = _snwprintf_s(
-				formattedText,
-				formattedTextLength,
-				L"%lld,%lld,%lld,%lld,%lld,%.3f,%.3f\r\n",
-				currentFrame.m_sequenceNumber, currentFrame.m_senderQpc, currentFrame.m_senderQpf,
-				currentFrame.m_receiverQpc, currentFrame.m_receiverQpf, currentFrame.m_estimatedTimeInFlightMs,
-				jitter);
-			FAIL_FAST_IF(-1 == converted);
-			g_jitterLogger->LogMessage(formattedText);
-		}
-	}
-
-	void PrintNewConnection(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr) noexcept try
-	{
-		ctsConfigInitOnce();
-
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		// write even after shutdown so can print the final summaries
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-			// case 1: // status updates
-			// case 2: // error info + status updates
-		case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		const auto writeToLogFile = g_connectionLogger && !g_connectionLogger->IsCsvFormat();
-		if (!writeToConsole && !writeToLogFile)
-		{
-			return;
-		}
-
-		wil::network::socket_address_wstring wsaLocalAddress{};
-		localAddr.format_complete_address_nothrow(wsaLocalAddress);
-		wil::network::socket_address_wstring wsaRemoteAddress{};
-		remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
-		if (writeToConsole)
-		{
-			constexpr auto* const tcpConnectionString = L"[%.3f] TCP connection established [%ws - %ws]\n";
-			constexpr auto* const udpConnectionString = L"[%.3f] UDP connection established [%ws - %ws]\n";
-			const auto* const connectionString = ProtocolType::TCP == g_configSettings->Protocol ? tcpConnectionString : udpConnectionString;
-
-			(void)fwprintf_s(
-				stdout,
-				connectionString,
-				GetStatusTimeStamp(),
-				wsaLocalAddress,
-				wsaRemoteAddress);
-		}
-
-		if (writeToLogFile)
-		{
-			g_connectionLogger->LogMessage(
-				wil::str_printf<std::wstring>(
-					ProtocolType::TCP == g_configSettings->Protocol
-					? L"[%.3f] TCP connection established [%ws - %ws]\r\n"
-					: L"[%.3f] UDP connection established [%ws - %ws]\r\n",
-					GetStatusTimeStamp(),
-					wsaLocalAddress,
-					wsaRemoteAddress).c_str());
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void PrintConnectionResults(uint32_t error) noexcept try
-	{
-		ctsConfigInitOnce();
-
-		// write even after shutdown so can print the final summaries
-		// except for a rude exit - not printing connection summaries after a rude exit is triggered
-		if (g_processStatus == ExitProcessType::Rude)
-		{
-			return;
-		}
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-			// case 1: // status updates
-			// case 2: // error info + status updates
-		case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		if (!writeToConsole && !g_connectionLogger)
-		{
-			return;
-		}
-
-		enum class ErrorType : std::uint8_t
-		{
-			Success,
-			NetworkError,
-			ProtocolError
-		} errorType = ErrorType::Success;
-
-		if (0 == error)
-		{
-			errorType = ErrorType::Success;
-		}
-		else if (ctsIoPattern::IsProtocolError(error))
-		{
-			errorType = ErrorType::ProtocolError;
-		}
-		else
-		{
-			errorType = ErrorType::NetworkError;
-		}
-
-
-		const float currentTime = GetStatusTimeStamp();
-
-		wstring csvString;
-		wstring textString;
-		wstring errorString;
-		if (ErrorType::ProtocolError != errorType)
-		{
-			if (0 == error)
-			{
-				errorString = L"Succeeded";
-			}
-			else
-			{
-				errorString = wil::str_printf<std::wstring>(
-					L"%lu: %ws",
-					error,
-					ctString::format_message(error).c_str());
-				// remove any commas from the formatted string - since that will mess up csv files
-				ctString::replace_all(errorString, L",", L" ");
-			}
-		}
-
-		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
-		{
-			// csv format : L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId"
-			static const auto* tcpResultCsvFormat = L"%.3f,%ws,%ws,%lld,%lld,%lld,%lld,%lld,%ws,%hs\r\n";
-			csvString = wil::str_printf<std::wstring>(
-				tcpResultCsvFormat,
-				currentTime,
-				wil::network::socket_address().format_complete_address().c_str(),
-				wil::network::socket_address().format_complete_address().c_str(),
-				0LL,
-				0LL,
-				0LL,
-				0LL,
-				0LL,
-				errorString.c_str(),
-				L"");
-		}
-		// we'll never write csv format to the console, so we'll need a text string in that case
-		// - and/or in the case the g_ConnectionLogger isn't writing to csv
-		if (writeToConsole || (g_connectionLogger && !g_connectionLogger->IsCsvFormat()))
-		{
-			static const auto* tcpNetworkFailureResultTextFormat =
-				L"[%.3f] TCP connection failed with the error %ws : [%ws - %ws] [%hs] : SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
-			textString = wil::str_printf<std::wstring>(
-				tcpNetworkFailureResultTextFormat,
-				currentTime,
-				errorString.c_str(),
-				wil::network::socket_address().format_complete_address().c_str(),
-				wil::network::socket_address().format_complete_address().c_str(),
-				L"",
-				0LL,
-				0LL,
-				0LL,
-				0LL,
-				0LL);
-		}
-
-		if (writeToConsole)
-		{
-			// text strings always go to the console
-			(void)fwprintf_s(stdout, L"%ws\n", textString.c_str());
-		}
-
-		if (g_connectionLogger)
-		{
-			if (g_connectionLogger->IsCsvFormat())
-			{
-				g_connectionLogger->LogMessage(csvString.c_str());
-			}
-			else
-			{
-				g_connectionLogger->LogMessage(
-					wil::str_printf<std::wstring>(L"%ws\r\n", textString.c_str()).c_str());
-			}
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void PrintConnectionResults(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, uint32_t error,
-		const ctsTcpStatistics& stats) noexcept try
-	{
-		ctsConfigInitOnce();
-
-		// write even after shutdown so can print the final summaries
-		// except for a rude exit - not printing connection summaries after a rude exit is triggered
-		if (g_processStatus == ExitProcessType::Rude)
-		{
-			return;
-		}
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-			// case 1: // status updates
-			// case 2: // error info + status updates
-		case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		if (!writeToConsole && !g_connectionLogger)
-		{
-			return;
-		}
-
-		enum class ErrorType : std::uint8_t
-		{
-			Success,
-			NetworkError,
-			ProtocolError
-		} errorType = ErrorType::Success;
-
-		if (0 == error)
-		{
-			errorType = ErrorType::Success;
-		}
-		else if (ctsIoPattern::IsProtocolError(error))
-		{
-			errorType = ErrorType::ProtocolError;
-		}
-		else
-		{
-			errorType = ErrorType::NetworkError;
-		}
-
-		const int64_t totalTime = stats.m_endTime.GetValue() - stats.m_startTime.GetValue();
-		FAIL_FAST_IF_MSG(
-			totalTime < 0LL,
-			"end_time is less than start_time in this ctsTcpStatistics object (%p)", &stats);
-		const float currentTime = GetStatusTimeStamp();
-
-		wstring csvString;
-		wstring textString;
-		wstring errorString;
-		if (ErrorType::ProtocolError != errorType)
-		{
-			if (0 == error)
-			{
-				errorString = L"Succeeded";
-			}
-			else
-			{
-				errorString = wil::str_printf<std::wstring>(
-					L"%lu: %ws",
-					error,
-					ctString::format_message(error).c_str());
-				// remove any commas from the formatted string - since that will mess up csv files
-				ctString::replace_all(errorString, L",", L" ");
-			}
-		}
-
-		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
-		{
-			wil::network::socket_address_wstring wsaLocalAddress{};
-			localAddr.format_complete_address_nothrow(wsaLocalAddress);
-			wil::network::socket_address_wstring wsaRemoteAddress{};
-			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
-
-			// csv format : L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId"
-			static const auto* tcpResultCsvFormat = L"%.3f,%ws,%ws,%lld,%lld,%lld,%lld,%lld,%ws,%hs\r\n";
-			csvString = wil::str_printf<std::wstring>(
-				tcpResultCsvFormat,
-				currentTime,
-				wsaLocalAddress,
-				wsaRemoteAddress,
-				stats.m_bytesSent.GetValue(),
-				totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
-				stats.m_bytesRecv.GetValue(),
-				totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
-				totalTime,
-				ErrorType::ProtocolError == errorType
-				? ctsIoPattern::BuildProtocolErrorString(error)
-				: errorString.c_str(),
-				stats.m_connectionIdentifier);
-		}
-		// we'll never write csv format to the console, so we'll need a text string in that case
-		// - and/or in the case the g_ConnectionLogger isn't writing to csv
-		if (writeToConsole || (g_connectionLogger && !g_connectionLogger->IsCsvFormat()))
-		{
-			wil::network::socket_address_wstring wsaLocalAddress{};
-			localAddr.format_complete_address_nothrow(wsaLocalAddress);
-			wil::network::socket_address_wstring wsaRemoteAddress{};
-			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
-
-			if (0 == error)
-			{
-				static const auto* tcpSuccessfulResultTextFormat =
-					L"[%.3f] TCP connection succeeded : [%ws - %ws] [%hs]: SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
-				textString = wil::str_printf<std::wstring>(
-					tcpSuccessfulResultTextFormat,
-					currentTime,
-					wsaLocalAddress,
-					wsaRemoteAddress,
-					stats.m_connectionIdentifier,
-					stats.m_bytesSent.GetValue(),
-					totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
-					stats.m_bytesRecv.GetValue(),
-					totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
-					totalTime);
-			}
-			else
-			{
-				static const auto* tcpProtocolFailureResultTextFormat =
-					L"[%.3f] TCP connection failed with the protocol error %ws : [%ws - %ws] [%hs] : SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
-				static const auto* tcpNetworkFailureResultTextFormat =
-					L"[%.3f] TCP connection failed with the error %ws : [%ws - %ws] [%hs] : SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
-				textString = wil::str_printf<std::wstring>(
-					ErrorType::ProtocolError == errorType
-					? tcpProtocolFailureResultTextFormat
-					: tcpNetworkFailureResultTextFormat,
-					currentTime,
-					ErrorType::ProtocolError == errorType
-					? ctsIoPattern::BuildProtocolErrorString(error)
-					: errorString.c_str(),
-					wsaLocalAddress,
-					wsaRemoteAddress,
-					stats.m_connectionIdentifier,
-					stats.m_bytesSent.GetValue(),
-					totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
-					stats.m_bytesRecv.GetValue(),
-					totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
-					totalTime);
-			}
-		}
-
-		if (writeToConsole)
-		{
-			// text strings always go to the console
-			(void)fwprintf_s(stdout, L"%ws\n", textString.c_str());
-		}
-
-		if (g_connectionLogger)
-		{
-			if (g_connectionLogger->IsCsvFormat())
-			{
-				g_connectionLogger->LogMessage(csvString.c_str());
-			}
-			else
-			{
-				g_connectionLogger->LogMessage(
-					wil::str_printf<std::wstring>(L"%ws\r\n", textString.c_str()).c_str());
-			}
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void PrintConnectionResults(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, uint32_t error,
-		const ctsUdpStatistics& stats) noexcept try
-	{
-		ctsConfigInitOnce();
-
-		// write even after shutdown so can print the final summaries
-		// except for a rude exit - not printing connection summaries after a rude exit is triggered
-		if (g_processStatus == ExitProcessType::Rude)
-		{
-			return;
-		}
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-			// case 1: // status updates
-			// case 2: // error info + status updates
-		case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		{
-			writeToConsole = true;
-		}
-		}
-
-		if (!writeToConsole && !g_connectionLogger)
-		{
-			return;
-		}
-
-		enum class ErrorType : std::uint8_t
-		{
-			Success,
-			NetworkError,
-			ProtocolError
-		} errorType{};
-
-		if (0 == error)
-		{
-			errorType = ErrorType::Success;
-		}
-		else if (ctsIoPattern::IsProtocolError(error))
-		{
-			errorType = ErrorType::ProtocolError;
-		}
-		else
-		{
-			errorType = ErrorType::NetworkError;
-		}
-
-		const float currentTime = GetStatusTimeStamp();
-		// the connection has ended - no locks needed
-		const int64_t elapsedTime(stats.m_endTime.GetValue() - stats.m_startTime.GetValue());
-		const int64_t bitsPerSecond = elapsedTime > 0LL ? stats.m_bitsReceived.GetValue() * 1000LL / elapsedTime : 0LL;
-
-		wstring csvString;
-		wstring textString;
-		wstring errorString;
-		if (ErrorType::ProtocolError != errorType)
-		{
-			if (0 == error)
-			{
-				errorString = L"Succeeded";
-			}
-			else
-			{
-				errorString = wil::str_printf<std::wstring>(
-					L"%lu: %ws",
-					error,
-					ctString::format_message(error).c_str());
-				// remove any commas from the formatted string - since that will mess up csv files
-				ctString::replace_all(errorString, L",", L" ");
-			}
-		}
-
-		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
-		{
-			wil::network::socket_address_wstring wsaLocalAddress{};
-			localAddr.format_complete_address_nothrow(wsaLocalAddress);
-			wil::network::socket_address_wstring wsaRemoteAddress{};
-			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
-
-			// csv format : "TimeSlice,LocalAddress,RemoteAddress,Bits/Sec,Completed,Dropped,Repeated,Errors,Result,ConnectionId"
-			static const auto* udpResultCsvFormat = L"%.3f,%ws,%ws,%llu,%llu,%llu,%llu,%llu,%ws,%hs\r\n";
-			csvString = wil::str_printf<std::wstring>(
-				udpResultCsvFormat,
-				currentTime,
-				wsaLocalAddress,
-				wsaRemoteAddress,
-				bitsPerSecond,
-				stats.m_successfulFrames.GetValue(),
-				stats.m_droppedFrames.GetValue(),
-				stats.m_duplicateFrames.GetValue(),
-				stats.m_errorFrames.GetValue(),
-				ErrorType::ProtocolError == errorType
-				? ctsIoPattern::BuildProtocolErrorString(error)
-				: errorString.c_str(),
-				stats.m_connectionIdentifier);
-		}
-		// we'll never write csv format to the console, so we'll need a text string in that case
-		// - and/or in the case the g_ConnectionLogger isn't writing to csv
-		if (writeToConsole || g_connectionLogger && !g_connectionLogger->IsCsvFormat())
-		{
-			wil::network::socket_address_wstring wsaLocalAddress{};
-			localAddr.format_complete_address_nothrow(wsaLocalAddress);
-			wil::network::socket_address_wstring wsaRemoteAddress{};
-			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
-
-			if (0 == error)
-			{
-				static const auto* udpSuccessfulResultTextFormat =
-					L"[%.3f] UDP connection succeeded : [%ws - %ws] [%hs] : BitsPerSecond [%llu]  Completed [%llu]  Dropped [%llu]  Repeated [%llu]  Errors [%llu]";
-				textString = wil::str_printf<std::wstring>(
-					udpSuccessfulResultTextFormat,
-					currentTime,
-					wsaLocalAddress,
-					wsaRemoteAddress,
-					stats.m_connectionIdentifier,
-					bitsPerSecond,
-					stats.m_successfulFrames.GetValue(),
-					stats.m_droppedFrames.GetValue(),
-					stats.m_duplicateFrames.GetValue(),
-					stats.m_errorFrames.GetValue());
-			}
-			else
-			{
-				static const auto* udpProtocolFailureResultTextFormat =
-					L"[%.3f] UDP connection failed with the protocol error %ws : [%ws - %ws] [%hs] : BitsPerSecond [%llu]  Completed [%llu]  Dropped [%llu]  Repeated [%llu]  Errors [%llu]";
-				static const auto* udpNetworkFailureResultTextFormat =
-					L"[%.3f] UDP connection failed with the error %ws : [%ws - %ws] [%hs] : BitsPerSecond [%llu]  Completed [%llu]  Dropped [%llu]  Repeated [%llu]  Errors [%llu]";
-				textString = wil::str_printf<std::wstring>(
-					ErrorType::ProtocolError == errorType
-					? udpProtocolFailureResultTextFormat
-					: udpNetworkFailureResultTextFormat,
-					currentTime,
-					ErrorType::ProtocolError == errorType
-					? ctsIoPattern::BuildProtocolErrorString(error)
-					: errorString.c_str(),
-					wsaLocalAddress,
-					wsaRemoteAddress,
-					stats.m_connectionIdentifier,
-					bitsPerSecond,
-					stats.m_successfulFrames.GetValue(),
-					stats.m_droppedFrames.GetValue(),
-					stats.m_duplicateFrames.GetValue(),
-					stats.m_errorFrames.GetValue());
-			}
-		}
-
-		if (writeToConsole)
-		{
-			// text strings always go to the console
-			(void)fwprintf_s(stdout, L"%ws\n", textString.c_str());
-		}
-
-		if (g_connectionLogger)
-		{
-			if (g_connectionLogger->IsCsvFormat())
-			{
-				g_connectionLogger->LogMessage(csvString.c_str());
-			}
-			else
-			{
-				g_connectionLogger->LogMessage(
-					wil::str_printf<std::wstring>(L"%ws\r\n", textString.c_str()).c_str());
-			}
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void PrintTcpDetails(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, SOCKET socket,
-		const ctsTcpStatistics& stats) noexcept try
-	{
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		if (g_tcpInfoLogger)
-		{
-			wil::network::socket_address_wstring wsaLocalAddress{};
-			localAddr.format_complete_address_nothrow(wsaLocalAddress);
-			wil::network::socket_address_wstring wsaRemoteAddress{};
-			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
-
-			static const auto* tcpSuccessfulResultTextFormat = L"%.3f, %ws, %ws, %hs, %lld, %lld, %lld, %lld, %lld, ";
-			const int64_t totalTime{ stats.m_endTime.GetValue() - stats.m_startTime.GetValue() };
-			auto textString = wil::str_printf<std::wstring>(
-				tcpSuccessfulResultTextFormat,
-				GetStatusTimeStamp(),
-				wsaLocalAddress,
-				wsaRemoteAddress,
-				stats.m_connectionIdentifier,
-				stats.m_bytesSent.GetValue(),
-				totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
-				stats.m_bytesRecv.GetValue(),
-				totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
-				totalTime);
-
-			DWORD bytesReturned{};
-			TCP_INFO_v1 tcpInfo1{};
-			DWORD tcpInfoVersion = 1;
-			if (WSAIoctl(
-				socket,
-				SIO_TCP_INFO,
-				&tcpInfoVersion, sizeof(tcpInfoVersion),
-				&tcpInfo1, sizeof(tcpInfo1),
-				&bytesReturned,
-				nullptr,
-				nullptr) == 0)
-			{
-				// the OS supports TCP_INFO_v1 - write those details
-				static const auto* tcpInfoVersion1TextFormat =
-					L"%lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu\r\n";
-				textString += wil::str_printf<std::wstring>(
-					tcpInfoVersion1TextFormat,
-					tcpInfo1.BytesReordered,
-					tcpInfo1.BytesRetrans,
-					tcpInfo1.SynRetrans,
-					tcpInfo1.DupAcksIn,
-					tcpInfo1.MinRttUs,
-					tcpInfo1.Mss,
-					tcpInfo1.TimeoutEpisodes,
-					tcpInfo1.FastRetrans,
-					tcpInfo1.SndLimBytesCwnd,
-					tcpInfo1.SndLimBytesRwin,
-					tcpInfo1.SndLimBytesSnd);
-				g_tcpInfoLogger->LogMessage(textString.c_str());
-				return;
-			}
-
-			TCP_INFO_v0 tcpInfo0{};
-			tcpInfoVersion = 0;
-			if (WSAIoctl(
-				socket,
-				SIO_TCP_INFO,
-				&tcpInfoVersion, sizeof(tcpInfoVersion),
-				&tcpInfo0, sizeof(tcpInfo0),
-				&bytesReturned,
-				nullptr,
-				nullptr) == 0)
-			{
-				// the OS supports TCP_INFO_v0 - write those details
-				static const auto* tcpInfoVersion0TextFormat = L"%lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu";
-				textString += wil::str_printf<std::wstring>(
-					tcpInfoVersion0TextFormat,
-					tcpInfo0.BytesReordered,
-					tcpInfo0.BytesRetrans,
-					tcpInfo0.SynRetrans,
-					tcpInfo0.DupAcksIn,
-					tcpInfo0.MinRttUs,
-					tcpInfo0.Mss,
-					tcpInfo0.TimeoutEpisodes,
-					tcpInfo0.FastRetrans);
-				g_tcpInfoLogger->LogMessage(textString.c_str());
-			}
-		}
-	}
-	catch (...)
-	{
-	}
-
-	void __cdecl PrintSummary(_In_ _Printf_format_string_ PCWSTR text, ...) noexcept
-	{
-		ctsConfigInitOnce();
-
-		// always write the summary, regardless of consoleVerbosity
-
-		va_list argptr;
-		va_start(argptr, text);
-		try
-		{
-			wstring formattedString;
-			wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr);
-			(void)fwprintf_s(stdout, L"%ws", formattedString.c_str());
-
-			if (g_connectionLogger && !g_connectionLogger->IsCsvFormat())
-			{
-				if (formattedString.empty())
-				{
-					wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr);
-				}
-				g_connectionLogger->LogMessage(
-					ctString::replace_all_copy(formattedString, L"\n", L"\r\n").c_str());
-			}
-		}
-		catch (...)
-		{
-		}
-		va_end(argptr);
-	}
-
-	void PrintErrorInfo(_In_ _Printf_format_string_ PCWSTR text, ...) noexcept
-	{
-		ctsConfigInitOnce();
-
-		if (g_processStatus != ExitProcessType::Running)
-		{
-			return;
-		}
-
-		if (g_breakOnError)
-		{
-			FAIL_FAST_MSG("%ws", text);
-		}
-
-		auto writeToConsole = false;
-		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
-		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
-		{
-			// case 0: // nothing
-			// case 1: // status updates
-		case 2: // error info + status updates
-			// case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-			writeToConsole = true;
-			break;
-		}
-
-		va_list argptr;
-		va_start(argptr, text);
-		try
-		{
-			std::wstring formattedString;
-			if (writeToConsole)
-			{
-				if (SUCCEEDED(wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr)))
-				{
-					(void)fwprintf_s(stdout, L"%ws\n", formattedString.c_str());
-				}
-			}
-
-			if (g_errorLogger && !g_errorLogger->IsCsvFormat())
-			{
-				if (formattedString.empty())
-				{
-					wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr);
-				}
-
-				if (!formattedString.empty())
-				{
-					g_errorLogger->LogError(
-						wil::str_printf<std::wstring>(
-							L"[%.3f] %ws\r\n",
-							GetStatusTimeStamp(),
-							formattedString.c_str()).c_str());
-				}
-			}
-		}
-		catch (...)
-		{
-		}
-		va_end(argptr);
-	}
-
-	//
-	// Get* 
-	// - accessor functions made public to retrieve configuration details
-	//
-	uint32_t GetBufferSize() noexcept
-	{
-		ctsConfigInitOnce();
-
-		return 0 == g_bufferSizeHigh ? g_bufferSizeLow : g_randomTwister.uniform_int(g_bufferSizeLow, g_bufferSizeHigh);
-	}
-
-	uint32_t GetMaxBufferSize() noexcept
-	{
-		ctsConfigInitOnce();
-
-		return g_bufferSizeHigh == 0 ? g_bufferSizeLow : g_bufferSizeHigh;
-	}
-
-	uint32_t GetMinBufferSize() noexcept
-	{
-		ctsConfigInitOnce();
-
-		return g_bufferSizeLow;
-	}
-
-	uint64_t GetTransferSize() noexcept
-	{
-		ctsConfigInitOnce();
-
-		return 0 == g_transferSizeHigh
-			? g_transferSizeLow
-			: g_randomTwister.uniform_int(g_transferSizeLow, g_transferSizeHigh);
-	}
-
-	int64_t GetTcpBytesPerSecond() noexcept
-	{
-		ctsConfigInitOnce();
-
-		return 0 == g_rateLimitHigh ? g_rateLimitLow : g_randomTwister.uniform_int(g_rateLimitLow, g_rateLimitHigh);
-	}
-
-	int GetListenBacklog() noexcept
-	{
-		ctsConfigInitOnce();
-
-		auto backlog = SOMAXCONN;
-		// Starting in Win8 listen() supports a larger backlog
-		if (static_cast<bool>(g_configSettings->rioFunctions))
-		{
-			backlog = SOMAXCONN_HINT(SOMAXCONN);
-		}
-		return backlog;
-	}
-
-	TcpShutdownType GetShutdownType() noexcept
-	{
-		if (g_configSettings->TcpShutdown != TcpShutdownType::Random)
-		{
-			return g_configSettings->TcpShutdown;
-		}
-
-		const auto randomValue = g_randomTwister.uniform_int(0, 1);
-		return (randomValue == 0) ? TcpShutdownType::GracefulShutdown : TcpShutdownType::HardShutdown;
-	}
-
-	const MediaStreamSettings& GetMediaStream() noexcept
-	{
-		ctsConfigInitOnce();
-
-		FAIL_FAST_IF_MSG(
-			0 == g_mediaStreamSettings.BitsPerSecond,
-			"Internally requesting media stream settings when this was not specified by the user");
-
-		return g_mediaStreamSettings;
-	}
-
-	bool IsListening() noexcept
-	{
-		ctsConfigInitOnce();
-
-		return !g_configSettings->ListenAddresses.empty();
-	}
-
-	float GetStatusTimeStamp() noexcept
-	{
-		return static_cast<float>(ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds) / 1000.0f;
-	}
-
-	uint32_t GetShardCount() noexcept
-	{
-		auto shardCount = static_cast<int>(g_configSettings->ShardCount);
-		if (shardCount == 0) {
-			const auto info = QueryCpuAffinitySupport();
-			const uint32_t logical = info.LogicalProcessorCount ? info.LogicalProcessorCount : 1u;
-			shardCount = static_cast<int>(logical);
-		}
-		return shardCount;
-	}
-
-	// Translate from ctsConfig::g_configSettings->ShardAffinityPolicy to ctl::CpuAffinityPolicy
-	CpuAffinityPolicy GetCpuAffinityPolicy() noexcept
-	{
-		CpuAffinityPolicy affinityPolicy = CpuAffinityPolicy::PerCpu;
-		switch (g_configSettings->ShardAffinityPolicy)
-		{
-		case AffinityPolicy::PerCpu:
-			affinityPolicy = CpuAffinityPolicy::PerCpu;
-			break;
-		case AffinityPolicy::PerGroup:
-			affinityPolicy = CpuAffinityPolicy::PerGroup;
-			break;
-		case AffinityPolicy::RssAligned:
-			affinityPolicy = CpuAffinityPolicy::RssAligned;
-			break;
-		case AffinityPolicy::Manual:
-			affinityPolicy = CpuAffinityPolicy::Manual;
-			break;
-		default:
-			affinityPolicy = CpuAffinityPolicy::PerCpu;
-			break;
-		}
-		return affinityPolicy;
-	}
-
-	//
-	// Set*Options
-	// - functions capturing any options that need to be set on a socket across different states
-	// - currently only implementing pre-bind options
-	//
-	bool SetProcessDefaultCpuSets()
-	{
-		// default to CPU set zero
-		uint32_t settingsGroupId = 0;
-		if (g_configSettings->CpuGroupId.has_value())
-		{
-			settingsGroupId = g_configSettings->CpuGroupId.value();
-		}
-		PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: trying to find CPUs on Group %u\n", settingsGroupId);
-
-		using pfn_SetProcessDefaultCpuSets = BOOL(__stdcall*)(
-			HANDLE Process,
-			_In_reads_(CpuSetIdCount) const DWORD* CpuSetIds,
-			DWORD CpuSetIdCount);
-
-		using pfn_GetSystemCpuSetInformation = BOOL(__stdcall*)(
-			PSYSTEM_CPU_SET_INFORMATION Info,
-			ULONG Length,
-			PULONG ReturnLength,
-			PVOID SystemInformation,
-			ULONG SystemInformationLength);
-
-		// deliberately "leaking" this module handle - we want it loaded the lifetime of the process
-		auto* const hMod = LoadLibraryEx(L"kernel32.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
-		if (!hMod)
-		{
-			const auto gle = GetLastError();
-			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: LoadLibraryEx failed to load kernel32.dll: %lu\n", gle);
-			return false;
-		}
-
-		const auto pfnSetProcessDefaultCpuSets = reinterpret_cast<pfn_SetProcessDefaultCpuSets>(
-			GetProcAddress(hMod, "SetProcessDefaultCpuSets"));
-		const auto pfnGetSystemCpuSetInformation = reinterpret_cast<pfn_GetSystemCpuSetInformation>(
-			GetProcAddress(hMod, "GetSystemCpuSetInformation"));
-		if (!pfnSetProcessDefaultCpuSets || !pfnGetSystemCpuSetInformation)
-		{
-			const auto gle = GetLastError();
-			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: GetProcAddress failed to load CpuSet functions: %lu\n", gle);
-			return false;
-		}
-
-		ULONG returnedLength = 0;
-		pfnGetSystemCpuSetInformation(nullptr, 0, &returnedLength, nullptr, 0);
-		if (returnedLength == 0)
-		{
-			// the API should have given us the length - something failed
-			const auto gle = GetLastError();
-			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: GetSystemCpuSetInformation failed to get the length required: %lu\n", gle);
-			return false;
-		}
-
-		const std::unique_ptr<BYTE[]> buffer(new BYTE[returnedLength]);
-		if (!pfnGetSystemCpuSetInformation(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.get()), returnedLength,
-			&returnedLength, nullptr, 0))
-		{
-			const auto gle = GetLastError();
-			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: GetSystemCpuSetInformation failed: %lu\n", gle);
-			return false;
-		}
-
-		std::vector<DWORD> cpuSetIdsOnCpuGroupZero;
-
-		PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: SYSTEM_CPU_SET_INFORMATION\n");
-		PRINT_DEBUG_INFO(
-			L"Id\t\tGroup\t\tLogicalProcessorIndex\t\tCoreIndex\tNumaNodeIndex\n");
-
-		void* current_buffer = buffer.get();
-		const void* end_of_buffer = buffer.get() + returnedLength;
-		while (current_buffer < end_of_buffer)
-		{
-			const SYSTEM_CPU_SET_INFORMATION* cpu_set_info = static_cast<PSYSTEM_CPU_SET_INFORMATION>(current_buffer);
-			PRINT_DEBUG_INFO(
-				L"Id: %lu\t\t"
-				L"Group: %d\t"
-				L"LogicalProcessorIndex: %d\t"
-				L"CoreIndex:%d\t"
-				L"NumaNodeIndex: %d\n",
-				cpu_set_info->CpuSet.Id,
-				cpu_set_info->CpuSet.Group,
-				cpu_set_info->CpuSet.LogicalProcessorIndex,
-				cpu_set_info->CpuSet.CoreIndex,
-				cpu_set_info->CpuSet.NumaNodeIndex);
-
-			if (cpu_set_info->CpuSet.Group == settingsGroupId)
-			{
-				cpuSetIdsOnCpuGroupZero.push_back(cpu_set_info->CpuSet.Id);
-			}
-
-			current_buffer = static_cast<BYTE*>(current_buffer) + cpu_set_info->Size;
-		}
-
-		if (cpuSetIdsOnCpuGroupZero.empty())
-		{
-			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: No CPU IDs found on Group %u\n", settingsGroupId);
-			return false;
-		}
-
-		if (!pfnSetProcessDefaultCpuSets(
-			GetCurrentProcess(),
-			cpuSetIdsOnCpuGroupZero.data(),
-			static_cast<DWORD>(cpuSetIdsOnCpuGroupZero.size())))
-		{
-			const auto gle = GetLastError();
-			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: SetProcessDefaultCpuSets failed: %lu\n", gle);
-			return false;
-		}
-
-		PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: SetProcessDefaultCpuSets set process affinity to all CPU IDs in Group %u\n", settingsGroupId);
-		return true;
-	}
-
-	//
-	// Set*Options
-	// - functions capturing any options that need to be set on a socket across different states
-	// - currently only implementing pre-bind options
-	//
-	int SetPreBindOptions(SOCKET socket, const wil::network::socket_address& localAddress) noexcept
-	{
-		ctsConfigInitOnce();
-
-		if (g_configSettings->OutgoingIfIndex > 0)
-		{
-			constexpr int optLength{ sizeof(g_configSettings->OutgoingIfIndex) };
-
-			if (localAddress.family() == AF_INET)
-			{
-				// Interface index is in network byte order for IPPROTO_IP.
-				const DWORD optionValue = htonl(g_configSettings->OutgoingIfIndex);
-				if (setsockopt(
-					socket,
-					IPPROTO_IP, // level
-					IP_UNICAST_IF,
-					reinterpret_cast<const char*>(&optionValue),
-					optLength) != 0)
-				{
-					const auto gle = WSAGetLastError();
-					PrintErrorIfFailed("setsockopt(IP_UNICAST_IF)", gle);
-					return gle;
-				}
-			}
-			else
-			{
-				// Interface index is in host byte order for IPPROTO_IPV6.
-				if (setsockopt(
-					socket,
-					IPPROTO_IPV6, // level
-					IPV6_UNICAST_IF,
-					reinterpret_cast<const char*>(&g_configSettings->OutgoingIfIndex),
-					optLength) != 0)
-				{
-					const auto gle = WSAGetLastError();
-					PrintErrorIfFailed("setsockopt(IPV6_UNICAST_IF)", gle);
-					return gle;
-				}
-			}
-		}
-
-		//
-		// if the user specified bind addresses, enable SO_PORT_SCALABILITY
-		// - this will allow each unique IP address the full range of ephemeral ports
-		// this option is not available when just binding to INET_ANY (making an ephemeral bind)
-		// this option is also not used if the user is binding to an explicit port #
-		// - since the port scalability rules no longer apply
-		//
-		// these only are applicable for outgoing connections
-		//
-		if (ProtocolType::TCP == g_configSettings->Protocol && !IsListening())
-		{
-			if (g_configSettings->Options & ReuseUnicastPort)
-			{
-				// the admin configured the system to use this socket option
-				// it is not compatible with SO_PORT_SCALABILITY
-				constexpr DWORD optValue{ 1 }; // BOOL
-				constexpr int optLength{ sizeof(optValue) };
-#ifndef SO_REUSE_UNICASTPORT
-#define SO_REUSE_UNICASTPORT (SO_PORT_SCALABILITY + 1)
-#endif
-				if (setsockopt(
-					socket,
-					SOL_SOCKET, // level
-					SO_REUSE_UNICASTPORT,
-					reinterpret_cast<const char*>(&optValue),
-					optLength) != 0)
-				{
-					const auto gle = WSAGetLastError();
-					PrintErrorIfFailed("setsockopt(SO_REUSE_UNICASTPORT)", gle);
-					return gle;
-				}
-			}
-			else if (localAddress.address_type() != NlatUnspecified && localAddress.port() == 0)
-			{
-				constexpr DWORD optValue{ 1 }; // BOOL
-				constexpr int optLength{ sizeof(optValue) };
-
-				if (setsockopt(
-					socket,
-					SOL_SOCKET, // level
-					SO_PORT_SCALABILITY,
-					reinterpret_cast<const char*>(&optValue),
-					optLength) != 0)
-				{
-					const auto gle = WSAGetLastError();
-					PrintErrorIfFailed("setsockopt(SO_PORT_SCALABILITY)", gle);
-					return gle;
-				}
-			}
-		}
-
-		if (g_configSettings->Options & LoopbackFastPath)
-		{
-			DWORD inValue{ 1 };
-			DWORD bytesReturned{};
-
-			if (WSAIoctl(
-				socket,
-				SIO_LOOPBACK_FAST_PATH,
-				&inValue, sizeof(inValue),
-				nullptr, 0,
-				&bytesReturned,
-				nullptr,
-				nullptr) != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("WSAIoctl(SIO_LOOPBACK_FAST_PATH)", gle);
-				return gle;
-			}
-		}
-
-		if (g_configSettings->KeepAliveValue > 0)
-		{
-			tcp_keepalive keepaliveValues{};
-			keepaliveValues.onoff = 1;
-			keepaliveValues.keepalivetime = g_configSettings->KeepAliveValue;
-			keepaliveValues.keepaliveinterval = 1000; // continue to default to 1 second
-
-			DWORD bytesReturned{};
-			if (WSAIoctl(
-				socket,
-				SIO_KEEPALIVE_VALS, // control code
-				&keepaliveValues, sizeof(keepaliveValues), // in params
-				nullptr, 0, // out params
-				&bytesReturned,
-				nullptr,
-				nullptr) != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("WSAIoctl(SIO_KEEPALIVE_VALS)", gle);
-				return gle;
-			}
-		}
-		else if (g_configSettings->Options & KeepAlive)
-		{
-			constexpr DWORD optValue{ 1 };
-			constexpr int optLength{ sizeof(optValue) };
-
-			if (setsockopt(
-				socket,
-				SOL_SOCKET, // level
-				SO_KEEPALIVE,
-				reinterpret_cast<const char*>(&optValue),
-				optLength) != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("setsockopt(SO_KEEPALIVE)", gle);
-				return gle;
-			}
-		}
-
-		if (g_configSettings->Options & SetRecvBuf)
-		{
-			const auto recvBuff = g_configSettings->RecvBufValue;
-			if (setsockopt(
-				socket,
-				SOL_SOCKET,
-				SO_RCVBUF,
-				reinterpret_cast<const char*>(&recvBuff),
-				sizeof(recvBuff)) != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("setsockopt(SO_RCVBUF)", gle);
-				return gle;
-			}
-		}
-
-		if (g_configSettings->Options & SetSendBuf)
-		{
-			const auto sendBuff = g_configSettings->SendBufValue;
-			if (setsockopt(
-				socket,
-				SOL_SOCKET,
-				SO_SNDBUF,
-				reinterpret_cast<const char*>(&sendBuff),
-				sizeof(sendBuff)) != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("setsockopt(SO_SNDBUF)", gle);
-				return gle;
-			}
-		}
-
-		if (g_configSettings->Options & NonBlockingIo)
-		{
-			u_long enableNonBlocking = 1;
-			if (ioctlsocket(socket, FIONBIO, &enableNonBlocking) != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("ioctlsocket(FIONBIO)", gle);
-				return gle;
-			}
-		}
-
-		if (g_configSettings->Options & EnableCircularQueueing)
-		{
-			DWORD bytesReturned{};
-			const auto error = WSAIoctl(
-				socket,
-				SIO_ENABLE_CIRCULAR_QUEUEING,
-				nullptr, 0, // in buffer
-				nullptr, 0, // out buffer
-				&bytesReturned,
-				nullptr,
-				nullptr);
-			if (error != 0)
-			{
-				const auto gle = WSAGetLastError();
-				PrintErrorIfFailed("WSAIoctl(SIO_ENABLE_CIRCULAR_QUEUEING)", gle);
-				return gle;
-			}
-		}
-
-		if (g_configSettings->Options & HandleInlineIocp)
-		{
-
-			if (!SetFileCompletionNotificationModes(
-				reinterpret_cast<HANDLE>(socket), // NOLINT(performance-no-int-to-ptr)
-				FILE_SKIP_COMPLETION_PORT_ON_SUCCESS))
-			{
-				const auto gle = GetLastError();
-				PrintErrorIfFailed("SetFileCompletionNotificationModes(FILE_SKIP_COMPLETION_PORT_ON_SUCCESS)", gle);
-				return static_cast<int>(gle);
-			}
-		}
-
-		return NO_ERROR;
-	}
-
-	////////////////////////////////////////////////////////////////////////////////////////////////////
-	///
-	/// SetPostConnectOptions
-	/// - functions capturing any options that need to be set once connected
-	///
-	////////////////////////////////////////////////////////////////////////////////////////////////////
-	int SetPostConnectOptions(SOCKET socket, const wil::network::socket_address& remoteAddress) noexcept
-	{
-		ctsConfigInitOnce();
-
-		if (g_qosHandle)
-		{
-			// attempt to assign the DSCP value to this socket
-			auto destinationAddress{ remoteAddress };
-
-			QOS_FLOWID flowID{ 0 };
-			if (!QOSAddSocketToFlow(
-				g_qosHandle,
-				socket,
-				destinationAddress.sockaddr(),
-				QOSTrafficTypeBestEffort,
-				0,
-				&flowID))
-			{
-				const auto gle = GetLastError();
-				PrintErrorIfFailed("QOSAddSocketToFlow(QOSTrafficTypeBestEffort)", gle);
-			}
-			else
-			{
-				if (!QOSSetFlow(
-					g_qosHandle,
-					flowID,
-					QOSSetOutgoingDSCPValue,
-					sizeof(DWORD),
-					&g_qosDscpValue,
-					0,
-					nullptr))
-				{
-					const auto gle = GetLastError();
-					PrintErrorIfFailed("QOSSetFlow(QOSSetOutgoingDSCPValue)", gle);
-				}
-			}
-		}
-
-		return NO_ERROR;
-	}
-
-	//
-	// PrintSettings
-	// - public function to write out to the console applied settings
-	//
-	void PrintSettings()
-	{
-		ctsConfigInitOnce();
-
-		wstring settingString(
-			L"  Configured Settings  \n"
-			L"-----------------------\n");
-
-		settingString.append(L"\tProtocol: ");
-		switch (g_configSettings->Protocol)
-		{
-		case ProtocolType::TCP:
-			settingString.append(L"TCP");
-			break;
-		case ProtocolType::UDP:
-			settingString.append(L"UDP");
-			break;
-
-		case ProtocolType::NoProtocolSet:
-			[[fallthrough]];
-		default:
-			FAIL_FAST_MSG("Unexpected Settings Protocol");
-		}
-		settingString.append(L"\n");
-
-		settingString.append(L"\tOptions:");
-		if (NoOptionSet == g_configSettings->Options)
-		{
-			settingString.append(L" None");
-		}
-		else
-		{
-			if (g_configSettings->Options & LoopbackFastPath)
-			{
-				settingString.append(L" TCPFastPath");
-			}
-			if (g_configSettings->KeepAliveValue > 0)
-			{
-				settingString.append(L" KeepAlive (");
-				settingString.append(std::to_wstring(g_configSettings->KeepAliveValue));
-				settingString.append(L")");
-			}
-			else if (g_configSettings->Options & KeepAlive)
-			{
-				settingString.append(L" KeepAlive");
-			}
-			if (g_configSettings->Options & NonBlockingIo)
-			{
-				settingString.append(L" NonBlockingIO");
-			}
-			if (g_configSettings->Options & HandleInlineIocp)
-			{
-				settingString.append(L" InlineIOCP");
-			}
-			if (g_configSettings->Options & ReuseUnicastPort)
-			{
-				settingString.append(L" ReuseUnicastPort");
-			}
-			if (g_configSettings->Options & PortScalability)
-			{
-				settingString.append(L" PortScalability");
-			}
-			if (g_configSettings->Options & SetRecvBuf)
-			{
-				settingString.append(wil::str_printf<std::wstring>(L" SO_RCVBUF(%lu)", g_configSettings->RecvBufValue));
-			}
-			if (g_configSettings->Options & SetSendBuf)
-			{
-				settingString.append(wil::str_printf<std::wstring>(L" SO_SNDBUF(%lu)", g_configSettings->SendBufValue));
-			}
-			if (g_configSettings->Options & MsgWaitAll)
-			{
-				settingString.append(L" MsgWaitAll");
-			}
-		}
-		settingString.append(L"\n");
-
-		settingString.append(wil::str_printf<std::wstring>(L"\tIO function: %ws\n", g_ioFunctionName));
-
-		settingString.append(L"\tIoPattern: ");
-		switch (g_configSettings->IoPattern)
-		{
-		case IoPatternType::Pull:
-			settingString.append(L"Pull <TCP client recv/server send>\n");
-			break;
-		case IoPatternType::Push:
-			settingString.append(L"Push <TCP client send/server recv>\n");
-			break;
-		case IoPatternType::PushPull:
-			settingString.append(L"PushPull <TCP client/server alternate send/recv>\n");
-			settingString.append(wil::str_printf<std::wstring>(L"\t\tPushBytes: %lu\n", g_configSettings->PushBytes));
-			settingString.append(wil::str_printf<std::wstring>(L"\t\tPullBytes: %lu\n", g_configSettings->PullBytes));
-			break;
-		case IoPatternType::Duplex:
-			settingString.append(L"Duplex <TCP client/server both sending and receiving>\n");
-			break;
-		case IoPatternType::MediaStream:
-			settingString.append(L"MediaStream <UDP controlled stream from server to client>\n");
-			break;
-
-		case IoPatternType::NoIoSet:
-			[[fallthrough]];
-		default:
-			FAIL_FAST_MSG("Unexpected Settings IoPattern");
-		}
-
-		settingString.append(wil::str_printf<std::wstring>(L"\tPrePostRecvs: %u\n", g_configSettings->PrePostRecvs));
-
-		if (g_configSettings->PrePostSends > 0)
-		{
-			settingString.
-				append(wil::str_printf<std::wstring>(L"\tPrePostSends: %u\n", g_configSettings->PrePostSends));
-		}
-		else
-		{
-			settingString.append(wil::str_printf<std::wstring>(L"\tPrePostSends: Following Ideal Send Backlog\n"));
-		}
-
-		settingString.append(
-			wil::str_printf<std::wstring>(
-				L"\tLevel of verification: %ws\n",
-				g_configSettings->ShouldVerifyBuffers ? L"Connections & Data" : L"Connections"));
-
-		settingString.append(wil::str_printf<std::wstring>(L"\tPort: %u\n", g_configSettings->Port));
-
-		if (0 == g_bufferSizeHigh)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tBuffer used for each IO request: %u [0x%lx] bytes\n",
-					g_bufferSizeLow, g_bufferSizeLow));
-		}
-		else
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tBuffer used for each IO request: [%u, %u] bytes\n",
-					g_bufferSizeLow, g_bufferSizeHigh));
-		}
-
-		if (0 == g_transferSizeHigh)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tTotal transfer per connection: %llu bytes\n",
-					g_transferSizeLow));
-		}
-		else
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tTotal transfer per connection: [%llu, %llu] bytes\n",
-					g_transferSizeLow, g_transferSizeHigh));
-		}
-
-		if (ProtocolType::UDP == g_configSettings->Protocol)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\t\tUDP Stream BitsPerSecond: %lld bits per second\n",
-					g_mediaStreamSettings.BitsPerSecond));
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\t\tUDP Stream FrameRate: %lu frames per second\n",
-					g_mediaStreamSettings.FramesPerSecond));
-
-			if (g_mediaStreamSettings.BufferDepthSeconds > 0)
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\t\tUDP Stream BufferDepth: %lu seconds\n",
-						g_mediaStreamSettings.BufferDepthSeconds));
-			}
-
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\t\tUDP Stream StreamLength: %lu seconds (%lu frames)\n",
-					g_mediaStreamSettings.StreamLengthSeconds,
-					g_mediaStreamSettings.StreamLengthFrames));
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\t\tUDP Stream FrameSize: %lu bytes\n",
-					g_mediaStreamSettings.FrameSizeBytes));
-		}
-
-		if (ProtocolType::TCP == g_configSettings->Protocol && g_rateLimitLow > 0)
-		{
-			if (0 == g_rateLimitHigh)
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tSending throughput rate limited down to %lld bytes/second\n",
-						g_rateLimitLow));
-			}
-			else
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tSending throughput rate limited down to a range of [%lld, %lld] bytes/second\n",
-						g_rateLimitLow, g_rateLimitHigh));
-			}
-		}
-
-		if (g_netAdapterAddresses != nullptr)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tIP Compartment: %u\n", g_compartmentId));
-		}
-
-		if (g_qosHandle)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tSetting QOS DSCP Value: %u\n", g_qosDscpValue));
-		}
-
-		if (!g_configSettings->ListenAddresses.empty())
-		{
-			settingString.append(L"\tAccepting connections on addresses:\n");
-			wil::network::socket_address_wstring address{};
-			for (const auto& addr : g_configSettings->ListenAddresses)
-			{
-				if (SUCCEEDED(addr.format_complete_address_nothrow(address)))
-				{
-					settingString.append(L"\t\t");
-					settingString.append(address);
-					settingString.append(L"\n");
-				}
-			}
-		}
-		else
-		{
-			if (g_configSettings->OutgoingIfIndex > 0)
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tInterfaceIndex: %u\n", g_configSettings->OutgoingIfIndex));
-			}
-
-			settingString.append(L"\tConnecting out to addresses:\n");
-			wil::network::socket_address_wstring address{};
-			for (const auto& addr : g_configSettings->TargetAddresses)
-			{
-				if (SUCCEEDED(addr.format_complete_address_nothrow(address)))
-				{
-					settingString.append(L"\t\t");
-					settingString.append(address);
-					settingString.append(L"\n");
-				}
-			}
-
-			settingString.append(L"\tBinding to local addresses for outgoing connections:\n");
-			for (const auto& addr : g_configSettings->BindAddresses)
-			{
-				if (SUCCEEDED(addr.format_complete_address_nothrow(address)))
-				{
-					settingString.append(L"\t\t");
-					settingString.append(address);
-					settingString.append(L"\n");
-				}
-			}
-
-			if (g_configSettings->LocalPortLow != 0)
-			{
-				if (0 == g_configSettings->LocalPortHigh)
-				{
-					settingString.append(
-						wil::str_printf<std::wstring>(
-							L"\tUsing local port for outgoing connections: %u\n",
-							g_configSettings->LocalPortLow));
-				}
-				else
-				{
-					settingString.append(
-						wil::str_printf<std::wstring>(
-							L"\tUsing local port for outgoing connections: [%u, %u]\n",
-							g_configSettings->LocalPortLow, g_configSettings->LocalPortHigh));
-				}
-			}
-
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tConnection limit (maximum established connections): %u [0x%lx]\n",
-					g_configSettings->ConnectionLimit,
-					g_configSettings->ConnectionLimit));
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tConnection throttling rate (maximum pended connection attempts): %u [0x%lx]\n",
-					g_configSettings->ConnectionThrottleLimit,
-					g_configSettings->ConnectionThrottleLimit));
-		}
-		// calculate total connections
-		if (g_configSettings->AcceptFunction)
-		{
-			if (g_configSettings->ServerExitLimit > MAXLONG)
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tServer-accepted connections before exit : 0x%llx\n",
-						g_configSettings->ServerExitLimit));
-			}
-			else
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tServer-accepted connections before exit : %llu [0x%llx]\n",
-						g_configSettings->ServerExitLimit,
-						g_configSettings->ServerExitLimit));
-			}
-		}
-		else
-		{
-			uint64_t totalConnections{};
-			if (g_configSettings->Iterations == MAXULONGLONG)
-			{
-				totalConnections = MAXULONGLONG;
-			}
-			else
-			{
-				totalConnections = g_configSettings->Iterations * g_configSettings->ConnectionLimit;
-			}
-			if (totalConnections > MAXLONG)
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tTotal outgoing connections before exit (iterations * concurrent connections) : 0x%llx\n",
-						totalConnections));
-			}
-			else
-			{
-				settingString.append(
-					wil::str_printf<std::wstring>(
-						L"\tTotal outgoing connections before exit (iterations * concurrent connections) : %llu [0x%llx]\n",
-						totalConnections,
-						totalConnections));
-			}
-		}
-
-		if (g_configSettings->CpuGroupId)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tAffinitized to all CPU IDs on CPU Group %lu\n",
-					g_configSettings->CpuGroupId.value()));
-		}
-
-		if (g_configSettings->EnableRecvSharding)
-		{
-			settingString.append(
-				wil::str_printf<std::wstring>(
-					L"\tReceive sharding is enabled (will affinitize receives to RSS)\n"
-					L"\t\tShardCount: %u\n"
-					L"\t\tShardWorkerCount: %u\n"
-					L"\t\tShardAffinityPolicy: %u\n"
-					L"\t\tIocpBatchSize: %u\n",
-					g_configSettings->ShardCount,
-					g_configSettings->ShardWorkerCount,
-					static_cast<uint32_t>(g_configSettings->ShardAffinityPolicy),
-					g_configSettings->IocpBatchSize));
-		}
-
-		settingString.append(L"\n");
-
-		// immediately print the legend once we know the status info object
-		switch (g_consoleVerbosity)
-		{
-			// case 0: // nothing
-		case 1: // status updates
-		case 2: // error info + status updates
-		case 3: // connection info
-		case 4: // connection info + error info
-		case 5: // connection info + error info + status updates
-		case 6: // above + debug info
-		default:
-		{
-			(void)fwprintf_s(stdout, L"%ws", settingString.c_str());
-		}
-		}
-
-		// must manually convert all carriage returns to file-friendly carriage return/line feed
-		if (g_connectionLogger && !g_connectionLogger->IsCsvFormat())
-		{
-			g_connectionLogger->LogMessage(
-				ctString::replace_all_copy(settingString, L"\n", L"\r\n").c_str());
-		}
-	}
-
-	SOCKET CreateSocket(int af, int type, int protocol, DWORD dwFlags)
-	{
-		auto oldCompartmentId = NET_IF_COMPARTMENT_ID_UNSPECIFIED;
-		auto bCompartmentIdSet = false;
-
-		//
-		// g_netAdapterAddresses is created when the user has requested a CompartmentId
-		// - since we would have had to look up the interface
-		//
-		if (g_netAdapterAddresses != nullptr)
-		{
-			oldCompartmentId = GetCurrentThreadCompartmentId();
-			if (oldCompartmentId != g_compartmentId)
-			{
-				const auto error = SetCurrentThreadCompartmentId(g_compartmentId);
-				if (error != NO_ERROR)
-				{
-					PrintErrorInfo(wil::str_printf<std::wstring>(
-						L"SetCurrentThreadCompartmentId for ID %u failed err %u", g_compartmentId, error).c_str());
-				}
-				else
-				{
-					bCompartmentIdSet = true;
-				}
-			}
-		}
-
-		const auto socket = ::WSASocket(af, type, protocol, nullptr, 0, dwFlags);
-		const auto wsaError = WSAGetLastError();
-
-		if (bCompartmentIdSet)
-		{
-			const auto error = SetCurrentThreadCompartmentId(oldCompartmentId);
-			if (error != NO_ERROR)
-			{
-				PrintErrorInfo(wil::str_printf<std::wstring>(
-					L"SetCurrentThreadCompartmentId for ID %u failed err %u",
-					oldCompartmentId, error).c_str());
-			}
-		}
-
-		if (INVALID_SOCKET == socket)
-		{
-			THROW_WIN32_MSG(wsaError, "WSASocket");
-		}
-
-		return socket;
-	}
-
-	bool ShutdownCalled() noexcept
-	{
-		return g_processStatus != ExitProcessType::Running;
-	}
-
-	uint32_t ConsoleVerbosity() noexcept
-	{
-		return g_consoleVerbosity;
-	}
-} // namespace ctsTraffic
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+// ReSharper disable CppClangTidyCppcoreguidelinesInterfacesGlobalInit
+// ReSharper disable CppClangTidyClangDiagnosticExitTimeDestructors
+#include <vector>
+#include <string>
+#include <algorithm>
+// os headers
+#include <Windows.h>
+#include <Psapi.h>
+#include <qos2.h>
+// multimedia timer
+#include <mmsystem.h>
+// ctl headers
+#include <ctString.hpp>
+#include <ctNetAdapterAddresses.hpp>
+#include <ctTimer.hpp>
+#include <ctRandom.hpp>
+#include <ctWmiInstance.hpp>
+// project headers
+#include "ctsConfig.h"
+#include "ctsLogger.hpp"
+#include "ctsIOPattern.h"
+#include "ctsPrintStatus.hpp"
+#include "ctsTCPFunctions.h"
+#include "ctsMediaStreamClient.h"
+#include "ctsMediaStreamServer.h"
+#include "ctsWinsockLayer.h"
+#include <ctCpuAffinity.hpp>
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using namespace std;
+using namespace ctl;
+
+namespace ctsTraffic::ctsConfig
+{
+	ctsConfigSettings* g_configSettings;
+
+	// Resolves a name (or address literal) to the list of matching socket_address results, throwing on failure.
+	static std::vector<wil::network::socket_address> ResolveNameToAddresses(_In_ PCWSTR name)
+	{
+		std::vector<wil::network::socket_address> returnAddresses;
+		const auto addrResults = wil::network::resolve_name(name);
+		for (const auto& address : wil::network::addr_info_iterator{ addrResults.get() })
+		{
+			returnAddresses.push_back(address);
+		}
+		return returnAddresses;
+	}
+
+	//
+	// Hiding the details of the raw data in an unnamed namespace to make it completely private
+	// Free functions below provide proper access to this information
+	// This design avoids having to pass a "config" object all over to share this information
+	//
+	static wil::critical_section g_statusUpdateLock{ ctsConfigSettings::c_CriticalSectionSpinlock };
+	static wil::critical_section g_shutdownLock{ ctsConfigSettings::c_CriticalSectionSpinlock };
+
+	constexpr WORD c_defaultPort = 4444;
+
+	constexpr uint64_t c_defaultTransfer = 0x40000000; // 1Gbyte
+
+	constexpr uint32_t c_defaultBufferSize = 0x10000; // 64kbyte
+	constexpr uint32_t c_defaultAcceptLimit = 10;
+	constexpr uint32_t c_defaultAcceptExLimit = 100;
+	constexpr uint32_t c_defaultAcceptDepthLow = 100;
+	constexpr uint32_t c_defaultAcceptDepthHigh = 1000;
+	constexpr uint32_t c_defaultTcpConnectionLimit = 8;
+	constexpr uint32_t c_defaultUdpConnectionLimit = 1;
+	constexpr uint32_t c_defaultConnectionThrottleLimit = 1000;
+	constexpr uint32_t c_defaultConnectionRampTimeMs = 10000;
+	constexpr uint32_t c_maxIocpBatchSize = 256U;
+
+	static PTP_POOL g_threadPool = nullptr;
+	static TP_CALLBACK_ENVIRON g_threadPoolEnvironment;
+	static uint32_t g_threadPoolThreadCount = 0;
+
+	static const wchar_t* g_createFunctionName = nullptr;
+	static const wchar_t* g_connectFunctionName = nullptr;
+	static const wchar_t* g_acceptFunctionName = nullptr;
+	static const wchar_t* g_ioFunctionName = nullptr;
+
+	// the IO function parsed from -IO (g_ioFunctionName is only for display)
+	enum class IoFunctionType : std::uint8_t
+	{
+		NotSet,
+		Iocp,
+		ReadWriteFile,
+		RioIocp,
+		WSAPoll,
+		Tls,
+		Quic,
+		MediaStream
+	};
+	static IoFunctionType g_ioFunctionType = IoFunctionType::NotSet;
+
+	// connection info + error info
+	static uint32_t g_consoleVerbosity = 4;
+	static uint32_t g_bufferSizeLow = 0;
+	static uint32_t g_bufferSizeHigh = 0;
+	static int64_t g_rateLimitLow = 0;
+	static int64_t g_rateLimitHigh = 0;
+	static uint64_t g_transferSizeLow = c_defaultTransfer;
+	static uint64_t g_transferSizeHigh = 0;
+
+	constexpr uint32_t c_defaultPushBytes = 0x100000;
+	constexpr uint32_t c_defaultPullBytes = 0x100000;
+
+	constexpr uint32_t c_defaultIdleKeepAliveBytes = 16;
+	constexpr uint32_t c_maxIdleKeepAliveBytes = 0x10000;
+	constexpr uint32_t c_defaultIdleKeepAliveIntervalMs = 30000;
+
+	constexpr uint32_t c_udpDatagramMaximumSizeBytes = 1400UL;
+
+	static uint32_t g_timePeriodRefCount{};
+
+	static int64_t g_previousPrintTimeSlice{};
+	static int64_t g_printTimeSliceCount{};
+
+	static NET_IF_COMPARTMENT_ID g_compartmentId = NET_IF_COMPARTMENT_ID_UNSPECIFIED;
+	static ctNetAdapterAddresses* g_netAdapterAddresses = nullptr;
+
+	static MediaStreamSettings g_mediaStreamSettings;
+	static ctRandomTwister g_randomTwister;
+
+	static HANDLE g_qosHandle = nullptr;
+	static uint32_t g_qosDscpValue = 0;
+
+	// default to 5 seconds
+	constexpr uint32_t c_defaultStatusUpdateFrequency = 5000;
+	static shared_ptr<ctsStatusInformation> g_printStatusInformation;
+	static shared_ptr<ctsLogger> g_connectionLogger;
+	static shared_ptr<ctsLogger> g_statusLogger;
+	static shared_ptr<ctsLogger> g_errorLogger;
+	static shared_ptr<ctsLogger> g_jitterLogger;
+	static shared_ptr<ctsLogger> g_tcpInfoLogger;
+
+	static bool g_isRssEnabledOnAnyProcessor = false;
+
+	static bool g_breakOnError = false;
+	static ExitProcessType g_processStatus = ExitProcessType::Running;
+
+	static INIT_ONCE g_configInitImpl = INIT_ONCE_STATIC_INIT;
+	static BOOL CALLBACK InitOnceConfigImpl(PINIT_ONCE, PVOID, PVOID*)
+	{
+		g_configSettings = new ctsConfigSettings;
+		g_configSettings->Port = c_defaultPort;
+		WI_SetAllFlags(g_configSettings->SocketFlags, WSA_FLAG_OVERLAPPED | WSA_FLAG_NO_HANDLE_INHERIT);
+		g_configSettings->Iterations = MAXULONGLONG;
+		g_configSettings->ConnectionLimit = 1;
+		g_configSettings->AcceptLimit = c_defaultAcceptLimit;
+		g_configSettings->ConnectionThrottleLimit = c_defaultConnectionThrottleLimit;
+		g_configSettings->ServerExitLimit = MAXULONGLONG;
+		g_configSettings->StatusUpdateFrequencyMilliseconds = c_defaultStatusUpdateFrequency;
+		// defaulting to verifying - therefore not using a shared buffer
+		g_configSettings->ShouldVerifyBuffers = true;
+		g_configSettings->UseSharedBuffer = false;
+
+		// sharded receive defaults
+		g_configSettings->EnableRecvSharding = false;
+		// default shard count to number of logical processors when 0
+		g_configSettings->ShardCount = 0;
+		g_configSettings->ShardWorkerCount = 1;
+		g_configSettings->ShardAffinityPolicy = AffinityPolicy::PerCpu;
+
+		g_previousPrintTimeSlice = 0LL;
+		g_printTimeSliceCount = 0LL;
+		return TRUE;
+	}
+	static void ctsConfigInitOnce() noexcept
+	{
+		FAIL_FAST_IF(!InitOnceExecuteOnce(&g_configInitImpl, InitOnceConfigImpl, nullptr, nullptr));
+	}
+
+	//
+	// parses the configuration of the local system for options dependent on deployments
+	//
+	static void CheckReuseUnicastPort() noexcept try
+	{
+		// Windows 10+ exposes a new socket option: SO_REUSE_UNICASTPORT
+		// - this allows for much greater reuse of local ports, but also requires
+		//   the system having been deliberately configured to take advantage of it
+		// - looking for corresponding the WMI class property, which only exists in Win10+
+		for (const auto& instance : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetTCPSetting"))
+		{
+			wil::unique_variant varValue;
+			instance.get(L"AutoReusePortRangeNumberOfPorts", varValue.addressof());
+			if (V_VT(varValue.addressof()) == VT_I4)
+			{
+				if (V_I4(varValue.addressof()) != 0)
+				{
+					g_configSettings->Options |= ReuseUnicastPort;
+					break;
+				}
+			}
+		}
+	}
+	catch (...)
+	{
+		// will assume is not configured if any exception is thrown
+		// - could be the class doesn't exist (Win7)
+		//   or the property doesn't exist (Win8 and 8.1)
+		PRINT_DEBUG_INFO(
+			L"\t\tNot using SO_REUSE_UNICASTPORT as AutoReusePortRangeNumberOfPorts is not supported or not configured\n");
+	}
+
+	constexpr auto* EnabledString = L"Enabled";
+	constexpr auto* NotEnabledString = L"NOT-ENABLED";
+	static std::wstring CheckOffloadRsc(const std::wstring& inputInterfaceDescription) noexcept try
+	{
+		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterRscSettingData"))
+		{
+			std::wstring interfaceDescription;
+			setting.get(L"InterfaceDescription", &interfaceDescription);
+			if (interfaceDescription != inputInterfaceDescription)
+			{
+				continue;
+			}
+
+			bool ipv4Enabled = false;
+			setting.get(L"IPv4Enabled", &ipv4Enabled);
+			bool ipv6Enabled = false;
+			setting.get(L"IPv6Enabled", &ipv6Enabled);
+			return wil::str_printf<std::wstring>(
+				L"RSC:IPv4 %ws IPv6 %ws",
+				ipv4Enabled ? EnabledString : NotEnabledString, ipv6Enabled ? EnabledString : NotEnabledString);
+		}
+
+		return wil::str_printf<std::wstring>(L"RSC:IPv4 %ws,IPv6 %ws", NotEnabledString, NotEnabledString);
+	}
+	catch (...)
+	{
+		PRINT_DEBUG_INFO(
+			L"\t\tQuerying for NetAdapterRsc failed : 0x%lx\n", wil::ResultFromCaughtException());
+		return {};
+	}
+
+	static std::wstring CheckOffloadLso(const std::wstring& inputInterfaceDescription) noexcept try
+	{
+		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterLsoSettingData"))
+		{
+			std::wstring interfaceDescription;
+			setting.get(L"InterfaceDescription", &interfaceDescription);
+			if (interfaceDescription != inputInterfaceDescription)
+			{
+				continue;
+			}
+
+			bool ipv4Enabled = false;
+			setting.get(L"IPv4Enabled", &ipv4Enabled);
+			bool ipv6Enabled = false;
+			setting.get(L"IPv6Enabled", &ipv6Enabled);
+			return wil::str_printf<std::wstring>(
+				L"LSO:IPv4 %ws IPv6 %ws",
+				ipv4Enabled ? EnabledString : NotEnabledString, ipv6Enabled ? EnabledString : NotEnabledString);
+		}
+
+		return wil::str_printf<std::wstring>(L"LSO:IPv4 %ws,IPv6 %ws", NotEnabledString, NotEnabledString);
+	}
+	catch (...)
+	{
+		PRINT_DEBUG_INFO(
+			L"\t\tQuerying for NetAdapterLso failed : 0x%lx\n", wil::ResultFromCaughtException());
+		return {};
+	}
+
+	static std::wstring CheckOffloadRss(const std::wstring& inputInterfaceDescription) noexcept try
+	{
+		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterRssSettingData"))
+		{
+			std::wstring interfaceDescription;
+			setting.get(L"InterfaceDescription", &interfaceDescription);
+			if (interfaceDescription != inputInterfaceDescription)
+			{
+				continue;
+			}
+
+			bool enabled = false;
+			setting.get(L"Enabled", &enabled);
+			if (enabled)
+			{
+			    g_isRssEnabledOnAnyProcessor = true;
+			}
+			return wil::str_printf<std::wstring>(
+				L"RSS:%ws", enabled ? EnabledString : NotEnabledString);
+		}
+		return wil::str_printf<std::wstring>(L"RSS:%ws", NotEnabledString);
+	}
+	catch (...)
+	{
+		PRINT_DEBUG_INFO(
+			L"\t\tQuerying for NetAdapterRss failed : 0x%lx\n", wil::ResultFromCaughtException());
+		return {};
+	}
+
+	static std::wstring PrintPhysicalAdapter(const std::wstring& inputInterfaceDescription) noexcept try
+	{
+		std::wstring returnString;
+
+		// the first query is to find the PCI link speed
+		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterHardwareInfoSettingData"))
+		{
+			std::wstring interfaceDescription;
+			setting.get(L"InterfaceDescription", &interfaceDescription);
+			if (!ctString::iordinal_equals(interfaceDescription, inputInterfaceDescription))
+			{
+				continue;
+			}
+
+			// filter the returned string to just the Bus information - e.g. a return value could look like "PCI bus 8, device 0, function 0"
+			std::wstring locationInformationString;
+			setting.get(L"LocationInformationString", &locationInformationString);
+			const auto foundLocation = locationInformationString.find(L',');
+			if (foundLocation != std::wstring::npos)
+			{
+				locationInformationString.erase(locationInformationString.begin() + foundLocation, locationInformationString.end());
+			}
+
+			if (locationInformationString.starts_with(L"PCI"))
+			{
+				uint32_t pciExpressCurrentLinkSpeedEncoded = 0;
+				setting.get(L"PciExpressCurrentLinkSpeedEncoded", &pciExpressCurrentLinkSpeedEncoded);
+				std::wstring pciExpressCurrentLinkSpeed;
+				if (pciExpressCurrentLinkSpeedEncoded == 1)
+				{
+					pciExpressCurrentLinkSpeed = L"2.5 Gbps";
+				}
+				if (pciExpressCurrentLinkSpeedEncoded == 2)
+				{
+					pciExpressCurrentLinkSpeed = L"5.0 Gbps";
+				}
+
+				returnString = wil::str_printf<std::wstring>(L"Bus:%ws [PCI Link Speed %ws]",
+					locationInformationString.c_str(), pciExpressCurrentLinkSpeed.c_str());
+			}
+			else
+			{
+				returnString = wil::str_printf<std::wstring>(L"Bus:%ws", locationInformationString.c_str());
+			}
+
+			break;
+		}
+
+		// the second query is to find a custom adapter property describing buffers available on the adapter
+		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapterAdvancedPropertySettingData"))
+		{
+			std::wstring interfaceDescription;
+			setting.get(L"InterfaceDescription", &interfaceDescription);
+			if (interfaceDescription != inputInterfaceDescription)
+			{
+				continue;
+			}
+
+			// convert the 'DisplayName' string from the adapter to lower-case
+			// this only works if it's ascii -- i.e., only if it's in English
+			std::wstring displayName;
+			if (!setting.get(L"DisplayName", &displayName))
+			{
+				continue;
+			}
+
+			for (auto& letter : displayName)
+			{
+				if (!iswascii(letter))
+				{
+					continue;
+				}
+
+				letter = towlower(letter);
+			}
+
+			if (displayName.find(L"buffer") == std::wstring::npos)
+			{
+				continue;
+			}
+
+			std::wstring displayValue;
+			if (!setting.get(L"DisplayValue", &displayValue))
+			{
+				continue;
+			}
+
+			if (!returnString.empty())
+			{
+				returnString += L" ";
+			}
+			returnString += wil::str_printf<std::wstring>(L"[%ws = %ws]", displayName.c_str(), displayValue.c_str());
+		}
+
+		if (returnString.empty())
+		{
+			returnString = L"(No hardware information available)";
+		}
+
+		returnString += L"\n";
+		return returnString;
+	}
+	catch (...)
+	{
+		PRINT_DEBUG_INFO(
+			L"\t\tQuerying for MSFT_NetAdapterHardwareInfo failed : 0x%lx\n", wil::ResultFromCaughtException());
+		return {};
+	}
+
+	//
+	// parses the input argument to determine if it matches the expected parameter
+	// if so, it returns a ptr to the corresponding parameter value
+	// otherwise, returns nullptr
+	//
+	// throws invalid_parameter if something is obviously wrong 
+	//
+	static const wchar_t* ParseArgument(_In_z_ const wchar_t* inputArgument, _In_z_ const wchar_t* expectedParam)
+	{
+		const wchar_t* paramEnd = inputArgument + wcslen(inputArgument);
+		const wchar_t* paramDelimiter = find(inputArgument, paramEnd, L':');
+		if (!(paramEnd > paramDelimiter + 1))
+		{
+			throw invalid_argument(ctString::convert_to_string(inputArgument));
+		}
+		// temporarily null-terminate it at the delimiter to do a string compare
+		*const_cast<wchar_t*>(paramDelimiter) = L'\0';
+		const wchar_t* returnValue = nullptr;
+		if (ctString::iordinal_equals(expectedParam, inputArgument))
+		{
+			returnValue = paramDelimiter + 1;
+		}
+		*const_cast<wchar_t*>(paramDelimiter) = L':';
+		return returnValue;
+	}
+
+	//
+	// ConvertToIntegral(wstring)
+	//
+	// Directly converts the *entire* contents of the passed in string to a numeric value
+	// - the type of that numeric value being the template type specified
+	//
+	// e.g.
+	// auto a = ConvertToIntegral<long>(L"-1");
+	// auto b = ConvertToIntegral<uint32_t>(L"0xa");
+	// auto a = ConvertToIntegral<int64_t>(L"0x123456789abcdef");
+	// auto a = ConvertToIntegral<uint64_t>(L"999999999999999999");
+	// 
+	// NOTE:
+	// - will *only* assume a string starting with "0x" to be converted as hexadecimal
+	//   if it does not start with "0x", will assume as base-10
+	// - if an unsigned type is specified in the template and a negative number is entered,
+	//   will convert that to the "unsigned" version of that set of bits
+	//   e.g.
+	//       uint64_t test = ConvertToIntegral<uint64_t>(L"-1");
+	//       // test == 0xffffffffffffffff
+	//
+	static int64_t ConvertToIntegralSigned(const wstring& inputString)
+	{
+		auto returnValue = 0ll;
+		size_t firstUnconvertedOffset = 0;
+		if (inputString.find(L'x') != wstring::npos || inputString.find(L'X') != wstring::npos)
+		{
+			returnValue = stoll(inputString, &firstUnconvertedOffset, 16);
+		}
+		else
+		{
+			returnValue = stoll(inputString, &firstUnconvertedOffset, 10);
+		}
+
+		if (firstUnconvertedOffset != inputString.size())
+		{
+			throw invalid_argument(ctString::convert_to_string(inputString));
+		}
+		return returnValue;
+	}
+
+	static uint64_t ConvertToIntegralUnsigned(const wstring& inputString)
+	{
+		auto returnValue = 0ull;
+		size_t firstUnconvertedOffset = 0;
+		if (inputString.find(L'x') != wstring::npos || inputString.find(L'X') != wstring::npos)
+		{
+			returnValue = stoull(inputString, &firstUnconvertedOffset, 16);
+		}
+		else
+		{
+			returnValue = stoull(inputString, &firstUnconvertedOffset, 10);
+		}
+
+		if (firstUnconvertedOffset != inputString.size())
+		{
+			throw invalid_argument(ctString::convert_to_string(inputString));
+		}
+		return returnValue;
+	}
+
+	template <typename T>
+	T ConvertToIntegral(const wstring& inputString);
+
+	template <>
+	int16_t ConvertToIntegral<int16_t>(const wstring& inputString)
+	{
+		const auto returnValue = ConvertToIntegralSigned(inputString);
+		if (returnValue > INT16_MAX || returnValue < INT16_MIN)
+		{
+			throw invalid_argument(ctString::convert_to_string(inputString));
+		}
+		return static_cast<int16_t>(returnValue);
+	}
+
+	template <>
+	uint16_t ConvertToIntegral<uint16_t>(const wstring& inputString)
+	{
+		const auto returnValue = ConvertToIntegralUnsigned(inputString);
+		if (returnValue > UINT16_MAX)
+		{
+			throw invalid_argument(ctString::convert_to_string(inputString));
+		}
+		return static_cast<uint16_t>(returnValue);
+	}
+
+	template <>
+	int32_t ConvertToIntegral<int32_t>(const wstring& inputString)
+	{
+		const auto returnValue = ConvertToIntegralSigned(inputString);
+		if (returnValue < INT32_MIN || returnValue > INT32_MAX)
+		{
+			throw invalid_argument(ctString::convert_to_string(inputString));
+		}
+		return static_cast<int32_t>(returnValue);
+	}
+
+	template <>
+	uint32_t ConvertToIntegral<uint32_t>(const wstring& inputString)
+	{
+		const auto returnValue = ConvertToIntegralUnsigned(inputString);
+		if (returnValue > UINT32_MAX)
+		{
+			throw invalid_argument(ctString::convert_to_string(inputString));
+		}
+		return static_cast<uint32_t>(returnValue);
+	}
+
+	template <>
+	int64_t ConvertToIntegral<int64_t>(const wstring& inputString)
+	{
+		return ConvertToIntegralSigned(inputString);
+	}
+
+	template <>
+	uint64_t ConvertToIntegral<uint64_t>(const wstring& inputString)
+	{
+		return ConvertToIntegralUnsigned(inputString);
+	}
+
+	//
+	// Parses for the connect function to use
+	//
+	static void ParseForCreate(const vector<const wchar_t*>&)
+	{
+		if (nullptr == g_configSettings->CreateFunction)
+		{
+			g_configSettings->CreateFunction = ctsWSASocket;
+			g_createFunctionName = L"WSASocket";
+		}
+	}
+
+	//
+	// Parses for the connect function to use
+	//
+	// -conn:connect
+	// -conn:ConnectByName
+	// -conn:ConnectEx  (*default)
+	// -conn:HappyEyeballs
+	//
+	// -ConnectAttemptDelay:#### (milliseconds, only with -conn:HappyEyeballs)
+	//
+	static void ParseForConnect(vector<const wchar_t*>& args)
+	{
+		auto connectSpecified = false;
+		const auto foundArg = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-conn");
+				return value != nullptr;
+			});
+		if (foundArg != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-conn (only applicable to TCP)");
+			}
+			if (IoFunctionType::Quic == g_ioFunctionType)
+			{
+				throw invalid_argument("-conn (-IO:Quic opens streams on its own QUIC connections)");
+			}
+
+			const auto* const value = ParseArgument(*foundArg, L"-conn");
+			if (ctString::iordinal_equals(L"ConnectEx", value))
+			{
+				g_configSettings->ConnectFunction = ctsConnectEx;
+				g_connectFunctionName = L"ConnectEx";
+			}
+			else if (ctString::iordinal_equals(L"connect", value))
+			{
+				g_configSettings->ConnectFunction = ctsSimpleConnect;
+				g_connectFunctionName = L"connect";
+			}
+			else if (ctString::iordinal_equals(L"ConnectByName", value))
+			{
+				g_configSettings->ConnectFunction = ctsConnectByName;
+				g_connectFunctionName = L"ConnectByName (cached DnsQueryEx, then ConnectEx)";
+			}
+			else if (ctString::iordinal_equals(L"HappyEyeballs", value))
+			{
+				// every attempt of a race binds its own socket
+				if (g_configSettings->LocalPortLow != 0 && 0 == g_configSettings->LocalPortHigh)
+				{
+					throw invalid_argument("-conn:HappyEyeballs requires a range of -LocalPort ports to bind its attempts");
+				}
+				g_configSettings->ConnectFunction = ctsHappyEyeballsConnect;
+				g_connectFunctionName = L"HappyEyeballs (racing ConnectEx)";
+			}
+			else
+			{
+				throw invalid_argument("-conn");
+			}
+			connectSpecified = true;
+			// always remove the arg from our vector
+			args.erase(foundArg);
+		}
+		else
+		{
+			if (IoFunctionType::Quic == g_ioFunctionType)
+			{
+				g_configSettings->ConnectFunction = ctsQuicConnect;
+				g_connectFunctionName = L"Quic (MsQuic StreamStart)";
+			}
+			else if (g_configSettings->IoPattern != IoPatternType::MediaStream)
+			{
+				g_configSettings->ConnectFunction = ctsConnectEx;
+				g_connectFunctionName = L"ConnectEx";
+			}
+			else
+			{
+				g_configSettings->ConnectFunction = ctsMediaStreamClientConnect;
+				g_connectFunctionName = L"MediaStream Client Connect";
+			}
+		}
+
+		if (IoPatternType::MediaStream == g_configSettings->IoPattern && connectSpecified)
+		{
+			throw invalid_argument("-conn (MediaStream has its own internal connection handler)");
+		}
+
+		const auto foundDelay = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ConnectAttemptDelay");
+				return value != nullptr;
+			});
+		if (foundDelay != end(args))
+		{
+			if (wstring(g_connectFunctionName) != L"HappyEyeballs (racing ConnectEx)")
+			{
+				throw invalid_argument("-ConnectAttemptDelay requires -conn:HappyEyeballs");
+			}
+			g_configSettings->ConnectAttemptDelayMs = ConvertToIntegral<uint32_t>(ParseArgument(*foundDelay, L"-ConnectAttemptDelay"));
+			// RFC 8305 section 5: never less than 10 ms, and no reason to wait more than 2 seconds
+			if (g_configSettings->ConnectAttemptDelayMs < 10 || g_configSettings->ConnectAttemptDelayMs > 2000)
+			{
+				throw invalid_argument("-ConnectAttemptDelay must be from 10 to 2000 milliseconds");
+			}
+			// always remove the arg from our vector
+			args.erase(foundDelay);
+		}
+	}
+
+	//
+	// Parses for the accept function to use
+	//
+	// -acc:accept
+	// -acc:acceptex  (*default)
+	//
+	static void ParseForAccept(vector<const wchar_t*>& args)
+	{
+		g_configSettings->AcceptLimit = c_defaultAcceptExLimit;
+
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-acc");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-acc (only applicable to TCP)");
+			}
+			if (IoFunctionType::Quic == g_ioFunctionType)
+			{
+				throw invalid_argument("-acc (-IO:Quic accepts streams from its own QUIC listeners)");
+			}
+
+			const auto* const value = ParseArgument(*foundArgument, L"-acc");
+			if (ctString::iordinal_equals(L"accept", value))
+			{
+				g_configSettings->AcceptFunction = ctsSimpleAccept;
+				g_acceptFunctionName = L"accept";
+			}
+			else if (ctString::iordinal_equals(L"AcceptEx", value))
+			{
+				g_configSettings->AcceptFunction = ctsAcceptEx;
+				g_acceptFunctionName = L"AcceptEx";
+			}
+			else
+			{
+				throw invalid_argument("-acc");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else if (!g_configSettings->ListenAddresses.empty())
+		{
+			if (IoFunctionType::Quic == g_ioFunctionType)
+			{
+				g_configSettings->AcceptFunction = ctsQuicAccept;
+				g_acceptFunctionName = L"Quic (MsQuic listener streams)";
+			}
+			else if (IoPatternType::MediaStream != g_configSettings->IoPattern)
+			{
+				// only default an Accept function if listening
+				g_configSettings->AcceptFunction = ctsAcceptEx;
+				g_acceptFunctionName = L"AcceptEx";
+			}
+			else
+			{
+				g_configSettings->AcceptFunction = ctsMediaStreamServerListener;
+				g_acceptFunctionName = L"MediaStream Server Listener";
+			}
+		}
+	}
+
+	//
+	// Parses for the IO (read/write) function to use
+	// -- only applicable to TCP
+	//
+	// -io:blocking
+	// -io:nonblocking
+	// -io:event
+	// -io:iocp (*default)
+	// -io:wsapoll
+	// -io:rioiocp
+	// -io:tls
+	// -io:quic
+	//
+	static void ParseForIoFunction(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-io");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-io (only applicable to TCP)");
+			}
+
+			const auto* const value = ParseArgument(*foundArgument, L"-io");
+			// keepalive intervals are scheduled with timers which are only supported by -IO:iocp
+			if (IoPatternType::IdleHold == g_configSettings->IoPattern && !ctString::iordinal_equals(L"iocp", value))
+			{
+				throw invalid_argument("-Pattern:IdleHold requires -IO:iocp");
+			}
+			// the gap between transfers delays the client's next send, which these never schedule
+			if (g_configSettings->TransferGapMs > 0 &&
+				(ctString::iordinal_equals(L"rioiocp", value) || ctString::iordinal_equals(L"ReadWriteFile", value)))
+			{
+				throw invalid_argument("-TransferGap is not supported with -IO:RioIocp or -IO:ReadWriteFile");
+			}
+
+			if (ctString::iordinal_equals(L"iocp", value))
+			{
+				g_configSettings->IoFunction = ctsSendRecvIocp;
+				g_configSettings->Options |= HandleInlineIocp;
+				g_ioFunctionName = L"Iocp (WSASend/WSARecv using IOCP)";
+				g_ioFunctionType = IoFunctionType::Iocp;
+			}
+			else if (ctString::iordinal_equals(L"ReadWriteFile", value))
+			{
+				g_configSettings->IoFunction = ctsReadWriteIocp;
+				g_ioFunctionName = L"ReadWriteFile (ReadFile/WriteFile using IOCP)";
+				g_ioFunctionType = IoFunctionType::ReadWriteFile;
+			}
+			else if (ctString::iordinal_equals(L"rioiocp", value))
+			{
+				g_configSettings->IoFunction = ctsRioIocp;
+				WI_SetFlag(g_configSettings->SocketFlags, WSA_FLAG_REGISTERED_IO);
+				g_ioFunctionName = L"RioIocp (RIO using IOCP notifications)";
+				g_ioFunctionType = IoFunctionType::RioIocp;
+			}
+			else if (ctString::iordinal_equals(L"wsapoll", value))
+			{
+				g_configSettings->IoFunction = ctsWSAPoll;
+				g_ioFunctionName = L"WSAPoll (non-blocking send/recv using per-thread WSAPoll loops)";
+				g_ioFunctionType = IoFunctionType::WSAPoll;
+			}
+			else if (ctString::iordinal_equals(L"tls", value))
+			{
+				g_configSettings->IoFunction = ctsTlsIocp;
+				g_ioFunctionName = L"Tls (WSASend/WSARecv using IOCP over a Schannel TLS session)";
+				g_ioFunctionType = IoFunctionType::Tls;
+			}
+			else if (ctString::iordinal_equals(L"quic", value))
+			{
+				// each connection is a QUIC stream: MsQuic replaces the socket functions end to end
+				g_configSettings->CreateFunction = ctsQuicCreate;
+				g_createFunctionName = L"Quic (MsQuic connection)";
+				g_configSettings->IoFunction = ctsQuicIo;
+				g_configSettings->ClosingFunction = ctsQuicClose;
+				g_ioFunctionName = L"Quic (MsQuic streams sharing each QUIC connection)";
+				g_ioFunctionType = IoFunctionType::Quic;
+			}
+			else
+			{
+				throw invalid_argument("-io");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			if (ProtocolType::TCP == g_configSettings->Protocol)
+			{
+				// Default for TCP is WSASend/WSARecv using IOCP
+				g_configSettings->IoFunction = ctsSendRecvIocp;
+				g_configSettings->Options |= HandleInlineIocp;
+				g_ioFunctionName = L"Iocp (WSASend/WSARecv using IOCP)";
+				g_ioFunctionType = IoFunctionType::Iocp;
+			}
+			else
+			{
+				if (IsListening())
+				{
+					g_configSettings->IoFunction = ctsMediaStreamServerIo;
+					// server also has a closing function to remove the closed socket
+					g_configSettings->ClosingFunction = ctsMediaStreamServerClose;
+					g_ioFunctionName = L"MediaStream Server";
+					g_ioFunctionType = IoFunctionType::MediaStream;
+				}
+				else
+				{
+					constexpr auto udpRecvBuff = 1048576ul; // 1 MB
+					g_configSettings->IoFunction = ctsMediaStreamClient;
+					g_configSettings->Options |= SetRecvBuf;
+					g_configSettings->RecvBufValue = udpRecvBuff;
+					g_configSettings->Options |= HandleInlineIocp;
+					g_configSettings->Options |= EnableCircularQueueing;
+					g_ioFunctionName = L"MediaStream Client";
+					g_ioFunctionType = IoFunctionType::MediaStream;
+				}
+			}
+		}
+	}
+
+	//
+	// Parses for batching RIO request submission across connections
+	// -- only applicable to -IO:RioIocp
+	//
+	// -SubmitBatchSize:####
+	// -SubmitBatchLatency:#### (microseconds)
+	//
+	static void ParseForSubmitBatch(vector<const wchar_t*>& args)
+	{
+		const auto foundSize = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SubmitBatchSize");
+				return value != nullptr;
+			});
+		if (foundSize != end(args))
+		{
+			if (!WI_IsFlagSet(g_configSettings->SocketFlags, WSA_FLAG_REGISTERED_IO))
+			{
+				throw invalid_argument("-SubmitBatchSize requires -IO:RioIocp");
+			}
+			g_configSettings->SubmitBatchSize = ConvertToIntegral<uint32_t>(ParseArgument(*foundSize, L"-SubmitBatchSize"));
+			if (0 == g_configSettings->SubmitBatchSize)
+			{
+				throw invalid_argument("-SubmitBatchSize must be greater than zero");
+			}
+			// always remove the arg from our vector
+			args.erase(foundSize);
+		}
+
+		const auto foundLatency = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SubmitBatchLatency");
+				return value != nullptr;
+			});
+		if (foundLatency != end(args))
+		{
+			if (0 == g_configSettings->SubmitBatchSize)
+			{
+				throw invalid_argument("-SubmitBatchLatency requires -SubmitBatchSize");
+			}
+			g_configSettings->SubmitBatchLatencyUsec = ConvertToIntegral<uint32_t>(ParseArgument(*foundLatency, L"-SubmitBatchLatency"));
+			// always remove the arg from our vector
+			args.erase(foundLatency);
+		}
+	}
+
+	//
+	// Parses for busy polling the RIO completion notifications
+	// -- only applicable to -IO:RioIocp
+	//
+	// -BusyPoll:#### (microseconds)
+	//
+	static void ParseForBusyPoll(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-BusyPoll");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (!WI_IsFlagSet(g_configSettings->SocketFlags, WSA_FLAG_REGISTERED_IO))
+			{
+				throw invalid_argument("-BusyPoll requires -IO:RioIocp");
+			}
+			g_configSettings->BusyPollUsec = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-BusyPoll"));
+			if (0 == g_configSettings->BusyPollUsec)
+			{
+				throw invalid_argument("-BusyPoll must be greater than zero");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the TLS session options
+	// -- only applicable to -IO:Tls (and -IO:Quic for -TlsCertificate)
+	//
+	// -TlsRecordSize:#### (bytes)
+	// -TlsCertificate:<thumbprint> (servers only)
+	//
+	static void ParseForTls(vector<const wchar_t*>& args)
+	{
+		const auto foundRecordSize = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-TlsRecordSize");
+				return value != nullptr;
+			});
+		if (foundRecordSize != end(args))
+		{
+			if (IoFunctionType::Tls != g_ioFunctionType)
+			{
+				throw invalid_argument("-TlsRecordSize requires -IO:Tls");
+			}
+			g_configSettings->TlsRecordSize = ConvertToIntegral<uint32_t>(ParseArgument(*foundRecordSize, L"-TlsRecordSize"));
+			// a TLS record carries at most 16KB of plaintext
+			if (0 == g_configSettings->TlsRecordSize || g_configSettings->TlsRecordSize > 16384)
+			{
+				throw invalid_argument("-TlsRecordSize must be between 1 and 16384");
+			}
+			// always remove the arg from our vector
+			args.erase(foundRecordSize);
+		}
+
+		const auto foundCertificate = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-TlsCertificate");
+				return value != nullptr;
+			});
+		if (foundCertificate != end(args))
+		{
+			if (IoFunctionType::Tls != g_ioFunctionType && IoFunctionType::Quic != g_ioFunctionType)
+			{
+				throw invalid_argument("-TlsCertificate requires -IO:Tls or -IO:Quic");
+			}
+			if (!IsListening())
+			{
+				throw invalid_argument("-TlsCertificate is only applicable to servers");
+			}
+			g_configSettings->TlsCertificateThumbprint = ParseArgument(*foundCertificate, L"-TlsCertificate");
+			if (g_configSettings->TlsCertificateThumbprint.empty())
+			{
+				throw invalid_argument("-TlsCertificate");
+			}
+			// always remove the arg from our vector
+			args.erase(foundCertificate);
+		}
+	}
+
+	//
+	// Parses for the QUIC connection options
+	// -- only applicable to -IO:Quic clients
+	//
+	// -QuicStreams:#### (streams per QUIC connection)
+	//
+	static void ParseForQuic(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-QuicStreams");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (IoFunctionType::Quic != g_ioFunctionType)
+			{
+				throw invalid_argument("-QuicStreams requires -IO:Quic");
+			}
+			if (IsListening())
+			{
+				throw invalid_argument("-QuicStreams is only applicable to clients");
+			}
+			g_configSettings->QuicStreams = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-QuicStreams"));
+			// servers allow each QUIC connection up to 1024 streams
+			if (0 == g_configSettings->QuicStreams || g_configSettings->QuicStreams > 1024)
+			{
+				throw invalid_argument("-QuicStreams must be between 1 and 1024");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the InlineCompletions setting to use
+	//
+	// -InlineCompletions:on
+	// -InlineCompletions:off
+	//
+	static void ParseForInlineCompletions(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-inlinecompletions");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-inlinecompletions");
+			if (ctString::iordinal_equals(L"on", value))
+			{
+				// -IO:Tls processes every completion from the IOCP
+				if (IoFunctionType::Tls == g_ioFunctionType)
+				{
+					throw invalid_argument("-InlineCompletions:on is not supported with -IO:Tls");
+				}
+				g_configSettings->Options |= HandleInlineIocp;
+			}
+			else if (ctString::iordinal_equals(L"off", value))
+			{
+				g_configSettings->Options &= ~HandleInlineIocp;
+			}
+			else
+			{
+				throw invalid_argument("-inlinecompletions");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the MsgWaitAll setting to use
+	//
+	// -MsgWaitAll:on
+	// -MsgWaitAll:off
+	//
+	static void ParseForMsgWaitAll(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-msgwaitall");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-msgwaitall");
+			if (ctString::iordinal_equals(L"on", value))
+			{
+				g_configSettings->Options |= MsgWaitAll;
+			}
+			else if (ctString::iordinal_equals(L"off", value))
+			{
+				g_configSettings->Options &= ~MsgWaitAll;
+			}
+			else
+			{
+				throw invalid_argument("-msgwaitall");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		{
+			// default to enable msgwaitall
+			g_configSettings->Options |= MsgWaitAll;
+		}
+	}
+
+	//
+	// Parses for the L4 Protocol to limit to usage
+	//
+	// -Protocol:tcp
+	// -Protocol:udp
+	//
+	static void ParseForProtocol(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-Protocol");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-Protocol");
+			if (ctString::iordinal_equals(L"tcp", value))
+			{
+				g_configSettings->Protocol = ProtocolType::TCP;
+			}
+			else if (ctString::iordinal_equals(L"udp", value))
+			{
+				g_configSettings->Protocol = ProtocolType::UDP;
+			}
+			else
+			{
+				throw invalid_argument("-Protocol");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			// default to TCP
+			g_configSettings->Protocol = ProtocolType::TCP;
+		}
+	}
+
+	//
+	// Parses for socket Options
+	// - allows for more than one option to be set
+	// -Options:<keepalive,tcpfastpath [-Options:<...>] [-Options:<...>]
+	//
+	static void ParseForOptions(vector<const wchar_t*>& args)
+	{
+		for (;;)
+		{
+			// loop until cannot fine -Options
+			const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+				{
+					const auto* const value = ParseArgument(parameter, L"-Options");
+					return value != nullptr;
+				});
+
+			if (foundArgument != end(args))
+			{
+				const auto* const value = ParseArgument(*foundArgument, L"-Options");
+				if (ctString::iordinal_equals(L"keepalive", value))
+				{
+					if (ProtocolType::TCP == g_configSettings->Protocol)
+					{
+						g_configSettings->Options |= KeepAlive;
+					}
+					else
+					{
+						throw invalid_argument("-Options (keepalive only allowed with TCP sockets)");
+					}
+				}
+				else if (ctString::iordinal_equals(L"tcpfastpath", value))
+				{
+					if (ProtocolType::TCP == g_configSettings->Protocol)
+					{
+						g_configSettings->Options |= LoopbackFastPath;
+					}
+					else
+					{
+						throw invalid_argument("-Options (tcpfastpath only allowed with TCP sockets)");
+					}
+				}
+				else
+				{
+					throw invalid_argument("-Options");
+				}
+
+				// always remove the arg from our vector
+				args.erase(foundArgument);
+			}
+			else
+			{
+				// didn't find -Options
+				break;
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////////
+	///
+	/// Parses for a specified DSCP value
+	/// -QosDscpValue:#### [-Options:<...>]
+	///
+	//////////////////////////////////////////////////////////////////////////////////////////
+	static void ParseForDscpValue(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool {
+			const auto* const value = ParseArgument(parameter, L"-QosDscpValue");
+			return value != nullptr;
+			});
+
+		if (foundArgument != end(args))
+		{
+			const auto value = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-QosDscpValue"));
+			if (value > 63)
+			{
+				throw invalid_argument("Invalid QosDscpValue");
+			}
+
+			// verify we can load QoS
+			QOS_VERSION QosVersion{.MajorVersion = 1, .MinorVersion = 0 };
+			THROW_IF_WIN32_BOOL_FALSE_MSG(QOSCreateHandle(&QosVersion, &g_qosHandle), "QOSCreateHandle failed");
+
+			g_qosDscpValue = value;
+
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////////
+	///
+	/// Parses the optional -KeepAliveValue:####
+	///
+	//////////////////////////////////////////////////////////////////////////////////////////
+	static void ParseForKeepAlive(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool {
+			const auto* const value = ParseArgument(parameter, L"-keepalivevalue");
+			return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (ProtocolType::TCP == g_configSettings->Protocol)
+			{
+				g_configSettings->KeepAliveValue = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-keepalivevalue"));
+				if (0 == g_configSettings->KeepAliveValue)
+				{
+					throw invalid_argument("Invalid KeepAliveValue");
+				}
+			}
+			else
+			{
+				throw invalid_argument("-KeepAliveValue is only allowed with TCP sockets");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the wire-Protocol to use
+	// --- these only apply to TCP
+	static IoPatternType ConvertToIoPattern(_In_z_ const wchar_t* value)
+	{
+		if (ctString::iordinal_equals(L"push", value))
+		{
+			return IoPatternType::Push;
+		}
+		if (ctString::iordinal_equals(L"pull", value))
+		{
+			return IoPatternType::Pull;
+		}
+		if (ctString::iordinal_equals(L"pushpull", value))
+		{
+			return IoPatternType::PushPull;
+		}
+		if (ctString::iordinal_equals(L"flood", value) || ctString::iordinal_equals(L"duplex", value))
+		{
+			// the old name for this was 'flood'
+			return IoPatternType::Duplex;
+		}
+		if (ctString::iordinal_equals(L"idlehold", value))
+		{
+			return IoPatternType::IdleHold;
+		}
+		return IoPatternType::NoIoSet;
+	}
+
+	//
+	// -pattern:push
+	// -pattern:pull
+	// -pattern:pushpull
+	// -pattern:duplex
+	// -pattern:idlehold
+	//
+	static void ParseForIoPattern(vector<const wchar_t*>& args)
+	{
+		auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-pattern");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-pattern (only applicable to TCP)");
+			}
+
+			g_configSettings->IoPattern = ConvertToIoPattern(ParseArgument(*foundArgument, L"-pattern"));
+			if (IoPatternType::NoIoSet == g_configSettings->IoPattern)
+			{
+				throw invalid_argument("-pattern");
+			}
+
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			if (g_configSettings->Protocol == ProtocolType::UDP)
+			{
+				g_configSettings->IoPattern = IoPatternType::MediaStream;
+			}
+			else
+			{
+				// default the TCP pattern to Push
+				g_configSettings->IoPattern = IoPatternType::Push;
+			}
+		}
+
+		// Now look for options tightly coupled to Protocol
+		const auto foundPushbytes = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-pushbytes");
+				return value != nullptr;
+			});
+		if (foundPushbytes != end(args))
+		{
+			if (g_configSettings->IoPattern != IoPatternType::PushPull)
+			{
+				throw invalid_argument("-PushBytes can only be set with -Pattern:PushPull");
+			}
+			g_configSettings->PushBytes = ConvertToIntegral<uint32_t>(ParseArgument(*foundPushbytes, L"-pushbytes"));
+			// always remove the arg from our vector
+			args.erase(foundPushbytes);
+		}
+		else
+		{
+			g_configSettings->PushBytes = c_defaultPushBytes;
+		}
+
+		const auto foundPullbytes = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-pullbytes");
+				return value != nullptr;
+			});
+		if (foundPullbytes != end(args))
+		{
+			if (g_configSettings->IoPattern != IoPatternType::PushPull)
+			{
+				throw invalid_argument("-PullBytes can only be set with -Pattern:PushPull");
+			}
+			g_configSettings->PullBytes = ConvertToIntegral<uint32_t>(ParseArgument(*foundPullbytes, L"-pullbytes"));
+			// always remove the arg from our vector
+			args.erase(foundPullbytes);
+		}
+		else
+		{
+			g_configSettings->PullBytes = c_defaultPullBytes;
+		}
+
+		const auto foundBurstCount = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-burstcount");
+				return value != nullptr;
+			});
+		if (foundBurstCount != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-BurstCount requires -Protocol:TCP");
+			}
+
+			g_configSettings->BurstCount = ConvertToIntegral<uint32_t>(ParseArgument(*foundBurstCount, L"-burstcount"));
+			if (g_configSettings->BurstCount == 0ul)
+			{
+				throw invalid_argument("-BurstCount requires a non-zero value");
+			}
+			// always remove the arg from our vector
+			args.erase(foundBurstCount);
+		}
+
+		const auto foundBurstDelay = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-burstdelay");
+				return value != nullptr;
+			});
+		if (foundBurstDelay != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-BurstDelay requires -Protocol:TCP");
+			}
+
+			g_configSettings->BurstDelay = ConvertToIntegral<uint32_t>(ParseArgument(*foundBurstDelay, L"-burstdelay"));
+			if (g_configSettings->BurstDelay == 0ul)
+			{
+				throw invalid_argument("-BurstDelay requires a non-zero value");
+			}
+			// always remove the arg from our vector
+			args.erase(foundBurstDelay);
+		}
+
+		// ReSharper disable CppRedundantParentheses
+		if ((g_configSettings->BurstCount.has_value() && !g_configSettings->BurstDelay.has_value()) ||
+			(!g_configSettings->BurstCount.has_value() && g_configSettings->BurstDelay.has_value()))
+		{
+			throw invalid_argument("-BurstCount and -BurstDelay must both be set if either are set");
+		}
+		// ReSharper restore CppRedundantParentheses
+
+		//
+		// Options for the UDP protocol
+		//
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-BitsPerSecond");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-BitsPerSecond requires -Protocol:UDP");
+			}
+			g_mediaStreamSettings.BitsPerSecond = ConvertToIntegral<int64_t>(
+				ParseArgument(*foundArgument, L"-BitsPerSecond"));
+			// BitsPerSecond must align on a byte-boundary
+			if (g_mediaStreamSettings.BitsPerSecond % 8 != 0)
+			{
+				g_mediaStreamSettings.BitsPerSecond -= g_mediaStreamSettings.BitsPerSecond % 8;
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-FrameRate");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-FrameRate requires -Protocol:UDP");
+			}
+			g_mediaStreamSettings.FramesPerSecond = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-FrameRate"));
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-BufferDepth");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-BufferDepth requires -Protocol:UDP");
+			}
+			g_mediaStreamSettings.BufferDepthSeconds = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-BufferDepth"));
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			// default buffer depth to 1
+			g_mediaStreamSettings.BufferDepthSeconds = 1;
+		}
+
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-StreamLength");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-StreamLength requires -Protocol:UDP");
+			}
+			g_mediaStreamSettings.StreamLengthSeconds = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-StreamLength"));
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-DatagramByteSize");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-DatagramByteSize requires -Protocol:UDP");
+			}
+			g_mediaStreamSettings.DatagramMaxSize = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-DatagramByteSize"));
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			// else set the default value
+			g_mediaStreamSettings.DatagramMaxSize = c_udpDatagramMaximumSizeBytes;
+		}
+
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-UdpOffload");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-UdpOffload requires -Protocol:UDP");
+			}
+			const auto* const value = ParseArgument(*foundArgument, L"-UdpOffload");
+			if (ctString::iordinal_equals(L"on", value))
+			{
+				g_mediaStreamSettings.UdpOffload = true;
+			}
+			else if (ctString::iordinal_equals(L"off", value))
+			{
+				g_mediaStreamSettings.UdpOffload = false;
+			}
+			else
+			{
+				throw invalid_argument("-UdpOffload");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+
+		foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-DatagramBatchSize");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-DatagramBatchSize requires -Protocol:UDP");
+			}
+			g_mediaStreamSettings.DatagramBatchSize = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-DatagramBatchSize"));
+			if (0 == g_mediaStreamSettings.DatagramBatchSize)
+			{
+				throw invalid_argument("-DatagramBatchSize");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+
+		// validate and resolve the UDP protocol options
+		if (ProtocolType::UDP == g_configSettings->Protocol)
+		{
+			if (0 == g_mediaStreamSettings.BitsPerSecond)
+			{
+				throw invalid_argument("-BitsPerSecond is required");
+			}
+			if (0 == g_mediaStreamSettings.FramesPerSecond)
+			{
+				throw invalid_argument("-FrameRate is required");
+			}
+			if (0 == g_mediaStreamSettings.StreamLengthSeconds)
+			{
+				throw invalid_argument("-StreamLength is required");
+			}
+
+			// finally calculate the total stream length after all settings are captured from the user
+			g_transferSizeLow = g_mediaStreamSettings.CalculateTransferSize();
+		}
+	}
+
+	//
+	// Parses for IP address or machine name target to use
+	// Can be comma-delimited if more than one
+	//
+	// 3 different parameters read address/name settings:
+	// Supports specifying the parameter multiple times:
+	//   e.g. -target:machine-a -target:machine-b
+	//
+	// -listen: (address to listen on)
+	//   - specifying * == listen to all addresses
+	// -target: (address to connect to)
+	// -bind:   (address to bind before connecting)
+	//   - specifying * == bind to all addresses (default)
+	//
+	static void ParseForAddress(vector<const wchar_t*>& args)
+	{
+		// -listen:<addr> 
+		auto foundListen = begin(args);
+		while (foundListen != end(args))
+		{
+			foundListen = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+				{
+					const auto* const value = ParseArgument(parameter, L"-listen");
+					return value != nullptr;
+				});
+			if (foundListen != end(args))
+			{
+				const auto* const value = ParseArgument(*foundListen, L"-listen");
+				if (ctString::iordinal_equals(L"*", value))
+				{
+					// add both v4 and v6
+					wil::network::socket_address listenAddr(AF_INET);
+					g_configSettings->ListenAddresses.push_back(listenAddr);
+					listenAddr.reset(AF_INET6);
+					g_configSettings->ListenAddresses.push_back(listenAddr);
+				}
+				else
+				{
+					auto tempAddresses(ResolveNameToAddresses(value));
+					if (tempAddresses.empty())
+					{
+						throw invalid_argument("-listen value did not resolve to an IP address");
+					}
+					g_configSettings->ListenAddresses.insert(end(g_configSettings->ListenAddresses),
+						begin(tempAddresses), end(tempAddresses));
+				}
+				// always remove the arg from our vector
+				args.erase(foundListen);
+				// found_listen is now invalidated since we just erased what it's pointing to
+				// - reset it to begin() since we know it's not end()
+				foundListen = args.begin();
+			}
+		}
+
+		// -target:<addr> 
+		auto foundTarget = begin(args);
+		while (foundTarget != end(args))
+		{
+			foundTarget = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+				{
+					const auto* const value = ParseArgument(parameter, L"-target");
+					return value != nullptr;
+				});
+			if (foundTarget != end(args))
+			{
+				if (!g_configSettings->ListenAddresses.empty())
+				{
+					throw invalid_argument("cannot specify both -Listen and -Target");
+				}
+
+				const auto* const value = ParseArgument(*foundTarget, L"-target");
+				g_configSettings->TargetAddressStrings.emplace_back(value);
+
+				auto tempAddresses(ResolveNameToAddresses(value));
+				if (!tempAddresses.empty())
+				{
+					g_configSettings->TargetAddresses.insert(end(g_configSettings->TargetAddresses),
+						begin(tempAddresses), end(tempAddresses));
+				}
+
+				// always remove the arg from our vector
+				args.erase(foundTarget);
+				// found_target is now invalidated since we just erased what it's pointing to
+				// - reset it to begin() since we know it's not end()
+				foundTarget = args.begin();
+			}
+		}
+
+		// -bind:<addr> 
+		auto foundBind = begin(args);
+		while (foundBind != end(args))
+		{
+			foundBind = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+				{
+					const auto* const value = ParseArgument(parameter, L"-bind");
+					return value != nullptr;
+				});
+			if (foundBind != end(args))
+			{
+				const auto* const value = ParseArgument(*foundBind, L"-bind");
+				// check for a comma-delimited list of IP Addresses
+				if (ctString::iordinal_equals(L"*", value))
+				{
+					// add both v4 and v6
+					wil::network::socket_address bindAddr(AF_INET);
+					g_configSettings->BindAddresses.push_back(bindAddr);
+					bindAddr.reset(AF_INET6);
+					g_configSettings->BindAddresses.push_back(bindAddr);
+				}
+				else
+				{
+					auto tempAddresses(ResolveNameToAddresses(value));
+					if (tempAddresses.empty())
+					{
+						throw invalid_argument("-bind value did not resolve to an IP address");
+					}
+					g_configSettings->BindAddresses.insert(end(g_configSettings->BindAddresses), begin(tempAddresses),
+						end(tempAddresses));
+				}
+				// always remove the arg from our vector
+				args.erase(foundBind);
+				// found_bind is now invalidated since we just erased what it's pointing to
+				// - reset it to begin() since we know it's not end()
+				foundBind = args.begin();
+			}
+		}
+
+		if (!g_configSettings->ListenAddresses.empty() && !g_configSettings->TargetAddresses.empty())
+		{
+			throw invalid_argument("cannot specify both -target and -listen");
+		}
+		if (!g_configSettings->ListenAddresses.empty() && !g_configSettings->BindAddresses.empty())
+		{
+			throw invalid_argument("cannot specify both -bind and -listen");
+		}
+		if (g_configSettings->ListenAddresses.empty() && g_configSettings->TargetAddresses.empty())
+		{
+			throw invalid_argument("must specify either -target or -listen");
+		}
+
+		// default bind addresses if not listening and did not exclusively want to bind
+		if (g_configSettings->ListenAddresses.empty() && g_configSettings->BindAddresses.empty())
+		{
+			wil::network::socket_address defaultAddr(AF_INET);
+			g_configSettings->BindAddresses.push_back(defaultAddr);
+			defaultAddr.reset(AF_INET6);
+			g_configSettings->BindAddresses.push_back(defaultAddr);
+		}
+
+		if (!g_configSettings->TargetAddresses.empty())
+		{
+			//
+			// guarantee that BindAddresses and TargetAddresses families can match
+			// - can't allow a bind address to be chosen if there are no TargetAddresses with the same family
+			//
+			uint32_t bindV4 = 0;
+			uint32_t bindV6 = 0;
+			uint32_t targetV4 = 0;
+			uint32_t targetV6 = 0;
+			for (const auto& addr : g_configSettings->BindAddresses)
+			{
+				if (addr.family() == AF_INET)
+				{
+					++bindV4;
+				}
+				else
+				{
+					++bindV6;
+				}
+			}
+			for (const auto& addr : g_configSettings->TargetAddresses)
+			{
+				if (addr.family() == AF_INET)
+				{
+					++targetV4;
+				}
+				else
+				{
+					++targetV6;
+				}
+			}
+			//
+			// if either bind or target has zero of either family, remove those addresses from the other vector
+			//
+			if (0 == bindV4)
+			{
+				std::erase_if(
+					g_configSettings->TargetAddresses,
+					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET; }
+				);
+			}
+			else if (0 == targetV4)
+			{
+				std::erase_if(
+					g_configSettings->BindAddresses,
+					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET; }
+				);
+			}
+
+			if (0 == bindV6)
+			{
+				std::erase_if(
+					g_configSettings->TargetAddresses,
+					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET6; }
+				);
+			}
+			else if (0 == targetV6)
+			{
+				std::erase_if(
+					g_configSettings->BindAddresses,
+					[](const wil::network::socket_address& addr) noexcept { return addr.family() == AF_INET6; }
+				);
+			}
+			//
+			// now if either are of size zero, the user specified addresses which didn't align
+			//
+			if (g_configSettings->BindAddresses.empty() || g_configSettings->TargetAddresses.empty())
+			{
+				throw invalid_argument("-bind addresses and target addresses must match families");
+			}
+		}
+	}
+
+	//
+	// Parses for the Port # to listen to/connect to
+	//
+	// -Port:##
+	//
+	static void ParseForPort(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-Port");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			g_configSettings->Port = ConvertToIntegral<uint16_t>(ParseArgument(*foundArgument, L"-Port"));
+			if (0 == g_configSettings->Port)
+			{
+				throw invalid_argument("-Port");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the Port # to listen to/connect to
+	//
+	// -PortScalability:<on,off>
+	//
+	static void ParseForPortScalability(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-PortScalability");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-PortScalability");
+			if (ctString::iordinal_equals(L"on", value))
+			{
+				if (g_configSettings->Options & ReuseUnicastPort)
+				{
+					// should only set PortScalability if ReuseUnicastPort has not already been set
+					// ReuseUnicastPort is the preferred socket option over PortScalability
+				}
+				else
+				{
+					g_configSettings->Options |= PortScalability;
+				}
+			}
+			else if (ctString::iordinal_equals(L"off", value))
+			{
+				// no need to update anything
+			}
+			else
+			{
+				throw invalid_argument("-PortScalability");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the connection limit [max number of connections to maintain]
+	//
+	// -connections:####
+	//
+	static void ParseForConnections(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-connections");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (IsListening())
+			{
+				throw invalid_argument("-Connections is only supported when running as a client");
+			}
+			if (!g_configSettings->TrafficClasses.empty())
+			{
+				throw invalid_argument("-Connections cannot be specified with -TrafficClass (specify Connections per class)");
+			}
+			g_configSettings->ConnectionLimit = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-connections"));
+			if (0 == g_configSettings->ConnectionLimit)
+			{
+				throw invalid_argument("-connections");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the server limit [max number of connections before the server exits]
+	//
+	// -ServerExitLimit:####
+	//
+	static void ParseForServerExitLimit(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ServerExitLimit");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (!IsListening())
+			{
+				throw invalid_argument("-ServerExitLimit is only supported when running as a client");
+			}
+			g_configSettings->ServerExitLimit = ConvertToIntegral<uint64_t>(
+				ParseArgument(*foundArgument, L"-ServerExitLimit"));
+			if (0 == g_configSettings->ServerExitLimit)
+			{
+				// zero indicates no exit
+				g_configSettings->ServerExitLimit = MAXULONGLONG;
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the connection limit [max number of connections to maintain]
+	//
+	// -ThrottleConnections:####
+	//
+	static void ParseForThrottleConnections(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ThrottleConnections");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (IsListening())
+			{
+				throw invalid_argument("-ThrottleConnections is only supported when running as a client");
+			}
+			g_configSettings->ConnectionThrottleLimit = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-ThrottleConnections"));
+			if (0 == g_configSettings->ConnectionThrottleLimit)
+			{
+				// zero means no limit
+				g_configSettings->ConnectionThrottleLimit = MAXUINT32;
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the open-loop connection start schedule
+	//
+	// -ConnectionRate:#### (connections started per second)
+	// -ConnectionArrival:<constant,poisson,ramp>
+	// -ConnectionRampTime:#### (milliseconds to ramp up to -ConnectionRate)
+	//
+	static void ParseForConnectionRate(vector<const wchar_t*>& args)
+	{
+		const auto foundRate = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ConnectionRate");
+				return value != nullptr;
+			});
+		if (foundRate != end(args))
+		{
+			if (IsListening())
+			{
+				throw invalid_argument("-ConnectionRate is only supported when running as a client");
+			}
+			g_configSettings->ConnectionRate = ConvertToIntegral<uint32_t>(ParseArgument(*foundRate, L"-ConnectionRate"));
+			if (0 == g_configSettings->ConnectionRate)
+			{
+				throw invalid_argument("-ConnectionRate");
+			}
+			// always remove the arg from our vector
+			args.erase(foundRate);
+		}
+
+		const auto foundArrival = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ConnectionArrival");
+				return value != nullptr;
+			});
+		if (foundArrival != end(args))
+		{
+			if (0 == g_configSettings->ConnectionRate)
+			{
+				throw invalid_argument("-ConnectionArrival requires -ConnectionRate");
+			}
+			const auto* const value = ParseArgument(*foundArrival, L"-ConnectionArrival");
+			if (ctString::iordinal_equals(L"constant", value))
+			{
+				g_configSettings->ConnectionArrival = ConnectionArrivalType::Constant;
+			}
+			else if (ctString::iordinal_equals(L"poisson", value))
+			{
+				g_configSettings->ConnectionArrival = ConnectionArrivalType::Poisson;
+			}
+			else if (ctString::iordinal_equals(L"ramp", value))
+			{
+				g_configSettings->ConnectionArrival = ConnectionArrivalType::Ramp;
+				g_configSettings->ConnectionRampTimeMs = c_defaultConnectionRampTimeMs;
+			}
+			else
+			{
+				throw invalid_argument("-ConnectionArrival");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArrival);
+		}
+
+		const auto foundRampTime = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ConnectionRampTime");
+				return value != nullptr;
+			});
+		if (foundRampTime != end(args))
+		{
+			if (g_configSettings->ConnectionArrival != ConnectionArrivalType::Ramp)
+			{
+				throw invalid_argument("-ConnectionRampTime requires -ConnectionArrival:ramp");
+			}
+			g_configSettings->ConnectionRampTimeMs = ConvertToIntegral<uint32_t>(ParseArgument(*foundRampTime, L"-ConnectionRampTime"));
+			if (0 == g_configSettings->ConnectionRampTimeMs)
+			{
+				throw invalid_argument("-ConnectionRampTime");
+			}
+			// always remove the arg from our vector
+			args.erase(foundRampTime);
+		}
+	}
+
+	template <typename T>
+	static void ReadRangeValues(_In_z_ const wchar_t* value, T& outLow, T& outHigh)
+	{
+		// a range was specified
+		// - find the ',' the '[', and the ']'
+		const auto valueLength = wcslen(value);
+		const auto* const valueEnd = value + valueLength;
+		if (valueLength < 5 || value[0] != L'[' || value[valueLength - 1] != L']')
+		{
+			throw invalid_argument("range value [###,###]");
+		}
+		const auto* const commaDelimiter = find(value, valueEnd, L',');
+		if (!(valueEnd > commaDelimiter + 1))
+		{
+			throw invalid_argument("range value [###,###]");
+		}
+
+		// null-terminate the first number at the delimiter to do a string -> int conversion
+		*const_cast<wchar_t*>(commaDelimiter) = L'\0';
+		const auto* const valueLow = value + 1; // move past the '['
+		outLow = ConvertToIntegral<T>(valueLow);
+
+		// null-terminate for the 2nd number over the last ']' to doa string -> int conversion
+		const_cast<wchar_t*>(value)[valueLength - 1] = L'\0';
+		const auto* const valueHigh = commaDelimiter + 1;
+		outHigh = ConvertToIntegral<T>(valueHigh);
+
+		// validate buffer values
+		if (outHigh < outLow)
+		{
+			throw invalid_argument("range value [###,###]");
+		}
+	}
+
+	//
+	// Parses for the buffer size to push down per IO
+	//
+	// -buffer:####
+	//        :[low,high]
+	//
+	static void ParseForBuffer(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-buffer");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-buffer (only applicable to TCP)");
+			}
+			if (IoPatternType::IdleHold == g_configSettings->IoPattern)
+			{
+				throw invalid_argument("-buffer cannot be used with -Pattern:IdleHold (use -IdleKeepAliveBytes)");
+			}
+
+			const auto* const value = ParseArgument(*foundArgument, L"-buffer");
+			if (value[0] == L'[')
+			{
+				ReadRangeValues(value, g_bufferSizeLow, g_bufferSizeHigh);
+			}
+			else
+			{
+				// singe values are written to g_BufferSizeLow, with g_BufferSizeHigh left at zero
+				g_bufferSizeLow = ConvertToIntegral<uint32_t>(value);
+			}
+			if (0 == g_bufferSizeLow)
+			{
+				throw invalid_argument("-buffer");
+			}
+
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			g_bufferSizeLow = c_defaultBufferSize;
+			g_bufferSizeHigh = 0;
+		}
+	}
+
+	//
+	// Parses for the bounds of the AcceptEx requests kept pended per listener
+	//
+	// -AcceptDepth:####
+	//             :[low,high]
+	//
+	static void ParseForAcceptDepth(vector<const wchar_t*>& args)
+	{
+		g_configSettings->AcceptDepthLow = c_defaultAcceptDepthLow;
+		g_configSettings->AcceptDepthHigh = c_defaultAcceptDepthHigh;
+
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-AcceptDepth");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			// parsed after ParseForAccept, which names the accept function for servers only
+			if (nullptr == g_acceptFunctionName || wstring(g_acceptFunctionName) != L"AcceptEx")
+			{
+				throw invalid_argument("-AcceptDepth is only supported when accepting connections with AcceptEx");
+			}
+
+			const auto* const value = ParseArgument(*foundArgument, L"-AcceptDepth");
+			if (value[0] == L'[')
+			{
+				ReadRangeValues(value, g_configSettings->AcceptDepthLow, g_configSettings->AcceptDepthHigh);
+			}
+			else
+			{
+				// a single value fixes the depth
+				g_configSettings->AcceptDepthLow = ConvertToIntegral<uint32_t>(value);
+				g_configSettings->AcceptDepthHigh = g_configSettings->AcceptDepthLow;
+			}
+			if (0 == g_configSettings->AcceptDepthLow)
+			{
+				throw invalid_argument("-AcceptDepth");
+			}
+
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the number of shards to split the AcceptEx requests of each listener across
+	//
+	// -AcceptShards:####
+	//
+	static void ParseForAcceptShards(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-AcceptShards");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			// parsed after ParseForAccept, which names the accept function for servers only
+			if (nullptr == g_acceptFunctionName || wstring(g_acceptFunctionName) != L"AcceptEx")
+			{
+				throw invalid_argument("-AcceptShards is only supported when accepting connections with AcceptEx");
+			}
+
+			g_configSettings->AcceptShards = ConvertToIntegral<uint32_t>(ParseArgument(*foundArgument, L"-AcceptShards"));
+			if (0 == g_configSettings->AcceptShards)
+			{
+				throw invalid_argument("-AcceptShards");
+			}
+
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the total transfer size in bytes per connection
+	//
+	// -transfer:####
+	//          :[low,high]
+	//
+	static void ParseForTransfer(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-transfer");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-transfer (only applicable to TCP)");
+			}
+			if (IoPatternType::IdleHold == g_configSettings->IoPattern)
+			{
+				throw invalid_argument("-transfer cannot be used with -Pattern:IdleHold (use -IdleHoldTime)");
+			}
+
+			const auto* const value = ParseArgument(*foundArgument, L"-transfer");
+			if (value[0] == L'[')
+			{
+				ReadRangeValues(value, g_transferSizeLow, g_transferSizeHigh);
+			}
+			else
+			{
+				// singe values are written to g_TransferSizeLow, with g_TransferSizeHigh left at zero
+				g_transferSizeLow = ConvertToIntegral<uint64_t>(value);
+			}
+			if (0 == g_transferSizeLow)
+			{
+				throw invalid_argument("-transfer");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the number of transfers run on each TCP connection, and the idle time between them
+	// - the number of transfers must match on the client and server
+	//
+	// -TransfersPerConnection:####
+	// -TransferGap:####
+	//
+	static void ParseForTransfersPerConnection(vector<const wchar_t*>& args)
+	{
+		const auto foundTransfers = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-TransfersPerConnection");
+				return value != nullptr;
+			});
+		if (foundTransfers != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-TransfersPerConnection (only applicable to TCP)");
+			}
+			if (IoPatternType::IdleHold == g_configSettings->IoPattern)
+			{
+				throw invalid_argument("-TransfersPerConnection cannot be used with -Pattern:IdleHold");
+			}
+
+			g_configSettings->TransfersPerConnection = ConvertToIntegral<uint32_t>(ParseArgument(*foundTransfers, L"-TransfersPerConnection"));
+			if (0 == g_configSettings->TransfersPerConnection)
+			{
+				throw invalid_argument("-TransfersPerConnection must be greater than zero");
+			}
+			// always remove the arg from our vector
+			args.erase(foundTransfers);
+		}
+
+		const auto foundGap = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-TransferGap");
+				return value != nullptr;
+			});
+		if (foundGap != end(args))
+		{
+			if (g_configSettings->TransfersPerConnection < 2)
+			{
+				throw invalid_argument("-TransferGap requires -TransfersPerConnection greater than 1");
+			}
+			if (IsListening())
+			{
+				throw invalid_argument("-TransferGap is only supported when running as a client");
+			}
+
+			g_configSettings->TransferGapMs = ConvertToIntegral<uint32_t>(ParseArgument(*foundGap, L"-TransferGap"));
+			// always remove the arg from our vector
+			args.erase(foundGap);
+		}
+	}
+
+	//
+	// Parses for the options tightly coupled to -Pattern:IdleHold
+	// - the buffer size is the keepalive payload size
+	// - the transfer size is the bytes sent and received over all keepalive exchanges
+	//   (these must match on the client and server)
+	//
+	// -IdleKeepAlive:####
+	// -IdleKeepAliveBytes:####
+	// -IdleHoldTime:####
+	//
+	static void ParseForIdleHold(vector<const wchar_t*>& args)
+	{
+		const auto foundInterval = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-idlekeepalive");
+				return value != nullptr;
+			});
+		if (foundInterval != end(args))
+		{
+			if (g_configSettings->IoPattern != IoPatternType::IdleHold)
+			{
+				throw invalid_argument("-IdleKeepAlive can only be set with -Pattern:IdleHold");
+			}
+			g_configSettings->IdleKeepAliveIntervalMs = ConvertToIntegral<uint32_t>(ParseArgument(*foundInterval, L"-idlekeepalive"));
+			if (0 == g_configSettings->IdleKeepAliveIntervalMs)
+			{
+				throw invalid_argument("-IdleKeepAlive must be greater than zero");
+			}
+			// always remove the arg from our vector
+			args.erase(foundInterval);
+		}
+		else
+		{
+			g_configSettings->IdleKeepAliveIntervalMs = c_defaultIdleKeepAliveIntervalMs;
+		}
+
+		const auto foundBytes = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-idlekeepalivebytes");
+				return value != nullptr;
+			});
+		if (foundBytes != end(args))
+		{
+			if (g_configSettings->IoPattern != IoPatternType::IdleHold)
+			{
+				throw invalid_argument("-IdleKeepAliveBytes can only be set with -Pattern:IdleHold");
+			}
+			g_configSettings->IdleKeepAliveBytes = ConvertToIntegral<uint32_t>(ParseArgument(*foundBytes, L"-idlekeepalivebytes"));
+			if (0 == g_configSettings->IdleKeepAliveBytes || g_configSettings->IdleKeepAliveBytes > c_maxIdleKeepAliveBytes)
+			{
+				throw invalid_argument("-IdleKeepAliveBytes must be between 1 and 65536");
+			}
+			// always remove the arg from our vector
+			args.erase(foundBytes);
+		}
+		else
+		{
+			g_configSettings->IdleKeepAliveBytes = c_defaultIdleKeepAliveBytes;
+		}
+
+		const auto foundHoldTime = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-idleholdtime");
+				return value != nullptr;
+			});
+		if (foundHoldTime != end(args))
+		{
+			if (g_configSettings->IoPattern != IoPatternType::IdleHold)
+			{
+				throw invalid_argument("-IdleHoldTime can only be set with -Pattern:IdleHold");
+			}
+			g_configSettings->IdleHoldTimeMs = ConvertToIntegral<uint32_t>(ParseArgument(*foundHoldTime, L"-idleholdtime"));
+			// always remove the arg from our vector
+			args.erase(foundHoldTime);
+		}
+
+		if (g_configSettings->IoPattern == IoPatternType::IdleHold)
+		{
+			// a hold time of zero holds connections until the run ends (-TimeLimit or ctrl-c)
+			const uint64_t keepAliveExchanges = 0 == g_configSettings->IdleHoldTimeMs ?
+				MAXDWORD :
+				std::max<uint64_t>(1, g_configSettings->IdleHoldTimeMs / g_configSettings->IdleKeepAliveIntervalMs);
+
+			g_bufferSizeLow = g_configSettings->IdleKeepAliveBytes;
+			g_bufferSizeHigh = 0;
+			// each exchange is a send and a recv of the keepalive payload
+			g_transferSizeLow = keepAliveExchanges * g_configSettings->IdleKeepAliveBytes * 2;
+			g_transferSizeHigh = 0;
+		}
+	}
+
+	//
+	// Parses for the LocalPort # to bind for local connect
+	// 
+	// -LocalPort:##
+	//
+	static void ParseForLocalPort(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-LocalPort");
+				return value != nullptr;
+			});
+
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-LocalPort");
+			if (value[0] == L'[')
+			{
+				ReadRangeValues(value, g_configSettings->LocalPortLow, g_configSettings->LocalPortHigh);
+			}
+			else
+			{
+				// single value are written to LocalPortLow with LocalPortHigh left at zero
+				g_configSettings->LocalPortHigh = 0;
+				g_configSettings->LocalPortLow = ConvertToIntegral<uint16_t>(value);
+			}
+			if (0 == g_configSettings->LocalPortLow)
+			{
+				throw invalid_argument("-LocalPort");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for an explicitly specified interface index for outgoing connections
+	// 
+	// -IfIndex:##
+	//
+	static void ParseForIfIndex(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-IfIndex");
+				return value != nullptr;
+			});
+
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-IfIndex");
+			g_configSettings->OutgoingIfIndex = ConvertToIntegral<uint32_t>(value);
+
+			if (0 == g_configSettings->OutgoingIfIndex)
+			{
+				throw invalid_argument("-IfIndex");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for Tcp throttling parameters
+	//
+	// -RateLimit:####
+	//           :[low,high]
+	// -RateLimitPeriod:####
+	//
+	static void ParseForRateLimit(vector<const wchar_t*>& args)
+	{
+		const auto foundRateLimit = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-RateLimit");
+				return value != nullptr;
+			});
+		if (foundRateLimit != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-RateLimit (only applicable to TCP)");
+			}
+
+			const auto* const value = ParseArgument(*foundRateLimit, L"-RateLimit");
+			if (value[0] == L'[')
+			{
+				ReadRangeValues(value, g_rateLimitLow, g_rateLimitLow);
+			}
+			else
+			{
+				// singe values are written to g_BufferSizeLow, with g_BufferSizeHigh left at zero
+				g_rateLimitLow = ConvertToIntegral<int64_t>(ParseArgument(*foundRateLimit, L"-RateLimit"));
+			}
+			if (0LL == g_rateLimitLow)
+			{
+				throw invalid_argument("-RateLimit");
+			}
+			// always remove the arg from our vector
+			args.erase(foundRateLimit);
+		}
+
+		const auto foundRateLimitPeriod = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-RateLimitPeriod");
+				return value != nullptr;
+			});
+		if (foundRateLimitPeriod != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP)
+			{
+				throw invalid_argument("-RateLimitPeriod (only applicable to TCP)");
+			}
+			const auto classRateLimit = ranges::any_of(g_configSettings->TrafficClasses, [](const ctsTrafficClass& trafficClass) noexcept {
+				return trafficClass.RateLimitLow != 0;
+			});
+			if (0LL == g_rateLimitLow && !classRateLimit)
+			{
+				throw invalid_argument("-RateLimitPeriod requires specifying -RateLimit");
+			}
+			g_configSettings->TcpBytesPerSecondPeriod = ConvertToIntegral<int64_t>(
+				ParseArgument(*foundRateLimitPeriod, L"-RateLimitPeriod"));
+			// always remove the arg from our vector
+			args.erase(foundRateLimitPeriod);
+		}
+	}
+
+	//
+	// Parses for a single size or rate field within a -TrafficClass value
+	//
+	// ####
+	// [low,high]
+	//
+	template <typename T>
+	static void ReadTrafficClassRange(wstring& value, T& outLow, T& outHigh, _In_z_ const char* fieldName)
+	{
+		if (value[0] == L'[')
+		{
+			// ReadRangeValues null-terminates within the buffer - which is our own copy
+			ReadRangeValues(value.data(), outLow, outHigh);
+		}
+		else
+		{
+			outLow = ConvertToIntegral<T>(value);
+			outHigh = 0;
+		}
+		if (0 == outLow)
+		{
+			throw invalid_argument(string("-TrafficClass ") + fieldName + " must be greater than zero");
+		}
+	}
+
+	//
+	// Parses for the set of traffic classes to run concurrently from a single client
+	//
+	// -TrafficClass:<name>,Pattern=<push|pull|pushpull|duplex>,Connections=####[,Buffer=####][,Transfer=####][,RateLimit=####][,Target=<addr>]
+	// - Buffer, Transfer, and RateLimit also accept a range: [low,high]
+	// - can be specified multiple times, once per class
+	//
+	static void ParseForTrafficClass(vector<const wchar_t*>& args)
+	{
+		auto foundArgument = begin(args);
+		while (foundArgument != end(args))
+		{
+			foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+				{
+					const auto* const value = ParseArgument(parameter, L"-TrafficClass");
+					return value != nullptr;
+				});
+			if (foundArgument != end(args))
+			{
+				if (IsListening())
+				{
+					throw invalid_argument("-TrafficClass is only supported when running as a client");
+				}
+				if (g_configSettings->Protocol != ProtocolType::TCP)
+				{
+					throw invalid_argument("-TrafficClass (only applicable to TCP)");
+				}
+				if (IoPatternType::IdleHold == g_configSettings->IoPattern)
+				{
+					throw invalid_argument("-TrafficClass cannot be used with -Pattern:IdleHold");
+				}
+				if (g_configSettings->TrafficClasses.size() == c_maxTrafficClasses)
+				{
+					throw invalid_argument("-TrafficClass exceeded the maximum number of traffic classes");
+				}
+
+				// split the value on commas which are not within a [low,high] range
+				vector<wstring> fields;
+				wstring currentField;
+				auto withinRange = false;
+				for (const auto* value = ParseArgument(*foundArgument, L"-TrafficClass"); *value != L'\0'; ++value)
+				{
+					if (*value == L',' && !withinRange)
+					{
+						fields.emplace_back(std::move(currentField));
+						currentField.clear();
+						continue;
+					}
+					if (*value == L'[')
+					{
+						withinRange = true;
+					}
+					else if (*value == L']')
+					{
+						withinRange = false;
+					}
+					currentField.push_back(*value);
+				}
+				fields.emplace_back(std::move(currentField));
+
+				ctsTrafficClass newClass;
+				newClass.Name = fields[0];
+				if (newClass.Name.empty() || newClass.Name.find(L'=') != wstring::npos)
+				{
+					throw invalid_argument("-TrafficClass must start with the name of the class");
+				}
+				for (const auto& existingClass : g_configSettings->TrafficClasses)
+				{
+					if (ctString::iordinal_equals(existingClass.Name, newClass.Name))
+					{
+						throw invalid_argument("-TrafficClass names must be unique");
+					}
+				}
+				newClass.IoPattern = g_configSettings->IoPattern;
+
+				for (auto field = fields.begin() + 1; field != fields.end(); ++field)
+				{
+					const auto delimiter = field->find(L'=');
+					if (delimiter == wstring::npos || delimiter + 1 == field->size())
+					{
+						throw invalid_argument("-TrafficClass fields must be specified as <name>=<value>");
+					}
+					const auto fieldName = field->substr(0, delimiter);
+					auto fieldValue = field->substr(delimiter + 1);
+
+					if (ctString::iordinal_equals(L"Pattern", fieldName))
+					{
+						newClass.IoPattern = ConvertToIoPattern(fieldValue.c_str());
+						if (IoPatternType::NoIoSet == newClass.IoPattern)
+						{
+							throw invalid_argument("-TrafficClass Pattern");
+						}
+						if (IoPatternType::IdleHold == newClass.IoPattern)
+						{
+							throw invalid_argument("-TrafficClass does not support Pattern=IdleHold");
+						}
+					}
+					else if (ctString::iordinal_equals(L"Connections", fieldName))
+					{
+						newClass.ConnectionLimit = ConvertToIntegral<uint32_t>(fieldValue);
+						if (0 == newClass.ConnectionLimit)
+						{
+							throw invalid_argument("-TrafficClass Connections must be greater than zero");
+						}
+					}
+					else if (ctString::iordinal_equals(L"Buffer", fieldName))
+					{
+						ReadTrafficClassRange(fieldValue, newClass.BufferSizeLow, newClass.BufferSizeHigh, "Buffer");
+					}
+					else if (ctString::iordinal_equals(L"Transfer", fieldName))
+					{
+						ReadTrafficClassRange(fieldValue, newClass.TransferSizeLow, newClass.TransferSizeHigh, "Transfer");
+					}
+					else if (ctString::iordinal_equals(L"RateLimit", fieldName))
+					{
+						ReadTrafficClassRange(fieldValue, newClass.RateLimitLow, newClass.RateLimitHigh, "RateLimit");
+					}
+					else if (ctString::iordinal_equals(L"Target", fieldName))
+					{
+						auto tempAddresses(ResolveNameToAddresses(fieldValue.c_str()));
+						for (auto& address : tempAddresses)
+						{
+							if (0 == address.port())
+							{
+								address.set_port(g_configSettings->Port);
+							}
+						}
+						// only keep targets which can be reached from one of the bind addresses
+						std::erase_if(tempAddresses, [](const wil::network::socket_address& target) {
+							return ranges::none_of(g_configSettings->BindAddresses, [&](const wil::network::socket_address& bind) noexcept {
+								return bind.family() == target.family();
+							});
+						});
+						if (tempAddresses.empty())
+						{
+							throw invalid_argument("-TrafficClass Target did not resolve to an IP address matching the -bind addresses");
+						}
+						newClass.TargetAddresses.insert(end(newClass.TargetAddresses), begin(tempAddresses), end(tempAddresses));
+					}
+					else
+					{
+						throw invalid_argument("-TrafficClass contained an unknown field");
+					}
+				}
+
+				if (0 == newClass.ConnectionLimit)
+				{
+					throw invalid_argument("-TrafficClass requires specifying Connections=####");
+				}
+				g_configSettings->TrafficClasses.emplace_back(std::move(newClass));
+
+				// always remove the arg from our vector
+				args.erase(foundArgument);
+				// foundArgument is now invalidated since we just erased what it's pointing to
+				// - reset it to begin() since we know it's not end()
+				foundArgument = args.begin();
+			}
+		}
+
+		if (!g_configSettings->TrafficClasses.empty())
+		{
+			// the total connection limit is the sum of all classes
+			g_configSettings->ConnectionLimit = 0;
+			for (const auto& trafficClass : g_configSettings->TrafficClasses)
+			{
+				g_configSettings->ConnectionLimit += trafficClass.ConnectionLimit;
+			}
+		}
+	}
+
+	//
+	// Parses for the total # of iterations
+	//
+	// -Iterations:####
+	//
+	static void ParseForIterations(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-Iterations");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (IsListening())
+			{
+				throw invalid_argument("-Iterations is only supported when running as a client");
+			}
+			g_configSettings->Iterations = ConvertToIntegral<uint64_t>(ParseArgument(*foundArgument, L"-Iterations"));
+			if (0 == g_configSettings->Iterations)
+			{
+				g_configSettings->Iterations = MAXULONGLONG;
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the verbosity level
+	//
+	// -ConsoleVerbosity:## <0-6>
+	// -StatusUpdate:####
+	//
+	static void ParseForLogging(vector<const wchar_t*>& args)
+	{
+		const auto foundVerbosity = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ConsoleVerbosity");
+				return value != nullptr;
+			});
+		if (foundVerbosity != end(args))
+		{
+			g_consoleVerbosity = ConvertToIntegral<uint32_t>(ParseArgument(*foundVerbosity, L"-ConsoleVerbosity"));
+			if (g_consoleVerbosity > 6)
+			{
+				throw invalid_argument("-ConsoleVerbosity");
+			}
+			// always remove the arg from our vector
+			args.erase(foundVerbosity);
+		}
+
+		const auto foundStatusUpdate = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-StatusUpdate");
+				return value != nullptr;
+			});
+		if (foundStatusUpdate != end(args))
+		{
+			g_configSettings->StatusUpdateFrequencyMilliseconds = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundStatusUpdate, L"-StatusUpdate"));
+			if (0 == g_configSettings->StatusUpdateFrequencyMilliseconds)
+			{
+				throw invalid_argument("-StatusUpdate");
+			}
+			// always remove the arg from our vector
+			args.erase(foundStatusUpdate);
+		}
+
+		wstring connectionFilename;
+		wstring errorFilename;
+		wstring statusFilename;
+		wstring jitterFilename;
+		wstring tcpInfoFilename;
+
+		const auto foundConnectionFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ConnectionFilename");
+				return value != nullptr;
+			});
+		if (foundConnectionFilename != end(args))
+		{
+			connectionFilename = ParseArgument(*foundConnectionFilename, L"-ConnectionFilename");
+			// always remove the arg from our vector
+			args.erase(foundConnectionFilename);
+		}
+
+		const auto foundErrorFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ErrorFilename");
+				return value != nullptr;
+			});
+		if (foundErrorFilename != end(args))
+		{
+			errorFilename = ParseArgument(*foundErrorFilename, L"-ErrorFilename");
+			// always remove the arg from our vector
+			args.erase(foundErrorFilename);
+		}
+
+		const auto foundStatusFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-StatusFilename");
+				return value != nullptr;
+			});
+		if (foundStatusFilename != end(args))
+		{
+			statusFilename = ParseArgument(*foundStatusFilename, L"-StatusFilename");
+			// always remove the arg from our vector
+			args.erase(foundStatusFilename);
+		}
+
+		const auto foundJitterFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-JitterFilename");
+				return value != nullptr;
+			});
+		if (foundJitterFilename != end(args))
+		{
+			jitterFilename = ParseArgument(*foundJitterFilename, L"-JitterFilename");
+			// always remove the arg from our vector
+			args.erase(foundJitterFilename);
+		}
+
+		const auto foundTcpInfoFilename = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-TcpInfoFilename");
+				return value != nullptr;
+			});
+		if (foundTcpInfoFilename != end(args))
+		{
+			tcpInfoFilename = ParseArgument(*foundTcpInfoFilename, L"-TcpInfoFilename");
+			// always remove the arg from our vector
+			args.erase(foundTcpInfoFilename);
+		}
+
+		// since CSV files each have their own header, we cannot allow the same CSV filename to be used
+		// for different loggers, as opposed to txt files, which can be shared across different loggers
+
+		if (!connectionFilename.empty())
+		{
+			if (ctString::iends_with(connectionFilename, L".csv"))
+			{
+				g_connectionLogger = make_shared<ctsTextLogger>(connectionFilename.c_str(), StatusFormatting::Csv);
+			}
+			else
+			{
+				g_connectionLogger = make_shared<
+					ctsTextLogger>(connectionFilename.c_str(), StatusFormatting::ClearText);
+			}
+		}
+
+		if (!errorFilename.empty())
+		{
+			if (ctString::iordinal_equals(connectionFilename, errorFilename))
+			{
+				if (g_connectionLogger->IsCsvFormat())
+				{
+					throw invalid_argument("The error logfile cannot be of csv format");
+				}
+				g_errorLogger = g_connectionLogger;
+			}
+			else
+			{
+				if (ctString::iends_with(errorFilename, L".csv"))
+				{
+					throw invalid_argument("The error logfile cannot be of csv format");
+				}
+				g_errorLogger = make_shared<ctsTextLogger>(errorFilename.c_str(), StatusFormatting::ClearText);
+			}
+		}
+
+		if (!statusFilename.empty())
+		{
+			if (ctString::iordinal_equals(connectionFilename, statusFilename))
+			{
+				if (g_connectionLogger->IsCsvFormat())
+				{
+					throw invalid_argument("The same csv filename cannot be used for different loggers");
+				}
+				g_statusLogger = g_connectionLogger;
+			}
+			else if (ctString::iordinal_equals(errorFilename, statusFilename))
+			{
+				if (g_errorLogger->IsCsvFormat())
+				{
+					throw invalid_argument("The same csv filename cannot be used for different loggers");
+				}
+				g_statusLogger = g_errorLogger;
+			}
+			else
+			{
+				if (ctString::iends_with(statusFilename, L".csv"))
+				{
+					g_statusLogger = make_shared<ctsTextLogger>(statusFilename.c_str(), StatusFormatting::Csv);
+				}
+				else
+				{
+					g_statusLogger = make_shared<ctsTextLogger>(statusFilename.c_str(), StatusFormatting::ClearText);
+				}
+			}
+		}
+
+		if (!jitterFilename.empty())
+		{
+			if (ctString::iends_with(jitterFilename, L".csv"))
+			{
+				if (ctString::iordinal_equals(connectionFilename, jitterFilename) ||
+					ctString::iordinal_equals(errorFilename, jitterFilename) ||
+					ctString::iordinal_equals(statusFilename, jitterFilename))
+				{
+					throw invalid_argument("The same csv filename cannot be used for different loggers");
+				}
+				g_jitterLogger = make_shared<ctsTextLogger>(jitterFilename.c_str(), StatusFormatting::Csv);
+			}
+			else
+			{
+				throw invalid_argument("Jitter can only be logged using a csv format");
+			}
+		}
+
+		if (!tcpInfoFilename.empty())
+		{
+			if (ctString::iends_with(tcpInfoFilename, L".csv"))
+			{
+				if (ctString::iordinal_equals(connectionFilename, tcpInfoFilename) ||
+					ctString::iordinal_equals(errorFilename, tcpInfoFilename) ||
+					ctString::iordinal_equals(statusFilename, tcpInfoFilename) ||
+					ctString::iordinal_equals(jitterFilename, tcpInfoFilename))
+				{
+					throw invalid_argument("The same csv filename cannot be used for different loggers");
+				}
+				g_tcpInfoLogger = make_shared<ctsTextLogger>(tcpInfoFilename.c_str(), StatusFormatting::Csv);
+			}
+			else
+			{
+				throw invalid_argument("TCP Info can only be logged using a csv format");
+			}
+		}
+	}
+
+	//
+	// Sets error policy
+	//
+	// -OnError:<log,break>
+	//
+	static void ParseForError(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-OnError");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-OnError");
+			if (ctString::iordinal_equals(L"log", value))
+			{
+				g_breakOnError = false;
+			}
+			else if (ctString::iordinal_equals(L"break", value))
+			{
+				g_breakOnError = true;
+			}
+			else
+			{
+				throw invalid_argument("-OnError");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Sets optional PrePostRecvs value
+	//
+	// -PrePostRecvs:#####
+	//
+	static void ParseForPrePostRecvs(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-PrePostRecvs");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			g_configSettings->PrePostRecvs = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-PrePostRecvs"));
+			if (0 == g_configSettings->PrePostRecvs)
+			{
+				throw invalid_argument("-PrePostRecvs");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			g_configSettings->PrePostRecvs = ProtocolType::TCP == g_configSettings->Protocol ? 1 : 2;
+		}
+	}
+
+	//
+	// Sets optional PrePostSends value
+	//
+	// -PrePostSends:#####
+	//
+	static void ParseForPrePostSends(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-PrePostSends");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			g_configSettings->PrePostSends = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-PrePostSends"));
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+		else
+		{
+			g_configSettings->PrePostSends = 1;
+			if (WI_IsFlagSet(g_configSettings->SocketFlags, WSA_FLAG_REGISTERED_IO))
+			{
+				// 0 PrePostSends == rely on ISB
+				g_configSettings->PrePostSends = 0;
+			}
+		}
+	}
+
+	//
+	// Sets optional SO_RCVBUF value
+	//
+	// -RecvBufValue:#####
+	//
+	static void ParseForRecvBufValue(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-RecvBufValue");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			g_configSettings->RecvBufValue = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-RecvBufValue"));
+			g_configSettings->Options |= SetRecvBuf;
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Sets optional SO_SNDBUF value
+	//
+	// -SendBufValue:#####
+	//
+	static void ParseForSendBufValue(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SendBufValue");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			g_configSettings->SendBufValue = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundArgument, L"-SendBufValue"));
+			g_configSettings->Options |= SetSendBuf;
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Sets the option to receive directly into the posted receive buffers
+	// - SO_RCVBUF is set to zero so the stack doesn't buffer data ahead of the posted receives
+	//   the data is then placed directly into the receive buffer posted when the data arrives
+	// - only applicable to -IO:iocp with inline completions, which tracks the bytes the stack still buffered
+	//
+	// -ZeroCopyRecv:on
+	// -ZeroCopyRecv:off
+	//
+	static void ParseForZeroCopyRecv(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ZeroCopyRecv");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-ZeroCopyRecv");
+			if (ctString::iordinal_equals(L"on", value))
+			{
+				if (g_configSettings->Protocol != ProtocolType::TCP || IoFunctionType::Iocp != g_ioFunctionType)
+				{
+					throw invalid_argument("-ZeroCopyRecv requires -IO:iocp");
+				}
+				// receives completed inline are how the bytes the stack had already buffered are counted
+				if (!(g_configSettings->Options & HandleInlineIocp))
+				{
+					throw invalid_argument("-ZeroCopyRecv cannot be used with -InlineCompletions:off");
+				}
+				if (g_configSettings->Options & SetRecvBuf)
+				{
+					throw invalid_argument("-ZeroCopyRecv cannot be used with -RecvBufValue (it sets SO_RCVBUF to 0)");
+				}
+				g_configSettings->Options |= ZeroCopyRecv;
+				g_configSettings->Options |= SetRecvBuf;
+				g_configSettings->RecvBufValue = 0;
+			}
+			else if (!ctString::iordinal_equals(L"off", value))
+			{
+				throw invalid_argument("-ZeroCopyRecv");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Sets the option to send directly from the shared send buffer
+	// - SO_SNDBUF is set to zero so the TCP stack doesn't copy send buffers into its own buffers
+	//   each send then completes once the peer acknowledges the data
+	// - only applicable to -IO:iocp with inline completions, which tracks how many sends the stack still copied
+	//
+	// -ZeroCopySend:on
+	// -ZeroCopySend:off
+	//
+	static void ParseForZeroCopySend(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ZeroCopySend");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-ZeroCopySend");
+			if (ctString::iordinal_equals(L"on", value))
+			{
+				if (g_configSettings->Protocol != ProtocolType::TCP || IoFunctionType::Iocp != g_ioFunctionType)
+				{
+					throw invalid_argument("-ZeroCopySend requires -IO:iocp");
+				}
+				// sends completed inline are how the sends the stack copied are counted
+				if (!(g_configSettings->Options & HandleInlineIocp))
+				{
+					throw invalid_argument("-ZeroCopySend cannot be used with -InlineCompletions:off");
+				}
+				if (g_configSettings->Options & SetSendBuf)
+				{
+					throw invalid_argument("-ZeroCopySend cannot be used with -SendBufValue (it sets SO_SNDBUF to 0)");
+				}
+				g_configSettings->Options |= ZeroCopySend;
+				g_configSettings->Options |= SetSendBuf;
+				g_configSettings->SendBufValue = 0;
+			}
+			else if (!ctString::iordinal_equals(L"off", value))
+			{
+				throw invalid_argument("-ZeroCopySend");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the file-backed transfer options
+	// - senders stream from -SendFile with TransmitFile instead of sending from the shared buffer
+	// - receivers write all data received to -RecvFile
+	// - only applicable to -IO:iocp
+	//
+	// -SendFile:<path>
+	// -SendFileSize:#### (generates -SendFile with the verification pattern)
+	// -SendFileCache:<warm,cold>
+	// -RecvFile:<path>
+	// -RecvFileMode:<buffered,unbuffered>
+	//
+	static void ParseForFileTransfer(vector<const wchar_t*>& args)
+	{
+		const auto foundSendFile = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SendFile");
+				return value != nullptr;
+			});
+		if (foundSendFile != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP || IoFunctionType::Iocp != g_ioFunctionType)
+			{
+				throw invalid_argument("-SendFile requires -IO:iocp");
+			}
+			// TransmitFile sends never complete before the stack has the data, so there's nothing for -ZeroCopySend to count
+			if (g_configSettings->Options & ZeroCopySend)
+			{
+				throw invalid_argument("-SendFile cannot be used with -ZeroCopySend");
+			}
+			g_configSettings->SendFilePath = ParseArgument(*foundSendFile, L"-SendFile");
+			if (g_configSettings->SendFilePath.empty())
+			{
+				throw invalid_argument("-SendFile");
+			}
+			// always remove the arg from our vector
+			args.erase(foundSendFile);
+		}
+
+		const auto foundSendFileSize = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SendFileSize");
+				return value != nullptr;
+			});
+		if (foundSendFileSize != end(args))
+		{
+			if (g_configSettings->SendFilePath.empty())
+			{
+				throw invalid_argument("-SendFileSize requires -SendFile");
+			}
+			g_configSettings->SendFileSize = ConvertToIntegral<uint64_t>(ParseArgument(*foundSendFileSize, L"-SendFileSize"));
+			if (g_configSettings->SendFileSize < uint64_t{ctsIoPattern::GetSharedBufferPatternSize()} + GetMaxBufferSize())
+			{
+				throw invalid_argument("-SendFileSize must be at least 64KB larger than the largest -Buffer");
+			}
+			// always remove the arg from our vector
+			args.erase(foundSendFileSize);
+		}
+		else if (!g_configSettings->SendFilePath.empty() && g_configSettings->ShouldVerifyBuffers)
+		{
+			// an existing file can hold anything: only the bytes transferred can be verified
+			throw invalid_argument("-SendFile without -SendFileSize sends the existing file as-is and requires -Verify:connection");
+		}
+
+		const auto foundSendFileCache = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SendFileCache");
+				return value != nullptr;
+			});
+		if (foundSendFileCache != end(args))
+		{
+			if (g_configSettings->SendFilePath.empty())
+			{
+				throw invalid_argument("-SendFileCache requires -SendFile");
+			}
+			const auto* const value = ParseArgument(*foundSendFileCache, L"-SendFileCache");
+			if (ctString::iordinal_equals(L"cold", value))
+			{
+				g_configSettings->SendFileCold = true;
+			}
+			else if (!ctString::iordinal_equals(L"warm", value))
+			{
+				throw invalid_argument("-SendFileCache");
+			}
+			// always remove the arg from our vector
+			args.erase(foundSendFileCache);
+		}
+
+		const auto foundRecvFile = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-RecvFile");
+				return value != nullptr;
+			});
+		if (foundRecvFile != end(args))
+		{
+			if (g_configSettings->Protocol != ProtocolType::TCP || IoFunctionType::Iocp != g_ioFunctionType)
+			{
+				throw invalid_argument("-RecvFile requires -IO:iocp");
+			}
+			g_configSettings->RecvFilePath = ParseArgument(*foundRecvFile, L"-RecvFile");
+			if (g_configSettings->RecvFilePath.empty())
+			{
+				throw invalid_argument("-RecvFile");
+			}
+			// always remove the arg from our vector
+			args.erase(foundRecvFile);
+		}
+
+		const auto foundRecvFileMode = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-RecvFileMode");
+				return value != nullptr;
+			});
+		if (foundRecvFileMode != end(args))
+		{
+			if (g_configSettings->RecvFilePath.empty())
+			{
+				throw invalid_argument("-RecvFileMode requires -RecvFile");
+			}
+			const auto* const value = ParseArgument(*foundRecvFileMode, L"-RecvFileMode");
+			if (ctString::iordinal_equals(L"unbuffered", value))
+			{
+				g_configSettings->RecvFileUnbuffered = true;
+			}
+			else if (!ctString::iordinal_equals(L"buffered", value))
+			{
+				throw invalid_argument("-RecvFileMode");
+			}
+			// always remove the arg from our vector
+			args.erase(foundRecvFileMode);
+		}
+	}
+
+	//
+	// Parses for the pool of sockets created ahead of the connections that take them
+	// - only applicable to clients creating sockets with WSASocket
+	//
+	// -SocketPool:#### (the number of sockets to keep ready per traffic class)
+	// -SocketPoolLow:#### (refill the pool once below this many sockets - defaults to half of -SocketPool)
+	// -SocketPoolBind:<on,off>
+	//
+	static void ParseForSocketPool(vector<const wchar_t*>& args)
+	{
+		const auto foundSocketPool = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SocketPool");
+				return value != nullptr;
+			});
+		if (foundSocketPool != end(args))
+		{
+			if (IsListening())
+			{
+				throw invalid_argument("-SocketPool is only supported when running as a client");
+			}
+			if (wstring(g_createFunctionName) != L"WSASocket")
+			{
+				throw invalid_argument("-SocketPool requires sockets created with WSASocket (is not supported with -IO:Quic)");
+			}
+			g_configSettings->SocketPoolHigh = ConvertToIntegral<uint32_t>(ParseArgument(*foundSocketPool, L"-SocketPool"));
+			if (0 == g_configSettings->SocketPoolHigh)
+			{
+				throw invalid_argument("-SocketPool");
+			}
+			g_configSettings->SocketPoolLow = g_configSettings->SocketPoolHigh / 2;
+			// always remove the arg from our vector
+			args.erase(foundSocketPool);
+		}
+
+		const auto foundSocketPoolLow = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SocketPoolLow");
+				return value != nullptr;
+			});
+		if (foundSocketPoolLow != end(args))
+		{
+			if (0 == g_configSettings->SocketPoolHigh)
+			{
+				throw invalid_argument("-SocketPoolLow requires -SocketPool");
+			}
+			g_configSettings->SocketPoolLow = ConvertToIntegral<uint32_t>(ParseArgument(*foundSocketPoolLow, L"-SocketPoolLow"));
+			if (g_configSettings->SocketPoolLow > g_configSettings->SocketPoolHigh)
+			{
+				throw invalid_argument("-SocketPoolLow cannot be larger than -SocketPool");
+			}
+			// always remove the arg from our vector
+			args.erase(foundSocketPoolLow);
+		}
+
+		const auto foundSocketPoolBind = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-SocketPoolBind");
+				return value != nullptr;
+			});
+		if (foundSocketPoolBind != end(args))
+		{
+			if (0 == g_configSettings->SocketPoolHigh)
+			{
+				throw invalid_argument("-SocketPoolBind requires -SocketPool");
+			}
+			const auto* const value = ParseArgument(*foundSocketPoolBind, L"-SocketPoolBind");
+			if (ctString::iordinal_equals(L"off", value))
+			{
+				g_configSettings->SocketPoolBind = false;
+			}
+			else if (!ctString::iordinal_equals(L"on", value))
+			{
+				throw invalid_argument("-SocketPoolBind");
+			}
+			// always remove the arg from our vector
+			args.erase(foundSocketPoolBind);
+		}
+
+		if (g_configSettings->SocketPoolHigh > 0)
+		{
+			g_configSettings->CreateFunction = ctsWSASocketPooled;
+			g_createFunctionName = L"WSASocket (from -SocketPool)";
+		}
+	}
+
+	// Parses how shards are assigned CPUs
+	// -AffinityPolicy:<PerCpu|PerGroup|RssAligned|Manual>
+	static void ParseForAffinityPolicy(vector<const wchar_t*>& args)
+	{
+		const auto foundAffinity = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-AffinityPolicy");
+				return value != nullptr;
+			});
+		if (foundAffinity != end(args))
+		{
+			const auto* const value = ParseArgument(*foundAffinity, L"-AffinityPolicy");
+			if (ctString::iordinal_equals(value, L"PerCpu"))
+			{
+				g_configSettings->ShardAffinityPolicy = AffinityPolicy::PerCpu;
+			}
+			else if (ctString::iordinal_equals(value, L"PerGroup"))
+			{
+				g_configSettings->ShardAffinityPolicy = AffinityPolicy::PerGroup;
+			}
+			else if (ctString::iordinal_equals(value, L"RssAligned"))
+			{
+				g_configSettings->ShardAffinityPolicy = AffinityPolicy::RssAligned;
+			}
+			else if (ctString::iordinal_equals(value, L"Manual"))
+			{
+				g_configSettings->ShardAffinityPolicy = AffinityPolicy::Manual;
+			}
+			else
+			{
+				throw invalid_argument("-AffinityPolicy");
+			}
+			args.erase(foundAffinity);
+		}
+	}
+
+	// Parses sharded receive options
+	// -EnableRecvSharding[:on|:off]
+	// -ShardCount:###
+	// -ShardWorkerCount:###
+	// -IocpBatchSize:###
+	// -AffinityPolicy:<PerCpu|PerGroup|RssAligned|Manual>
+	static void ParseForRecvSharding(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-EnableRecvSharding");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* value = ParseArgument(*foundArgument, L"-EnableRecvSharding");
+
+			if (ctString::iordinal_equals(value, L"on"))
+			{
+				g_configSettings->EnableRecvSharding = true;
+			}
+			else if (ctString::iordinal_equals(value, L"off"))
+			{
+				g_configSettings->EnableRecvSharding = false;
+			}
+			else
+			{
+				const auto err = std::string("Invalid -EnableRecvSharding value: ") + ctString::convert_to_string(value);
+				throw std::invalid_argument(err);
+			}
+			args.erase(foundArgument);
+		}
+
+		if (!g_configSettings->EnableRecvSharding)
+		{
+			// no further parsing needed
+			return;
+		}
+
+		const auto foundShardCount = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ShardCount");
+				return value != nullptr;
+			});
+		if (foundShardCount != end(args))
+		{
+			const auto val = ConvertToIntegral<uint32_t>(ParseArgument(*foundShardCount, L"-ShardCount"));
+			// 0 is a valid sentinel meaning "default to logical processor count"
+			g_configSettings->ShardCount = val;
+			args.erase(foundShardCount);
+		}
+
+		const auto foundWorker = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-ShardWorkerCount");
+				return value != nullptr;
+			});
+		if (foundWorker != end(args))
+		{
+			const auto val = ConvertToIntegral<uint32_t>(ParseArgument(*foundWorker, L"-ShardWorkerCount"));
+			if (val == 0)
+			{
+				throw invalid_argument("-ShardWorkerCount");
+			}
+			g_configSettings->ShardWorkerCount = val;
+			args.erase(foundWorker);
+		}
+
+		// Parse IOCP batch size for sharded receive (optional)
+		const auto foundBatch = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-IocpBatchSize");
+				return value != nullptr;
+			});
+		if (foundBatch != end(args))
+		{
+			const auto val = ConvertToIntegral<uint32_t>(ParseArgument(*foundBatch, L"-IocpBatchSize"));
+			if (val == 0)
+			{
+				throw invalid_argument("-IocpBatchSize");
+			}
+			if (val > c_maxIocpBatchSize)
+			{
+				throw invalid_argument(std::string("-IocpBatchSize : exceeds maximum size of ") + std::to_string(c_maxIocpBatchSize));
+			}
+			// clamp to a reasonable upper bound to avoid excessive allocations
+			g_configSettings->IocpBatchSize = std::min<uint32_t>(val, c_maxIocpBatchSize);
+			args.erase(foundBatch);
+		}
+
+		ParseForAffinityPolicy(args);
+
+		// Post-parse validations
+		if (g_configSettings->EnableRecvSharding)
+		{
+			// Sharded receive mode currently only supported for UDP servers
+			if (g_configSettings->Protocol != ProtocolType::UDP)
+			{
+				throw invalid_argument("-EnableRecvSharding (only valid with -Protocol:udp)");
+			}
+
+			// Must be in listening/server mode (at least one -Listen provided)
+			if (g_configSettings->ListenAddresses.empty())
+			{
+				throw invalid_argument("-EnableRecvSharding (requires the server to be listening; specify -Listen:<addr>)");
+			}
+
+			// numeric ranges already validated above for zero; additional range checks could be added here
+			if (g_configSettings->ShardWorkerCount == 0)
+			{
+				throw invalid_argument("-ShardWorkerCount");
+			}
+		}
+	}
+
+	//
+	// Sets an IP Compartment (routing domain)
+	//
+	// -Compartment:<ifalias>
+	//
+	static void ParseForCompartment(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-Compartment");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			// delay-load IPHLPAPI.DLL
+			const auto* const value = ParseArgument(*foundArgument, L"-Compartment");
+			g_netAdapterAddresses = new ctNetAdapterAddresses(AF_UNSPEC, GAA_FLAG_INCLUDE_ALL_COMPARTMENTS);
+			const auto foundInterface = ranges::find_if(
+				*g_netAdapterAddresses,
+				[&value](const IP_ADAPTER_ADDRESSES& adapterAddress)
+				{
+					return ctString::iordinal_equals(
+						value, adapterAddress.FriendlyName);
+				});
+			THROW_HR_IF_MSG(
+				HRESULT_FROM_WIN32(ERROR_NOT_FOUND),
+				foundInterface == g_netAdapterAddresses->end(),
+				"GetAdaptersAddresses could not find the interface alias '%ws'",
+				value);
+
+			g_compartmentId = foundInterface->CompartmentId;
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Sets a threadpool environment for TP APIs to consume
+	//
+	// Configuring for max threads == number of processors * 2
+	//
+	// currently not exposing this as a command-line parameter
+	//
+	static void ParseForThreadpool(vector<const wchar_t*>& args)
+	{
+		auto setRunsLong = false;
+
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-threadpool");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-threadpool");
+			if (ctString::iordinal_equals(L"default", value))
+			{
+				setRunsLong = false;
+			}
+			else if (ctString::iordinal_equals(L"runslong", value))
+			{
+				setRunsLong = true;
+			}
+
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+
+		SYSTEM_INFO systemInfo;
+		GetSystemInfo(&systemInfo);
+		g_threadPoolThreadCount = systemInfo.dwNumberOfProcessors;
+		if (g_threadPoolThreadCount < 48)
+		{
+			g_threadPoolThreadCount = static_cast<uint32_t>(static_cast<float>(g_threadPoolThreadCount) * 1.25f);
+		}
+		if (g_threadPoolThreadCount > 96)
+		{
+			g_threadPoolThreadCount = static_cast<uint32_t>(static_cast<float>(g_threadPoolThreadCount) / 1.25f);
+		}
+
+		g_threadPool = CreateThreadpool(nullptr);
+		if (!g_threadPool)
+		{
+			THROW_WIN32_MSG(GetLastError(), "CreateThreadPool");
+		}
+		SetThreadpoolThreadMaximum(g_threadPool, g_threadPoolThreadCount);
+
+		InitializeThreadpoolEnvironment(&g_threadPoolEnvironment);
+		if (setRunsLong)
+		{
+			SetThreadpoolCallbackRunsLong(&g_threadPoolEnvironment);
+		}
+		SetThreadpoolCallbackPool(&g_threadPoolEnvironment, g_threadPool);
+
+		g_configSettings->pTpEnvironment = &g_threadPoolEnvironment;
+	}
+
+	//
+	// Parses for whether to verify buffer contents on receiver
+	//
+	// -verify:<connection,data>
+	// (the old options were <always,never>)
+	//
+	// Note this controls if using a SharedBuffer across all IO or unique buffers
+	// - if not validating data, won't waste memory creating buffers for every connection
+	// - if validating data, must create buffers for every connection
+	//
+	static void ParseForShouldVerifyBuffers(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-verify");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			const auto* const value = ParseArgument(*foundArgument, L"-verify");
+			if (ctString::iordinal_equals(L"always", value) || ctString::iordinal_equals(L"data", value))
+			{
+				g_configSettings->ShouldVerifyBuffers = true;
+				g_configSettings->UseSharedBuffer = false;
+			}
+			else if (ctString::iordinal_equals(L"never", value) || ctString::iordinal_equals(L"connection", value))
+			{
+				g_configSettings->ShouldVerifyBuffers = false;
+				g_configSettings->UseSharedBuffer = true;
+			}
+			else
+			{
+				throw invalid_argument("-verify");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for how the client should close the connection with the server
+	//
+	// -shutdown:<graceful,rude,random>
+	//
+	static void ParseForShutdown(vector<const wchar_t*>& args)
+	{
+		const auto foundArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-shutdown");
+				return value != nullptr;
+			});
+		if (foundArgument != end(args))
+		{
+			if (IsListening())
+			{
+				throw invalid_argument("-shutdown is a client-only option");
+			}
+
+			const auto* const value = ParseArgument(*foundArgument, L"-shutdown");
+			if (ctString::iordinal_equals(L"graceful", value))
+			{
+				g_configSettings->TcpShutdown = TcpShutdownType::GracefulShutdown;
+			}
+			else if (ctString::iordinal_equals(L"rude", value))
+			{
+				g_configSettings->TcpShutdown = TcpShutdownType::HardShutdown;
+			}
+			else if (ctString::iordinal_equals(L"random", value))
+			{
+				g_configSettings->TcpShutdown = TcpShutdownType::Random;
+			}
+			else
+			{
+				throw invalid_argument("-shutdown");
+			}
+			// always remove the arg from our vector
+			args.erase(foundArgument);
+		}
+	}
+
+	//
+	// Parses for the optional maximum time to run
+	//
+	// -TimeLimit:##
+	// -PauseAtEnd:##
+	//
+	static void ParseForTimeLimit(vector<const wchar_t*>& args)
+	{
+		const auto foundTimeLimitArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-TimeLimit");
+				return value != nullptr;
+			});
+		if (foundTimeLimitArgument != end(args))
+		{
+			g_configSettings->TimeLimit = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundTimeLimitArgument, L"-TimeLimit"));
+			if (0 == g_configSettings->TimeLimit)
+			{
+				throw invalid_argument("-TimeLimit");
+			}
+			// always remove the arg from our vector
+			args.erase(foundTimeLimitArgument);
+		}
+
+		const auto foundPauseAtEndArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-PauseAtEnd");
+				return value != nullptr;
+			});
+		if (foundPauseAtEndArgument != end(args))
+		{
+			g_configSettings->PauseAtEnd = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundPauseAtEndArgument, L"-PauseAtEnd"));
+			if (0 == g_configSettings->PauseAtEnd)
+			{
+				throw invalid_argument("-PauseAtEnd");
+			}
+			// always remove the arg from our vector
+			args.erase(foundPauseAtEndArgument);
+		}
+	}
+
+	//
+	// Parses for the optional CPU Group ID to set affinity
+	//
+	// -CpuSetGroupId:##
+	//
+	static void ParseForCpuSets(vector<const wchar_t*>& args)
+	{
+		const auto foundCpuGroupIdArgument = ranges::find_if(args, [](const wchar_t* parameter) -> bool
+			{
+				const auto* const value = ParseArgument(parameter, L"-CpuSetGroupId");
+				return value != nullptr;
+			});
+		if (foundCpuGroupIdArgument != end(args))
+		{
+			g_configSettings->CpuGroupId = ConvertToIntegral<uint32_t>(
+				ParseArgument(*foundCpuGroupIdArgument, L"-CpuSetGroupId"));
+			// always remove the arg from our vector
+			args.erase(foundCpuGroupIdArgument);
+		}
+		else
+		{
+			// default to group zero
+			g_configSettings->CpuGroupId = 0;
+		}
+	}
+
+	//
+	// Members within the ctsConfig namespace that can be accessed anywhere within ctsTraffic
+	//
+	void PrintUsage(PrintUsageOption option)
+	{
+		ctsConfigInitOnce();
+
+		wstring usage;
+
+		switch (option)
+		{
+		case PrintUsageOption::Default:
+			usage.append(L"\n"
+				L"ctsTraffic is a utility to generate and validate the integrity of network traffic. It is a client / server application "
+				L"with the ability to send and receive traffic in a variety of protocol patterns, utilizing a variety of API calling patterns.\n"
+				L"\n"
+				L"Getting started: using the default parameters (ctrl-c or ctrl-break will cleanly shutdown the client or server)\n"
+				L"   server:\n"
+				L"     ctsTraffic.exe -Listen:*\n"
+				L"   client:\n"
+				L"     ctsTraffic.exe -Target:<server name or address>\n"
+				L"\n"
+				L"The above default options do the following:\n"
+				L"   - the server will listen on port 4444 on all addresses for any # of inbound client connections\n"
+				L"     (controlled with -Port)\n"
+				L"   - the server will listen for connections indefinitely\n"
+				L"     (controlled with -ServerExitLimit)\n"
+				L"   - the client will establish 8 concurrently connected TCP connections to the server\n"
+				L"     (controlled with -Connections)\n"
+				L"   - the client will indefinitely create new connections as existing connections close\n"
+				L"     (controlled with -Iterations)\n"
+				L"   - the client and server will default to the 'push' IO pattern - client sends data, server receives data\n"
+				L"     (controlled with -Pattern)\n"
+				L"   - both client and server send and recv data using 64KB buffers\n"
+				L"     (controlled with -Buffer)\n"
+				L"   - as data is received by either side, the entire data buffer is checked for data integrity\n"
+				L"     (controlled with -Verify)\n"
+				L"\n"
+				L"The server-side and client-side may have independent settings *except* for the following\n"
+				L"   (these *must* match exactly on both the client and the server)\n"
+				L"   -Port:######  (defaults to 4444)\n"
+				L"   -Protocol:<tcp,udp>  (defaults to TCP)\n"
+				L"   -Verify:<data,connection>  (defaults to 'data' - verifies all data transferred)\n"
+				L"   -Pattern:<push,pull,pushpull,duplex,idlehold>  (TCP only - defaults to push)\n"
+				L"   -Transfer:######  (TCP only - defaults to 1GB of data)\n"
+				L"   -IdleKeepAlive:###### -IdleKeepAliveBytes:###### -IdleHoldTime:######  (with -Pattern:IdleHold)\n"
+				L"   -BitsPerSecond:######  (required for UDP)\n"
+				L"   -FrameRate:######  (required for UDP)\n"
+				L"   -StreamLength:######  (required for UDP)\n"
+				L"   -DatagramByteSize:###### (optional for UDP - but must match if supplied)\n"
+				L"                    : if set, the client side value must be >= server value\n"
+			);
+			break;
+
+		case PrintUsageOption::Tcp:
+			usage.append(L"\n"
+				L"----------------------------------------------------------------------\n"
+				L"                    TCP usage options                                 \n"
+				L"----------------------------------------------------------------------\n"
+				L"-Buffer:#####\n"
+				L"   - the # of bytes in the buffer used for each send/recv IO\n"
+				L"     <default> == 65536  (each send or recv will post a 64KB buffer)\n"
+				L"   - supports range : [low,high]  (each connection will randomly choose a buffer size from within this range)\n"
+				L"-Pattern:<push,pull,pushpull,duplex,idlehold>\n"
+				L"   - the protocol pattern to send & recv over the TCP connection\n"
+				L"     <default> == push\n"
+				L"   - push : client pushes data to the server (client sends, server receives)\n"
+				L"   - pull : client pulls data from the server (server sends, client receives)\n"
+				L"   - pushpull : client/server alternates sending/receiving data\n"
+				L"                PushBytes and PullBytes can further customize this option (see help:advanced)\n"
+				L"   - duplex : client/server sends and receives concurrently throughout the entire connection\n"
+				L"   - idlehold : client/server hold mostly-idle connections, exchanging a small keepalive at an interval\n"
+				L"                IdleKeepAlive, IdleKeepAliveBytes and IdleHoldTime can further customize this option (see help:advanced)\n"
+				L"                the keepalive round-trip times and the memory used per connection are reported when the run ends\n"
+				L"-RateLimit:#####\n"
+				L"   - rate limits the number of bytes/sec being sent and received on each individual connection\n"
+				L"     <default> == 0 (no rate limits)\n"
+				L"   - supports range : [low,high]  (each connection will randomly choose a rate limit setting from within this range)\n"
+				L"-Transfer:#####\n"
+				L"   - the total bytes to transfer per TCP connection\n"
+				L"     <default> == 1073741824  (each connection will transfer a sum total of 1GB)\n"
+				L"   - supports range : [low,high]  (each connection will randomly choose a total transfer size send across)\n"
+				L"     note : specifying a range *will* create failures (used to test TCP failures paths)\n"
+				L"-Verify:<data,connection>\n"
+				L"   - controls if received buffers should be verified for data integrity/data corruption\n"
+				L"     <default> == data\n"
+				L"   - connection : the integrity of every connection is verified - the expected # of bytes sent and received\n"
+				L"   - data : the integrity of every received data buffer is verified against the an expected bit-pattern\n"
+				L"     note : data is a super-set of connection for the level of validation provided\n"
+				L"\n"
+				L"----------------------------------------------------------------------\n"
+				L"                    TCP client-only usage options                     \n"
+				L"----------------------------------------------------------------------\n"
+				L"-Connections:#####\n"
+				L"   - the # of active concurrent connections a client should maintain to indicated servers\n"
+				L"     <default> == 8\n"
+				L"     note : this is only applicable to clients - servers accept any # of connections\n"
+				L"          : as a connection closes, another is immediately connected to maintain the target count\n"
+				L"          : the total # of connections to be made before exit == Iterations * Connections\n"
+				L"-Iterations:####\n"
+				L"   - the number of times to iterate across the number of '-Connections'\n"
+				L"     <default> == 0  (infinite)\n"
+				L"     note : the total # of connections to be made before exit == Iterations * Connections\n"
+				L"-Shutdown:<graceful,rude>\n"
+				L"   - controls how clients terminate the TCP connection\n"
+				L"     <default> == graceful\n"
+				L"   - graceful : client will initiate a 4-way FIN with the server and wait for the server's FIN\n"
+				L"   - rude : client will immediately close the connection once it receives the 'done' response from the server\n"
+				L"          : this will deliberately tell TCP to linger for zero seconds and close the socket\n"
+				L"          : this may result in a RST instead of a FIN\n"
+				L"-Target:<address or name>\n"
+				L"   - the IP Address, FQDN, or hostname of the server to connect\n"
+				L"     note : given a FQDN or hostname, all resolved addresses (both IPv4 and IPv6) will be used\n"
+				L"          : one can specify multiple targets by providing -Target for each address or name\n"
+				L"          : one can specify '-Target:localhost' when client and server are both local\n"
+				L"----------------------------------------------------------------------\n"
+				L"                    TCP server-only usage options                     \n"
+				L"----------------------------------------------------------------------\n"
+				L"-Listen:<address or *> [-Listen:<addr> -Listen:<addr>]\n"
+				L"   - the specific IP Address for the server-side to listen, or '*' for all IP Addresses\n"
+				L"     note : can specify multiple addresses by providing -Listen for each address\n"
+				L"-ServerExitLimit:####\n"
+				L"   - the total # of accepted connections before server gracefully exits\n"
+				L"     <default> == 0  (infinite)\n"
+			);
+			break;
+
+		case PrintUsageOption::Udp:
+			usage.append(L"\n"
+				L"----------------------------------------------------------------------\n"
+				L"                        UDP usage options                             \n"
+				L"  * requires the -Protocol:UDP option to be specified                 \n"
+				L"  * UDP datagrams are streamed in a controlled pattern                \n"
+				L"    similar to audio/video streaming solutions                        \n"
+				L"  * In all cases, the client-side receives and server-side sends      \n"
+				L"    at a fixed bit-rate and frame-size                                \n"
+				L"----------------------------------------------------------------------\n"
+				L"-BitsPerSecond:####\n"
+				L"   - the number of bits per second to stream split across '-FrameRate' # of frames\n"
+				L"   - <required>\n"
+				L"-FrameRate:####\n"
+				L"   - the number of frames per second being streamed\n"
+				L"   - <required>\n"
+				L"     note : for server-side this is the specific frequency that datagrams are sent\n"
+				L"          : for client-side this is the frequency that frames are processed and verified\n"
+				L"-StreamLength:####\n"
+				L"   - the total number of seconds to run the entire stream\n"
+				L"   - <required>\n"
+				L"-BufferDepth:####\n"
+				L"   - the number of seconds to buffer before processing the stream\n"
+				L"     <default> = 1 (second)\n"
+				L"     note : this affects the client-side buffering of frames\n"
+				L"          : this also affects how far the client-side will peek at frames to resend if missing\n"
+				L"          : the client will look ahead at 1/2 the buffer depth to request a resend if missing\n"
+				L"-UdpOffload:<on,off>\n"
+				L"   - uses UDP segmentation offload to reduce the number of send and receive calls\n"
+				L"     <default> == off\n"
+				L"     note : the server hands the stack all datagrams of a frame in one send call (USO)\n"
+				L"          : the client receives multiple datagrams coalesced by the stack in one receive call (URO)\n"
+				L"          : falls back to one datagram per call when the OS or NIC does not support offload\n"
+				L"          : client and server can set this independently - datagrams on the wire are unchanged\n"
+				L"-DatagramBatchSize:####\n"
+				L"   - the number of receives kept posted together on each datagram socket\n"
+				L"     <default> == 1\n"
+				L"     note : the server keeps this many receives posted for START requests on each listening socket\n"
+				L"          : the client keeps at least this many receives posted on each stream (raising -PrePostRecvs)\n"
+				L"          : the summary reports the datagrams per send and recv call and the frame jitter\n"
+				L"----------------------------------------------------------------------\n"
+				L"                    UDP client-only usage options                     \n"
+				L"----------------------------------------------------------------------\n"
+				L"-Connections:#####\n"
+				L"   - the # of active concurrent connections a client should maintain to indicated servers\n"
+				L"     <default> == 8\n"
+				L"     note : this is only applicable to clients - servers accept any # of connections\n"
+				L"          : as a connection closes, another is immediately connected to maintain the target count\n"
+				L"          : the total # of connections to be made before exit == Iterations * Connections\n"
+				L"-Iterations:####\n"
+				L"   - the number of times to iterate across the number of '-Connections'\n"
+				L"     <default> == 0  (infinite)\n"
+				L"     note : the total # of connections to be made before exit == Iterations * Connections\n"
+				L"-Target:<address or name>\n"
+				L"   - the IP Address, FQDN, or hostname of the server to connect\n"
+				L"     note : given a FQDN or hostname, all resolved addresses (both IPv4 and IPv6) will be used\n"
+				L"          : one can specify multiple targets by providing -Target for each address or name\n"
+				L"          : one can specify '-Target:localhost' when client and server are both local\n"
+				L"----------------------------------------------------------------------\n"
+				L"                    UDP server-only usage options                     \n"
+				L"----------------------------------------------------------------------\n"
+				L"-Listen:<address or *> [-Listen:<addr> -Listen:<addr>]\n"
+				L"   - the specific IP Address for the server-side to listen, or '*' for all IP Addresses\n"
+				L"     note : can specify multiple addresses by providing -Listen for each address\n"
+				L"-DatagramByteSize:####\n"
+				L"   - (optional) the maximum size for each datagram to be sent\n"
+				L"     <default> = 1400 bytes\n"
+				L"     note : this affects how each Frame is split into individual calls to WSASendTo\n"
+				L"          : this may need to be made within one MTU for some network deployments\n"
+				L"     note : this is an optional parameter, but if specified on the server\n"
+				L"          : then the client must have a value set that is equal-to or greater-than that of the server\n"
+				L"     note : will generally have a ceiling around 65500 bytes\n"
+				L"-ServerExitLimit:####\n"
+				L"   - the total # of accepted connections before server gracefully exits\n"
+				L"     <default> == 0  (infinite)\n"
+				L"\n"
+				L"  UDP server-only: Sharded receive options\n"
+				L"    (applies to UDP servers only)\n"
+				L"-EnableRecvSharding[:on|:off]\n"
+				L"   - opt-in receive sharding mode. When enabled, ctsTraffic will create one\n"
+				L"     UDP socket and one IOCP per shard and run dedicated worker threads.\n"
+				L"     <default> == off\n"
+				L"-ShardCount:###\n"
+				L"   - number of receive shards to create\n"
+				L"     <default> == 0 (defaults to logical processor count)\n"
+				/* OutstandingReceives removed: no longer a configurable option */
+				L"-ShardWorkerCount:###\n"
+				L"   - number of worker threads to run per shard\n"
+				L"     <default> == 1\n"
+				L"-IocpBatchSize:###\n"
+				L"   - number of completions to process per worker loop iteration\n"
+				L"     <default> == 64\n"
+				L"-AffinityPolicy:<PerCpu|PerGroup|RssAligned|Manual>\n"
+				L"   - how to assign CPU affinity to shards when supported\n"
+				L"     <default> == PerCpu  (infinite)\n"
+			);
+			break;
+
+		case PrintUsageOption::Logging:
+			usage.append(L"\n"
+				L"----------------------------------------------------------------------\n"
+				L"                    Logging options                                   \n"
+				L"----------------------------------------------------------------------\n"
+				L"Logging in ctsTraffic:\n"
+				L"Information available to be logged is grouped into 4 basic buckets:\n"
+				L"  - Connection information : this will write a data point for every successful connection established\n"
+				L"                             -ConnectionFilename specifies the file written with this data\n"
+				L"                             the IP address and port tuples for the source and destination will be written\n"
+				L"                             this will also write a data point at the point of every connection completion\n"
+				L"                             information unique to the protocol that was used will be included on success\n"
+				L"  - Error information      : this will write error strings at the point of failure of any connection\n"
+				L"                             -ErrorFilename specifies the file written with this data\n"
+				L"                             error information will include the specific point of failure (function that failed)\n"
+				L"                             as well as which connection the failure occurred (based off of IP address and port)\n"
+				L"  - Status information     : this will write out status information as applicable to the protocol being used\n"
+				L"                             -StatusFilename specifies the file written with this data\n"
+				L"                             the status information will be printed at a frequency set by -StatusUpdate\n"
+				L"                             the details printed are aggregate values from all connections for that time slice\n"
+				L"  - Jitter information     : for UDP-patterns only, the jitter logging information will write out data per-datagram\n"
+				L"                             -JitterFilename specifies the file written with this data\n"
+				L"                             this information is formatted specifically to calculate jitter between packets\n"
+				L"                             it follows the same format used with the published tool ntttcp.exe:\n"
+				L"                             [frame#],[sender.qpc],[sender.qpf],[receiver.qpc],[receiver.qpf]\n"
+				L"                             - qpc is the result of QueryPerformanceCounter\n"
+				L"                             - qpf is the result of QueryPerformanceFrequency\n"
+				L"                             the algorithm to apply to this data can be found on this site under 'Performance Metrics'\n"
+				L"                             http://msdn.microsoft.com/en-us/library/windows/hardware/dn247504.aspx \n"
+				L"  - TCP_INFO information   : for TCP-patterns only, the TcpInfo logging captures information from TCP_INFO_* structs\n"
+				L"                             -TcpInfoFilename specifies the file written with this data\n"
+				L"                             this information is captured at the end of each TCP connection and written to csv\n"
+				L"                             note this is only available on Windows 10 RS2 and later\n"
+				L"\n"
+				L"The format in which the above data is logged is based off of the file extension of the filename specified above\n"
+				L"  - There are 2 possible file types:\n"
+				L"    - txt : plain text format is used with the file extension .txt, or for an unrecognized file extension\n"
+				L"            text output is formatted as one would see it printed to the console in UTF8 format\n"
+				L"    - csv : comma-separated value format is used with the file extension .csv\n"
+				L"            information is separated into columns separated by a comma for easier post-processing\n"
+				L"            the column layout of the data is specific to the type of output and protocol being used\n"
+				L"            NOTE: csv formatting will only apply to status updates and jitter, not connection or error information\n"
+				L"\n"
+				L"\n"
+				L"-ConsoleVerbosity:<0-5>\n"
+				L"    - logging verbosity for all information to be written to the console\n"
+				L"      <default> == 4\n"
+				L"      0 : off (nothing written to the console)\n"
+				L"      1 : status updates\n"
+				L"      2 : error information + status updates\n"
+				L"      3 : connection information only\n"
+				L"      4 : connection information + error information\n"
+				L"      5 : connection information + error information + status updates\n"
+				// L"      6 : above + debug output\n" // Not exposing debug information to users
+				L"-ConnectionFilename:<filename with/without path>\n"
+				L"      <default> == not written to a log file\n"
+				L"-ErrorFilename:<filename with/without path>\n"
+				L"      <default> == not written to a log file\n"
+				L"-StatusFilename:<filename with/without path>\n"
+				L"      <default> == not written to a log file\n"
+				L"-JitterFilename:<filename with/without path>\n"
+				L"      <default> == not written to a log file\n"
+				L"-TcpInfoFilename:<filename with/without path>\n"
+				L"      <default> == not written to a log file\n"
+				L"-StatusUpdate:####\n"
+				L"    - the millisecond frequency which real-time status updates are written\n"
+				L"      <default> == 5000 (milliseconds)\n"
+			);
+			break;
+
+		case PrintUsageOption::Advanced:
+			usage.append(L"\n"
+				L"----------------------------------------------------------------------\n"
+				L"                        Advanced Options                              \n"
+				L"                                                                      \n"
+				L"  * these options target specific scenario requirements               \n"
+				L"----------------------------------------------------------------------\n"
+				L"-Acc:<accept,AcceptEx>\n"
+				L"   - specifies the Winsock API to process accepting inbound connections\n"
+				L"     the default is appropriate unless deliberately needing to test other APIs\n"
+				L"     <default> == AcceptEx\n"
+				L"   - AcceptEx : uses OVERLAPPED AcceptEx with IO Completion ports\n"
+				L"   - accept : uses blocking calls to accept\n"
+				L"            : be careful using this as it will not scale out well as each call blocks a thread\n"
+				L"-AcceptDepth:####\n"
+				L"            :[low,high]\n"
+				L"   - applied only with -Acc:AcceptEx - the number of AcceptEx requests kept pended on each listening socket\n"
+				L"     with a range, the number adapts to the rate connections are accepted, doubling whenever\n"
+				L"     every pended AcceptEx has completed (connections then wait in the listen backlog)\n"
+				L"     <default> == [100,1000]\n"
+				L"     note : this is a server-only option\n"
+				L"          : the summary reports how long accepted connections waited to be picked up,\n"
+				L"            and how often a listener ran out of pended AcceptEx requests\n"
+				L"-AcceptShards:####\n"
+				L"   - applied only with -Acc:AcceptEx - splits the AcceptEx requests of each listening socket across\n"
+				L"     this many shards, each pending and reposting its own share of -AcceptDepth\n"
+				L"     the listener's completions are processed by this many IOCP worker threads (not pinned to CPUs)\n"
+				L"     <default> == not sharded (completions are processed on the threadpool)\n"
+				L"     note : this is a server-only option\n"
+				L"          : Windows queues incoming connections on one listening socket per address,\n"
+				L"            so the shards share that socket's accept backlog and its one completion port:\n"
+				L"            any of the workers can process the completion of any shard's AcceptEx\n"
+				L"          : IO on accepted connections still runs on each connection's own threadpool IOCP,\n"
+				L"            not on the worker which accepted it\n"
+				L"          : the summary reports the accepts per second of each shard\n"
+				L"-Bind:<IP-address or *>\n"
+				L"   - a client-side option used to control what IP address is used for outgoing connections\n"
+				L"     <default> == *  (will implicitly bind to the correct IP to connect to the target IP)\n"
+				L"     note : this is typically only necessary when wanting to distribute traffic\n"
+				L"            over a specific interface for multi-homed configurations\n"
+				L"     note : can specify multiple addresses by providing -Bind for each address\n"
+				L"-BurstCount:####\n"
+				L"   - optional parameter\n"
+				L"   - applies to any TCP IO Pattern\n"
+				L"   - the number of sends() to send -buffer:#### in a tight loop before triggering a delay\n"
+				L"     note : this is a required field when using BurstDelay\n"
+				L"-BurstDelay:####\n"
+				L"   - optional parameter\n"
+				L"   - applies to any TCP IO Pattern\n"
+				L"   - the number of milliseconds to delay after completing -BurstCount sends\n"
+				L"     note : this is a required field when using BurstCount\n"
+				L"-BusyPoll:####\n"
+				L"   - applied only with -IO:RioIocp - the # of microseconds each RIO worker thread spins polling\n"
+				L"     for completions before blocking, trading CPU for lower completion latency\n"
+				L"     each RIO worker thread is also pinned to its own CPU\n"
+				L"     <default> == <not set> (worker threads block until completions are available)\n"
+				L"-Compartment:<ifAlias>\n"
+				L"   - specifies the interface alias of the compartment to use for all sockets\n"
+				L"     this is most commonly appropriate for servers configured with IP Compartments\n"
+				L"     <default> == using the default IP compartment\n"
+				L"     note : all systems use the default compartment unless explicitly configured otherwise\n"
+				L"          : the IP addresses specified through -Bind (for clients) and -Listen (for servers)\n"
+				L"            will be directly affected by this Compartment value, including specifying '*'\n"
+				L"-Conn:<connect,ConnectEx,ConnectByName,HappyEyeballs>\n"
+				L"   - specifies the Winsock API to establish outbound connections\n"
+				L"     the default is appropriate unless deliberately needing to test other APIs\n"
+				L"     <default> == ConnectEx  (appropriate unless explicitly wanting to test other APIs)\n"
+				L"   - ConnectEx : uses OVERLAPPED ConnectEx with IO Completion ports\n"
+				L"   - connect : uses blocking calls to connect\n"
+				L"             : be careful using blocking options as it will not scale out as well as each call blocks a thread\n"
+				L"   - ConnectByName : resolves each -Target name asynchronously with DnsQueryEx, then uses OVERLAPPED ConnectEx\n"
+				L"                     resolved addresses are cached for the TTL of their DNS records, and connections\n"
+				L"                     to a name already being resolved wait for that query rather than issuing another\n"
+				L"   - HappyEyeballs : races OVERLAPPED ConnectEx attempts across every -Target address (RFC 8305)\n"
+				L"                     alternating address families, starting the next when one fails or hasn't connected\n"
+				L"                     within -ConnectAttemptDelay - the first to connect is kept, the others closed\n"
+				L"-ConnectAttemptDelay:####\n"
+				L"   - applied only with -conn:HappyEyeballs - the milliseconds an attempt has to connect\n"
+				L"     before the next attempt is started alongside it (from 10 to 2000)\n"
+				L"     <default> == 250\n"
+				L"-ConnectionArrival:<constant,poisson,ramp>\n"
+				L"   - applied only with -ConnectionRate - how connection starts are spaced over time\n"
+				L"     <default> == constant\n"
+				L"   - constant : starts are evenly spaced at -ConnectionRate\n"
+				L"   - poisson : starts are randomly spaced (exponentially distributed), averaging -ConnectionRate\n"
+				L"   - ramp : starts are evenly spaced, the rate growing from zero to -ConnectionRate over -ConnectionRampTime\n"
+				L"-ConnectionRampTime:####\n"
+				L"   - applied only with -ConnectionArrival:ramp - the milliseconds to ramp up to -ConnectionRate\n"
+				L"     <default> == 10000\n"
+				L"-ConnectionRate:####\n"
+				L"   - starts connections on a fixed timeline of this many connections per second\n"
+				L"     regardless of how long earlier connections take (an open-loop load)\n"
+				L"     -Connections and -ThrottleConnections still cap the connections open and connecting at once:\n"
+				L"     a start held back by them is made as soon as a connection closes\n"
+				L"     <default> == <not set> (connections are started as fast as -Connections allows)\n"
+				L"     note : this is a client-only option\n"
+				L"          : the summary reports the intended and achieved rates, and how late each start was\n"
+				L"            measured from the time it was intended (so stalls are not hidden),\n"
+				L"            and the most starts that were due but not yet made at any one time\n"
+				L"-CpuSetGroupId:####\n"
+				L"   - specifies the CPU Set Group ID that ctsTraffic should affinitize\n"
+				L"     will call GetSystemCpuSetInformation to find the matching Group ID\n"
+				L"     and pass that list of CPU IDs to SetProcessDefaultCpuSets\n"
+				L"     <default> == (not set)\n"
+				L"-IdleHoldTime:####\n"
+				L"   - applied only with -Pattern:IdleHold - the # of milliseconds each connection is held open\n"
+				L"     <default> == 0 (connections are held until the run ends with -TimeLimit or ctrl-c)\n"
+				L"     note : must match on the client and server\n"
+				L"-IdleKeepAlive:####\n"
+				L"   - applied only with -Pattern:IdleHold - the # of milliseconds between keepalive exchanges\n"
+				L"     <default> == 30000\n"
+				L"     note : must match on the client and server\n"
+				L"-IdleKeepAliveBytes:####\n"
+				L"   - applied only with -Pattern:IdleHold - the # of bytes sent by the client and echoed by the server\n"
+				L"     this is also the size of the only recv buffer allocated for each connection\n"
+				L"     <default> == 16\n"
+				L"     note : must match on the client and server\n"
+				L"-IfIndex:####\n"
+				L"   - the interface index which to use for outbound connectivity\n"
+				L"     assigns the interface with IP_UNICAST_IF / IPV6_UNICAST_IF\n"
+				L"     <default> == not set (will not restrict binding to any specific interface)\n"
+				L"-InlineCompletions:<on,off>\n"
+				L"   - will set the below option on all SOCKETS for OVERLAPPED I/O calls so inline successful\n"
+				L"     completions will not be queued to the completion handler\n"
+				L"     SetFileCompletionNotificationModes(FILE_SKIP_COMPLETION_PORT_ON_SUCCESS)\n"
+				L"     <default> == on for TCP -IO:iocp\n"
+				L"                  on for UDP clients\n"
+				L"                  off for all other TCP -IO options\n"
+				L"-IO:<iocp,RioIocp,ReadWriteFile,WSAPoll,Tls,Quic>\n"
+				L"   - the API set and usage for processing the protocol pattern\n"
+				L"     <default> == iocp\n"
+				L"   - iocp : leverages WSARecv/WSASend using IOCP for async completions\n"
+				L"   - RioIocp : registered i/o using an overlapped IOCP for completion notification\n"
+				L"   - ReadWriteFile : leverages ReadFile/WriteFile using IOCP for async completions\n"
+				L"   - WSAPoll : non-blocking send/recv driven by WSAPoll readiness on per-thread event loops\n"
+				L"             -PrePostRecvs/-PrePostSends are the # of tasks kept ready to run on each socket\n"
+				L"             note : -MsgWaitAll is not applied as the sockets are non-blocking\n"
+				L"   - Tls : leverages WSARecv/WSASend using IOCP over a Schannel TLS session\n"
+				L"           negotiated before any data is sent - all byte counts and verification are of the plaintext\n"
+				L"           servers use -TlsCertificate, or a self-signed certificate created for the run\n"
+				L"           clients do not validate the server certificate\n"
+				L"   - Quic : each connection is a bidirectional stream over MsQuic (msquic.dll alongside ctsTraffic.exe)\n"
+				L"            clients open -QuicStreams streams on each QUIC connection before opening the next\n"
+				L"            servers use -TlsCertificate, or a self-signed certificate created for the run\n"
+				L"            note : -conn and -acc are not applicable - MsQuic connects and accepts the QUIC connections\n"
+				L"-KeepAliveValue:####\n"
+				L"   - the # of milliseconds to set KeepAlive for TCP connections\n"
+				L"     <default> == not set\n"
+				L"     note : This setting is a more specific setting than -Options:keepalive\n"
+				L"            as -Options:keepalive will use the system default values for keep-alive timers\n"
+				L"-LocalPort:####\n"
+				L"   - the local port to bind to when initiating a connection\n"
+				L"     <default> == 0  (an ephemeral port will be chosen when making a connection)\n"
+				L"   - supports range : [low,high] each new connection will choose a port within this range not in use\n"
+				L"     note : You must provide a sufficiently large range to support the number of connections\n"
+				L"          : Be very careful when using with TCP connections, as port values will not be immediately\n"
+				L"            reusable; TCP will hold an closed IP:port in a TIME_WAIT statue for a period of time\n"
+				L"            only after which will it be able to be reused (TcpTimedWaitDelay, default is 2 minutes)\n"
+				L"            a range does not hand out a port held in TIME_WAIT until that time has passed\n"
+				L"            connections fail with WSAEADDRINUSE when every port in the range is in use or in TIME_WAIT\n"
+				L"-MsgWaitAll:<on,off>\n"
+				L"   - sets the MSG_WAITALL flag when calling WSARecv for receiving data over TCP connections\n"
+				L"     this flag instructs TCP to not complete the receive request until the entire buffer is full\n"
+				L"     <default> == on\n"
+				L"     note : the default behavior when not specified is for TCP to indicate data up to the app per RFC\n"
+				L"            thus apps generally only set this when they know precisely the number of bytes they are expecting\n"
+				L"-OnError:<log,break>\n"
+				L"   - policy to control how errors are handled at runtime\n"
+				L"     <default> == log \n"
+				L"   - log : log error information only\n"
+				L"   - break : break into the debugger with error information\n"
+				L"             useful when live-troubleshooting difficult failures\n"
+				L"-Options:<keepalive,tcpfastpath>  [-Options:<...>] [-Options:<...>]\n"
+				L"   - additional socket options and IOCTLS available to be set on connected sockets\n"
+				L"     <default> == None\n"
+				L"   - keepalive : only for TCP sockets - enables default timeout Keep-Alive probes\n"
+				L"               : ctsTraffic servers have this enabled by default\n"
+				L"   - tcpfastpath : a new option for Windows 8, only for TCP sockets over loopback\n"
+				L"                 : the firewall must be disabled for the option to take effect\n"
+				L"-PauseAtEnd:####\n"
+				L"   - specifies the number of milliseconds to pause before finally exiting the process after all work is done\n"
+				L"     this is useful for automation when one needs the process to not exit immediately\n"
+				L"     <default> == None (will exit once all work is done)\n"
+				L"-PortScalability:<on,off>\n"
+				L"  - specifies if the socket option SO_PORT_SCALABILITY should be set on each socket created\n"
+				L"     <default> == off\n"
+				L"     note : SO_REUSE_UNICASTPORT will be set instead of SO_PORT_SCALABILITY if the system is configured for it\n"
+				L"            SO_REUSE_UNICASTPORT will be used if AutoReusePortRangeNumberOfPorts is set in any MSFT_NetTCPSetting\n"
+				L"            This can be set in Powershell with the Set-NetTCPSetting Powershell command-let\n"
+				L"-PrePostRecvs:#####\n"
+				L"   - specifies the number of recv requests to issue concurrently within an IO Pattern\n"
+				L"   - for example, with the default -pattern:pull, the client will post recv calls \n"
+				L"        one after another, immediately posting a recv after the prior completed.\n"
+				L"        with -pattern:pull -PrePostRecvs:2, clients will keep 2 recv calls in-flight at all times.\n"
+				L"     <default> == 1 for TCP (one recv request at a time)\n"
+				L"     <default> == 2 for UDP (two recv requests kept in-flight)\n"
+				L"     note : with TCP patterns, -verify:connection must be specified in order to specify\n"
+				L"            more than one -PrePostRecvs (UDP can always support any number)\n"
+				L"-PrePostSends:#####\n"
+				L"   - specifies the number of send requests to issue concurrently within an IO Pattern\n"
+				L"   - for example, with the default -pattern:pull, the servers will post send calls \n"
+				L"        one after another, immediately posting a send after the prior completed.\n"
+				L"        With -pattern:pull -PrePostSends:2, servers will keep 2 send calls in-flight at all times.\n"
+				L"   - The value of '0' has special meaning: it indicates for ctsTraffic to keep as many sends\n"
+				L"        in flight as indicated by the Ideal Send Backlog (ISB) indicated by TCP. In this\n"
+				L"        configuration, ctsTraffic will maintain send calls until the number of bytes being sent\n"
+				L"        equals the number of byes indicates by ISB for that TCP connection.\n"
+				L"     <default> == 1 for non-RIO TCP (Winsock will adjust automatically according to ISB)\n"
+				L"     <default> == 0 (ISB) for RIO TCP (RIO doesn't user send buffers so callers must track ISB)\n"
+				L"     <default> == 1 for UDP (one send request on each timer tick)\n"
+				L"-PullBytes:#####\n"
+				L"   - applied only with -Pattern:PushPull - the number of bytes to 'pull'\n"
+				L"     <default> == 1048576 (1MB)\n"
+				L"     note : pullbytes are the bytes received on the client and sent from the server\n"
+				L"-PushBytes:#####\n"
+				L"   - applied only with -Pattern:PushPull - the number of bytes to 'push'\n"
+				L"     <default> == 1048576 (1MB)\n"
+				L"     note : pushbytes are the bytes sent from the client and received on the server\n"
+				L"-QosDscpValue:#####\n"
+				L"   - specifies an outgoing DSCP value for all connected sockets\n"
+				L"     <default> == no DSCP value\n"
+				L"     note: the value must be from 0 to 63 inclusive\n"
+				L"-QuicStreams:#####\n"
+				L"   - applied only with -IO:Quic on clients - the # of connections (streams) each QUIC connection carries\n"
+				L"     every -QuicStreams connections share a single QUIC handshake\n"
+				L"     <default> == 1 (a QUIC connection for every connection)\n"
+				L"     note: the value must be from 1 to 1024 inclusive\n"
+				L"-RateLimitPeriod:#####\n"
+				L"   - the # of milliseconds describing the granularity by which -RateLimit bytes/second is enforced\n"
+				L"        the -RateLimit bytes/second will be evenly split across -RateLimitPeriod milliseconds\n"
+				L"        For example, -RateLimit:1000 -RateLimitPeriod:50 will limit send rates to 100 bytes every 20 ms\n"
+				L"     <default> == 100 (-RateLimit bytes/second will be split out across 100 ms. time slices)\n"
+				L"     note : only applicable to TCP connections\n"
+				L"          : only applicable is -RateLimit is set (default is not to rate limit)\n"
+				L"-RecvFile:<path>\n"
+				L"   - applied only with -IO:iocp - every byte received is written to this file (replaced if it exists)\n"
+				L"     writes are made as each receive completes, before its buffer is verified and reused\n"
+				L"     <default> == <not set>\n"
+				L"     note : the file wraps back to its start after 1GB\n"
+				L"-RecvFileMode:<buffered,unbuffered>\n"
+				L"   - applied only with -RecvFile - how received data is written\n"
+				L"     <default> == buffered\n"
+				L"   - buffered : writes go through the system cache\n"
+				L"   - unbuffered : writes bypass the system cache (FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH)\n"
+				L"                  received data is coalesced into 1MB chunks per thread, and only whole chunks are written\n"
+				L"                  the data left in each chunk is written once the run is done\n"
+				L"-RecvBufValue:#####\n"
+				L"   - specifies the value to pass to the SO_RCVBUF socket option\n"
+				L"     <default> == <not set>\n"
+				L"     note : this is only necessary to specify in carefully considered scenarios\n"
+				L"          : the default receive buffering is optimal for the majority of scenarios\n"
+				L"-SendBufValue:#####\n"
+				L"   - specifies the value to pass to the SO_SNDBUF socket option\n"
+				L"     <default> == <not set>\n"
+				L"     note : this is only necessary to specify in carefully considered scenarios\n"
+				L"          : the default send buffering is optimal for the majority of scenarios\n"
+				L"-SendFile:<path>\n"
+				L"   - applied only with -IO:iocp - sends are made with TransmitFile from this file\n"
+				L"     instead of WSASend from the in-memory pattern buffer\n"
+				L"     <default> == <not set>\n"
+				L"     note : without -SendFileSize the existing file is sent as-is, which requires -Verify:connection\n"
+				L"-SendFileCache:<warm,cold>\n"
+				L"   - applied only with -SendFile - the state of the system cache when the run starts\n"
+				L"     <default> == warm\n"
+				L"   - warm : the file is read once before the run so sends are made from the system cache\n"
+				L"   - cold : the file's pages are purged from the system cache before the run\n"
+				L"            use a -SendFileSize larger than memory to keep the entire run cold\n"
+				L"-SendFileSize:#####\n"
+				L"   - applied only with -SendFile - generates the file with the verification pattern (replacing it if it exists)\n"
+				L"     the size is rounded up to a multiple of 64KB\n"
+				L"     <default> == <not set> (the existing file is sent)\n"
+				L"-SocketPool:####\n"
+				L"   - keeps this many sockets per traffic class created, configured and bound ahead of the connections\n"
+				L"     that take them, so creating the socket is taken off each connection's critical path\n"
+				L"     the pool is filled before the run starts and refilled in the background\n"
+				L"     <default> == 0 (each connection creates its own socket)\n"
+				L"     note : this is a client-only option, not supported with -IO:Quic\n"
+				L"          : the summary reports how often connections found the pool empty and waited to create a socket\n"
+				L"-SocketPoolBind:<on,off>\n"
+				L"   - applied only with -SocketPool - whether pooled sockets are bound before they're taken\n"
+				L"     <default> == on\n"
+				L"-SocketPoolLow:####\n"
+				L"   - applied only with -SocketPool - the pool is refilled once it has fewer than this many sockets\n"
+				L"     <default> == half of -SocketPool\n"
+				L"-SubmitBatchLatency:####\n"
+				L"   - applied only with -SubmitBatchSize - the max # of microseconds a deferred request waits\n"
+				L"     before the worker thread submits its batch\n"
+				L"     <default> == 100\n"
+				L"-SubmitBatchSize:####\n"
+				L"   - applied only with -IO:RioIocp - RIO worker threads defer the requests posted while\n"
+				L"     processing completions across all connections, submitting them once this many are deferred\n"
+				L"     (or when -SubmitBatchLatency expires, or the worker has no more completions to process:\n"
+				L"      it keeps dequeuing completions while any are ready, so a batch can span many dequeues)\n"
+				L"     <default> == 0 (each connection submits its own requests)\n"
+				L"-ThrottleConnections:####\n"
+				L"   - gates currently pended connection attempts\n"
+				L"     <default> == 1000  (there will be at most 1000 sockets trying to connect at any one time)\n"
+				L"     note : zero means no throttling  (will immediately try to connect all '-Connections')\n"
+				L"          : this is a client-only option\n"
+				L"-Threadpool:<default,runslong>\n"
+				L"   - sets options on the NT threadpool used for IO and work items\n"
+				L"     <default> == default\n"
+				L"   - default : uses the default TP_CALLBACK_ENVIRON from InitializeThreadpoolEnvironment\n"
+				L"               this is recommended for must use cases unless we see work not well distributed\n"
+				L"               between different CPUs - usually only at very high throughput rates\n"
+				L"   - runslong : calls SetThreadpoolCallbackRunsLong on the TP_CALLBACK_ENVIRON\n"
+				L"-TimeLimit:#####\n"
+				L"   - the maximum number of milliseconds to run before the application is aborted and terminated\n"
+				L"     <default> == <no time limit>\n"
+				L"     note : this is to be used only to cap the maximum time to run, as this will log an error\n"
+				L"            if this TimeLimit is exceeded; predictable results should have the scenario finish\n"
+				L"            before this time limit is hit\n"
+				L"-TlsCertificate:<thumbprint>\n"
+				L"   - applied only with -IO:Tls or -IO:Quic on servers - the SHA1 thumbprint of the server certificate\n"
+				L"     found in the CurrentUser or LocalMachine 'My' certificate store\n"
+				L"     <default> == <not set> (a self-signed certificate for CN=localhost is created for the run)\n"
+				L"-TlsRecordSize:####\n"
+				L"   - applied only with -IO:Tls - the max # of plaintext bytes encrypted into each TLS record\n"
+				L"     each send is split into records of this size\n"
+				L"     <default> == 16384 (the largest TLS record)\n"
+				L"-TrafficClass:<name>,Pattern=<push,pull,pushpull,duplex>,Connections=####[,Buffer=####][,Transfer=####][,RateLimit=####][,Target=<addr>]\n"
+				L"   - defines a class of connections to run concurrently with other classes from the same client\n"
+				L"     each class maintains its own number of connections and reports its own statistics\n"
+				L"     Buffer, Transfer, and RateLimit also accept a range: [low,high]\n"
+				L"     fields not specified for a class use the values from -Pattern, -Buffer, -Transfer, -RateLimit, and -Target\n"
+				L"     a Pattern or Transfer different from -Pattern or -Transfer requires a Target for the class:\n"
+				L"     a server runs only its one -Pattern and -Transfer\n"
+				L"     can be specified up to 8 times; cannot be used with -Connections\n"
+				L"     <default> == <all connections use the same settings>\n"
+				L"     For example: -TrafficClass:bulk,Pattern=push,Connections=4,Transfer=0x40000000\n"
+				L"                  -TrafficClass:rpc,Pattern=pushpull,Connections=16,Buffer=1024,Transfer=0x100000,Target=rpcserver\n"
+				L"     (the rpc class connects to its own server, run with -Pattern:pushpull -Transfer:0x100000)\n"
+				L"     note : only applicable to TCP clients\n"
+				L"-TransferGap:####\n"
+				L"   - the milliseconds a client waits between the transfers on a connection (see -TransfersPerConnection)\n"
+				L"     <default> == 0  (each transfer starts as soon as the prior one completes)\n"
+				L"     note : this is a client-only option, not supported with -IO:RioIocp or -IO:ReadWriteFile\n"
+				L"-TransfersPerConnection:####\n"
+				L"   - the number of sequential transfers run on each TCP connection before it's closed\n"
+				L"     each transfer moves -Transfer bytes per -Pattern and ends with the server's completion message\n"
+				L"     the client starts each transfer after the first by sending the connection id back to the server\n"
+				L"     the summary reports the time of the first transfer on each connection separately from the transfers\n"
+				L"     after it on the now warm connection (no handshake and an open congestion window)\n"
+				L"     <default> == 1\n"
+				L"     note : must be set to the same value on the client and server\n"
+				L"          : cannot be used with -Pattern:IdleHold\n"
+				L"-ZeroCopyRecv:<on,off>\n"
+				L"   - sets SO_RCVBUF to 0 so TCP places received data directly into the posted receive buffers\n"
+				L"     instead of buffering it in the stack and copying it once a receive is posted\n"
+				L"     the summary reports the bytes received directly and the bytes the stack still buffered\n"
+				L"     works with both -Verify:data and -Verify:connection\n"
+				L"     <default> == off\n"
+				L"     note : only applicable to -IO:iocp; cannot be used with -RecvBufValue or -InlineCompletions:off\n"
+				L"          : use -PrePostRecvs (with -Verify:connection) to keep receives posted ahead of the data\n"
+				L"-ZeroCopySend:<on,off>\n"
+				L"   - sets SO_SNDBUF to 0 so TCP sends directly from the shared send buffer instead of copying it\n"
+				L"     each send then completes once the peer has acknowledged the data\n"
+				L"     the summary reports the sends the stack still completed without waiting (copied)\n"
+				L"     and the CPU cycles per byte\n"
+				L"     <default> == off\n"
+				L"     note : only applicable to -IO:iocp; cannot be used with -SendBufValue or -InlineCompletions:off\n"
+				L"          : use -PrePostSends to keep enough sends in flight to fill the connection\n"
+			);
+			break;
+		}
+
+		(void)fwprintf_s(stdout, L"%ws", usage.c_str());
+	}
+
+	// forward declare this function called by Startup, but implemented later in this function
+	static bool SetProcessDefaultCpuSets();
+	bool Startup(int argc, _In_reads_(argc) const wchar_t** argv)
+	{
+		ctsConfigInitOnce();
+
+		if (argc < 2)
+		{
+			PrintUsage();
+			return false;
+		}
+
+		const auto com = wil::CoInitializeEx();
+
+		// ignore the first argv... the exe itself
+		const wchar_t** argBegin = argv + 1;
+		const wchar_t** argEnd = argv + argc;
+		vector args(argBegin, argEnd);
+
+		//
+		// First:
+		// check of they asked for help text
+		//
+		const auto foundHelp = ranges::find_if(
+			args,
+			[](const wchar_t* arg) -> bool
+			{
+				return ctString::istarts_with(arg, L"-Help") ||
+					ctString::iordinal_equals(arg, L"-?");
+			});
+		if (foundHelp != end(args))
+		{
+			const auto* helpString = *foundHelp;
+			if (ctString::iordinal_equals(helpString, L"-Help:Advanced"))
+			{
+				PrintUsage(PrintUsageOption::Advanced);
+				return false;
+			}
+			if (ctString::iordinal_equals(helpString, L"-Help:Tcp"))
+			{
+				PrintUsage(PrintUsageOption::Tcp);
+				return false;
+			}
+			if (ctString::iordinal_equals(helpString, L"-Help:Udp"))
+			{
+				PrintUsage(PrintUsageOption::Udp);
+				return false;
+			}
+			if (ctString::iordinal_equals(helpString, L"-Help:Logging"))
+			{
+				PrintUsage(PrintUsageOption::Logging);
+				return false;
+			}
+
+			PrintUsage();
+			return false;
+		}
+
+		// create the handle for ctrl-c
+		g_configSettings->CtrlCHandle = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		if (!g_configSettings->CtrlCHandle)
+		{
+			THROW_WIN32_MSG(GetLastError(), "CreateEvent");
+		}
+
+		// Many of the below settings must be made in a specified order - comments below help to explain this reasoning
+		// note: the IO function definitions must come after *all* other settings
+		//       since instantiations of those IO functions might reference global Settings values
+
+		//
+		// Next:
+		// Establish logging settings including verbosity levels and error policies before any functional settings
+		// Create the threadpool before instantiating any other object
+		//
+		ParseForError(args);
+		ParseForLogging(args);
+
+		// right after logging is configured, set process affinity if specified
+		ParseForCpuSets(args);
+		if (!SetProcessDefaultCpuSets())
+		{
+			// if we can't set the cpu id, clear it so we won't print it later
+			g_configSettings->CpuGroupId.reset();
+		}
+
+		//
+		// Next: check for static machine configuration
+		// - note these are checking system settings, not user arguments
+		//
+		CheckReuseUnicastPort();
+
+		for (const auto& setting : ctWmiEnumerateInstance::Query(L"SELECT * FROM MSFT_NetAdapter"))
+		{
+			std::wstring interfaceDescription;
+			if (setting.get(L"InterfaceDescription", &interfaceDescription))
+			{
+				uint32_t operationalStatus{};
+				setting.get(L"InterfaceOperationalStatus", &operationalStatus);
+				std::wstring adapterInfo =
+					wil::str_printf<std::wstring>(L"Adapter %ws (%ws)\n\t", interfaceDescription.c_str(), operationalStatus == 1 ? L"Up" : L"NOT-UP");
+
+				constexpr auto* comma_space{ L", " };
+				adapterInfo += CheckOffloadRsc(interfaceDescription) + comma_space;
+				adapterInfo += CheckOffloadLso(interfaceDescription) + comma_space;
+				adapterInfo += CheckOffloadRss(interfaceDescription) + comma_space;
+				adapterInfo += PrintPhysicalAdapter(interfaceDescription) + L"\n";
+				PrintSummary(adapterInfo.c_str());
+			}
+		}
+
+		//
+		// Next: establish the address and port # to be used
+		//
+		ParseForAddress(args);
+		ParseForPort(args);
+		ParseForPortScalability(args);
+		ParseForLocalPort(args);
+		ParseForIfIndex(args);
+
+		//
+		// ensure a Port is assigned to all listening addresses and target addresses
+		//
+		for (auto& addr : g_configSettings->ListenAddresses)
+		{
+			if (addr.port() == 0x0000)
+			{
+				addr.set_port(g_configSettings->Port);
+			}
+		}
+		for (auto& addr : g_configSettings->TargetAddresses)
+		{
+			if (addr.port() == 0x0000)
+			{
+				addr.set_port(g_configSettings->Port);
+			}
+		}
+
+		if (g_configSettings->OutgoingIfIndex != 0 && !g_configSettings->ListenAddresses.empty())
+		{
+			throw invalid_argument("-IfIndex can only be used for outgoing connections, not listening sockets");
+		}
+
+		//
+		// Next: gather the protocol and Pattern to be used
+		// - set the threadpool value after identifying the pattern
+		ParseForProtocol(args);
+		// default to keep-alive on TCP servers
+		if (ProtocolType::TCP == g_configSettings->Protocol && !g_configSettings->ListenAddresses.empty())
+		{
+			g_configSettings->Options |= KeepAlive;
+		}
+
+		ParseForIoPattern(args);
+		ParseForThreadpool(args);
+		// validate protocol & pattern combinations
+		if (ProtocolType::UDP == g_configSettings->Protocol &&
+			IoPatternType::MediaStream != g_configSettings->IoPattern)
+		{
+			throw invalid_argument("UDP only supports the MediaStream IO Pattern");
+		}
+		if (ProtocolType::TCP == g_configSettings->Protocol &&
+			IoPatternType::MediaStream == g_configSettings->IoPattern)
+		{
+			throw invalid_argument("TCP does not support the MediaStream IO Pattern");
+		}
+		// set appropriate defaults for # of connections for TCP vs. UDP
+		if (ProtocolType::UDP == g_configSettings->Protocol)
+		{
+			g_configSettings->ConnectionLimit = c_defaultUdpConnectionLimit;
+		}
+		else
+		{
+			g_configSettings->ConnectionLimit = c_defaultTcpConnectionLimit;
+		}
+
+		//
+		// Next, set the ctsStatusInformation to be used to print status updates for this protocol
+		// - this must be called after both set_logging and set_protocol
+		//
+		if (ProtocolType::TCP == g_configSettings->Protocol)
+		{
+			g_printStatusInformation = make_shared<ctsTcpStatusInformation>();
+		}
+		else
+		{
+			g_printStatusInformation = make_shared<ctsUdpStatusInformation>();
+		}
+
+		//
+		// Next: capture other various settings which do not have explicit dependencies
+		//
+		ParseForOptions(args);
+		ParseForDscpValue(args);
+		ParseForKeepAlive(args);
+		ParseForCompartment(args);
+		ParseForTrafficClass(args);
+		ParseForConnections(args);
+		ParseForThrottleConnections(args);
+		ParseForConnectionRate(args);
+		ParseForBuffer(args);
+		ParseForTransfer(args);
+		ParseForTransfersPerConnection(args);
+		ParseForIdleHold(args);
+		ParseForIterations(args);
+		ParseForServerExitLimit(args);
+
+		ParseForRateLimit(args);
+		ParseForTimeLimit(args);
+
+		if (g_rateLimitLow > 0LL && g_configSettings->BurstDelay.has_value())
+		{
+			throw invalid_argument("-RateLimit and -BurstDelay cannot be used concurrently");
+		}
+
+		const auto ratePerPeriod = g_rateLimitLow * g_configSettings->TcpBytesPerSecondPeriod / 1000LL;
+		if (g_configSettings->Protocol == ProtocolType::TCP && g_rateLimitLow > 0 && ratePerPeriod < 1)
+		{
+			throw invalid_argument(
+				"RateLimit * RateLimitPeriod / 1000 must be greater than zero - meaning every period should send at least 1 byte");
+		}
+		for (const auto& trafficClass : g_configSettings->TrafficClasses)
+		{
+			// checked once -Transfer is parsed
+			if (const auto* const serverMismatch = trafficClass.CheckServerSettings(g_configSettings->IoPattern, g_transferSizeLow, g_transferSizeHigh))
+			{
+				throw invalid_argument(serverMismatch);
+			}
+			if (trafficClass.RateLimitLow > 0LL && g_configSettings->BurstDelay.has_value())
+			{
+				throw invalid_argument("-TrafficClass RateLimit and -BurstDelay cannot be used concurrently");
+			}
+			if (trafficClass.RateLimitLow > 0LL && trafficClass.RateLimitLow * g_configSettings->TcpBytesPerSecondPeriod / 1000LL < 1)
+			{
+				throw invalid_argument(
+					"-TrafficClass RateLimit * RateLimitPeriod / 1000 must be greater than zero - meaning every period should send at least 1 byte");
+			}
+		}
+
+		//
+		// verify jitter logging requirements
+		//
+		if (g_jitterLogger && g_configSettings->Protocol != ProtocolType::UDP)
+		{
+			throw invalid_argument("Jitter can only be logged using UDP");
+		}
+		if (g_jitterLogger && !g_configSettings->ListenAddresses.empty())
+		{
+			throw invalid_argument("Jitter can only be logged on the client");
+		}
+		if (g_jitterLogger && g_configSettings->ConnectionLimit != 1)
+		{
+			throw invalid_argument("Jitter can only be logged for a single UDP connection");
+		}
+
+		if (g_mediaStreamSettings.FrameSizeBytes > 0)
+		{
+			// the bufferSize is now effectively the frame size
+			g_bufferSizeHigh = 0;
+			g_bufferSizeLow = g_mediaStreamSettings.FrameSizeBytes;
+			if (g_bufferSizeLow < 20)
+			{
+				throw invalid_argument("The media stream frame size (buffer) must be at least 20 bytes");
+			}
+		}
+
+		// validate LocalPort usage
+		if (!g_configSettings->ListenAddresses.empty() && g_configSettings->LocalPortLow != 0)
+		{
+			throw invalid_argument(
+				"Cannot specify both -listen and -LocalPort. To listen on a specific port, use -Port:####");
+		}
+		if (g_configSettings->LocalPortLow != 0)
+		{
+			const USHORT numberOfPorts =
+				g_configSettings->LocalPortHigh == 0
+				? 1
+				: static_cast<USHORT>(g_configSettings->LocalPortHigh - g_configSettings->LocalPortLow + 1);
+
+			if (numberOfPorts < g_configSettings->ConnectionLimit)
+			{
+				throw invalid_argument(
+					"Cannot specify more connections than specified local ports. "
+					"Reduce the number of connections or increase the range of local ports.");
+			}
+		}
+
+		//
+		// Set the default buffer values as these settings are optional
+		//
+		g_configSettings->ShouldVerifyBuffers = true;
+		g_configSettings->UseSharedBuffer = false;
+		ParseForShouldVerifyBuffers(args);
+		if (ProtocolType::UDP == g_configSettings->Protocol)
+		{
+			// UDP clients can never recv into the same shared buffer since it uses it for seq. numbers, etc
+			if (!IsListening())
+			{
+				g_configSettings->UseSharedBuffer = false;
+			}
+		}
+
+		//
+		// finally set the functions to use once all other settings are established
+		// set_ioFunction changes global options for socket operation for instance WSA_FLAG_REGISTERED_IO flag
+		// - hence it is requirement to invoke it prior to any socket operation
+		//
+		ParseForIoFunction(args);
+		ParseForSubmitBatch(args);
+		ParseForBusyPoll(args);
+		ParseForTls(args);
+		ParseForQuic(args);
+		ParseForInlineCompletions(args);
+		ParseForMsgWaitAll(args);
+		ParseForCreate(args);
+		ParseForConnect(args);
+		ParseForAccept(args);
+		ParseForAcceptDepth(args);
+		ParseForAcceptShards(args);
+
+		if (!g_configSettings->ListenAddresses.empty())
+		{
+			// servers 'create' connections when they accept them
+			g_configSettings->CreateFunction = g_configSettings->AcceptFunction;
+			g_configSettings->ConnectFunction = nullptr;
+			g_configSettings->TargetAddresses.clear();
+			g_configSettings->TargetAddressStrings.clear();
+		}
+		else if (wstring(g_connectFunctionName) == L"ConnectByName (cached DnsQueryEx, then ConnectEx)")
+		{
+			// in this case, we can only use the string names, not the remote addresses
+			g_configSettings->TargetAddresses.clear();
+			if (g_configSettings->TargetAddressStrings.empty())
+			{
+				throw invalid_argument("Must specify a target address");
+			}
+			if (ranges::any_of(g_configSettings->TrafficClasses, [](const ctsTrafficClass& trafficClass) noexcept { return !trafficClass.TargetAddresses.empty(); }))
+			{
+				throw invalid_argument("-TrafficClass Target is not supported with -conn:ConnectByName");
+			}
+		}
+		else
+		{
+			// in this case, we can only use the remote addresses, not the string names
+			g_configSettings->TargetAddressStrings.clear();
+			if (g_configSettings->TargetAddresses.empty())
+			{
+				throw invalid_argument("Must specify a target address");
+			}
+		}
+
+		g_configSettings->TcpShutdown = TcpShutdownType::GracefulShutdown;
+		ParseForShutdown(args);
+
+		ParseForPrePostRecvs(args);
+		if (ProtocolType::TCP == g_configSettings->Protocol &&
+			g_configSettings->ShouldVerifyBuffers &&
+			g_configSettings->PrePostRecvs > 1)
+		{
+			throw invalid_argument("-PrePostRecvs > 1 requires -Verify:connection when using TCP");
+		}
+		// UDP clients keep at least a batch of receives posted
+		if (ProtocolType::UDP == g_configSettings->Protocol &&
+			g_configSettings->PrePostRecvs < g_mediaStreamSettings.DatagramBatchSize)
+		{
+			g_configSettings->PrePostRecvs = g_mediaStreamSettings.DatagramBatchSize;
+		}
+		ParseForPrePostSends(args);
+		ParseForRecvBufValue(args);
+		ParseForSendBufValue(args);
+		ParseForZeroCopySend(args);
+		ParseForZeroCopyRecv(args);
+		ParseForFileTransfer(args);
+		ParseForSocketPool(args);
+		ParseForRecvSharding(args);
+
+		// if sharding is enabled, there must be at least one adapter with RSS enabled
+		// else they will get really poor performance since all recv completions will be on one CPU
+		if (g_configSettings->EnableRecvSharding && !g_isRssEnabledOnAnyProcessor)
+		{
+			throw invalid_argument("-EnableRecvSharding requires at least one network adapter to have RSS enabled");
+		}
+
+		if (!args.empty())
+		{
+			wstring errorString;
+			for (const auto& argString : args)
+			{
+				errorString.append(L" ");
+				errorString.append(argString);
+			}
+			errorString.append(L"\n");
+			PrintErrorInfoOverride(errorString.c_str());
+			throw invalid_argument(ctString::convert_to_string(errorString).c_str());
+		}
+
+		if (ProtocolType::UDP == g_configSettings->Protocol)
+		{
+			if (const auto timerResult = timeBeginPeriod(1); timerResult != TIMERR_NOERROR)
+			{
+				THROW_WIN32_MSG(timerResult, "timeBeginPeriod");
+			}
+			++g_timePeriodRefCount;
+		}
+
+		return true;
+	}
+
+	void Shutdown(ExitProcessType type) noexcept
+	{
+		ctsConfigInitOnce();
+
+		const auto lock = g_shutdownLock.lock();
+
+		// never overwrite a rude shutdown status
+		if (g_processStatus != ExitProcessType::Rude)
+		{
+			g_processStatus = type;
+		}
+
+		if (g_configSettings->CtrlCHandle)
+		{
+			if (!SetEvent(g_configSettings->CtrlCHandle))
+			{
+				FAIL_FAST_MSG(
+					"SetEvent(%p) failed [%lu] when trying to shutdown",
+					g_configSettings->CtrlCHandle, GetLastError());
+			}
+		}
+
+		delete g_netAdapterAddresses;
+		g_netAdapterAddresses = nullptr;
+
+		while (g_timePeriodRefCount > 0)
+		{
+			(void)timeEndPeriod(1);
+			--g_timePeriodRefCount;
+		}
+	}
+
+	// the Legend is to explain the fields for status updates
+	// - only print if status updates are going to be provided
+	void PrintLegend() noexcept
+	{
+		ctsConfigInitOnce();
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+		case 1: // status updates
+		case 2: // error info + status updates
+			// case 3: // connection info
+			// case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		if (g_printStatusInformation)
+		{
+			if (writeToConsole)
+			{
+				if (const auto* legend = g_printStatusInformation->PrintLegend(StatusFormatting::ConsoleOutput))
+				{
+					(void)fwprintf_s(stdout, L"%ws\n", legend);
+				}
+				if (const auto* header = g_printStatusInformation->PrintHeader(StatusFormatting::ConsoleOutput))
+				{
+					(void)fwprintf_s(stdout, L"%ws\n", header);
+				}
+			}
+
+			if (g_statusLogger)
+			{
+				g_statusLogger->LogLegend(g_printStatusInformation);
+				g_statusLogger->LogHeader(g_printStatusInformation);
+			}
+		}
+
+		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
+		{
+			if (ProtocolType::UDP == g_configSettings->Protocol)
+			{
+				g_connectionLogger->LogMessage(
+					L"TimeSlice,LocalAddress,RemoteAddress,Bits/Sec,Completed,Dropped,Repeated,Errors,Result,ConnectionId\r\n");
+			}
+			else
+			{
+				// TCP
+				if (g_configSettings->TrafficClasses.empty())
+				{
+					g_connectionLogger->LogMessage(
+						L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId\r\n");
+				}
+				else
+				{
+					g_connectionLogger->LogMessage(
+						L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId,TrafficClass\r\n");
+				}
+			}
+		}
+
+		if (g_jitterLogger && g_jitterLogger->IsCsvFormat())
+		{
+			g_jitterLogger->LogMessage(
+				L"SequenceNumber,SenderQpc,SenderQpf,ReceiverQpc,ReceiverQpf,RelativeInFlightTimeMs,PrevToCurrentInFlightTimeJitter\r\n");
+		}
+
+		if (g_tcpInfoLogger && g_tcpInfoLogger->IsCsvFormat())
+		{
+			g_tcpInfoLogger->LogMessage(
+				L"TimeSlice,LocalAddress,RemoteAddress,ConnectionId,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,BytesReordered,BytesRetransmitted,SynRetransmitted,DupAcksIn,MinRttUs,Mss,TimeoutEpisodes,FastRetransmit,SndLimBytesCwnd,SndLimBytesRwin,SndLimBytesSnd\r\n");
+		}
+	}
+
+	// Always print to console if override
+	void PrintExceptionOverride(_In_ PCSTR exceptionText) noexcept
+	{
+		ctsConfigInitOnce();
+
+		FAIL_FAST_IF_MSG(g_breakOnError, "[ctsTraffic] >> exception - %hs\n", exceptionText);
+
+		try
+		{
+			const auto formattedString(
+				wil::str_printf<std::wstring>(
+					L"[%.3f] %hs",
+					GetStatusTimeStamp(),
+					exceptionText));
+			(void)fwprintf_s(stderr, L"%ws\n", formattedString.c_str());
+
+			if (g_errorLogger)
+			{
+				g_errorLogger->LogError(
+					wil::str_printf<std::wstring>(L"%ws\r\n", formattedString.c_str()).c_str());
+			}
+		}
+		catch (...)
+		{
+			(void)fwprintf_s(stderr, L"Error : failed to allocate memory\n");
+			if (g_errorLogger)
+			{
+				g_errorLogger->LogError(L"Error : failed to allocate memory\r\n");
+			}
+		}
+	}
+
+	//
+	// Print* functions
+	// - tracks what level of -verbose was specified
+	//   and prints to console accordingly
+	//
+	static void PrintException(const wil::ResultException& e) noexcept
+	{
+		ctsConfigInitOnce();
+
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		WCHAR errorString[1024]{};
+		GetFailureLogString(errorString, 1024, e.GetFailureInfo());
+		if (g_breakOnError)
+		{
+			FAIL_FAST_MSG(
+				"Fatal exception: %ws", errorString);
+		}
+
+		PrintErrorInfo(errorString);
+	}
+
+	static void PrintException(const std::exception& e) noexcept
+	{
+		ctsConfigInitOnce();
+
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		try
+		{
+			PrintErrorInfo(ctString::convert_to_wstring(e.what()).c_str());
+		}
+		catch (...)
+		{
+			const auto hr = wil::ResultFromCaughtException();
+			if (g_breakOnError)
+			{
+				FAIL_FAST_MSG("Fatal exception: 0x%lx", hr);
+			}
+
+			// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+			switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+			{
+				// case 0: // nothing
+				// case 1: // status updates
+			case 2: // error info + status updates
+				// case 3: // connection info
+			case 4: // connection info + error info
+			case 5: // connection info + error info + status updates
+			case 6: // above + debug info
+				(void)fwprintf_s(stderr, L"[%.3f] Exception thrown: %hs\n", GetStatusTimeStamp(), e.what());
+			}
+		}
+	}
+
+	DWORD PrintThrownException() noexcept
+	{
+		try
+		{
+			throw;
+		}
+		catch (const wil::ResultException& e)
+		{
+			PrintException(e);
+			return Win32FromHresult(e.GetErrorCode());
+		}
+		catch (const std::exception& e)
+		{
+			PrintException(e);
+			return WSAENOBUFS;
+		}
+		catch (...)
+		{
+			FAIL_FAST();
+		}
+	}
+
+	void PrintException(DWORD why, _In_ PCWSTR what, _In_ PCWSTR where) noexcept try
+	{
+		const auto translation = ctString::format_message(why);
+		const auto formattedString = wil::str_printf<std::wstring>(
+			L"[exception] %ws%ws%ws%ws [%u / 0x%lx - %ws]",
+			what ? L" " : L"",
+			what ? what : L"",
+			where ? L" at " : L"",
+			where ? where : L"",
+			why,
+			why,
+			!translation.empty() ? translation.c_str() : L"unknown error");
+		PrintErrorInfo(formattedString.c_str());
+	}
+	catch (...)
+	{
+		PrintErrorInfo(L"[exception] out of memory");
+	}
+
+	// Always print to console if override
+	void PrintErrorInfoOverride(_In_ PCWSTR text) noexcept try
+	{
+		ctsConfigInitOnce();
+
+		if (g_breakOnError)
+		{
+			FAIL_FAST_MSG("%ws", text);
+		}
+
+		(void)fwprintf_s(stderr, L"%ws\n", text);
+
+		if (g_errorLogger)
+		{
+			g_errorLogger->LogError(
+				wil::str_printf<std::wstring>(
+					L"[%.3f] %ws\r\n",
+					GetStatusTimeStamp(), text).c_str());
+		}
+	}
+	catch (...)
+	{
+	}
+
+	void PrintErrorIfFailed(_In_ PCSTR what, uint32_t why) noexcept try
+	{
+		ctsConfigInitOnce();
+
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		if (why == 0)
+		{
+			return;
+		}
+
+		if (g_breakOnError)
+		{
+			FAIL_FAST_MSG("%hs failed (%u)\n", what, why);
+		}
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+			// case 1: // status updates
+		case 2: // error info + status updates
+			// case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		if (!writeToConsole && !g_errorLogger)
+		{
+			return;
+		}
+
+		wstring errorString;
+		if (ctsIoPattern::IsProtocolError(why))
+		{
+			errorString = wil::str_printf<std::wstring>(
+				L"[%.3f] Connection aborted due to the protocol error %ws",
+				GetStatusTimeStamp(),
+				ctsIoPattern::BuildProtocolErrorString(why));
+		}
+		else
+		{
+			errorString = wil::str_printf<std::wstring>(
+				L"[%.3f] %hs failed (%u) %ws",
+				GetStatusTimeStamp(),
+				what,
+				why,
+				ctString::format_message(why).c_str());
+		}
+
+		if (writeToConsole)
+		{
+			(void)fwprintf_s(stderr, L"%ws\n", errorString.c_str());
+		}
+
+		if (g_errorLogger)
+		{
+			g_errorLogger->LogError(
+				wil::str_printf<std::wstring>(L"%ws\r\n", errorString.c_str()).c_str());
+		}
+	}
+	catch (...)
+	{
+	}
+
+	//
+	// Captures the private bytes of the process when the most IdleHold connections are held
+	// - sampled on each status update independent of the status verbosity
+	//
+	static void SampleIdleHoldMemory() noexcept
+	{
+		if (g_configSettings->IoPattern != IoPatternType::IdleHold)
+		{
+			return;
+		}
+
+		const auto activeConnections = g_configSettings->ConnectionStatusDetails.m_activeConnectionCount.GetValue();
+		if (activeConnections > g_configSettings->IdleHoldPeakConnections.GetValue())
+		{
+			if (const auto privateBytes = GetProcessPrivateBytes(); privateBytes > 0)
+			{
+				g_configSettings->IdleHoldPeakConnections.SetValue(activeConnections);
+				g_configSettings->IdleHoldPeakPrivateBytes.SetValue(privateBytes);
+			}
+		}
+	}
+
+	void PrintStatusUpdate() noexcept
+	{
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		SampleIdleHoldMemory();
+
+		if (!g_printStatusInformation)
+		{
+			return;
+		}
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+		case 1: // status updates
+		case 2: // error info + status updates
+			// case 3: // connection info
+			// case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		if (!writeToConsole && !g_statusLogger)
+		{
+			return;
+		}
+
+		if (const auto lock = g_statusUpdateLock.try_lock())
+		{
+			// capture the timeSlices
+			const auto lPreviousTimeSlice = g_previousPrintTimeSlice;
+			const auto lCurrentTimeSlice = ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds;
+
+			if (lCurrentTimeSlice > lPreviousTimeSlice)
+			{
+				// write out the header to the console every 40 updates 
+				if (writeToConsole)
+				{
+					if (g_printTimeSliceCount != 0 && 0 == g_printTimeSliceCount % 40)
+					{
+						if (const auto* header = g_printStatusInformation->PrintHeader(
+							StatusFormatting::ConsoleOutput))
+						{
+							(void)fwprintf_s(stdout, L"%ws", header);
+						}
+					}
+				}
+
+				// need to indicate either print_status() or LogStatus() to reset the status info,
+				// - the data *must* be reset once and *only once* in this function
+
+				auto statusCount = 0;
+				if (writeToConsole)
+				{
+					++statusCount;
+				}
+				if (g_statusLogger)
+				{
+					++statusCount;
+				}
+
+				if (writeToConsole)
+				{
+					--statusCount;
+					const bool clearStatus = 0 == statusCount;
+					if (const auto* printString = g_printStatusInformation->PrintStatus(
+						StatusFormatting::ConsoleOutput, lCurrentTimeSlice, clearStatus))
+					{
+						(void)fwprintf_s(stdout, L"%ws", printString);
+					}
+				}
+
+				if (g_statusLogger)
+				{
+					--statusCount;
+					const bool clearStatus = 0 == statusCount;
+					g_statusLogger->LogStatus(g_printStatusInformation, lCurrentTimeSlice, clearStatus);
+				}
+
+				// update tracking values
+				g_previousPrintTimeSlice = lCurrentTimeSlice;
+				++g_printTimeSliceCount;
+			}
+		}
+	}
+
+	void PrintJitterUpdate(const JitterFrameEntry& currentFrame, const JitterFrameEntry& previousFrame) noexcept
+	{
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		if (g_jitterLogger)
+		{
+			const auto jitter = std::abs(
+				previousFrame.m_estimatedTimeInFlightMs - currentFrame.m_estimatedTimeInFlightMs);
+			// int64_t ~= up to 20 characters long, 10 for each float, plus 10 for commas & CR
+			constexpr size_t formattedTextLength = 20 * 5 + 10 * 2 + 10;
+			wchar_t formattedText[formattedTextLength]{};
+			const auto converted = _snwprintf_s(
+				formattedText,
+				formattedTextLength,
+				L"%lld,%lld,%lld,%lld,%lld,%.3f,%.3f\r\n",
+				currentFrame.m_sequenceNumber, currentFrame.m_senderQpc, currentFrame.m_senderQpf,
+				currentFrame.m_receiverQpc, currentFrame.m_receiverQpf, currentFrame.m_estimatedTimeInFlightMs,
+				jitter);
+			FAIL_FAST_IF(-1 == converted);
+			g_jitterLogger->LogMessage(formattedText);
+		}
+	}
+
+	void PrintNewConnection(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr) noexcept try
+	{
+		ctsConfigInitOnce();
+
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		// write even after shutdown so can print the final summaries
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+			// case 1: // status updates
+			// case 2: // error info + status updates
+		case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		const auto writeToLogFile = g_connectionLogger && !g_connectionLogger->IsCsvFormat();
+		if (!writeToConsole && !writeToLogFile)
+		{
+			return;
+		}
+
+		wil::network::socket_address_wstring wsaLocalAddress{};
+		localAddr.format_complete_address_nothrow(wsaLocalAddress);
+		wil::network::socket_address_wstring wsaRemoteAddress{};
+		remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
+		if (writeToConsole)
+		{
+			constexpr auto* const tcpConnectionString = L"[%.3f] TCP connection established [%ws - %ws]\n";
+			constexpr auto* const udpConnectionString = L"[%.3f] UDP connection established [%ws - %ws]\n";
+			const auto* const connectionString = ProtocolType::TCP == g_configSettings->Protocol ? tcpConnectionString : udpConnectionString;
+
+			(void)fwprintf_s(
+				stdout,
+				connectionString,
+				GetStatusTimeStamp(),
+				wsaLocalAddress,
+				wsaRemoteAddress);
+		}
+
+		if (writeToLogFile)
+		{
+			g_connectionLogger->LogMessage(
+				wil::str_printf<std::wstring>(
+					ProtocolType::TCP == g_configSettings->Protocol
+					? L"[%.3f] TCP connection established [%ws - %ws]\r\n"
+					: L"[%.3f] UDP connection established [%ws - %ws]\r\n",
+					GetStatusTimeStamp(),
+					wsaLocalAddress,
+					wsaRemoteAddress).c_str());
+		}
+	}
+	catch (...)
+	{
+	}
+
+	void PrintConnectionResults(uint32_t error) noexcept try
+	{
+		ctsConfigInitOnce();
+
+		// write even after shutdown so can print the final summaries
+		// except for a rude exit - not printing connection summaries after a rude exit is triggered
+		if (g_processStatus == ExitProcessType::Rude)
+		{
+			return;
+		}
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+			// case 1: // status updates
+			// case 2: // error info + status updates
+		case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		if (!writeToConsole && !g_connectionLogger)
+		{
+			return;
+		}
+
+		enum class ErrorType : std::uint8_t
+		{
+			Success,
+			NetworkError,
+			ProtocolError
+		} errorType = ErrorType::Success;
+
+		if (0 == error)
+		{
+			errorType = ErrorType::Success;
+		}
+		else if (ctsIoPattern::IsProtocolError(error))
+		{
+			errorType = ErrorType::ProtocolError;
+		}
+		else
+		{
+			errorType = ErrorType::NetworkError;
+		}
+
+
+		const float currentTime = GetStatusTimeStamp();
+
+		wstring csvString;
+		wstring textString;
+		wstring errorString;
+		if (ErrorType::ProtocolError != errorType)
+		{
+			if (0 == error)
+			{
+				errorString = L"Succeeded";
+			}
+			else
+			{
+				errorString = wil::str_printf<std::wstring>(
+					L"%lu: %ws",
+					error,
+					ctString::format_message(error).c_str());
+				// remove any commas from the formatted string - since that will mess up csv files
+				ctString::replace_all(errorString, L",", L" ");
+			}
+		}
+
+		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
+		{
+			// csv format : L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId"
+			static const auto* tcpResultCsvFormat = L"%.3f,%ws,%ws,%lld,%lld,%lld,%lld,%lld,%ws,%hs\r\n";
+			csvString = wil::str_printf<std::wstring>(
+				tcpResultCsvFormat,
+				currentTime,
+				wil::network::socket_address().format_complete_address().c_str(),
+				wil::network::socket_address().format_complete_address().c_str(),
+				0LL,
+				0LL,
+				0LL,
+				0LL,
+				0LL,
+				errorString.c_str(),
+				L"");
+			if (!g_configSettings->TrafficClasses.empty())
+			{
+				// no traffic class is known when the connection failed before being created - leave the column empty
+				csvString.insert(csvString.size() - 2, L",");
+			}
+		}
+		// we'll never write csv format to the console, so we'll need a text string in that case
+		// - and/or in the case the g_ConnectionLogger isn't writing to csv
+		if (writeToConsole || (g_connectionLogger && !g_connectionLogger->IsCsvFormat()))
+		{
+			static const auto* tcpNetworkFailureResultTextFormat =
+				L"[%.3f] TCP connection failed with the error %ws : [%ws - %ws] [%hs] : SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
+			textString = wil::str_printf<std::wstring>(
+				tcpNetworkFailureResultTextFormat,
+				currentTime,
+				errorString.c_str(),
+				wil::network::socket_address().format_complete_address().c_str(),
+				wil::network::socket_address().format_complete_address().c_str(),
+				L"",
+				0LL,
+				0LL,
+				0LL,
+				0LL,
+				0LL);
+		}
+
+		if (writeToConsole)
+		{
+			// text strings always go to the console
+			(void)fwprintf_s(stdout, L"%ws\n", textString.c_str());
+		}
+
+		if (g_connectionLogger)
+		{
+			if (g_connectionLogger->IsCsvFormat())
+			{
+				g_connectionLogger->LogMessage(csvString.c_str());
+			}
+			else
+			{
+				g_connectionLogger->LogMessage(
+					wil::str_printf<std::wstring>(L"%ws\r\n", textString.c_str()).c_str());
+			}
+		}
+	}
+	catch (...)
+	{
+	}
+
+	void PrintConnectionResults(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, uint32_t error,
+		const ctsTcpStatistics& stats, uint32_t trafficClass) noexcept try
+	{
+		ctsConfigInitOnce();
+
+		// write even after shutdown so can print the final summaries
+		// except for a rude exit - not printing connection summaries after a rude exit is triggered
+		if (g_processStatus == ExitProcessType::Rude)
+		{
+			return;
+		}
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+			// case 1: // status updates
+			// case 2: // error info + status updates
+		case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		if (!writeToConsole && !g_connectionLogger)
+		{
+			return;
+		}
+
+		enum class ErrorType : std::uint8_t
+		{
+			Success,
+			NetworkError,
+			ProtocolError
+		} errorType = ErrorType::Success;
+
+		if (0 == error)
+		{
+			errorType = ErrorType::Success;
+		}
+		else if (ctsIoPattern::IsProtocolError(error))
+		{
+			errorType = ErrorType::ProtocolError;
+		}
+		else
+		{
+			errorType = ErrorType::NetworkError;
+		}
+
+		const int64_t totalTime = stats.m_endTime.GetValue() - stats.m_startTime.GetValue();
+		FAIL_FAST_IF_MSG(
+			totalTime < 0LL,
+			"end_time is less than start_time in this ctsTcpStatistics object (%p)", &stats);
+		const float currentTime = GetStatusTimeStamp();
+		const auto* const classSettings = g_configSettings->GetTrafficClass(trafficClass);
+
+		wstring csvString;
+		wstring textString;
+		wstring errorString;
+		if (ErrorType::ProtocolError != errorType)
+		{
+			if (0 == error)
+			{
+				errorString = L"Succeeded";
+			}
+			else
+			{
+				errorString = wil::str_printf<std::wstring>(
+					L"%lu: %ws",
+					error,
+					ctString::format_message(error).c_str());
+				// remove any commas from the formatted string - since that will mess up csv files
+				ctString::replace_all(errorString, L",", L" ");
+			}
+		}
+
+		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
+		{
+			wil::network::socket_address_wstring wsaLocalAddress{};
+			localAddr.format_complete_address_nothrow(wsaLocalAddress);
+			wil::network::socket_address_wstring wsaRemoteAddress{};
+			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
+
+			// csv format : L"TimeSlice,LocalAddress,RemoteAddress,SendBytes,SendBps,RecvBytes,RecvBps,TimeMs,Result,ConnectionId"
+			static const auto* tcpResultCsvFormat = L"%.3f,%ws,%ws,%lld,%lld,%lld,%lld,%lld,%ws,%hs\r\n";
+			csvString = wil::str_printf<std::wstring>(
+				tcpResultCsvFormat,
+				currentTime,
+				wsaLocalAddress,
+				wsaRemoteAddress,
+				stats.m_bytesSent.GetValue(),
+				totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
+				stats.m_bytesRecv.GetValue(),
+				totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
+				totalTime,
+				ErrorType::ProtocolError == errorType
+				? ctsIoPattern::BuildProtocolErrorString(error)
+				: errorString.c_str(),
+				stats.m_connectionIdentifier);
+			if (classSettings)
+			{
+				csvString.insert(csvString.size() - 2, L"," + classSettings->Name);
+			}
+		}
+		// we'll never write csv format to the console, so we'll need a text string in that case
+		// - and/or in the case the g_ConnectionLogger isn't writing to csv
+		if (writeToConsole || (g_connectionLogger && !g_connectionLogger->IsCsvFormat()))
+		{
+			wil::network::socket_address_wstring wsaLocalAddress{};
+			localAddr.format_complete_address_nothrow(wsaLocalAddress);
+			wil::network::socket_address_wstring wsaRemoteAddress{};
+			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
+
+			if (0 == error)
+			{
+				static const auto* tcpSuccessfulResultTextFormat =
+					L"[%.3f] TCP connection succeeded : [%ws - %ws] [%hs]: SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
+				textString = wil::str_printf<std::wstring>(
+					tcpSuccessfulResultTextFormat,
+					currentTime,
+					wsaLocalAddress,
+					wsaRemoteAddress,
+					stats.m_connectionIdentifier,
+					stats.m_bytesSent.GetValue(),
+					totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
+					stats.m_bytesRecv.GetValue(),
+					totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
+					totalTime);
+			}
+			else
+			{
+				static const auto* tcpProtocolFailureResultTextFormat =
+					L"[%.3f] TCP connection failed with the protocol error %ws : [%ws - %ws] [%hs] : SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
+				static const auto* tcpNetworkFailureResultTextFormat =
+					L"[%.3f] TCP connection failed with the error %ws : [%ws - %ws] [%hs] : SendBytes[%lld]  SendBps[%lld]  RecvBytes[%lld]  RecvBps[%lld]  Time[%lld ms]";
+				textString = wil::str_printf<std::wstring>(
+					ErrorType::ProtocolError == errorType
+					? tcpProtocolFailureResultTextFormat
+					: tcpNetworkFailureResultTextFormat,
+					currentTime,
+					ErrorType::ProtocolError == errorType
+					? ctsIoPattern::BuildProtocolErrorString(error)
+					: errorString.c_str(),
+					wsaLocalAddress,
+					wsaRemoteAddress,
+					stats.m_connectionIdentifier,
+					stats.m_bytesSent.GetValue(),
+					totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
+					stats.m_bytesRecv.GetValue(),
+					totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
+					totalTime);
+			}
+			if (classSettings)
+			{
+				textString.append(L"  TrafficClass[" + classSettings->Name + L"]");
+			}
+		}
+
+		if (writeToConsole)
+		{
+			// text strings always go to the console
+			(void)fwprintf_s(stdout, L"%ws\n", textString.c_str());
+		}
+
+		if (g_connectionLogger)
+		{
+			if (g_connectionLogger->IsCsvFormat())
+			{
+				g_connectionLogger->LogMessage(csvString.c_str());
+			}
+			else
+			{
+				g_connectionLogger->LogMessage(
+					wil::str_printf<std::wstring>(L"%ws\r\n", textString.c_str()).c_str());
+			}
+		}
+	}
+	catch (...)
+	{
+	}
+
+	void PrintConnectionResults(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, uint32_t error,
+		const ctsUdpStatistics& stats) noexcept try
+	{
+		ctsConfigInitOnce();
+
+		// write even after shutdown so can print the final summaries
+		// except for a rude exit - not printing connection summaries after a rude exit is triggered
+		if (g_processStatus == ExitProcessType::Rude)
+		{
+			return;
+		}
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+			// case 1: // status updates
+			// case 2: // error info + status updates
+		case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		{
+			writeToConsole = true;
+		}
+		}
+
+		if (!writeToConsole && !g_connectionLogger)
+		{
+			return;
+		}
+
+		enum class ErrorType : std::uint8_t
+		{
+			Success,
+			NetworkError,
+			ProtocolError
+		} errorType{};
+
+		if (0 == error)
+		{
+			errorType = ErrorType::Success;
+		}
+		else if (ctsIoPattern::IsProtocolError(error))
+		{
+			errorType = ErrorType::ProtocolError;
+		}
+		else
+		{
+			errorType = ErrorType::NetworkError;
+		}
+
+		const float currentTime = GetStatusTimeStamp();
+		// the connection has ended - no locks needed
+		const int64_t elapsedTime(stats.m_endTime.GetValue() - stats.m_startTime.GetValue());
+		const int64_t bitsPerSecond = elapsedTime > 0LL ? stats.m_bitsReceived.GetValue() * 1000LL / elapsedTime : 0LL;
+
+		wstring csvString;
+		wstring textString;
+		wstring errorString;
+		if (ErrorType::ProtocolError != errorType)
+		{
+			if (0 == error)
+			{
+				errorString = L"Succeeded";
+			}
+			else
+			{
+				errorString = wil::str_printf<std::wstring>(
+					L"%lu: %ws",
+					error,
+					ctString::format_message(error).c_str());
+				// remove any commas from the formatted string - since that will mess up csv files
+				ctString::replace_all(errorString, L",", L" ");
+			}
+		}
+
+		if (g_connectionLogger && g_connectionLogger->IsCsvFormat())
+		{
+			wil::network::socket_address_wstring wsaLocalAddress{};
+			localAddr.format_complete_address_nothrow(wsaLocalAddress);
+			wil::network::socket_address_wstring wsaRemoteAddress{};
+			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
+
+			// csv format : "TimeSlice,LocalAddress,RemoteAddress,Bits/Sec,Completed,Dropped,Repeated,Errors,Result,ConnectionId"
+			static const auto* udpResultCsvFormat = L"%.3f,%ws,%ws,%llu,%llu,%llu,%llu,%llu,%ws,%hs\r\n";
+			csvString = wil::str_printf<std::wstring>(
+				udpResultCsvFormat,
+				currentTime,
+				wsaLocalAddress,
+				wsaRemoteAddress,
+				bitsPerSecond,
+				stats.m_successfulFrames.GetValue(),
+				stats.m_droppedFrames.GetValue(),
+				stats.m_duplicateFrames.GetValue(),
+				stats.m_errorFrames.GetValue(),
+				ErrorType::ProtocolError == errorType
+				? ctsIoPattern::BuildProtocolErrorString(error)
+				: errorString.c_str(),
+				stats.m_connectionIdentifier);
+		}
+		// we'll never write csv format to the console, so we'll need a text string in that case
+		// - and/or in the case the g_ConnectionLogger isn't writing to csv
+		if (writeToConsole || g_connectionLogger && !g_connectionLogger->IsCsvFormat())
+		{
+			wil::network::socket_address_wstring wsaLocalAddress{};
+			localAddr.format_complete_address_nothrow(wsaLocalAddress);
+			wil::network::socket_address_wstring wsaRemoteAddress{};
+			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
+
+			if (0 == error)
+			{
+				static const auto* udpSuccessfulResultTextFormat =
+					L"[%.3f] UDP connection succeeded : [%ws - %ws] [%hs] : BitsPerSecond [%llu]  Completed [%llu]  Dropped [%llu]  Repeated [%llu]  Errors [%llu]";
+				textString = wil::str_printf<std::wstring>(
+					udpSuccessfulResultTextFormat,
+					currentTime,
+					wsaLocalAddress,
+					wsaRemoteAddress,
+					stats.m_connectionIdentifier,
+					bitsPerSecond,
+					stats.m_successfulFrames.GetValue(),
+					stats.m_droppedFrames.GetValue(),
+					stats.m_duplicateFrames.GetValue(),
+					stats.m_errorFrames.GetValue());
+			}
+			else
+			{
+				static const auto* udpProtocolFailureResultTextFormat =
+					L"[%.3f] UDP connection failed with the protocol error %ws : [%ws - %ws] [%hs] : BitsPerSecond [%llu]  Completed [%llu]  Dropped [%llu]  Repeated [%llu]  Errors [%llu]";
+				static const auto* udpNetworkFailureResultTextFormat =
+					L"[%.3f] UDP connection failed with the error %ws : [%ws - %ws] [%hs] : BitsPerSecond [%llu]  Completed [%llu]  Dropped [%llu]  Repeated [%llu]  Errors [%llu]";
+				textString = wil::str_printf<std::wstring>(
+					ErrorType::ProtocolError == errorType
+					? udpProtocolFailureResultTextFormat
+					: udpNetworkFailureResultTextFormat,
+					currentTime,
+					ErrorType::ProtocolError == errorType
+					? ctsIoPattern::BuildProtocolErrorString(error)
+					: errorString.c_str(),
+					wsaLocalAddress,
+					wsaRemoteAddress,
+					stats.m_connectionIdentifier,
+					bitsPerSecond,
+					stats.m_successfulFrames.GetValue(),
+					stats.m_droppedFrames.GetValue(),
+					stats.m_duplicateFrames.GetValue(),
+					stats.m_errorFrames.GetValue());
+			}
+		}
+
+		if (writeToConsole)
+		{
+			// text strings always go to the console
+			(void)fwprintf_s(stdout, L"%ws\n", textString.c_str());
+		}
+
+		if (g_connectionLogger)
+		{
+			if (g_connectionLogger->IsCsvFormat())
+			{
+				g_connectionLogger->LogMessage(csvString.c_str());
+			}
+			else
+			{
+				g_connectionLogger->LogMessage(
+					wil::str_printf<std::wstring>(L"%ws\r\n", textString.c_str()).c_str());
+			}
+		}
+	}
+	catch (...)
+	{
+	}
+
+	void PrintTcpDetails(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, SOCKET socket,
+		const ctsTcpStatistics& stats) noexcept try
+	{
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		if (g_tcpInfoLogger)
+		{
+			wil::network::socket_address_wstring wsaLocalAddress{};
+			localAddr.format_complete_address_nothrow(wsaLocalAddress);
+			wil::network::socket_address_wstring wsaRemoteAddress{};
+			remoteAddr.format_complete_address_nothrow(wsaRemoteAddress);
+
+			static const auto* tcpSuccessfulResultTextFormat = L"%.3f, %ws, %ws, %hs, %lld, %lld, %lld, %lld, %lld, ";
+			const int64_t totalTime{ stats.m_endTime.GetValue() - stats.m_startTime.GetValue() };
+			auto textString = wil::str_printf<std::wstring>(
+				tcpSuccessfulResultTextFormat,
+				GetStatusTimeStamp(),
+				wsaLocalAddress,
+				wsaRemoteAddress,
+				stats.m_connectionIdentifier,
+				stats.m_bytesSent.GetValue(),
+				totalTime > 0LL ? stats.m_bytesSent.GetValue() * 1000LL / totalTime : 0LL,
+				stats.m_bytesRecv.GetValue(),
+				totalTime > 0LL ? stats.m_bytesRecv.GetValue() * 1000LL / totalTime : 0LL,
+				totalTime);
+
+			DWORD bytesReturned{};
+			TCP_INFO_v1 tcpInfo1{};
+			DWORD tcpInfoVersion = 1;
+			if (WSAIoctl(
+				socket,
+				SIO_TCP_INFO,
+				&tcpInfoVersion, sizeof(tcpInfoVersion),
+				&tcpInfo1, sizeof(tcpInfo1),
+				&bytesReturned,
+				nullptr,
+				nullptr) == 0)
+			{
+				// the OS supports TCP_INFO_v1 - write those details
+				static const auto* tcpInfoVersion1TextFormat =
+					L"%lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu\r\n";
+				textString += wil::str_printf<std::wstring>(
+					tcpInfoVersion1TextFormat,
+					tcpInfo1.BytesReordered,
+					tcpInfo1.BytesRetrans,
+					tcpInfo1.SynRetrans,
+					tcpInfo1.DupAcksIn,
+					tcpInfo1.MinRttUs,
+					tcpInfo1.Mss,
+					tcpInfo1.TimeoutEpisodes,
+					tcpInfo1.FastRetrans,
+					tcpInfo1.SndLimBytesCwnd,
+					tcpInfo1.SndLimBytesRwin,
+					tcpInfo1.SndLimBytesSnd);
+				g_tcpInfoLogger->LogMessage(textString.c_str());
+				return;
+			}
+
+			TCP_INFO_v0 tcpInfo0{};
+			tcpInfoVersion = 0;
+			if (WSAIoctl(
+				socket,
+				SIO_TCP_INFO,
+				&tcpInfoVersion, sizeof(tcpInfoVersion),
+				&tcpInfo0, sizeof(tcpInfo0),
+				&bytesReturned,
+				nullptr,
+				nullptr) == 0)
+			{
+				// the OS supports TCP_INFO_v0 - write those details
+				static const auto* tcpInfoVersion0TextFormat = L"%lu, %lu, %lu, %lu, %lu, %lu, %lu, %lu";
+				textString += wil::str_printf<std::wstring>(
+					tcpInfoVersion0TextFormat,
+					tcpInfo0.BytesReordered,
+					tcpInfo0.BytesRetrans,
+					tcpInfo0.SynRetrans,
+					tcpInfo0.DupAcksIn,
+					tcpInfo0.MinRttUs,
+					tcpInfo0.Mss,
+					tcpInfo0.TimeoutEpisodes,
+					tcpInfo0.FastRetrans);
+				g_tcpInfoLogger->LogMessage(textString.c_str());
+			}
+		}
+	}
+	catch (...)
+	{
+	}
+
+	void __cdecl PrintSummary(_In_ _Printf_format_string_ PCWSTR text, ...) noexcept
+	{
+		ctsConfigInitOnce();
+
+		// always write the summary, regardless of consoleVerbosity
+
+		va_list argptr;
+		va_start(argptr, text);
+		try
+		{
+			wstring formattedString;
+			wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr);
+			(void)fwprintf_s(stdout, L"%ws", formattedString.c_str());
+
+			if (g_connectionLogger && !g_connectionLogger->IsCsvFormat())
+			{
+				if (formattedString.empty())
+				{
+					wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr);
+				}
+				g_connectionLogger->LogMessage(
+					ctString::replace_all_copy(formattedString, L"\n", L"\r\n").c_str());
+			}
+		}
+		catch (...)
+		{
+		}
+		va_end(argptr);
+	}
+
+	void PrintErrorInfo(_In_ _Printf_format_string_ PCWSTR text, ...) noexcept
+	{
+		ctsConfigInitOnce();
+
+		if (g_processStatus != ExitProcessType::Running)
+		{
+			return;
+		}
+
+		if (g_breakOnError)
+		{
+			FAIL_FAST_MSG("%ws", text);
+		}
+
+		auto writeToConsole = false;
+		// ReSharper disable once CppDefaultCaseNotHandledInSwitchStatement
+		switch (g_consoleVerbosity) // NOLINT(hicpp-multiway-paths-covered)
+		{
+			// case 0: // nothing
+			// case 1: // status updates
+		case 2: // error info + status updates
+			// case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+			writeToConsole = true;
+			break;
+		}
+
+		va_list argptr;
+		va_start(argptr, text);
+		try
+		{
+			std::wstring formattedString;
+			if (writeToConsole)
+			{
+				if (SUCCEEDED(wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr)))
+				{
+					(void)fwprintf_s(stdout, L"%ws\n", formattedString.c_str());
+				}
+			}
+
+			if (g_errorLogger && !g_errorLogger->IsCsvFormat())
+			{
+				if (formattedString.empty())
+				{
+					wil::details::str_vprintf_nothrow<std::wstring>(formattedString, text, argptr);
+				}
+
+				if (!formattedString.empty())
+				{
+					g_errorLogger->LogError(
+						wil::str_printf<std::wstring>(
+							L"[%.3f] %ws\r\n",
+							GetStatusTimeStamp(),
+							formattedString.c_str()).c_str());
+				}
+			}
+		}
+		catch (...)
+		{
+		}
+		va_end(argptr);
+	}
+
+	//
+	// Get* 
+	// - accessor functions made public to retrieve configuration details
+	//
+	uint32_t GetBufferSize() noexcept
+	{
+		ctsConfigInitOnce();
+
+		return 0 == g_bufferSizeHigh ? g_bufferSizeLow : g_randomTwister.uniform_int(g_bufferSizeLow, g_bufferSizeHigh);
+	}
+
+	uint32_t GetBufferSize(uint32_t trafficClass) noexcept
+	{
+		ctsConfigInitOnce();
+
+		const auto* const classSettings = g_configSettings->GetTrafficClass(trafficClass);
+		if (!classSettings || 0 == classSettings->BufferSizeLow)
+		{
+			return GetBufferSize();
+		}
+		return 0 == classSettings->BufferSizeHigh
+			? classSettings->BufferSizeLow
+			: g_randomTwister.uniform_int(classSettings->BufferSizeLow, classSettings->BufferSizeHigh);
+	}
+
+	uint32_t GetMaxBufferSize() noexcept
+	{
+		ctsConfigInitOnce();
+
+		// buffers are shared across all traffic classes - they must fit the largest buffer of any class
+		auto maxBufferSize = g_bufferSizeHigh == 0 ? g_bufferSizeLow : g_bufferSizeHigh;
+		for (const auto& classSettings : g_configSettings->TrafficClasses)
+		{
+			maxBufferSize = std::max(maxBufferSize, std::max(classSettings.BufferSizeLow, classSettings.BufferSizeHigh));
+		}
+		return maxBufferSize;
+	}
+
+	uint32_t GetMinBufferSize() noexcept
+	{
+		ctsConfigInitOnce();
+
+		auto minBufferSize = g_bufferSizeLow;
+		for (const auto& classSettings : g_configSettings->TrafficClasses)
+		{
+			if (classSettings.BufferSizeLow != 0)
+			{
+				minBufferSize = std::min(minBufferSize, classSettings.BufferSizeLow);
+			}
+		}
+		return minBufferSize;
+	}
+
+	uint64_t GetTransferSize() noexcept
+	{
+		ctsConfigInitOnce();
+
+		return 0 == g_transferSizeHigh
+			? g_transferSizeLow
+			: g_randomTwister.uniform_int(g_transferSizeLow, g_transferSizeHigh);
+	}
+
+	int64_t GetTcpBytesPerSecond() noexcept
+	{
+		ctsConfigInitOnce();
+
+		return 0 == g_rateLimitHigh ? g_rateLimitLow : g_randomTwister.uniform_int(g_rateLimitLow, g_rateLimitHigh);
+	}
+
+	uint64_t GetTransferSize(uint32_t trafficClass) noexcept
+	{
+		ctsConfigInitOnce();
+
+		const auto* const classSettings = g_configSettings->GetTrafficClass(trafficClass);
+		if (!classSettings || 0 == classSettings->TransferSizeLow)
+		{
+			return GetTransferSize();
+		}
+		return 0 == classSettings->TransferSizeHigh
+			? classSettings->TransferSizeLow
+			: g_randomTwister.uniform_int(classSettings->TransferSizeLow, classSettings->TransferSizeHigh);
+	}
+
+	int64_t GetTcpBytesPerSecond(uint32_t trafficClass) noexcept
+	{
+		ctsConfigInitOnce();
+
+		const auto* const classSettings = g_configSettings->GetTrafficClass(trafficClass);
+		if (!classSettings || 0 == classSettings->RateLimitLow)
+		{
+			return GetTcpBytesPerSecond();
+		}
+		return 0 == classSettings->RateLimitHigh
+			? classSettings->RateLimitLow
+			: g_randomTwister.uniform_int(classSettings->RateLimitLow, classSettings->RateLimitHigh);
+	}
+
+	int GetListenBacklog() noexcept
+	{
+		ctsConfigInitOnce();
+
+		auto backlog = SOMAXCONN;
+		// Starting in Win8 listen() supports a larger backlog
+		if (static_cast<bool>(g_configSettings->rioFunctions))
+		{
+			backlog = SOMAXCONN_HINT(SOMAXCONN);
+		}
+		return backlog;
+	}
+
+	TcpShutdownType GetShutdownType() noexcept
+	{
+		if (g_configSettings->TcpShutdown != TcpShutdownType::Random)
+		{
+			return g_configSettings->TcpShutdown;
+		}
+
+		const auto randomValue = g_randomTwister.uniform_int(0, 1);
+		return (randomValue == 0) ? TcpShutdownType::GracefulShutdown : TcpShutdownType::HardShutdown;
+	}
+
+	int64_t GetProcessPrivateBytes() noexcept
+	{
+		PROCESS_MEMORY_COUNTERS_EX memoryCounters{};
+		if (!GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&memoryCounters), sizeof memoryCounters))
+		{
+			PRINT_DEBUG_INFO(L"\t\tctsConfig::GetProcessPrivateBytes : GetProcessMemoryInfo failed (%lu)\n", GetLastError());
+			return 0;
+		}
+		return static_cast<int64_t>(memoryCounters.PrivateUsage);
+	}
+
+	uint64_t GetProcessCycleTime() noexcept
+	{
+		ULONG64 cycleTime{};
+		if (!QueryProcessCycleTime(GetCurrentProcess(), &cycleTime))
+		{
+			PRINT_DEBUG_INFO(L"\t\tctsConfig::GetProcessCycleTime : QueryProcessCycleTime failed (%lu)\n", GetLastError());
+			return 0;
+		}
+		return cycleTime;
+	}
+
+	const MediaStreamSettings& GetMediaStream() noexcept
+	{
+		ctsConfigInitOnce();
+
+		FAIL_FAST_IF_MSG(
+			0 == g_mediaStreamSettings.BitsPerSecond,
+			"Internally requesting media stream settings when this was not specified by the user");
+
+		return g_mediaStreamSettings;
+	}
+
+	bool IsListening() noexcept
+	{
+		ctsConfigInitOnce();
+
+		return !g_configSettings->ListenAddresses.empty();
+	}
+
+	float GetStatusTimeStamp() noexcept
+	{
+		return static_cast<float>(ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds) / 1000.0f;
+	}
+
+	uint32_t GetShardCount() noexcept
+	{
+		auto shardCount = static_cast<int>(g_configSettings->ShardCount);
+		if (shardCount == 0) {
+			const auto info = QueryCpuAffinitySupport();
+			const uint32_t logical = info.LogicalProcessorCount ? info.LogicalProcessorCount : 1u;
+			shardCount = static_cast<int>(logical);
+		}
+		return shardCount;
+	}
+
+	// Translate from ctsConfig::g_configSettings->ShardAffinityPolicy to ctl::CpuAffinityPolicy
+	CpuAffinityPolicy GetCpuAffinityPolicy() noexcept
+	{
+		CpuAffinityPolicy affinityPolicy = CpuAffinityPolicy::PerCpu;
+		switch (g_configSettings->ShardAffinityPolicy)
+		{
+		case AffinityPolicy::PerCpu:
+			affinityPolicy = CpuAffinityPolicy::PerCpu;
+			break;
+		case AffinityPolicy::PerGroup:
+			affinityPolicy = CpuAffinityPolicy::PerGroup;
+			break;
+		case AffinityPolicy::RssAligned:
+			affinityPolicy = CpuAffinityPolicy::RssAligned;
+			break;
+		case AffinityPolicy::Manual:
+			affinityPolicy = CpuAffinityPolicy::Manual;
+			break;
+		default:
+			affinityPolicy = CpuAffinityPolicy::PerCpu;
+			break;
+		}
+		return affinityPolicy;
+	}
+
+	//
+	// Set*Options
+	// - functions capturing any options that need to be set on a socket across different states
+	// - currently only implementing pre-bind options
+	//
+	bool SetProcessDefaultCpuSets()
+	{
+		// default to CPU set zero
+		uint32_t settingsGroupId = 0;
+		if (g_configSettings->CpuGroupId.has_value())
+		{
+			settingsGroupId = g_configSettings->CpuGroupId.value();
+		}
+		PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: trying to find CPUs on Group %u\n", settingsGroupId);
+
+		using pfn_SetProcessDefaultCpuSets = BOOL(__stdcall*)(
+			HANDLE Process,
+			_In_reads_(CpuSetIdCount) const DWORD* CpuSetIds,
+			DWORD CpuSetIdCount);
+
+		using pfn_GetSystemCpuSetInformation = BOOL(__stdcall*)(
+			PSYSTEM_CPU_SET_INFORMATION Info,
+			ULONG Length,
+			PULONG ReturnLength,
+			PVOID SystemInformation,
+			ULONG SystemInformationLength);
+
+		// deliberately "leaking" this module handle - we want it loaded the lifetime of the process
+		auto* const hMod = LoadLibraryEx(L"kernel32.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
+		if (!hMod)
+		{
+			const auto gle = GetLastError();
+			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: LoadLibraryEx failed to load kernel32.dll: %lu\n", gle);
+			return false;
+		}
+
+		const auto pfnSetProcessDefaultCpuSets = reinterpret_cast<pfn_SetProcessDefaultCpuSets>(
+			GetProcAddress(hMod, "SetProcessDefaultCpuSets"));
+		const auto pfnGetSystemCpuSetInformation = reinterpret_cast<pfn_GetSystemCpuSetInformation>(
+			GetProcAddress(hMod, "GetSystemCpuSetInformation"));
+		if (!pfnSetProcessDefaultCpuSets || !pfnGetSystemCpuSetInformation)
+		{
+			const auto gle = GetLastError();
+			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: GetProcAddress failed to load CpuSet functions: %lu\n", gle);
+			return false;
+		}
+
+		ULONG returnedLength = 0;
+		pfnGetSystemCpuSetInformation(nullptr, 0, &returnedLength, nullptr, 0);
+		if (returnedLength == 0)
+		{
+			// the API should have given us the length - something failed
+			const auto gle = GetLastError();
+			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: GetSystemCpuSetInformation failed to get the length required: %lu\n", gle);
+			return false;
+		}
+
+		const std::unique_ptr<BYTE[]> buffer(new BYTE[returnedLength]);
+		if (!pfnGetSystemCpuSetInformation(reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.get()), returnedLength,
+			&returnedLength, nullptr, 0))
+		{
+			const auto gle = GetLastError();
+			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: GetSystemCpuSetInformation failed: %lu\n", gle);
+			return false;
+		}
+
+		std::vector<DWORD> cpuSetIdsOnCpuGroupZero;
+
+		PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: SYSTEM_CPU_SET_INFORMATION\n");
+		PRINT_DEBUG_INFO(
+			L"Id\t\tGroup\t\tLogicalProcessorIndex\t\tCoreIndex\tNumaNodeIndex\n");
+
+		void* current_buffer = buffer.get();
+		const void* end_of_buffer = buffer.get() + returnedLength;
+		while (current_buffer < end_of_buffer)
+		{
+			const SYSTEM_CPU_SET_INFORMATION* cpu_set_info = static_cast<PSYSTEM_CPU_SET_INFORMATION>(current_buffer);
+			PRINT_DEBUG_INFO(
+				L"Id: %lu\t\t"
+				L"Group: %d\t"
+				L"LogicalProcessorIndex: %d\t"
+				L"CoreIndex:%d\t"
+				L"NumaNodeIndex: %d\n",
+				cpu_set_info->CpuSet.Id,
+				cpu_set_info->CpuSet.Group,
+				cpu_set_info->CpuSet.LogicalProcessorIndex,
+				cpu_set_info->CpuSet.CoreIndex,
+				cpu_set_info->CpuSet.NumaNodeIndex);
+
+			if (cpu_set_info->CpuSet.Group == settingsGroupId)
+			{
+				cpuSetIdsOnCpuGroupZero.push_back(cpu_set_info->CpuSet.Id);
+			}
+
+			current_buffer = static_cast<BYTE*>(current_buffer) + cpu_set_info->Size;
+		}
+
+		if (cpuSetIdsOnCpuGroupZero.empty())
+		{
+			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: No CPU IDs found on Group %u\n", settingsGroupId);
+			return false;
+		}
+
+		if (!pfnSetProcessDefaultCpuSets(
+			GetCurrentProcess(),
+			cpuSetIdsOnCpuGroupZero.data(),
+			static_cast<DWORD>(cpuSetIdsOnCpuGroupZero.size())))
+		{
+			const auto gle = GetLastError();
+			PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: SetProcessDefaultCpuSets failed: %lu\n", gle);
+			return false;
+		}
+
+		PRINT_DEBUG_INFO(L"\t\tSetProcessDefaultCpuSets: SetProcessDefaultCpuSets set process affinity to all CPU IDs in Group %u\n", settingsGroupId);
+		return true;
+	}
+
+	//
+	// Set*Options
+	// - functions capturing any options that need to be set on a socket across different states
+	// - currently only implementing pre-bind options
+	//
+	int SetPreBindOptions(SOCKET socket, const wil::network::socket_address& localAddress) noexcept
+	{
+		ctsConfigInitOnce();
+
+		if (g_configSettings->OutgoingIfIndex > 0)
+		{
+			constexpr int optLength{ sizeof(g_configSettings->OutgoingIfIndex) };
+
+			if (localAddress.family() == AF_INET)
+			{
+				// Interface index is in network byte order for IPPROTO_IP.
+				const DWORD optionValue = htonl(g_configSettings->OutgoingIfIndex);
+				if (setsockopt(
+					socket,
+					IPPROTO_IP, // level
+					IP_UNICAST_IF,
+					reinterpret_cast<const char*>(&optionValue),
+					optLength) != 0)
+				{
+					const auto gle = WSAGetLastError();
+					PrintErrorIfFailed("setsockopt(IP_UNICAST_IF)", gle);
+					return gle;
+				}
+			}
+			else
+			{
+				// Interface index is in host byte order for IPPROTO_IPV6.
+				if (setsockopt(
+					socket,
+					IPPROTO_IPV6, // level
+					IPV6_UNICAST_IF,
+					reinterpret_cast<const char*>(&g_configSettings->OutgoingIfIndex),
+					optLength) != 0)
+				{
+					const auto gle = WSAGetLastError();
+					PrintErrorIfFailed("setsockopt(IPV6_UNICAST_IF)", gle);
+					return gle;
+				}
+			}
+		}
+
+		//
+		// if the user specified bind addresses, enable SO_PORT_SCALABILITY
+		// - this will allow each unique IP address the full range of ephemeral ports
+		// this option is not available when just binding to INET_ANY (making an ephemeral bind)
+		// this option is also not used if the user is binding to an explicit port #
+		// - since the port scalability rules no longer apply
+		//
+		// these only are applicable for outgoing connections
+		//
+		if (ProtocolType::TCP == g_configSettings->Protocol && !IsListening())
+		{
+			if (g_configSettings->Options & ReuseUnicastPort)
+			{
+				// the admin configured the system to use this socket option
+				// it is not compatible with SO_PORT_SCALABILITY
+				constexpr DWORD optValue{ 1 }; // BOOL
+				constexpr int optLength{ sizeof(optValue) };
+#ifndef SO_REUSE_UNICASTPORT
+#define SO_REUSE_UNICASTPORT (SO_PORT_SCALABILITY + 1)
+#endif
+				if (setsockopt(
+					socket,
+					SOL_SOCKET, // level
+					SO_REUSE_UNICASTPORT,
+					reinterpret_cast<const char*>(&optValue),
+					optLength) != 0)
+				{
+					const auto gle = WSAGetLastError();
+					PrintErrorIfFailed("setsockopt(SO_REUSE_UNICASTPORT)", gle);
+					return gle;
+				}
+			}
+			else if (localAddress.address_type() != NlatUnspecified && localAddress.port() == 0)
+			{
+				constexpr DWORD optValue{ 1 }; // BOOL
+				constexpr int optLength{ sizeof(optValue) };
+
+				if (setsockopt(
+					socket,
+					SOL_SOCKET, // level
+					SO_PORT_SCALABILITY,
+					reinterpret_cast<const char*>(&optValue),
+					optLength) != 0)
+				{
+					const auto gle = WSAGetLastError();
+					PrintErrorIfFailed("setsockopt(SO_PORT_SCALABILITY)", gle);
+					return gle;
+				}
+			}
+		}
+
+		if (g_configSettings->Options & LoopbackFastPath)
+		{
+			DWORD inValue{ 1 };
+			DWORD bytesReturned{};
+
+			if (WSAIoctl(
+				socket,
+				SIO_LOOPBACK_FAST_PATH,
+				&inValue, sizeof(inValue),
+				nullptr, 0,
+				&bytesReturned,
+				nullptr,
+				nullptr) != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("WSAIoctl(SIO_LOOPBACK_FAST_PATH)", gle);
+				return gle;
+			}
+		}
+
+		if (g_configSettings->KeepAliveValue > 0)
+		{
+			tcp_keepalive keepaliveValues{};
+			keepaliveValues.onoff = 1;
+			keepaliveValues.keepalivetime = g_configSettings->KeepAliveValue;
+			keepaliveValues.keepaliveinterval = 1000; // continue to default to 1 second
+
+			DWORD bytesReturned{};
+			if (WSAIoctl(
+				socket,
+				SIO_KEEPALIVE_VALS, // control code
+				&keepaliveValues, sizeof(keepaliveValues), // in params
+				nullptr, 0, // out params
+				&bytesReturned,
+				nullptr,
+				nullptr) != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("WSAIoctl(SIO_KEEPALIVE_VALS)", gle);
+				return gle;
+			}
+		}
+		else if (g_configSettings->Options & KeepAlive)
+		{
+			constexpr DWORD optValue{ 1 };
+			constexpr int optLength{ sizeof(optValue) };
+
+			if (setsockopt(
+				socket,
+				SOL_SOCKET, // level
+				SO_KEEPALIVE,
+				reinterpret_cast<const char*>(&optValue),
+				optLength) != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("setsockopt(SO_KEEPALIVE)", gle);
+				return gle;
+			}
+		}
+
+		if (g_configSettings->Options & SetRecvBuf)
+		{
+			const auto recvBuff = g_configSettings->RecvBufValue;
+			if (setsockopt(
+				socket,
+				SOL_SOCKET,
+				SO_RCVBUF,
+				reinterpret_cast<const char*>(&recvBuff),
+				sizeof(recvBuff)) != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("setsockopt(SO_RCVBUF)", gle);
+				return gle;
+			}
+		}
+
+		if (g_configSettings->Options & SetSendBuf)
+		{
+			const auto sendBuff = g_configSettings->SendBufValue;
+			if (setsockopt(
+				socket,
+				SOL_SOCKET,
+				SO_SNDBUF,
+				reinterpret_cast<const char*>(&sendBuff),
+				sizeof(sendBuff)) != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("setsockopt(SO_SNDBUF)", gle);
+				return gle;
+			}
+		}
+
+		if (g_configSettings->Options & NonBlockingIo)
+		{
+			u_long enableNonBlocking = 1;
+			if (ioctlsocket(socket, FIONBIO, &enableNonBlocking) != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("ioctlsocket(FIONBIO)", gle);
+				return gle;
+			}
+		}
+
+		if (g_configSettings->Options & EnableCircularQueueing)
+		{
+			DWORD bytesReturned{};
+			const auto error = WSAIoctl(
+				socket,
+				SIO_ENABLE_CIRCULAR_QUEUEING,
+				nullptr, 0, // in buffer
+				nullptr, 0, // out buffer
+				&bytesReturned,
+				nullptr,
+				nullptr);
+			if (error != 0)
+			{
+				const auto gle = WSAGetLastError();
+				PrintErrorIfFailed("WSAIoctl(SIO_ENABLE_CIRCULAR_QUEUEING)", gle);
+				return gle;
+			}
+		}
+
+		if (g_configSettings->Options & HandleInlineIocp)
+		{
+
+			if (!SetFileCompletionNotificationModes(
+				reinterpret_cast<HANDLE>(socket), // NOLINT(performance-no-int-to-ptr)
+				FILE_SKIP_COMPLETION_PORT_ON_SUCCESS))
+			{
+				const auto gle = GetLastError();
+				PrintErrorIfFailed("SetFileCompletionNotificationModes(FILE_SKIP_COMPLETION_PORT_ON_SUCCESS)", gle);
+				return static_cast<int>(gle);
+			}
+		}
+
+		return NO_ERROR;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	///
+	/// SetPostConnectOptions
+	/// - functions capturing any options that need to be set once connected
+	///
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	int SetPostConnectOptions(SOCKET socket, const wil::network::socket_address& remoteAddress) noexcept
+	{
+		ctsConfigInitOnce();
+
+		if (g_qosHandle)
+		{
+			// attempt to assign the DSCP value to this socket
+			auto destinationAddress{ remoteAddress };
+
+			QOS_FLOWID flowID{ 0 };
+			if (!QOSAddSocketToFlow(
+				g_qosHandle,
+				socket,
+				destinationAddress.sockaddr(),
+				QOSTrafficTypeBestEffort,
+				0,
+				&flowID))
+			{
+				const auto gle = GetLastError();
+				PrintErrorIfFailed("QOSAddSocketToFlow(QOSTrafficTypeBestEffort)", gle);
+			}
+			else
+			{
+				if (!QOSSetFlow(
+					g_qosHandle,
+					flowID,
+					QOSSetOutgoingDSCPValue,
+					sizeof(DWORD),
+					&g_qosDscpValue,
+					0,
+					nullptr))
+				{
+					const auto gle = GetLastError();
+					PrintErrorIfFailed("QOSSetFlow(QOSSetOutgoingDSCPValue)", gle);
+				}
+			}
+		}
+
+		return NO_ERROR;
+	}
+
+	//
+	// PrintSettings
+	// - public function to write out to the console applied settings
+	//
+	void PrintSettings()
+	{
+		ctsConfigInitOnce();
+
+		wstring settingString(
+			L"  Configured Settings  \n"
+			L"-----------------------\n");
+
+		settingString.append(L"\tProtocol: ");
+		switch (g_configSettings->Protocol)
+		{
+		case ProtocolType::TCP:
+			settingString.append(L"TCP");
+			break;
+		case ProtocolType::UDP:
+			settingString.append(L"UDP");
+			break;
+
+		case ProtocolType::NoProtocolSet:
+			[[fallthrough]];
+		default:
+			FAIL_FAST_MSG("Unexpected Settings Protocol");
+		}
+		settingString.append(L"\n");
+
+		settingString.append(L"\tOptions:");
+		if (NoOptionSet == g_configSettings->Options)
+		{
+			settingString.append(L" None");
+		}
+		else
+		{
+			if (g_configSettings->Options & LoopbackFastPath)
+			{
+				settingString.append(L" TCPFastPath");
+			}
+			if (g_configSettings->KeepAliveValue > 0)
+			{
+				settingString.append(L" KeepAlive (");
+				settingString.append(std::to_wstring(g_configSettings->KeepAliveValue));
+				settingString.append(L")");
+			}
+			else if (g_configSettings->Options & KeepAlive)
+			{
+				settingString.append(L" KeepAlive");
+			}
+			if (g_configSettings->Options & NonBlockingIo)
+			{
+				settingString.append(L" NonBlockingIO");
+			}
+			if (g_configSettings->Options & HandleInlineIocp)
+			{
+				settingString.append(L" InlineIOCP");
+			}
+			if (g_configSettings->Options & ReuseUnicastPort)
+			{
+				settingString.append(L" ReuseUnicastPort");
+			}
+			if (g_configSettings->Options & PortScalability)
+			{
+				settingString.append(L" PortScalability");
+			}
+			if (g_configSettings->Options & SetRecvBuf)
+			{
+				settingString.append(wil::str_printf<std::wstring>(L" SO_RCVBUF(%lu)", g_configSettings->RecvBufValue));
+			}
+			if (g_configSettings->Options & SetSendBuf)
+			{
+				settingString.append(wil::str_printf<std::wstring>(L" SO_SNDBUF(%lu)", g_configSettings->SendBufValue));
+			}
+			if (g_configSettings->Options & ZeroCopySend)
+			{
+				settingString.append(L" ZeroCopySend");
+			}
+			if (g_configSettings->Options & ZeroCopyRecv)
+			{
+				settingString.append(L" ZeroCopyRecv");
+			}
+			if (g_configSettings->Options & MsgWaitAll)
+			{
+				settingString.append(L" MsgWaitAll");
+			}
+		}
+		settingString.append(L"\n");
+
+		settingString.append(wil::str_printf<std::wstring>(L"\tIO function: %ws\n", g_ioFunctionName));
+		if (g_configSettings->SubmitBatchSize > 0)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\t\tSubmitBatchSize: %u\n"
+					L"\t\tSubmitBatchLatency: %u usec\n",
+					g_configSettings->SubmitBatchSize,
+					g_configSettings->SubmitBatchLatencyUsec));
+		}
+		if (g_configSettings->BusyPollUsec > 0)
+		{
+			settingString.append(wil::str_printf<std::wstring>(L"\t\tBusyPoll: %u usec\n", g_configSettings->BusyPollUsec));
+		}
+		if (IoFunctionType::Tls == g_ioFunctionType)
+		{
+			settingString.append(
+				g_configSettings->TlsRecordSize > 0
+					? wil::str_printf<std::wstring>(L"\t\tTlsRecordSize: %u\n", g_configSettings->TlsRecordSize)
+					: std::wstring(L"\t\tTlsRecordSize: <default>\n"));
+			if (IsListening())
+			{
+				settingString.append(
+					g_configSettings->TlsCertificateThumbprint.empty()
+						? std::wstring(L"\t\tTlsCertificate: <self-signed>\n")
+						: wil::str_printf<std::wstring>(L"\t\tTlsCertificate: %ws\n", g_configSettings->TlsCertificateThumbprint.c_str()));
+			}
+		}
+		if (IoFunctionType::Quic == g_ioFunctionType)
+		{
+			if (IsListening())
+			{
+				settingString.append(
+					g_configSettings->TlsCertificateThumbprint.empty()
+						? std::wstring(L"\t\tTlsCertificate: <self-signed>\n")
+						: wil::str_printf<std::wstring>(L"\t\tTlsCertificate: %ws\n", g_configSettings->TlsCertificateThumbprint.c_str()));
+			}
+			else
+			{
+				settingString.append(wil::str_printf<std::wstring>(L"\t\tQuicStreams: %u\n", g_configSettings->QuicStreams));
+			}
+		}
+		if (!g_configSettings->SendFilePath.empty())
+		{
+			settingString.append(wil::str_printf<std::wstring>(
+				L"\t\tSendFile: %ws (%ws, %ws cache)\n",
+				g_configSettings->SendFilePath.c_str(),
+				g_configSettings->SendFileSize > 0 ? L"generated" : L"existing",
+				g_configSettings->SendFileCold ? L"cold" : L"warm"));
+		}
+		if (!g_configSettings->RecvFilePath.empty())
+		{
+			settingString.append(wil::str_printf<std::wstring>(
+				L"\t\tRecvFile: %ws (%ws)\n",
+				g_configSettings->RecvFilePath.c_str(),
+				g_configSettings->RecvFileUnbuffered ? L"unbuffered" : L"buffered"));
+		}
+		if (g_configSettings->SocketPoolHigh > 0)
+		{
+			settingString.append(wil::str_printf<std::wstring>(
+				L"\t\tSocketPool: %u (refilled below %u, %ws)\n",
+				g_configSettings->SocketPoolHigh,
+				g_configSettings->SocketPoolLow,
+				g_configSettings->SocketPoolBind ? L"pre-bound" : L"bound when taken"));
+		}
+
+		settingString.append(L"\tIoPattern: ");
+		switch (g_configSettings->IoPattern)
+		{
+		case IoPatternType::Pull:
+			settingString.append(L"Pull <TCP client recv/server send>\n");
+			break;
+		case IoPatternType::Push:
+			settingString.append(L"Push <TCP client send/server recv>\n");
+			break;
+		case IoPatternType::PushPull:
+			settingString.append(L"PushPull <TCP client/server alternate send/recv>\n");
+			settingString.append(wil::str_printf<std::wstring>(L"\t\tPushBytes: %lu\n", g_configSettings->PushBytes));
+			settingString.append(wil::str_printf<std::wstring>(L"\t\tPullBytes: %lu\n", g_configSettings->PullBytes));
+			break;
+		case IoPatternType::Duplex:
+			settingString.append(L"Duplex <TCP client/server both sending and receiving>\n");
+			break;
+		case IoPatternType::MediaStream:
+			settingString.append(L"MediaStream <UDP controlled stream from server to client>\n");
+			break;
+		case IoPatternType::IdleHold:
+			settingString.append(L"IdleHold <TCP client keepalive echoed by the server>\n");
+			settingString.append(wil::str_printf<std::wstring>(L"\t\tKeepAlive Interval: %lu ms\n", g_configSettings->IdleKeepAliveIntervalMs));
+			settingString.append(wil::str_printf<std::wstring>(L"\t\tKeepAlive Bytes: %lu\n", g_configSettings->IdleKeepAliveBytes));
+			if (g_configSettings->IdleHoldTimeMs > 0)
+			{
+				settingString.append(wil::str_printf<std::wstring>(L"\t\tHold Time: %lu ms\n", g_configSettings->IdleHoldTimeMs));
+			}
+			else
+			{
+				settingString.append(L"\t\tHold Time: until the run ends\n");
+			}
+			break;
+
+		case IoPatternType::NoIoSet:
+			[[fallthrough]];
+		default:
+			FAIL_FAST_MSG("Unexpected Settings IoPattern");
+		}
+
+		settingString.append(wil::str_printf<std::wstring>(L"\tPrePostRecvs: %u\n", g_configSettings->PrePostRecvs));
+
+		if (g_configSettings->PrePostSends > 0)
+		{
+			settingString.
+				append(wil::str_printf<std::wstring>(L"\tPrePostSends: %u\n", g_configSettings->PrePostSends));
+		}
+		else
+		{
+			settingString.append(wil::str_printf<std::wstring>(L"\tPrePostSends: Following Ideal Send Backlog\n"));
+		}
+
+		settingString.append(
+			wil::str_printf<std::wstring>(
+				L"\tLevel of verification: %ws\n",
+				g_configSettings->ShouldVerifyBuffers ? L"Connections & Data" : L"Connections"));
+
+		settingString.append(wil::str_printf<std::wstring>(L"\tPort: %u\n", g_configSettings->Port));
+
+		if (0 == g_bufferSizeHigh)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tBuffer used for each IO request: %u [0x%lx] bytes\n",
+					g_bufferSizeLow, g_bufferSizeLow));
+		}
+		else
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tBuffer used for each IO request: [%u, %u] bytes\n",
+					g_bufferSizeLow, g_bufferSizeHigh));
+		}
+
+		if (0 == g_transferSizeHigh)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tTotal transfer per connection: %llu bytes\n",
+					g_transferSizeLow));
+		}
+		else
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tTotal transfer per connection: [%llu, %llu] bytes\n",
+					g_transferSizeLow, g_transferSizeHigh));
+		}
+		if (g_configSettings->TransfersPerConnection > 1)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tTransfers per connection: %u (the transfer size is of each transfer), %u ms between transfers\n",
+					g_configSettings->TransfersPerConnection, g_configSettings->TransferGapMs));
+		}
+
+		if (ProtocolType::UDP == g_configSettings->Protocol)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\t\tUDP Stream BitsPerSecond: %lld bits per second\n",
+					g_mediaStreamSettings.BitsPerSecond));
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\t\tUDP Stream FrameRate: %lu frames per second\n",
+					g_mediaStreamSettings.FramesPerSecond));
+
+			if (g_mediaStreamSettings.BufferDepthSeconds > 0)
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\t\tUDP Stream BufferDepth: %lu seconds\n",
+						g_mediaStreamSettings.BufferDepthSeconds));
+			}
+
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\t\tUDP Stream StreamLength: %lu seconds (%lu frames)\n",
+					g_mediaStreamSettings.StreamLengthSeconds,
+					g_mediaStreamSettings.StreamLengthFrames));
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\t\tUDP Stream FrameSize: %lu bytes\n",
+					g_mediaStreamSettings.FrameSizeBytes));
+			if (g_mediaStreamSettings.UdpOffload)
+			{
+				settingString.append(L"\t\tUDP Stream Offload: on\n");
+			}
+			if (g_mediaStreamSettings.DatagramBatchSize > 1)
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\t\tUDP Stream DatagramBatchSize: %u\n",
+						g_mediaStreamSettings.DatagramBatchSize));
+			}
+		}
+
+		if (ProtocolType::TCP == g_configSettings->Protocol && g_rateLimitLow > 0)
+		{
+			if (0 == g_rateLimitHigh)
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tSending throughput rate limited down to %lld bytes/second\n",
+						g_rateLimitLow));
+			}
+			else
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tSending throughput rate limited down to a range of [%lld, %lld] bytes/second\n",
+						g_rateLimitLow, g_rateLimitHigh));
+			}
+		}
+
+		if (g_netAdapterAddresses != nullptr)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tIP Compartment: %u\n", g_compartmentId));
+		}
+
+		if (g_qosHandle)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tSetting QOS DSCP Value: %u\n", g_qosDscpValue));
+		}
+
+		if (!g_configSettings->ListenAddresses.empty())
+		{
+			settingString.append(L"\tAccepting connections on addresses:\n");
+			wil::network::socket_address_wstring address{};
+			for (const auto& addr : g_configSettings->ListenAddresses)
+			{
+				if (SUCCEEDED(addr.format_complete_address_nothrow(address)))
+				{
+					settingString.append(L"\t\t");
+					settingString.append(address);
+					settingString.append(L"\n");
+				}
+			}
+			if (wstring(g_acceptFunctionName) == L"AcceptEx")
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tAcceptEx requests pended per listener: [%u, %u]\n",
+						g_configSettings->AcceptDepthLow,
+						g_configSettings->AcceptDepthHigh));
+				if (g_configSettings->AcceptShards > 0)
+				{
+					settingString.append(
+						wil::str_printf<std::wstring>(
+							L"\tAcceptEx shards per listener: %u\n",
+							g_configSettings->AcceptShards));
+				}
+			}
+		}
+		else
+		{
+			if (g_configSettings->OutgoingIfIndex > 0)
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tInterfaceIndex: %u\n", g_configSettings->OutgoingIfIndex));
+			}
+
+			settingString.append(L"\tConnecting out to addresses:\n");
+			wil::network::socket_address_wstring address{};
+			for (const auto& addr : g_configSettings->TargetAddresses)
+			{
+				if (SUCCEEDED(addr.format_complete_address_nothrow(address)))
+				{
+					settingString.append(L"\t\t");
+					settingString.append(address);
+					settingString.append(L"\n");
+				}
+			}
+
+			settingString.append(L"\tBinding to local addresses for outgoing connections:\n");
+			for (const auto& addr : g_configSettings->BindAddresses)
+			{
+				if (SUCCEEDED(addr.format_complete_address_nothrow(address)))
+				{
+					settingString.append(L"\t\t");
+					settingString.append(address);
+					settingString.append(L"\n");
+				}
+			}
+
+			if (g_configSettings->LocalPortLow != 0)
+			{
+				if (0 == g_configSettings->LocalPortHigh)
+				{
+					settingString.append(
+						wil::str_printf<std::wstring>(
+							L"\tUsing local port for outgoing connections: %u\n",
+							g_configSettings->LocalPortLow));
+				}
+				else
+				{
+					settingString.append(
+						wil::str_printf<std::wstring>(
+							L"\tUsing local port for outgoing connections: [%u, %u]\n",
+							g_configSettings->LocalPortLow, g_configSettings->LocalPortHigh));
+				}
+			}
+
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tConnection limit (maximum established connections): %u [0x%lx]\n",
+					g_configSettings->ConnectionLimit,
+					g_configSettings->ConnectionLimit));
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tConnection throttling rate (maximum pended connection attempts): %u [0x%lx]\n",
+					g_configSettings->ConnectionThrottleLimit,
+					g_configSettings->ConnectionThrottleLimit));
+			if (g_configSettings->ConnectionRate > 0)
+			{
+				const wchar_t* arrivalName = L"constant";
+				if (ConnectionArrivalType::Poisson == g_configSettings->ConnectionArrival)
+				{
+					arrivalName = L"poisson";
+				}
+				else if (ConnectionArrivalType::Ramp == g_configSettings->ConnectionArrival)
+				{
+					arrivalName = L"ramp";
+				}
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tConnection rate (connections started per second): %u, arrival: %ws",
+						g_configSettings->ConnectionRate,
+						arrivalName));
+				if (ConnectionArrivalType::Ramp == g_configSettings->ConnectionArrival)
+				{
+					settingString.append(
+						wil::str_printf<std::wstring>(L" over %u ms", g_configSettings->ConnectionRampTimeMs));
+				}
+				settingString.append(L"\n");
+			}
+			if (wstring(g_connectFunctionName) == L"HappyEyeballs (racing ConnectEx)")
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tRacing connection attempts across target addresses (HappyEyeballs), %u ms between attempts\n",
+						g_configSettings->ConnectAttemptDelayMs));
+			}
+
+			for (const auto& trafficClass : g_configSettings->TrafficClasses)
+			{
+				const wchar_t* patternName = L"Duplex";
+				switch (trafficClass.IoPattern)
+				{
+				case IoPatternType::Pull:
+					patternName = L"Pull";
+					break;
+				case IoPatternType::Push:
+					patternName = L"Push";
+					break;
+				case IoPatternType::PushPull:
+					patternName = L"PushPull";
+					break;
+				default:
+					break;
+				}
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tTraffic class '%ws': IoPattern %ws, Connections %u, Buffer %u-%u, Transfer %llu-%llu, RateLimit %lld-%lld, Targets %zu\n",
+						trafficClass.Name.c_str(),
+						patternName,
+						trafficClass.ConnectionLimit,
+						trafficClass.BufferSizeLow,
+						trafficClass.BufferSizeHigh,
+						trafficClass.TransferSizeLow,
+						trafficClass.TransferSizeHigh,
+						trafficClass.RateLimitLow,
+						trafficClass.RateLimitHigh,
+						trafficClass.TargetAddresses.size()));
+			}
+		}
+		// calculate total connections
+		if (g_configSettings->AcceptFunction)
+		{
+			if (g_configSettings->ServerExitLimit > MAXLONG)
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tServer-accepted connections before exit : 0x%llx\n",
+						g_configSettings->ServerExitLimit));
+			}
+			else
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tServer-accepted connections before exit : %llu [0x%llx]\n",
+						g_configSettings->ServerExitLimit,
+						g_configSettings->ServerExitLimit));
+			}
+		}
+		else
+		{
+			uint64_t totalConnections{};
+			if (g_configSettings->Iterations == MAXULONGLONG)
+			{
+				totalConnections = MAXULONGLONG;
+			}
+			else
+			{
+				totalConnections = g_configSettings->Iterations * g_configSettings->ConnectionLimit;
+			}
+			if (totalConnections > MAXLONG)
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tTotal outgoing connections before exit (iterations * concurrent connections) : 0x%llx\n",
+						totalConnections));
+			}
+			else
+			{
+				settingString.append(
+					wil::str_printf<std::wstring>(
+						L"\tTotal outgoing connections before exit (iterations * concurrent connections) : %llu [0x%llx]\n",
+						totalConnections,
+						totalConnections));
+			}
+		}
+
+		if (g_configSettings->CpuGroupId)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tAffinitized to all CPU IDs on CPU Group %lu\n",
+					g_configSettings->CpuGroupId.value()));
+		}
+
+		if (g_configSettings->EnableRecvSharding)
+		{
+			settingString.append(
+				wil::str_printf<std::wstring>(
+					L"\tReceive sharding is enabled (will affinitize receives to RSS)\n"
+					L"\t\tShardCount: %u\n"
+					L"\t\tShardWorkerCount: %u\n"
+					L"\t\tShardAffinityPolicy: %u\n"
+					L"\t\tIocpBatchSize: %u\n",
+					g_configSettings->ShardCount,
+					g_configSettings->ShardWorkerCount,
+					static_cast<uint32_t>(g_configSettings->ShardAffinityPolicy),
+					g_configSettings->IocpBatchSize));
+		}
+
+		settingString.append(L"\n");
+
+		// immediately print the legend once we know the status info object
+		switch (g_consoleVerbosity)
+		{
+			// case 0: // nothing
+		case 1: // status updates
+		case 2: // error info + status updates
+		case 3: // connection info
+		case 4: // connection info + error info
+		case 5: // connection info + error info + status updates
+		case 6: // above + debug info
+		default:
+		{
+			(void)fwprintf_s(stdout, L"%ws", settingString.c_str());
+		}
+		}
+
+		// must manually convert all carriage returns to file-friendly carriage return/line feed
+		if (g_connectionLogger && !g_connectionLogger->IsCsvFormat())
+		{
+			g_connectionLogger->LogMessage(
+				ctString::replace_all_copy(settingString, L"\n", L"\r\n").c_str());
+		}
+	}
+
+	SOCKET CreateSocket(int af, int type, int protocol, DWORD dwFlags)
+	{
+		auto oldCompartmentId = NET_IF_COMPARTMENT_ID_UNSPECIFIED;
+		auto bCompartmentIdSet = false;
+
+		//
+		// g_netAdapterAddresses is created when the user has requested a CompartmentId
+		// - since we would have had to look up the interface
+		//
+		if (g_netAdapterAddresses != nullptr)
+		{
+			oldCompartmentId = GetCurrentThreadCompartmentId();
+			if (oldCompartmentId != g_compartmentId)
+			{
+				const auto error = SetCurrentThreadCompartmentId(g_compartmentId);
+				if (error != NO_ERROR)
+				{
+					PrintErrorInfo(wil::str_printf<std::wstring>(
+						L"SetCurrentThreadCompartmentId for ID %u failed err %u", g_compartmentId, error).c_str());
+				}
+				else
+				{
+					bCompartmentIdSet = true;
+				}
+			}
+		}
+
+		const auto socket = ::WSASocket(af, type, protocol, nullptr, 0, dwFlags);
+		const auto wsaError = WSAGetLastError();
+
+		if (bCompartmentIdSet)
+		{
+			const auto error = SetCurrentThreadCompartmentId(oldCompartmentId);
+			if (error != NO_ERROR)
+			{
+				PrintErrorInfo(wil::str_printf<std::wstring>(
+					L"SetCurrentThreadCompartmentId for ID %u failed err %u",
+					oldCompartmentId, error).c_str());
+			}
+		}
+
+		if (INVALID_SOCKET == socket)
+		{
+			THROW_WIN32_MSG(wsaError, "WSASocket");
+		}
+
+		return socket;
+	}
+
+	bool ShutdownCalled() noexcept
+	{
+		return g_processStatus != ExitProcessType::Running;
+	}
+
+	uint32_t ConsoleVerbosity() noexcept
+	{
+		return g_consoleVerbosity;
+	}
+} // namespace ctsTraffic
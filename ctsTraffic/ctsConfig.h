@@ -83,7 +83,15 @@ namespace ctsTraffic
             Pull,
             PushPull,
             Duplex,
-            MediaStream
+            MediaStream,
+            IdleHold
+        };
+
+        enum class ConnectionArrivalType : std::uint8_t
+        {
+            Constant,
+            Poisson,
+            Ramp
         };
 
         enum class AffinityPolicy : std::uint8_t
@@ -115,8 +123,10 @@ namespace ctsTraffic
             SetSendBuf = 0x0040,
             EnableCircularQueueing = 0x0080,
             MsgWaitAll = 0x0100,
-            PortScalability = 0x0200
-            // next enum  = 0x0400
+            PortScalability = 0x0200,
+            ZeroCopySend = 0x0400,
+            ZeroCopyRecv = 0x0800
+            // next enum  = 0x1000
         };
 
         //
@@ -238,7 +248,8 @@ namespace ctsTraffic
             const wil::network::socket_address& localAddr,
             const wil::network::socket_address& remoteAddr,
             uint32_t error,
-            const ctsTcpStatistics& stats) noexcept;
+            const ctsTcpStatistics& stats,
+            uint32_t trafficClass) noexcept;
         void PrintConnectionResults(
             const wil::network::socket_address& localAddr,
             const wil::network::socket_address& remoteAddr,
@@ -276,6 +287,11 @@ namespace ctsTraffic
 
         TcpShutdownType GetShutdownType() noexcept;
 
+        // returns the private (committed) bytes of this process - 0 if it could not be queried
+        int64_t GetProcessPrivateBytes() noexcept;
+        // returns the CPU cycles consumed by all threads of this process - 0 if it could not be queried
+        uint64_t GetProcessCycleTime() noexcept;
+
         // Set* functions
         int32_t SetPreBindOptions(SOCKET socket, const wil::network::socket_address& localAddress) noexcept;
         int32_t SetPostConnectOptions(SOCKET socket, const wil::network::socket_address& remoteAddress) noexcept;
@@ -289,6 +305,10 @@ namespace ctsTraffic
             uint32_t BufferDepthSeconds = 0;
             uint32_t StreamLengthSeconds = 0;
             uint32_t DatagramMaxSize = 0;
+            // -UdpOffload: segmented sends (USO) on the server, coalesced receives (URO) on the client
+            bool UdpOffload = false;
+            // -DatagramBatchSize: the number of receives kept posted together on each datagram socket
+            uint32_t DatagramBatchSize = 1;
             // internally calculated
             uint32_t FrameSizeBytes = 0;
             uint32_t StreamLengthFrames = 0;
@@ -367,6 +387,77 @@ namespace ctsTraffic
 
         const MediaStreamSettings& GetMediaStream() noexcept;
 
+        //
+        // Traffic classes allow a single client to run a mix of connections with independent settings
+        // - e.g. bulk transfers competing with latency-sensitive request/response connections
+        // - each class tracks its own statistics alongside the aggregate statistics in ctsConfigSettings
+        // - a zero value for any size or rate falls back to the corresponding global setting
+        //
+        constexpr uint32_t c_defaultTrafficClass = 0;
+        constexpr uint32_t c_maxTrafficClasses = 8;
+
+        struct ctsTrafficClass
+        {
+            // dynamically initialize status details with current qpc
+            ctsTrafficClass() noexcept :
+                ConnectionStatusDetails(ctl::ctTimer::snap_qpc_as_msec())
+            {
+            }
+
+            ~ctsTrafficClass() noexcept = default;
+            // movable only to be stored in a vector
+            ctsTrafficClass(const ctsTrafficClass&) = delete;
+            ctsTrafficClass& operator=(const ctsTrafficClass&) = delete;
+            ctsTrafficClass(ctsTrafficClass&&) noexcept = default;
+            ctsTrafficClass& operator=(ctsTrafficClass&&) = delete;
+
+            // the server runs a single -Pattern and -Transfer: a class which runs a different one needs its own Target
+            // - returns the reason the class can't run against the server, or nullptr if it can
+            [[nodiscard]] const char* CheckServerSettings(IoPatternType serverPattern, uint64_t serverTransferLow, uint64_t serverTransferHigh) const noexcept
+            {
+                if (!TargetAddresses.empty())
+                {
+                    return nullptr;
+                }
+                if (IoPattern != IoPatternType::NoIoSet && IoPattern != serverPattern)
+                {
+                    return "-TrafficClass Pattern must match -Pattern unless the class specifies its own Target";
+                }
+                if (TransferSizeLow != 0 && (TransferSizeLow != serverTransferLow || TransferSizeHigh != serverTransferHigh))
+                {
+                    return "-TrafficClass Transfer must match -Transfer unless the class specifies its own Target";
+                }
+                return nullptr;
+            }
+
+            std::wstring Name;
+            IoPatternType IoPattern = IoPatternType::NoIoSet;
+
+            uint32_t BufferSizeLow = 0;
+            uint32_t BufferSizeHigh = 0;
+            uint64_t TransferSizeLow = 0;
+            uint64_t TransferSizeHigh = 0;
+            int64_t RateLimitLow = 0;
+            int64_t RateLimitHigh = 0;
+            uint32_t ConnectionLimit = 0;
+
+            // optional: overrides the global target addresses for connections in this class
+            std::vector<wil::network::socket_address> TargetAddresses{};
+
+            // stats for status updates and summaries
+            ctsConnectionStatistics ConnectionStatusDetails;
+            ctsTcpStatistics TcpStatusDetails;
+            // latency is tracked as the time taken by each successfully completed connection
+            ctsStatsTracking CompletedConnectionTimeMs;
+            ctsStatsTracking CompletedConnectionCount;
+        };
+
+        // Get* functions for settings which can be specified per traffic class
+        // - returns the global setting when the traffic class did not override it
+        int64_t GetTcpBytesPerSecond(uint32_t trafficClass) noexcept;
+        uint32_t GetBufferSize(uint32_t trafficClass) noexcept;
+        uint64_t GetTransferSize(uint32_t trafficClass) noexcept;
+
         struct ctsConfigSettings
         {
             // dynamically initialize status details with current qpc
@@ -403,14 +494,30 @@ namespace ctsTraffic
             uint64_t Iterations = 0;
             uint64_t ServerExitLimit = 0;
             uint32_t AcceptLimit = 0;
+            // -AcceptDepth: the bounds of the AcceptEx requests kept pended per listener
+            uint32_t AcceptDepthLow = 0;
+            uint32_t AcceptDepthHigh = 0;
+            // -AcceptShards: the AcceptEx requests of each listener are split across this many shards,
+            // with as many IOCP workers sharing the listener's completion port (0 == not sharded)
+            uint32_t AcceptShards = 0;
             uint32_t ConnectionLimit = 0;
             uint32_t ConnectionThrottleLimit = 0;
+            // -ConnectionRate: clients start connections on an open-loop timeline of this many starts per second
+            // (0 == connections are started as fast as the connection limits allow)
+            uint32_t ConnectionRate = 0;
+            ConnectionArrivalType ConnectionArrival = ConnectionArrivalType::Constant;
+            uint32_t ConnectionRampTimeMs = 0;
+            // -conn:HappyEyeballs: the time a connection attempt has to connect before the next attempt is started
+            uint32_t ConnectAttemptDelayMs = 250;
 
             std::vector<wil::network::socket_address> ListenAddresses{};
             std::vector<wil::network::socket_address> TargetAddresses{};
             std::vector<wil::network::socket_address> BindAddresses{};
             std::vector<std::wstring> TargetAddressStrings{};
 
+            // optional: the mix of traffic classes to run (empty when -TrafficClass was not specified)
+            std::vector<ctsTrafficClass> TrafficClasses{};
+
             // stats for status updates and summaries
             ctsConnectionStatistics ConnectionStatusDetails;
             ctsTcpStatistics TcpStatusDetails;
@@ -420,6 +527,7 @@ namespace ctsTraffic
 
             int64_t TcpBytesPerSecondPeriod = 100LL;
             int64_t StartTimeMilliseconds = 0;
+            uint64_t StartProcessCycleTime = 0;
 
             uint32_t TimeLimit = 0;
             uint32_t PauseAtEnd = 0;
@@ -439,6 +547,167 @@ namespace ctsTraffic
             uint32_t PushBytes = 0;
             uint32_t PullBytes = 0;
 
+            // -TransfersPerConnection: each TCP connection runs this many transfers of the transfer size,
+            // with clients waiting TransferGapMs before starting each transfer after the first
+            uint32_t TransfersPerConnection = 1;
+            uint32_t TransferGapMs = 0;
+            // the time each transfer took (the first on each connection separately from the rest, on warm connections),
+            // and the bytes of the warm transfers
+            ctsLatencyHistogram FirstTransferUsec;
+            ctsLatencyHistogram WarmTransferUsec;
+            ctsStatsTracking WarmTransferBytes;
+
+            // for the IdleHold pattern
+            uint32_t IdleKeepAliveBytes = 0;
+            uint32_t IdleKeepAliveIntervalMs = 0;
+            uint32_t IdleHoldTimeMs = 0;
+            // round-trip time of every keepalive exchange (client only)
+            ctsLatencyHistogram KeepAliveRoundTripUsec;
+            // private bytes of the process before any connections were made
+            // and when the most connections were concurrently held
+            int64_t StartPrivateBytes = 0;
+            ctsStatsTracking IdleHoldPeakConnections;
+            ctsStatsTracking IdleHoldPeakPrivateBytes;
+
+            // count of send, recv, and WSAPoll calls made by -IO:WSAPoll
+            // - and the times a connection used its send/recv budget for a pass of its loop, and waited for the next pass
+            ctsStatsTracking WSAPollSyscallCount;
+            ctsStatsTracking WSAPollBudgetYields;
+
+            // -ZeroCopySend: sends issued with SO_SNDBUF=0, and those the stack completed without waiting
+            // for the peer to acknowledge the data (the stack copied the data into its own buffers)
+            ctsStatsTracking ZeroCopySendCount;
+            ctsStatsTracking ZeroCopySendCopiedCount;
+            // -ZeroCopyRecv: bytes placed directly into receives already posted when the data arrived,
+            // and bytes the stack had buffered (copied) before a receive was posted
+            ctsStatsTracking ZeroCopyRecvBytes;
+            ctsStatsTracking ZeroCopyRecvCopiedBytes;
+
+            // -SendFile: senders stream from this file with TransmitFile instead of sending from the shared buffer
+            std::wstring SendFilePath{};
+            // -SendFileSize: the size of the file generated with the verification pattern (0 == send the existing file as-is)
+            uint64_t SendFileSize = 0;
+            // -SendFileCache:cold purges the file's pages from the system cache before the run
+            bool SendFileCold = false;
+            // -RecvFile: receivers write all data received to this file, bypassing the system cache with -RecvFileMode:unbuffered
+            std::wstring RecvFilePath{};
+            bool RecvFileUnbuffered = false;
+            // bytes sent from the file, bytes written to the file, and the time spent writing them
+            ctsStatsTracking SendFileBytes;
+            ctsStatsTracking RecvFileBytes;
+            ctsStatsTracking RecvFileWriteUsec;
+
+            // -SocketPool: clients take sockets already created, configured, and bound by a background fill
+            // - each traffic class keeps up to SocketPoolHigh sockets, refilled once below SocketPoolLow
+            // - -SocketPoolBind:off leaves binding to when the socket is taken
+            uint32_t SocketPoolHigh = 0;
+            uint32_t SocketPoolLow = 0;
+            bool SocketPoolBind = true;
+            // sockets taken from the pool, and connections that found it empty and the time they spent creating their own
+            ctsStatsTracking SocketPoolHits;
+            ctsStatsTracking SocketPoolStalls;
+            ctsStatsTracking SocketPoolStallUsec;
+
+            // -LocalPort:[low,high]: ports bound from the range and the time from allocating to binding each,
+            // allocations that found every port in use (or still in TIME_WAIT), and allocated ports found already bound
+            ctsLatencyHistogram LocalPortAllocateUsec;
+            ctsStatsTracking LocalPortAllocations;
+            ctsStatsTracking LocalPortExhausted;
+            ctsStatsTracking LocalPortBindConflicts;
+
+            // -ConnectionRate: connections started, and how many the timeline intended by the time it ended
+            // - ConnectionRateElapsedUsec is the time from the beginning of the timeline to its end:
+            //   the last start, or when the run stopped if starts were still to be made
+            ctsStatsTracking ConnectionRateStarts;
+            ctsStatsTracking ConnectionRateIntended;
+            ctsStatsTracking ConnectionRateElapsedUsec;
+            // the most starts that were due but not yet made at any one time
+            ctsStatsTracking ConnectionRateMaxBehind;
+            // how long after its intended time each connection was started, and the count more than 1ms late
+            ctsLatencyHistogram ConnectionStartLatenessUsec;
+            ctsStatsTracking ConnectionLateStarts;
+
+            // -conn:HappyEyeballs: the time from the winning attempt starting until it connected and the races won, per address family
+            // - attempts started across all races, and attempts still in flight when another won (closed to cancel them)
+            ctsLatencyHistogram HappyEyeballsIpv4ConnectUsec;
+            ctsLatencyHistogram HappyEyeballsIpv6ConnectUsec;
+            ctsStatsTracking HappyEyeballsIpv4Wins;
+            ctsStatsTracking HappyEyeballsIpv6Wins;
+            ctsStatsTracking HappyEyeballsAttempts;
+            ctsStatsTracking HappyEyeballsCancelled;
+
+            // -conn:ConnectByName: lookups answered from the name cache, lookups which waited on a query already in flight,
+            // and lookups which issued a DNS query (and those queries which failed)
+            // - the time each DNS query took, and the time each connection waited for its target's addresses
+            ctsStatsTracking NameResolveCacheHits;
+            ctsStatsTracking NameResolveCoalesced;
+            ctsStatsTracking NameResolveQueries;
+            ctsStatsTracking NameResolveFailures;
+            ctsLatencyHistogram NameResolveQueryUsec;
+            ctsLatencyHistogram NameResolveWaitUsec;
+
+            // -Acc:AcceptEx: the time from each AcceptEx completing (the handshake had completed)
+            // until a ctsSocketState picked up the connection, the times a listener's pended AcceptEx requests
+            // all completed (so new connections waited in the listen backlog), and the most pended on one listener
+            ctsLatencyHistogram AcceptExPickupUsec;
+            ctsStatsTracking AcceptExBacklogExhausted;
+            ctsStatsTracking AcceptExPeakDepth;
+
+            // UDP media stream send and receive calls made, and the datagrams they carried
+            // - with -UdpOffload one call can carry many datagrams
+            ctsStatsTracking UdpSendCalls;
+            ctsStatsTracking UdpSendBytes;
+            ctsStatsTracking UdpSendDatagrams;
+            ctsStatsTracking UdpRecvCalls;
+            ctsStatsTracking UdpRecvDatagrams;
+            // change in the estimated time in flight between consecutive rendered frames (client only)
+            ctsLatencyHistogram UdpFrameJitterUsec;
+
+            // -IO:RioIocp submission batching across connections (0 == each connection submits its own requests)
+            uint32_t SubmitBatchSize = 0;
+            uint32_t SubmitBatchLatencyUsec = 100;
+            // requests submitted per flush, and how long the oldest request waited to be submitted
+            ctsLatencyHistogram SubmitBatchRequests;
+            ctsLatencyHistogram SubmitFlushLatencyUsec;
+
+            // RIO_BUFFERIDs registered over the run - pooled buffers (or recv slabs) are only registered when no free buffer is available
+            ctsStatsTracking RioBufferRegistrations;
+
+            // -IO:RioIocp busy polling: microseconds a worker spins on the IOCP before blocking (0 == always block)
+            uint32_t BusyPollUsec = 0;
+            // time workers spent spinning versus processing completions,
+            // how each notification was dequeued, and how long each worker waited for it
+            ctsStatsTracking BusyPollSpinUsec;
+            ctsStatsTracking BusyPollWorkUsec;
+            ctsStatsTracking BusyPollSpinWakeups;
+            ctsStatsTracking BusyPollBlockedWakeups;
+            ctsLatencyHistogram BusyPollWaitUsec;
+
+            // -IO:Tls: the most plaintext bytes encrypted into each TLS record (0 == the largest record the session allows)
+            uint32_t TlsRecordSize = 0;
+            // -TlsCertificate: the SHA1 thumbprint of the server certificate (empty == a self-signed certificate is created)
+            std::wstring TlsCertificateThumbprint{};
+            // TLS handshakes completed and failed, and how long each completed handshake took
+            ctsStatsTracking TlsHandshakes;
+            ctsStatsTracking TlsHandshakeFailures;
+            ctsLatencyHistogram TlsHandshakeUsec;
+            // TLS records sent, the ciphertext carrying them, and the time spent encrypting and decrypting
+            ctsStatsTracking TlsRecordsSent;
+            ctsStatsTracking TlsCiphertextBytesSent;
+            ctsStatsTracking TlsCiphertextBytesRecv;
+            ctsStatsTracking TlsEncryptUsec;
+            ctsStatsTracking TlsDecryptUsec;
+
+            // -IO:Quic: the ctsTraffic connections (QUIC streams) each client QUIC connection carries
+            uint32_t QuicStreams = 1;
+            // QUIC handshakes completed and failed, and how long each completed handshake took
+            ctsStatsTracking QuicHandshakes;
+            ctsStatsTracking QuicHandshakeFailures;
+            ctsLatencyHistogram QuicHandshakeUsec;
+            // QUIC streams opened, and how long each client stream took to start (including any handshake it waited on)
+            ctsStatsTracking QuicStreamsOpened;
+            ctsLatencyHistogram QuicStreamStartUsec;
+
             std::optional<uint32_t> BurstCount;
             std::optional<uint32_t> BurstDelay;
             std::optional<uint32_t> CpuGroupId;
@@ -453,6 +722,12 @@ namespace ctsTraffic
             bool ShouldVerifyBuffers = false;
 
             static constexpr DWORD c_CriticalSectionSpinlock = 200ul;
+
+            // returns nullptr if traffic classes were not configured
+            [[nodiscard]] ctsTrafficClass* GetTrafficClass(uint32_t trafficClass) noexcept
+            {
+                return trafficClass < TrafficClasses.size() ? &TrafficClasses[trafficClass] : nullptr;
+            }
         };
 
         //
@@ -1,97 +1,266 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// cpp headers
-#include <memory>
-// os headers
-#include <Windows.h>
-// project headers
-#include "ctsSocket.h"
-#include "ctsConfig.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-
-static std::atomic_signed_lock_free g_targetCounter{};
-
-using ctsTraffic::ctsConfig::g_configSettings;
-
-namespace ctsTraffic
-{
-    //
-    // ctsConnectByName makes *blocking* calls to connect
-    // - callers should be careful to ensure that this is really what they want
-    // - since it will not scale out well
-    //
-    // Its intended use is either for UDP sockets, or for very few concurrent connections
-    //
-    void ctsConnectByName(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
-    {
-        // attempt to get a reference to the socket
-        const auto sharedSocket(weakSocket.lock());
-        if (!sharedSocket)
-        {
-            return;
-        }
-
-        auto error = 0ul;
-        const auto socketReference(sharedSocket->AcquireSocketLock());
-        const auto socket = socketReference.GetSocket();
-        if (socket != INVALID_SOCKET)
-        {
-            try
-            {
-                const auto targetSize = g_configSettings->TargetAddressStrings.size();
-                const auto connectCounter = g_targetCounter.fetch_add(1) + 1;
-                const auto& targetAddr = g_configSettings->TargetAddressStrings[connectCounter % targetSize];
-
-                // read the local sockaddr - e.g. if we needed to bind locally
-                wil::network::socket_address localAddr(sharedSocket->GetLocalSockaddr());
-                wil::network::socket_address remoteAddr;
-                DWORD localAddrLength = localAddr.size();
-                DWORD remoteAddrLength = remoteAddr.size();
-
-                PRINT_DEBUG_INFO(L"\t\tWSAConnectByName to %ws : %u\n", targetAddr.c_str(), ctsConfig::g_configSettings->Port);
-                if (!WSAConnectByNameW(
-                    socket,
-                    const_cast<LPWSTR>(targetAddr.c_str()),
-                    const_cast<LPWSTR>(std::to_wstring(g_configSettings->Port).c_str()),
-                    &localAddrLength,
-                    localAddr.sockaddr(),
-                    &remoteAddrLength,
-                    remoteAddr.sockaddr(),
-                    nullptr,
-                    nullptr))
-                {
-                    error = WSAGetLastError();
-                    ctsConfig::PrintErrorIfFailed("WSAConnectByName", error);
-                    THROW_WIN32(error);
-                }
-                PRINT_DEBUG_INFO(
-                    L"\t\tWSAConnectByName completed successfully - localAddress (%ws), remoteAddress (%ws)\n",
-                    localAddr.format_complete_address().c_str(), remoteAddr.format_complete_address().c_str());
-
-                sharedSocket->SetLocalSockaddr(localAddr);
-                sharedSocket->SetRemoteSockaddr(remoteAddr);
-                ctsConfig::PrintNewConnection(localAddr, remoteAddr);
-            }
-            CATCH_LOG()
-        }
-        else
-        {
-            error = WSAECONNABORTED;
-        }
-
-        sharedSocket->CompleteState(error);
-    }
-}
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+// os headers
+#include <Windows.h>
+#include <WinDNS.h>
+// ctl headers
+#include <ctTimer.hpp>
+// project headers
+#include "ctsSocket.h"
+#include "ctsConfig.h"
+#include "ctsNameCache.hpp"
+#include "ctsTCPFunctions.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+static std::atomic_signed_lock_free g_targetCounter{};
+static std::atomic_signed_lock_free g_addressCounter{};
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+namespace ctsTraffic
+{
+    // a connection waiting for its target name to be resolved
+    struct ctsNameWaiter
+    {
+        std::weak_ptr<ctsSocket> m_socket;
+        int64_t m_lookupUsec = 0;
+    };
+
+    using ctsTargetNameCache = ctsNameCache<wil::network::socket_address, ctsNameWaiter>;
+
+    struct ctsNameResolver
+    {
+        wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        _Guarded_by_(m_lock) ctsTargetNameCache m_cache;
+    };
+
+    // never deleted: DNS queries can still be completing as the process exits
+    static ctsNameResolver& GetNameResolver()
+    {
+        static auto* const s_resolver = new ctsNameResolver;
+        return *s_resolver;
+    }
+
+    // an asynchronous DnsQueryEx: DnsQueryEx writes its results into m_result, which must outlive the query
+    struct ctsDnsQuery
+    {
+        std::wstring m_name;
+        int64_t m_startUsec = 0;
+        DNS_QUERY_RESULT m_result{};
+        DNS_QUERY_CANCEL m_cancel{};
+    };
+
+    static void ctsConnectResolved(const ctsNameWaiter& waiter, const ctsTargetNameCache::Resolution& resolution) noexcept
+    {
+        const auto sharedSocket(waiter.m_socket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        g_configSettings->NameResolveWaitUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - waiter.m_lookupUsec);
+        if (resolution.Error != 0)
+        {
+            ctsConfig::PrintErrorIfFailed("DnsQueryEx", resolution.Error);
+            sharedSocket->CompleteState(resolution.Error);
+            return;
+        }
+
+        // spread connections across every address the name resolved to
+        const auto addressCounter = g_addressCounter.fetch_add(1);
+        const auto& targetAddr = resolution.Addresses[addressCounter % resolution.Addresses.size()];
+        PRINT_DEBUG_INFO(L"\t\tConnectByName resolved its target to %ws\n", targetAddr.format_complete_address().c_str());
+
+        sharedSocket->SetRemoteSockaddr(targetAddr);
+        ctsConnectEx(waiter.m_socket);
+    }
+
+    static void ctsCompleteResolve(const std::wstring& name, int64_t startUsec, DWORD status, PDNS_RECORD records) noexcept
+    {
+        const auto nowUsec = ctl::ctTimer::snap_qpc_as_usec();
+        g_configSettings->NameResolveQueryUsec.Add(nowUsec - startUsec);
+
+        ctsTargetNameCache::Resolution resolution;
+        resolution.Error = status;
+        DWORD ttlSeconds = MAXDWORD;
+        try
+        {
+            for (auto* record = records; NO_ERROR == status && record != nullptr; record = record->pNext)
+            {
+                // the answers can also hold the CNAME records the name was resolved through
+                if (DNS_TYPE_AAAA == record->wType && DnsSectionAnswer == record->Flags.S.Section)
+                {
+                    wil::network::socket_address address{AF_INET6};
+                    static_assert(sizeof address.sockaddr_inet()->Ipv6.sin6_addr == sizeof record->Data.AAAA.Ip6Address);
+                    memcpy(&address.sockaddr_inet()->Ipv6.sin6_addr, &record->Data.AAAA.Ip6Address, sizeof record->Data.AAAA.Ip6Address);
+                    address.set_port(g_configSettings->Port);
+                    resolution.Addresses.push_back(address);
+                    ttlSeconds = std::min(ttlSeconds, record->dwTtl);
+                }
+            }
+            if (NO_ERROR == status && resolution.Addresses.empty())
+            {
+                resolution.Error = DNS_INFO_NO_RECORDS;
+            }
+        }
+        catch (...)
+        {
+            resolution.Addresses.clear();
+            resolution.Error = ctsConfig::PrintThrownException();
+        }
+        if (records != nullptr)
+        {
+            DnsRecordListFree(records, DnsFreeRecordList);
+        }
+        if (resolution.Error != 0)
+        {
+            g_configSettings->NameResolveFailures.Increment();
+            ttlSeconds = 0;
+        }
+
+        // the cache takes its own copy: the waiters continue with this one outside the lock
+        ctsTargetNameCache::Resolution cachedResolution;
+        try
+        {
+            cachedResolution = resolution;
+        }
+        catch (...)
+        {
+            // waiters still continue with the resolution, it just isn't cached
+            cachedResolution.Addresses.clear();
+            cachedResolution.Error = ERROR_OUTOFMEMORY;
+        }
+
+        std::vector<ctsNameWaiter> waiters;
+        {
+            auto& resolver = GetNameResolver();
+            const auto lock = resolver.m_lock.lock();
+            waiters = resolver.m_cache.Complete(name, nowUsec, std::move(cachedResolution), static_cast<int64_t>(ttlSeconds) * 1'000'000);
+        }
+        for (const auto& waiter : waiters)
+        {
+            ctsConnectResolved(waiter, resolution);
+        }
+    }
+
+    static VOID WINAPI ctsDnsQueryCompletion(_In_ PVOID pQueryContext, _Inout_ PDNS_QUERY_RESULT pQueryResults) noexcept
+    {
+        const std::unique_ptr<ctsDnsQuery> query(static_cast<ctsDnsQuery*>(pQueryContext));
+        ctsCompleteResolve(query->m_name, query->m_startUsec, pQueryResults->QueryStatus, pQueryResults->pQueryRecords);
+    }
+
+    //
+    // Queries DNS for the name's AAAA records, with DNS_QUERY_DUAL_ADDR also returning its A records
+    // as IPv4-mapped IPv6 addresses: the socket is dual-mode, so can connect to either
+    // - DnsQueryEx resolves names through the hosts file as well as DNS, and returns the TTL of each record
+    //
+    static void ctsStartResolve(const std::wstring& name) noexcept
+    {
+        std::unique_ptr<ctsDnsQuery> query;
+        try
+        {
+            query = std::make_unique<ctsDnsQuery>();
+            query->m_name = name;
+        }
+        catch (...)
+        {
+            ctsCompleteResolve(name, ctl::ctTimer::snap_qpc_as_usec(), ctsConfig::PrintThrownException(), nullptr);
+            return;
+        }
+
+        query->m_startUsec = ctl::ctTimer::snap_qpc_as_usec();
+        query->m_result.Version = DNS_QUERY_REQUEST_VERSION1;
+
+        DNS_QUERY_REQUEST request{};
+        request.Version = DNS_QUERY_REQUEST_VERSION1;
+        request.QueryName = query->m_name.c_str();
+        request.QueryType = DNS_TYPE_AAAA;
+        request.QueryOptions = DNS_QUERY_STANDARD | DNS_QUERY_DUAL_ADDR;
+        request.pQueryContext = query.get();
+        request.pQueryCompletionCallback = ctsDnsQueryCompletion;
+
+        PRINT_DEBUG_INFO(L"\t\tDnsQueryEx resolving %ws\n", query->m_name.c_str());
+        const auto status = DnsQueryEx(&request, &query->m_result, &query->m_cancel);
+        if (DNS_REQUEST_PENDING == status)
+        {
+            // owned by ctsDnsQueryCompletion
+            query.release();
+            return;
+        }
+
+        // completed inline (e.g. from the DNS client cache): the completion callback is not invoked
+        ctsCompleteResolve(query->m_name, query->m_startUsec, status, query->m_result.pQueryRecords);
+    }
+
+    //
+    // ctsConnectByName resolves the target name, then connects through ctsConnectEx
+    // - names are resolved asynchronously, and kept for the TTL of their records
+    // - connections to a name already being resolved wait for that resolution rather than querying again
+    //
+    void ctsConnectByName(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        // attempt to get a reference to the socket
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        try
+        {
+            const auto targetSize = g_configSettings->TargetAddressStrings.size();
+            const auto connectCounter = g_targetCounter.fetch_add(1) + 1;
+            const auto& targetName = g_configSettings->TargetAddressStrings[connectCounter % targetSize];
+
+            const auto lookupUsec = ctl::ctTimer::snap_qpc_as_usec();
+            ctsTargetNameCache::Resolution resolution;
+            ctsTargetNameCache::LookupResult lookupResult;
+            {
+                auto& resolver = GetNameResolver();
+                const auto lock = resolver.m_lock.lock();
+                lookupResult = resolver.m_cache.Lookup(targetName, lookupUsec, ctsNameWaiter{weakSocket, lookupUsec}, resolution);
+            }
+
+            switch (lookupResult)
+            {
+                case ctsTargetNameCache::LookupResult::Hit:
+                    g_configSettings->NameResolveCacheHits.Increment();
+                    ctsConnectResolved(ctsNameWaiter{weakSocket, lookupUsec}, resolution);
+                    break;
+
+                case ctsTargetNameCache::LookupResult::Coalesced:
+                    g_configSettings->NameResolveCoalesced.Increment();
+                    break;
+
+                case ctsTargetNameCache::LookupResult::Resolve:
+                    g_configSettings->NameResolveQueries.Increment();
+                    ctsStartResolve(targetName);
+                    break;
+            }
+        }
+        catch (...)
+        {
+            const auto error = ctsConfig::PrintThrownException();
+            sharedSocket->CompleteState(error);
+        }
+    }
+}
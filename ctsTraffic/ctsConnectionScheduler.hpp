@@ -0,0 +1,161 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+
+namespace ctsTraffic
+{
+enum class ctsArrivalProcess
+{
+    // starts evenly spaced at the rate
+    Constant,
+    // starts at exponentially distributed intervals averaging the rate
+    Poisson,
+    // evenly spaced starts, the rate growing linearly from zero to the rate over the ramp time
+    Ramp
+};
+
+//
+// ctsConnectionScheduler
+//
+// The open-loop timeline of intended connection starts for -ConnectionRate
+// - the timeline only depends on the arrival process, never on when the caller actually started a connection,
+//   so a start that can't be made on time stays due: the caller makes it as soon as it can
+//   and measures its lateness from the time it was intended, not from when the previous start was made
+//   (coordinated omission: timing each start from the previous one would hide every stall)
+// - times are microseconds on the caller's clock, so any clock (including a simulated one) can drive it
+// - not thread-safe: the caller must serialize access
+//
+class ctsConnectionScheduler
+{
+public:
+    ctsConnectionScheduler(ctsArrivalProcess arrivalProcess, double startsPerSecond, int64_t rampUsec, uint64_t seed) noexcept :
+        m_arrivalProcess(arrivalProcess),
+        m_startsPerUsec(startsPerSecond / 1000000.0),
+        m_rampUsec(arrivalProcess == ctsArrivalProcess::Ramp ? static_cast<double>(rampUsec) : 0.0),
+        m_randomEngine(seed),
+        m_interval(m_startsPerUsec)
+    {
+    }
+
+    // the timeline begins at startUsec
+    void Start(int64_t startUsec) noexcept
+    {
+        m_startUsec = startUsec;
+        m_startsTaken = 0;
+        m_nextOffsetUsec = IntendedOffset(0);
+    }
+
+    // the intended time of the next start
+    [[nodiscard]] int64_t NextStartUsec() const noexcept
+    {
+        return m_startUsec + static_cast<int64_t>(m_nextOffsetUsec);
+    }
+
+    [[nodiscard]] bool IsDue(int64_t nowUsec) const noexcept
+    {
+        return nowUsec >= NextStartUsec();
+    }
+
+    // takes the next start off the timeline, returning the time it was intended
+    int64_t TakeStart() noexcept
+    {
+        const auto intendedUsec = NextStartUsec();
+        ++m_startsTaken;
+        m_nextOffsetUsec = IntendedOffset(m_startsTaken);
+        return intendedUsec;
+    }
+
+    [[nodiscard]] uint64_t GetStartsTaken() const noexcept
+    {
+        return m_startsTaken;
+    }
+
+    // the number of starts intended at or before nowUsec, whether or not they were taken
+    [[nodiscard]] uint64_t IntendedStartsBy(int64_t nowUsec) const noexcept
+    {
+        const auto elapsedUsec = static_cast<double>(nowUsec - m_startUsec);
+        if (elapsedUsec < 0.0)
+        {
+            return 0;
+        }
+        switch (m_arrivalProcess)
+        {
+            case ctsArrivalProcess::Ramp:
+                // the count of starts is the integral of the rate, which is a triangle through the ramp
+                if (elapsedUsec < m_rampUsec)
+                {
+                    return static_cast<uint64_t>(m_startsPerUsec * elapsedUsec * elapsedUsec / (2.0 * m_rampUsec));
+                }
+                return static_cast<uint64_t>(m_startsPerUsec * (elapsedUsec - m_rampUsec / 2.0));
+
+            case ctsArrivalProcess::Constant:
+            case ctsArrivalProcess::Poisson:
+            default:
+                // Poisson arrivals are random: the expected count is what the rate intends
+                return static_cast<uint64_t>(m_startsPerUsec * elapsedUsec) + 1;
+        }
+    }
+
+    ctsConnectionScheduler(const ctsConnectionScheduler&) = delete;
+    ctsConnectionScheduler& operator=(const ctsConnectionScheduler&) = delete;
+    ctsConnectionScheduler(ctsConnectionScheduler&&) = delete;
+    ctsConnectionScheduler& operator=(ctsConnectionScheduler&&) = delete;
+
+private:
+    // the offset from the start of the timeline of the start at startIndex (0-based)
+    // - constant and ramp offsets are computed from the index, so rounding never accumulates
+    double IntendedOffset(uint64_t startIndex) noexcept
+    {
+        const auto index = static_cast<double>(startIndex);
+        switch (m_arrivalProcess)
+        {
+            case ctsArrivalProcess::Poisson:
+                // the first start is at the beginning of the timeline
+                return 0 == startIndex ? 0.0 : m_nextOffsetUsec + m_interval(m_randomEngine);
+
+            case ctsArrivalProcess::Ramp:
+            {
+                // the (index+1)th start is when the integral of the rate reaches index+1
+                // - the rate is zero at the beginning of the timeline, so no start is made there
+                const auto rampStarts = m_startsPerUsec * m_rampUsec / 2.0;
+                if (index + 1.0 <= rampStarts)
+                {
+                    return std::sqrt(2.0 * m_rampUsec * (index + 1.0) / m_startsPerUsec);
+                }
+                return m_rampUsec + (index + 1.0 - rampStarts) / m_startsPerUsec;
+            }
+
+            case ctsArrivalProcess::Constant:
+            default:
+                return index / m_startsPerUsec;
+        }
+    }
+
+    const ctsArrivalProcess m_arrivalProcess;
+    const double m_startsPerUsec;
+    const double m_rampUsec;
+    std::mt19937_64 m_randomEngine;
+    std::exponential_distribution<double> m_interval;
+
+    int64_t m_startUsec = 0;
+    uint64_t m_startsTaken = 0;
+    double m_nextOffsetUsec = 0.0;
+};
+} // namespace ctsTraffic
@@ -0,0 +1,178 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <cstdint>
+#include <vector>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+// - nor any OS headers: this header is portable, so the race can be tested on any platform
+
+namespace ctsTraffic
+{
+//
+// ctsHappyEyeballsOrder
+//
+// Orders the target addresses a connection races across (RFC 8305 section 4)
+// - the address the connection was created for goes first
+// - the remaining addresses alternate address families, starting with the other family,
+//   so a family which is black-holed delays the connection by at most one attempt delay
+// - Address only needs family(); returns indexes into targets
+//
+template <typename Address>
+std::vector<uint32_t> ctsHappyEyeballsOrder(const std::vector<Address>& targets, uint32_t first)
+{
+    std::vector<uint32_t> sameFamily;
+    std::vector<uint32_t> otherFamily;
+    for (uint32_t target = 0; target < static_cast<uint32_t>(targets.size()); ++target)
+    {
+        if (target != first)
+        {
+            if (targets[target].family() == targets[first].family())
+            {
+                sameFamily.push_back(target);
+            }
+            else
+            {
+                otherFamily.push_back(target);
+            }
+        }
+    }
+
+    std::vector<uint32_t> order{first};
+    size_t same = 0;
+    size_t other = 0;
+    while (same < sameFamily.size() || other < otherFamily.size())
+    {
+        if (other < otherFamily.size())
+        {
+            order.push_back(otherFamily[other++]);
+        }
+        if (same < sameFamily.size())
+        {
+            order.push_back(sameFamily[same++]);
+        }
+    }
+    return order;
+}
+
+//
+// ctsHappyEyeballsRace
+//
+// Tracks the staggered connection attempts of one connection (RFC 8305 section 5)
+// - attempts start in order: the next when the newest fails, or hasn't connected within the connection attempt delay
+// - the first attempt to connect wins: the attempts still in flight lose, and are closed by the caller
+// - the race fails once every attempt has failed, with the error of the last to fail
+// - not thread-safe: callers serialize calls with their own lock
+//
+class ctsHappyEyeballsRace
+{
+public:
+    static constexpr uint32_t c_noAttempt = UINT32_MAX;
+
+    enum class Outcome : std::uint8_t
+    {
+        // not decided: start the next attempt, if there is one
+        Racing,
+        Won,
+        // decided by another attempt
+        Lost,
+        Failed
+    };
+
+    explicit ctsHappyEyeballsRace(uint32_t attemptCount) noexcept :
+        m_attemptCount(attemptCount)
+    {
+    }
+
+    // returns c_noAttempt once every attempt has started, or the race is decided
+    uint32_t StartNextAttempt() noexcept
+    {
+        if (IsDecided() || m_startedCount == m_attemptCount)
+        {
+            return c_noAttempt;
+        }
+        ++m_inFlightCount;
+        return m_startedCount++;
+    }
+
+    // the connection attempt delay only applies to the attempt started last
+    [[nodiscard]] bool IsNewestAttempt(uint32_t attempt) const noexcept
+    {
+        return attempt + 1 == m_startedCount;
+    }
+
+    Outcome AttemptConnected(uint32_t attempt) noexcept
+    {
+        --m_inFlightCount;
+        if (IsDecided())
+        {
+            return Outcome::Lost;
+        }
+        m_winner = attempt;
+        return Outcome::Won;
+    }
+
+    Outcome AttemptFailed(uint32_t error) noexcept
+    {
+        --m_inFlightCount;
+        if (IsDecided())
+        {
+            return Outcome::Lost;
+        }
+        m_lastError = error;
+        ++m_failedCount;
+        return m_failedCount == m_attemptCount ? Outcome::Failed : Outcome::Racing;
+    }
+
+    [[nodiscard]] bool IsDecided() const noexcept
+    {
+        return m_winner != c_noAttempt || m_failedCount == m_attemptCount;
+    }
+
+    // decided, and every attempt started has completed: nothing more will be reported to the race
+    [[nodiscard]] bool IsFinished() const noexcept
+    {
+        return IsDecided() && 0 == m_inFlightCount;
+    }
+
+    [[nodiscard]] uint32_t GetWinner() const noexcept
+    {
+        return m_winner;
+    }
+
+    [[nodiscard]] uint32_t GetLastError() const noexcept
+    {
+        return m_lastError;
+    }
+
+    [[nodiscard]] uint32_t GetStartedCount() const noexcept
+    {
+        return m_startedCount;
+    }
+
+    [[nodiscard]] uint32_t GetInFlightCount() const noexcept
+    {
+        return m_inFlightCount;
+    }
+
+private:
+    const uint32_t m_attemptCount;
+    uint32_t m_startedCount = 0;
+    uint32_t m_inFlightCount = 0;
+    uint32_t m_failedCount = 0;
+    uint32_t m_winner = c_noAttempt;
+    uint32_t m_lastError = 0;
+};
+} // namespace ctsTraffic
@@ -0,0 +1,490 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <algorithm>
+#include <memory>
+#include <vector>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctTimer.hpp>
+// project headers
+#include "ctsSocket.h"
+#include "ctsConfig.h"
+#include "ctsHappyEyeballs.hpp"
+#include "ctsTCPFunctions.h"
+#include "ctsWinsockLayer.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+namespace ctsTraffic
+{
+class ctsConnectRace;
+
+//
+// One attempt of a connection race
+// - attempt 0 connects the socket the ctsSocket was created with, the others connect sockets created for the race
+// - each ConnectEx signals an event rather than the IOCP: a socket can only be associated with one completion port,
+//   and the winner's is associated by the ctsSocket as IO starts
+//
+struct ctsConnectAttempt
+{
+    ctsConnectRace* m_race = nullptr;
+    uint32_t m_index = 0;
+    wil::network::socket_address m_targetAddr;
+    ctsRaceSocket m_raceSocket;
+    OVERLAPPED m_overlapped{};
+    wil::unique_event_nothrow m_connectEvent;
+    // waits for the ConnectEx to complete - and for the connection attempt delay while this is the newest attempt
+    wil::unique_threadpool_wait_nowait m_connectWait;
+    int64_t m_startUsec = 0;
+    // the ConnectEx has been issued and hasn't yet completed
+    bool m_connecting = false;
+};
+
+//
+// Races staggered ConnectEx attempts across the target addresses (RFC 8305)
+// - kept alive by a reference to itself until every attempt started has completed
+//
+class ctsConnectRace
+{
+public:
+    ctsConnectRace(const std::shared_ptr<ctsSocket>& sharedSocket, const std::vector<wil::network::socket_address>& targets) :
+        m_socket(sharedSocket),
+        m_trafficClass(sharedSocket->GetTrafficClass()),
+        m_race(static_cast<uint32_t>(targets.size()))
+    {
+        for (const auto& target : targets)
+        {
+            auto& attempt = m_attempts.emplace_back(std::make_unique<ctsConnectAttempt>());
+            attempt->m_race = this;
+            attempt->m_index = static_cast<uint32_t>(m_attempts.size() - 1);
+            attempt->m_targetAddr = target;
+        }
+    }
+
+    static void Start(const std::shared_ptr<ctsConnectRace>& race) noexcept
+    {
+        auto outcome = ctsHappyEyeballsRace::Outcome::Racing;
+        std::shared_ptr<ctsConnectRace> finished;
+        {
+            const auto lock = race->m_lock.lock();
+            race->m_self = race;
+            outcome = race->StartNextAttempts();
+            if (race->m_race.IsFinished())
+            {
+                finished = std::move(race->m_self);
+            }
+        }
+
+        if (ctsHappyEyeballsRace::Outcome::Failed == outcome)
+        {
+            race->CompleteFailed();
+        }
+    }
+
+    ctsConnectRace(const ctsConnectRace&) = delete;
+    ctsConnectRace& operator=(const ctsConnectRace&) = delete;
+    ctsConnectRace(ctsConnectRace&&) = delete;
+    ctsConnectRace& operator=(ctsConnectRace&&) = delete;
+    ~ctsConnectRace() = default;
+
+private:
+    const std::weak_ptr<ctsSocket> m_socket;
+    const uint32_t m_trafficClass;
+
+    wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+    _Guarded_by_(m_lock) ctsHappyEyeballsRace m_race;
+    _Guarded_by_(m_lock) std::vector<std::unique_ptr<ctsConnectAttempt>> m_attempts;
+    _Guarded_by_(m_lock) std::shared_ptr<ctsConnectRace> m_self;
+
+    static VOID NTAPI ConnectWaitCallback(PTP_CALLBACK_INSTANCE, PVOID pContext, PTP_WAIT, TP_WAIT_RESULT waitResult) noexcept
+    {
+        const auto* const attempt = static_cast<ctsConnectAttempt*>(pContext);
+        attempt->m_race->ConnectWaitCompleted(attempt->m_index, WAIT_TIMEOUT == waitResult);
+    }
+
+    // starts attempts until one is pended or the race runs out of attempts - returns Failed once every attempt has failed
+    _Requires_lock_held_(m_lock) ctsHappyEyeballsRace::Outcome StartNextAttempts() noexcept
+    {
+        for (auto index = m_race.StartNextAttempt(); index != ctsHappyEyeballsRace::c_noAttempt; index = m_race.StartNextAttempt())
+        {
+            g_configSettings->HappyEyeballsAttempts.Increment();
+            const auto error = StartAttempt(*m_attempts[index]);
+            if (NO_ERROR == error)
+            {
+                return ctsHappyEyeballsRace::Outcome::Racing;
+            }
+
+            CloseAttempt(*m_attempts[index]);
+            if (ctsHappyEyeballsRace::Outcome::Failed == m_race.AttemptFailed(error))
+            {
+                return ctsHappyEyeballsRace::Outcome::Failed;
+            }
+        }
+        return ctsHappyEyeballsRace::Outcome::Racing;
+    }
+
+    _Requires_lock_held_(m_lock) uint32_t StartAttempt(ctsConnectAttempt& attempt) noexcept
+    {
+        attempt.m_startUsec = ctl::ctTimer::snap_qpc_as_usec();
+        if (attempt.m_index != 0)
+        {
+            const char* functionName{};
+            const auto error = ctsWSASocketCreateForTarget(m_trafficClass, attempt.m_targetAddr, attempt.m_raceSocket, functionName);
+            if (error != NO_ERROR)
+            {
+                ctsConfig::PrintErrorIfFailed(functionName, error);
+                return error;
+            }
+        }
+
+        if (!attempt.m_connectEvent.try_create(wil::EventOptions::ManualReset, nullptr))
+        {
+            return GetLastError();
+        }
+        attempt.m_overlapped.hEvent = attempt.m_connectEvent.get();
+        attempt.m_connectWait.reset(CreateThreadpoolWait(ConnectWaitCallback, &attempt, g_configSettings->pTpEnvironment));
+        if (!attempt.m_connectWait)
+        {
+            return GetLastError();
+        }
+
+        uint32_t error = NO_ERROR;
+        if (0 == attempt.m_index)
+        {
+            const auto sharedSocket(m_socket.lock());
+            if (!sharedSocket)
+            {
+                return WSAECONNABORTED;
+            }
+
+            const auto socketReference(sharedSocket->AcquireSocketLock());
+            error = IssueConnect(socketReference.GetSocket(), attempt);
+        }
+        else
+        {
+            error = IssueConnect(attempt.m_raceSocket.Socket.get(), attempt);
+        }
+        if (error != NO_ERROR)
+        {
+            return error;
+        }
+
+        PRINT_DEBUG_INFO(L"\t\tHappyEyeballs attempt %u connecting to %ws\n", attempt.m_index, attempt.m_targetAddr.format_complete_address().c_str());
+        attempt.m_connecting = true;
+        SetConnectWait(attempt, true);
+        return NO_ERROR;
+    }
+
+    static uint32_t IssueConnect(SOCKET socket, ctsConnectAttempt& attempt) noexcept
+    {
+        if (INVALID_SOCKET == socket)
+        {
+            return WSAECONNABORTED;
+        }
+
+        if (!g_configSettings->winsockFunctions->ConnectEx(socket, attempt.m_targetAddr.sockaddr(), attempt.m_targetAddr.size(), nullptr, 0, nullptr, &attempt.m_overlapped))
+        {
+            const auto error = WSAGetLastError();
+            if (error != ERROR_IO_PENDING)
+            {
+                PRINT_DEBUG_INFO(L"\t\tHappyEyeballs attempt %u ConnectEx failed (%d)\n", attempt.m_index, error);
+                return error;
+            }
+        }
+        // completed inline or pended: either way the event is set once the connect has completed
+        return NO_ERROR;
+    }
+
+    static void SetConnectWait(ctsConnectAttempt& attempt, bool newestAttempt) noexcept
+    {
+        // relative times are negative, in 100ns units
+        FILETIME attemptDelay{};
+        const auto attemptDelayTicks = -static_cast<int64_t>(g_configSettings->ConnectAttemptDelayMs) * 10000LL;
+        attemptDelay.dwLowDateTime = static_cast<DWORD>(attemptDelayTicks);
+        attemptDelay.dwHighDateTime = static_cast<DWORD>(attemptDelayTicks >> 32);
+        SetThreadpoolWait(attempt.m_connectWait.get(), attempt.m_connectEvent.get(), newestAttempt ? &attemptDelay : nullptr);
+    }
+
+    _Requires_lock_held_(m_lock) uint32_t GetConnectResult(ctsConnectAttempt& attempt) const noexcept
+    {
+        DWORD transferred{};
+        DWORD flags{};
+        if (0 == attempt.m_index)
+        {
+            const auto sharedSocket(m_socket.lock());
+            if (!sharedSocket)
+            {
+                return WSAECONNABORTED;
+            }
+
+            const auto socketReference(sharedSocket->AcquireSocketLock());
+            if (INVALID_SOCKET == socketReference.GetSocket())
+            {
+                return WSAECONNABORTED;
+            }
+            if (!WSAGetOverlappedResult(socketReference.GetSocket(), &attempt.m_overlapped, &transferred, FALSE, &flags))
+            {
+                return WSAGetLastError();
+            }
+            return NO_ERROR;
+        }
+
+        if (!WSAGetOverlappedResult(attempt.m_raceSocket.Socket.get(), &attempt.m_overlapped, &transferred, FALSE, &flags))
+        {
+            return WSAGetLastError();
+        }
+        return NO_ERROR;
+    }
+
+    // closes a socket created for the race (the ctsSocket closes its own), which cancels a pended ConnectEx
+    static void CloseAttempt(ctsConnectAttempt& attempt) noexcept
+    {
+        if (attempt.m_raceSocket.Socket)
+        {
+            // it may have connected just as it lost the race: don't leave it in TIME_WAIT
+            (void)ctsSetLingerToResetSocket(attempt.m_raceSocket.Socket.get());
+            attempt.m_raceSocket.Socket.reset();
+        }
+        if (attempt.m_raceSocket.LocalPort != 0)
+        {
+            ctsWSASocketReleaseLocalPort(attempt.m_raceSocket.LocalPortAllocator, attempt.m_raceSocket.LocalPort, false);
+            attempt.m_raceSocket.LocalPort = 0;
+        }
+    }
+
+    // the winner is decided: close every other attempt still connecting, and hand the winning socket to the ctsSocket
+    // - returns false if the ctsSocket has already closed
+    _Requires_lock_held_(m_lock) bool TakeWinner(ctsConnectAttempt& winner) noexcept
+    {
+        for (uint32_t index = 0; index < m_race.GetStartedCount(); ++index)
+        {
+            auto& attempt = *m_attempts[index];
+            if (index != winner.m_index && attempt.m_connecting)
+            {
+                g_configSettings->HappyEyeballsCancelled.Increment();
+                CloseAttempt(attempt);
+            }
+        }
+
+        const auto connectUsec = ctl::ctTimer::snap_qpc_as_usec() - winner.m_startUsec;
+        if (AF_INET == winner.m_targetAddr.family())
+        {
+            g_configSettings->HappyEyeballsIpv4ConnectUsec.Add(connectUsec);
+            g_configSettings->HappyEyeballsIpv4Wins.Increment();
+        }
+        else
+        {
+            g_configSettings->HappyEyeballsIpv6ConnectUsec.Add(connectUsec);
+            g_configSettings->HappyEyeballsIpv6Wins.Increment();
+        }
+
+        if (0 == winner.m_index)
+        {
+            return true;
+        }
+
+        const auto sharedSocket(m_socket.lock());
+        // the ctsSocket's own socket is closed as it's replaced, cancelling its ConnectEx if still pended
+        if (sharedSocket && sharedSocket->ReplaceSocket(
+            winner.m_raceSocket.Socket,
+            winner.m_raceSocket.LocalAddress,
+            winner.m_targetAddr,
+            winner.m_raceSocket.LocalPortAllocator,
+            winner.m_raceSocket.LocalPort))
+        {
+            // the ctsSocket now returns the port
+            winner.m_raceSocket.LocalPort = 0;
+            return true;
+        }
+
+        CloseAttempt(winner);
+        return false;
+    }
+
+    void ConnectWaitCompleted(uint32_t index, bool attemptDelayExpired) noexcept
+    {
+        auto outcome = ctsHappyEyeballsRace::Outcome::Racing;
+        auto winnerClosed = false;
+        wil::network::socket_address targetAddr;
+        // released after the lock: the race is deleted once every attempt started has completed
+        std::shared_ptr<ctsConnectRace> finished;
+        {
+            const auto lock = m_lock.lock();
+            auto& attempt = *m_attempts[index];
+            targetAddr = attempt.m_targetAddr;
+            if (attemptDelayExpired)
+            {
+                // still connecting: keep waiting for it, and start the next attempt alongside it
+                SetConnectWait(attempt, false);
+                if (m_race.IsNewestAttempt(index))
+                {
+                    outcome = StartNextAttempts();
+                }
+                PRINT_DEBUG_INFO(L"\t\tHappyEyeballs attempt %u has not connected within %u ms\n", index, g_configSettings->ConnectAttemptDelayMs);
+            }
+            else
+            {
+                attempt.m_connecting = false;
+                if (m_race.IsDecided())
+                {
+                    // lost: it was closed when the race was decided
+                    outcome = m_race.AttemptFailed(WSAECONNABORTED);
+                }
+                else if (const auto error = GetConnectResult(attempt); NO_ERROR == error)
+                {
+                    outcome = m_race.AttemptConnected(index);
+                    winnerClosed = !TakeWinner(attempt);
+                }
+                else
+                {
+                    PRINT_DEBUG_INFO(L"\t\tHappyEyeballs attempt %u to %ws failed (%u)\n", index, targetAddr.format_complete_address().c_str(), error);
+                    CloseAttempt(attempt);
+                    outcome = m_race.AttemptFailed(error);
+                    if (ctsHappyEyeballsRace::Outcome::Racing == outcome)
+                    {
+                        // don't wait for the attempt delay once an attempt has failed
+                        outcome = StartNextAttempts();
+                    }
+                }
+            }
+
+            if (m_race.IsFinished())
+            {
+                finished = std::move(m_self);
+            }
+        }
+
+        if (ctsHappyEyeballsRace::Outcome::Won == outcome)
+        {
+            CompleteConnected(targetAddr, winnerClosed);
+        }
+        else if (ctsHappyEyeballsRace::Outcome::Failed == outcome)
+        {
+            CompleteFailed();
+        }
+    }
+
+    // as ctsConnectEx completes a connection
+    void CompleteConnected(const wil::network::socket_address& targetAddress, bool winnerClosed) const noexcept
+    {
+        const auto sharedSocket(m_socket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        auto gle = winnerClosed ? WSAECONNABORTED : 0;
+        wil::network::socket_address localAddr;
+        {
+            const auto socketReference(sharedSocket->AcquireSocketLock());
+            const auto socket = socketReference.GetSocket();
+            if (socket == INVALID_SOCKET)
+            {
+                gle = WSAECONNABORTED;
+            }
+
+            // update the socket context - necessary with ConnectEx
+            if (NO_ERROR == gle)
+            {
+                const auto err = setsockopt(socket, SOL_SOCKET, SO_UPDATE_CONNECT_CONTEXT, nullptr, 0);
+                FAIL_FAST_IF_MSG(
+                    err != 0,
+                    "setsockopt(SO_UPDATE_CONNECT_CONTEXT) failed [%d], connected socket [%lld]",
+                    WSAGetLastError(), static_cast<int64_t>(socket));
+
+                ctsConfig::SetPostConnectOptions(socket, targetAddress);
+
+                // store the local addr of the connection
+                int localAddrLen = localAddr.size();
+                if (0 == getsockname(socket, localAddr.sockaddr(), &localAddrLen))
+                {
+                    sharedSocket->SetLocalSockaddr(localAddr);
+                }
+            }
+        }
+
+        ctsConfig::PrintErrorIfFailed("ConnectEx", gle);
+        sharedSocket->CompleteState(gle);
+        // print results after completing state
+        if (NO_ERROR == gle)
+        {
+            ctsConfig::PrintNewConnection(localAddr, targetAddress);
+        }
+    }
+
+    void CompleteFailed() noexcept
+    {
+        uint32_t error{};
+        {
+            const auto lock = m_lock.lock();
+            error = m_race.GetLastError();
+        }
+
+        ctsConfig::PrintErrorIfFailed("ConnectEx", error);
+        if (const auto sharedSocket(m_socket.lock()); sharedSocket)
+        {
+            sharedSocket->CompleteState(error);
+        }
+    }
+};
+
+void ctsHappyEyeballsConnect(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+{
+    const auto sharedSocket(weakSocket.lock());
+    if (!sharedSocket)
+    {
+        return;
+    }
+
+    try
+    {
+        // a traffic class can override the target addresses for its connections
+        const auto* const trafficClass = g_configSettings->GetTrafficClass(sharedSocket->GetTrafficClass());
+        const auto& targetAddresses = trafficClass && !trafficClass->TargetAddresses.empty()
+            ? trafficClass->TargetAddresses
+            : g_configSettings->TargetAddresses;
+
+        // race the target the socket was created for, then the targets of every family there's a bind address for
+        const auto& socketTarget = sharedSocket->GetRemoteSockaddr();
+        std::vector<wil::network::socket_address> targets{socketTarget};
+        for (const auto& target : targetAddresses)
+        {
+            if (!(target == socketTarget) &&
+                std::ranges::any_of(g_configSettings->BindAddresses, [&](const wil::network::socket_address& bind) noexcept { return bind.family() == target.family(); }))
+            {
+                targets.push_back(target);
+            }
+        }
+
+        std::vector<wil::network::socket_address> orderedTargets;
+        for (const auto target : ctsHappyEyeballsOrder(targets, 0))
+        {
+            orderedTargets.push_back(targets[target]);
+        }
+
+        ctsConnectRace::Start(std::make_shared<ctsConnectRace>(sharedSocket, orderedTargets));
+    }
+    catch (...)
+    {
+        const auto error = ctsConfig::PrintThrownException();
+        sharedSocket->CompleteState(error);
+    }
+}
+} // namespace
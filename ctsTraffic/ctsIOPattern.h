@@ -17,12 +17,14 @@ See the Apache Version 2.0 License for specific language governing permissions a
 #include <array>
 #include <memory>
 #include <algorithm>
+#include <type_traits>
 // os headers
 #include <Windows.h>
 // project headers
 #include "ctsConfig.h"
 #include "ctsIOPatternState.hpp"
 #include "ctsIOTask.hpp"
+#include "ctsRioBufferPool.hpp"
 #include "ctsStatistics.hpp"
 // wil headers always included last
 #include <wil/stl.h>
@@ -77,11 +79,16 @@ public:
     }
 
     // Helper factory to build known patterns
-    static std::shared_ptr<ctsIoPattern> MakeIoPattern();
+    // - the traffic class selects the pattern and per-class settings when traffic classes are configured
+    static std::shared_ptr<ctsIoPattern> MakeIoPattern(uint32_t trafficClass = ctsConfig::c_defaultTrafficClass);
     // Making available the shared buffer used for sends and recvs
     static char* AccessSharedBuffer() noexcept;
+    // the shared buffer repeats the verification pattern every GetSharedBufferPatternSize() bytes
+    // - each send task's m_bufferOffset is the offset into that pattern
+    static uint32_t GetSharedBufferPatternSize() noexcept;
     // destructor must be virtual as this is a base pure virtual class
-    virtual ~ctsIoPattern() noexcept = default;
+    // - returns RIO buffers to the process-wide pools they were taken from
+    virtual ~ctsIoPattern() noexcept;
 
     // Exposing statistics members publicly to ctsSocket
     virtual void PrintStatistics(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr) noexcept = 0;
@@ -101,6 +108,11 @@ public:
         return m_lastError;
     }
 
+    [[nodiscard]] uint32_t GetTrafficClass() const noexcept
+    {
+        return m_trafficClass;
+    }
+
     void SetParent(const std::shared_ptr<ctsSocket>& parentSocket) noexcept
     {
         m_parentSocket = parentSocket;
@@ -119,7 +131,9 @@ public:
         }
 
         // add 2 to count 1 for m_rioConnectionId and one for m_rioCompletionMessages
-        return m_receivingRioBufferIds.size() + m_sendingRioBufferIds.size() + 2;
+        // - plus 1 for m_rioNextTransferId when the server receives the id of each next transfer
+        const size_t nextTransferIdCount = m_rioNextTransferId.m_bufferId != RIO_INVALID_BUFFERID ? 1 : 0;
+        return m_receivingRioBuffers.size() + m_sendingRioBufferIds.size() + 2 + nextTransferIdCount;
     }
 
     //
@@ -170,6 +184,10 @@ private:
     // - *not* setting the private ctsIOTask::tracked_io property
     ctsTask CreateNewTask(ctsTaskAction action, uint32_t maxTransfer) noexcept;
 
+    // -TransfersPerConnection: records the time of the transfer which just exchanged its completion message
+    // - and prepares the derived pattern for the next transfer if one follows
+    void CompleteTransfer() noexcept;
+
     //
     // Private method which must be implemented by the derived interface (the IO pattern)
     //
@@ -186,6 +204,16 @@ private:
     virtual ctsTask GetNextTaskFromPattern() = 0;
     virtual ctsIoPatternError CompleteTaskBackToPattern(const ctsTask&, uint32_t currentTransfer) noexcept = 0;
 
+    //
+    // void StartNextTransfer() noexcept
+    // - -TransfersPerConnection: a notification to the derived class that the transfer completed
+    //   and another of GetTotalTransfer() bytes follows on this connection - all IO of the prior transfer has completed
+    // - derived classes tracking their progress through the transfer must reset it here
+    //
+    virtual void StartNextTransfer() noexcept
+    {
+    }
+
     // holding a weak reference to the parent socket object
     // since these will share the same locking requirements
     std::weak_ptr<ctsSocket> m_parentSocket;
@@ -215,6 +243,8 @@ private:
     std::vector<char*> m_recvBufferFreeList;
     std::vector<char> m_recvBufferContainer;
     std::array<char, c_completionMessageSize> m_completionMessageBuffer{};
+    // -TransfersPerConnection: the server receives the id starting each next transfer here, to compare with its own
+    std::array<char, ctsStatistics::ConnectionIdLength> m_nextTransferIdBuffer{};
 
     struct RioBufferId
     {
@@ -262,11 +292,17 @@ private:
     };
 
     // RIO buffer-Id for send()'s and recv()'s
-    // cannot use the same RIO_BUFFERID concurrently (not supported by RIO)
-    std::vector<RioBufferId> m_receivingRioBufferIds;
+    // sends all read the shared send buffer, so each concurrent send needs its own RIO_BUFFERID
+    // recvs each have their own buffer, which can share its RIO_BUFFERID with other recv buffers at another offset
+    // - the recv buffers are owned by the process-wide pool: they are returned, not deregistered
+    std::vector<ctsRioBufferPool::RegisteredBuffer> m_receivingRioBuffers;
     std::vector<RioBufferId> m_sendingRioBufferIds;
+    // send buffer IDs are taken from the process-wide pool as sends need them
+    // - the total taken by this connection, including those with sends in flight
+    uint32_t m_sendingRioBufferIdsHeld = 0;
     RioBufferId m_rioConnectionId;
     RioBufferId m_rioCompletionMessage;
+    RioBufferId m_rioNextTransferId;
 
     // tracking time information for scheduling IO at time offsets
     // (bytes/sec) * (1 sec/1000 ms) * (x ms/Quantum) == (bytes/quantum)
@@ -276,10 +312,16 @@ private:
 
     uint32_t m_lastError = c_statusIoRunning;
 
+    // -TransfersPerConnection: when the current transfer made its first IO request
+    int64_t m_transferStartUsec = 0;
+
+    // the traffic class this pattern is tracking statistics for
+    const uint32_t m_trafficClass;
+
 protected:
     // protected constructor
     // - only applicable for the derived types to indicate if it will need send or recv buffers
-    explicit ctsIoPattern(uint32_t recvCount);
+    explicit ctsIoPattern(uint32_t recvCount, uint32_t trafficClass = ctsConfig::c_defaultTrafficClass);
 
     // The derived template class for tracking statistics must implement these pure virtual functions
     virtual void StartStatistics() noexcept = 0;
@@ -291,6 +333,9 @@ protected:
     // </summary>
     void CreateRecvBuffers();
     void CreateSendBuffers();
+    // takes another send buffer ID from the process-wide pool
+    // - returns false if this connection already holds the max # of send buffer IDs, or none could be registered
+    bool AcquireRioSendBufferId() noexcept;
 
     //
     // Returns a ctsIOTask for the next transfer based on the IOAction
@@ -417,8 +462,8 @@ template <typename S>
 class ctsIoPatternStatistics : public ctsIoPattern
 {
 public:
-    explicit ctsIoPatternStatistics(uint32_t recvCount) :
-        ctsIoPattern{recvCount}
+    explicit ctsIoPatternStatistics(uint32_t recvCount, uint32_t trafficClass = ctsConfig::c_defaultTrafficClass) :
+        ctsIoPattern{recvCount, trafficClass}
     {
         // servers need to generate a unique connection ID
         if (ctsConfig::IsListening())
@@ -452,11 +497,33 @@ public:
             UpdateLastPatternError(ctsIoPatternError::TooFewBytes);
         }
 
-        ctsConfig::PrintConnectionResults(
-            localAddr,
-            remoteAddr,
-            GetLastPatternError(),
-            m_statistics);
+        if constexpr (std::is_same_v<S, ctsTcpStatistics>)
+        {
+            // the connection time of successful connections is tracked per traffic class to report latency
+            if (auto* const trafficClass = ctsConfig::g_configSettings->GetTrafficClass(GetTrafficClass()))
+            {
+                if (0 == GetLastPatternError())
+                {
+                    trafficClass->CompletedConnectionTimeMs.Add(m_statistics.m_endTime.GetValue() - m_statistics.m_startTime.GetValue());
+                    trafficClass->CompletedConnectionCount.Increment();
+                }
+            }
+
+            ctsConfig::PrintConnectionResults(
+                localAddr,
+                remoteAddr,
+                GetLastPatternError(),
+                m_statistics,
+                GetTrafficClass());
+        }
+        else
+        {
+            ctsConfig::PrintConnectionResults(
+                localAddr,
+                remoteAddr,
+                GetLastPatternError(),
+                m_statistics);
+        }
     }
 
     void PrintTcpInfo(const wil::network::socket_address& localAddr, const wil::network::socket_address& remoteAddr, SOCKET socket) noexcept override
@@ -502,7 +569,7 @@ public:
 class ctsIoPatternPull final : public ctsIoPatternStatistics<ctsTcpStatistics>
 {
 public:
-    ctsIoPatternPull();
+    explicit ctsIoPatternPull(uint32_t trafficClass = ctsConfig::c_defaultTrafficClass);
     ~ctsIoPatternPull() noexcept override = default;
 
     ctsIoPatternPull(const ctsIoPatternPull&) = delete;
@@ -529,7 +596,7 @@ private:
 class ctsIoPatternPush final : public ctsIoPatternStatistics<ctsTcpStatistics>
 {
 public:
-    ctsIoPatternPush();
+    explicit ctsIoPatternPush(uint32_t trafficClass = ctsConfig::c_defaultTrafficClass);
     ~ctsIoPatternPush() noexcept override = default;
 
     ctsIoPatternPush(const ctsIoPatternPush&) = delete;
@@ -557,7 +624,7 @@ private:
 class ctsIoPatternPushPull final : public ctsIoPatternStatistics<ctsTcpStatistics>
 {
 public:
-    ctsIoPatternPushPull();
+    explicit ctsIoPatternPushPull(uint32_t trafficClass = ctsConfig::c_defaultTrafficClass);
     ~ctsIoPatternPushPull() noexcept override = default;
 
     ctsIoPatternPushPull(const ctsIoPatternPushPull&) = delete;
@@ -567,6 +634,7 @@ public:
 
     ctsTask GetNextTaskFromPattern() noexcept override;
     ctsIoPatternError CompleteTaskBackToPattern(const ctsTask& task, uint32_t currentTransfer) noexcept override;
+    void StartNextTransfer() noexcept override;
 
 private:
     const uint32_t m_pushSegmentSize;
@@ -588,7 +656,7 @@ private:
 class ctsIoPatternDuplex final : public ctsIoPatternStatistics<ctsTcpStatistics>
 {
 public:
-    ctsIoPatternDuplex() noexcept;
+    explicit ctsIoPatternDuplex(uint32_t trafficClass = ctsConfig::c_defaultTrafficClass) noexcept;
     ~ctsIoPatternDuplex() noexcept override = default;
 
     ctsIoPatternDuplex(const ctsIoPatternDuplex&) = delete;
@@ -599,6 +667,7 @@ public:
     // required virtual functions
     ctsTask GetNextTaskFromPattern() noexcept override;
     ctsIoPatternError CompleteTaskBackToPattern(const ctsTask& task, uint32_t completedBytes) noexcept override;
+    void StartNextTransfer() noexcept override;
 
 private:
     // need to know when to stop sending
@@ -608,6 +677,51 @@ private:
     uint32_t m_sendBytesInFlight{0};
 };
 
+//
+// IdleHold Pattern
+//  - TCP-only
+//  - Holds mostly-idle connections open to measure the cost of many long-lived connections
+//  - The client sends a small keepalive payload every keepalive interval
+//  - The server echoes back the same number of bytes
+//  - The client tracks the round-trip time of each keepalive exchange
+//  - Only a single recv buffer the size of the keepalive payload is allocated per connection
+//
+class ctsIoPatternIdleHold final : public ctsIoPatternStatistics<ctsTcpStatistics>
+{
+public:
+    ctsIoPatternIdleHold() noexcept;
+    ~ctsIoPatternIdleHold() noexcept override = default;
+
+    ctsIoPatternIdleHold(const ctsIoPatternIdleHold&) = delete;
+    ctsIoPatternIdleHold& operator=(const ctsIoPatternIdleHold&) = delete;
+    ctsIoPatternIdleHold(ctsIoPatternIdleHold&&) = delete;
+    ctsIoPatternIdleHold& operator=(ctsIoPatternIdleHold&&) = delete;
+
+    // required virtual functions
+    ctsTask GetNextTaskFromPattern() noexcept override;
+    ctsIoPatternError CompleteTaskBackToPattern(const ctsTask& task, uint32_t completedBytes) noexcept override;
+
+private:
+    void CompleteExchange() noexcept;
+
+    const uint32_t m_keepAliveBytes;
+    const int64_t m_keepAliveIntervalMs;
+    const bool m_listening;
+
+    // bytes completed for the current keepalive exchange
+    uint32_t m_sendBytesThisExchange{0};
+    uint32_t m_recvBytesThisExchange{0};
+    bool m_recvPosted{false};
+    // the client starts by sending, the server starts by receiving
+    bool m_sendNeeded{false};
+
+    // client-only: timestamps to calculate the keepalive round-trip time
+    int64_t m_exchangeStartMs{0};
+    int64_t m_sendScheduledUsec{0};
+    int64_t m_sendCompletedUsec{0};
+    int64_t m_recvCompletedUsec{0};
+};
+
 //
 // UDP Media server
 //  - Receives a START message from a client to establish a 'connection'
@@ -701,6 +815,8 @@ private:
     // member functions - all require the base lock
     std::vector<ctsConfig::JitterFrameEntry>::iterator FindSequenceNumber(int64_t sequenceNumber) noexcept;
 
+    ctsIoPatternError CompleteReceivedDatagram(const ctsTask& task, uint32_t completedBytes, const LARGE_INTEGER& qpc) noexcept;
+
     bool ReceivedBufferedFrames() noexcept;
 
     [[nodiscard]] bool SetNextTimer(bool initialTimer) const noexcept;
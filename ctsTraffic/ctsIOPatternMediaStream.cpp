@@ -14,6 +14,7 @@ See the Apache Version 2.0 License for specific language governing permissions a
 
 // cpp headers
 #include <algorithm>
+#include <cmath>
 #include <vector>
 // os headers
 #include <Windows.h>
@@ -127,9 +128,10 @@ ctsTask ctsIoPatternMediaStreamClient::GetNextTaskFromPattern() noexcept
     if (m_recvNeeded > 0)
     {
         // don't try posting more than m_maxDatagramSize at a time
+        // - unless the stack can coalesce datagrams into each receive (-UdpOffload)
         returnTask = CreateUntrackedTask(
             ctsTaskAction::Recv,
-            std::min(m_frameSizeBytes, m_maxDatagramSize));
+            std::min(m_frameSizeBytes, ctsConfig::GetMediaStream().UdpOffload ? c_udpOffloadMaxBytes : m_maxDatagramSize));
         // always write in a zero for the seq number to initialize the buffer
         *reinterpret_cast<int64_t*>(returnTask.m_buffer) = 0LL;
         --m_recvNeeded;
@@ -166,107 +168,128 @@ ctsIoPatternError ctsIoPatternMediaStreamClient::CompleteTaskBackToPattern(const
             return ctsIoPatternError::TooFewBytes;
         }
 
-        if (!ctsMediaStreamMessage::ValidateBufferLengthFromTask(task, completedBytes))
+        // with -UdpOffload a single receive can hold many datagrams coalesced by the stack
+        auto datagramStatus = ctsIoPatternError::NoError;
+        if (!ctsMediaStreamMessage::ForEachReceivedDatagram(
+            task,
+            completedBytes,
+            [&](const ctsTask& datagramTask, uint32_t datagramBytes) noexcept {
+                g_configSettings->UdpRecvDatagrams.Increment();
+                datagramStatus = CompleteReceivedDatagram(datagramTask, datagramBytes, qpc);
+                return ctsIoPatternError::NoError == datagramStatus;
+            }))
         {
-            ctsConfig::PrintErrorInfo(L"ctsIoPatternMediaStreamClient received an invalid datagram trying to parse the protocol header");
-            return ctsIoPatternError::TooFewBytes;
+            return datagramStatus;
         }
 
-        if (ctsMediaStreamMessage::GetProtocolHeaderFromTask(task) == c_udpDatagramProtocolHeaderFlagId)
-        {
-            // save off the connection ID when we receive it
-            ctsMediaStreamMessage::SetConnectionIdFromTask(GetConnectionIdentifier(), task);
-            // since a recv completed, will need to request another
-            ++m_recvNeeded;
-            return ctsIoPatternError::NoError;
-        }
+        // since a recv completed successfully, will need to request another
+        ++m_recvNeeded;
+    }
+    // else this is the completion of the SEND request
 
-        // validate the buffer contents
-        ctsTask validationTask(task);
-        validationTask.m_bufferOffset = c_udpDatagramDataHeaderLength; // skip the UdpDatagramDataHeaderLength since we use them for our own stuff
-        validationTask.m_bufferLength -= c_udpDatagramDataHeaderLength;
-        if (!VerifyBuffer(validationTask, completedBytes - c_udpDatagramDataHeaderLength))
-        {
-            // exit early if the buffers don't match
-            return ctsIoPatternError::CorruptedBytes;
-        }
+    return ctsIoPatternError::NoError;
+}
+
+// Processes a single datagram from a completed receive
+// - the task references the datagram at the start of its buffer
+//
+// _Requires_lock_held_(m_lock)
+ctsIoPatternError ctsIoPatternMediaStreamClient::CompleteReceivedDatagram(const ctsTask& task, uint32_t completedBytes, const LARGE_INTEGER& qpc) noexcept
+{
+    if (!ctsMediaStreamMessage::ValidateBufferLengthFromTask(task, completedBytes))
+    {
+        ctsConfig::PrintErrorInfo(L"ctsIoPatternMediaStreamClient received an invalid datagram trying to parse the protocol header");
+        return ctsIoPatternError::TooFewBytes;
+    }
+
+    if (ctsMediaStreamMessage::GetProtocolHeaderFromTask(task) == c_udpDatagramProtocolHeaderFlagId)
+    {
+        // save off the connection ID when we receive it
+        ctsMediaStreamMessage::SetConnectionIdFromTask(GetConnectionIdentifier(), task);
+        return ctsIoPatternError::NoError;
+    }
+
+    // validate the buffer contents
+    ctsTask validationTask(task);
+    validationTask.m_bufferOffset = c_udpDatagramDataHeaderLength; // skip the UdpDatagramDataHeaderLength since we use them for our own stuff
+    validationTask.m_bufferLength -= c_udpDatagramDataHeaderLength;
+    if (!VerifyBuffer(validationTask, completedBytes - c_udpDatagramDataHeaderLength))
+    {
+        // exit early if the buffers don't match
+        return ctsIoPatternError::CorruptedBytes;
+    }
 
-        // track the # of *bits* received
-        g_configSettings->UdpStatusDetails.m_bitsReceived.Add(completedBytes * 8LL);
-        m_statistics.m_bitsReceived.Add(completedBytes * 8LL);
+    // track the # of *bits* received
+    g_configSettings->UdpStatusDetails.m_bitsReceived.Add(completedBytes * 8LL);
+    m_statistics.m_bitsReceived.Add(completedBytes * 8LL);
 
-        const auto receivedSequenceNumber = ctsMediaStreamMessage::GetSequenceNumberFromTask(task);
-        if (receivedSequenceNumber > m_finalFrame)
+    const auto receivedSequenceNumber = ctsMediaStreamMessage::GetSequenceNumberFromTask(task);
+    if (receivedSequenceNumber > m_finalFrame)
+    {
+        g_configSettings->UdpStatusDetails.m_errorFrames.Increment();
+        m_statistics.m_errorFrames.Increment();
+
+        PRINT_DEBUG_INFO(
+            L"\t\tctsIOPatternMediaStreamClient received **an unknown** seq number (%lld) (outside the final frame %lld)\n",
+            receivedSequenceNumber,
+            m_finalFrame);
+    }
+    else
+    {
+        //
+        // search our circular queue (starting at the head_entry)
+        // for the seq number we just received, and if found, tag as received
+        //
+        const auto foundSlot = FindSequenceNumber(receivedSequenceNumber);
+        if (foundSlot != m_frameEntries.end())
         {
-            g_configSettings->UdpStatusDetails.m_errorFrames.Increment();
-            m_statistics.m_errorFrames.Increment();
+            const auto bufferedQpc = *reinterpret_cast<int64_t*>(task.m_buffer + 8);
+            const auto bufferedQpf = *reinterpret_cast<int64_t*>(task.m_buffer + 16);
+
+            // always overwrite qpc & qpf values with the latest datagram details
+            foundSlot->m_senderQpc = bufferedQpc;
+            foundSlot->m_senderQpf = bufferedQpf;
+            foundSlot->m_receiverQpc = qpc.QuadPart;
+            foundSlot->m_receiverQpf = ctl::ctTimer::snap_qpf();
+            foundSlot->m_bytesReceived += completedBytes;
 
             PRINT_DEBUG_INFO(
-                L"\t\tctsIOPatternMediaStreamClient received **an unknown** seq number (%lld) (outside the final frame %lld)\n",
-                receivedSequenceNumber,
-                m_finalFrame);
+                L"\t\tctsIOPatternMediaStreamClient received seq number %lld (%u received-bytes, %lld frame-bytes)\n",
+                foundSlot->m_sequenceNumber,
+                completedBytes,
+                foundSlot->m_bytesReceived);
+
+            // stop the timer once we receive the last frame
+            // - it's not perfect (e.g. might have received them out of order)
+            // - but it will be very close for tracking the total bits/sec
+            if (receivedSequenceNumber == m_finalFrame)
+            {
+                EndStatistics();
+            }
         }
         else
         {
-            //
-            // search our circular queue (starting at the head_entry)
-            // for the seq number we just received, and if found, tag as received
-            //
-            const auto foundSlot = FindSequenceNumber(receivedSequenceNumber);
-            if (foundSlot != m_frameEntries.end())
-            {
-                const auto bufferedQpc = *reinterpret_cast<int64_t*>(task.m_buffer + 8);
-                const auto bufferedQpf = *reinterpret_cast<int64_t*>(task.m_buffer + 16);
-
-                // always overwrite qpc & qpf values with the latest datagram details
-                foundSlot->m_senderQpc = bufferedQpc;
-                foundSlot->m_senderQpf = bufferedQpf;
-                foundSlot->m_receiverQpc = qpc.QuadPart;
-                foundSlot->m_receiverQpf = ctl::ctTimer::snap_qpf();
-                foundSlot->m_bytesReceived += completedBytes;
+            // didn't find a slot for the received seq. number
+            g_configSettings->UdpStatusDetails.m_errorFrames.Increment();
+            m_statistics.m_errorFrames.Increment();
 
+            if (receivedSequenceNumber < m_headEntry->m_sequenceNumber)
+            {
                 PRINT_DEBUG_INFO(
-                    L"\t\tctsIOPatternMediaStreamClient received seq number %lld (%u received-bytes, %lld frame-bytes)\n",
-                    foundSlot->m_sequenceNumber,
-                    completedBytes,
-                    foundSlot->m_bytesReceived);
-
-                // stop the timer once we receive the last frame
-                // - it's not perfect (e.g. might have received them out of order)
-                // - but it will be very close for tracking the total bits/sec
-                if (receivedSequenceNumber == m_finalFrame)
-                {
-                    EndStatistics();
-                }
+                    L"\t\tctsIOPatternMediaStreamClient received **a stale** seq number (%lld) - current seq number (%lld)\n",
+                    receivedSequenceNumber,
+                    m_headEntry->m_sequenceNumber);
             }
             else
             {
-                // didn't find a slot for the received seq. number
-                g_configSettings->UdpStatusDetails.m_errorFrames.Increment();
-                m_statistics.m_errorFrames.Increment();
-
-                if (receivedSequenceNumber < m_headEntry->m_sequenceNumber)
-                {
-                    PRINT_DEBUG_INFO(
-                        L"\t\tctsIOPatternMediaStreamClient received **a stale** seq number (%lld) - current seq number (%lld)\n",
-                        receivedSequenceNumber,
-                        m_headEntry->m_sequenceNumber);
-                }
-                else
-                {
-                    PRINT_DEBUG_INFO(
-                        L"\t\tctsIOPatternMediaStreamClient received **a future** seq number (%lld) - head of queue (%lld) tail of queue (%llu)\n",
-                        receivedSequenceNumber,
-                        m_headEntry->m_sequenceNumber,
-                        m_headEntry->m_sequenceNumber + m_frameEntries.size() - 1);
-                }
+                PRINT_DEBUG_INFO(
+                    L"\t\tctsIOPatternMediaStreamClient received **a future** seq number (%lld) - head of queue (%lld) tail of queue (%llu)\n",
+                    receivedSequenceNumber,
+                    m_headEntry->m_sequenceNumber,
+                    m_headEntry->m_sequenceNumber + m_frameEntries.size() - 1);
             }
         }
-
-        // since a recv completed successfully, will need to request another
-        ++m_recvNeeded;
     }
-    // else this is the completion of the SEND request
 
     return ctsIoPatternError::NoError;
 }
@@ -392,6 +415,13 @@ void ctsIoPatternMediaStreamClient::RenderFrame() noexcept
         // Directly write this status update if jitter is enabled
         PrintJitterUpdate(*m_headEntry, m_previousFrame);
 
+        // track the change in time in flight from the previously rendered frame
+        if (m_previousFrame.m_receiverQpf != 0)
+        {
+            g_configSettings->UdpFrameJitterUsec.Add(static_cast<int64_t>(
+                std::abs(m_previousFrame.m_estimatedTimeInFlightMs - m_headEntry->m_estimatedTimeInFlightMs) * 1000.0));
+        }
+
         // if this is the first frame, capture it
         if (m_firstFrame.m_receiverQpc == 0)
         {
@@ -32,6 +32,8 @@ enum class ctsIoPatternType : std::int8_t
     MoreIo,
     SendCompletion,
     RecvCompletion,
+    SendNextTransfer,
+    RecvNextTransfer,
     GracefulShutdown,
     HardShutdown,
     RequestFin
@@ -57,6 +59,10 @@ class ctsIoPatternState
         ClientRecvConnectionId,
         ServerSendCompletion,
         ClientRecvCompletion,
+        // -TransfersPerConnection: the client starts each transfer after the first by sending the connection id back
+        NextTransfer,
+        ClientSendNextTransfer,
+        ServerRecvNextTransfer,
         CompletedTransfer,
         ErrorIoFailed,
 
@@ -79,10 +85,18 @@ class ctsIoPatternState
                                   ctsConfig::GetMaxBufferSize() :
                                   ctsConfig::GetMaxBufferSize() * ctsConfig::g_configSettings->PrePostSends;
 
+    // -TransfersPerConnection: transfers of m_maxTransfer bytes run on the connection before it's shut down
+    uint32_t m_transfersPerConnection = ctsConfig::g_configSettings->TransfersPerConnection;
+    uint32_t m_completedTransfers = 0;
+
     InternalPatternState m_internalState = InternalPatternState::Initialized;
     // track if waiting for the prior state to complete
     bool m_pendedState = false;
 
+    // the completion message was exchanged for the current transfer
+    // - returns true if another transfer follows it on this connection
+    bool CompletedTransferOnConnection() noexcept;
+
 public:
     ctsIoPatternState() noexcept;
 
@@ -96,6 +110,11 @@ public:
 
     [[nodiscard]] bool IsCompleted() const noexcept;
 
+    // the transfers which have exchanged their completion message
+    [[nodiscard]] uint32_t GetCompletedTransfers() const noexcept;
+    // the current transfer is the last on this connection
+    [[nodiscard]] bool IsFinalTransfer() const noexcept;
+
     [[nodiscard]] bool IsCurrentStateMoreIo() const noexcept;
     ctsIoPatternType GetNextPatternType() noexcept;
     void NotifyNextTask(const ctsTask& nextTask) noexcept;
@@ -162,6 +181,29 @@ inline bool ctsIoPatternState::IsCompleted() const noexcept
     return InternalPatternState::CompletedTransfer == m_internalState || InternalPatternState::ErrorIoFailed == m_internalState;
 }
 
+inline uint32_t ctsIoPatternState::GetCompletedTransfers() const noexcept
+{
+    return m_completedTransfers;
+}
+
+inline bool ctsIoPatternState::IsFinalTransfer() const noexcept
+{
+    return m_completedTransfers + 1 >= m_transfersPerConnection;
+}
+
+inline bool ctsIoPatternState::CompletedTransferOnConnection() noexcept
+{
+    ++m_completedTransfers;
+    if (m_completedTransfers >= m_transfersPerConnection)
+    {
+        return false;
+    }
+
+    // the next transfer starts counting from zero: all IO for this transfer has completed
+    m_confirmedBytes = 0;
+    return true;
+}
+
 inline bool ctsIoPatternState::IsCurrentStateMoreIo() const noexcept
 {
     return m_internalState == InternalPatternState::MoreIo;
@@ -193,9 +235,28 @@ inline ctsIoPatternType ctsIoPatternState::GetNextPatternType() noexcept
             return ctsIoPatternType::RecvConnectionId;
         }
 
+        case InternalPatternState::NextTransfer:
+        {
+            if (ctsConfig::IsListening())
+            {
+                PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::GetNextPatternType : RecvNextTransfer\n");
+                m_pendedState = true;
+                m_internalState = InternalPatternState::ServerRecvNextTransfer;
+                return ctsIoPatternType::RecvNextTransfer;
+            }
+
+            PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::GetNextPatternType : SendNextTransfer\n");
+            m_pendedState = true;
+            m_internalState = InternalPatternState::ClientSendNextTransfer;
+            return ctsIoPatternType::SendNextTransfer;
+        }
+
         // both client and server start IO after the connection ID is shared
+        // - and start each transfer after the first once the client has sent it back
         case InternalPatternState::ServerSendConnectionId:
         case InternalPatternState::ClientRecvConnectionId:
+        case InternalPatternState::ClientSendNextTransfer:
+        case InternalPatternState::ServerRecvNextTransfer:
             PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::GetNextPatternType : MoreIo\n");
             m_internalState = InternalPatternState::MoreIo;
             return ctsIoPatternType::MoreIo;
@@ -302,7 +363,8 @@ inline ctsIoPatternError ctsIoPatternState::CompletedTask(const ctsTask& complet
 
     // if completed our connection id request, immediately return
     // (not validating IO below)
-    if (InternalPatternState::ServerSendConnectionId == m_internalState || InternalPatternState::ClientRecvConnectionId == m_internalState)
+    if (InternalPatternState::ServerSendConnectionId == m_internalState || InternalPatternState::ClientRecvConnectionId == m_internalState ||
+        InternalPatternState::ClientSendNextTransfer == m_internalState || InternalPatternState::ServerRecvNextTransfer == m_internalState)
     {
         // must have received the full id
         if (completedTransferBytes != ctsStatistics::ConnectionIdLength)
@@ -389,6 +451,14 @@ inline ctsIoPatternError ctsIoPatternState::CompletedTask(const ctsTask& complet
                         break;
 
                     case InternalPatternState::ServerSendCompletion:
+                        if (CompletedTransferOnConnection())
+                        {
+                            PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::CompletedTask (ServerSendCompletion) : NextTransfer\n");
+                            m_internalState = InternalPatternState::NextTransfer;
+                            m_pendedState = false;
+                            break;
+                        }
+
                         PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::CompletedTask (ServerSendCompletion) : RequestFIN\n");
                         m_internalState = InternalPatternState::RequestFin;
                         m_pendedState = false;
@@ -444,7 +514,13 @@ inline ctsIoPatternError ctsIoPatternState::CompletedTask(const ctsTask& complet
                             return ctsIoPatternError::TooFewBytes;
                         }
 
-                        if (ctsConfig::TcpShutdownType::GracefulShutdown == ctsConfig::GetShutdownType())
+                        if (CompletedTransferOnConnection())
+                        {
+                            PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::CompletedTask (ClientRecvCompletion) : NextTransfer\n");
+                            m_internalState = InternalPatternState::NextTransfer;
+                            m_pendedState = false;
+                        }
+                        else if (ctsConfig::TcpShutdownType::GracefulShutdown == ctsConfig::GetShutdownType())
                         {
                             PRINT_DEBUG_INFO(L"\t\tctsIOPatternState::CompletedTask (ClientRecvCompletion) : GracefulShutdown\n");
                             m_internalState = InternalPatternState::GracefulShutdown;
@@ -42,7 +42,12 @@ struct ctsTask
     _Field_size_full_(m_bufferLength) char* m_buffer = nullptr;
     uint32_t m_bufferLength = 0UL;
     uint32_t m_bufferOffset = 0UL;
+    // (RIO) the offset of m_buffer within the memory registered as m_rioBufferid
+    uint32_t m_rioBufferOffset = 0UL;
     uint32_t m_expectedPatternOffset = 0UL;
+    // (UDP) the size of each datagram when the stack coalesced datagrams into this receive (URO)
+    // - zero when the receive holds a single datagram
+    uint32_t m_coalescedSegmentSize = 0UL;
     ctsTaskAction m_ioAction = ctsTaskAction::None;
 
     // (internal) flag identifying the type of buffer
@@ -0,0 +1,142 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+// - nor any OS headers: this header is portable, so the allocator can be tested on any platform
+
+namespace ctsTraffic
+{
+//
+// ctsLocalPortAllocator
+//
+// Hands out the ports of a -LocalPort:[low,high] range for one local address without a lock
+// - a bitmap tracks which ports are free: allocating is a scan for a set bit and one compare-exchange to clear it,
+//   so a nearly exhausted range costs a scan of the bitmap words rather than a failed bind per port in use
+// - each free port carries when it can be bound again, so a port released into TIME_WAIT isn't handed out until it has left it
+// - each allocation starts scanning from the word after the previous one, spreading connections across the range
+// - times are microseconds on the caller's clock; safe to call from any number of threads
+//
+class ctsLocalPortAllocator
+{
+public:
+    static constexpr uint32_t c_portsPerWord = 64;
+
+    // lowPort through highPort inclusive - every port starts free
+    ctsLocalPortAllocator(uint16_t lowPort, uint16_t highPort) :
+        m_lowPort(lowPort),
+        m_portCount(highPort >= lowPort ? static_cast<uint32_t>(highPort - lowPort) + 1 : 0),
+        m_wordCount((m_portCount + c_portsPerWord - 1) / c_portsPerWord),
+        m_freePorts(std::make_unique<std::atomic<uint64_t>[]>(m_wordCount)),
+        m_reusableAtUsec(std::make_unique<std::atomic<int64_t>[]>(m_portCount))
+    {
+        for (uint32_t word = 0; word < m_wordCount; ++word)
+        {
+            const auto portsInWord = std::min(c_portsPerWord, m_portCount - word * c_portsPerWord);
+            m_freePorts[word].store(portsInWord == c_portsPerWord ? ~uint64_t{0} : (uint64_t{1} << portsInWord) - 1, std::memory_order_relaxed);
+        }
+        for (uint32_t port = 0; port < m_portCount; ++port)
+        {
+            m_reusableAtUsec[port].store(INT64_MIN, std::memory_order_relaxed);
+        }
+    }
+
+    // returns 0 when every port is in use, or still held in TIME_WAIT at nowUsec
+    uint16_t Allocate(int64_t nowUsec) noexcept
+    {
+        if (0 == m_wordCount)
+        {
+            return 0;
+        }
+
+        const auto startWord = m_nextWord.fetch_add(1, std::memory_order_relaxed);
+        for (uint32_t scanned = 0; scanned < m_wordCount; ++scanned)
+        {
+            const auto wordIndex = (startWord + scanned) % m_wordCount;
+            auto& word = m_freePorts[wordIndex];
+            auto freeBits = word.load(std::memory_order_acquire);
+            auto candidates = freeBits;
+            while (candidates != 0)
+            {
+                const auto bit = static_cast<uint32_t>(std::countr_zero(candidates));
+                const auto mask = uint64_t{1} << bit;
+                const auto portIndex = wordIndex * c_portsPerWord + bit;
+                if (m_reusableAtUsec[portIndex].load(std::memory_order_relaxed) > nowUsec)
+                {
+                    // free, but TCP still holds it in TIME_WAIT
+                    candidates &= ~mask;
+                    continue;
+                }
+                if (word.compare_exchange_weak(freeBits, freeBits & ~mask, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    return static_cast<uint16_t>(m_lowPort + portIndex);
+                }
+                // another thread took or returned a port in this word - try those still free
+                candidates &= freeBits;
+            }
+        }
+        return 0;
+    }
+
+    // returns an allocated port, which can be allocated again once nowUsec reaches reusableAtUsec
+    void Release(uint16_t port, int64_t reusableAtUsec) noexcept
+    {
+        const auto portIndex = static_cast<uint32_t>(port - m_lowPort);
+        if (port < m_lowPort || portIndex >= m_portCount)
+        {
+            return;
+        }
+
+        // the time must be visible before the bit: Allocate reads the time only after seeing the port free
+        m_reusableAtUsec[portIndex].store(reusableAtUsec, std::memory_order_relaxed);
+        m_freePorts[portIndex / c_portsPerWord].fetch_or(uint64_t{1} << (portIndex % c_portsPerWord), std::memory_order_release);
+    }
+
+    // the ports not allocated, including those still held in TIME_WAIT
+    [[nodiscard]] uint32_t GetFreeCount() const noexcept
+    {
+        uint32_t freeCount = 0;
+        for (uint32_t word = 0; word < m_wordCount; ++word)
+        {
+            freeCount += static_cast<uint32_t>(std::popcount(m_freePorts[word].load(std::memory_order_relaxed)));
+        }
+        return freeCount;
+    }
+
+    [[nodiscard]] uint32_t GetPortCount() const noexcept
+    {
+        return m_portCount;
+    }
+
+    ctsLocalPortAllocator(const ctsLocalPortAllocator&) = delete;
+    ctsLocalPortAllocator& operator=(const ctsLocalPortAllocator&) = delete;
+    ctsLocalPortAllocator(ctsLocalPortAllocator&&) = delete;
+    ctsLocalPortAllocator& operator=(ctsLocalPortAllocator&&) = delete;
+
+private:
+    const uint16_t m_lowPort;
+    const uint32_t m_portCount;
+    const uint32_t m_wordCount;
+    // a set bit is a free port
+    const std::unique_ptr<std::atomic<uint64_t>[]> m_freePorts;
+    const std::unique_ptr<std::atomic<int64_t>[]> m_reusableAtUsec;
+    std::atomic<uint32_t> m_nextWord{0};
+};
+} // namespace ctsTraffic
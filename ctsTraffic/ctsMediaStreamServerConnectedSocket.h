@@ -15,6 +15,7 @@ See the Apache Version 2.0 License for specific language governing permissions a
 
 // cpp headers
 #include <memory>
+#include <vector>
 // os headers
 #include <Windows.h>
 // project headers
@@ -36,6 +37,8 @@ private:
     // the CS is mutable, so we can take a lock / release a lock in const methods
     mutable wil::critical_section m_objectGuard{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
     _Guarded_by_(m_objectGuard) ctsTask m_nextTask;
+    // -UdpOffload: the datagrams of the next frame laid out back-to-back for a segmented send
+    _Guarded_by_(m_objectGuard) std::vector<char> m_segmentedSendBuffer;
 
     wil::unique_threadpool_timer m_taskTimer{};
 
@@ -85,6 +88,12 @@ public:
         return m_nextTask;
     }
 
+    // only called from the IO functor, which is invoked while holding m_objectGuard
+    std::vector<char>& GetSegmentedSendBuffer() noexcept
+    {
+        return m_segmentedSendBuffer;
+    }
+
     int64_t IncrementSequence() noexcept
     {
         return InterlockedIncrement64(&m_sequenceNumber);
@@ -16,6 +16,7 @@ See the Apache Version 2.0 License for specific language governing permissions a
 // cpp headers
 #include <array>
 #include <memory>
+#include <vector>
 // os headers
 #include <Windows.h>
 // ctl headers
@@ -43,15 +44,21 @@ private:
 
 	const wil::network::socket_address m_listeningAddr;
 
-    std::array<char, c_recvBufferSize> m_recvBuffer{};
-    DWORD m_recvFlags{};
+    // each receive kept posted on the listening socket (-DatagramBatchSize) has its own buffer and remote address
+    struct RecvContext
+    {
+        std::array<char, c_recvBufferSize> m_recvBuffer{};
+        DWORD m_recvFlags{};
 
-    wil::network::socket_address m_remoteAddr;
-    int m_remoteAddrLen{};
+        wil::network::socket_address m_remoteAddr;
+        int m_remoteAddrLen{};
+    };
+    std::vector<RecvContext> m_recvContexts;
 
     bool m_priorFailureWasConnectionReset = false;
 
-    void RecvCompletion(OVERLAPPED* pOverlapped) noexcept;
+    void InitiateRecv(RecvContext& recvContext) noexcept;
+    void RecvCompletion(RecvContext& recvContext, OVERLAPPED* pOverlapped) noexcept;
 
 public:
     // increment the per-listener accepted connection count
@@ -62,7 +69,7 @@ public:
     ctsMediaStreamServerListeningSocket(
         wil::unique_socket&& listeningSocket,
         const wil::network::socket_address& listeningAddr,
-        std::shared_ptr<ctl::ctThreadIocp_base> threadIocp) noexcept;
+        std::shared_ptr<ctl::ctThreadIocp_base> threadIocp);
 
     ~ctsMediaStreamServerListeningSocket() noexcept;
 
@@ -70,6 +77,7 @@ public:
 
     wil::network::socket_address GetListeningAddress() const noexcept;
 
+    // posts all receives on the listening socket
     void InitiateRecv() noexcept;
 
     // non-copyable
@@ -0,0 +1,108 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+// - nor any OS headers: this header is portable, so the cache can be tested on any platform
+
+namespace ctsTraffic
+{
+//
+// ctsNameCache
+//
+// Caches the addresses -conn:ConnectByName resolves each target name to
+// - a resolution is kept for the TTL of the records it came from: connections within the TTL don't resolve again
+// - connections looking up a name while it's being resolved wait for that resolution rather than starting another
+// - a failed resolution is kept for c_failedResolutionUsec, so connections to a failing name don't each query it
+// - Waiter is whatever the caller needs to continue a connection once its name is resolved
+// - times are microseconds on the caller's clock
+// - not thread-safe: callers serialize calls with their own lock
+//
+template <typename Address, typename Waiter>
+class ctsNameCache
+{
+public:
+    static constexpr int64_t c_failedResolutionUsec = 1'000'000;
+
+    struct Resolution
+    {
+        std::vector<Address> Addresses;
+        uint32_t Error = 0;
+    };
+
+    enum class LookupResult : std::uint8_t
+    {
+        // the cached resolution was returned: the waiter was not queued
+        Hit,
+        // the waiter was queued behind the resolution already in flight
+        Coalesced,
+        // the waiter was queued: the caller must resolve the name, then call Complete
+        Resolve
+    };
+
+    LookupResult Lookup(const std::wstring& name, int64_t nowUsec, Waiter&& waiter, Resolution& resolution)
+    {
+        auto& entry = m_entries[name];
+        if (entry.m_resolving)
+        {
+            entry.m_waiters.push_back(std::move(waiter));
+            return LookupResult::Coalesced;
+        }
+        if (entry.m_resolved && nowUsec < entry.m_expiresUsec)
+        {
+            resolution = entry.m_resolution;
+            return LookupResult::Hit;
+        }
+
+        entry.m_waiters.push_back(std::move(waiter));
+        entry.m_resolving = true;
+        return LookupResult::Resolve;
+    }
+
+    // returns the waiters queued on the name: the caller continues them with the resolution outside its lock
+    std::vector<Waiter> Complete(const std::wstring& name, int64_t nowUsec, Resolution&& resolution, int64_t ttlUsec) noexcept
+    {
+        const auto foundEntry = m_entries.find(name);
+        if (foundEntry == m_entries.end())
+        {
+            return {};
+        }
+
+        auto& entry = foundEntry->second;
+        entry.m_expiresUsec = nowUsec + (resolution.Error != 0 ? c_failedResolutionUsec : ttlUsec);
+        entry.m_resolution = std::move(resolution);
+        entry.m_resolved = true;
+        entry.m_resolving = false;
+        return std::exchange(entry.m_waiters, {});
+    }
+
+private:
+    struct Entry
+    {
+        Resolution m_resolution;
+        std::vector<Waiter> m_waiters;
+        int64_t m_expiresUsec = 0;
+        bool m_resolved = false;
+        bool m_resolving = false;
+    };
+
+    std::unordered_map<std::wstring, Entry> m_entries;
+};
+} // namespace ctsTraffic
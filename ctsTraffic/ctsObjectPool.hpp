@@ -0,0 +1,551 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+// os headers
+#include <Windows.h>
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+
+namespace ctsTraffic
+{
+//
+// Pools recycling the objects every connection creates and destroys
+// - ctsSocketState, ctsSocket and ctsIoPattern are allocated through ctsPoolAllocator
+//   so std::allocate_shared reuses the memory blocks (object + control block) of closed connections
+// - receive buffers are recycled through ctsRecycledBuffers instead of allocated and zero-filled
+// - threadpool work objects are recycled through ctsPooledThreadpoolWork
+//
+// Each pool keeps a bounded number of free objects
+// - objects released beyond that bound are freed, so memory is only reclaimed as the load shrinks
+//
+// The block and buffer pools keep a free list per thread, backed by a process-wide overflow list
+// - a connection is often closed on a different thread than the one which created it, so a thread only
+//   freeing objects would fill its own list and never reuse them: what it frees past its own bound
+//   goes to the overflow list, where threads whose own list is empty take them from
+//
+
+//
+// ctsObjectPoolStatistics
+//
+// Process-wide counts of what the pools had to allocate and what they could reuse
+//
+class ctsObjectPoolStatistics
+{
+public:
+    static void HeapAllocation() noexcept
+    {
+        s_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void Reused() noexcept
+    {
+        s_reused.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static int64_t GetHeapAllocations() noexcept
+    {
+        return s_heapAllocations.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static int64_t GetReused() noexcept
+    {
+        return s_reused.load(std::memory_order_relaxed);
+    }
+
+    static void Reset() noexcept
+    {
+        s_heapAllocations = 0;
+        s_reused = 0;
+    }
+
+private:
+    inline static std::atomic<int64_t> s_heapAllocations{0};
+    inline static std::atomic<int64_t> s_reused{0};
+};
+
+//
+// ctsPooledBlocks
+//
+// Per-thread free lists of memory blocks of one size
+// - a block freed on a different thread than it was allocated on joins the freeing thread's list
+// - once a thread's list is full, half of it moves to the overflow list in one chain,
+//   and a thread whose list is empty takes up to that many back, so the overflow lock is taken once per batch
+// - the free lists are intrusive: a free block stores the pointer to the next free block
+//
+template <size_t BlockSize>
+class ctsPooledBlocks
+{
+public:
+    static constexpr uint32_t c_maxFreeBlocks = 1024;
+    static constexpr uint32_t c_transferBlocks = c_maxFreeBlocks / 2;
+    static constexpr uint32_t c_maxOverflowBlocks = c_maxFreeBlocks * 16;
+
+    [[nodiscard]] static void* Allocate()
+    {
+        auto& freeList = t_freeList;
+        if (!freeList.m_head)
+        {
+            TakeOverflow(freeList);
+        }
+        if (freeList.m_head)
+        {
+            auto* const block = freeList.m_head;
+            freeList.m_head = block->m_next;
+            --freeList.m_count;
+            ctsObjectPoolStatistics::Reused();
+            return block;
+        }
+
+        auto* const block = ::operator new(c_allocationSize);
+        ctsObjectPoolStatistics::HeapAllocation();
+        return block;
+    }
+
+    static void Free(_In_ void* block) noexcept
+    {
+        auto& freeList = t_freeList;
+        if (freeList.m_count >= c_maxFreeBlocks)
+        {
+            GiveOverflow(freeList);
+        }
+
+        auto* const freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->m_next = freeList.m_head;
+        freeList.m_head = freeBlock;
+        ++freeList.m_count;
+    }
+
+    // the free blocks of the calling thread
+    [[nodiscard]] static uint32_t GetFreeCount() noexcept
+    {
+        return t_freeList.m_count;
+    }
+
+    [[nodiscard]] static uint32_t GetOverflowCount() noexcept
+    {
+        auto& overflow = GetOverflow();
+        const auto lock = overflow.m_lock.lock();
+        return overflow.m_count;
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* m_next;
+    };
+
+    struct Overflow
+    {
+        wil::critical_section m_lock{200};
+        _Guarded_by_(m_lock) FreeBlock* m_head = nullptr;
+        _Guarded_by_(m_lock) uint32_t m_count = 0;
+    };
+
+    static constexpr size_t c_allocationSize = BlockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : BlockSize;
+
+    struct FreeList
+    {
+        FreeBlock* m_head = nullptr;
+        uint32_t m_count = 0;
+
+        FreeList() = default;
+        ~FreeList() noexcept
+        {
+            while (m_head)
+            {
+                auto* const next = m_head->m_next;
+                ::operator delete(m_head);
+                m_head = next;
+            }
+        }
+
+        FreeList(const FreeList&) = delete;
+        FreeList& operator=(const FreeList&) = delete;
+        FreeList(FreeList&&) = delete;
+        FreeList& operator=(FreeList&&) = delete;
+    };
+
+    inline static thread_local FreeList t_freeList;
+
+    static Overflow& GetOverflow() noexcept
+    {
+        // never destroyed: threads can still be freeing blocks as the process exits
+        static auto* const overflow = new Overflow;
+        return *overflow;
+    }
+
+    // moves c_transferBlocks from the full list to the overflow list - or back to the heap, if that is full too
+    static void GiveOverflow(FreeList& freeList) noexcept
+    {
+        auto* const chainHead = freeList.m_head;
+        auto* chainTail = chainHead;
+        for (uint32_t count = 1; count < c_transferBlocks; ++count)
+        {
+            chainTail = chainTail->m_next;
+        }
+        freeList.m_head = chainTail->m_next;
+        freeList.m_count -= c_transferBlocks;
+
+        {
+            auto& overflow = GetOverflow();
+            const auto lock = overflow.m_lock.lock();
+            if (overflow.m_count + c_transferBlocks <= c_maxOverflowBlocks)
+            {
+                chainTail->m_next = overflow.m_head;
+                overflow.m_head = chainHead;
+                overflow.m_count += c_transferBlocks;
+                return;
+            }
+        }
+
+        chainTail->m_next = nullptr;
+        for (auto* block = chainHead; block != nullptr;)
+        {
+            auto* const next = block->m_next;
+            ::operator delete(block);
+            block = next;
+        }
+    }
+
+    // moves up to c_transferBlocks from the overflow list to the empty list
+    static void TakeOverflow(FreeList& freeList) noexcept
+    {
+        auto& overflow = GetOverflow();
+        const auto lock = overflow.m_lock.lock();
+        if (!overflow.m_head)
+        {
+            return;
+        }
+
+        auto* const chainHead = overflow.m_head;
+        auto* chainTail = chainHead;
+        uint32_t count = 1;
+        while (count < c_transferBlocks && chainTail->m_next)
+        {
+            chainTail = chainTail->m_next;
+            ++count;
+        }
+        overflow.m_head = chainTail->m_next;
+        overflow.m_count -= count;
+
+        chainTail->m_next = nullptr;
+        freeList.m_head = chainHead;
+        freeList.m_count = count;
+    }
+};
+
+//
+// ctsPoolAllocator
+//
+// Allocator for std::allocate_shared, taking single objects from ctsPooledBlocks
+// - allocate_shared rebinds it to its control block type, so the object and its control block
+//   come from the one pooled block
+//
+template <typename T>
+class ctsPoolAllocator
+{
+public:
+    using value_type = T;
+
+    ctsPoolAllocator() noexcept = default;
+
+    template <typename U>
+    // ReSharper disable once CppNonExplicitConvertingConstructor
+    ctsPoolAllocator(const ctsPoolAllocator<U>&) noexcept
+    {
+    }
+
+    [[nodiscard]] T* allocate(size_t count)
+    {
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "ctsPoolAllocator does not support over-aligned types");
+        if (count != 1)
+        {
+            return std::allocator<T>{}.allocate(count);
+        }
+        return static_cast<T*>(ctsPooledBlocks<sizeof(T)>::Allocate());
+    }
+
+    void deallocate(_In_ T* object, size_t count) noexcept
+    {
+        if (count != 1)
+        {
+            std::allocator<T>{}.deallocate(object, count);
+            return;
+        }
+        ctsPooledBlocks<sizeof(T)>::Free(object);
+    }
+
+    template <typename U>
+    bool operator==(const ctsPoolAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+};
+
+//
+// ctsRecycledBuffers
+//
+// Per-thread lists of byte buffers returned by closed connections
+// - Acquire returns a buffer of exactly the requested size: a recycled buffer keeps the bytes
+//   last written to it, so callers must not depend on its contents
+// - buffers released once the thread's list is full go to the overflow list,
+//   which Acquire searches when the thread's own list has no buffer of the size
+//
+class ctsRecycledBuffers
+{
+public:
+    static constexpr size_t c_maxFreeBuffers = 64;
+    static constexpr size_t c_maxOverflowBuffers = c_maxFreeBuffers * 16;
+
+    [[nodiscard]] static std::vector<char> Acquire(size_t byteCount)
+    {
+        std::vector<char> returnBuffer;
+        if (TakeBuffer(t_freeBuffers, byteCount, returnBuffer))
+        {
+            ctsObjectPoolStatistics::Reused();
+            return returnBuffer;
+        }
+
+        {
+            auto& overflow = GetOverflow();
+            const auto lock = overflow.m_lock.lock();
+            if (TakeBuffer(overflow.m_freeBuffers, byteCount, returnBuffer))
+            {
+                ctsObjectPoolStatistics::Reused();
+                return returnBuffer;
+            }
+        }
+
+        returnBuffer.resize(byteCount);
+        ctsObjectPoolStatistics::HeapAllocation();
+        return returnBuffer;
+    }
+
+    static void Release(std::vector<char>&& buffer) noexcept
+    {
+        if (buffer.empty())
+        {
+            return;
+        }
+
+        try
+        {
+            auto& freeBuffers = t_freeBuffers;
+            if (freeBuffers.size() < c_maxFreeBuffers)
+            {
+                freeBuffers.emplace_back(std::move(buffer));
+                return;
+            }
+
+            auto& overflow = GetOverflow();
+            const auto lock = overflow.m_lock.lock();
+            if (overflow.m_freeBuffers.size() < c_maxOverflowBuffers)
+            {
+                overflow.m_freeBuffers.emplace_back(std::move(buffer));
+            }
+        }
+        catch (...)
+        {
+            // the buffer is freed with the caller's vector
+        }
+    }
+
+    // the free buffers of the calling thread
+    [[nodiscard]] static size_t GetFreeCount() noexcept
+    {
+        return t_freeBuffers.size();
+    }
+
+    [[nodiscard]] static size_t GetOverflowCount() noexcept
+    {
+        auto& overflow = GetOverflow();
+        const auto lock = overflow.m_lock.lock();
+        return overflow.m_freeBuffers.size();
+    }
+
+private:
+    struct Overflow
+    {
+        wil::critical_section m_lock{200};
+        _Guarded_by_(m_lock) std::vector<std::vector<char>> m_freeBuffers;
+    };
+
+    inline static thread_local std::vector<std::vector<char>> t_freeBuffers;
+
+    static Overflow& GetOverflow() noexcept
+    {
+        // never destroyed: threads can still be releasing buffers as the process exits
+        static auto* const overflow = new Overflow;
+        return *overflow;
+    }
+
+    static bool TakeBuffer(std::vector<std::vector<char>>& freeBuffers, size_t byteCount, std::vector<char>& takenBuffer) noexcept
+    {
+        for (auto freeBuffer = freeBuffers.rbegin(); freeBuffer != freeBuffers.rend(); ++freeBuffer)
+        {
+            if (freeBuffer->size() == byteCount)
+            {
+                takenBuffer = std::move(*freeBuffer);
+                freeBuffers.erase(std::next(freeBuffer).base());
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+//
+// ctsPooledThreadpoolWork
+//
+// Owns a threadpool work object for the lifetime of this instance, taken from a process-wide pool
+// - the PTP_WORK is created with a trampoline callback whose context is the pool entry,
+//   so the same PTP_WORK can be handed to a new owner with a new callback and context
+// - the destructor waits for all callbacks (canceling those not yet started), as wil::unique_threadpool_work does,
+//   then returns the work object to the pool
+//
+class ctsPooledThreadpoolWork
+{
+public:
+    static constexpr size_t c_maxFreeWork = 1024;
+
+    ctsPooledThreadpoolWork() noexcept = default;
+
+    // can throw under low resource conditions
+    ctsPooledThreadpoolWork(PTP_WORK_CALLBACK callback, _In_opt_ PVOID context, _In_opt_ PTP_CALLBACK_ENVIRON environment)
+    {
+        m_entry = TakeEntry(environment);
+        if (!m_entry)
+        {
+            m_entry = std::make_unique<WorkEntry>();
+            m_entry->m_environment = environment;
+            m_entry->m_work.reset(CreateThreadpoolWork(WorkCallback, m_entry.get(), environment));
+            THROW_LAST_ERROR_IF_NULL(m_entry->m_work.get());
+            ctsObjectPoolStatistics::HeapAllocation();
+        }
+        else
+        {
+            ctsObjectPoolStatistics::Reused();
+        }
+        m_entry->m_callback = callback;
+        m_entry->m_context = context;
+    }
+
+    ~ctsPooledThreadpoolWork() noexcept
+    {
+        reset();
+    }
+
+    [[nodiscard]] PTP_WORK get() const noexcept
+    {
+        return m_entry ? m_entry->m_work.get() : nullptr;
+    }
+
+    void reset() noexcept
+    {
+        if (m_entry)
+        {
+            WaitForThreadpoolWorkCallbacks(m_entry->m_work.get(), TRUE);
+            ReturnEntry(std::move(m_entry));
+        }
+    }
+
+    ctsPooledThreadpoolWork(const ctsPooledThreadpoolWork&) = delete;
+    ctsPooledThreadpoolWork& operator=(const ctsPooledThreadpoolWork&) = delete;
+    ctsPooledThreadpoolWork(ctsPooledThreadpoolWork&&) = delete;
+    ctsPooledThreadpoolWork& operator=(ctsPooledThreadpoolWork&&) = delete;
+
+private:
+    struct WorkEntry
+    {
+        wil::unique_threadpool_work_nowait m_work;
+        PTP_CALLBACK_ENVIRON m_environment = nullptr;
+        PTP_WORK_CALLBACK m_callback = nullptr;
+        PVOID m_context = nullptr;
+    };
+
+    struct WorkPool
+    {
+        wil::critical_section m_lock{200};
+        _Guarded_by_(m_lock) std::vector<std::unique_ptr<WorkEntry>> m_freeWork;
+    };
+
+    std::unique_ptr<WorkEntry> m_entry;
+
+    static WorkPool& GetWorkPool() noexcept
+    {
+        // never destroyed: threadpool objects must not be closed while the process is exiting
+        static auto* const workPool = new WorkPool;
+        return *workPool;
+    }
+
+    static std::unique_ptr<WorkEntry> TakeEntry(PTP_CALLBACK_ENVIRON environment) noexcept
+    {
+        auto& workPool = GetWorkPool();
+        const auto lock = workPool.m_lock.lock();
+        for (auto freeWork = workPool.m_freeWork.rbegin(); freeWork != workPool.m_freeWork.rend(); ++freeWork)
+        {
+            if ((*freeWork)->m_environment == environment)
+            {
+                auto returnEntry = std::move(*freeWork);
+                workPool.m_freeWork.erase(std::next(freeWork).base());
+                return returnEntry;
+            }
+        }
+        return nullptr;
+    }
+
+    static void ReturnEntry(std::unique_ptr<WorkEntry> entry) noexcept
+    {
+        entry->m_callback = nullptr;
+        entry->m_context = nullptr;
+
+        {
+            auto& workPool = GetWorkPool();
+            const auto lock = workPool.m_lock.lock();
+            if (workPool.m_freeWork.size() < c_maxFreeWork)
+            {
+                try
+                {
+                    workPool.m_freeWork.emplace_back(std::move(entry));
+                    return;
+                }
+                catch (...)
+                {
+                    // closed below
+                }
+            }
+        }
+
+        // not pooled: the work object is closed here, outside the pool lock
+        entry.reset();
+    }
+
+    static VOID NTAPI WorkCallback(PTP_CALLBACK_INSTANCE instance, PVOID context, PTP_WORK work) noexcept
+    {
+        const auto* const entry = static_cast<WorkEntry*>(context);
+        entry->m_callback(instance, entry->m_context, work);
+    }
+};
+} // namespace ctsTraffic
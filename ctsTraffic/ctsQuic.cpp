@@ -0,0 +1,1317 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+// os headers
+#include <Windows.h>
+#include <msquic.h>
+// ctl headers
+#include <ctTimer.hpp>
+// project headers
+#include "ctsConfig.h"
+#include "ctsSocket.h"
+#include "ctsIOTask.hpp"
+#include "ctsQuicStream.hpp"
+#include "ctsTlsSession.hpp"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+//
+// -IO:Quic
+//
+// Each ctsSocket is one bidirectional QUIC stream, running the same ctsIoPattern as a TCP connection
+// - clients open up to -QuicStreams streams on each QUIC connection before opening the next connection
+//   so -Connections counts streams, and every -QuicStreams of them share one handshake
+// - servers listen on every -Listen address, handing each stream a peer starts to the next ctsQuicAccept
+// - the ctsIoPattern sees the bytes sent and received on its stream:
+//   its byte counts and buffer verification are unchanged
+//
+// MsQuic is loaded from msquic.dll at runtime: it sends and receives with UDP segmentation offload (USO)
+// and receive coalescing (URO) whenever the network stack supports them
+//
+// Locks are always taken in the order: QuicStream lock, then the ctsSocket lock
+// - MsQuic calls which block on MsQuic worker threads (StreamClose, ConnectionClose, GetParam)
+//   are only made from MsQuic callbacks
+//
+namespace ctsTraffic { namespace Quic
+    {
+        class QuicConnection;
+        class QuicStream;
+
+        static INIT_ONCE g_quicInitializer = INIT_ONCE_STATIC_INIT;
+        // MsQuic objects shared by all connections - never closed, as they're used until the process exits
+        static const QUIC_API_TABLE* g_msQuic = nullptr;
+        static HQUIC g_registration = nullptr;
+        static HQUIC g_configuration = nullptr;
+        static std::vector<HQUIC> g_listeners;
+        // the server certificate: found from -TlsCertificate, or created for the lifetime of the process
+        static wil::unique_cert_context g_serverCertificate;
+        static std::unique_ptr<ctsTlsSelfSignedCertificate> g_pSelfSignedCertificate;
+
+        // the ALPN clients and servers must agree on
+        static uint8_t g_alpn[] = {'c', 't', 's', 'T', 'r', 'a', 'f', 'f', 'i', 'c'};
+        static const QUIC_BUFFER g_alpnBuffer{sizeof g_alpn, g_alpn};
+
+        // servers accept up to the most streams a client can open on each connection
+        static constexpr uint16_t c_maxStreams = 1024;
+
+        // every ctsSocket's stream, from when it's connected or accepted until ctsQuicClose
+        static wil::critical_section g_streamsLock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        static std::unordered_map<const ctsSocket*, std::shared_ptr<QuicStream>> g_streams;
+
+        // servers: accept requests waiting for a peer to start a stream, and streams waiting for an accept request
+        static wil::critical_section g_acceptLock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        static ctsQuicAcceptQueue<ctsSocket, QuicStream> g_acceptQueue;
+
+        // clients: the connection new streams are opened on, until it has opened -QuicStreams streams
+        static wil::critical_section g_clientLock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        static std::shared_ptr<QuicConnection> g_clientConnection;
+        static uint32_t g_targetCounter = 0;
+
+        static DWORD ErrorFromStatus(QUIC_STATUS status) noexcept
+        {
+            return ctsConfig::Win32FromHresult(status);
+        }
+
+        static wil::network::socket_address AddressFromQuic(const QUIC_ADDR& quicAddress) noexcept
+        {
+            wil::network::socket_address address;
+            *address.sockaddr_inet() = quicAddress;
+            return address;
+        }
+
+        static QUIC_STATUS QUIC_API ListenerCallback(HQUIC, void*, QUIC_LISTENER_EVENT* event) noexcept;
+        static QUIC_STATUS QUIC_API ConnectionCallback(HQUIC, void* context, QUIC_CONNECTION_EVENT* event) noexcept;
+        static QUIC_STATUS QUIC_API StreamCallback(HQUIC, void* context, QUIC_STREAM_EVENT* event) noexcept;
+
+        static BOOL CALLBACK InitOnceQuic(PINIT_ONCE, PVOID, PVOID*) noexcept
+        {
+            try
+            {
+                // msquic.dll is not part of Windows: it's expected alongside ctsTraffic.exe
+                const auto msQuicModule = LoadLibraryExW(L"msquic.dll", nullptr, LOAD_LIBRARY_SEARCH_APPLICATION_DIR | LOAD_LIBRARY_SEARCH_SYSTEM32);
+                THROW_LAST_ERROR_IF_NULL_MSG(msQuicModule, "LoadLibraryEx(msquic.dll)");
+                using MsQuicOpenVersionFn = QUIC_STATUS (QUIC_API*)(uint32_t, const void**);
+                const auto msQuicOpenVersion = reinterpret_cast<MsQuicOpenVersionFn>(GetProcAddress(msQuicModule, "MsQuicOpenVersion"));
+                THROW_LAST_ERROR_IF_NULL_MSG(msQuicOpenVersion, "GetProcAddress(MsQuicOpenVersion)");
+                THROW_IF_FAILED_MSG(
+                    msQuicOpenVersion(QUIC_API_VERSION_2, reinterpret_cast<const void**>(&g_msQuic)),
+                    "MsQuicOpenVersion");
+
+                const QUIC_REGISTRATION_CONFIG registrationConfig{"ctsTraffic", QUIC_EXECUTION_PROFILE_TYPE_MAX_THROUGHPUT};
+                THROW_IF_FAILED_MSG(g_msQuic->RegistrationOpen(&registrationConfig, &g_registration), "RegistrationOpen");
+
+                const auto listening = ctsConfig::IsListening();
+                QUIC_SETTINGS settings{};
+                if (listening)
+                {
+                    settings.PeerBidiStreamCount = c_maxStreams;
+                    settings.IsSet.PeerBidiStreamCount = TRUE;
+                }
+                THROW_IF_FAILED_MSG(
+                    g_msQuic->ConfigurationOpen(g_registration, &g_alpnBuffer, 1, &settings, sizeof settings, nullptr, &g_configuration),
+                    "ConfigurationOpen");
+
+                QUIC_CREDENTIAL_CONFIG credential{};
+                if (listening)
+                {
+                    PCCERT_CONTEXT serverCertificate = nullptr;
+                    if (g_configSettings->TlsCertificateThumbprint.empty())
+                    {
+                        g_pSelfSignedCertificate = std::make_unique<ctsTlsSelfSignedCertificate>();
+                        serverCertificate = g_pSelfSignedCertificate->Get();
+                    }
+                    else
+                    {
+                        g_serverCertificate = ctsTlsFindCertificate(g_configSettings->TlsCertificateThumbprint.c_str());
+                        serverCertificate = g_serverCertificate.get();
+                    }
+                    credential.Type = QUIC_CREDENTIAL_TYPE_CERTIFICATE_CONTEXT;
+                    credential.CertificateContext = reinterpret_cast<QUIC_CERTIFICATE*>(const_cast<CERT_CONTEXT*>(serverCertificate));
+                }
+                else
+                {
+                    // servers present self-signed certificates: clients don't validate them
+                    credential.Type = QUIC_CREDENTIAL_TYPE_NONE;
+                    credential.Flags = QUIC_CREDENTIAL_FLAG_CLIENT | QUIC_CREDENTIAL_FLAG_NO_CERTIFICATE_VALIDATION;
+                }
+                THROW_IF_FAILED_MSG(g_msQuic->ConfigurationLoadCredential(g_configuration, &credential), "ConfigurationLoadCredential");
+
+                if (listening)
+                {
+                    for (const auto& listenAddress : g_configSettings->ListenAddresses)
+                    {
+                        HQUIC listener{};
+                        THROW_IF_FAILED_MSG(g_msQuic->ListenerOpen(g_registration, ListenerCallback, nullptr, &listener), "ListenerOpen");
+                        g_listeners.push_back(listener);
+
+                        const QUIC_ADDR quicAddress = *listenAddress.sockaddr_inet();
+                        THROW_IF_FAILED_MSG(g_msQuic->ListenerStart(listener, &g_alpnBuffer, 1, &quicAddress), "ListenerStart");
+                        PRINT_DEBUG_INFO(L"\t\tctsQuic: listening on %ws\n", listenAddress.format_complete_address().c_str());
+                    }
+                }
+            }
+            catch (...)
+            {
+                const auto gle = ctsConfig::PrintThrownException();
+                SetLastError(gle);
+                return FALSE;
+            }
+            return TRUE;
+        }
+
+        static DWORD InitializeQuic() noexcept
+        {
+            if (!InitOnceExecuteOnce(&g_quicInitializer, InitOnceQuic, nullptr, nullptr))
+            {
+                auto gle = GetLastError();
+                if (0 == gle)
+                {
+                    gle = ERROR_NOT_SUPPORTED;
+                }
+                ctsConfig::PrintException(gle, L"InitOnceExecuteOnce", L"ctsQuic");
+                return gle;
+            }
+            return NO_ERROR;
+        }
+
+        struct QuicTaskStatus
+        {
+            // the error to complete the ctsSocket state with
+            DWORD m_ioErrorCode = NO_ERROR;
+            // the ctsIoPattern has no more IO for this stream
+            bool m_ioDone = false;
+        };
+
+        // a send task passed to StreamSend: both must remain valid until SEND_COMPLETE
+        struct QuicSendRequest
+        {
+            QUIC_BUFFER m_buffer{};
+            ctsTask m_task{};
+        };
+
+        //
+        // One QUIC connection carrying the streams of one or more ctsSockets
+        // - kept alive by its own reference until MsQuic indicates SHUTDOWN_COMPLETE
+        //
+        class QuicConnection : public std::enable_shared_from_this<QuicConnection>
+        {
+        public:
+            QuicConnection() noexcept = default;
+            ~QuicConnection() noexcept = default;
+            QuicConnection(const QuicConnection&) = delete;
+            QuicConnection& operator=(const QuicConnection&) = delete;
+            QuicConnection(QuicConnection&&) = delete;
+            QuicConnection& operator=(QuicConnection&&) = delete;
+
+            // clients: opens a connection to the target and starts the handshake
+            void Start(const wil::network::socket_address& targetAddress)
+            {
+                m_remoteAddress = targetAddress;
+                THROW_IF_FAILED_MSG(g_msQuic->ConnectionOpen(g_registration, ConnectionCallback, this, &m_handle), "ConnectionOpen");
+
+                const QUIC_ADDR quicAddress = *targetAddress.sockaddr_inet();
+                auto status = g_msQuic->SetParam(m_handle, QUIC_PARAM_CONN_REMOTE_ADDRESS, sizeof quicAddress, &quicAddress);
+                if (QUIC_SUCCEEDED(status))
+                {
+                    m_self = shared_from_this();
+                    m_handshakeStartUsec = ctl::ctTimer::snap_qpc_as_usec();
+                    const auto serverName = targetAddress.format_address();
+                    char serverNameA[INET6_ADDRSTRLEN]{};
+                    WideCharToMultiByte(CP_UTF8, 0, serverName.c_str(), -1, serverNameA, sizeof serverNameA, nullptr, nullptr);
+                    status = g_msQuic->ConnectionStart(m_handle, g_configuration, QUIC_ADDRESS_FAMILY_UNSPEC, serverNameA, targetAddress.port());
+                }
+                if (QUIC_FAILED(status))
+                {
+                    // no events are indicated for a connection which never started
+                    m_self.reset();
+                    g_msQuic->ConnectionClose(m_handle);
+                    m_handle = nullptr;
+                    THROW_HR_MSG(status, "ConnectionStart");
+                }
+            }
+
+            // servers: takes ownership of the connection the listener indicated
+            QUIC_STATUS Accept(HQUIC handle, const QUIC_NEW_CONNECTION_INFO& info) noexcept
+            {
+                m_handle = handle;
+                m_localAddress = AddressFromQuic(*info.LocalAddress);
+                m_remoteAddress = AddressFromQuic(*info.RemoteAddress);
+                m_handshakeStartUsec = ctl::ctTimer::snap_qpc_as_usec();
+
+                g_msQuic->SetCallbackHandler(m_handle, reinterpret_cast<void*>(ConnectionCallback), this);
+                const auto status = g_msQuic->ConnectionSetConfiguration(m_handle, g_configuration);
+                if (QUIC_SUCCEEDED(status))
+                {
+                    // failing the callback closes the connection: otherwise it's closed on SHUTDOWN_COMPLETE
+                    m_self = shared_from_this();
+                }
+                return status;
+            }
+
+            //
+            // Clients: assigns a stream slot on this connection, returning false once all -QuicStreams are assigned
+            //
+            bool TryAssignStream() noexcept
+            {
+                const auto lock = m_lock.lock();
+                return !m_shutdown && m_streamSlots.TryAssign();
+            }
+
+            // Clients: opens a stream for the ctsSocket once the handshake completes
+            void AddStream(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+
+            // Streams: the stream finished - clients shut down the connection once all its streams finished
+            void StreamClosed() noexcept
+            {
+                auto lock = m_lock.lock();
+                if (m_streamSlots.Close() && !ctsConfig::IsListening())
+                {
+                    ShutdownConnection(lock);
+                }
+            }
+
+            [[nodiscard]] HQUIC GetHandle() const noexcept
+            {
+                return m_handle;
+            }
+
+            [[nodiscard]] const wil::network::socket_address& GetLocalAddress() const noexcept
+            {
+                return m_localAddress;
+            }
+
+            [[nodiscard]] const wil::network::socket_address& GetRemoteAddress() const noexcept
+            {
+                return m_remoteAddress;
+            }
+
+            QUIC_STATUS OnEvent(QUIC_CONNECTION_EVENT* event) noexcept;
+
+        private:
+            mutable wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+            HQUIC m_handle = nullptr;
+            // released on SHUTDOWN_COMPLETE
+            std::shared_ptr<QuicConnection> m_self;
+            wil::network::socket_address m_localAddress;
+            wil::network::socket_address m_remoteAddress;
+            int64_t m_handshakeStartUsec = 0;
+            _Guarded_by_(m_lock) bool m_connected = false;
+            _Guarded_by_(m_lock) bool m_shutdown = false;
+            _Guarded_by_(m_lock) bool m_shutdownRequested = false;
+            _Guarded_by_(m_lock) DWORD m_shutdownError = NO_ERROR;
+            _Guarded_by_(m_lock) ctsQuicStreamSlots m_streamSlots{g_configSettings->QuicStreams};
+            // clients: ctsSockets waiting for the handshake to complete before opening their stream
+            _Guarded_by_(m_lock) std::vector<std::weak_ptr<ctsSocket>> m_waitingSockets;
+
+            void ShutdownConnection(const wil::cs_leave_scope_exit&) noexcept
+            {
+                if (!m_shutdownRequested && m_handle)
+                {
+                    m_shutdownRequested = true;
+                    g_msQuic->ConnectionShutdown(m_handle, QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, 0);
+                }
+            }
+
+            void StartStream(const std::shared_ptr<ctsSocket>& sharedSocket) noexcept;
+        };
+
+        //
+        // One bidirectional stream: the IO of one ctsSocket
+        // - kept alive by its own reference until MsQuic indicates SHUTDOWN_COMPLETE
+        //
+        class QuicStream : public std::enable_shared_from_this<QuicStream>
+        {
+        public:
+            explicit QuicStream(std::shared_ptr<QuicConnection> connection) noexcept :
+                m_connection(std::move(connection))
+            {
+            }
+
+            ~QuicStream() noexcept = default;
+            QuicStream(const QuicStream&) = delete;
+            QuicStream& operator=(const QuicStream&) = delete;
+            QuicStream(QuicStream&&) = delete;
+            QuicStream& operator=(QuicStream&&) = delete;
+
+            // clients: opens and starts the stream - the ctsSocket's connect completes with START_COMPLETE
+            DWORD Start(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+            {
+                const auto lock = m_lock.lock();
+                m_weakSocket = weakSocket;
+                m_startUsec = ctl::ctTimer::snap_qpc_as_usec();
+
+                auto status = g_msQuic->StreamOpen(m_connection->GetHandle(), QUIC_STREAM_OPEN_FLAG_NONE, StreamCallback, this, &m_handle);
+                if (QUIC_FAILED(status))
+                {
+                    m_handle = nullptr;
+                    return ErrorFromStatus(status);
+                }
+
+                // the peer must learn of the stream before this side sends: patterns can start by receiving
+                m_self = shared_from_this();
+                status = g_msQuic->StreamStart(m_handle, QUIC_STREAM_START_FLAG_IMMEDIATE);
+                if (QUIC_FAILED(status))
+                {
+                    m_self.reset();
+                    g_msQuic->StreamClose(m_handle);
+                    m_handle = nullptr;
+                    return ErrorFromStatus(status);
+                }
+                return NO_ERROR;
+            }
+
+            // servers: takes ownership of the stream the peer started
+            void Accept(HQUIC handle) noexcept
+            {
+                const auto lock = m_lock.lock();
+                m_handle = handle;
+                m_self = shared_from_this();
+                g_msQuic->SetCallbackHandler(m_handle, reinterpret_cast<void*>(StreamCallback), this);
+            }
+
+            // servers: the stream was handed to a ctsSocket by ctsQuicAccept
+            void SetSocket(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+            {
+                const auto lock = m_lock.lock();
+                m_weakSocket = weakSocket;
+            }
+
+            [[nodiscard]] const std::shared_ptr<QuicConnection>& GetConnection() const noexcept
+            {
+                return m_connection;
+            }
+
+            //
+            // Starts the ctsIoPattern's IO on the stream
+            //
+            void StartIo(const std::shared_ptr<ctsSocket>& sharedSocket) noexcept
+            {
+                const auto lock = m_lock.lock();
+                const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                const auto lockedPattern = lockedSocket.GetPattern();
+                if (!lockedPattern)
+                {
+                    return;
+                }
+
+                // hold an IO reference while starting the IO
+                sharedSocket->IncrementIo();
+                m_ioStarted = true;
+                auto status = ProcessTasks(sharedSocket, lockedPattern);
+                if (!status.m_ioDone)
+                {
+                    // a server stream can have received data before it was accepted
+                    status = ProcessReceived(sharedSocket, lockedPattern);
+                }
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(status.m_ioErrorCode);
+                }
+            }
+
+            //
+            // The ctsSocket is closing: shuts down the stream if the ctsIoPattern didn't
+            //
+            void Close(DWORD error) noexcept
+            {
+                const auto lock = m_lock.lock();
+                ShutdownStream(error);
+                m_weakSocket.reset();
+            }
+
+            QUIC_STATUS OnEvent(QUIC_STREAM_EVENT* event) noexcept;
+
+        private:
+            mutable wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+            const std::shared_ptr<QuicConnection> m_connection;
+            _Guarded_by_(m_lock) HQUIC m_handle = nullptr;
+            // released on SHUTDOWN_COMPLETE
+            _Guarded_by_(m_lock) std::shared_ptr<QuicStream> m_self;
+            _Guarded_by_(m_lock) std::weak_ptr<ctsSocket> m_weakSocket;
+            _Guarded_by_(m_lock) int64_t m_startUsec = 0;
+            _Guarded_by_(m_lock) bool m_ioStarted = false;
+            _Guarded_by_(m_lock) bool m_shutdownSent = false;
+            _Guarded_by_(m_lock) bool m_streamClosed = false;
+
+            // recv tasks waiting for data, and the data MsQuic indicated which is not yet copied to recv tasks
+            // - each recv task holds an IO reference on the ctsSocket until it's completed
+            // - MsQuic keeps the held buffers valid until StreamReceiveComplete
+            _Guarded_by_(m_lock) ctsQuicReceiveQueue<QUIC_BUFFER, ctsTask> m_received;
+            // the held buffers were indicated with QUIC_STATUS_PENDING: StreamReceiveComplete returns them
+            _Guarded_by_(m_lock) bool m_receivePending = false;
+
+            void ShutdownStream(DWORD error) noexcept
+            {
+                if (!m_shutdownSent && !m_streamClosed && m_handle)
+                {
+                    m_shutdownSent = true;
+                    // an abort (with RST_STREAM / STOP_SENDING) replaces closing with an error
+                    g_msQuic->StreamShutdown(
+                        m_handle,
+                        NO_ERROR == error ? QUIC_STREAM_SHUTDOWN_FLAG_GRACEFUL : QUIC_STREAM_SHUTDOWN_FLAG_ABORT,
+                        error);
+                }
+            }
+
+            //
+            // Requests IO from the ctsIoPattern until it has no more IO to start right now
+            //
+            QuicTaskStatus ProcessTasks(const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern) noexcept
+            {
+                QuicTaskStatus status{};
+                while (!status.m_ioDone)
+                {
+                    const ctsTask nextIo = sharedPattern->InitiateIo();
+                    if (ctsTaskAction::None == nextIo.m_ioAction)
+                    {
+                        // nothing failed, just no more IO right now
+                        break;
+                    }
+
+                    if (nextIo.m_timeOffsetMilliseconds > 0)
+                    {
+                        // the timer holds an IO reference until it runs the task
+                        sharedSocket->IncrementIo();
+                        try
+                        {
+                            sharedSocket->SetTimer(
+                                nextIo,
+                                [stream = shared_from_this()](const std::weak_ptr<ctsSocket>&, const ctsTask& task) noexcept {
+                                    stream->TimerCallback(task);
+                                });
+                            break;
+                        }
+                        catch (...)
+                        {
+                            const auto error = ctsConfig::PrintThrownException();
+                            sharedSocket->DecrementIo();
+                            status = CompleteTask(sharedPattern, nextIo, 0, error);
+                        }
+                    }
+                    else
+                    {
+                        status = ProcessTask(sharedSocket, sharedPattern, nextIo);
+                    }
+                }
+                return status;
+            }
+
+            void TimerCallback(const ctsTask& task) noexcept
+            {
+                const auto lock = m_lock.lock();
+                const auto sharedSocket(m_weakSocket.lock());
+                if (!sharedSocket)
+                {
+                    return;
+                }
+
+                const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                const auto lockedPattern = lockedSocket.GetPattern();
+                if (!lockedPattern)
+                {
+                    return;
+                }
+
+                auto status = ProcessTask(sharedSocket, lockedPattern, task);
+                if (!status.m_ioDone)
+                {
+                    status = ProcessTasks(sharedSocket, lockedPattern);
+                }
+
+                // release the IO reference held for the timer
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(status.m_ioErrorCode);
+                }
+            }
+
+            //
+            // Starts the IO for the task, or completes it inline if it can't be started
+            //
+            QuicTaskStatus ProcessTask(const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern, const ctsTask& nextIo) noexcept
+            {
+                if (m_streamClosed || !m_handle)
+                {
+                    // even if the stream was closed we still must complete the IO request
+                    auto status = CompleteTask(sharedPattern, nextIo, 0, NO_ERROR == m_received.GetError() ? WSAECONNABORTED : m_received.GetError());
+                    status.m_ioDone = true;
+                    return status;
+                }
+
+                switch (nextIo.m_ioAction)
+                {
+                    case ctsTaskAction::Send:
+                    {
+                        auto sendRequest = std::unique_ptr<QuicSendRequest>(new (std::nothrow) QuicSendRequest);
+                        if (!sendRequest)
+                        {
+                            return CompleteTask(sharedPattern, nextIo, 0, WSAENOBUFS);
+                        }
+
+                        // the ctsIoPattern keeps the buffer valid until the task is completed
+                        sendRequest->m_buffer.Buffer = reinterpret_cast<uint8_t*>(nextIo.m_buffer + nextIo.m_bufferOffset);
+                        sendRequest->m_buffer.Length = nextIo.m_bufferLength;
+                        sendRequest->m_task = nextIo;
+
+                        sharedSocket->IncrementIo();
+                        const auto status = g_msQuic->StreamSend(m_handle, &sendRequest->m_buffer, 1, QUIC_SEND_FLAG_NONE, sendRequest.get());
+                        if (QUIC_FAILED(status))
+                        {
+                            sharedSocket->DecrementIo();
+                            const auto error = ErrorFromStatus(status);
+                            PRINT_DEBUG_INFO(L"\t\tIO Failed: StreamSend (%lu) [ctsQuic]\n", error);
+                            return CompleteTask(sharedPattern, nextIo, 0, error);
+                        }
+                        // owned by MsQuic until SEND_COMPLETE
+                        sendRequest.release();
+                        return {};
+                    }
+
+                    case ctsTaskAction::Recv:
+                        try
+                        {
+                            m_received.AddTask(nextIo);
+                        }
+                        catch (...)
+                        {
+                            return CompleteTask(sharedPattern, nextIo, 0, ctsConfig::PrintThrownException());
+                        }
+                        sharedSocket->IncrementIo();
+                        return ProcessReceived(sharedSocket, sharedPattern);
+
+                    case ctsTaskAction::GracefulShutdown:
+                        // sends FIN on the stream once everything already sent has been sent
+                        m_shutdownSent = true;
+                        g_msQuic->StreamShutdown(m_handle, QUIC_STREAM_SHUTDOWN_FLAG_GRACEFUL, 0);
+                        return CompleteTask(sharedPattern, nextIo, 0, NO_ERROR);
+
+                    case ctsTaskAction::HardShutdown:
+                        // aborts both directions of the stream
+                        ShutdownStream(static_cast<DWORD>(SOCKET_ERROR));
+                        return CompleteTask(sharedPattern, nextIo, 0, NO_ERROR);
+
+                    default:
+                        FAIL_FAST_MSG("ctsQuic: unexpected ctsTaskAction %d", static_cast<int>(nextIo.m_ioAction));
+                }
+            }
+
+            //
+            // Returns the ctsIoPattern's decision after completing the task
+            //
+            QuicTaskStatus CompleteTask(const std::shared_ptr<ctsIoPattern>& sharedPattern, const ctsTask& task, uint32_t transferred, DWORD error) noexcept
+            {
+                const char* functionName = ctsTaskAction::Recv == task.m_ioAction ? "StreamReceive" : "StreamSend";
+                QuicTaskStatus status{};
+                switch (const ctsIoStatus protocolStatus = sharedPattern->CompleteIo(task, transferred, error))
+                {
+                    case ctsIoStatus::ContinueIo:
+                        // if the IO failed, the protocol wants to ignore the error
+                        break;
+
+                    case ctsIoStatus::CompletedIo:
+                        status.m_ioDone = true;
+                        break;
+
+                    case ctsIoStatus::FailedIo:
+                        // write out the error to the error log since the protocol sees this as a hard error
+                        ctsConfig::PrintErrorIfFailed(functionName, error);
+                        // protocol sees this as a failure : capture the error the protocol recorded
+                        status.m_ioErrorCode = sharedPattern->GetLastPatternError();
+                        status.m_ioDone = true;
+                        break;
+
+                    default:
+                        FAIL_FAST_MSG("ctsQuic: unknown ctsSocket::IOStatus - %d\n", protocolStatus);
+                }
+
+                if (status.m_ioDone)
+                {
+                    // the stream is done: close it gracefully on success, else abort it
+                    // - which also completes any recv tasks still waiting on the stream
+                    ShutdownStream(status.m_ioErrorCode);
+                }
+                return status;
+            }
+
+            //
+            // Copies the data held from MsQuic into recv tasks, completing them in order
+            // - each recv task is completed with whatever data is available, as a TCP recv would
+            // - once the peer has finished sending and no data remains, recv tasks are completed with zero bytes
+            //
+            QuicTaskStatus ProcessReceived(const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern) noexcept
+            {
+                QuicTaskStatus status{};
+                ctsTask task;
+                uint32_t transferred{};
+                uint32_t error{};
+                while (!status.m_ioDone && m_received.CompleteNext(task, transferred, error))
+                {
+                    if (!m_received.IsHoldingData())
+                    {
+                        ReleaseHeldBuffers();
+                    }
+
+                    status = CompleteTask(sharedPattern, task, transferred, error);
+                    sharedSocket->DecrementIo();
+                }
+                return status;
+            }
+
+            // returns all the data MsQuic indicated once it's been copied out
+            void ReleaseHeldBuffers() noexcept
+            {
+                const auto heldLength = m_received.ReleaseHeld();
+                if (m_receivePending && m_handle && !m_streamClosed)
+                {
+                    g_msQuic->StreamReceiveComplete(m_handle, heldLength);
+                }
+                m_receivePending = false;
+            }
+
+            // completes every recv task still waiting, once the stream can't receive any more data
+            QuicTaskStatus FinishReceives(const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern, DWORD error) noexcept
+            {
+                m_received.Finish(error);
+                return ProcessReceived(sharedSocket, sharedPattern);
+            }
+
+            QUIC_STATUS OnReceive(QUIC_STREAM_EVENT* event) noexcept;
+            void OnSendComplete(_In_ QuicSendRequest* sendRequest, bool canceled) noexcept;
+            void OnRecvFinished(DWORD error) noexcept;
+            void OnStartComplete(QUIC_STATUS startStatus) noexcept;
+            void OnShutdownComplete() noexcept;
+        };
+
+        void QuicConnection::AddStream(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+        {
+            auto lock = m_lock.lock();
+            if (m_shutdown)
+            {
+                const auto error = NO_ERROR == m_shutdownError ? WSAECONNABORTED : m_shutdownError;
+                lock.reset();
+                if (const auto sharedSocket = weakSocket.lock())
+                {
+                    sharedSocket->CompleteState(error);
+                }
+                return;
+            }
+
+            if (!m_connected)
+            {
+                try
+                {
+                    m_waitingSockets.push_back(weakSocket);
+                    return;
+                }
+                catch (...)
+                {
+                    const auto error = ctsConfig::PrintThrownException();
+                    lock.reset();
+                    if (const auto sharedSocket = weakSocket.lock())
+                    {
+                        sharedSocket->CompleteState(error);
+                    }
+                    return;
+                }
+            }
+
+            lock.reset();
+            if (const auto sharedSocket = weakSocket.lock())
+            {
+                StartStream(sharedSocket);
+            }
+        }
+
+        void QuicConnection::StartStream(const std::shared_ptr<ctsSocket>& sharedSocket) noexcept
+        {
+            DWORD error = NO_ERROR;
+            try
+            {
+                sharedSocket->SetLocalSockaddr(m_localAddress);
+                sharedSocket->SetRemoteSockaddr(m_remoteAddress);
+
+                const auto stream = std::make_shared<QuicStream>(shared_from_this());
+                {
+                    const auto streamsLock = g_streamsLock.lock();
+                    g_streams[sharedSocket.get()] = stream;
+                }
+
+                error = stream->Start(sharedSocket);
+                if (error != NO_ERROR)
+                {
+                    const auto streamsLock = g_streamsLock.lock();
+                    g_streams.erase(sharedSocket.get());
+                }
+            }
+            catch (...)
+            {
+                error = ctsConfig::PrintThrownException();
+            }
+
+            if (error != NO_ERROR)
+            {
+                ctsConfig::PrintErrorIfFailed("StreamStart", error);
+                StreamClosed();
+                sharedSocket->CompleteState(error);
+            }
+        }
+
+        QUIC_STATUS QuicConnection::OnEvent(QUIC_CONNECTION_EVENT* event) noexcept
+        {
+            switch (event->Type)
+            {
+                case QUIC_CONNECTION_EVENT_CONNECTED:
+                {
+                    const auto handshakeUsec = ctl::ctTimer::snap_qpc_as_usec() - m_handshakeStartUsec;
+                    g_configSettings->QuicHandshakes.Increment();
+                    g_configSettings->QuicHandshakeUsec.Add(handshakeUsec);
+                    PRINT_DEBUG_INFO(L"\t\tctsQuic: handshake completed in %lld usec\n", handshakeUsec);
+
+                    if (!ctsConfig::IsListening())
+                    {
+                        QUIC_ADDR localAddress{};
+                        uint32_t localAddressLength = sizeof localAddress;
+                        if (QUIC_SUCCEEDED(g_msQuic->GetParam(m_handle, QUIC_PARAM_CONN_LOCAL_ADDRESS, &localAddressLength, &localAddress)))
+                        {
+                            m_localAddress = AddressFromQuic(localAddress);
+                        }
+                    }
+
+                    std::vector<std::weak_ptr<ctsSocket>> waitingSockets;
+                    {
+                        const auto lock = m_lock.lock();
+                        m_connected = true;
+                        waitingSockets.swap(m_waitingSockets);
+                    }
+                    for (const auto& weakSocket : waitingSockets)
+                    {
+                        if (const auto sharedSocket = weakSocket.lock())
+                        {
+                            StartStream(sharedSocket);
+                        }
+                    }
+                    break;
+                }
+
+                case QUIC_CONNECTION_EVENT_SHUTDOWN_INITIATED_BY_TRANSPORT:
+                {
+                    const auto lock = m_lock.lock();
+                    m_shutdown = true;
+                    if (NO_ERROR == m_shutdownError)
+                    {
+                        m_shutdownError = ErrorFromStatus(event->SHUTDOWN_INITIATED_BY_TRANSPORT.Status);
+                    }
+                    PRINT_DEBUG_INFO(L"\t\tctsQuic: connection shut down by the transport (%lu)\n", m_shutdownError);
+                    break;
+                }
+
+                case QUIC_CONNECTION_EVENT_SHUTDOWN_INITIATED_BY_PEER:
+                {
+                    const auto lock = m_lock.lock();
+                    m_shutdown = true;
+                    if (NO_ERROR == m_shutdownError && !m_connected)
+                    {
+                        m_shutdownError = WSAECONNREFUSED;
+                    }
+                    break;
+                }
+
+                case QUIC_CONNECTION_EVENT_PEER_STREAM_STARTED:
+                {
+                    // servers: the stream waits for the next ctsQuicAccept
+                    try
+                    {
+                        const auto stream = std::make_shared<QuicStream>(shared_from_this());
+                        stream->Accept(event->PEER_STREAM_STARTED.Stream);
+                        g_configSettings->QuicStreamsOpened.Increment();
+
+                        std::shared_ptr<ctsSocket> acceptingSocket;
+                        {
+                            const auto acceptLock = g_acceptLock.lock();
+                            acceptingSocket = g_acceptQueue.StreamStarted(stream);
+                        }
+
+                        if (acceptingSocket)
+                        {
+                            stream->SetSocket(acceptingSocket);
+                            acceptingSocket->SetLocalSockaddr(m_localAddress);
+                            acceptingSocket->SetRemoteSockaddr(m_remoteAddress);
+                            {
+                                const auto streamsLock = g_streamsLock.lock();
+                                g_streams[acceptingSocket.get()] = stream;
+                            }
+                            acceptingSocket->CompleteState(NO_ERROR);
+                        }
+                    }
+                    catch (...)
+                    {
+                        // the stream is refused: MsQuic closes it when the callback fails
+                        ctsConfig::PrintThrownException();
+                        return QUIC_STATUS_OUT_OF_MEMORY;
+                    }
+                    break;
+                }
+
+                case QUIC_CONNECTION_EVENT_SHUTDOWN_COMPLETE:
+                {
+                    std::vector<std::weak_ptr<ctsSocket>> waitingSockets;
+                    DWORD error{};
+                    bool connected{};
+                    {
+                        const auto lock = m_lock.lock();
+                        m_shutdown = true;
+                        connected = m_connected;
+                        error = NO_ERROR == m_shutdownError ? WSAECONNABORTED : m_shutdownError;
+                        waitingSockets.swap(m_waitingSockets);
+                    }
+
+                    if (!connected)
+                    {
+                        g_configSettings->QuicHandshakeFailures.Increment();
+                        ctsConfig::PrintErrorIfFailed("QUIC handshake", error);
+                    }
+                    for (const auto& weakSocket : waitingSockets)
+                    {
+                        if (const auto sharedSocket = weakSocket.lock())
+                        {
+                            sharedSocket->CompleteState(error);
+                        }
+                    }
+
+                    {
+                        const auto clientLock = g_clientLock.lock();
+                        if (g_clientConnection.get() == this)
+                        {
+                            g_clientConnection.reset();
+                        }
+                    }
+
+                    if (!event->SHUTDOWN_COMPLETE.AppCloseInProgress)
+                    {
+                        g_msQuic->ConnectionClose(m_handle);
+                    }
+                    // must be last: this can release the final reference to this object
+                    const auto self = std::move(m_self);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+            return QUIC_STATUS_SUCCESS;
+        }
+
+        QUIC_STATUS QuicStream::OnEvent(QUIC_STREAM_EVENT* event) noexcept
+        {
+            switch (event->Type)
+            {
+                case QUIC_STREAM_EVENT_START_COMPLETE:
+                    OnStartComplete(event->START_COMPLETE.Status);
+                    break;
+
+                case QUIC_STREAM_EVENT_RECEIVE:
+                    return OnReceive(event);
+
+                case QUIC_STREAM_EVENT_SEND_COMPLETE:
+                    OnSendComplete(static_cast<QuicSendRequest*>(event->SEND_COMPLETE.ClientContext), !!event->SEND_COMPLETE.Canceled);
+                    break;
+
+                case QUIC_STREAM_EVENT_PEER_SEND_SHUTDOWN:
+                    // FIN: recv tasks are completed with zero bytes once the data received is consumed
+                    OnRecvFinished(NO_ERROR);
+                    break;
+
+                case QUIC_STREAM_EVENT_PEER_SEND_ABORTED:
+                    OnRecvFinished(WSAECONNRESET);
+                    break;
+
+                case QUIC_STREAM_EVENT_SHUTDOWN_COMPLETE:
+                    OnShutdownComplete();
+                    break;
+
+                default:
+                    break;
+            }
+            return QUIC_STATUS_SUCCESS;
+        }
+
+        void QuicStream::OnStartComplete(QUIC_STATUS startStatus) noexcept
+        {
+            std::shared_ptr<ctsSocket> sharedSocket;
+            DWORD error = NO_ERROR;
+            {
+                const auto lock = m_lock.lock();
+                sharedSocket = m_weakSocket.lock();
+                if (QUIC_SUCCEEDED(startStatus))
+                {
+                    g_configSettings->QuicStreamsOpened.Increment();
+                    g_configSettings->QuicStreamStartUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - m_startUsec);
+                }
+                else
+                {
+                    error = ErrorFromStatus(startStatus);
+                    ctsConfig::PrintErrorIfFailed("StreamStart", error);
+                }
+            }
+
+            // the ctsSocket's connect completes once the stream is started
+            if (sharedSocket)
+            {
+                sharedSocket->CompleteState(error);
+            }
+        }
+
+        QUIC_STATUS QuicStream::OnReceive(QUIC_STREAM_EVENT* event) noexcept
+        {
+            const auto lock = m_lock.lock();
+            FAIL_FAST_IF_MSG(
+                m_received.IsHoldingData(),
+                "ctsQuic: MsQuic indicated data while data is still held (stream %p)", this);
+
+            const auto& receive = event->RECEIVE;
+            if (0 == receive.TotalBufferLength)
+            {
+                // FIN without data is also indicated with PEER_SEND_SHUTDOWN
+                return QUIC_STATUS_SUCCESS;
+            }
+
+            try
+            {
+                m_received.Hold(receive.Buffers, receive.BufferCount, receive.TotalBufferLength);
+            }
+            catch (...)
+            {
+                // refusing the data aborts the stream
+                return QUIC_STATUS_OUT_OF_MEMORY;
+            }
+
+            const auto sharedSocket(m_weakSocket.lock());
+            if (m_ioStarted && sharedSocket)
+            {
+                const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                if (const auto lockedPattern = lockedSocket.GetPattern())
+                {
+                    // an IO reference is held while completing recv tasks
+                    sharedSocket->IncrementIo();
+                    auto status = ProcessReceived(sharedSocket, lockedPattern);
+                    if (!status.m_ioDone)
+                    {
+                        status = ProcessTasks(sharedSocket, lockedPattern);
+                    }
+                    if (0 == sharedSocket->DecrementIo())
+                    {
+                        sharedSocket->CompleteState(status.m_ioErrorCode);
+                    }
+                }
+            }
+
+            if (m_received.IsHoldingData())
+            {
+                // MsQuic keeps the buffers until StreamReceiveComplete, and indicates nothing more until then
+                m_receivePending = true;
+                return QUIC_STATUS_PENDING;
+            }
+
+            // all the data was consumed inline
+            m_received.ReleaseHeld();
+            return QUIC_STATUS_SUCCESS;
+        }
+
+        void QuicStream::OnSendComplete(_In_ QuicSendRequest* sendRequest, bool canceled) noexcept
+        {
+            const std::unique_ptr<QuicSendRequest> completedRequest(sendRequest);
+
+            const auto lock = m_lock.lock();
+            const auto sharedSocket(m_weakSocket.lock());
+            if (!sharedSocket)
+            {
+                return;
+            }
+
+            const auto lockedSocket = sharedSocket->AcquireSocketLock();
+            const auto lockedPattern = lockedSocket.GetPattern();
+            const auto completion = ctsQuicCompleteSend(completedRequest->m_task, canceled, WSAECONNABORTED);
+            DWORD gle = completion.m_error;
+            if (lockedPattern)
+            {
+                auto status = CompleteTask(lockedPattern, completedRequest->m_task, completion.m_transferred, completion.m_error);
+                if (!status.m_ioDone)
+                {
+                    // more IO is requested from the protocol
+                    status = ProcessTasks(sharedSocket, lockedPattern);
+                }
+                gle = status.m_ioErrorCode;
+            }
+
+            // always decrement *after* attempting new IO : the prior IO is now formally "done"
+            if (0 == sharedSocket->DecrementIo())
+            {
+                sharedSocket->CompleteState(gle);
+            }
+        }
+
+        void QuicStream::OnRecvFinished(DWORD error) noexcept
+        {
+            const auto lock = m_lock.lock();
+            m_received.Finish(error);
+
+            const auto sharedSocket(m_weakSocket.lock());
+            if (!m_ioStarted || !sharedSocket)
+            {
+                return;
+            }
+
+            const auto lockedSocket = sharedSocket->AcquireSocketLock();
+            if (const auto lockedPattern = lockedSocket.GetPattern())
+            {
+                sharedSocket->IncrementIo();
+                auto status = ProcessReceived(sharedSocket, lockedPattern);
+                if (!status.m_ioDone)
+                {
+                    status = ProcessTasks(sharedSocket, lockedPattern);
+                }
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(status.m_ioErrorCode);
+                }
+            }
+        }
+
+        void QuicStream::OnShutdownComplete() noexcept
+        {
+            std::shared_ptr<QuicStream> self;
+            {
+                const auto lock = m_lock.lock();
+                m_streamClosed = true;
+                // MsQuic no longer holds any data indicated to the stream: nothing more can be copied from it
+                m_receivePending = false;
+                m_received.ReleaseHeld();
+
+                const auto sharedSocket(m_weakSocket.lock());
+                if (m_ioStarted && sharedSocket)
+                {
+                    const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                    if (const auto lockedPattern = lockedSocket.GetPattern())
+                    {
+                        // recv tasks still waiting will never see more data
+                        sharedSocket->IncrementIo();
+                        const auto status = FinishReceives(sharedSocket, lockedPattern, WSAECONNABORTED);
+                        if (0 == sharedSocket->DecrementIo())
+                        {
+                            sharedSocket->CompleteState(status.m_ioErrorCode);
+                        }
+                    }
+                }
+
+                g_msQuic->StreamClose(m_handle);
+                m_handle = nullptr;
+                self = std::move(m_self);
+            }
+
+            m_connection->StreamClosed();
+            // self can release the final reference to this object as it goes out of scope
+        }
+
+        static QUIC_STATUS QUIC_API ListenerCallback(HQUIC, void*, QUIC_LISTENER_EVENT* event) noexcept
+        {
+            if (QUIC_LISTENER_EVENT_NEW_CONNECTION != event->Type)
+            {
+                return QUIC_STATUS_SUCCESS;
+            }
+
+            try
+            {
+                const auto connection = std::make_shared<QuicConnection>();
+                return connection->Accept(event->NEW_CONNECTION.Connection, *event->NEW_CONNECTION.Info);
+            }
+            catch (...)
+            {
+                // refusing the connection: MsQuic closes it
+                ctsConfig::PrintThrownException();
+                return QUIC_STATUS_OUT_OF_MEMORY;
+            }
+        }
+
+        static QUIC_STATUS QUIC_API ConnectionCallback(HQUIC, void* context, QUIC_CONNECTION_EVENT* event) noexcept
+        {
+            return static_cast<QuicConnection*>(context)->OnEvent(event);
+        }
+
+        static QUIC_STATUS QUIC_API StreamCallback(HQUIC, void* context, QUIC_STREAM_EVENT* event) noexcept
+        {
+            return static_cast<QuicStream*>(context)->OnEvent(event);
+        }
+
+        // clients: the connection the next stream is opened on
+        static std::shared_ptr<QuicConnection> AssignClientConnection(const std::shared_ptr<ctsSocket>& sharedSocket)
+        {
+            const auto lock = g_clientLock.lock();
+            if (g_clientConnection && g_clientConnection->TryAssignStream())
+            {
+                return g_clientConnection;
+            }
+
+            // a traffic class can override the target addresses for its connections
+            const auto* const trafficClass = g_configSettings->GetTrafficClass(sharedSocket->GetTrafficClass());
+            const auto& targetAddresses = trafficClass && !trafficClass->TargetAddresses.empty()
+                ? trafficClass->TargetAddresses
+                : g_configSettings->TargetAddresses;
+            THROW_HR_IF_MSG(E_INVALIDARG, targetAddresses.empty(), "ctsQuic requires a target address");
+
+            auto newConnection = std::make_shared<QuicConnection>();
+            newConnection->Start(targetAddresses[g_targetCounter++ % targetAddresses.size()]);
+            FAIL_FAST_IF(!newConnection->TryAssignStream());
+            g_clientConnection = newConnection;
+            return newConnection;
+        }
+    } // namespace Quic
+
+    // Clients: nothing to create - the QUIC connection is opened (or shared) by ctsQuicConnect
+    void ctsQuicCreate(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        if (const auto sharedSocket = weakSocket.lock())
+        {
+            sharedSocket->CompleteState(Quic::InitializeQuic());
+        }
+    }
+
+    // Clients: opens a stream on a QUIC connection - completing once the handshake completes and the stream starts
+    void ctsQuicConnect(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        try
+        {
+            const auto connection = Quic::AssignClientConnection(sharedSocket);
+            connection->AddStream(weakSocket);
+        }
+        catch (...)
+        {
+            sharedSocket->CompleteState(ctsConfig::PrintThrownException());
+        }
+    }
+
+    // Servers: completes with the next stream a peer starts
+    void ctsQuicAccept(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        if (const auto error = Quic::InitializeQuic(); error != NO_ERROR)
+        {
+            sharedSocket->CompleteState(error);
+            return;
+        }
+
+        std::shared_ptr<Quic::QuicStream> acceptedStream;
+        try
+        {
+            const auto acceptLock = Quic::g_acceptLock.lock();
+            acceptedStream = Quic::g_acceptQueue.Accept(weakSocket);
+        }
+        catch (...)
+        {
+            sharedSocket->CompleteState(ctsConfig::PrintThrownException());
+            return;
+        }
+        if (!acceptedStream)
+        {
+            // completed when the next stream is started by a peer
+            return;
+        }
+
+        acceptedStream->SetSocket(weakSocket);
+        sharedSocket->SetLocalSockaddr(acceptedStream->GetConnection()->GetLocalAddress());
+        sharedSocket->SetRemoteSockaddr(acceptedStream->GetConnection()->GetRemoteAddress());
+        try
+        {
+            const auto streamsLock = Quic::g_streamsLock.lock();
+            Quic::g_streams[sharedSocket.get()] = acceptedStream;
+        }
+        catch (...)
+        {
+            acceptedStream->Close(WSAENOBUFS);
+            sharedSocket->CompleteState(ctsConfig::PrintThrownException());
+            return;
+        }
+        sharedSocket->CompleteState(NO_ERROR);
+    }
+
+    // Runs the ctsIoPattern over the ctsSocket's stream
+    void ctsQuicIo(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        std::shared_ptr<Quic::QuicStream> stream;
+        {
+            const auto streamsLock = Quic::g_streamsLock.lock();
+            if (const auto foundStream = Quic::g_streams.find(sharedSocket.get()); foundStream != Quic::g_streams.end())
+            {
+                stream = foundStream->second;
+            }
+        }
+        if (!stream)
+        {
+            sharedSocket->CompleteState(WSAENOTCONN);
+            return;
+        }
+
+        stream->StartIo(sharedSocket);
+    }
+
+    // The ctsSocket is closing: shuts down its stream if it's still open
+    void ctsQuicClose(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        std::shared_ptr<Quic::QuicStream> stream;
+        {
+            const auto streamsLock = Quic::g_streamsLock.lock();
+            if (const auto foundStream = Quic::g_streams.find(sharedSocket.get()); foundStream != Quic::g_streams.end())
+            {
+                stream = std::move(foundStream->second);
+                Quic::g_streams.erase(foundStream);
+            }
+        }
+
+        if (stream)
+        {
+            const auto pattern = sharedSocket->AcquireSocketLock().GetPattern();
+            stream->Close(pattern ? pattern->GetLastPatternError() : static_cast<DWORD>(WSAECONNABORTED));
+        }
+    }
+} // namespace
@@ -0,0 +1,259 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+// - nor any OS headers: this header is portable, so -IO:Quic stream handling can be tested without MsQuic
+
+namespace ctsTraffic
+{
+//
+// ctsQuicStreamSlots
+//
+// Clients: the streams assigned to one QUIC connection
+// - each connection carries up to maxStreams streams, after which new streams open a new connection
+// - once every stream it will carry has closed, the connection is shut down
+//
+class ctsQuicStreamSlots
+{
+public:
+    explicit ctsQuicStreamSlots(uint32_t maxStreams) noexcept :
+        m_maxStreams(maxStreams)
+    {
+    }
+
+    // returns false once all maxStreams are assigned
+    bool TryAssign() noexcept
+    {
+        if (m_assigned == m_maxStreams)
+        {
+            return false;
+        }
+        ++m_assigned;
+        return true;
+    }
+
+    // returns true when the last stream the connection will carry has closed
+    bool Close() noexcept
+    {
+        ++m_closed;
+        return m_closed == m_assigned && m_assigned == m_maxStreams;
+    }
+
+    [[nodiscard]] uint32_t GetAssignedCount() const noexcept
+    {
+        return m_assigned;
+    }
+
+private:
+    const uint32_t m_maxStreams;
+    uint32_t m_assigned = 0;
+    uint32_t m_closed = 0;
+};
+
+//
+// ctsQuicAcceptQueue
+//
+// Servers: hands each stream a peer starts to the next accept request
+// - streams started before an accept request is made wait for the next request, in the order they were started
+// - accept requests whose socket was since closed are skipped
+// - the caller serializes access
+//
+template <typename Socket, typename Stream>
+class ctsQuicAcceptQueue
+{
+public:
+    // a peer started a stream: returns the socket accepting it, or nullptr if the stream now waits for an accept request
+    std::shared_ptr<Socket> StreamStarted(const std::shared_ptr<Stream>& stream)
+    {
+        while (!m_pendingAccepts.empty())
+        {
+            auto acceptingSocket = m_pendingAccepts.front().lock();
+            m_pendingAccepts.pop_front();
+            if (acceptingSocket)
+            {
+                return acceptingSocket;
+            }
+        }
+
+        m_pendingStreams.push_back(stream);
+        return nullptr;
+    }
+
+    // an accept request: returns the stream to accept, or nullptr if the request now waits for a peer to start a stream
+    std::shared_ptr<Stream> Accept(const std::weak_ptr<Socket>& weakSocket)
+    {
+        if (m_pendingStreams.empty())
+        {
+            m_pendingAccepts.push_back(weakSocket);
+            return nullptr;
+        }
+
+        auto acceptedStream = std::move(m_pendingStreams.front());
+        m_pendingStreams.pop_front();
+        return acceptedStream;
+    }
+
+    [[nodiscard]] size_t GetPendingStreamCount() const noexcept
+    {
+        return m_pendingStreams.size();
+    }
+
+    [[nodiscard]] size_t GetPendingAcceptCount() const noexcept
+    {
+        return m_pendingAccepts.size();
+    }
+
+private:
+    std::deque<std::weak_ptr<Socket>> m_pendingAccepts;
+    std::deque<std::shared_ptr<Stream>> m_pendingStreams;
+};
+
+//
+// ctsQuicReceiveQueue
+//
+// The data MsQuic indicated on a stream, and the recv tasks waiting for it
+// - MsQuic owns the buffers it indicates: they are held until every byte is copied into recv tasks,
+//   then ReleaseHeld returns the length to complete with StreamReceiveComplete
+// - recv tasks complete in the order they were requested, each with whatever data is held, as a TCP recv would
+// - once the peer has finished (or aborted) sending and no data is held, recv tasks complete with zero bytes
+//   and the error the stream finished with
+// - Buffer needs Buffer (uint8_t*) and Length (uint32_t), as a QUIC_BUFFER
+// - Task needs m_buffer, m_bufferOffset, and m_bufferLength
+//
+template <typename Buffer, typename Task>
+class ctsQuicReceiveQueue
+{
+public:
+    void AddTask(const Task& task)
+    {
+        m_tasks.push_back(task);
+    }
+
+    // holds the buffers from a RECEIVE indication - only one indication is held at a time
+    void Hold(const Buffer* buffers, uint32_t bufferCount, uint64_t totalLength)
+    {
+        m_heldBuffers.assign(buffers, buffers + bufferCount);
+        m_heldBufferIndex = 0;
+        m_heldBufferOffset = 0;
+        m_heldLength = totalLength;
+    }
+
+    // the peer finished sending: error is zero for a FIN, else the error the stream was aborted with
+    // - the first error is kept
+    void Finish(uint32_t error) noexcept
+    {
+        m_finished = true;
+        if (0 == m_error)
+        {
+            m_error = error;
+        }
+    }
+
+    //
+    // Copies held data into the next recv task, returning false if no recv task can be completed yet
+    // - error is set when the task completes with zero bytes
+    //
+    bool CompleteNext(Task& task, uint32_t& transferred, uint32_t& error) noexcept
+    {
+        if (m_tasks.empty() || (!IsHoldingData() && !m_finished))
+        {
+            return false;
+        }
+
+        task = m_tasks.front();
+        m_tasks.pop_front();
+
+        uint32_t copied = 0;
+        while (copied < task.m_bufferLength && IsHoldingData())
+        {
+            const auto& heldBuffer = m_heldBuffers[m_heldBufferIndex];
+            const auto copyLength = std::min(task.m_bufferLength - copied, heldBuffer.Length - m_heldBufferOffset);
+            memcpy(task.m_buffer + task.m_bufferOffset + copied, heldBuffer.Buffer + m_heldBufferOffset, copyLength);
+            copied += copyLength;
+            m_heldBufferOffset += copyLength;
+            if (m_heldBufferOffset == heldBuffer.Length)
+            {
+                ++m_heldBufferIndex;
+                m_heldBufferOffset = 0;
+            }
+        }
+
+        transferred = copied;
+        error = 0 == copied ? m_error : 0;
+        return true;
+    }
+
+    // data is held which hasn't been copied into recv tasks
+    [[nodiscard]] bool IsHoldingData() const noexcept
+    {
+        return m_heldBufferIndex < m_heldBuffers.size();
+    }
+
+    // stops holding the indicated buffers, returning the total length they held
+    uint64_t ReleaseHeld() noexcept
+    {
+        const auto heldLength = m_heldLength;
+        m_heldBuffers.clear();
+        m_heldBufferIndex = 0;
+        m_heldBufferOffset = 0;
+        m_heldLength = 0;
+        return heldLength;
+    }
+
+    [[nodiscard]] uint32_t GetError() const noexcept
+    {
+        return m_error;
+    }
+
+    [[nodiscard]] size_t GetTaskCount() const noexcept
+    {
+        return m_tasks.size();
+    }
+
+private:
+    std::deque<Task> m_tasks;
+    std::vector<Buffer> m_heldBuffers;
+    size_t m_heldBufferIndex = 0;
+    uint32_t m_heldBufferOffset = 0;
+    uint64_t m_heldLength = 0;
+    bool m_finished = false;
+    uint32_t m_error = 0;
+};
+
+// the bytes and error a send task completes with when MsQuic indicates SEND_COMPLETE
+// - MsQuic sends the whole buffer, unless the stream was aborted first and the send canceled
+struct ctsQuicSendCompletion
+{
+    uint32_t m_transferred = 0;
+    uint32_t m_error = 0;
+};
+
+template <typename Task>
+ctsQuicSendCompletion ctsQuicCompleteSend(const Task& task, bool canceled, uint32_t canceledError) noexcept
+{
+    if (canceled)
+    {
+        return {0, canceledError};
+    }
+    return {task.m_bufferLength, 0};
+}
+} // namespace ctsTraffic
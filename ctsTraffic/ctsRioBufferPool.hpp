@@ -0,0 +1,278 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <memory>
+#include <new>
+#include <vector>
+// os headers
+#include <Windows.h>
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+
+namespace ctsTraffic
+{
+//
+// ctsRioBufferPool
+//
+// Process-wide pool of RIO-registered buffers of one fixed size
+// - buffers are registered the first time they are needed, then recycled between connections
+//   so connections churning through the pool don't register or deregister anything
+//
+// Two kinds of pools:
+// - a shared-buffer pool registers the same caller-owned memory for every buffer
+//   (e.g. the shared send buffer, which every send reads from)
+//   every buffer gets its own RIO_BUFFERID, so no two sends are outstanding on the same RIO_BUFFERID
+// - a slab pool carves buffers from slabs of buffersPerSlab buffers, allocating slabs as needed
+//   (e.g. receive buffers, where each request needs its own memory)
+//   each slab is registered once: its buffers share the slab's RIO_BUFFERID, each at its own offset
+//
+// All RIO calls go through the function table given to the constructor
+// - the pool can be unit tested against a mock function table
+//
+class ctsRioBufferPool
+{
+public:
+    struct RegisteredBuffer
+    {
+        char* m_buffer = nullptr;
+        RIO_BUFFERID m_bufferId = RIO_INVALID_BUFFERID;
+        // the offset of m_buffer within the memory registered as m_bufferId (the RIO_BUF Offset)
+        uint32_t m_offset = 0;
+    };
+
+    // every buffer registers sharedBuffer, which must outlive the pool
+    ctsRioBufferPool(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctions, _In_reads_bytes_(bufferSize) char* sharedBuffer, uint32_t bufferSize) noexcept :
+        m_rioFunctions(rioFunctions),
+        m_sharedBuffer(sharedBuffer),
+        m_bufferSize(bufferSize),
+        m_buffersPerSlab(0)
+    {
+    }
+
+    // buffers are carved from slabs holding buffersPerSlab buffers each
+    ctsRioBufferPool(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctions, uint32_t bufferSize, uint32_t buffersPerSlab) noexcept :
+        m_rioFunctions(rioFunctions),
+        m_sharedBuffer(nullptr),
+        m_bufferSize(bufferSize),
+        m_buffersPerSlab(buffersPerSlab > 0 ? buffersPerSlab : 1)
+    {
+    }
+
+    ~ctsRioBufferPool() noexcept
+    {
+        if (m_sharedBuffer)
+        {
+            // buffers still held by callers are not deregistered
+            for (const auto& freeBuffer : m_freeBuffers)
+            {
+                m_rioFunctions.RIODeregisterBuffer(freeBuffer.m_bufferId);
+            }
+        }
+        else
+        {
+            // slabs are freed with the pool, including the buffers still held by callers
+            for (const auto& slab : m_slabs)
+            {
+                m_rioFunctions.RIODeregisterBuffer(slab.m_bufferId);
+            }
+        }
+    }
+
+    ctsRioBufferPool(const ctsRioBufferPool&) = delete;
+    ctsRioBufferPool& operator=(const ctsRioBufferPool&) = delete;
+    ctsRioBufferPool(ctsRioBufferPool&&) = delete;
+    ctsRioBufferPool& operator=(ctsRioBufferPool&&) = delete;
+
+    //
+    // Returns a free buffer, registering a new one (or a new slab) if none are free
+    // - newlyRegistered is set to true if a buffer or slab was registered
+    // - on failure returns RIO_INVALID_BUFFERID, with WSAGetLastError() describing the failure
+    //
+    RegisteredBuffer Acquire(_Out_opt_ bool* newlyRegistered = nullptr) noexcept
+    {
+        if (newlyRegistered)
+        {
+            *newlyRegistered = false;
+        }
+
+        const auto lock = m_lock.lock();
+        if (!m_freeBuffers.empty())
+        {
+            const auto returnBuffer = m_freeBuffers.back();
+            m_freeBuffers.pop_back();
+            return returnBuffer;
+        }
+
+        // guarantee Release can always return this buffer without allocating
+        try
+        {
+            m_freeBuffers.reserve(m_bufferCount + 1);
+        }
+        catch (...)
+        {
+            WSASetLastError(WSAENOBUFS);
+            return {};
+        }
+
+        RegisteredBuffer newBuffer;
+        if (m_sharedBuffer)
+        {
+            newBuffer.m_buffer = m_sharedBuffer;
+            newBuffer.m_bufferId = m_rioFunctions.RIORegisterBuffer(m_sharedBuffer, m_bufferSize);
+            if (RIO_INVALID_BUFFERID == newBuffer.m_bufferId)
+            {
+                return {};
+            }
+            ++m_registeredCount;
+            if (newlyRegistered)
+            {
+                *newlyRegistered = true;
+            }
+        }
+        else
+        {
+            if (m_slabs.empty() || m_nextSlabBuffer == m_buffersPerSlab)
+            {
+                // sets the last error on failure
+                if (!AllocateSlab())
+                {
+                    return {};
+                }
+                if (newlyRegistered)
+                {
+                    *newlyRegistered = true;
+                }
+            }
+            const auto& slab = m_slabs.back();
+            newBuffer.m_offset = m_nextSlabBuffer * m_bufferSize;
+            newBuffer.m_buffer = slab.m_buffer.get() + newBuffer.m_offset;
+            newBuffer.m_bufferId = slab.m_bufferId;
+            ++m_nextSlabBuffer;
+        }
+
+        ++m_bufferCount;
+        return newBuffer;
+    }
+
+    //
+    // Returns a buffer from Acquire to the pool, to be handed to the next caller of Acquire
+    //
+    void Release(const RegisteredBuffer& buffer) noexcept
+    {
+        FAIL_FAST_IF(RIO_INVALID_BUFFERID == buffer.m_bufferId);
+
+        const auto lock = m_lock.lock();
+        FAIL_FAST_IF_MSG(
+            m_freeBuffers.size() >= m_bufferCount,
+            "ctsRioBufferPool::Release - more buffers released (%zu) than were acquired (%zu)",
+            m_freeBuffers.size() + 1, m_bufferCount);
+        // cannot throw: Acquire reserved room for every buffer it handed out
+        m_freeBuffers.push_back(buffer);
+    }
+
+    [[nodiscard]] uint32_t GetBufferSize() const noexcept
+    {
+        return m_bufferSize;
+    }
+
+    // the number of RIORegisterBuffer calls: one per buffer for a shared-buffer pool, one per slab for a slab pool
+    [[nodiscard]] size_t GetRegisteredCount() const noexcept
+    {
+        const auto lock = m_lock.lock();
+        return m_registeredCount;
+    }
+
+    [[nodiscard]] size_t GetBufferCount() const noexcept
+    {
+        const auto lock = m_lock.lock();
+        return m_bufferCount;
+    }
+
+    [[nodiscard]] size_t GetFreeCount() const noexcept
+    {
+        const auto lock = m_lock.lock();
+        return m_freeBuffers.size();
+    }
+
+    [[nodiscard]] size_t GetSlabCount() const noexcept
+    {
+        const auto lock = m_lock.lock();
+        return m_slabs.size();
+    }
+
+private:
+    static constexpr DWORD c_criticalSectionSpinCount = 200ul;
+
+    mutable wil::critical_section m_lock{c_criticalSectionSpinCount};
+    const RIO_EXTENSION_FUNCTION_TABLE& m_rioFunctions;
+    char* const m_sharedBuffer;
+    const uint32_t m_bufferSize;
+    const uint32_t m_buffersPerSlab;
+
+    struct Slab
+    {
+        std::unique_ptr<char[]> m_buffer;
+        RIO_BUFFERID m_bufferId = RIO_INVALID_BUFFERID;
+    };
+
+    _Guarded_by_(m_lock) std::vector<RegisteredBuffer> m_freeBuffers;
+    _Guarded_by_(m_lock) std::vector<Slab> m_slabs;
+    // the next buffer to carve from the most recent slab
+    _Guarded_by_(m_lock) uint32_t m_nextSlabBuffer = 0;
+    // buffers handed out by Acquire, whether or not they were since released
+    _Guarded_by_(m_lock) size_t m_bufferCount = 0;
+    _Guarded_by_(m_lock) size_t m_registeredCount = 0;
+
+    // allocates and registers a new slab
+    // - on failure returns false, with WSAGetLastError() describing the failure
+    // requires m_lock to be held
+    bool AllocateSlab() noexcept
+    {
+        try
+        {
+            m_slabs.reserve(m_slabs.size() + 1);
+        }
+        catch (...)
+        {
+            WSASetLastError(WSAENOBUFS);
+            return false;
+        }
+
+        const auto slabSize = m_bufferSize * m_buffersPerSlab;
+        Slab newSlab;
+        newSlab.m_buffer.reset(new (std::nothrow) char[slabSize]);
+        if (!newSlab.m_buffer)
+        {
+            WSASetLastError(WSAENOBUFS);
+            return false;
+        }
+
+        newSlab.m_bufferId = m_rioFunctions.RIORegisterBuffer(newSlab.m_buffer.get(), slabSize);
+        if (RIO_INVALID_BUFFERID == newSlab.m_bufferId)
+        {
+            return false;
+        }
+
+        m_slabs.emplace_back(std::move(newSlab));
+        m_nextSlabBuffer = 0;
+        ++m_registeredCount;
+        return true;
+    }
+};
+} // namespace ctsTraffic
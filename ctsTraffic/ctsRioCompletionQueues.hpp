@@ -0,0 +1,259 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <atomic>
+#include <memory>
+// os headers
+#include <Windows.h>
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+
+namespace ctsTraffic
+{
+//
+// ctsRioCompletionQueues
+//
+// Owns a set of RIO completion queues (shards) which all notify the same IOCP
+// - every RQ is assigned to one shard when it is created and stays there
+// - each shard tracks its own size and used slots under its own lock,
+//   and is resized independently as the RQs assigned to it grow
+// - each shard notifies the IOCP with its shard index as the completion key,
+//   so a worker dequeues from (and re-arms) only the shard it was notified for
+//
+// All RIO calls go through the function table given to the constructor
+// - the sizing, resizing and dispatch logic can be unit tested against a mock function table
+//
+class ctsRioCompletionQueues
+{
+public:
+    static constexpr ULONG c_maxCompletionQueueSize = RIO_MAX_CQ_SIZE;
+
+    // throws a wil exception on failure, closing every CQ it created
+    ctsRioCompletionQueues(const RIO_EXTENSION_FUNCTION_TABLE& rioFunctions, HANDLE iocp, uint32_t shardCount, ULONG initialCompletionQueueSize) :
+        m_rioFunctions(rioFunctions),
+        m_shards(std::make_unique<Shard[]>(shardCount)),
+        m_shardCount(shardCount)
+    {
+        THROW_HR_IF(E_INVALIDARG, 0 == shardCount);
+        THROW_HR_IF(E_INVALIDARG, 0 == initialCompletionQueueSize || initialCompletionQueueSize > c_maxCompletionQueueSize);
+
+        auto closeCompletionQueuesOnError = wil::scope_exit([&]() noexcept { CloseCompletionQueues(); });
+        for (auto shard = 0ul; shard < m_shardCount; ++shard)
+        {
+            auto& rioShard = m_shards[shard];
+            rioShard.m_notification.Type = RIO_IOCP_COMPLETION;
+            rioShard.m_notification.Iocp.IocpHandle = iocp;
+            rioShard.m_notification.Iocp.CompletionKey = reinterpret_cast<PVOID>(static_cast<ULONG_PTR>(shard)); // NOLINT(performance-no-int-to-ptr)
+            rioShard.m_notification.Iocp.Overlapped = &rioShard.m_overlapped;
+
+            rioShard.m_completionQueue = m_rioFunctions.RIOCreateCompletionQueue(initialCompletionQueueSize, &rioShard.m_notification);
+            // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+            if (RIO_INVALID_CQ == rioShard.m_completionQueue)
+            {
+                THROW_WIN32_MSG(WSAGetLastError(), "RIOCreateCompletionQueue");
+            }
+            rioShard.m_completionQueueSize = initialCompletionQueueSize;
+        }
+        closeCompletionQueuesOnError.release();
+    }
+
+    ~ctsRioCompletionQueues() noexcept
+    {
+        CloseCompletionQueues();
+    }
+
+    ctsRioCompletionQueues(const ctsRioCompletionQueues&) = delete;
+    ctsRioCompletionQueues& operator=(const ctsRioCompletionQueues&) = delete;
+    ctsRioCompletionQueues(ctsRioCompletionQueues&&) = delete;
+    ctsRioCompletionQueues& operator=(ctsRioCompletionQueues&&) = delete;
+
+    [[nodiscard]] uint32_t GetShardCount() const noexcept
+    {
+        return m_shardCount;
+    }
+
+    // the shard index is the completion key each shard notifies the IOCP with
+    [[nodiscard]] static uint32_t GetShardFromCompletionKey(ULONG_PTR completionKey) noexcept
+    {
+        return static_cast<uint32_t>(completionKey);
+    }
+
+    // assigns new RQs to shards round-robin
+    [[nodiscard]] uint32_t AssignShard() noexcept
+    {
+        return m_nextShard.fetch_add(1, std::memory_order_relaxed) % m_shardCount;
+    }
+
+    [[nodiscard]] RIO_CQ GetCompletionQueue(uint32_t shard) const noexcept
+    {
+        return m_shards[shard].m_completionQueue;
+    }
+
+    [[nodiscard]] ULONG GetCompletionQueueSize(uint32_t shard) const noexcept
+    {
+        const auto lock = m_shards[shard].m_lock.lock();
+        return m_shards[shard].m_completionQueueSize;
+    }
+
+    [[nodiscard]] ULONG GetCompletionQueueUsed(uint32_t shard) const noexcept
+    {
+        const auto lock = m_shards[shard].m_lock.lock();
+        return m_shards[shard].m_completionQueueUsed;
+    }
+
+    //
+    // Guarantees the shard's CQ has room for newSlots more RQ entries, growing the CQ if needed
+    // Returns NO_ERROR or the error from RIOResizeCompletionQueue
+    //
+    [[nodiscard]] DWORD MakeRoom(uint32_t shard, ULONG newSlots) noexcept
+    {
+        auto& rioShard = m_shards[shard];
+        const auto lock = rioShard.m_lock.lock();
+
+        const ULONG newCqUsed = rioShard.m_completionQueueUsed + newSlots;
+        if (rioShard.m_completionQueueSize < newCqUsed)
+        {
+            // fail hard if we are already at the max CQ size and can't grow it for more IO
+            FAIL_FAST_IF_MSG(
+                (c_maxCompletionQueueSize == rioShard.m_completionQueueSize) || (newCqUsed > c_maxCompletionQueueSize),
+                "ctsRioCompletionQueues: attempting to grow CQ shard %u beyond RIO_MAX_CQ_SIZE", shard);
+
+            // multiply new_cq_used by 1.25 for better growth patterns
+            auto newCqSize = static_cast<ULONG>(newCqUsed * 1.25);
+            if (newCqSize > c_maxCompletionQueueSize)
+            {
+                static_assert(MAXLONG / 1.5 > RIO_MAX_CQ_SIZE, "rio_cq_size can overflow");
+                newCqSize = c_maxCompletionQueueSize;
+            }
+
+            if (!m_rioFunctions.RIOResizeCompletionQueue(rioShard.m_completionQueue, newCqSize))
+            {
+                return WSAGetLastError();
+            }
+
+            rioShard.m_completionQueueSize = newCqSize;
+        }
+
+        rioShard.m_completionQueueUsed = newCqUsed;
+        return NO_ERROR;
+    }
+
+    //
+    // Release slots in the shard's CQ
+    //
+    void ReleaseRoom(uint32_t shard, ULONG slots) noexcept
+    {
+        auto& rioShard = m_shards[shard];
+        const auto lock = rioShard.m_lock.lock();
+
+        FAIL_FAST_IF_MSG(
+            rioShard.m_completionQueueUsed < slots,
+            "ctsRioCompletionQueues::ReleaseRoom(%u, %lu): underflow - current used slots (%lu)",
+            shard, slots, rioShard.m_completionQueueUsed);
+
+        rioShard.m_completionQueueUsed -= slots;
+    }
+
+    //
+    // Arms every shard's CQ to notify the IOCP - called once after creating the CQs
+    // Returns NO_ERROR or the error from RIONotify
+    //
+    [[nodiscard]] DWORD NotifyAll() noexcept
+    {
+        for (auto shard = 0ul; shard < m_shardCount; ++shard)
+        {
+            const auto lock = m_shards[shard].m_lock.lock();
+            const auto notifyResult = m_rioFunctions.RIONotify(m_shards[shard].m_completionQueue);
+            if (notifyResult != NO_ERROR)
+            {
+                return static_cast<DWORD>(notifyResult);
+            }
+        }
+        return NO_ERROR;
+    }
+
+    //
+    // Dequeues up to resultCount completions from the shard which notified the IOCP,
+    // then re-arms that shard's notification
+    // - only the shard's lock is taken: other shards are dequeued concurrently by other workers
+    //
+    ULONG Dequeue(uint32_t shard, _Out_writes_to_(resultCount, return) RIORESULT* rioResults, ULONG resultCount) noexcept
+    {
+        auto& rioShard = m_shards[shard];
+        const auto lock = rioShard.m_lock.lock();
+
+        const auto dequeResultCount = m_rioFunctions.RIODequeueCompletion(rioShard.m_completionQueue, rioResults, resultCount);
+
+        // We were notified there were completions, but we can't dequeue any IO
+        // - something has gone horribly wrong - likely our CQ is corrupt
+        // Will kill the test into the debugger to investigate
+        FAIL_FAST_IF_MSG(
+            // ReSharper disable once CppRedundantParentheses
+            (0 == dequeResultCount) || (RIO_CORRUPT_CQ == dequeResultCount),
+            "RIODequeueCompletion on(%p) returned [%lu] : expected to have dequeued IO after being signaled",
+            rioShard.m_completionQueue, dequeResultCount);
+
+        // Immediately after invoking Dequeue, post another Notify
+        const auto notifyResult = m_rioFunctions.RIONotify(rioShard.m_completionQueue);
+
+        // if notify fails, we can't reliably know when the next IO completes
+        // - this will cause everything to come to a grinding halt
+        // Will kill the test into the debugger to investigate
+        FAIL_FAST_IF_MSG(
+            notifyResult != 0,
+            "RIONotify(%p) failed [%d]", rioShard.m_completionQueue, notifyResult);
+
+        return dequeResultCount;
+    }
+
+private:
+    struct Shard
+    {
+        mutable wil::critical_section m_lock{c_criticalSectionSpinCount};
+        RIO_NOTIFICATION_COMPLETION m_notification{};
+        // each shard needs its own OVERLAPPED: RIO queues it to the IOCP with every notification
+        OVERLAPPED m_overlapped{};
+        // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+        RIO_CQ m_completionQueue = RIO_INVALID_CQ;
+        ULONG m_completionQueueSize = 0;
+        ULONG m_completionQueueUsed = 0;
+    };
+
+    static constexpr DWORD c_criticalSectionSpinCount = 200ul;
+
+    const RIO_EXTENSION_FUNCTION_TABLE& m_rioFunctions;
+    const std::unique_ptr<Shard[]> m_shards;
+    const uint32_t m_shardCount;
+    std::atomic<uint32_t> m_nextShard{0};
+
+    void CloseCompletionQueues() noexcept
+    {
+        for (auto shard = 0ul; shard < m_shardCount; ++shard)
+        {
+            // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+            if (m_shards[shard].m_completionQueue != RIO_INVALID_CQ)
+            {
+                m_rioFunctions.RIOCloseCompletionQueue(m_shards[shard].m_completionQueue);
+                // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+                m_shards[shard].m_completionQueue = RIO_INVALID_CQ;
+            }
+        }
+    }
+};
+} // namespace ctsTraffic
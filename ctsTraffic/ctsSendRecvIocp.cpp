@@ -1,416 +1,770 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// cpp headers
-#include <memory>
-// os headers
-#include <Windows.h>
-// ctl headers
-#include <ctThreadIocp.hpp>
-// project headers
-#include "ctsConfig.h"
-#include "ctsSocket.h"
-#include "ctsIOTask.hpp"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-
-using ctsTraffic::ctsConfig::g_configSettings;
-
-namespace ctsTraffic
-{
-    // forward declaration
-    void ctsSendRecvIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-
-    struct ctsSendRecvStatus
-    {
-        // Winsock error code
-        uint32_t m_ioErrorCode = NO_ERROR;
-        // flag if to request another ctsIOTask
-        bool m_ioDone = false;
-        // returns if IO was started (since can return !io_done, but I/O wasn't started yet)
-        bool m_ioStarted = false;
-    };
-
-    // IO Threadpool completion callback 
-    static void ctsSendRecvCompletionCallback(
-        _In_ OVERLAPPED* pOverlapped,
-        const std::weak_ptr<ctsSocket>& weakSocket,
-        const ctsTask& task) noexcept
-    {
-        const auto sharedSocket(weakSocket.lock());
-        if (!sharedSocket)
-        {
-            return;
-        }
-
-        int gle = NO_ERROR;
-
-        // hold a reference on the socket
-        const auto lockedSocket = sharedSocket->AcquireSocketLock();
-        const auto lockedPattern = lockedSocket.GetPattern();
-        if (!lockedPattern)
-        {
-            gle = WSAECONNABORTED;
-        }
-
-        const auto socket = lockedSocket.GetSocket();
-        DWORD transferred = 0;
-        if (gle == NO_ERROR)
-        {
-            // try to get the success/error code and bytes transferred (under the socket lock)
-            // if we no longer have a valid socket or the pattern was destroyed, return early
-            if (INVALID_SOCKET == socket)
-            {
-                gle = WSAECONNABORTED;
-            }
-            else
-            {
-                DWORD flags{};
-                if (!WSAGetOverlappedResult(socket, pOverlapped, &transferred, FALSE, &flags))
-                {
-                    gle = WSAGetLastError();
-                }
-            }
-        }
-
-        // write to PrintError if the IO failed
-        const char* functionName = ctsTaskAction::Send == task.m_ioAction ? "WSASend" : "WSARecv";
-        if (gle != NO_ERROR)
-        {
-            PRINT_DEBUG_INFO(L"\t\tIO Failed: %hs (%d) [ctsSendRecvIocp]\n", functionName, gle);
-        }
-
-        if (lockedPattern)
-        {
-            // see if complete_io requests more IO
-            switch (const ctsIoStatus protocolStatus = lockedPattern->CompleteIo(task, transferred, gle))
-            {
-            case ctsIoStatus::ContinueIo:
-                // more IO is requested from the protocol : invoke the new IO call while holding a ref-count to the prior IO
-                ctsSendRecvIocp(weakSocket);
-                break;
-
-            case ctsIoStatus::CompletedIo:
-                // no more IO is requested from the protocol : indicate success
-                gle = NO_ERROR;
-                break;
-
-            case ctsIoStatus::FailedIo:
-                // write out the error to the error log since the protocol sees this as a hard error
-                ctsConfig::PrintErrorIfFailed(functionName, gle);
-                // protocol sees this as a failure : capture the error the protocol recorded
-                gle = static_cast<int>(lockedPattern->GetLastPatternError());
-                break;
-
-            default:
-                FAIL_FAST_MSG("ctsSendRecvIocp : unknown ctsSocket::IOStatus %d", protocolStatus);
-            }
-        }
-
-        // always decrement *after* attempting new IO : the prior IO is now formally "done"
-        if (sharedSocket->DecrementIo() == 0)
-        {
-            // if we have no more IO pended, complete the state
-            sharedSocket->CompleteState(gle);
-        }
-    }
-
-    //
-    // Attempts the IO specified in the ctsIOTask on the ctsSocket
-    //
-    // ** ctsSocket::increment_io must have been called before this function was invoked
-    //
-    static ctsSendRecvStatus ctsSendRecvProcessTask(SOCKET socket, const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern, const ctsTask& nextIo) noexcept
-    {
-        ctsSendRecvStatus returnStatus;
-
-        // if we no longer have a valid socket return early
-        if (INVALID_SOCKET == socket)
-        {
-            returnStatus.m_ioErrorCode = WSAECONNABORTED;
-            returnStatus.m_ioStarted = false;
-            returnStatus.m_ioDone = true;
-            // even if the socket was closed we still must complete the IO request
-            sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode);
-            return returnStatus;
-        }
-
-        if (ctsTaskAction::GracefulShutdown == nextIo.m_ioAction)
-        {
-            if (shutdown(socket, SD_SEND) != 0)
-            {
-                returnStatus.m_ioErrorCode = WSAGetLastError();
-                PRINT_DEBUG_INFO(L"\t\tIO Failed: shutdown(SD_SEND) (%d) [ctsSendRecvIocp]\n", returnStatus.m_ioErrorCode);
-            }
-            else
-            {
-                PRINT_DEBUG_INFO(L"\t\tIO successfully called shutdown(SD_SEND) (%d) [ctsSendRecvIocp]\n", returnStatus.m_ioErrorCode);
-            }
-            returnStatus.m_ioDone = sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode) != ctsIoStatus::ContinueIo;
-            returnStatus.m_ioStarted = false;
-        }
-        else if (ctsTaskAction::HardShutdown == nextIo.m_ioAction)
-        {
-            // pass through -1 to force an RST with the closesocket
-            returnStatus.m_ioErrorCode = sharedSocket->CloseSocket(static_cast<uint32_t>(SOCKET_ERROR));
-            returnStatus.m_ioDone = sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode) != ctsIoStatus::ContinueIo;
-            returnStatus.m_ioStarted = false;
-        }
-        else
-        {
-            try
-            {
-                // attempt to allocate an IO thread-pool object
-                const std::shared_ptr<ctl::ctThreadIocp>& ioThreadPool(sharedSocket->GetIocpThreadpool());
-                OVERLAPPED* const pOverlapped = ioThreadPool->new_request(
-                    [weak_reference = std::weak_ptr(sharedSocket), nextIo](OVERLAPPED* pCallbackOverlapped) noexcept {
-                        ctsSendRecvCompletionCallback(pCallbackOverlapped, weak_reference, nextIo);
-                    });
-
-                WSABUF wsaBuffer{};
-                wsaBuffer.buf = nextIo.m_buffer + nextIo.m_bufferOffset;
-                wsaBuffer.len = nextIo.m_bufferLength;
-
-                PCSTR functionName{};
-                if (ctsTaskAction::Send == nextIo.m_ioAction)
-                {
-                    if (nextIo.m_bufferLength == 0)
-                    {
-                        PRINT_DEBUG_INFO(L"\t\tIO sending zero bytes! [ctsSendRecvIocp]\n");
-                    }
-
-                    functionName = "WSASend";
-                    if (WSASend(socket, &wsaBuffer, 1, nullptr, 0, pOverlapped, nullptr) != 0)
-                    {
-                        returnStatus.m_ioErrorCode = WSAGetLastError();
-                    }
-                }
-                else
-                {
-                    functionName = "WSARecv";
-                    DWORD flags = g_configSettings->Options & ctsConfig::OptionType::MsgWaitAll ? MSG_WAITALL : 0;
-                    if (WSARecv(socket, &wsaBuffer, 1, nullptr, &flags, pOverlapped, nullptr) != 0)
-                    {
-                        returnStatus.m_ioErrorCode = WSAGetLastError();
-                    }
-                }
-                //
-                // not calling complete_io if returned IO pended 
-                // not calling complete_io if returned success but not handling inline completions
-                //
-                if (WSA_IO_PENDING == returnStatus.m_ioErrorCode ||
-                    // ReSharper disable once CppRedundantParentheses
-                    (NO_ERROR == returnStatus.m_ioErrorCode && !(g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)))
-                {
-                    returnStatus.m_ioErrorCode = NO_ERROR;
-                    returnStatus.m_ioStarted = true;
-                    returnStatus.m_ioDone = false;
-                }
-                else
-                {
-                    // process the completion if the API call failed, or if it succeeded, and we're handling the completion inline, 
-                    returnStatus.m_ioStarted = false;
-                    // determine # of bytes transferred, if any
-                    DWORD bytesTransferred = 0;
-                    if (NO_ERROR == returnStatus.m_ioErrorCode)
-                    {
-                        DWORD flags{};
-                        if (!WSAGetOverlappedResult(socket, pOverlapped, &bytesTransferred, FALSE, &flags))
-                        {
-                            FAIL_FAST_MSG(
-                                "WSAGetOverlappedResult failed (%d) after the IO request (%hs) succeeded", WSAGetLastError(), functionName);
-                        }
-                    }
-                    else
-                    {
-                        PRINT_DEBUG_INFO(L"\t\tIO Failed: %hs (%d) [ctsSendRecvIocp]\n", functionName, returnStatus.m_ioErrorCode);
-                    }
-
-                    // must cancel the IOCP TP since IO is not pended
-                    ioThreadPool->cancel_request(pOverlapped);
-                    // call back to the socket to see if it wants more IO
-                    switch (const ctsIoStatus protocolStatus = sharedPattern->CompleteIo(nextIo, bytesTransferred, returnStatus.m_ioErrorCode))
-                    {
-                    case ctsIoStatus::ContinueIo:
-                        // The protocol layer wants to transfer more data
-                        // if the prior IO request failed, the protocol wants to ignore the error
-                        returnStatus.m_ioErrorCode = NO_ERROR;
-                        returnStatus.m_ioDone = false;
-                        break;
-
-                    case ctsIoStatus::CompletedIo:
-                        // The protocol layer has successfully complete all IO on this connection
-                        // if the prior IO request failed, the protocol wants to ignore the error
-                        returnStatus.m_ioErrorCode = NO_ERROR;
-                        returnStatus.m_ioDone = true;
-                        break;
-
-                    case ctsIoStatus::FailedIo:
-                        // write out the error
-                        ctsConfig::PrintErrorIfFailed(functionName, sharedPattern->GetLastPatternError());
-                        // the protocol acknowledged the failure - socket is done with IO
-                        returnStatus.m_ioErrorCode = sharedPattern->GetLastPatternError();
-                        returnStatus.m_ioDone = true;
-                        break;
-
-                    default:
-                        FAIL_FAST_MSG("ctsSendRecvIocp: unknown ctsSocket::IOStatus - %d\n", protocolStatus);
-                    }
-                }
-            }
-            catch (...)
-            {
-                returnStatus.m_ioErrorCode = ctsConfig::PrintThrownException();
-                returnStatus.m_ioDone = sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode) != ctsIoStatus::ContinueIo;
-                returnStatus.m_ioStarted = false;
-            }
-        }
-
-        return returnStatus;
-    }
-
-    //
-    // This is the callback for the threadpool timer.
-    // Processes the given task and then calls ctsSendRecvIocp function to deal with any additional tasks
-    //
-    static void ctsSendRecvTimerCallback(const std::weak_ptr<ctsSocket>& weakSocket, const ctsTask& nextIo) noexcept
-    {
-        // attempt to get a reference to the socket
-        const auto sharedSocket(weakSocket.lock());
-        if (!sharedSocket)
-        {
-            return;
-        }
-
-        // hold a reference on the socket
-        const auto lockedSocket = sharedSocket->AcquireSocketLock();
-        const auto lockedPattern = lockedSocket.GetPattern();
-        if (!lockedPattern)
-        {
-            return;
-        }
-        // if lockedSocket has an INVALID_SOCKET, continue below to ctsSendRecvProcessTask
-        // where it's handled appropriately
-
-        // increment IO for this IO request
-        sharedSocket->IncrementIo();
-
-        // run the ctsIOTask (next_io) that was scheduled through the TP timer
-        const ctsSendRecvStatus status = ctsSendRecvProcessTask(lockedSocket.GetSocket(), sharedSocket, lockedPattern, nextIo);
-        // if no IO was started, decrement the IO counter
-        if (!status.m_ioStarted)
-        {
-            if (0 == sharedSocket->DecrementIo())
-            {
-                // this should never be zero since we should be holding a ref-count for this callback
-                FAIL_FAST_MSG(
-                    "The ref-count of the ctsSocket object (%p) fell to zero during a scheduled callback", sharedSocket.get());
-            }
-        }
-        // continue requesting IO if this connection still isn't done with all IO after scheduling the prior IO
-        if (!status.m_ioDone)
-        {
-            ctsSendRecvIocp(weakSocket);
-        }
-        // finally decrement the IO that was counted for this IO that was completed async
-        if (sharedSocket->DecrementIo() == 0)
-        {
-            // if we have no more IO pended, complete the state
-            sharedSocket->CompleteState(status.m_ioErrorCode);
-        }
-    }
-
-    // The function registered with ctsConfig
-    void ctsSendRecvIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
-    {
-        // attempt to get a reference to the socket
-        const auto sharedSocket(weakSocket.lock());
-        if (!sharedSocket)
-        {
-            return;
-        }
-
-        // hold a reference on the socket
-        const auto lockedSocket = sharedSocket->AcquireSocketLock();
-        const auto lockedPattern = lockedSocket.GetPattern();
-        if (!lockedPattern)
-        {
-            return;
-        }
-        // if lockedSocket has an INVALID_SOCKET, continue below to ctsSendRecvProcessTask
-        // where it's handled appropriately
-
-        //
-        // loop until failure or initiate_io returns None
-        //
-        // IO is always done in the ctsProcessIOTask function,
-        // - either synchronously or scheduled through a timer object
-        //
-        // The IO ref-count must be incremented here to hold an IO count on the socket
-        // - so that we won't inadvertently call complete_state() while IO is still being scheduled
-        //
-        sharedSocket->IncrementIo();
-
-        ctsSendRecvStatus status{};
-        while (!status.m_ioDone)
-        {
-            const ctsTask nextIo = lockedPattern->InitiateIo();
-            if (ctsTaskAction::None == nextIo.m_ioAction)
-            {
-                // nothing failed, just no more IO right now
-                break;
-            }
-
-            // increment IO for each individual request
-            sharedSocket->IncrementIo();
-
-            if (nextIo.m_timeOffsetMilliseconds > 0)
-            {
-                // set_timer can throw
-                try
-                {
-                    sharedSocket->SetTimer(nextIo, ctsSendRecvTimerCallback);
-                    status.m_ioStarted = true; // IO started in the context of keeping the count incremented
-                    status.m_ioDone = true;
-                }
-                catch (...)
-                {
-                    status.m_ioErrorCode = ctsConfig::PrintThrownException();
-                    status.m_ioStarted = false;
-                }
-            }
-            else
-            {
-                status = ctsSendRecvProcessTask(lockedSocket.GetSocket(), sharedSocket, lockedPattern, nextIo);
-            }
-
-            // if no IO was started, decrement the IO counter
-            if (!status.m_ioStarted)
-            {
-                // since IO is not pended, remove the ref-count
-                if (0 == sharedSocket->DecrementIo())
-                {
-                    // this should never be zero as we are holding a reference outside the loop
-                    FAIL_FAST_MSG(
-                        "The ctsSocket (%p) ref-count fell to zero while this function was holding a reference", sharedSocket.get());
-                }
-            }
-        }
-        // decrement IO at the end to release the ref-count held before the loop
-        if (0 == sharedSocket->DecrementIo())
-        {
-            sharedSocket->CompleteState(status.m_ioErrorCode);
-        }
-    }
-} // namespace
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctThreadIocp.hpp>
+#include <ctTimer.hpp>
+// project headers
+#include "ctsConfig.h"
+#include "ctsSocket.h"
+#include "ctsIOTask.hpp"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+namespace ctsTraffic
+{
+    // forward declaration
+    void ctsSendRecvIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+
+    struct ctsSendRecvStatus
+    {
+        // Winsock error code
+        uint32_t m_ioErrorCode = NO_ERROR;
+        // flag if to request another ctsIOTask
+        bool m_ioDone = false;
+        // returns if IO was started (since can return !io_done, but I/O wasn't started yet)
+        bool m_ioStarted = false;
+    };
+
+    // -SendFile and -RecvFile are opened once, before the run, and shared by all connections
+    static wil::unique_hfile g_sendFile;
+    static uint64_t g_sendFileSize = 0;
+    static std::atomic<uint64_t> g_sendFileCursor{0};
+    static wil::unique_hfile g_recvFile;
+    static std::atomic<uint64_t> g_recvFileCursor{0};
+    // received data wraps back to the start of -RecvFile after 1GB so long runs don't fill the disk
+    constexpr uint64_t c_recvFileWrapBytes = 0x40000000ull;
+    // unbuffered writes must be sector-aligned in address, offset and length: 4KB covers current sector sizes
+    constexpr uint32_t c_unbufferedAlignment = 4096;
+    // file reads and writes made while generating and warming -SendFile, and unbuffered writes to -RecvFile
+    constexpr uint32_t c_fileChunkSize = 0x100000;
+
+    // -RecvFileMode:unbuffered can only write whole sectors: each thread coalesces what it receives
+    // into an aligned chunk, writing the chunk once it's full
+    // - the partly filled chunks are written when the file is closed
+    struct ctsRecvFileStage
+    {
+        wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        wil::unique_virtualalloc_ptr<char> m_buffer;
+        uint32_t m_used = 0;
+    };
+
+    struct ctsRecvFileStages
+    {
+        wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        _Guarded_by_(m_lock) std::vector<std::unique_ptr<ctsRecvFileStage>> m_stages;
+    };
+
+    // never deleted: receives can still be completing as the process exits
+    static ctsRecvFileStages& GetRecvFileStages()
+    {
+        static auto* const s_stages = new ctsRecvFileStages;
+        return *s_stages;
+    }
+
+    static thread_local ctsRecvFileStage* t_recvFileStage = nullptr;
+
+    // writes the verification pattern repeatedly, so the file at any offset matches the shared send buffer
+    // at that offset into the pattern - the file size is rounded up to a whole number of patterns
+    static void ctsGenerateSendFile()
+    {
+        const auto patternSize = ctsIoPattern::GetSharedBufferPatternSize();
+        const auto* const pattern = ctsIoPattern::AccessSharedBuffer();
+        std::vector<char> chunk(c_fileChunkSize);
+        for (uint32_t offset = 0; offset < c_fileChunkSize; offset += patternSize)
+        {
+            memcpy(chunk.data() + offset, pattern, patternSize);
+        }
+
+        const wil::unique_hfile file(CreateFileW(
+            g_configSettings->SendFilePath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+        THROW_LAST_ERROR_IF_MSG(!file.is_valid(), "CreateFile(-SendFile %ws)", g_configSettings->SendFilePath.c_str());
+
+        for (uint64_t written = 0; written < g_configSettings->SendFileSize;)
+        {
+            const auto remaining = g_configSettings->SendFileSize - written;
+            const auto writeLength = remaining >= c_fileChunkSize
+                ? c_fileChunkSize
+                : static_cast<uint32_t>((remaining + patternSize - 1) / patternSize * patternSize);
+            DWORD bytesWritten{};
+            THROW_IF_WIN32_BOOL_FALSE_MSG(WriteFile(file.get(), chunk.data(), writeLength, &bytesWritten, nullptr), "WriteFile(-SendFile)");
+            written += bytesWritten;
+        }
+        THROW_IF_WIN32_BOOL_FALSE(FlushFileBuffers(file.get()));
+    }
+
+    // -SendFileCache:warm reads the file once so TransmitFile sends from the system cache
+    static void ctsWarmSendFile()
+    {
+        const wil::unique_hfile file(CreateFileW(
+            g_configSettings->SendFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+        THROW_LAST_ERROR_IF_MSG(!file.is_valid(), "CreateFile(-SendFile %ws)", g_configSettings->SendFilePath.c_str());
+
+        std::vector<char> chunk(c_fileChunkSize);
+        DWORD bytesRead{};
+        do
+        {
+            THROW_IF_WIN32_BOOL_FALSE_MSG(ReadFile(file.get(), chunk.data(), c_fileChunkSize, &bytesRead, nullptr), "ReadFile(-SendFile)");
+        } while (bytesRead > 0);
+    }
+
+    // -SendFileCache:cold - the file system purges a file's cached pages when a non-cached handle is opened to it
+    // - a file larger than memory keeps later passes through the file cold as well
+    static void ctsPurgeSendFile()
+    {
+        const wil::unique_hfile file(CreateFileW(
+            g_configSettings->SendFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr));
+        THROW_LAST_ERROR_IF_MSG(!file.is_valid(), "CreateFile(-SendFile %ws)", g_configSettings->SendFilePath.c_str());
+    }
+
+    void ctsSendRecvIocpOpenFiles()
+    {
+        if (!g_configSettings->SendFilePath.empty())
+        {
+            if (g_configSettings->SendFileSize > 0)
+            {
+                ctsGenerateSendFile();
+            }
+            if (g_configSettings->SendFileCold)
+            {
+                ctsPurgeSendFile();
+            }
+            else
+            {
+                ctsWarmSendFile();
+            }
+
+            g_sendFile.reset(CreateFileW(
+                g_configSettings->SendFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr));
+            THROW_LAST_ERROR_IF_MSG(!g_sendFile.is_valid(), "CreateFile(-SendFile %ws)", g_configSettings->SendFilePath.c_str());
+
+            LARGE_INTEGER fileSize{};
+            THROW_IF_WIN32_BOOL_FALSE(GetFileSizeEx(g_sendFile.get(), &fileSize));
+            g_sendFileSize = fileSize.QuadPart;
+            // every send must fit in the file at its offset into the pattern
+            THROW_HR_IF_MSG(
+                HRESULT_FROM_WIN32(ERROR_HANDLE_EOF),
+                g_sendFileSize < uint64_t{ctsIoPattern::GetSharedBufferPatternSize()} + ctsConfig::GetMaxBufferSize(),
+                "-SendFile must be at least %u bytes (64KB more than the largest -Buffer)",
+                ctsIoPattern::GetSharedBufferPatternSize() + ctsConfig::GetMaxBufferSize());
+        }
+
+        if (!g_configSettings->RecvFilePath.empty())
+        {
+            g_recvFile.reset(CreateFileW(
+                g_configSettings->RecvFilePath.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                g_configSettings->RecvFileUnbuffered ? FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH : FILE_FLAG_SEQUENTIAL_SCAN,
+                nullptr));
+            THROW_LAST_ERROR_IF_MSG(!g_recvFile.is_valid(), "CreateFile(-RecvFile %ws)", g_configSettings->RecvFilePath.c_str());
+        }
+    }
+
+    // the file repeats the pattern: any offset at the task's position within the pattern sends the same bytes
+    // - sends walk through the file in the order they're issued across all connections, wrapping at its end
+    static uint64_t ctsNextSendFileOffset(const ctsTask& task) noexcept
+    {
+        const uint64_t patternSize = ctsIoPattern::GetSharedBufferPatternSize();
+        const auto reserved = g_sendFileCursor.fetch_add(task.m_bufferLength);
+        auto fileOffset = reserved / patternSize % (g_sendFileSize / patternSize) * patternSize + task.m_bufferOffset;
+        if (fileOffset + task.m_bufferLength > g_sendFileSize)
+        {
+            fileOffset = task.m_bufferOffset;
+        }
+        return fileOffset;
+    }
+
+    // writes at the next offset into -RecvFile, counting dataLength bytes as written
+    // - unbuffered writes are whole sectors, only the last write made when closing the file is padded past dataLength
+    static bool ctsWriteRecvFileAt(const char* data, DWORD writeLength, DWORD dataLength) noexcept
+    {
+        const auto fileOffset = g_recvFileCursor.fetch_add(writeLength) % c_recvFileWrapBytes;
+        OVERLAPPED writeOffset{};
+        writeOffset.Offset = static_cast<DWORD>(fileOffset);
+        writeOffset.OffsetHigh = static_cast<DWORD>(fileOffset >> 32);
+
+        const auto startUsec = ctl::ctTimer::snap_qpc_as_usec();
+        DWORD bytesWritten{};
+        if (!WriteFile(g_recvFile.get(), data, writeLength, &bytesWritten, &writeOffset))
+        {
+            ctsConfig::PrintErrorIfFailed("WriteFile(-RecvFile)", GetLastError());
+            return false;
+        }
+        g_configSettings->RecvFileWriteUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - startUsec);
+        g_configSettings->RecvFileBytes.Add(dataLength);
+        return true;
+    }
+
+    static ctsRecvFileStage* ctsGetRecvFileStage() noexcept
+    {
+        if (t_recvFileStage)
+        {
+            return t_recvFileStage;
+        }
+
+        try
+        {
+            auto stage = std::make_unique<ctsRecvFileStage>();
+            stage->m_buffer.reset(static_cast<char*>(VirtualAlloc(nullptr, c_fileChunkSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)));
+            THROW_LAST_ERROR_IF_MSG(!stage->m_buffer, "VirtualAlloc(-RecvFile)");
+
+            auto& stages = GetRecvFileStages();
+            const auto lock = stages.m_lock.lock();
+            stages.m_stages.emplace_back(std::move(stage));
+            t_recvFileStage = stages.m_stages.back().get();
+        }
+        catch (...)
+        {
+            ctsConfig::PrintThrownException();
+        }
+        return t_recvFileStage;
+    }
+
+    // writes the data received into -RecvFile before the pattern verifies the buffer and reuses it
+    // - a failed write is reported but doesn't fail the connection
+    static void ctsWriteRecvFile(const ctsTask& task, DWORD transferred) noexcept
+    {
+        const char* data = task.m_buffer + task.m_bufferOffset;
+        if (!g_configSettings->RecvFileUnbuffered)
+        {
+            ctsWriteRecvFileAt(data, transferred, transferred);
+            return;
+        }
+
+        auto* const stage = ctsGetRecvFileStage();
+        if (!stage)
+        {
+            return;
+        }
+
+        const auto lock = stage->m_lock.lock();
+        while (transferred > 0)
+        {
+            const auto copyLength = std::min<DWORD>(transferred, c_fileChunkSize - stage->m_used);
+            memcpy(stage->m_buffer.get() + stage->m_used, data, copyLength);
+            stage->m_used += copyLength;
+            data += copyLength;
+            transferred -= copyLength;
+
+            if (c_fileChunkSize == stage->m_used)
+            {
+                ctsWriteRecvFileAt(stage->m_buffer.get(), c_fileChunkSize, c_fileChunkSize);
+                stage->m_used = 0;
+            }
+        }
+    }
+
+    void ctsSendRecvIocpCloseFiles() noexcept
+    {
+        if (!g_recvFile || !g_configSettings->RecvFileUnbuffered)
+        {
+            return;
+        }
+
+        // write the whole sectors of each partly filled chunk, gathering what's left of each into one aligned buffer
+        // - the last partial sector is padded out to be written, then the file is truncated back to the bytes received
+        const wil::unique_virtualalloc_ptr<char> tail(static_cast<char*>(VirtualAlloc(nullptr, c_unbufferedAlignment * 2, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)));
+        if (!tail)
+        {
+            ctsConfig::PrintErrorIfFailed("VirtualAlloc(-RecvFile)", GetLastError());
+            return;
+        }
+        DWORD tailLength = 0;
+
+        auto& stages = GetRecvFileStages();
+        const auto lock = stages.m_lock.lock();
+        for (const auto& stage : stages.m_stages)
+        {
+            const auto stageLock = stage->m_lock.lock();
+            const auto sectorBytes = stage->m_used / c_unbufferedAlignment * c_unbufferedAlignment;
+            if (sectorBytes > 0)
+            {
+                ctsWriteRecvFileAt(stage->m_buffer.get(), sectorBytes, sectorBytes);
+            }
+
+            // less than a sector is left in each: the tail never holds two whole sectors
+            const auto remaining = stage->m_used - sectorBytes;
+            memcpy(tail.get() + tailLength, stage->m_buffer.get() + sectorBytes, remaining);
+            tailLength += remaining;
+            stage->m_used = 0;
+            if (tailLength >= c_unbufferedAlignment)
+            {
+                ctsWriteRecvFileAt(tail.get(), c_unbufferedAlignment, c_unbufferedAlignment);
+                tailLength -= c_unbufferedAlignment;
+                memcpy(tail.get(), tail.get() + c_unbufferedAlignment, tailLength);
+            }
+        }
+
+        if (tailLength > 0)
+        {
+            const auto endOfData = g_recvFileCursor.load() + tailLength;
+            if (ctsWriteRecvFileAt(tail.get(), c_unbufferedAlignment, tailLength) && endOfData <= c_recvFileWrapBytes)
+            {
+                FILE_END_OF_FILE_INFO endOfFile{};
+                endOfFile.EndOfFile.QuadPart = static_cast<LONGLONG>(endOfData);
+                if (!SetFileInformationByHandle(g_recvFile.get(), FileEndOfFileInfo, &endOfFile, sizeof endOfFile))
+                {
+                    ctsConfig::PrintErrorIfFailed("SetFileInformationByHandle(-RecvFile)", GetLastError());
+                }
+            }
+        }
+    }
+
+    // IO Threadpool completion callback 
+    static void ctsSendRecvCompletionCallback(
+        _In_ OVERLAPPED* pOverlapped,
+        const std::weak_ptr<ctsSocket>& weakSocket,
+        const ctsTask& task) noexcept
+    {
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        int gle = NO_ERROR;
+
+        // hold a reference on the socket
+        const auto lockedSocket = sharedSocket->AcquireSocketLock();
+        const auto lockedPattern = lockedSocket.GetPattern();
+        if (!lockedPattern)
+        {
+            gle = WSAECONNABORTED;
+        }
+
+        const auto socket = lockedSocket.GetSocket();
+        DWORD transferred = 0;
+        if (gle == NO_ERROR)
+        {
+            // try to get the success/error code and bytes transferred (under the socket lock)
+            // if we no longer have a valid socket or the pattern was destroyed, return early
+            if (INVALID_SOCKET == socket)
+            {
+                gle = WSAECONNABORTED;
+            }
+            else
+            {
+                DWORD flags{};
+                if (!WSAGetOverlappedResult(socket, pOverlapped, &transferred, FALSE, &flags))
+                {
+                    gle = WSAGetLastError();
+                }
+            }
+        }
+
+        // write to PrintError if the IO failed
+        const char* functionName = "WSARecv";
+        if (ctsTaskAction::Send == task.m_ioAction)
+        {
+            functionName = g_sendFile ? "TransmitFile" : "WSASend";
+        }
+        if (gle != NO_ERROR)
+        {
+            PRINT_DEBUG_INFO(L"\t\tIO Failed: %hs (%d) [ctsSendRecvIocp]\n", functionName, gle);
+        }
+
+        // the receive was posted before the data arrived: with SO_RCVBUF=0 the data was placed directly in its buffer
+        if (NO_ERROR == gle && ctsTaskAction::Recv == task.m_ioAction && g_configSettings->Options & ctsConfig::OptionType::ZeroCopyRecv)
+        {
+            g_configSettings->ZeroCopyRecvBytes.Add(transferred);
+        }
+
+        if (NO_ERROR == gle && transferred > 0)
+        {
+            if (ctsTaskAction::Send == task.m_ioAction && g_sendFile)
+            {
+                g_configSettings->SendFileBytes.Add(transferred);
+            }
+            else if (ctsTaskAction::Recv == task.m_ioAction && g_recvFile)
+            {
+                ctsWriteRecvFile(task, transferred);
+            }
+        }
+
+        if (lockedPattern)
+        {
+            // see if complete_io requests more IO
+            switch (const ctsIoStatus protocolStatus = lockedPattern->CompleteIo(task, transferred, gle))
+            {
+            case ctsIoStatus::ContinueIo:
+                // more IO is requested from the protocol : invoke the new IO call while holding a ref-count to the prior IO
+                ctsSendRecvIocp(weakSocket);
+                break;
+
+            case ctsIoStatus::CompletedIo:
+                // no more IO is requested from the protocol : indicate success
+                gle = NO_ERROR;
+                break;
+
+            case ctsIoStatus::FailedIo:
+                // write out the error to the error log since the protocol sees this as a hard error
+                ctsConfig::PrintErrorIfFailed(functionName, gle);
+                // protocol sees this as a failure : capture the error the protocol recorded
+                gle = static_cast<int>(lockedPattern->GetLastPatternError());
+                break;
+
+            default:
+                FAIL_FAST_MSG("ctsSendRecvIocp : unknown ctsSocket::IOStatus %d", protocolStatus);
+            }
+        }
+
+        // always decrement *after* attempting new IO : the prior IO is now formally "done"
+        if (sharedSocket->DecrementIo() == 0)
+        {
+            // if we have no more IO pended, complete the state
+            sharedSocket->CompleteState(gle);
+        }
+    }
+
+    //
+    // Attempts the IO specified in the ctsIOTask on the ctsSocket
+    //
+    // ** ctsSocket::increment_io must have been called before this function was invoked
+    //
+    static ctsSendRecvStatus ctsSendRecvProcessTask(SOCKET socket, const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern, const ctsTask& nextIo) noexcept
+    {
+        ctsSendRecvStatus returnStatus;
+
+        // if we no longer have a valid socket return early
+        if (INVALID_SOCKET == socket)
+        {
+            returnStatus.m_ioErrorCode = WSAECONNABORTED;
+            returnStatus.m_ioStarted = false;
+            returnStatus.m_ioDone = true;
+            // even if the socket was closed we still must complete the IO request
+            sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode);
+            return returnStatus;
+        }
+
+        if (ctsTaskAction::GracefulShutdown == nextIo.m_ioAction)
+        {
+            if (shutdown(socket, SD_SEND) != 0)
+            {
+                returnStatus.m_ioErrorCode = WSAGetLastError();
+                PRINT_DEBUG_INFO(L"\t\tIO Failed: shutdown(SD_SEND) (%d) [ctsSendRecvIocp]\n", returnStatus.m_ioErrorCode);
+            }
+            else
+            {
+                PRINT_DEBUG_INFO(L"\t\tIO successfully called shutdown(SD_SEND) (%d) [ctsSendRecvIocp]\n", returnStatus.m_ioErrorCode);
+            }
+            returnStatus.m_ioDone = sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode) != ctsIoStatus::ContinueIo;
+            returnStatus.m_ioStarted = false;
+        }
+        else if (ctsTaskAction::HardShutdown == nextIo.m_ioAction)
+        {
+            // pass through -1 to force an RST with the closesocket
+            returnStatus.m_ioErrorCode = sharedSocket->CloseSocket(static_cast<uint32_t>(SOCKET_ERROR));
+            returnStatus.m_ioDone = sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode) != ctsIoStatus::ContinueIo;
+            returnStatus.m_ioStarted = false;
+        }
+        else
+        {
+            try
+            {
+                // attempt to allocate an IO thread-pool object
+                const std::shared_ptr<ctl::ctThreadIocp>& ioThreadPool(sharedSocket->GetIocpThreadpool());
+                OVERLAPPED* const pOverlapped = ioThreadPool->new_request(
+                    [weak_reference = std::weak_ptr(sharedSocket), nextIo](OVERLAPPED* pCallbackOverlapped) noexcept {
+                        ctsSendRecvCompletionCallback(pCallbackOverlapped, weak_reference, nextIo);
+                    });
+
+                WSABUF wsaBuffer{};
+                wsaBuffer.buf = nextIo.m_buffer + nextIo.m_bufferOffset;
+                wsaBuffer.len = nextIo.m_bufferLength;
+
+                PCSTR functionName{};
+                if (ctsTaskAction::Send == nextIo.m_ioAction)
+                {
+                    if (nextIo.m_bufferLength == 0)
+                    {
+                        PRINT_DEBUG_INFO(L"\t\tIO sending zero bytes! [ctsSendRecvIocp]\n");
+                    }
+
+                    if (g_sendFile)
+                    {
+                        // TransmitFile reads the file from the offset in the OVERLAPPED
+                        functionName = "TransmitFile";
+                        const auto fileOffset = ctsNextSendFileOffset(nextIo);
+                        pOverlapped->Offset = static_cast<DWORD>(fileOffset);
+                        pOverlapped->OffsetHigh = static_cast<DWORD>(fileOffset >> 32);
+                        if (!g_configSettings->winsockFunctions->TransmitFile(socket, g_sendFile.get(), nextIo.m_bufferLength, 0, pOverlapped, nullptr, 0))
+                        {
+                            returnStatus.m_ioErrorCode = WSAGetLastError();
+                        }
+                    }
+                    else
+                    {
+                        functionName = "WSASend";
+                        if (WSASend(socket, &wsaBuffer, 1, nullptr, 0, pOverlapped, nullptr) != 0)
+                        {
+                            returnStatus.m_ioErrorCode = WSAGetLastError();
+                        }
+                    }
+
+                    if (g_configSettings->Options & ctsConfig::OptionType::ZeroCopySend)
+                    {
+                        g_configSettings->ZeroCopySendCount.Increment();
+                    }
+                }
+                else
+                {
+                    functionName = "WSARecv";
+                    DWORD flags = g_configSettings->Options & ctsConfig::OptionType::MsgWaitAll ? MSG_WAITALL : 0;
+                    if (WSARecv(socket, &wsaBuffer, 1, nullptr, &flags, pOverlapped, nullptr) != 0)
+                    {
+                        returnStatus.m_ioErrorCode = WSAGetLastError();
+                    }
+                }
+                //
+                // not calling complete_io if returned IO pended 
+                // not calling complete_io if returned success but not handling inline completions
+                //
+                if (WSA_IO_PENDING == returnStatus.m_ioErrorCode ||
+                    // ReSharper disable once CppRedundantParentheses
+                    (NO_ERROR == returnStatus.m_ioErrorCode && !(g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)))
+                {
+                    returnStatus.m_ioErrorCode = NO_ERROR;
+                    returnStatus.m_ioStarted = true;
+                    returnStatus.m_ioDone = false;
+                }
+                else
+                {
+                    // process the completion if the API call failed, or if it succeeded, and we're handling the completion inline, 
+                    returnStatus.m_ioStarted = false;
+                    // determine # of bytes transferred, if any
+                    DWORD bytesTransferred = 0;
+                    if (NO_ERROR == returnStatus.m_ioErrorCode)
+                    {
+                        DWORD flags{};
+                        if (!WSAGetOverlappedResult(socket, pOverlapped, &bytesTransferred, FALSE, &flags))
+                        {
+                            FAIL_FAST_MSG(
+                                "WSAGetOverlappedResult failed (%d) after the IO request (%hs) succeeded", WSAGetLastError(), functionName);
+                        }
+
+                        // the receive completed inline: the stack had already buffered (copied) the data
+                        if (ctsTaskAction::Recv == nextIo.m_ioAction && g_configSettings->Options & ctsConfig::OptionType::ZeroCopyRecv)
+                        {
+                            g_configSettings->ZeroCopyRecvCopiedBytes.Add(bytesTransferred);
+                        }
+                        // the send completed inline: with SO_SNDBUF=0 it can only complete before the peer
+                        // acknowledges it if the TCP stack copied the buffer instead of sending from it directly
+                        else if (ctsTaskAction::Send == nextIo.m_ioAction && g_configSettings->Options & ctsConfig::OptionType::ZeroCopySend)
+                        {
+                            g_configSettings->ZeroCopySendCopiedCount.Increment();
+                        }
+
+                        if (bytesTransferred > 0)
+                        {
+                            if (ctsTaskAction::Send == nextIo.m_ioAction && g_sendFile)
+                            {
+                                g_configSettings->SendFileBytes.Add(bytesTransferred);
+                            }
+                            else if (ctsTaskAction::Recv == nextIo.m_ioAction && g_recvFile)
+                            {
+                                ctsWriteRecvFile(nextIo, bytesTransferred);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        PRINT_DEBUG_INFO(L"\t\tIO Failed: %hs (%d) [ctsSendRecvIocp]\n", functionName, returnStatus.m_ioErrorCode);
+                    }
+
+                    // must cancel the IOCP TP since IO is not pended
+                    ioThreadPool->cancel_request(pOverlapped);
+                    // call back to the socket to see if it wants more IO
+                    switch (const ctsIoStatus protocolStatus = sharedPattern->CompleteIo(nextIo, bytesTransferred, returnStatus.m_ioErrorCode))
+                    {
+                    case ctsIoStatus::ContinueIo:
+                        // The protocol layer wants to transfer more data
+                        // if the prior IO request failed, the protocol wants to ignore the error
+                        returnStatus.m_ioErrorCode = NO_ERROR;
+                        returnStatus.m_ioDone = false;
+                        break;
+
+                    case ctsIoStatus::CompletedIo:
+                        // The protocol layer has successfully complete all IO on this connection
+                        // if the prior IO request failed, the protocol wants to ignore the error
+                        returnStatus.m_ioErrorCode = NO_ERROR;
+                        returnStatus.m_ioDone = true;
+                        break;
+
+                    case ctsIoStatus::FailedIo:
+                        // write out the error
+                        ctsConfig::PrintErrorIfFailed(functionName, sharedPattern->GetLastPatternError());
+                        // the protocol acknowledged the failure - socket is done with IO
+                        returnStatus.m_ioErrorCode = sharedPattern->GetLastPatternError();
+                        returnStatus.m_ioDone = true;
+                        break;
+
+                    default:
+                        FAIL_FAST_MSG("ctsSendRecvIocp: unknown ctsSocket::IOStatus - %d\n", protocolStatus);
+                    }
+                }
+            }
+            catch (...)
+            {
+                returnStatus.m_ioErrorCode = ctsConfig::PrintThrownException();
+                returnStatus.m_ioDone = sharedPattern->CompleteIo(nextIo, 0, returnStatus.m_ioErrorCode) != ctsIoStatus::ContinueIo;
+                returnStatus.m_ioStarted = false;
+            }
+        }
+
+        return returnStatus;
+    }
+
+    //
+    // This is the callback for the threadpool timer.
+    // Processes the given task and then calls ctsSendRecvIocp function to deal with any additional tasks
+    //
+    static void ctsSendRecvTimerCallback(const std::weak_ptr<ctsSocket>& weakSocket, const ctsTask& nextIo) noexcept
+    {
+        // attempt to get a reference to the socket
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        // hold a reference on the socket
+        const auto lockedSocket = sharedSocket->AcquireSocketLock();
+        const auto lockedPattern = lockedSocket.GetPattern();
+        if (!lockedPattern)
+        {
+            return;
+        }
+        // if lockedSocket has an INVALID_SOCKET, continue below to ctsSendRecvProcessTask
+        // where it's handled appropriately
+
+        // increment IO for this IO request
+        sharedSocket->IncrementIo();
+
+        // run the ctsIOTask (next_io) that was scheduled through the TP timer
+        const ctsSendRecvStatus status = ctsSendRecvProcessTask(lockedSocket.GetSocket(), sharedSocket, lockedPattern, nextIo);
+        // if no IO was started, decrement the IO counter
+        if (!status.m_ioStarted)
+        {
+            if (0 == sharedSocket->DecrementIo())
+            {
+                // this should never be zero since we should be holding a ref-count for this callback
+                FAIL_FAST_MSG(
+                    "The ref-count of the ctsSocket object (%p) fell to zero during a scheduled callback", sharedSocket.get());
+            }
+        }
+        // continue requesting IO if this connection still isn't done with all IO after scheduling the prior IO
+        if (!status.m_ioDone)
+        {
+            ctsSendRecvIocp(weakSocket);
+        }
+        // finally decrement the IO that was counted for this IO that was completed async
+        if (sharedSocket->DecrementIo() == 0)
+        {
+            // if we have no more IO pended, complete the state
+            sharedSocket->CompleteState(status.m_ioErrorCode);
+        }
+    }
+
+    // The function registered with ctsConfig
+    void ctsSendRecvIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        // attempt to get a reference to the socket
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        // hold a reference on the socket
+        const auto lockedSocket = sharedSocket->AcquireSocketLock();
+        const auto lockedPattern = lockedSocket.GetPattern();
+        if (!lockedPattern)
+        {
+            return;
+        }
+        // if lockedSocket has an INVALID_SOCKET, continue below to ctsSendRecvProcessTask
+        // where it's handled appropriately
+
+        //
+        // loop until failure or initiate_io returns None
+        //
+        // IO is always done in the ctsProcessIOTask function,
+        // - either synchronously or scheduled through a timer object
+        //
+        // The IO ref-count must be incremented here to hold an IO count on the socket
+        // - so that we won't inadvertently call complete_state() while IO is still being scheduled
+        //
+        sharedSocket->IncrementIo();
+
+        ctsSendRecvStatus status{};
+        while (!status.m_ioDone)
+        {
+            const ctsTask nextIo = lockedPattern->InitiateIo();
+            if (ctsTaskAction::None == nextIo.m_ioAction)
+            {
+                // nothing failed, just no more IO right now
+                break;
+            }
+
+            // increment IO for each individual request
+            sharedSocket->IncrementIo();
+
+            if (nextIo.m_timeOffsetMilliseconds > 0)
+            {
+                // set_timer can throw
+                try
+                {
+                    sharedSocket->SetTimer(nextIo, ctsSendRecvTimerCallback);
+                    status.m_ioStarted = true; // IO started in the context of keeping the count incremented
+                    status.m_ioDone = true;
+                }
+                catch (...)
+                {
+                    status.m_ioErrorCode = ctsConfig::PrintThrownException();
+                    status.m_ioStarted = false;
+                }
+            }
+            else
+            {
+                status = ctsSendRecvProcessTask(lockedSocket.GetSocket(), sharedSocket, lockedPattern, nextIo);
+            }
+
+            // if no IO was started, decrement the IO counter
+            if (!status.m_ioStarted)
+            {
+                // since IO is not pended, remove the ref-count
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    // this should never be zero as we are holding a reference outside the loop
+                    FAIL_FAST_MSG(
+                        "The ctsSocket (%p) ref-count fell to zero while this function was holding a reference", sharedSocket.get());
+                }
+            }
+        }
+        // decrement IO at the end to release the ref-count held before the loop
+        if (0 == sharedSocket->DecrementIo())
+        {
+            sharedSocket->CompleteState(status.m_ioErrorCode);
+        }
+    }
+} // namespace
@@ -18,6 +18,7 @@ See the Apache Version 2.0 License for specific language governing permissions a
 // project headers
 #include "ctsConfig.h"
 #include "ctsSocketState.h"
+#include "ctsTCPFunctions.h"
 #include "ctsWinsockLayer.h"
 // wil headers always included last
 #include <wil/stl.h>
@@ -32,8 +33,9 @@ namespace ctsTraffic
     using namespace std;
 
     // default values are assigned in the class declaration
-    ctsSocket::ctsSocket(weak_ptr<ctsSocketState> parent) noexcept :
-        m_parent(std::move(parent))
+    ctsSocket::ctsSocket(weak_ptr<ctsSocketState> parent, uint32_t trafficClass) noexcept :
+        m_parent(std::move(parent)),
+        m_trafficClass(trafficClass)
     {
     }
 
@@ -104,6 +106,17 @@ namespace ctsTraffic
 
             m_socket.reset();
         }
+
+        if (m_localPort != 0)
+        {
+            // the side closing a TCP connection gracefully holds the port in TIME_WAIT - a RST does not
+            const auto timeWait =
+                0 == errorCode &&
+                ctsConfig::ProtocolType::TCP == g_configSettings->Protocol &&
+                g_configSettings->TcpShutdown != ctsConfig::TcpShutdownType::HardShutdown;
+            ctsWSASocketReleaseLocalPort(m_localPortAllocator, m_localPort, timeWait);
+            m_localPort = 0;
+        }
         return error;
     }
 
@@ -171,6 +184,46 @@ namespace ctsTraffic
         m_localSockaddr = localAddress;
     }
 
+    void ctsSocket::SetLocalPortLease(uint32_t allocatorIndex, uint16_t port) noexcept
+    {
+        const auto lock = m_lock.lock();
+        m_localPortAllocator = allocatorIndex;
+        m_localPort = port;
+    }
+
+    bool ctsSocket::ReplaceSocket(
+        wil::unique_socket& socket,
+        const wil::network::socket_address& localAddress,
+        const wil::network::socket_address& targetAddress,
+        uint32_t localPortAllocator,
+        uint16_t localPort) noexcept
+    {
+        const auto lock = m_lock.lock();
+        if (!m_socket)
+        {
+            return false;
+        }
+
+        FAIL_FAST_IF_MSG(
+            !!m_tpIocp,
+            "ctsSocket::ReplaceSocket called after the SOCKET (%Iu) was associated with the IOCP threadpool",
+            m_socket.get());
+
+        // the replaced socket may have connected just as it lost the race: don't leave it in TIME_WAIT
+        (void)ctsSetLingerToResetSocket(m_socket.get());
+        m_socket.reset(socket.release());
+        if (m_localPort != 0)
+        {
+            ctsWSASocketReleaseLocalPort(m_localPortAllocator, m_localPort, false);
+        }
+
+        m_localSockaddr = localAddress;
+        m_targetSockaddr = targetAddress;
+        m_localPortAllocator = localPortAllocator;
+        m_localPort = localPort;
+        return true;
+    }
+
     const wil::network::socket_address& ctsSocket::GetRemoteSockaddr() const noexcept
     {
         return m_targetSockaddr;
@@ -183,7 +236,7 @@ namespace ctsTraffic
 
     void ctsSocket::SetIoPattern()
     {
-        m_pattern = ctsIoPattern::MakeIoPattern();
+        m_pattern = ctsIoPattern::MakeIoPattern(m_trafficClass);
         if (!m_pattern)
         {
             // in test scenarios
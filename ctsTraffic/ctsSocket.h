@@ -80,8 +80,9 @@ public:
 
     //
     // constructor requiring a parent ctsSocketState weak reference
+    // - and the traffic class this socket was created for
     //
-    explicit ctsSocket(std::weak_ptr<ctsSocketState> parent) noexcept;
+    explicit ctsSocket(std::weak_ptr<ctsSocketState> parent, uint32_t trafficClass = ctsConfig::c_defaultTrafficClass) noexcept;
 
     _No_competing_thread_ ~ctsSocket() noexcept;
 
@@ -136,11 +137,37 @@ public:
     const wil::network::socket_address& GetRemoteSockaddr() const noexcept;
     void SetRemoteSockaddr(const wil::network::socket_address& targetAddress) noexcept;
 
+    //
+    // -LocalPort:[low,high]: the local port this socket was bound to, returned to its allocator when the socket is closed
+    //
+    void SetLocalPortLease(uint32_t allocatorIndex, uint16_t port) noexcept;
+
+    //
+    // -conn:HappyEyeballs: takes the socket which won the connection race in place of the socket created for this connection
+    // - the replaced socket is reset and closed, returning its local port if it had one
+    // - must be called before IO is started: the socket isn't yet associated with the IOCP threadpool
+    // - returns false, leaving the socket with the caller, if this socket was already closed
+    //
+    bool ReplaceSocket(
+        wil::unique_socket& socket,
+        const wil::network::socket_address& localAddress,
+        const wil::network::socket_address& targetAddress,
+        uint32_t localPortAllocator,
+        uint16_t localPort) noexcept;
+
     //
     // Get/Set the ctsIOPattern
     //
     void SetIoPattern();
 
+    //
+    // Gets the traffic class - which selects the target addresses and IO pattern settings
+    //
+    uint32_t GetTrafficClass() const noexcept
+    {
+        return m_trafficClass;
+    }
+
     //
     // methods for functors to use for ref-counting the # of IO they have issued on this socket
     //
@@ -193,6 +220,7 @@ private:
     std::weak_ptr<ctsSocketState> m_parent;
     // maintain a shared_ptr to the pattern
     std::shared_ptr<ctsIoPattern> m_pattern;
+    const uint32_t m_trafficClass;
 
     /// only guarded when returning to the caller
     std::shared_ptr<ctl::ctThreadIocp> m_tpIocp;
@@ -203,6 +231,9 @@ private:
     wil::network::socket_address m_localSockaddr;
     wil::network::socket_address m_targetSockaddr;
 
+    _Guarded_by_(m_lock) uint32_t m_localPortAllocator = 0;
+    _Guarded_by_(m_lock) uint16_t m_localPort = 0;
+
     uint32_t m_ioCount = 0L;
 
     static void NTAPI ThreadPoolTimerCallback(PTP_CALLBACK_INSTANCE, PVOID pContext, PTP_TIMER);
@@ -14,10 +14,15 @@ See the Apache Version 2.0 License for specific language governing permissions a
 // parent header
 #include "ctsSocketBroker.h"
 // cpp headers
+#include <algorithm>
 #include <memory>
 #include <iterator>
+#include <random>
+#include <utility>
 // os headers
 #include <Windows.h>
+// ctl headers
+#include <ctTimer.hpp>
 // wil headers
 #include <wil/stl.h>
 #include <wil/resource.h>
@@ -50,6 +55,45 @@ ctsSocketBroker::ctsSocketBroker()
             m_totalConnectionsRemaining = g_configSettings->Iterations * static_cast<ULONGLONG>(g_configSettings->ConnectionLimit);
         }
         m_pendingLimit = g_configSettings->ConnectionLimit;
+
+        for (const auto& trafficClass : g_configSettings->TrafficClasses)
+        {
+            TrafficClassSlots slots;
+            slots.m_connectionLimit = trafficClass.ConnectionLimit;
+            slots.m_connectionsRemaining = g_configSettings->Iterations == MAXULONGLONG
+                ? MAXULONGLONG
+                : g_configSettings->Iterations * static_cast<ULONGLONG>(trafficClass.ConnectionLimit);
+            m_trafficClassSlots.push_back(slots);
+        }
+
+        if (g_configSettings->ConnectionRate > 0)
+        {
+            auto arrivalProcess = ctsArrivalProcess::Constant;
+            if (ctsConfig::ConnectionArrivalType::Poisson == g_configSettings->ConnectionArrival)
+            {
+                arrivalProcess = ctsArrivalProcess::Poisson;
+            }
+            else if (ctsConfig::ConnectionArrivalType::Ramp == g_configSettings->ConnectionArrival)
+            {
+                arrivalProcess = ctsArrivalProcess::Ramp;
+            }
+            m_connectionScheduler.emplace(
+                arrivalProcess,
+                static_cast<double>(g_configSettings->ConnectionRate),
+                static_cast<int64_t>(g_configSettings->ConnectionRampTimeMs) * 1000LL,
+                std::random_device{}());
+            m_scheduledConnections = m_totalConnectionsRemaining;
+
+            // high-resolution timers are only available on newer OS versions
+            m_scheduleTimer.reset(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS));
+            if (!m_scheduleTimer)
+            {
+                m_scheduleTimer.reset(CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS));
+                THROW_LAST_ERROR_IF(!m_scheduleTimer);
+            }
+            m_scheduleWait.reset(CreateThreadpoolWait(ScheduleWaitCallback, this, g_configSettings->pTpEnvironment));
+            THROW_LAST_ERROR_IF(!m_scheduleWait);
+        }
     }
 
     // make sure pending_limit cannot be larger than total_connections_remaining
@@ -65,15 +109,27 @@ ctsSocketBroker::ctsSocketBroker()
 ctsSocketBroker::~ctsSocketBroker() noexcept
 {
     // first signal the done event to stop work
-    m_doneEvent.SetEvent();
+    // - under the lock, since StartScheduledSockets checks it under the lock before re-arming the schedule wait
+    {
+        const auto lock = m_lock.lock();
+        m_doneEvent.SetEvent();
+
+        // -ConnectionRate: the run stopped before every start was made (e.g. -TimeLimit)
+        if (m_connectionScheduler && m_scheduleStartUsec > 0 && !m_scheduleEnded)
+        {
+            RecordScheduleEnd(ctl::ctTimer::snap_qpc_as_usec());
+        }
+    }
 
     // next stop the TP if anything is running or queued
     m_tpFlatQueue.cancel();
+    m_scheduleWait.reset();
 
     // now delete all children, guaranteeing they stop processing
     // - must do this explicitly before deleting the CS
     //   in case they were calling back while we called detach
     m_socketPool.clear();
+    m_closedSockets.clear();
 }
 
 void ctsSocketBroker::Start()
@@ -82,6 +138,17 @@ void ctsSocketBroker::Start()
         L"\t\tStarting broker: total connections remaining (0x%llx), pending limit (0x%x)\n",
         m_totalConnectionsRemaining, m_pendingLimit);
 
+    if (m_connectionScheduler)
+    {
+        {
+            const auto lock = m_lock.lock();
+            m_scheduleStartUsec = ctl::ctTimer::snap_qpc_as_usec();
+            m_connectionScheduler->Start(m_scheduleStartUsec);
+        }
+        StartScheduledSockets();
+        return;
+    }
+
     // must always guard access to the vector
     const auto lock = m_lock.lock();
 
@@ -97,19 +164,202 @@ void ctsSocketBroker::Start()
             break;
         }
 
-        m_socketPool.push_back(make_shared<ctsSocketState>(shared_from_this()));
-        (*m_socketPool.rbegin())->Start();
-        ++m_pendingSockets;
-        --m_totalConnectionsRemaining;
+        const auto trafficClass = NextTrafficClass();
+        if (!trafficClass)
+        {
+            break;
+        }
+        CreateSocketState(*trafficClass);
     }
 }
 
+std::optional<uint32_t> ctsSocketBroker::NextTrafficClass() const noexcept
+{
+    if (m_trafficClassSlots.empty())
+    {
+        return ctsConfig::c_defaultTrafficClass;
+    }
+
+    const auto classCount = static_cast<uint32_t>(m_trafficClassSlots.size());
+    for (uint32_t count = 0; count < classCount; ++count)
+    {
+        const auto trafficClass = (m_nextTrafficClass + count) % classCount;
+        const auto& slots = m_trafficClassSlots[trafficClass];
+        if (slots.m_connectionsRemaining > 0 &&
+            slots.m_pendingSockets + slots.m_activeSockets < slots.m_connectionLimit)
+        {
+            return trafficClass;
+        }
+    }
+    return std::nullopt;
+}
+
+void ctsSocketBroker::CreateSocketState(uint32_t trafficClass)
+{
+    // reuse a slot handed back by a closed socket before growing the table
+    uint32_t brokerSlot;
+    if (m_freeSlots.empty())
+    {
+        brokerSlot = static_cast<uint32_t>(m_socketPool.size());
+        m_socketPool.emplace_back();
+    }
+    else
+    {
+        brokerSlot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+
+    try
+    {
+        m_socketPool[brokerSlot] = std::allocate_shared<ctsSocketState>(ctsPoolAllocator<ctsSocketState>{}, shared_from_this(), trafficClass, brokerSlot);
+    }
+    catch (...)
+    {
+        m_freeSlots.push_back(brokerSlot);
+        throw;
+    }
+    m_socketPool[brokerSlot]->Start();
+    ++m_pendingSockets;
+    --m_totalConnectionsRemaining;
+
+    if (trafficClass < m_trafficClassSlots.size())
+    {
+        auto& slots = m_trafficClassSlots[trafficClass];
+        ++slots.m_pendingSockets;
+        --slots.m_connectionsRemaining;
+        m_nextTrafficClass = (trafficClass + 1) % static_cast<uint32_t>(m_trafficClassSlots.size());
+    }
+}
+
+void ctsSocketBroker::StartScheduledSockets() noexcept try
+{
+    for (;;)
+    {
+        int64_t nextStartUsec{};
+        {
+            const auto lock = m_lock.lock();
+            if (m_doneEvent.is_signaled() || !StartDueSockets())
+            {
+                return;
+            }
+
+            nextStartUsec = m_connectionScheduler->NextStartUsec();
+            const auto waitUsec = nextStartUsec - ctl::ctTimer::snap_qpc_as_usec();
+            if (waitUsec > c_scheduleSpinUsec)
+            {
+                // wake early by c_scheduleSpinUsec - a negative due time is relative, in 100ns units
+                LARGE_INTEGER dueTime{};
+                dueTime.QuadPart = -((waitUsec - c_scheduleSpinUsec) * 10LL);
+                THROW_IF_WIN32_BOOL_FALSE(SetWaitableTimer(m_scheduleTimer.get(), &dueTime, 0, nullptr, nullptr, FALSE));
+                SetThreadpoolWait(m_scheduleWait.get(), m_scheduleTimer.get(), nullptr);
+                return;
+            }
+        }
+
+        // the next start is too soon for the timer: wait for it outside the lock
+        while (ctl::ctTimer::snap_qpc_as_usec() < nextStartUsec)
+        {
+            if (m_doneEvent.is_signaled())
+            {
+                return;
+            }
+            YieldProcessor();
+        }
+    }
+}
+catch (...)
+{
+    ctsConfig::PrintThrownException();
+    // retry the schedule once a connection closes
+    const auto lock = m_lock.lock();
+    m_scheduleBlocked = true;
+}
+
+bool ctsSocketBroker::StartDueSockets()
+{
+    auto& scheduler = *m_connectionScheduler;
+    while (m_totalConnectionsRemaining > 0)
+    {
+        auto startUsec = ctl::ctTimer::snap_qpc_as_usec();
+        if (!scheduler.IsDue(startUsec))
+        {
+            m_scheduleBlocked = false;
+            return true;
+        }
+        TrackScheduleBehind(startUsec);
+
+        // the start stays due while the limits hold it back - its lateness keeps growing until it's made
+        // ReSharper disable once CppRedundantParentheses
+        if ((m_pendingSockets + m_activeSockets) >= g_configSettings->ConnectionLimit ||
+            m_pendingSockets >= g_configSettings->ConnectionThrottleLimit)
+        {
+            m_scheduleBlocked = true;
+            return false;
+        }
+        const auto trafficClass = NextTrafficClass();
+        if (!trafficClass)
+        {
+            m_scheduleBlocked = true;
+            return false;
+        }
+
+        CreateSocketState(*trafficClass);
+        startUsec = ctl::ctTimer::snap_qpc_as_usec();
+        const auto latenessUsec = startUsec - scheduler.TakeStart();
+        g_configSettings->ConnectionStartLatenessUsec.Add(latenessUsec);
+        if (latenessUsec > c_lateStartUsec)
+        {
+            g_configSettings->ConnectionLateStarts.Increment();
+        }
+        g_configSettings->ConnectionRateStarts.Increment();
+    }
+
+    // every start has been made
+    if (!m_scheduleEnded)
+    {
+        RecordScheduleEnd(ctl::ctTimer::snap_qpc_as_usec());
+    }
+    m_scheduleBlocked = false;
+    return false;
+}
+
+void ctsSocketBroker::TrackScheduleBehind(int64_t nowUsec) const noexcept
+{
+    // with -ConnectionArrival:poisson, behind the expected count of starts by then
+    const auto intendedStarts = std::min<ULONGLONG>(m_connectionScheduler->IntendedStartsBy(nowUsec), m_scheduledConnections);
+    const auto startsTaken = m_connectionScheduler->GetStartsTaken();
+    if (intendedStarts > startsTaken)
+    {
+        const auto behind = static_cast<int64_t>(intendedStarts - startsTaken);
+        if (behind > g_configSettings->ConnectionRateMaxBehind.GetValue())
+        {
+            g_configSettings->ConnectionRateMaxBehind.SetValue(behind);
+        }
+    }
+}
+
+void ctsSocketBroker::RecordScheduleEnd(int64_t endUsec) noexcept
+{
+    m_scheduleEnded = true;
+    TrackScheduleBehind(endUsec);
+
+    // computed at the end rather than at the last start: starts still held back when the run stopped count as intended
+    const auto intendedStarts = std::min<ULONGLONG>(m_connectionScheduler->IntendedStartsBy(endUsec), m_scheduledConnections);
+    g_configSettings->ConnectionRateIntended.SetValue(static_cast<int64_t>(intendedStarts));
+    g_configSettings->ConnectionRateElapsedUsec.SetValue(endUsec - m_scheduleStartUsec);
+}
+
+void CALLBACK ctsSocketBroker::ScheduleWaitCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WAIT, TP_WAIT_RESULT) noexcept
+{
+    static_cast<ctsSocketBroker*>(context)->StartScheduledSockets();
+}
+
 //
 // SocketState is indicating the socket is now 'connected'
 // - and will be pumping IO
 // Update pending and active counts under guard
 //
-void ctsSocketBroker::InitiatingIo() noexcept
+void ctsSocketBroker::InitiatingIo(uint32_t trafficClass) noexcept
 {
     const auto lock = m_lock.lock();
 
@@ -121,6 +371,17 @@ void ctsSocketBroker::InitiatingIo() noexcept
     --m_pendingSockets;
     ++m_activeSockets;
 
+    if (trafficClass < m_trafficClassSlots.size())
+    {
+        auto& slots = m_trafficClassSlots[trafficClass];
+        FAIL_FAST_IF_MSG(
+            slots.m_pendingSockets == 0,
+            "ctsSocketBroker::initiating_io - About to decrement pending_sockets for traffic class %u, but pending_sockets == 0",
+            trafficClass);
+        --slots.m_pendingSockets;
+        ++slots.m_activeSockets;
+    }
+
     m_tpFlatQueue.submit([&] { RefreshSockets(); });
 }
 
@@ -128,10 +389,29 @@ void ctsSocketBroker::InitiatingIo() noexcept
 // SocketState is indicating the socket is now 'closed'
 // Update pending or active counts (depending on prior state) under guard
 //
-void ctsSocketBroker::Closing(bool wasActive) noexcept
+void ctsSocketBroker::Closing(uint32_t trafficClass, bool wasActive, uint32_t brokerSlot) noexcept
 {
     const auto lock = m_lock.lock();
 
+    // hand the closed socket back from its slot - it's deleted outside the lock in RefreshSockets
+    // - the slot is empty if RefreshSockets already took the whole pool when exiting
+    if (brokerSlot < m_socketPool.size() && m_socketPool[brokerSlot])
+    {
+        m_closedSockets.emplace_back(std::move(m_socketPool[brokerSlot]));
+        m_freeSlots.push_back(brokerSlot);
+    }
+
+    if (trafficClass < m_trafficClassSlots.size())
+    {
+        auto& slots = m_trafficClassSlots[trafficClass];
+        auto& slotCount = wasActive ? slots.m_activeSockets : slots.m_pendingSockets;
+        FAIL_FAST_IF_MSG(
+            slotCount == 0,
+            "ctsSocketBroker::closing - About to decrement sockets for traffic class %u, but the count == 0 (wasActive == %d)",
+            trafficClass, wasActive);
+        --slotCount;
+    }
+
     if (wasActive)
     {
         FAIL_FAST_IF_MSG(
@@ -179,7 +459,7 @@ bool ctsSocketBroker::Wait(DWORD milliseconds) const noexcept
 }
 
 //
-// Timer callback to scavenge any closed sockets
+// Threadpool callback to delete any closed sockets handed back through Closing
 // Then refresh sockets that should be created anew
 //
 void ctsSocketBroker::RefreshSockets() noexcept try
@@ -188,9 +468,12 @@ void ctsSocketBroker::RefreshSockets() noexcept try
     std::vector<std::shared_ptr<ctsSocketState>> removedObjects;
 
     auto exiting = false;
+    auto resumeSchedule = false;
     try
     {
         const auto lock = m_lock.lock();
+        removedObjects = std::move(m_closedSockets);
+        m_closedSockets.clear();
 
         exiting = 0 == m_totalConnectionsRemaining &&
                   0 == m_pendingSockets &&
@@ -198,46 +481,44 @@ void ctsSocketBroker::RefreshSockets() noexcept try
 
         if (exiting)
         {
-            removedObjects = std::move(m_socketPool);
+            std::ranges::move(m_socketPool, std::back_inserter(removedObjects));
+            m_socketPool.clear();
+            m_freeSlots.clear();
         }
-        else
+        else if (m_connectionScheduler)
         {
-            std::erase_if(m_socketPool, [&](const auto& socketPoolEntry) {
-                if (ctsSocketState::InternalState::Closed == socketPoolEntry->GetCurrentState())
-                {
-                    removedObjects.emplace_back(std::move(socketPoolEntry));
-                    return true;
-                }
-                return false;
-            });
-
-            if (!m_doneEvent.is_signaled())
+            // -ConnectionRate: connections are only started on the schedule
+            // - resume it if a due start was held back by the connection limits
+            resumeSchedule = !m_doneEvent.is_signaled() && std::exchange(m_scheduleBlocked, false);
+        }
+        else if (!m_doneEvent.is_signaled())
+        {
+            // don't spin up more if the user asked to shut down
+            // catch up to the expected # of pended connections
+            while (m_pendingSockets < m_pendingLimit && m_totalConnectionsRemaining > 0)
             {
-                // don't spin up more if the user asked to shut down
-                // catch up to the expected # of pended connections
-                while (m_pendingSockets < m_pendingLimit && m_totalConnectionsRemaining > 0)
+                // not throttling the server accepting sockets based off total # of connections (pending + active)
+                // - only throttling total connections for outgoing connections
+                if (!g_configSettings->AcceptFunction)
                 {
-                    // not throttling the server accepting sockets based off total # of connections (pending + active)
-                    // - only throttling total connections for outgoing connections
-                    if (!g_configSettings->AcceptFunction)
+                    // ReSharper disable once CppRedundantParentheses
+                    if ((m_pendingSockets + m_activeSockets) >= g_configSettings->ConnectionLimit)
+                    {
+                        break;
+                    }
+                    // throttle pending connection attempts as specified
+                    if (m_pendingSockets >= g_configSettings->ConnectionThrottleLimit)
                     {
-                        // ReSharper disable once CppRedundantParentheses
-                        if ((m_pendingSockets + m_activeSockets) >= g_configSettings->ConnectionLimit)
-                        {
-                            break;
-                        }
-                        // throttle pending connection attempts as specified
-                        if (m_pendingSockets >= g_configSettings->ConnectionThrottleLimit)
-                        {
-                            break;
-                        }
+                        break;
                     }
+                }
 
-                    m_socketPool.push_back(make_shared<ctsSocketState>(shared_from_this()));
-                    (*m_socketPool.rbegin())->Start();
-                    ++m_pendingSockets;
-                    --m_totalConnectionsRemaining;
+                const auto trafficClass = NextTrafficClass();
+                if (!trafficClass)
+                {
+                    break;
                 }
+                CreateSocketState(*trafficClass);
             }
         }
     }
@@ -248,6 +529,11 @@ void ctsSocketBroker::RefreshSockets() noexcept try
 
     removedObjects.clear();
 
+    if (resumeSchedule)
+    {
+        StartScheduledSockets();
+    }
+
     if (exiting)
     {
         SetEvent(m_doneEvent.get());
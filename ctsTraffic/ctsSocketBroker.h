@@ -16,12 +16,14 @@ See the Apache Version 2.0 License for specific language governing permissions a
 // cpp headers
 #include <vector>
 #include <memory>
+#include <optional>
 // os headers
 #include <Windows.h>
 // wil headers
 #include <wil/resource.h>
 // project headers
 #include "ctsConfig.h"
+#include "ctsConnectionScheduler.hpp"
 #include "ctsSocketState.h"
 #include "ctThreadpoolQueue.hpp"
 
@@ -46,8 +48,9 @@ public:
     void Start();
 
     // methods that the child ctsSocketState objects will invoke when they change state
-    void InitiatingIo() noexcept;
-    void Closing(bool wasActive) noexcept;
+    void InitiatingIo(uint32_t trafficClass) noexcept;
+    // - brokerSlot is the index the broker gave the ctsSocketState when it was created
+    void Closing(uint32_t trafficClass, bool wasActive, uint32_t brokerSlot) noexcept;
 
     // method to wait on when all connections are completed
     bool Wait(DWORD milliseconds) const noexcept;
@@ -60,15 +63,40 @@ public:
 
 private:
     void RefreshSockets() noexcept;
+    // must be called with m_lock held
+    // - returns the traffic class for the next socket, or nullopt if no class has an open slot
+    std::optional<uint32_t> NextTrafficClass() const noexcept;
+    void CreateSocketState(uint32_t trafficClass);
+
+    // -ConnectionRate: makes the starts the schedule has due, then waits for the next one
+    // - waiting on a high-resolution timer, spinning out the last c_scheduleSpinUsec
+    void StartScheduledSockets() noexcept;
+    // must be called with m_lock held
+    // - makes every due start the connection limits allow, returning false if no more starts can be made
+    //   until a connection closes (m_scheduleBlocked is set) or all connections have been started
+    bool StartDueSockets();
+    // must be called with m_lock held
+    // - tracks the most due starts not yet made (ConnectionRateMaxBehind)
+    void TrackScheduleBehind(int64_t nowUsec) const noexcept;
+    // must be called with m_lock held
+    // - the timeline ends once every start was made, or when the run stops before then:
+    //   records how many starts it intended by endUsec, and how long it ran
+    void RecordScheduleEnd(int64_t endUsec) noexcept;
+    static void CALLBACK ScheduleWaitCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WAIT, TP_WAIT_RESULT) noexcept;
 
     // CS to guard access to the vector socket_pool
     wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
     // notification event when we're done
     wil::unique_event_nothrow m_doneEvent;
-    // vector of currently active sockets
+    // slot table of currently active sockets, indexed by the slot given to each ctsSocketState
     // must be shared_ptr since ctsSocketState derives from enable_shared_from_this
     // - and thus there must be at least one ref-count on that object to call shared_from_this()
+    // - a closing ctsSocketState hands back its slot, so reclaiming and reusing a slot is O(1)
     std::vector<std::shared_ptr<ctsSocketState>> m_socketPool{};
+    // slots in m_socketPool that are free to be reused
+    std::vector<uint32_t> m_freeSlots{};
+    // closed sockets removed from their slot, waiting to be deleted outside the lock in RefreshSockets
+    std::vector<std::shared_ptr<ctsSocketState>> m_closedSockets{};
     // keep a burn-down count as connections are made to know when to be 'done'
     ULONGLONG m_totalConnectionsRemaining = 0ULL;
     // track what's pended and what's active
@@ -76,6 +104,33 @@ private:
     uint32_t m_pendingSockets = 0UL;
     uint32_t m_activeSockets = 0UL;
 
+    // when traffic classes are configured, each class is given its own slots from the above totals
+    struct TrafficClassSlots
+    {
+        ULONGLONG m_connectionsRemaining = 0ULL;
+        uint32_t m_connectionLimit = 0UL;
+        uint32_t m_pendingSockets = 0UL;
+        uint32_t m_activeSockets = 0UL;
+    };
+    std::vector<TrafficClassSlots> m_trafficClassSlots{};
+    // the class to try first for the next slot - classes are filled round-robin so no class is starved
+    uint32_t m_nextTrafficClass = 0UL;
+
+    // -ConnectionRate: the open-loop timeline of connection starts, and the timer waited on for the next one
+    std::optional<ctsConnectionScheduler> m_connectionScheduler{};
+    wil::unique_handle m_scheduleTimer{};
+    wil::unique_threadpool_wait m_scheduleWait{};
+    int64_t m_scheduleStartUsec = 0;
+    // the starts the timeline makes over the run, so it never intends more
+    ULONGLONG m_scheduledConnections = 0ULL;
+    bool m_scheduleEnded = false;
+    // a due start is held back by the connection limits: it's made once RefreshSockets sees a connection close
+    bool m_scheduleBlocked = false;
+    // the timer can't reliably wake sooner than this before a start: the rest is waited for on the threadpool thread
+    static constexpr int64_t c_scheduleSpinUsec = 1000;
+    // a start made more than this long after its intended time is counted as late
+    static constexpr int64_t c_lateStartUsec = 1000;
+
     ctl::ctThreadpoolQueue<ctl::ctThreadpoolGrowthPolicy::Flat> m_tpFlatQueue;
 };
 } // namespace
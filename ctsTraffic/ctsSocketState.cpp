@@ -27,11 +27,12 @@ using ctsTraffic::ctsConfig::g_configSettings;
 
 namespace ctsTraffic
 {
-ctsSocketState::ctsSocketState(std::weak_ptr<ctsSocketBroker> pBroker) :
-    m_broker(std::move(pBroker))
+ctsSocketState::ctsSocketState(std::weak_ptr<ctsSocketBroker> pBroker, uint32_t trafficClass, uint32_t brokerSlot) :
+    m_threadPoolWorker(ThreadPoolWorker, this, g_configSettings->pTpEnvironment),
+    m_broker(std::move(pBroker)),
+    m_trafficClass(trafficClass),
+    m_brokerSlot(brokerSlot)
 {
-    m_threadPoolWorker.reset(CreateThreadpoolWork(ThreadPoolWorker, this, g_configSettings->pTpEnvironment));
-    THROW_LAST_ERROR_IF_NULL(m_threadPoolWorker.get());
 }
 
 ctsSocketState::~ctsSocketState() noexcept
@@ -79,7 +80,9 @@ void ctsSocketState::CompleteState(DWORD error) noexcept
                 else
                 {
                     m_state = InternalState::InitiatingIo;
-                    g_configSettings->ConnectionStatusDetails.m_activeConnectionCount.Increment();
+                    UpdateConnectionStatistics([](ctsConnectionStatistics& statistics) noexcept {
+                        statistics.m_activeConnectionCount.Increment();
+                    });
                 }
                 break;
             }
@@ -87,7 +90,9 @@ void ctsSocketState::CompleteState(DWORD error) noexcept
             case InternalState::Connected:
             {
                 m_state = InternalState::InitiatingIo;
-                g_configSettings->ConnectionStatusDetails.m_activeConnectionCount.Increment();
+                UpdateConnectionStatistics([](ctsConnectionStatistics& statistics) noexcept {
+                    statistics.m_activeConnectionCount.Increment();
+                });
                 break;
             }
 
@@ -152,7 +157,7 @@ VOID NTAPI ctsSocketState::ThreadPoolWorker(PTP_CALLBACK_INSTANCE, PVOID context
         {
             try
             {
-                thisPtr->m_socket = std::make_shared<ctsSocket>(thisPtr->shared_from_this());
+                thisPtr->m_socket = std::allocate_shared<ctsSocket>(ctsPoolAllocator<ctsSocket>{}, thisPtr->shared_from_this(), thisPtr->m_trafficClass);
 
                 auto lock = thisPtr->m_stateGuard.lock();
                 thisPtr->m_state = InternalState::Created;
@@ -184,7 +189,7 @@ VOID NTAPI ctsSocketState::ThreadPoolWorker(PTP_CALLBACK_INSTANCE, PVOID context
             // notify the broker when initiating IO
             if (const auto parent = thisPtr->m_broker.lock())
             {
-                parent->InitiatingIo();
+                parent->InitiatingIo(thisPtr->m_trafficClass);
             }
 
             try
@@ -212,30 +217,35 @@ VOID NTAPI ctsSocketState::ThreadPoolWorker(PTP_CALLBACK_INSTANCE, PVOID context
         //   on a threadpool thread - in which case it would deadlock on itself
         case InternalState::Closing:
         {
+            const auto lastError = thisPtr->m_lastError;
             if (thisPtr->m_initiatedIo)
             {
-                // Update the status counter if we previously tracked this connection as active
-                g_configSettings->ConnectionStatusDetails.m_activeConnectionCount.Decrement();
-
-                // Update the historic stats for this connection
-                if (0 == thisPtr->m_lastError)
-                {
-                    g_configSettings->ConnectionStatusDetails.m_successfulCompletionCount.Increment();
-                }
-                else if (ctsIoPattern::IsProtocolError(thisPtr->m_lastError))
-                {
-                    g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.Increment();
-                }
-                else
-                {
-                    g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.Increment();
-                }
+                thisPtr->UpdateConnectionStatistics([lastError](ctsConnectionStatistics& statistics) noexcept {
+                    // Update the status counter if we previously tracked this connection as active
+                    statistics.m_activeConnectionCount.Decrement();
+
+                    // Update the historic stats for this connection
+                    if (0 == lastError)
+                    {
+                        statistics.m_successfulCompletionCount.Increment();
+                    }
+                    else if (ctsIoPattern::IsProtocolError(lastError))
+                    {
+                        statistics.m_protocolErrorCount.Increment();
+                    }
+                    else
+                    {
+                        statistics.m_connectionErrorCount.Increment();
+                    }
+                });
             }
             else
             {
                 // if this socket never started IO, it never created an io_pattern to track stats
-                // - in this case, directly track the failures in the global stats
-                g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.Increment();
+                // - in this case, directly track the failures in the global and traffic class stats
+                thisPtr->UpdateConnectionStatistics([](ctsConnectionStatistics& statistics) noexcept {
+                    statistics.m_connectionErrorCount.Increment();
+                });
             }
 
             if (thisPtr->m_socket)
@@ -249,15 +259,15 @@ VOID NTAPI ctsSocketState::ThreadPoolWorker(PTP_CALLBACK_INSTANCE, PVOID context
                 }
             }
 
-            // update the state last, since ctsBroker looks for this state value
-            // - to know when to delete the ctsSocketState instance
+            // update the state last, before handing our slot back to ctsBroker
+            // - which deletes the ctsSocketState instance once it's Closed
             auto lock = thisPtr->m_stateGuard.lock();
             thisPtr->m_state = InternalState::Closed;
             lock.reset();
 
             if (const auto parent = thisPtr->m_broker.lock())
             {
-                parent->Closing(thisPtr->m_initiatedIo);
+                parent->Closing(thisPtr->m_trafficClass, thisPtr->m_initiatedIo, thisPtr->m_brokerSlot);
             }
 
             PRINT_DEBUG_INFO(L"\t\tctsSocketState Closed\n");
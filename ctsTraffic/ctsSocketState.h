@@ -21,6 +21,7 @@ See the Apache Version 2.0 License for specific language governing permissions a
 #include <wil/resource.h>
 
 #include "ctsConfig.h"
+#include "ctsObjectPool.hpp"
 
 namespace ctsTraffic
 {
@@ -58,7 +59,12 @@ public:
     };
 
     // constructor requires a parent ctsSocketBroker
-    explicit ctsSocketState(std::weak_ptr<ctsSocketBroker> pBroker);
+    // - and the traffic class this connection is counted against
+    // - and the slot the broker tracks this instance in, handed back when Closing
+    explicit ctsSocketState(
+        std::weak_ptr<ctsSocketBroker> pBroker,
+        uint32_t trafficClass = ctsConfig::c_defaultTrafficClass,
+        uint32_t brokerSlot = 0);
 
     ~ctsSocketState() noexcept;
 
@@ -79,6 +85,16 @@ public:
     //
     InternalState GetCurrentState() const noexcept;
 
+    uint32_t GetTrafficClass() const noexcept
+    {
+        return m_trafficClass;
+    }
+
+    uint32_t GetBrokerSlot() const noexcept
+    {
+        return m_brokerSlot;
+    }
+
     ctsSocketState(const ctsSocketState&) = delete;
     ctsSocketState& operator=(const ctsSocketState&) = delete;
     ctsSocketState(ctsSocketState&&) = delete;
@@ -89,14 +105,29 @@ private:
     // private members of ctsSocketState
     // - CS's are mutable to allow taking a CS in a const function
     //
-    wil::unique_threadpool_work m_threadPoolWorker{};
+    ctsPooledThreadpoolWork m_threadPoolWorker{};
     mutable wil::critical_section m_stateGuard{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
     std::weak_ptr<ctsSocketBroker> m_broker{};
     std::shared_ptr<ctsSocket> m_socket{};
     InternalState m_state = InternalState::Creating;
     uint32_t m_lastError = 0UL;
+    const uint32_t m_trafficClass;
+    const uint32_t m_brokerSlot;
     bool m_initiatedIo = false;
 
+    //
+    // connection statistics are updated in the global stats and the stats of this socket's traffic class
+    //
+    template <typename T>
+    void UpdateConnectionStatistics(T&& update) const noexcept
+    {
+        update(ctsConfig::g_configSettings->ConnectionStatusDetails);
+        if (auto* const trafficClass = ctsConfig::g_configSettings->GetTrafficClass(m_trafficClass))
+        {
+            update(trafficClass->ConnectionStatusDetails);
+        }
+    }
+
     //
     // static threadpool callback function
     //
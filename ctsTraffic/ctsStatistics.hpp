@@ -14,7 +14,9 @@ See the Apache Version 2.0 License for specific language governing permissions a
 // ReSharper disable CppInconsistentNaming
 #pragma once
 // cpp headers
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cstring>
 // os headers
 #include <Windows.h>
@@ -197,6 +199,124 @@ namespace ctsTraffic {
 		}
 	};
 
+	//
+	// Lock-free log-linear histogram for latency values (e.g. microseconds)
+	// - every power of 2 is split into c_subBuckets linear buckets
+	//   so a reported percentile is within 1/c_subBuckets (12.5%) of the actual value
+	// - values beyond the last bucket are counted in the last bucket
+	//
+	struct ctsLatencyHistogram
+	{
+	private:
+		static constexpr uint32_t c_subBucketBits = 3;
+		static constexpr uint32_t c_subBuckets = 1ul << c_subBucketBits;
+		// values up to 2^40 (~12 days in microseconds)
+		static constexpr uint32_t c_bucketCount = (40 - c_subBucketBits + 1) * c_subBuckets;
+
+		std::array<std::atomic<int64_t>, c_bucketCount> m_buckets{};
+		std::atomic<int64_t> m_count{};
+		std::atomic<int64_t> m_sum{};
+		std::atomic<int64_t> m_max{};
+
+		static uint32_t BucketIndex(uint64_t value) noexcept
+		{
+			if (value < c_subBuckets)
+			{
+				return static_cast<uint32_t>(value);
+			}
+			// the bits below the top (c_subBucketBits + 1) bits are dropped
+			const auto shift = static_cast<uint32_t>(std::bit_width(value)) - 1 - c_subBucketBits;
+			const auto index = (shift + 1) * c_subBuckets + static_cast<uint32_t>((value >> shift) & (c_subBuckets - 1));
+			return index < c_bucketCount ? index : c_bucketCount - 1;
+		}
+
+		// returns the largest value that would be counted in the bucket
+		static int64_t BucketUpperBound(uint32_t index) noexcept
+		{
+			if (index < c_subBuckets)
+			{
+				return index;
+			}
+			const auto shift = index / c_subBuckets - 1;
+			const auto subBucket = index % c_subBuckets;
+			return static_cast<int64_t>(((static_cast<uint64_t>(c_subBuckets) + subBucket + 1) << shift) - 1);
+		}
+
+	public:
+		ctsLatencyHistogram() noexcept = default;
+		~ctsLatencyHistogram() noexcept = default;
+		// non-copyable
+		ctsLatencyHistogram(const ctsLatencyHistogram&) = delete;
+		ctsLatencyHistogram& operator=(const ctsLatencyHistogram&) = delete;
+		ctsLatencyHistogram(ctsLatencyHistogram&&) = delete;
+		ctsLatencyHistogram& operator=(ctsLatencyHistogram&&) = delete;
+
+		void Add(int64_t value) noexcept
+		{
+			if (value < 0)
+			{
+				value = 0;
+			}
+
+			m_buckets[BucketIndex(static_cast<uint64_t>(value))].fetch_add(1);
+			m_count.fetch_add(1);
+			m_sum.fetch_add(value);
+
+			auto currentMax = m_max.load();
+			while (value > currentMax && !m_max.compare_exchange_weak(currentMax, value))
+			{
+			}
+		}
+
+		[[nodiscard]] int64_t GetCount() const noexcept
+		{
+			return m_count.load();
+		}
+
+		[[nodiscard]] int64_t GetMax() const noexcept
+		{
+			return m_max.load();
+		}
+
+		[[nodiscard]] int64_t GetMean() const noexcept
+		{
+			const auto count = m_count.load();
+			return count > 0 ? m_sum.load() / count : 0;
+		}
+
+		//
+		// Returns the value at the requested percentile (0.0 - 100.0)
+		// - reports the upper bound of the bucket the percentile falls in (never larger than the max value seen)
+		//
+		[[nodiscard]] int64_t GetPercentile(double percentile) const noexcept
+		{
+			const auto count = m_count.load();
+			if (0 == count)
+			{
+				return 0;
+			}
+
+			auto target = static_cast<int64_t>(static_cast<double>(count) * percentile / 100.0 + 0.5);
+			if (target < 1)
+			{
+				target = 1;
+			}
+
+			int64_t seen = 0;
+			for (uint32_t index = 0; index < c_bucketCount; ++index)
+			{
+				seen += m_buckets[index].load();
+				if (seen >= target)
+				{
+					const auto upperBound = BucketUpperBound(index);
+					const auto maxValue = m_max.load();
+					return upperBound < maxValue ? upperBound : maxValue;
+				}
+			}
+			return m_max.load();
+		}
+	};
+
 
 	struct ctsConnectionStatistics
 	{
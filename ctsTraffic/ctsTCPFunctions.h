@@ -1,37 +1,88 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-#pragma once
-
-// cpp headers
-#include <memory>
-// project headers
-#include "ctsSocket.h"
-
-namespace ctsTraffic
-{
-// ReSharper disable once CppInconsistentNaming
-void ctsWSASocket(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-
-void ctsConnectByName(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-
-void ctsSimpleConnect(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-void ctsSimpleAccept(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-
-void ctsAcceptEx(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-void ctsConnectEx(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-
-void ctsReadWriteIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-void ctsSendRecvIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-void ctsRioIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
-}
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+
+// cpp headers
+#include <cstdint>
+#include <memory>
+#include <vector>
+// project headers
+#include "ctsSocket.h"
+
+namespace ctsTraffic
+{
+// ReSharper disable once CppInconsistentNaming
+void ctsWSASocket(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+// -SocketPool: takes a socket from the pool filled in the background - the pool is filled by ctsWSASocketPoolStart, which can throw
+void ctsWSASocketPooled(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsWSASocketPoolStart();
+// -LocalPort:[low,high]: sockets are bound to ports handed out by ctsWSASocketLocalPortsStart's allocators
+// - ctsSocket returns its port when closed, held back while a gracefully closed TCP connection is in TIME_WAIT
+void ctsWSASocketLocalPortsStart();
+void ctsWSASocketReleaseLocalPort(uint32_t allocatorIndex, uint16_t port, bool timeWait) noexcept;
+// -conn:HappyEyeballs: a socket created, configured, and bound to race against the connection's own socket
+struct ctsRaceSocket
+{
+    wil::unique_socket Socket;
+    wil::network::socket_address LocalAddress;
+    // -LocalPort:[low,high]: the port leased from the allocator - zero if none
+    uint32_t LocalPortAllocator = 0;
+    uint16_t LocalPort = 0;
+};
+// on failure returns the error and the name of the function that failed
+uint32_t ctsWSASocketCreateForTarget(
+    uint32_t trafficClassId,
+    const wil::network::socket_address& targetAddr,
+    ctsRaceSocket& raceSocket,
+    const char*& functionName) noexcept;
+
+void ctsConnectByName(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+
+void ctsSimpleConnect(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsSimpleAccept(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+
+void ctsAcceptEx(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+// -AcceptShards: the accepts of each shard of each AcceptEx listener (used for final reporting)
+struct ctsAcceptShardInfo
+{
+    wil::network::socket_address ListeningAddress;
+    uint32_t ShardIndex;
+    uint64_t Accepts;
+    uint32_t PeakPended;
+    // times every AcceptEx the shard had pended completed before it could repost one
+    uint64_t BacklogExhausted;
+};
+std::vector<ctsAcceptShardInfo> ctsAcceptExShardInfos() noexcept;
+void ctsConnectEx(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+// -conn:HappyEyeballs: races ConnectEx attempts across the target addresses, staggered by -ConnectAttemptDelay
+void ctsHappyEyeballsConnect(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+
+void ctsReadWriteIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsSendRecvIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+// -SendFile and -RecvFile: generates, warms or purges, and opens the files before the run - can throw
+void ctsSendRecvIocpOpenFiles();
+// -RecvFileMode:unbuffered: writes the received data still coalescing into sectors once the run is done
+void ctsSendRecvIocpCloseFiles() noexcept;
+void ctsRioIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsTlsIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+// ReSharper disable once CppInconsistentNaming
+void ctsWSAPoll(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+
+// -IO:Quic replaces the create, connect/accept, IO, and closing functions: each ctsSocket is a QUIC stream
+void ctsQuicCreate(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsQuicConnect(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsQuicAccept(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsQuicIo(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+void ctsQuicClose(const std::weak_ptr<ctsSocket>& weakSocket) noexcept;
+}
@@ -0,0 +1,820 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <deque>
+#include <memory>
+#include <vector>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctThreadIocp.hpp>
+#include <ctTimer.hpp>
+// project headers
+#include "ctsConfig.h"
+#include "ctsSocket.h"
+#include "ctsIOTask.hpp"
+#include "ctsTlsSession.hpp"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+//
+// -IO:Tls
+//
+// WSASend/WSARecv using IOCP over a Schannel TLS session, negotiated before the ctsIoPattern starts its IO
+// - the ctsIoPattern only sees plaintext: its byte counts and buffer verification are unchanged
+// - each send task is encrypted into records of up to -TlsRecordSize plaintext bytes, sent with one WSASend
+// - recv tasks are completed from the plaintext decrypted from the ciphertext received
+//   with at most one WSARecv outstanding for the connection, so the ciphertext buffer is only
+//   decrypted while no receive is writing into it
+//
+// All state in the TlsSocketContext is accessed only while holding the ctsSocket lock
+//
+namespace ctsTraffic { namespace Tlsiocp
+    {
+        static INIT_ONCE g_tlsInitializer = INIT_ONCE_STATIC_INIT;
+        // the credential shared by all connections - never freed, as it's used until the process exits
+        static ctsTlsCredential* g_pTlsCredential = nullptr;
+        // the server certificate: found from -TlsCertificate, or created for the lifetime of the process
+        // - destroyed with the process' static objects, deleting the persisted key created for it
+        static wil::unique_cert_context g_serverCertificate;
+        static std::unique_ptr<ctsTlsSelfSignedCertificate> g_pSelfSignedCertificate;
+
+        // the most ciphertext received with each WSARecv
+        static constexpr uint32_t c_receiveSize = 0x10000;
+
+        static BOOL CALLBACK InitOnceTls(PINIT_ONCE, PVOID, PVOID*) noexcept
+        {
+            try
+            {
+                PCCERT_CONTEXT serverCertificate = nullptr;
+                if (ctsConfig::IsListening())
+                {
+                    if (g_configSettings->TlsCertificateThumbprint.empty())
+                    {
+                        g_pSelfSignedCertificate = std::make_unique<ctsTlsSelfSignedCertificate>();
+                        serverCertificate = g_pSelfSignedCertificate->Get();
+                    }
+                    else
+                    {
+                        g_serverCertificate = ctsTlsFindCertificate(g_configSettings->TlsCertificateThumbprint.c_str());
+                        serverCertificate = g_serverCertificate.get();
+                    }
+                }
+                g_pTlsCredential = new ctsTlsCredential(serverCertificate);
+            }
+            catch (...)
+            {
+                const auto gle = ctsConfig::PrintThrownException();
+                SetLastError(gle);
+                return FALSE;
+            }
+            return TRUE;
+        }
+
+        struct TlsTaskStatus
+        {
+            // the error to complete the ctsSocket state with
+            DWORD m_ioErrorCode = NO_ERROR;
+            // the ctsIoPattern has no more IO for this connection
+            bool m_ioDone = false;
+        };
+
+        class TlsSocketContext : public std::enable_shared_from_this<TlsSocketContext>
+        {
+        public:
+            explicit TlsSocketContext(std::weak_ptr<ctsSocket> weakSocket) noexcept :
+                m_weakSocket(std::move(weakSocket)),
+                m_session(*g_pTlsCredential, g_configSettings->TlsRecordSize)
+            {
+            }
+
+            ~TlsSocketContext() noexcept = default;
+            TlsSocketContext(const TlsSocketContext&) = delete;
+            TlsSocketContext& operator=(const TlsSocketContext&) = delete;
+            TlsSocketContext(TlsSocketContext&&) = delete;
+            TlsSocketContext& operator=(TlsSocketContext&&) = delete;
+
+            //
+            // Starts the handshake, returning the error to complete the ctsSocket with
+            // - the caller holds the socket lock and an IO reference
+            //
+            DWORD StartHandshake(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket, const std::shared_ptr<ctsIoPattern>& sharedPattern) noexcept
+            {
+                m_handshakeStartUsec = ctl::ctTimer::snap_qpc_as_usec();
+                return ContinueHandshake(sharedSocket, socket, sharedPattern, NO_ERROR);
+            }
+
+        private:
+            std::weak_ptr<ctsSocket> m_weakSocket;
+            ctsTlsSession m_session;
+            int64_t m_handshakeStartUsec = 0;
+            // the handshake failed: the connection completes with this error once its IO has drained
+            DWORD m_handshakeError = NO_ERROR;
+            // recv tasks waiting for plaintext, completed in the order the ctsIoPattern requested them
+            std::deque<ctsTask> m_recvTasks;
+            // the ciphertext WSARecv is outstanding
+            bool m_recvPosted = false;
+            // the peer closed the TCP connection
+            bool m_recvClosed = false;
+            // ciphertext buffers from completed sends, reused for the next sends
+            std::vector<std::shared_ptr<std::vector<char>>> m_freeSendBuffers;
+
+            std::shared_ptr<std::vector<char>> AllocateSendBuffer()
+            {
+                if (m_freeSendBuffers.empty())
+                {
+                    return std::make_shared<std::vector<char>>();
+                }
+
+                auto sendBuffer = std::move(m_freeSendBuffers.back());
+                m_freeSendBuffers.pop_back();
+                sendBuffer->clear();
+                return sendBuffer;
+            }
+
+            [[nodiscard]] const char* HandshakeFunctionName() const noexcept
+            {
+                return g_pTlsCredential->IsServer() ? "AcceptSecurityContext" : "InitializeSecurityContext";
+            }
+
+            DWORD ContinueHandshake(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket, const std::shared_ptr<ctsIoPattern>& sharedPattern, DWORD error) noexcept
+            {
+                if (NO_ERROR == error)
+                {
+                    try
+                    {
+                        // the tokens must be sent even when the handshake failed: they can carry the alert to the peer
+                        const auto tokens = AllocateSendBuffer();
+                        const auto status = m_session.Handshake(*tokens);
+                        if (!tokens->empty())
+                        {
+                            const auto sendError = PostSend(sharedSocket, socket, tokens, ctsTask{});
+                            if (sendError != NO_ERROR && SUCCEEDED(status))
+                            {
+                                error = sendError;
+                            }
+                        }
+
+                        if (NO_ERROR == error)
+                        {
+                            if (SEC_E_OK == status)
+                            {
+                                g_configSettings->TlsHandshakes.Increment();
+                                g_configSettings->TlsHandshakeUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - m_handshakeStartUsec);
+                                PRINT_DEBUG_INFO(
+                                    L"\t\tctsTlsIocp: handshake completed (max record size %u) [%ws]\n",
+                                    m_session.GetMaxRecordSize(),
+                                    g_pTlsCredential->IsServer() ? L"server" : L"client");
+
+                                // the ctsIoPattern starts its IO once the session is established
+                                return ProcessTasks(sharedSocket, socket, sharedPattern);
+                            }
+
+                            if (SEC_I_CONTINUE_NEEDED == status || SEC_E_INCOMPLETE_MESSAGE == status)
+                            {
+                                error = PostRecv(sharedSocket, socket);
+                            }
+                            else
+                            {
+                                error = static_cast<DWORD>(status);
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        error = ctsConfig::PrintThrownException();
+                    }
+                }
+
+                if (error != NO_ERROR)
+                {
+                    FailHandshake(HandshakeFunctionName(), error);
+                }
+                return error;
+            }
+
+            void FailHandshake(_In_ PCSTR functionName, DWORD error) noexcept
+            {
+                if (NO_ERROR == m_handshakeError)
+                {
+                    m_handshakeError = error;
+                    g_configSettings->TlsHandshakeFailures.Increment();
+                    ctsConfig::PrintErrorIfFailed(functionName, error);
+                }
+            }
+
+            //
+            // Requests IO from the ctsIoPattern until it has no more IO to start right now
+            //
+            DWORD ProcessTasks(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket, const std::shared_ptr<ctsIoPattern>& sharedPattern) noexcept
+            {
+                TlsTaskStatus status{};
+                while (!status.m_ioDone)
+                {
+                    const ctsTask nextIo = sharedPattern->InitiateIo();
+                    if (ctsTaskAction::None == nextIo.m_ioAction)
+                    {
+                        // nothing failed, just no more IO right now
+                        break;
+                    }
+
+                    if (nextIo.m_timeOffsetMilliseconds > 0)
+                    {
+                        // the timer holds an IO reference until it runs the task
+                        sharedSocket->IncrementIo();
+                        try
+                        {
+                            sharedSocket->SetTimer(
+                                nextIo,
+                                [context = shared_from_this()](const std::weak_ptr<ctsSocket>&, const ctsTask& task) noexcept {
+                                    context->TimerCallback(task);
+                                });
+                            break;
+                        }
+                        catch (...)
+                        {
+                            const auto error = ctsConfig::PrintThrownException();
+                            sharedSocket->DecrementIo();
+                            status = CompleteTask(sharedSocket, sharedPattern, nextIo, 0, error);
+                        }
+                    }
+                    else
+                    {
+                        status = ProcessTask(sharedSocket, socket, sharedPattern, nextIo);
+                    }
+                }
+                return status.m_ioErrorCode;
+            }
+
+            void TimerCallback(const ctsTask& task) noexcept
+            {
+                const auto sharedSocket(m_weakSocket.lock());
+                if (!sharedSocket)
+                {
+                    return;
+                }
+
+                const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                const auto lockedPattern = lockedSocket.GetPattern();
+                if (!lockedPattern)
+                {
+                    return;
+                }
+
+                const auto socket = lockedSocket.GetSocket();
+                const auto status = ProcessTask(sharedSocket, socket, lockedPattern, task);
+                auto error = status.m_ioErrorCode;
+                if (!status.m_ioDone)
+                {
+                    if (const auto processError = ProcessTasks(sharedSocket, socket, lockedPattern); processError != NO_ERROR)
+                    {
+                        error = processError;
+                    }
+                }
+
+                // release the IO reference held for the timer
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(error);
+                }
+            }
+
+            //
+            // Starts the IO for the task, or completes it inline if it can't be started
+            //
+            TlsTaskStatus ProcessTask(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket, const std::shared_ptr<ctsIoPattern>& sharedPattern, const ctsTask& nextIo) noexcept
+            {
+                if (INVALID_SOCKET == socket)
+                {
+                    // even if the socket was closed we still must complete the IO request
+                    auto status = CompleteTask(sharedSocket, sharedPattern, nextIo, 0, WSAECONNABORTED);
+                    status.m_ioDone = true;
+                    return status;
+                }
+
+                try
+                {
+                    switch (nextIo.m_ioAction)
+                    {
+                        case ctsTaskAction::Send:
+                        {
+                            const auto records = AllocateSendBuffer();
+                            uint32_t recordCount{};
+                            const auto encryptStartUsec = ctl::ctTimer::snap_qpc_as_usec();
+                            const auto encryptStatus = m_session.Encrypt(
+                                nextIo.m_buffer + nextIo.m_bufferOffset, nextIo.m_bufferLength, *records, &recordCount);
+                            g_configSettings->TlsEncryptUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - encryptStartUsec);
+                            if (encryptStatus != SEC_E_OK)
+                            {
+                                ctsConfig::PrintErrorIfFailed("EncryptMessage", static_cast<uint32_t>(encryptStatus));
+                                return CompleteTask(sharedSocket, sharedPattern, nextIo, 0, static_cast<DWORD>(encryptStatus));
+                            }
+
+                            g_configSettings->TlsRecordsSent.Add(recordCount);
+                            g_configSettings->TlsCiphertextBytesSent.Add(static_cast<int64_t>(records->size()));
+                            if (const auto error = PostSend(sharedSocket, socket, records, nextIo); error != NO_ERROR)
+                            {
+                                PRINT_DEBUG_INFO(L"\t\tIO Failed: WSASend (%lu) [ctsTlsIocp]\n", error);
+                                return CompleteTask(sharedSocket, sharedPattern, nextIo, 0, error);
+                            }
+                            return {};
+                        }
+
+                        case ctsTaskAction::Recv:
+                            m_recvTasks.push_back(nextIo);
+                            if (m_recvPosted)
+                            {
+                                // completed once the outstanding WSARecv completes
+                                return {};
+                            }
+                            return ProcessReceived(sharedSocket, socket, sharedPattern);
+
+                        case ctsTaskAction::GracefulShutdown:
+                        {
+                            // send close_notify, then shutdown(SD_SEND) once it's sent
+                            const auto closeNotify = AllocateSendBuffer();
+                            const auto shutdownStatus = m_session.Shutdown(*closeNotify);
+                            if (SEC_E_OK == shutdownStatus && !closeNotify->empty())
+                            {
+                                if (const auto error = PostSend(sharedSocket, socket, closeNotify, nextIo); error != NO_ERROR)
+                                {
+                                    return CompleteTask(sharedSocket, sharedPattern, nextIo, 0, error);
+                                }
+                                return {};
+                            }
+
+                            PRINT_DEBUG_INFO(L"\t\tctsTlsIocp: no close_notify to send (0x%lx)\n", shutdownStatus);
+                            DWORD error = NO_ERROR;
+                            if (shutdown(socket, SD_SEND) != 0)
+                            {
+                                error = WSAGetLastError();
+                                PRINT_DEBUG_INFO(L"\t\tIO Failed: shutdown(SD_SEND) (%lu) [ctsTlsIocp]\n", error);
+                            }
+                            return CompleteTask(sharedSocket, sharedPattern, nextIo, 0, error);
+                        }
+
+                        case ctsTaskAction::HardShutdown:
+                            // pass through -1 to force an RST with the closesocket
+                            return CompleteTask(
+                                sharedSocket, sharedPattern, nextIo, 0, sharedSocket->CloseSocket(static_cast<uint32_t>(SOCKET_ERROR)));
+
+                        default:
+                            FAIL_FAST_MSG("ctsTlsIocp: unexpected ctsTaskAction %d", static_cast<int>(nextIo.m_ioAction));
+                    }
+                }
+                catch (...)
+                {
+                    return CompleteTask(sharedSocket, sharedPattern, nextIo, 0, ctsConfig::PrintThrownException());
+                }
+            }
+
+            //
+            // Returns the ctsIoPattern's decision after completing the task
+            //
+            TlsTaskStatus CompleteTask(const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern, const ctsTask& task, uint32_t transferred, DWORD error) noexcept
+            {
+                const char* functionName = ctsTaskAction::Recv == task.m_ioAction ? "WSARecv" : "WSASend";
+                TlsTaskStatus status{};
+                switch (const ctsIoStatus protocolStatus = sharedPattern->CompleteIo(task, transferred, error))
+                {
+                    case ctsIoStatus::ContinueIo:
+                        // if the IO failed, the protocol wants to ignore the error
+                        break;
+
+                    case ctsIoStatus::CompletedIo:
+                        status.m_ioDone = true;
+                        break;
+
+                    case ctsIoStatus::FailedIo:
+                        // write out the error to the error log since the protocol sees this as a hard error
+                        ctsConfig::PrintErrorIfFailed(functionName, error);
+                        // protocol sees this as a failure : capture the error the protocol recorded
+                        status.m_ioErrorCode = sharedPattern->GetLastPatternError();
+                        status.m_ioDone = true;
+                        break;
+
+                    default:
+                        FAIL_FAST_MSG("ctsTlsIocp: unknown ctsSocket::IOStatus - %d\n", protocolStatus);
+                }
+
+                if (status.m_ioDone && m_recvPosted)
+                {
+                    // nothing will consume what the outstanding WSARecv receives: close the socket to complete it
+                    sharedSocket->CloseSocket(status.m_ioErrorCode);
+                }
+                return status;
+            }
+
+            //
+            // Decrypts the ciphertext received, completing recv tasks with the plaintext
+            // - posts the next WSARecv if recv tasks are still waiting
+            // - requires that no WSARecv is outstanding
+            //
+            TlsTaskStatus ProcessReceived(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket, const std::shared_ptr<ctsIoPattern>& sharedPattern)
+            {
+                const auto replyTokens = AllocateSendBuffer();
+                const auto decryptStartUsec = ctl::ctTimer::snap_qpc_as_usec();
+                auto decryptStatus = static_cast<DWORD>(m_session.Decrypt(*replyTokens));
+                g_configSettings->TlsDecryptUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - decryptStartUsec);
+                if (decryptStatus != SEC_E_OK)
+                {
+                    ctsConfig::PrintErrorIfFailed("DecryptMessage", decryptStatus);
+                }
+                else if (!replyTokens->empty())
+                {
+                    // post-handshake replies are sent in order with the records already sent
+                    decryptStatus = PostSend(sharedSocket, socket, replyTokens, ctsTask{});
+                }
+                if (decryptStatus != SEC_E_OK)
+                {
+                    return FailRecvTasks(sharedSocket, sharedPattern, decryptStatus);
+                }
+
+                TlsTaskStatus status{};
+                while (!m_recvTasks.empty() && !status.m_ioDone)
+                {
+                    // once the stream has ended, recv tasks are completed with zero bytes
+                    if (0 == m_session.GetPlaintextLength() && !m_session.IsShutdownReceived() && !m_recvClosed)
+                    {
+                        break;
+                    }
+
+                    const auto task = m_recvTasks.front();
+                    m_recvTasks.pop_front();
+                    const auto copied = m_session.ReadPlaintext(task.m_buffer + task.m_bufferOffset, task.m_bufferLength);
+                    status = CompleteTask(sharedSocket, sharedPattern, task, copied, NO_ERROR);
+                }
+
+                if (!status.m_ioDone && !m_recvTasks.empty())
+                {
+                    if (const auto error = PostRecv(sharedSocket, socket); error != NO_ERROR)
+                    {
+                        PRINT_DEBUG_INFO(L"\t\tIO Failed: WSARecv (%lu) [ctsTlsIocp]\n", error);
+                        return FailRecvTasks(sharedSocket, sharedPattern, error);
+                    }
+                }
+                return status;
+            }
+
+            TlsTaskStatus FailRecvTasks(const std::shared_ptr<ctsSocket>& sharedSocket, const std::shared_ptr<ctsIoPattern>& sharedPattern, DWORD error) noexcept
+            {
+                TlsTaskStatus status{error, false};
+                while (!m_recvTasks.empty() && !status.m_ioDone)
+                {
+                    const auto task = m_recvTasks.front();
+                    m_recvTasks.pop_front();
+                    status = CompleteTask(sharedSocket, sharedPattern, task, 0, error);
+                }
+                return status;
+            }
+
+            //
+            // Sends the ciphertext - the task is completed back to the ctsIoPattern when the send completes
+            // - ctsTaskAction::None sends handshake tokens the ctsIoPattern never sees
+            // Returns NO_ERROR if the send was started
+            //
+            DWORD PostSend(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket, const std::shared_ptr<std::vector<char>>& ciphertext, const ctsTask& task) noexcept
+            {
+                sharedSocket->IncrementIo();
+                DWORD error = NO_ERROR;
+                try
+                {
+                    const std::shared_ptr<ctl::ctThreadIocp>& ioThreadPool(sharedSocket->GetIocpThreadpool());
+                    OVERLAPPED* const pOverlapped = ioThreadPool->new_request(
+                        [context = shared_from_this(), ciphertext, task](OVERLAPPED* pCallbackOverlapped) noexcept {
+                            context->SendCompletion(pCallbackOverlapped, ciphertext, task);
+                        });
+
+                    WSABUF wsaBuffer{};
+                    wsaBuffer.buf = ciphertext->data();
+                    wsaBuffer.len = static_cast<ULONG>(ciphertext->size());
+                    if (WSASend(socket, &wsaBuffer, 1, nullptr, 0, pOverlapped, nullptr) != 0)
+                    {
+                        error = WSAGetLastError();
+                        if (WSA_IO_PENDING == error)
+                        {
+                            error = NO_ERROR;
+                        }
+                        else
+                        {
+                            // must cancel the IOCP TP since IO is not pended
+                            ioThreadPool->cancel_request(pOverlapped);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    error = ctsConfig::PrintThrownException();
+                }
+
+                if (error != NO_ERROR)
+                {
+                    // the caller holds its own IO reference
+                    sharedSocket->DecrementIo();
+                }
+                return error;
+            }
+
+            //
+            // Receives ciphertext into the session's receive buffer
+            // Returns NO_ERROR if the receive was started
+            //
+            DWORD PostRecv(const std::shared_ptr<ctsSocket>& sharedSocket, SOCKET socket) noexcept
+            {
+                FAIL_FAST_IF_MSG(m_recvPosted, "ctsTlsIocp: only one WSARecv can be outstanding (context %p)", this);
+
+                sharedSocket->IncrementIo();
+                DWORD error = NO_ERROR;
+                try
+                {
+                    WSABUF wsaBuffer{};
+                    wsaBuffer.buf = m_session.GetReceiveBuffer(c_receiveSize);
+                    wsaBuffer.len = c_receiveSize;
+
+                    const std::shared_ptr<ctl::ctThreadIocp>& ioThreadPool(sharedSocket->GetIocpThreadpool());
+                    OVERLAPPED* const pOverlapped = ioThreadPool->new_request(
+                        [context = shared_from_this()](OVERLAPPED* pCallbackOverlapped) noexcept {
+                            context->RecvCompletion(pCallbackOverlapped);
+                        });
+
+                    DWORD flags = 0;
+                    if (WSARecv(socket, &wsaBuffer, 1, nullptr, &flags, pOverlapped, nullptr) != 0)
+                    {
+                        error = WSAGetLastError();
+                        if (WSA_IO_PENDING == error)
+                        {
+                            error = NO_ERROR;
+                        }
+                        else
+                        {
+                            // must cancel the IOCP TP since IO is not pended
+                            ioThreadPool->cancel_request(pOverlapped);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    error = ctsConfig::PrintThrownException();
+                }
+
+                if (NO_ERROR == error)
+                {
+                    m_recvPosted = true;
+                }
+                else
+                {
+                    // the caller holds its own IO reference
+                    sharedSocket->DecrementIo();
+                }
+                return error;
+            }
+
+            // IO Threadpool completion callback for WSASend
+            void SendCompletion(_In_ OVERLAPPED* pOverlapped, const std::shared_ptr<std::vector<char>>& ciphertext, const ctsTask& task) noexcept
+            {
+                const auto sharedSocket(m_weakSocket.lock());
+                if (!sharedSocket)
+                {
+                    return;
+                }
+
+                // hold a reference on the socket
+                const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                const auto lockedPattern = lockedSocket.GetPattern();
+                const auto socket = lockedSocket.GetSocket();
+                DWORD gle = GetCompletionResult(lockedPattern, socket, pOverlapped, nullptr);
+                if (gle != NO_ERROR)
+                {
+                    PRINT_DEBUG_INFO(L"\t\tIO Failed: WSASend (%lu) [ctsTlsIocp]\n", gle);
+                }
+
+                try
+                {
+                    m_freeSendBuffers.push_back(ciphertext);
+                }
+                catch (...)
+                {
+                    // the buffer is freed instead of reused
+                }
+
+                if (lockedPattern)
+                {
+                    if (ctsTaskAction::None == task.m_ioAction)
+                    {
+                        // handshake tokens: the ctsIoPattern isn't running until the handshake completes
+                        if (!m_session.IsHandshakeComplete())
+                        {
+                            if (gle != NO_ERROR)
+                            {
+                                FailHandshake("WSASend", gle);
+                                if (m_recvPosted)
+                                {
+                                    // the peer will never reply: close the socket to complete the outstanding WSARecv
+                                    sharedSocket->CloseSocket(gle);
+                                }
+                            }
+                            gle = m_handshakeError;
+                        }
+                    }
+                    else
+                    {
+                        if (ctsTaskAction::GracefulShutdown == task.m_ioAction && NO_ERROR == gle)
+                        {
+                            if (shutdown(socket, SD_SEND) != 0)
+                            {
+                                gle = WSAGetLastError();
+                                PRINT_DEBUG_INFO(L"\t\tIO Failed: shutdown(SD_SEND) (%lu) [ctsTlsIocp]\n", gle);
+                            }
+                        }
+
+                        // the ctsIoPattern sees the plaintext bytes once all the records carrying them are sent
+                        const auto transferred = ctsTaskAction::Send == task.m_ioAction && NO_ERROR == gle ? task.m_bufferLength : 0u;
+                        const auto status = CompleteTask(sharedSocket, lockedPattern, task, transferred, gle);
+                        gle = status.m_ioErrorCode;
+                        if (!status.m_ioDone)
+                        {
+                            // more IO is requested from the protocol
+                            gle = ProcessTasks(sharedSocket, socket, lockedPattern);
+                        }
+                    }
+                }
+
+                // always decrement *after* attempting new IO : the prior IO is now formally "done"
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(gle);
+                }
+            }
+
+            // IO Threadpool completion callback for WSARecv
+            void RecvCompletion(_In_ OVERLAPPED* pOverlapped) noexcept
+            {
+                const auto sharedSocket(m_weakSocket.lock());
+                if (!sharedSocket)
+                {
+                    return;
+                }
+
+                // hold a reference on the socket
+                const auto lockedSocket = sharedSocket->AcquireSocketLock();
+                const auto lockedPattern = lockedSocket.GetPattern();
+                const auto socket = lockedSocket.GetSocket();
+                DWORD transferred = 0;
+                DWORD gle = GetCompletionResult(lockedPattern, socket, pOverlapped, &transferred);
+                if (gle != NO_ERROR)
+                {
+                    PRINT_DEBUG_INFO(L"\t\tIO Failed: WSARecv (%lu) [ctsTlsIocp]\n", gle);
+                }
+
+                m_recvPosted = false;
+                if (NO_ERROR == gle)
+                {
+                    g_configSettings->TlsCiphertextBytesRecv.Add(transferred);
+                    if (0 == transferred)
+                    {
+                        m_recvClosed = true;
+                    }
+                    else
+                    {
+                        m_session.CommitReceived(transferred);
+                    }
+                }
+
+                if (lockedPattern)
+                {
+                    if (!m_session.IsHandshakeComplete())
+                    {
+                        if (NO_ERROR == gle && m_recvClosed)
+                        {
+                            // the peer closed the connection before the handshake completed
+                            gle = WSAECONNRESET;
+                        }
+                        gle = ContinueHandshake(sharedSocket, socket, lockedPattern, gle);
+                    }
+                    else
+                    {
+                        TlsTaskStatus status{};
+                        try
+                        {
+                            status = NO_ERROR == gle
+                                ? ProcessReceived(sharedSocket, socket, lockedPattern)
+                                : FailRecvTasks(sharedSocket, lockedPattern, gle);
+                        }
+                        catch (...)
+                        {
+                            status = FailRecvTasks(sharedSocket, lockedPattern, ctsConfig::PrintThrownException());
+                        }
+
+                        gle = status.m_ioErrorCode;
+                        if (!status.m_ioDone)
+                        {
+                            // more IO is requested from the protocol
+                            gle = ProcessTasks(sharedSocket, socket, lockedPattern);
+                        }
+                    }
+                }
+
+                // always decrement *after* attempting new IO : the prior IO is now formally "done"
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(gle);
+                }
+            }
+
+            // returns the result of the completed IO (under the socket lock)
+            static DWORD GetCompletionResult(const std::shared_ptr<ctsIoPattern>& lockedPattern, SOCKET socket, _In_ OVERLAPPED* pOverlapped, _Out_opt_ DWORD* transferred) noexcept
+            {
+                DWORD bytesTransferred = 0;
+                if (transferred)
+                {
+                    *transferred = 0;
+                }
+
+                // if we no longer have a valid socket or the pattern was destroyed, the IO is aborted
+                if (!lockedPattern || INVALID_SOCKET == socket)
+                {
+                    return WSAECONNABORTED;
+                }
+
+                DWORD flags{};
+                if (!WSAGetOverlappedResult(socket, pOverlapped, &bytesTransferred, FALSE, &flags))
+                {
+                    return WSAGetLastError();
+                }
+
+                if (transferred)
+                {
+                    *transferred = bytesTransferred;
+                }
+                return NO_ERROR;
+            }
+        };
+    } // namespace Tlsiocp
+
+    // The function registered with ctsConfig
+    void ctsTlsIocp(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        // attempt to get a reference to the socket
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        //
+        // guarantee the credential is initialized
+        //
+        if (!InitOnceExecuteOnce(&Tlsiocp::g_tlsInitializer, Tlsiocp::InitOnceTls, nullptr, nullptr))
+        {
+            auto gle = GetLastError();
+            if (0 == gle)
+            {
+                gle = SEC_E_NO_CREDENTIALS;
+            }
+            ctsConfig::PrintException(gle, L"InitOnceExecuteOnce", L"ctsTlsIocp");
+            sharedSocket->CompleteState(gle);
+            return;
+        }
+
+        // hold a reference on the socket
+        const auto lockedSocket = sharedSocket->AcquireSocketLock();
+        const auto lockedPattern = lockedSocket.GetPattern();
+        if (!lockedPattern)
+        {
+            return;
+        }
+
+        // hold an IO reference while starting the handshake
+        // - the context is kept alive by the IO it has outstanding
+        sharedSocket->IncrementIo();
+        DWORD error = NO_ERROR;
+        try
+        {
+            const auto context = std::make_shared<Tlsiocp::TlsSocketContext>(weakSocket);
+            error = context->StartHandshake(sharedSocket, lockedSocket.GetSocket(), lockedPattern);
+        }
+        catch (...)
+        {
+            error = ctsConfig::PrintThrownException();
+        }
+
+        if (0 == sharedSocket->DecrementIo())
+        {
+            sharedSocket->CompleteState(error);
+        }
+    }
+} // namespace
@@ -0,0 +1,640 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+// os headers
+#include <Windows.h>
+#include <wincrypt.h>
+#include <ncrypt.h>
+#define SECURITY_WIN32
+#include <security.h>
+// SCH_CREDENTIALS (required to negotiate TLS 1.3) is only defined with SCHANNEL_USE_BLACKLISTS
+#define SCHANNEL_USE_BLACKLISTS
+#include <subauth.h>
+#include <schannel.h>
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/resource.h>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+
+namespace ctsTraffic
+{
+//
+// ctsTlsSelfSignedCertificate
+//
+// Creates a self-signed server certificate for the lifetime of this object
+// - Schannel performs private key operations in LSA, which cannot use an ephemeral key
+//   so the key is persisted under a unique name, and deleted when this object is destroyed
+// - the certificate is not added to any certificate store
+//
+class ctsTlsSelfSignedCertificate
+{
+public:
+    // throws a wil exception on failure
+    explicit ctsTlsSelfSignedCertificate(_In_ PCWSTR subjectName = L"CN=localhost")
+    {
+        static std::atomic<uint32_t> s_keyCount{0};
+        m_keyName = wil::str_printf<std::wstring>(
+            L"ctsTraffic-%lu-%llu-%u", GetCurrentProcessId(), GetTickCount64(), s_keyCount.fetch_add(1));
+
+        wil::unique_ncrypt_prov provider;
+        THROW_IF_FAILED_MSG(NCryptOpenStorageProvider(&provider, MS_KEY_STORAGE_PROVIDER, 0), "NCryptOpenStorageProvider");
+        THROW_IF_FAILED_MSG(
+            NCryptCreatePersistedKey(provider.get(), &m_key, NCRYPT_RSA_ALGORITHM, m_keyName.c_str(), 0, NCRYPT_OVERWRITE_KEY_FLAG),
+            "NCryptCreatePersistedKey");
+        auto deleteKeyOnError = wil::scope_exit([&]() noexcept { DeleteKey(); });
+
+        DWORD keyLength = c_keyLengthBits;
+        THROW_IF_FAILED_MSG(
+            NCryptSetProperty(m_key.get(), NCRYPT_LENGTH_PROPERTY, reinterpret_cast<PBYTE>(&keyLength), sizeof keyLength, 0),
+            "NCryptSetProperty(NCRYPT_LENGTH_PROPERTY)");
+        THROW_IF_FAILED_MSG(NCryptFinalizeKey(m_key.get(), 0), "NCryptFinalizeKey");
+
+        DWORD encodedLength = 0;
+        THROW_IF_WIN32_BOOL_FALSE_MSG(
+            CertStrToNameW(X509_ASN_ENCODING, subjectName, CERT_X500_NAME_STR, nullptr, nullptr, &encodedLength, nullptr),
+            "CertStrToNameW(%ws)", subjectName);
+        std::vector<BYTE> encodedSubject(encodedLength);
+        THROW_IF_WIN32_BOOL_FALSE_MSG(
+            CertStrToNameW(X509_ASN_ENCODING, subjectName, CERT_X500_NAME_STR, nullptr, encodedSubject.data(), &encodedLength, nullptr),
+            "CertStrToNameW(%ws)", subjectName);
+        CERT_NAME_BLOB subject{encodedLength, encodedSubject.data()};
+
+        // Schannel finds the private key through the key provider info set on the certificate
+        CRYPT_KEY_PROV_INFO keyProviderInfo{};
+        keyProviderInfo.pwszContainerName = m_keyName.data();
+        keyProviderInfo.pwszProvName = const_cast<LPWSTR>(MS_KEY_STORAGE_PROVIDER);
+        keyProviderInfo.dwKeySpec = AT_KEYEXCHANGE;
+
+        SYSTEMTIME expiration{};
+        GetSystemTime(&expiration);
+        expiration.wYear += 1;
+        if (2 == expiration.wMonth && 29 == expiration.wDay)
+        {
+            expiration.wDay = 28;
+        }
+
+        m_certificate.reset(CertCreateSelfSignCertificate(m_key.get(), &subject, 0, &keyProviderInfo, nullptr, nullptr, &expiration, nullptr));
+        THROW_LAST_ERROR_IF_NULL_MSG(m_certificate.get(), "CertCreateSelfSignCertificate");
+        deleteKeyOnError.release();
+    }
+
+    ~ctsTlsSelfSignedCertificate() noexcept
+    {
+        m_certificate.reset();
+        DeleteKey();
+    }
+
+    ctsTlsSelfSignedCertificate(const ctsTlsSelfSignedCertificate&) = delete;
+    ctsTlsSelfSignedCertificate& operator=(const ctsTlsSelfSignedCertificate&) = delete;
+    ctsTlsSelfSignedCertificate(ctsTlsSelfSignedCertificate&&) = delete;
+    ctsTlsSelfSignedCertificate& operator=(ctsTlsSelfSignedCertificate&&) = delete;
+
+    [[nodiscard]] PCCERT_CONTEXT Get() const noexcept
+    {
+        return m_certificate.get();
+    }
+
+private:
+    static constexpr DWORD c_keyLengthBits = 2048;
+
+    std::wstring m_keyName;
+    wil::unique_ncrypt_key m_key;
+    wil::unique_cert_context m_certificate;
+
+    void DeleteKey() noexcept
+    {
+        if (m_key)
+        {
+            // NCryptDeleteKey frees the handle when it succeeds
+            if (SUCCEEDED(NCryptDeleteKey(m_key.get(), 0)))
+            {
+                m_key.release();
+            }
+            m_key.reset();
+        }
+    }
+};
+
+//
+// Finds the certificate with the given SHA1 thumbprint (hex, spaces allowed)
+// - searches the 'My' store of the current user, then of the local machine
+// - throws a wil exception if the certificate is not found
+//
+inline wil::unique_cert_context ctsTlsFindCertificate(_In_ PCWSTR thumbprint)
+{
+    BYTE hash[20]{};
+    DWORD hashLength = sizeof hash;
+    THROW_IF_WIN32_BOOL_FALSE_MSG(
+        CryptStringToBinaryW(thumbprint, 0, CRYPT_STRING_HEX, hash, &hashLength, nullptr, nullptr),
+        "CryptStringToBinaryW(%ws)", thumbprint);
+    THROW_HR_IF_MSG(E_INVALIDARG, hashLength != sizeof hash, "The certificate thumbprint must be a SHA1 hash (%ws)", thumbprint);
+
+    CRYPT_HASH_BLOB hashBlob{hashLength, hash};
+    for (const DWORD storeLocation : {CERT_SYSTEM_STORE_CURRENT_USER, CERT_SYSTEM_STORE_LOCAL_MACHINE})
+    {
+        const wil::unique_hcertstore store(CertOpenStore(
+            CERT_STORE_PROV_SYSTEM_W, 0, 0, storeLocation | CERT_STORE_READONLY_FLAG | CERT_STORE_OPEN_EXISTING_FLAG, L"My"));
+        if (!store)
+        {
+            continue;
+        }
+
+        wil::unique_cert_context certificate(CertFindCertificateInStore(
+            store.get(), X509_ASN_ENCODING | PKCS_7_ASN_ENCODING, 0, CERT_FIND_HASH, &hashBlob, nullptr));
+        if (certificate)
+        {
+            return certificate;
+        }
+    }
+
+    THROW_HR_MSG(CRYPT_E_NOT_FOUND, "The certificate %ws was not found in the CurrentUser or LocalMachine My store", thumbprint);
+}
+
+//
+// ctsTlsCredential
+//
+// Schannel credentials shared by every TLS session of one role
+// - a server credential presents the given certificate
+// - a client credential does not validate the server certificate:
+//   test servers present self-signed certificates
+//
+class ctsTlsCredential
+{
+public:
+    // serverCertificate == nullptr creates a client credential
+    // throws a wil exception on failure
+    explicit ctsTlsCredential(_In_opt_ PCCERT_CONTEXT serverCertificate) :
+        m_isServer(serverCertificate != nullptr)
+    {
+        SCH_CREDENTIALS credentials{};
+        credentials.dwVersion = SCH_CREDENTIALS_VERSION;
+        credentials.dwFlags = SCH_USE_STRONG_CRYPTO;
+        if (m_isServer)
+        {
+            credentials.cCreds = 1;
+            credentials.paCred = &serverCertificate;
+        }
+        else
+        {
+            credentials.dwFlags |= SCH_CRED_MANUAL_CRED_VALIDATION | SCH_CRED_NO_DEFAULT_CREDS;
+        }
+
+        TimeStamp expiration{};
+        THROW_IF_FAILED_MSG(
+            AcquireCredentialsHandleW(
+                nullptr,
+                const_cast<LPWSTR>(UNISP_NAME_W),
+                m_isServer ? SECPKG_CRED_INBOUND : SECPKG_CRED_OUTBOUND,
+                nullptr,
+                &credentials,
+                nullptr,
+                nullptr,
+                &m_credential,
+                &expiration),
+            "AcquireCredentialsHandle");
+    }
+
+    ~ctsTlsCredential() noexcept
+    {
+        FreeCredentialsHandle(&m_credential);
+    }
+
+    ctsTlsCredential(const ctsTlsCredential&) = delete;
+    ctsTlsCredential& operator=(const ctsTlsCredential&) = delete;
+    ctsTlsCredential(ctsTlsCredential&&) = delete;
+    ctsTlsCredential& operator=(ctsTlsCredential&&) = delete;
+
+    [[nodiscard]] bool IsServer() const noexcept
+    {
+        return m_isServer;
+    }
+
+    [[nodiscard]] CredHandle* Get() const noexcept
+    {
+        return const_cast<CredHandle*>(&m_credential);
+    }
+
+private:
+    CredHandle m_credential{};
+    const bool m_isServer;
+};
+
+//
+// ctsTlsSession
+//
+// One Schannel TLS session over a byte stream - the caller owns all IO
+// - ciphertext received is appended with GetReceiveBuffer + CommitReceived
+// - Handshake consumes the ciphertext received, returning the tokens to send to the peer
+// - once the handshake completes, Encrypt turns plaintext into records to send,
+//   and Decrypt turns the ciphertext received into plaintext read with ReadPlaintext
+//
+// Not thread safe: the caller serializes all calls on a session
+//
+class ctsTlsSession
+{
+public:
+    // maxRecordSize limits the plaintext bytes in each record (0 == the largest record the session allows)
+    ctsTlsSession(const ctsTlsCredential& credential, uint32_t maxRecordSize) noexcept :
+        m_credential(credential),
+        m_requestedRecordSize(maxRecordSize)
+    {
+    }
+
+    ~ctsTlsSession() noexcept
+    {
+        if (m_contextCreated)
+        {
+            DeleteSecurityContext(&m_context);
+        }
+    }
+
+    ctsTlsSession(const ctsTlsSession&) = delete;
+    ctsTlsSession& operator=(const ctsTlsSession&) = delete;
+    ctsTlsSession(ctsTlsSession&&) = delete;
+    ctsTlsSession& operator=(ctsTlsSession&&) = delete;
+
+    [[nodiscard]] bool IsHandshakeComplete() const noexcept
+    {
+        return m_handshakeComplete;
+    }
+
+    // the peer sent close_notify: no more plaintext will be received
+    [[nodiscard]] bool IsShutdownReceived() const noexcept
+    {
+        return m_shutdownReceived;
+    }
+
+    // the most plaintext bytes encrypted into one record - valid once the handshake completes
+    [[nodiscard]] uint32_t GetMaxRecordSize() const noexcept
+    {
+        return m_maxRecordSize;
+    }
+
+    [[nodiscard]] size_t GetPlaintextLength() const noexcept
+    {
+        return m_plaintext.size() - m_plaintextOffset;
+    }
+
+    //
+    // Returns space for receiving up to length more bytes of ciphertext
+    // - the returned buffer remains valid until the next call which consumes ciphertext
+    //   (CommitReceived, Handshake, or Decrypt)
+    //
+    char* GetReceiveBuffer(uint32_t length)
+    {
+        if (m_ciphertext.size() < m_ciphertextLength + length)
+        {
+            m_ciphertext.resize(m_ciphertextLength + length);
+        }
+        return m_ciphertext.data() + m_ciphertextLength;
+    }
+
+    void CommitReceived(uint32_t length) noexcept
+    {
+        FAIL_FAST_IF(m_ciphertextLength + length > m_ciphertext.size());
+        m_ciphertextLength += length;
+    }
+
+    //
+    // Runs the next step of the handshake over the ciphertext received
+    // - appends any token to send to the peer to output - which must be sent even when the handshake fails
+    // Returns
+    // - SEC_E_OK once the handshake completed
+    // - SEC_I_CONTINUE_NEEDED or SEC_E_INCOMPLETE_MESSAGE when more must be received from the peer
+    // - any other status is a failure
+    //
+    SECURITY_STATUS Handshake(std::vector<char>& output)
+    {
+        // only the client starts the handshake without input from its peer
+        if (0 == m_ciphertextLength && (m_contextCreated || m_credential.IsServer()))
+        {
+            return SEC_E_INCOMPLETE_MESSAGE;
+        }
+
+        SecBuffer inputBuffers[2]{};
+        inputBuffers[0].BufferType = SECBUFFER_TOKEN;
+        inputBuffers[0].pvBuffer = m_ciphertext.data();
+        inputBuffers[0].cbBuffer = m_ciphertextLength;
+        inputBuffers[1].BufferType = SECBUFFER_EMPTY;
+        SecBufferDesc inputDesc{SECBUFFER_VERSION, 2, inputBuffers};
+
+        const auto status = CallSecurityContext(m_contextCreated || m_credential.IsServer() ? &inputDesc : nullptr, output);
+        if (SEC_E_INCOMPLETE_MESSAGE == status)
+        {
+            // keep everything received until the rest of the message arrives
+            return status;
+        }
+
+        // keep only the bytes received after this handshake message
+        if (SECBUFFER_EXTRA == inputBuffers[1].BufferType)
+        {
+            ConsumeCiphertext(m_ciphertextLength - inputBuffers[1].cbBuffer);
+        }
+        else
+        {
+            ConsumeCiphertext(m_ciphertextLength);
+        }
+
+        if (SEC_E_OK == status)
+        {
+            SecPkgContext_StreamSizes streamSizes{};
+            const auto queryStatus = QueryContextAttributesW(&m_context, SECPKG_ATTR_STREAM_SIZES, &streamSizes);
+            if (queryStatus != SEC_E_OK)
+            {
+                return queryStatus;
+            }
+
+            m_headerSize = streamSizes.cbHeader;
+            m_trailerSize = streamSizes.cbTrailer;
+            m_maxRecordSize = streamSizes.cbMaximumMessage;
+            if (m_requestedRecordSize > 0)
+            {
+                m_maxRecordSize = std::min(m_maxRecordSize, m_requestedRecordSize);
+            }
+            m_handshakeComplete = true;
+        }
+        return status;
+    }
+
+    //
+    // Encrypts plaintext into records of up to GetMaxRecordSize() bytes, appending them to output
+    // - recordCount is set to the number of records appended
+    //
+    SECURITY_STATUS Encrypt(_In_reads_bytes_(length) const char* plaintext, uint32_t length, std::vector<char>& output, _Out_ uint32_t* recordCount)
+    {
+        *recordCount = 0;
+        FAIL_FAST_IF(!m_handshakeComplete);
+
+        for (uint32_t offset = 0; offset < length;)
+        {
+            const auto recordLength = std::min(length - offset, m_maxRecordSize);
+            const auto recordOffset = output.size();
+            output.resize(recordOffset + m_headerSize + recordLength + m_trailerSize);
+            auto* const record = output.data() + recordOffset;
+            memcpy(record + m_headerSize, plaintext + offset, recordLength);
+
+            SecBuffer buffers[4]{};
+            buffers[0].BufferType = SECBUFFER_STREAM_HEADER;
+            buffers[0].pvBuffer = record;
+            buffers[0].cbBuffer = m_headerSize;
+            buffers[1].BufferType = SECBUFFER_DATA;
+            buffers[1].pvBuffer = record + m_headerSize;
+            buffers[1].cbBuffer = recordLength;
+            buffers[2].BufferType = SECBUFFER_STREAM_TRAILER;
+            buffers[2].pvBuffer = record + m_headerSize + recordLength;
+            buffers[2].cbBuffer = m_trailerSize;
+            buffers[3].BufferType = SECBUFFER_EMPTY;
+            SecBufferDesc bufferDesc{SECBUFFER_VERSION, 4, buffers};
+
+            const auto status = EncryptMessage(&m_context, 0, &bufferDesc, 0);
+            if (status != SEC_E_OK)
+            {
+                output.resize(recordOffset);
+                return status;
+            }
+
+            // the trailer can be shorter than the maximum trailer size
+            output.resize(recordOffset + buffers[0].cbBuffer + buffers[1].cbBuffer + buffers[2].cbBuffer);
+            offset += recordLength;
+            ++*recordCount;
+        }
+        return SEC_E_OK;
+    }
+
+    //
+    // Decrypts every complete record received, making its plaintext available to ReadPlaintext
+    // - appends to output any token the peer expects in reply to post-handshake messages
+    // - a partial record is kept until the rest of it is received
+    //
+    SECURITY_STATUS Decrypt(std::vector<char>& output)
+    {
+        FAIL_FAST_IF(!m_handshakeComplete);
+
+        while (m_ciphertextLength > 0 && !m_shutdownReceived)
+        {
+            SecBuffer buffers[4]{};
+            buffers[0].BufferType = SECBUFFER_DATA;
+            buffers[0].pvBuffer = m_ciphertext.data();
+            buffers[0].cbBuffer = m_ciphertextLength;
+            buffers[1].BufferType = SECBUFFER_EMPTY;
+            buffers[2].BufferType = SECBUFFER_EMPTY;
+            buffers[3].BufferType = SECBUFFER_EMPTY;
+            SecBufferDesc bufferDesc{SECBUFFER_VERSION, 4, buffers};
+
+            const auto status = DecryptMessage(&m_context, &bufferDesc, 0, nullptr);
+            if (SEC_E_INCOMPLETE_MESSAGE == status)
+            {
+                return SEC_E_OK;
+            }
+            if (SEC_I_CONTEXT_EXPIRED == status)
+            {
+                // close_notify: anything after it is ignored
+                m_shutdownReceived = true;
+                m_ciphertextLength = 0;
+                return SEC_E_OK;
+            }
+            if (status != SEC_E_OK && status != SEC_I_RENEGOTIATE)
+            {
+                return status;
+            }
+
+            // records are decrypted in place
+            const SecBuffer* dataBuffer = nullptr;
+            const SecBuffer* extraBuffer = nullptr;
+            for (const auto& buffer : buffers)
+            {
+                if (SECBUFFER_DATA == buffer.BufferType && !dataBuffer)
+                {
+                    dataBuffer = &buffer;
+                }
+                else if (SECBUFFER_EXTRA == buffer.BufferType && !extraBuffer)
+                {
+                    extraBuffer = &buffer;
+                }
+            }
+
+            if (dataBuffer && dataBuffer->cbBuffer > 0)
+            {
+                const auto* const data = static_cast<const char*>(dataBuffer->pvBuffer);
+                m_plaintext.insert(m_plaintext.end(), data, data + dataBuffer->cbBuffer);
+            }
+
+            if (extraBuffer)
+            {
+                ConsumeCiphertext(m_ciphertextLength - extraBuffer->cbBuffer);
+            }
+            else
+            {
+                ConsumeCiphertext(m_ciphertextLength);
+            }
+
+            if (SEC_I_RENEGOTIATE == status)
+            {
+                // post-handshake messages (e.g. TLS 1.3 session tickets) are handed back to the handshake
+                // - a renegotiation needing more round trips is not supported
+                const auto handshakeStatus = Handshake(output);
+                if (handshakeStatus != SEC_E_OK)
+                {
+                    return SEC_I_CONTINUE_NEEDED == handshakeStatus || SEC_E_INCOMPLETE_MESSAGE == handshakeStatus
+                        ? SEC_E_UNSUPPORTED_FUNCTION
+                        : handshakeStatus;
+                }
+            }
+        }
+        return SEC_E_OK;
+    }
+
+    //
+    // Copies up to length bytes of decrypted plaintext into buffer, returning the number of bytes copied
+    //
+    uint32_t ReadPlaintext(_Out_writes_bytes_to_(length, return) char* buffer, uint32_t length) noexcept
+    {
+        const auto copied = static_cast<uint32_t>(std::min<size_t>(length, GetPlaintextLength()));
+        memcpy(buffer, m_plaintext.data() + m_plaintextOffset, copied);
+        m_plaintextOffset += copied;
+        if (m_plaintextOffset == m_plaintext.size())
+        {
+            m_plaintext.clear();
+            m_plaintextOffset = 0;
+        }
+        return copied;
+    }
+
+    //
+    // Appends the close_notify alert to send to the peer to output
+    //
+    SECURITY_STATUS Shutdown(std::vector<char>& output)
+    {
+        DWORD shutdownToken = SCHANNEL_SHUTDOWN;
+        SecBuffer tokenBuffer{sizeof shutdownToken, SECBUFFER_TOKEN, &shutdownToken};
+        SecBufferDesc tokenDesc{SECBUFFER_VERSION, 1, &tokenBuffer};
+        const auto status = ApplyControlToken(&m_context, &tokenDesc);
+        if (status != SEC_E_OK)
+        {
+            return status;
+        }
+
+        SecBuffer inputBuffer{0, SECBUFFER_EMPTY, nullptr};
+        SecBufferDesc inputDesc{SECBUFFER_VERSION, 1, &inputBuffer};
+        const auto shutdownStatus = CallSecurityContext(m_credential.IsServer() ? &inputDesc : nullptr, output);
+        return SEC_I_CONTEXT_EXPIRED == shutdownStatus ? SEC_E_OK : shutdownStatus;
+    }
+
+private:
+    static constexpr ULONG c_clientContextFlags =
+        ISC_REQ_SEQUENCE_DETECT | ISC_REQ_REPLAY_DETECT | ISC_REQ_CONFIDENTIALITY | ISC_REQ_ALLOCATE_MEMORY |
+        ISC_REQ_STREAM | ISC_REQ_EXTENDED_ERROR | ISC_REQ_MANUAL_CRED_VALIDATION;
+    static constexpr ULONG c_serverContextFlags =
+        ASC_REQ_SEQUENCE_DETECT | ASC_REQ_REPLAY_DETECT | ASC_REQ_CONFIDENTIALITY | ASC_REQ_ALLOCATE_MEMORY |
+        ASC_REQ_STREAM | ASC_REQ_EXTENDED_ERROR;
+
+    const ctsTlsCredential& m_credential;
+    const uint32_t m_requestedRecordSize;
+    CtxtHandle m_context{};
+    bool m_contextCreated = false;
+    bool m_handshakeComplete = false;
+    bool m_shutdownReceived = false;
+
+    ULONG m_headerSize = 0;
+    ULONG m_trailerSize = 0;
+    uint32_t m_maxRecordSize = 0;
+
+    // ciphertext received and not yet consumed: only the first m_ciphertextLength bytes are valid
+    std::vector<char> m_ciphertext;
+    uint32_t m_ciphertextLength = 0;
+    // plaintext decrypted and not yet read: starting at m_plaintextOffset
+    std::vector<char> m_plaintext;
+    size_t m_plaintextOffset = 0;
+
+    void ConsumeCiphertext(uint32_t length) noexcept
+    {
+        FAIL_FAST_IF(length > m_ciphertextLength);
+        m_ciphertextLength -= length;
+        if (m_ciphertextLength > 0)
+        {
+            memmove(m_ciphertext.data(), m_ciphertext.data() + length, m_ciphertextLength);
+        }
+    }
+
+    // appends the token Schannel returned to output
+    SECURITY_STATUS CallSecurityContext(_In_opt_ SecBufferDesc* input, std::vector<char>& output)
+    {
+        SecBuffer outputBuffers[2]{};
+        outputBuffers[0].BufferType = SECBUFFER_TOKEN;
+        outputBuffers[1].BufferType = SECBUFFER_ALERT;
+        SecBufferDesc outputDesc{SECBUFFER_VERSION, 2, outputBuffers};
+        // Schannel allocates the output buffers (*_REQ_ALLOCATE_MEMORY)
+        const auto freeOutputBuffers = wil::scope_exit([&]() noexcept {
+            for (const auto& buffer : outputBuffers)
+            {
+                if (buffer.pvBuffer)
+                {
+                    FreeContextBuffer(buffer.pvBuffer);
+                }
+            }
+        });
+
+        ULONG contextAttributes{};
+        SECURITY_STATUS status{};
+        if (m_credential.IsServer())
+        {
+            status = AcceptSecurityContext(
+                m_credential.Get(),
+                m_contextCreated ? &m_context : nullptr,
+                input,
+                c_serverContextFlags,
+                0,
+                &m_context,
+                &outputDesc,
+                &contextAttributes,
+                nullptr);
+        }
+        else
+        {
+            status = InitializeSecurityContextW(
+                m_credential.Get(),
+                m_contextCreated ? &m_context : nullptr,
+                nullptr,
+                c_clientContextFlags,
+                0,
+                0,
+                input,
+                0,
+                &m_context,
+                &outputDesc,
+                &contextAttributes,
+                nullptr);
+        }
+
+        if (SUCCEEDED(status))
+        {
+            m_contextCreated = true;
+        }
+
+        if (outputBuffers[0].pvBuffer && outputBuffers[0].cbBuffer > 0)
+        {
+            const auto* const token = static_cast<const char*>(outputBuffers[0].pvBuffer);
+            output.insert(output.end(), token, token + outputBuffers[0].cbBuffer);
+        }
+        return status;
+    }
+};
+} // namespace ctsTraffic
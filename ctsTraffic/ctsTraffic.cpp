@@ -1,234 +1,724 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// ReSharper disable once CppUnusedIncludeDirective
-#include "targetver.h"
-
-// CRT headers
-#include <algorithm>
-#include <cstdio>
-#include <exception>
-// os headers
-#include <Windows.h>
-// local headers
-#include "ctsConfig.h"
-#include "ctsSocketBroker.h"
-#include "ctsMediaStreamServer.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-#include <wil/resource.h>
-
-using namespace ctsTraffic;
-using ctsConfig::g_configSettings;
-
-// global ptr for easing debugging
-static ctsSocketBroker* g_socketBroker = nullptr;
-
-static BOOL WINAPI CtrlBreakHandlerRoutine(DWORD) noexcept
-{
-	// handle all exit types - notify config that it's time to shut down
-	ctsConfig::PrintSummary(L"\n  **** ctrl-break hit -- shutting down ****\n");
-	ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-	return TRUE;
-}
-
-int __cdecl wmain(int argc, _In_reads_z_(argc) const wchar_t** argv)
-{
-	WSADATA wsadata{};
-	auto err = WSAStartup(WINSOCK_VERSION, &wsadata);
-	if (err != 0)
-	{
-		wprintf(L"ctsTraffic failed at WSAStartup [%d]\n", err);
-		return err;
-	}
-
-	try
-	{
-		if (!ctsConfig::Startup(argc, argv))
-		{
-			ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-			err = ERROR_INVALID_DATA;
-		}
-	}
-	catch (const std::invalid_argument& e)
-	{
-		ctsConfig::PrintErrorInfoOverride(wil::str_printf<std::wstring>(L"Invalid argument specified: %hs", e.what()).c_str());
-		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-		err = ERROR_INVALID_DATA;
-	}
-	catch (const std::exception& e)
-	{
-		ctsConfig::PrintExceptionOverride(e.what());
-		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-		err = ERROR_INVALID_DATA;
-	}
-
-	if (err == ERROR_INVALID_DATA)
-	{
-		wprintf(
-			L"\n"
-			L"For more information on command line options, specify -Help\n"
-			L"ctsTraffic.exe -Help:[tcp] [udp] [logging] [advanced]\n"
-			L"   -help:tcp : prints usage for TCP options\n"
-			L"   -help:udp : prints usage for UDP options\n"
-			L"   -help:logging : prints usage for logging options\n"
-			L"   -help:advanced : prints the usage for advanced and experimental options\n"
-			L"\n\n");
-		return err;
-	}
-
-	try
-	{
-		if (!SetConsoleCtrlHandler(CtrlBreakHandlerRoutine, TRUE))
-		{
-			THROW_WIN32_MSG(GetLastError(), "SetConsoleCtrlHandler");
-		}
-
-		ctsConfig::PrintSettings();
-		ctsConfig::PrintLegend();
-
-		// set the start timer as close as possible to the start of the engine
-		g_configSettings->StartTimeMilliseconds = ctl::ctTimer::snap_qpc_as_msec();
-		const auto broker(std::make_shared<ctsSocketBroker>());
-		g_socketBroker = broker.get();
-		broker->Start();
-
-		wil::unique_threadpool_timer statusTimer;
-		if (g_configSettings->StatusUpdateFrequencyMilliseconds > 0)
-		{
-			statusTimer.reset(CreateThreadpoolTimer([](PTP_CALLBACK_INSTANCE, PVOID, PTP_TIMER) { ctsConfig::PrintStatusUpdate(); }, nullptr, nullptr));
-			THROW_LAST_ERROR_IF(!statusTimer);
-			FILETIME zeroFiletime{};
-			SetThreadpoolTimer(statusTimer.get(), &zeroFiletime, g_configSettings->StatusUpdateFrequencyMilliseconds, 0);
-		}
-
-		if (!broker->Wait(g_configSettings->TimeLimit > 0 ? g_configSettings->TimeLimit : INFINITE))
-		{
-			ctsConfig::PrintSummary(L"\n  **** Time-limit of %lu reached ****\n", g_configSettings->TimeLimit);
-		}
-
-		if (g_configSettings->PauseAtEnd > 0)
-		{
-			// stop all status updates being printed to the console and pause before destroying the broker object
-			statusTimer.reset();
-			ctsConfig::PrintSummary(L"\n  **** Pausing-At-End for %lu milliseconds ****\n", g_configSettings->PauseAtEnd);
-			Sleep(g_configSettings->PauseAtEnd);
-		}
-	}
-	catch (const wil::ResultException& e)
-	{
-		ctsConfig::PrintExceptionOverride(e.what());
-		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-		return e.GetErrorCode();
-	}
-	catch (const std::bad_alloc&)
-	{
-		ctsConfig::PrintErrorInfoOverride(L"ctsTraffic failed: Out of Memory");
-		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-		return ERROR_OUTOFMEMORY;
-	}
-	catch (const std::exception& e)
-	{
-		ctsConfig::PrintErrorInfoOverride(wil::str_printf<std::wstring>(L"ctsTraffic failed: %hs", e.what()).c_str());
-		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
-		return ERROR_CANCELLED;
-	}
-
-	const auto totalTimeRun = ctl::ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds;
-
-	// write out the final status update
-	ctsConfig::PrintStatusUpdate();
-
-	ctsConfig::Shutdown(ctsConfig::ExitProcessType::Normal);
-
-	ctsConfig::PrintSummary(
-		L"\n\n"
-		L"  Historic Connection Statistics (all connections over the complete lifetime)  \n"
-		L"-------------------------------------------------------------------------------\n"
-		L"  SuccessfulConnections [%lld]   NetworkErrors [%lld]   ProtocolErrors [%lld]\n",
-		g_configSettings->ConnectionStatusDetails.m_successfulCompletionCount.GetValue(),
-		g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.GetValue(),
-		g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.GetValue());
-
-	if (g_configSettings->Protocol == ctsConfig::ProtocolType::TCP)
-	{
-		ctsConfig::PrintSummary(
-			L"\n"
-			L"  Total Bytes Recv : %lld\n"
-			L"  Total Bytes Sent : %lld\n",
-			g_configSettings->TcpStatusDetails.m_bytesRecv.GetValue(),
-			g_configSettings->TcpStatusDetails.m_bytesSent.GetValue());
-	}
-	else
-	{
-		// currently don't track UDP server stats
-		if (!ctsConfig::IsListening())
-		{
-			const auto successfulFrames = g_configSettings->UdpStatusDetails.m_successfulFrames.GetValue();
-			const auto droppedFrames = g_configSettings->UdpStatusDetails.m_droppedFrames.GetValue();
-			const auto duplicateFrames = g_configSettings->UdpStatusDetails.m_duplicateFrames.GetValue();
-			const auto errorFrames = g_configSettings->UdpStatusDetails.m_errorFrames.GetValue();
-
-			const auto totalFrames =
-				successfulFrames +
-				droppedFrames +
-				duplicateFrames +
-				errorFrames;
-			ctsConfig::PrintSummary(
-				L"\n"
-				L"  Total Bytes Recv : %lld\n"
-				L"  Total Successful Frames : %lld (%f)\n"
-				L"  Total Dropped Frames : %lld (%f)\n"
-				L"  Total Duplicate Frames : %lld (%f)\n"
-				L"  Total Error Frames : %lld (%f)\n",
-				g_configSettings->UdpStatusDetails.m_bitsReceived.GetValue() / 8LL,
-				successfulFrames,
-				totalFrames > 0 ? static_cast<double>(successfulFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0,
-				droppedFrames,
-				totalFrames > 0 ? static_cast<double>(droppedFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0,
-				duplicateFrames,
-				totalFrames > 0 ? static_cast<double>(duplicateFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0,
-				errorFrames,
-				totalFrames > 0 ? static_cast<double>(errorFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0);
-		}
-		else if (g_configSettings->EnableRecvSharding)
-		{
-
-			// If using the media-stream server, print per-listener connection counts
-			const auto listenerInfos = ctsMediaStreamServerImpl::GetListenerInfos();
-			if (!listenerInfos.empty())
-			{
-				ctsConfig::PrintSummary(L"\n  Connections per listener (shard):\n");
-				for (size_t i = 0; i < listenerInfos.size(); ++i)
-				{
-					const auto& info = listenerInfos[i];
-					ctsConfig::PrintSummary(
-						L"    Listener %zu : %ws : %u\n",
-						i,
-						info.ListeningAddress.format_complete_address().c_str(),
-						info.ConnectionCount);
-				}
-			}
-		}
-	}
-	ctsConfig::PrintSummary(
-		L"  Total Time : %lld ms.\n", totalTimeRun);
-
-	int64_t errorCount =
-		g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.GetValue() +
-		g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.GetValue();
-
-	errorCount = std::min<int64_t>(errorCount, MAXINT);
-	return static_cast<int>(errorCount);
-}
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "targetver.h"
+
+// CRT headers
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+// os headers
+#include <Windows.h>
+// local headers
+#include "ctsConfig.h"
+#include "ctsObjectPool.hpp"
+#include "ctsSocketBroker.h"
+#include "ctsMediaStreamServer.h"
+#include "ctsTCPFunctions.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using namespace ctsTraffic;
+using ctsConfig::g_configSettings;
+
+// global ptr for easing debugging
+static ctsSocketBroker* g_socketBroker = nullptr;
+
+static BOOL WINAPI CtrlBreakHandlerRoutine(DWORD) noexcept
+{
+	// handle all exit types - notify config that it's time to shut down
+	ctsConfig::PrintSummary(L"\n  **** ctrl-break hit -- shutting down ****\n");
+	ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+	return TRUE;
+}
+
+int __cdecl wmain(int argc, _In_reads_z_(argc) const wchar_t** argv)
+{
+	WSADATA wsadata{};
+	auto err = WSAStartup(WINSOCK_VERSION, &wsadata);
+	if (err != 0)
+	{
+		wprintf(L"ctsTraffic failed at WSAStartup [%d]\n", err);
+		return err;
+	}
+
+	try
+	{
+		if (!ctsConfig::Startup(argc, argv))
+		{
+			ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+			err = ERROR_INVALID_DATA;
+		}
+	}
+	catch (const std::invalid_argument& e)
+	{
+		ctsConfig::PrintErrorInfoOverride(wil::str_printf<std::wstring>(L"Invalid argument specified: %hs", e.what()).c_str());
+		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+		err = ERROR_INVALID_DATA;
+	}
+	catch (const std::exception& e)
+	{
+		ctsConfig::PrintExceptionOverride(e.what());
+		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+		err = ERROR_INVALID_DATA;
+	}
+
+	if (err == ERROR_INVALID_DATA)
+	{
+		wprintf(
+			L"\n"
+			L"For more information on command line options, specify -Help\n"
+			L"ctsTraffic.exe -Help:[tcp] [udp] [logging] [advanced]\n"
+			L"   -help:tcp : prints usage for TCP options\n"
+			L"   -help:udp : prints usage for UDP options\n"
+			L"   -help:logging : prints usage for logging options\n"
+			L"   -help:advanced : prints the usage for advanced and experimental options\n"
+			L"\n\n");
+		return err;
+	}
+
+	try
+	{
+		if (!SetConsoleCtrlHandler(CtrlBreakHandlerRoutine, TRUE))
+		{
+			THROW_WIN32_MSG(GetLastError(), "SetConsoleCtrlHandler");
+		}
+
+		ctsConfig::PrintSettings();
+		ctsConfig::PrintLegend();
+
+		// capture the memory used before any connections are made to calculate the memory per connection
+		if (ctsConfig::IoPatternType::IdleHold == g_configSettings->IoPattern)
+		{
+			g_configSettings->StartPrivateBytes = ctsConfig::GetProcessPrivateBytes();
+		}
+
+		// -SendFile is generated and brought into (or purged from) the system cache before the run is timed
+		if (!g_configSettings->SendFilePath.empty() || !g_configSettings->RecvFilePath.empty())
+		{
+			ctsSendRecvIocpOpenFiles();
+		}
+
+		// -LocalPort:[low,high] allocators must exist before -SocketPool binds any sockets
+		if (g_configSettings->LocalPortHigh != 0)
+		{
+			ctsWSASocketLocalPortsStart();
+		}
+
+		// -SocketPool is filled before the run is timed, so the first connections don't stall
+		if (g_configSettings->SocketPoolHigh > 0)
+		{
+			ctsWSASocketPoolStart();
+		}
+
+		// set the start timer as close as possible to the start of the engine
+		g_configSettings->StartTimeMilliseconds = ctl::ctTimer::snap_qpc_as_msec();
+		g_configSettings->StartProcessCycleTime = ctsConfig::GetProcessCycleTime();
+		const auto broker(std::make_shared<ctsSocketBroker>());
+		g_socketBroker = broker.get();
+		broker->Start();
+
+		wil::unique_threadpool_timer statusTimer;
+		if (g_configSettings->StatusUpdateFrequencyMilliseconds > 0)
+		{
+			statusTimer.reset(CreateThreadpoolTimer([](PTP_CALLBACK_INSTANCE, PVOID, PTP_TIMER) { ctsConfig::PrintStatusUpdate(); }, nullptr, nullptr));
+			THROW_LAST_ERROR_IF(!statusTimer);
+			FILETIME zeroFiletime{};
+			SetThreadpoolTimer(statusTimer.get(), &zeroFiletime, g_configSettings->StatusUpdateFrequencyMilliseconds, 0);
+		}
+
+		if (!broker->Wait(g_configSettings->TimeLimit > 0 ? g_configSettings->TimeLimit : INFINITE))
+		{
+			ctsConfig::PrintSummary(L"\n  **** Time-limit of %lu reached ****\n", g_configSettings->TimeLimit);
+		}
+
+		if (g_configSettings->PauseAtEnd > 0)
+		{
+			// stop all status updates being printed to the console and pause before destroying the broker object
+			statusTimer.reset();
+			ctsConfig::PrintSummary(L"\n  **** Pausing-At-End for %lu milliseconds ****\n", g_configSettings->PauseAtEnd);
+			Sleep(g_configSettings->PauseAtEnd);
+		}
+	}
+	catch (const wil::ResultException& e)
+	{
+		ctsConfig::PrintExceptionOverride(e.what());
+		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+		return e.GetErrorCode();
+	}
+	catch (const std::bad_alloc&)
+	{
+		ctsConfig::PrintErrorInfoOverride(L"ctsTraffic failed: Out of Memory");
+		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+		return ERROR_OUTOFMEMORY;
+	}
+	catch (const std::exception& e)
+	{
+		ctsConfig::PrintErrorInfoOverride(wil::str_printf<std::wstring>(L"ctsTraffic failed: %hs", e.what()).c_str());
+		ctsConfig::Shutdown(ctsConfig::ExitProcessType::Rude);
+		return ERROR_CANCELLED;
+	}
+
+	// -RecvFileMode:unbuffered: the received data not yet written as whole sectors
+	if (!g_configSettings->RecvFilePath.empty())
+	{
+		ctsSendRecvIocpCloseFiles();
+	}
+
+	const auto totalTimeRun = ctl::ctTimer::snap_qpc_as_msec() - g_configSettings->StartTimeMilliseconds;
+
+	// write out the final status update
+	ctsConfig::PrintStatusUpdate();
+
+	ctsConfig::Shutdown(ctsConfig::ExitProcessType::Normal);
+
+	ctsConfig::PrintSummary(
+		L"\n\n"
+		L"  Historic Connection Statistics (all connections over the complete lifetime)  \n"
+		L"-------------------------------------------------------------------------------\n"
+		L"  SuccessfulConnections [%lld]   NetworkErrors [%lld]   ProtocolErrors [%lld]\n",
+		g_configSettings->ConnectionStatusDetails.m_successfulCompletionCount.GetValue(),
+		g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.GetValue(),
+		g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.GetValue());
+
+	// per-connection objects are recycled through ctsObjectPool: show what still had to come from the heap
+	{
+		const auto totalConnections =
+			g_configSettings->ConnectionStatusDetails.m_successfulCompletionCount.GetValue() +
+			g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.GetValue() +
+			g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.GetValue();
+		const auto heapAllocations = ctsObjectPoolStatistics::GetHeapAllocations();
+		ctsConfig::PrintSummary(
+			L"  Connections/sec : %.2f   Pooled Allocations : %lld reused, %lld from the heap (%.2f per connection)\n",
+			totalTimeRun > 0 ? static_cast<double>(totalConnections) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0,
+			ctsObjectPoolStatistics::GetReused(),
+			heapAllocations,
+			totalConnections > 0 ? static_cast<double>(heapAllocations) / static_cast<double>(totalConnections) : 0.0);
+	}
+
+	// only -SocketPool takes pre-created sockets: stalls are connections that found the pool empty
+	if (g_configSettings->SocketPoolHigh > 0)
+	{
+		const auto stalls = g_configSettings->SocketPoolStalls.GetValue();
+		ctsConfig::PrintSummary(
+			L"  Socket Pool : %lld sockets taken, %lld stalls (%.3f ms average stall)\n",
+			g_configSettings->SocketPoolHits.GetValue(),
+			stalls,
+			stalls > 0 ? static_cast<double>(g_configSettings->SocketPoolStallUsec.GetValue()) / 1000.0 / static_cast<double>(stalls) : 0.0);
+	}
+
+	// only -LocalPort:[low,high] allocates local ports from a range
+	if (const auto& allocateTime = g_configSettings->LocalPortAllocateUsec; g_configSettings->LocalPortHigh != 0)
+	{
+		const auto allocations = g_configSettings->LocalPortAllocations.GetValue();
+		const auto exhausted = g_configSettings->LocalPortExhausted.GetValue();
+		ctsConfig::PrintSummary(
+			L"  Local Ports : %lld bound, %lld failed (%.2f%%) with every port in use or in TIME_WAIT, %lld found already bound\n"
+			L"  Local Port Allocate Time (microseconds, from allocating a port to binding it):\n"
+			L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n",
+			allocations,
+			exhausted,
+			allocations + exhausted > 0 ? static_cast<double>(exhausted) * 100.0 / static_cast<double>(allocations + exhausted) : 0.0,
+			g_configSettings->LocalPortBindConflicts.GetValue(),
+			allocateTime.GetMean(),
+			allocateTime.GetPercentile(50.0),
+			allocateTime.GetPercentile(99.0),
+			allocateTime.GetMax());
+	}
+
+	// only -TransfersPerConnection runs more than one transfer per connection
+	if (g_configSettings->TransfersPerConnection > 1)
+	{
+		const auto& firstTransfers = g_configSettings->FirstTransferUsec;
+		const auto& warmTransfers = g_configSettings->WarmTransferUsec;
+		const auto warmTransferUsec = warmTransfers.GetMean() * warmTransfers.GetCount();
+		ctsConfig::PrintSummary(
+			L"  Transfer Time (microseconds) - the first transfer on each of %lld connections:\n"
+			L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n"
+			L"  Transfer Time (microseconds) - %lld later transfers on warm connections (%.3f Mbps while transferring):\n"
+			L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n",
+			firstTransfers.GetCount(),
+			firstTransfers.GetMean(),
+			firstTransfers.GetPercentile(50.0),
+			firstTransfers.GetPercentile(99.0),
+			firstTransfers.GetMax(),
+			warmTransfers.GetCount(),
+			warmTransferUsec > 0 ? static_cast<double>(g_configSettings->WarmTransferBytes.GetValue()) * 8.0 / static_cast<double>(warmTransferUsec) : 0.0,
+			warmTransfers.GetMean(),
+			warmTransfers.GetPercentile(50.0),
+			warmTransfers.GetPercentile(99.0),
+			warmTransfers.GetMax());
+	}
+
+	// only -ConnectionRate starts connections on a schedule
+	if (const auto scheduledStarts = g_configSettings->ConnectionRateStarts.GetValue(); scheduledStarts > 0)
+	{
+		const auto elapsedUsec = g_configSettings->ConnectionRateElapsedUsec.GetValue();
+		const auto& lateness = g_configSettings->ConnectionStartLatenessUsec;
+		ctsConfig::PrintSummary(
+			L"  Connection Rate : intended %.2f per second, achieved %.2f per second (%lld of %lld intended starts made, at most %lld behind)\n"
+			L"  Connection Start Lateness (microseconds, from each start's intended time) - %lld starts more than 1ms late:\n"
+			L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  P99.9 [%lld]  Max [%lld]\n",
+			elapsedUsec > 0 ? static_cast<double>(g_configSettings->ConnectionRateIntended.GetValue()) * 1000000.0 / static_cast<double>(elapsedUsec) : 0.0,
+			elapsedUsec > 0 ? static_cast<double>(scheduledStarts) * 1000000.0 / static_cast<double>(elapsedUsec) : 0.0,
+			scheduledStarts,
+			g_configSettings->ConnectionRateIntended.GetValue(),
+			g_configSettings->ConnectionRateMaxBehind.GetValue(),
+			g_configSettings->ConnectionLateStarts.GetValue(),
+			lateness.GetMean(),
+			lateness.GetPercentile(50.0),
+			lateness.GetPercentile(90.0),
+			lateness.GetPercentile(99.0),
+			lateness.GetPercentile(99.9),
+			lateness.GetMax());
+	}
+
+	// only -conn:HappyEyeballs races connection attempts
+	if (const auto attempts = g_configSettings->HappyEyeballsAttempts.GetValue(); attempts > 0)
+	{
+		const auto& ipv4ConnectTime = g_configSettings->HappyEyeballsIpv4ConnectUsec;
+		const auto& ipv6ConnectTime = g_configSettings->HappyEyeballsIpv6ConnectUsec;
+		ctsConfig::PrintSummary(
+			L"  HappyEyeballs : %lld connection attempts, %lld cancelled when another attempt connected first\n"
+			L"  HappyEyeballs IPv6 : %lld connections won - Connect Time (microseconds, from the winning attempt starting):\n"
+			L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n"
+			L"  HappyEyeballs IPv4 : %lld connections won - Connect Time (microseconds, from the winning attempt starting):\n"
+			L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n",
+			attempts,
+			g_configSettings->HappyEyeballsCancelled.GetValue(),
+			g_configSettings->HappyEyeballsIpv6Wins.GetValue(),
+			ipv6ConnectTime.GetMean(),
+			ipv6ConnectTime.GetPercentile(50.0),
+			ipv6ConnectTime.GetPercentile(99.0),
+			ipv6ConnectTime.GetMax(),
+			g_configSettings->HappyEyeballsIpv4Wins.GetValue(),
+			ipv4ConnectTime.GetMean(),
+			ipv4ConnectTime.GetPercentile(50.0),
+			ipv4ConnectTime.GetPercentile(99.0),
+			ipv4ConnectTime.GetMax());
+	}
+
+	// only -conn:ConnectByName resolves target names as connections are made
+	if (const auto queries = g_configSettings->NameResolveQueries.GetValue(); queries > 0)
+	{
+		const auto cacheHits = g_configSettings->NameResolveCacheHits.GetValue();
+		const auto coalesced = g_configSettings->NameResolveCoalesced.GetValue();
+		const auto lookups = cacheHits + coalesced + queries;
+		const auto& queryTime = g_configSettings->NameResolveQueryUsec;
+		const auto& waitTime = g_configSettings->NameResolveWaitUsec;
+		ctsConfig::PrintSummary(
+			L"  Name Resolution : %lld lookups, %lld cache hits (%.2f%%), %lld waited on a query in flight, %lld DNS queries (%lld failed)\n"
+			L"  DNS Query Time (microseconds):\n"
+			L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n"
+			L"  Name Resolve Wait (microseconds, from the connection looking up its target to having its addresses):\n"
+			L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  Max [%lld]\n",
+			lookups,
+			cacheHits,
+			static_cast<double>(cacheHits) * 100.0 / static_cast<double>(lookups),
+			coalesced,
+			queries,
+			g_configSettings->NameResolveFailures.GetValue(),
+			queryTime.GetMean(),
+			queryTime.GetPercentile(50.0),
+			queryTime.GetPercentile(99.0),
+			queryTime.GetMax(),
+			waitTime.GetMean(),
+			waitTime.GetPercentile(50.0),
+			waitTime.GetPercentile(90.0),
+			waitTime.GetPercentile(99.0),
+			waitTime.GetMax());
+	}
+
+	// only -Acc:AcceptEx hands accepted connections to the sockets requesting them
+	if (const auto& pickupTime = g_configSettings->AcceptExPickupUsec; pickupTime.GetCount() > 0)
+	{
+		ctsConfig::PrintSummary(
+			L"  AcceptEx Pickup Time (microseconds, from the handshake completing to a connection taking the socket):\n"
+			L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  P99.9 [%lld]  Max [%lld]\n"
+			L"  AcceptEx Depth : at most %lld pended per listener   Backlog Exhausted : %lld times (no AcceptEx left pended)\n",
+			pickupTime.GetMean(),
+			pickupTime.GetPercentile(50.0),
+			pickupTime.GetPercentile(90.0),
+			pickupTime.GetPercentile(99.0),
+			pickupTime.GetPercentile(99.9),
+			pickupTime.GetMax(),
+			g_configSettings->AcceptExPeakDepth.GetValue(),
+			g_configSettings->AcceptExBacklogExhausted.GetValue());
+	}
+
+	// only -AcceptShards splits the AcceptEx requests of each listener across shards
+	if (g_configSettings->AcceptShards > 0)
+	{
+		const auto shardInfos = ctsAcceptExShardInfos();
+		const size_t shardCount = g_configSettings->AcceptShards;
+		for (size_t listenerStart = 0; listenerStart < shardInfos.size(); listenerStart += shardCount)
+		{
+			const auto listenerEnd = std::min(listenerStart + shardCount, shardInfos.size());
+			ctsConfig::PrintSummary(
+				L"  AcceptEx Shards : %ws\n",
+				shardInfos[listenerStart].ListeningAddress.format_complete_address().c_str());
+			for (auto shard = listenerStart; shard < listenerEnd; ++shard)
+			{
+				const auto& info = shardInfos[shard];
+				ctsConfig::PrintSummary(
+					L"    Shard %u : %llu accepts (%.1f per second)   Peak Pended : %u   Backlog Exhausted : %llu\n",
+					info.ShardIndex,
+					info.Accepts,
+					totalTimeRun > 0 ? static_cast<double>(info.Accepts) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0,
+					info.PeakPended,
+					info.BacklogExhausted);
+			}
+		}
+	}
+
+	// only -IO:RioIocp registers buffers
+	if (const auto rioRegistrations = g_configSettings->RioBufferRegistrations.GetValue(); rioRegistrations > 0)
+	{
+		const auto totalConnections =
+			g_configSettings->ConnectionStatusDetails.m_successfulCompletionCount.GetValue() +
+			g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.GetValue() +
+			g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.GetValue();
+		ctsConfig::PrintSummary(
+			L"  RIO Buffer Registrations : %lld (%.2f per connection)\n",
+			rioRegistrations,
+			totalConnections > 0 ? static_cast<double>(rioRegistrations) / static_cast<double>(totalConnections) : 0.0);
+	}
+
+	if (g_configSettings->Protocol == ctsConfig::ProtocolType::TCP)
+	{
+		ctsConfig::PrintSummary(
+			L"\n"
+			L"  Total Bytes Recv : %lld\n"
+			L"  Total Bytes Sent : %lld\n",
+			g_configSettings->TcpStatusDetails.m_bytesRecv.GetValue(),
+			g_configSettings->TcpStatusDetails.m_bytesSent.GetValue());
+
+		const auto totalTcpBytes = g_configSettings->TcpStatusDetails.m_bytesRecv.GetValue() + g_configSettings->TcpStatusDetails.m_bytesSent.GetValue();
+		if (const auto cycleTime = ctsConfig::GetProcessCycleTime(); cycleTime > g_configSettings->StartProcessCycleTime && totalTcpBytes > 0)
+		{
+			ctsConfig::PrintSummary(
+				L"  CPU Cycles Per Byte : %.2f\n",
+				static_cast<double>(cycleTime - g_configSettings->StartProcessCycleTime) / static_cast<double>(totalTcpBytes));
+		}
+
+		// only -ZeroCopySend counts sends made with SO_SNDBUF=0
+		if (const auto zeroCopySends = g_configSettings->ZeroCopySendCount.GetValue(); zeroCopySends > 0)
+		{
+			const auto copiedSends = g_configSettings->ZeroCopySendCopiedCount.GetValue();
+			ctsConfig::PrintSummary(
+				L"  Zero-Copy Sends : %lld   Copied By The Stack : %lld (%.2f%%)\n",
+				zeroCopySends,
+				copiedSends,
+				static_cast<double>(copiedSends) * 100.0 / static_cast<double>(zeroCopySends));
+		}
+
+		// only -ZeroCopyRecv counts the bytes received directly into the posted receives
+		const auto zeroCopyRecvBytes = g_configSettings->ZeroCopyRecvBytes.GetValue();
+		if (const auto copiedRecvBytes = g_configSettings->ZeroCopyRecvCopiedBytes.GetValue(); zeroCopyRecvBytes + copiedRecvBytes > 0)
+		{
+			ctsConfig::PrintSummary(
+				L"  Zero-Copy Recv Bytes : %lld   Copied By The Stack : %lld (%.2f%%)\n",
+				zeroCopyRecvBytes,
+				copiedRecvBytes,
+				static_cast<double>(copiedRecvBytes) * 100.0 / static_cast<double>(zeroCopyRecvBytes + copiedRecvBytes));
+		}
+
+		// only -SendFile and -RecvFile move bytes through files: compare their throughput and CPU with the network-only numbers
+		const auto sendFileBytes = g_configSettings->SendFileBytes.GetValue();
+		if (const auto recvFileBytes = g_configSettings->RecvFileBytes.GetValue(); sendFileBytes + recvFileBytes > 0)
+		{
+			const auto fileBytes = sendFileBytes + recvFileBytes;
+			const auto cycleTime = ctsConfig::GetProcessCycleTime();
+			const auto writeUsec = g_configSettings->RecvFileWriteUsec.GetValue();
+			ctsConfig::PrintSummary(
+				L"  File Bytes Sent (TransmitFile) : %lld   File Bytes Written : %lld (%.1f usec per MB written)\n"
+				L"  Network Throughput : %.1f bytes per second   File + Network Throughput : %.1f bytes per second\n"
+				L"  CPU Cycles Per File Byte : %.2f\n",
+				sendFileBytes,
+				recvFileBytes,
+				recvFileBytes > 0 ? static_cast<double>(writeUsec) * 1048576.0 / static_cast<double>(recvFileBytes) : 0.0,
+				totalTimeRun > 0 ? static_cast<double>(totalTcpBytes) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0,
+				totalTimeRun > 0 ? static_cast<double>(fileBytes) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0,
+				cycleTime > g_configSettings->StartProcessCycleTime
+					? static_cast<double>(cycleTime - g_configSettings->StartProcessCycleTime) / static_cast<double>(fileBytes)
+					: 0.0);
+		}
+
+		// only -IO:WSAPoll counts its syscalls
+		if (const auto syscallCount = g_configSettings->WSAPollSyscallCount.GetValue(); syscallCount > 0)
+		{
+			ctsConfig::PrintSummary(
+				L"  Total Syscalls (send, recv, WSAPoll) : %lld (%.1f per GB)   Budget Yields : %lld (a connection deferred to the next loop pass)\n",
+				syscallCount,
+				totalTcpBytes > 0 ? static_cast<double>(syscallCount) * 1073741824.0 / static_cast<double>(totalTcpBytes) : 0.0,
+				g_configSettings->WSAPollBudgetYields.GetValue());
+		}
+
+		// only -IO:RioIocp with -SubmitBatchSize flushes submission queues
+		if (const auto& batchRequests = g_configSettings->SubmitBatchRequests; batchRequests.GetCount() > 0)
+		{
+			const auto& flushLatency = g_configSettings->SubmitFlushLatencyUsec;
+			ctsConfig::PrintSummary(
+				L"  RIO Requests Per Submission over %lld submissions:\n"
+				L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n"
+				L"  RIO Submission Delay (microseconds):\n"
+				L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n",
+				batchRequests.GetCount(),
+				batchRequests.GetMean(),
+				batchRequests.GetPercentile(50.0),
+				batchRequests.GetPercentile(99.0),
+				batchRequests.GetMax(),
+				flushLatency.GetMean(),
+				flushLatency.GetPercentile(50.0),
+				flushLatency.GetPercentile(99.0),
+				flushLatency.GetMax());
+		}
+
+		// only -IO:RioIocp with -BusyPoll spins waiting for completions
+		if (const auto& busyPollWaits = g_configSettings->BusyPollWaitUsec; busyPollWaits.GetCount() > 0)
+		{
+			const auto spinUsec = g_configSettings->BusyPollSpinUsec.GetValue();
+			const auto workUsec = g_configSettings->BusyPollWorkUsec.GetValue();
+			ctsConfig::PrintSummary(
+				L"  Busy Poll Spin Time : %lld usec   Completion Work Time : %lld usec (%.2f%% of worker time spinning)\n"
+				L"  Notifications Dequeued While Spinning : %lld   After Blocking : %lld\n"
+				L"  Busy Poll Wait For Completions (microseconds) over %lld notifications:\n"
+				L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  P99.9 [%lld]  Max [%lld]\n",
+				spinUsec,
+				workUsec,
+				spinUsec + workUsec > 0 ? static_cast<double>(spinUsec) * 100.0 / static_cast<double>(spinUsec + workUsec) : 0.0,
+				g_configSettings->BusyPollSpinWakeups.GetValue(),
+				g_configSettings->BusyPollBlockedWakeups.GetValue(),
+				busyPollWaits.GetCount(),
+				busyPollWaits.GetMean(),
+				busyPollWaits.GetPercentile(50.0),
+				busyPollWaits.GetPercentile(90.0),
+				busyPollWaits.GetPercentile(99.0),
+				busyPollWaits.GetPercentile(99.9),
+				busyPollWaits.GetMax());
+		}
+
+		// only -IO:Tls negotiates TLS sessions
+		const auto tlsHandshakes = g_configSettings->TlsHandshakes.GetValue();
+		if (const auto tlsHandshakeFailures = g_configSettings->TlsHandshakeFailures.GetValue(); tlsHandshakes + tlsHandshakeFailures > 0)
+		{
+			const auto& handshakeTime = g_configSettings->TlsHandshakeUsec;
+			const auto bytesSent = g_configSettings->TcpStatusDetails.m_bytesSent.GetValue();
+			const auto bytesRecv = g_configSettings->TcpStatusDetails.m_bytesRecv.GetValue();
+			const auto recordsSent = g_configSettings->TlsRecordsSent.GetValue();
+			const auto ciphertextSent = g_configSettings->TlsCiphertextBytesSent.GetValue();
+			ctsConfig::PrintSummary(
+				L"  TLS Handshakes : %lld (%.1f per second)   Failed : %lld\n"
+				L"  TLS Handshake Time (microseconds):\n"
+				L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  Max [%lld]\n"
+				L"  TLS Records Sent : %lld (%.1f plaintext bytes per record)   Record Overhead : %.2f%% of plaintext sent\n"
+				L"  TLS Ciphertext Bytes Sent : %lld   Recv : %lld\n"
+				L"  TLS Encrypt Time : %.2f ns per byte sent   Decrypt Time : %.2f ns per byte received\n",
+				tlsHandshakes,
+				totalTimeRun > 0 ? static_cast<double>(tlsHandshakes) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0,
+				tlsHandshakeFailures,
+				handshakeTime.GetMean(),
+				handshakeTime.GetPercentile(50.0),
+				handshakeTime.GetPercentile(90.0),
+				handshakeTime.GetPercentile(99.0),
+				handshakeTime.GetMax(),
+				recordsSent,
+				recordsSent > 0 ? static_cast<double>(bytesSent) / static_cast<double>(recordsSent) : 0.0,
+				bytesSent > 0 ? static_cast<double>(ciphertextSent - bytesSent) * 100.0 / static_cast<double>(bytesSent) : 0.0,
+				ciphertextSent,
+				g_configSettings->TlsCiphertextBytesRecv.GetValue(),
+				bytesSent > 0 ? static_cast<double>(g_configSettings->TlsEncryptUsec.GetValue()) * 1000.0 / static_cast<double>(bytesSent) : 0.0,
+				bytesRecv > 0 ? static_cast<double>(g_configSettings->TlsDecryptUsec.GetValue()) * 1000.0 / static_cast<double>(bytesRecv) : 0.0);
+		}
+
+		// only -IO:Quic runs connections as QUIC streams
+		const auto quicHandshakes = g_configSettings->QuicHandshakes.GetValue();
+		if (const auto quicHandshakeFailures = g_configSettings->QuicHandshakeFailures.GetValue(); quicHandshakes + quicHandshakeFailures > 0)
+		{
+			const auto& handshakeTime = g_configSettings->QuicHandshakeUsec;
+			const auto& streamStartTime = g_configSettings->QuicStreamStartUsec;
+			const auto streamsOpened = g_configSettings->QuicStreamsOpened.GetValue();
+			// goodput: the application bytes the patterns moved, excluding all QUIC and UDP overhead
+			const auto goodputBytes = g_configSettings->TcpStatusDetails.m_bytesSent.GetValue() + g_configSettings->TcpStatusDetails.m_bytesRecv.GetValue();
+			ctsConfig::PrintSummary(
+				L"  QUIC Handshakes : %lld (%.1f per second)   Failed : %lld\n"
+				L"  QUIC Handshake Time (microseconds):\n"
+				L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  Max [%lld]\n"
+				L"  QUIC Streams Opened : %lld (%.1f per QUIC connection)\n"
+				L"  QUIC Stream Start Time (microseconds, including any handshake the stream waited on):\n"
+				L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  Max [%lld]\n"
+				L"  QUIC Goodput : %.1f bytes per second\n",
+				quicHandshakes,
+				totalTimeRun > 0 ? static_cast<double>(quicHandshakes) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0,
+				quicHandshakeFailures,
+				handshakeTime.GetMean(),
+				handshakeTime.GetPercentile(50.0),
+				handshakeTime.GetPercentile(90.0),
+				handshakeTime.GetPercentile(99.0),
+				handshakeTime.GetMax(),
+				streamsOpened,
+				quicHandshakes > 0 ? static_cast<double>(streamsOpened) / static_cast<double>(quicHandshakes) : 0.0,
+				streamStartTime.GetMean(),
+				streamStartTime.GetPercentile(50.0),
+				streamStartTime.GetPercentile(90.0),
+				streamStartTime.GetPercentile(99.0),
+				streamStartTime.GetMax(),
+				totalTimeRun > 0 ? static_cast<double>(goodputBytes) * 1000.0 / static_cast<double>(totalTimeRun) : 0.0);
+		}
+
+		if (ctsConfig::IoPatternType::IdleHold == g_configSettings->IoPattern)
+		{
+			const auto peakConnections = g_configSettings->IdleHoldPeakConnections.GetValue();
+			const auto peakPrivateBytes = g_configSettings->IdleHoldPeakPrivateBytes.GetValue();
+			ctsConfig::PrintSummary(
+				L"\n"
+				L"  Peak Held Connections : %lld\n"
+				L"  Private Bytes Per Connection : %lld (%lld bytes held at the peak, %lld bytes before connecting)\n",
+				peakConnections,
+				peakConnections > 0 ? (peakPrivateBytes - g_configSettings->StartPrivateBytes) / peakConnections : 0LL,
+				peakPrivateBytes,
+				g_configSettings->StartPrivateBytes);
+
+			// only the client measures the keepalive round-trip time
+			const auto& roundTrips = g_configSettings->KeepAliveRoundTripUsec;
+			if (roundTrips.GetCount() > 0)
+			{
+				ctsConfig::PrintSummary(
+					L"  KeepAlive Round-Trip Time (microseconds) over %lld keepalives:\n"
+					L"    Mean [%lld]  P50 [%lld]  P90 [%lld]  P99 [%lld]  P99.9 [%lld]  Max [%lld]\n",
+					roundTrips.GetCount(),
+					roundTrips.GetMean(),
+					roundTrips.GetPercentile(50.0),
+					roundTrips.GetPercentile(90.0),
+					roundTrips.GetPercentile(99.0),
+					roundTrips.GetPercentile(99.9),
+					roundTrips.GetMax());
+			}
+		}
+	}
+	else
+	{
+		// currently don't track UDP server stats
+		if (!ctsConfig::IsListening())
+		{
+			const auto successfulFrames = g_configSettings->UdpStatusDetails.m_successfulFrames.GetValue();
+			const auto droppedFrames = g_configSettings->UdpStatusDetails.m_droppedFrames.GetValue();
+			const auto duplicateFrames = g_configSettings->UdpStatusDetails.m_duplicateFrames.GetValue();
+			const auto errorFrames = g_configSettings->UdpStatusDetails.m_errorFrames.GetValue();
+
+			const auto totalFrames =
+				successfulFrames +
+				droppedFrames +
+				duplicateFrames +
+				errorFrames;
+			ctsConfig::PrintSummary(
+				L"\n"
+				L"  Total Bytes Recv : %lld\n"
+				L"  Total Successful Frames : %lld (%f)\n"
+				L"  Total Dropped Frames : %lld (%f)\n"
+				L"  Total Duplicate Frames : %lld (%f)\n"
+				L"  Total Error Frames : %lld (%f)\n",
+				g_configSettings->UdpStatusDetails.m_bitsReceived.GetValue() / 8LL,
+				successfulFrames,
+				totalFrames > 0 ? static_cast<double>(successfulFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0,
+				droppedFrames,
+				totalFrames > 0 ? static_cast<double>(droppedFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0,
+				duplicateFrames,
+				totalFrames > 0 ? static_cast<double>(duplicateFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0,
+				errorFrames,
+				totalFrames > 0 ? static_cast<double>(errorFrames) / static_cast<double>(totalFrames) * 100.0 : 0.0);
+		}
+		else if (g_configSettings->EnableRecvSharding)
+		{
+
+			// If using the media-stream server, print per-listener connection counts
+			const auto listenerInfos = ctsMediaStreamServerImpl::GetListenerInfos();
+			if (!listenerInfos.empty())
+			{
+				ctsConfig::PrintSummary(L"\n  Connections per listener (shard):\n");
+				for (size_t i = 0; i < listenerInfos.size(); ++i)
+				{
+					const auto& info = listenerInfos[i];
+					ctsConfig::PrintSummary(
+						L"    Listener %zu : %ws : %u\n",
+						i,
+						info.ListeningAddress.format_complete_address().c_str(),
+						info.ConnectionCount);
+				}
+			}
+		}
+
+		// the number of send or recv calls shows the effect of -UdpOffload (one call carrying many datagrams)
+		const auto totalTimeSeconds = static_cast<double>(totalTimeRun) / 1000.0;
+		int64_t totalUdpBits = 0;
+		if (ctsConfig::IsListening())
+		{
+			const auto sendCalls = g_configSettings->UdpSendCalls.GetValue();
+			totalUdpBits = g_configSettings->UdpSendBytes.GetValue() * 8LL;
+			if (sendCalls > 0)
+			{
+				ctsConfig::PrintSummary(
+					L"\n"
+					L"  Total Send Calls : %lld (%.1f per second)   Bytes Per Send Call : %lld   Datagrams Per Send Call : %.2f\n",
+					sendCalls,
+					totalTimeSeconds > 0.0 ? static_cast<double>(sendCalls) / totalTimeSeconds : 0.0,
+					totalUdpBits / 8LL / sendCalls,
+					static_cast<double>(g_configSettings->UdpSendDatagrams.GetValue()) / static_cast<double>(sendCalls));
+			}
+		}
+		else
+		{
+			const auto recvCalls = g_configSettings->UdpRecvCalls.GetValue();
+			totalUdpBits = g_configSettings->UdpStatusDetails.m_bitsReceived.GetValue();
+			if (recvCalls > 0)
+			{
+				ctsConfig::PrintSummary(
+					L"  Total Recv Calls : %lld (%.1f per second)   Datagrams Per Recv Call : %.2f\n",
+					recvCalls,
+					totalTimeSeconds > 0.0 ? static_cast<double>(recvCalls) / totalTimeSeconds : 0.0,
+					static_cast<double>(g_configSettings->UdpRecvDatagrams.GetValue()) / static_cast<double>(recvCalls));
+			}
+
+			if (const auto& frameJitter = g_configSettings->UdpFrameJitterUsec; frameJitter.GetCount() > 0)
+			{
+				ctsConfig::PrintSummary(
+					L"  Frame Jitter (microseconds) over %lld frames:\n"
+					L"    Mean [%lld]  P50 [%lld]  P99 [%lld]  Max [%lld]\n",
+					frameJitter.GetCount(),
+					frameJitter.GetMean(),
+					frameJitter.GetPercentile(50.0),
+					frameJitter.GetPercentile(99.0),
+					frameJitter.GetMax());
+			}
+		}
+
+		if (const auto cycleTime = ctsConfig::GetProcessCycleTime(); cycleTime > g_configSettings->StartProcessCycleTime && totalUdpBits > 0)
+		{
+			ctsConfig::PrintSummary(
+				L"  CPU Cycles Per Gbit : %.0f\n",
+				static_cast<double>(cycleTime - g_configSettings->StartProcessCycleTime) * 1000000000.0 / static_cast<double>(totalUdpBits));
+		}
+	}
+	ctsConfig::PrintSummary(
+		L"  Total Time : %lld ms.\n", totalTimeRun);
+
+	int64_t errorCount =
+		g_configSettings->ConnectionStatusDetails.m_connectionErrorCount.GetValue() +
+		g_configSettings->ConnectionStatusDetails.m_protocolErrorCount.GetValue();
+
+	errorCount = std::min<int64_t>(errorCount, MAXINT);
+	return static_cast<int>(errorCount);
+}
@@ -0,0 +1,625 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctTimer.hpp>
+// project headers
+#include "ctsConfig.h"
+#include "ctsSocket.h"
+#include "ctsIOTask.hpp"
+#include "ctsWSAPollSend.hpp"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+//
+// ctsWSAPoll
+//
+// A readiness-based IO engine: non-blocking send/recv driven by WSAPoll
+// - every worker thread runs its own event loop over the sockets assigned to it
+// - a socket is pinned to one loop for its lifetime, so its IO is never processed concurrently
+//
+// Readiness is consumed edge-triggered:
+// - send/recv are attempted as soon as the pattern offers a task
+// - a socket is only added to the WSAPoll set for the direction which returned WSAEWOULDBLOCK
+//   and is removed once that direction is reported ready
+//
+// Tasks offered by the pattern are queued until the socket is ready
+// - the pattern counts queued tasks as in-flight, so -PrePostRecvs/-PrePostSends
+//   is the number of tasks kept ready to run for each direction
+//
+// Each connection can make at most c_ioBudgetPerPass send/recv calls per pass of its loop
+// - a connection which always has data ready continues on the next pass, after the other connections
+//
+namespace ctsTraffic { namespace Wsapoll
+    {
+        struct WSAPollConnection
+        {
+            explicit WSAPollConnection(std::weak_ptr<ctsSocket> weakSocket) noexcept :
+                m_weakSocket(std::move(weakSocket))
+            {
+            }
+
+            std::weak_ptr<ctsSocket> m_weakSocket;
+            // the SOCKET added to the WSAPoll set - only valid after the first time the connection is processed
+            SOCKET m_socket = INVALID_SOCKET;
+            // tasks ready to run once the socket is ready
+            std::deque<ctsTask> m_sendTasks;
+            std::deque<ctsTask> m_recvTasks;
+            // a non-blocking send can accept only part of the buffer
+            // - the rest is sent when the socket is next writable, before completing the task
+            uint32_t m_partialSendBytes = 0;
+            // tasks the pattern scheduled for a future time
+            std::vector<std::pair<int64_t, ctsTask>> m_timedTasks;
+            // set when send/recv returned WSAEWOULDBLOCK: the socket is polled for that direction
+            bool m_sendBlocked = false;
+            bool m_recvBlocked = false;
+            // set when the connection has work to process on the next pass of the loop
+            bool m_ready = true;
+        };
+
+        class WSAPollLoop
+        {
+        public:
+            WSAPollLoop()
+            {
+                // the loop is woken for new connections by sending a datagram to itself
+                m_wakeSocket.reset(WSASocketW(AF_INET, SOCK_DGRAM, IPPROTO_UDP, nullptr, 0, 0));
+                if (!m_wakeSocket)
+                {
+                    THROW_WIN32_MSG(WSAGetLastError(), "WSASocket (ctsWSAPoll wake socket)");
+                }
+
+                wil::network::socket_address wakeAddress{AF_INET};
+                wakeAddress.set_address_loopback();
+                if (SOCKET_ERROR == bind(m_wakeSocket.get(), wakeAddress.sockaddr(), wakeAddress.size()))
+                {
+                    THROW_WIN32_MSG(WSAGetLastError(), "bind (ctsWSAPoll wake socket)");
+                }
+                int wakeAddressLength = wakeAddress.size();
+                if (SOCKET_ERROR == getsockname(m_wakeSocket.get(), wakeAddress.sockaddr(), &wakeAddressLength))
+                {
+                    THROW_WIN32_MSG(WSAGetLastError(), "getsockname (ctsWSAPoll wake socket)");
+                }
+                if (SOCKET_ERROR == connect(m_wakeSocket.get(), wakeAddress.sockaddr(), wakeAddressLength))
+                {
+                    THROW_WIN32_MSG(WSAGetLastError(), "connect (ctsWSAPoll wake socket)");
+                }
+                u_long nonBlocking = 1;
+                if (SOCKET_ERROR == ioctlsocket(m_wakeSocket.get(), FIONBIO, &nonBlocking))
+                {
+                    THROW_WIN32_MSG(WSAGetLastError(), "ioctlsocket(FIONBIO) (ctsWSAPoll wake socket)");
+                }
+
+                m_thread.reset(CreateThread(nullptr, 0, ThreadProc, this, 0, nullptr));
+                THROW_LAST_ERROR_IF_NULL_MSG(m_thread.get(), "CreateThread (ctsWSAPoll)");
+            }
+
+            ~WSAPollLoop() noexcept = default;
+            WSAPollLoop(const WSAPollLoop&) = delete;
+            WSAPollLoop& operator=(const WSAPollLoop&) = delete;
+            WSAPollLoop(WSAPollLoop&&) = delete;
+            WSAPollLoop& operator=(WSAPollLoop&&) = delete;
+
+            void AddConnection(const std::weak_ptr<ctsSocket>& weakSocket)
+            {
+                {
+                    const auto lock = m_lock.lock();
+                    m_newConnections.emplace_back(std::make_unique<WSAPollConnection>(weakSocket));
+                }
+                Wake();
+            }
+
+        private:
+            static DWORD WINAPI ThreadProc(LPVOID pContext) noexcept // NOLINT(bugprone-exception-escape)
+            {
+                static_cast<WSAPollLoop*>(pContext)->Run();
+                return 0;
+            }
+
+            void Wake() const noexcept
+            {
+                constexpr char wakeByte = 0;
+                // if the wake socket's buffer is full, the loop is already signaled
+                send(m_wakeSocket.get(), &wakeByte, 1, 0);
+            }
+
+            void DrainWakeSocket() const noexcept
+            {
+                char wakeBytes[16];
+                while (recv(m_wakeSocket.get(), wakeBytes, static_cast<int>(sizeof wakeBytes), 0) > 0)
+                {
+                }
+            }
+
+            void Run() noexcept;
+            bool ProcessConnection(WSAPollConnection& connection) noexcept;
+
+            static constexpr uint32_t c_ioBudgetPerPass = 16;
+
+            wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+            _Guarded_by_(m_lock) std::vector<std::unique_ptr<WSAPollConnection>> m_newConnections;
+            wil::unique_socket m_wakeSocket;
+            wil::unique_handle m_thread;
+
+            // only accessed from the loop thread
+            std::vector<std::unique_ptr<WSAPollConnection>> m_connections;
+            std::vector<WSAPOLLFD> m_pollFds;
+            std::vector<WSAPollConnection*> m_polledConnections;
+        };
+
+        //
+        // The event loop for this thread
+        // - adopts new connections
+        // - processes every connection with work ready to run
+        // - then blocks in WSAPoll until a polled socket is ready, a timed task is due, or the loop is woken
+        //
+        void WSAPollLoop::Run() noexcept
+        {
+            for (;;)
+            {
+                {
+                    const auto lock = m_lock.lock();
+                    for (auto& newConnection : m_newConnections)
+                    {
+                        m_connections.emplace_back(std::move(newConnection));
+                    }
+                    m_newConnections.clear();
+                }
+
+                // process connections with work ready, removing those which have completed
+                const auto currentTimeMs = ctTimer::snap_qpc_as_msec();
+                auto connectionsYielded = false;
+                for (auto connection = m_connections.begin(); connection != m_connections.end();)
+                {
+                    auto& connectionRef = **connection;
+                    for (const auto& timedTask : connectionRef.m_timedTasks)
+                    {
+                        if (timedTask.first <= currentTimeMs)
+                        {
+                            connectionRef.m_ready = true;
+                            break;
+                        }
+                    }
+
+                    if (connectionRef.m_ready)
+                    {
+                        connectionRef.m_ready = false;
+                        if (ProcessConnection(connectionRef))
+                        {
+                            // the order of connections doesn't matter: swap with the last to remove in O(1)
+                            std::swap(*connection, m_connections.back());
+                            m_connections.pop_back();
+                            continue;
+                        }
+                        // spent its budget with IO still ready to run
+                        connectionsYielded |= connectionRef.m_ready;
+                    }
+                    ++connection;
+                }
+
+                // build the WSAPoll set from connections blocked on a direction with tasks waiting
+                m_pollFds.clear();
+                m_polledConnections.clear();
+                m_pollFds.push_back(WSAPOLLFD{m_wakeSocket.get(), POLLRDNORM, 0});
+                m_polledConnections.push_back(nullptr);
+
+                auto nextTimedTaskMs = MAXLONGLONG;
+                for (const auto& connection : m_connections)
+                {
+                    SHORT events = 0;
+                    if (connection->m_recvBlocked && !connection->m_recvTasks.empty())
+                    {
+                        events |= POLLRDNORM;
+                    }
+                    if (connection->m_sendBlocked && !connection->m_sendTasks.empty())
+                    {
+                        events |= POLLWRNORM;
+                    }
+                    if (events != 0)
+                    {
+                        m_pollFds.push_back(WSAPOLLFD{connection->m_socket, events, 0});
+                        m_polledConnections.push_back(connection.get());
+                    }
+
+                    for (const auto& timedTask : connection->m_timedTasks)
+                    {
+                        nextTimedTaskMs = std::min(nextTimedTaskMs, timedTask.first);
+                    }
+                }
+
+                INT timeoutMs = -1;
+                if (connectionsYielded)
+                {
+                    // only pick up readiness changes: connections which yielded continue on the next pass
+                    timeoutMs = 0;
+                }
+                else if (nextTimedTaskMs != MAXLONGLONG)
+                {
+                    timeoutMs = static_cast<INT>(std::max(0LL, std::min<int64_t>(nextTimedTaskMs - ctTimer::snap_qpc_as_msec(), MAXINT)));
+                }
+
+                g_configSettings->WSAPollSyscallCount.Increment();
+                const auto pollResult = WSAPoll(m_pollFds.data(), static_cast<ULONG>(m_pollFds.size()), timeoutMs);
+                if (SOCKET_ERROR == pollResult)
+                {
+                    // a socket in the set was closed out from under the loop
+                    // - process every polled connection so each discovers its own state
+                    PRINT_DEBUG_INFO(L"\t\tctsWSAPoll: WSAPoll failed (%d)\n", WSAGetLastError());
+                    for (auto* const polledConnection : m_polledConnections)
+                    {
+                        if (polledConnection)
+                        {
+                            polledConnection->m_sendBlocked = false;
+                            polledConnection->m_recvBlocked = false;
+                            polledConnection->m_ready = true;
+                        }
+                    }
+                    continue;
+                }
+
+                if (m_pollFds[0].revents != 0)
+                {
+                    DrainWakeSocket();
+                }
+                for (size_t polled = 1; polled < m_pollFds.size(); ++polled)
+                {
+                    const auto revents = m_pollFds[polled].revents;
+                    if (revents != 0)
+                    {
+                        auto* const polledConnection = m_polledConnections[polled];
+                        // errors and hangups are reported through the next send/recv
+                        if (revents & (POLLRDNORM | POLLHUP | POLLERR | POLLNVAL))
+                        {
+                            polledConnection->m_recvBlocked = false;
+                        }
+                        if (revents & (POLLWRNORM | POLLHUP | POLLERR | POLLNVAL))
+                        {
+                            polledConnection->m_sendBlocked = false;
+                        }
+                        polledConnection->m_ready = true;
+                    }
+                }
+            }
+        }
+
+        //
+        // Runs all IO on the connection until it would block
+        // Returns true once the connection has no more IO and was completed back to the ctsSocket
+        //
+        bool WSAPollLoop::ProcessConnection(WSAPollConnection& connection) noexcept
+        {
+            const auto sharedSocket(connection.m_weakSocket.lock());
+            if (!sharedSocket)
+            {
+                return true;
+            }
+
+            // hold the socket lock while doing IO on it
+            const auto lockedSocket = sharedSocket->AcquireSocketLock();
+            const auto lockedPattern = lockedSocket.GetPattern();
+            auto socket = lockedSocket.GetSocket();
+
+            auto ioDone = false;
+            DWORD error = NO_ERROR;
+            // returns the ctsIoPattern's decision, tracking if the connection is done
+            const auto completeTask = [&](const ctsTask& task, uint32_t transferred, DWORD status) noexcept {
+                const auto* const functionName = ctsTaskAction::Recv == task.m_ioAction ? "recv" : "send";
+                switch (const auto protocolStatus = lockedPattern->CompleteIo(task, transferred, status))
+                {
+                    case ctsIoStatus::ContinueIo:
+                        // if the IO failed, the protocol wants to ignore the error
+                        break;
+
+                    case ctsIoStatus::CompletedIo:
+                        ioDone = true;
+                        error = NO_ERROR;
+                        break;
+
+                    case ctsIoStatus::FailedIo:
+                        // write out the error to the error log since the protocol sees this as a hard error
+                        ctsConfig::PrintErrorIfFailed(functionName, status);
+                        // protocol sees this as a failure : capture the error the protocol recorded
+                        ioDone = true;
+                        error = lockedPattern->GetLastPatternError();
+                        break;
+
+                    default:
+                        FAIL_FAST_MSG("ctsWSAPoll: unknown ctsSocket::IOStatus - %d\n", protocolStatus);
+                }
+            };
+
+            if (!lockedPattern || INVALID_SOCKET == socket)
+            {
+                // the socket was closed - the queued tasks are completed back to the pattern below
+                ioDone = true;
+                error = WSAECONNABORTED;
+            }
+            else if (INVALID_SOCKET == connection.m_socket)
+            {
+                // first time this loop has seen the socket
+                u_long nonBlocking = 1;
+                if (SOCKET_ERROR == ioctlsocket(socket, FIONBIO, &nonBlocking))
+                {
+                    error = WSAGetLastError();
+                    ctsConfig::PrintErrorIfFailed("ioctlsocket(FIONBIO)", error);
+                    ioDone = true;
+                }
+                connection.m_socket = socket;
+            }
+
+            // a task completing lets the pattern offer more
+            auto madeProgress = true;
+            const auto completeQueuedTask = [&](const ctsTask& task, uint32_t transferred, DWORD status) noexcept {
+                madeProgress = true;
+                completeTask(task, transferred, status);
+                return ioDone;
+            };
+
+            auto budget = c_ioBudgetPerPass;
+            while (!ioDone && madeProgress && budget > 0)
+            {
+                madeProgress = false;
+
+                // queue every task the pattern has ready
+                const auto currentTimeMs = ctTimer::snap_qpc_as_msec();
+                for (auto timedTask = connection.m_timedTasks.begin(); timedTask != connection.m_timedTasks.end();)
+                {
+                    if (timedTask->first <= currentTimeMs)
+                    {
+                        (ctsTaskAction::Send == timedTask->second.m_ioAction ? connection.m_sendTasks : connection.m_recvTasks).push_back(timedTask->second);
+                        timedTask = connection.m_timedTasks.erase(timedTask);
+                        madeProgress = true;
+                    }
+                    else
+                    {
+                        ++timedTask;
+                    }
+                }
+
+                while (!ioDone)
+                {
+                    const ctsTask nextTask = lockedPattern->InitiateIo();
+                    if (ctsTaskAction::None == nextTask.m_ioAction)
+                    {
+                        break;
+                    }
+                    madeProgress = true;
+
+                    if (ctsTaskAction::GracefulShutdown == nextTask.m_ioAction)
+                    {
+                        auto shutdownError = NO_ERROR;
+                        if (shutdown(socket, SD_SEND) != 0)
+                        {
+                            shutdownError = WSAGetLastError();
+                            PRINT_DEBUG_INFO(L"\t\tIO Failed: shutdown(SD_SEND) (%lu) [ctsWSAPoll]\n", shutdownError);
+                        }
+                        completeTask(nextTask, 0, shutdownError);
+                    }
+                    else if (ctsTaskAction::HardShutdown == nextTask.m_ioAction)
+                    {
+                        // pass through -1 to force an RST with the closesocket
+                        const auto closeError = sharedSocket->CloseSocket(static_cast<uint32_t>(SOCKET_ERROR));
+                        socket = INVALID_SOCKET;
+                        completeTask(nextTask, 0, closeError);
+                    }
+                    else if (nextTask.m_timeOffsetMilliseconds > 0)
+                    {
+                        connection.m_timedTasks.emplace_back(currentTimeMs + nextTask.m_timeOffsetMilliseconds, nextTask);
+                    }
+                    else if (ctsTaskAction::Send == nextTask.m_ioAction)
+                    {
+                        connection.m_sendTasks.push_back(nextTask);
+                    }
+                    else
+                    {
+                        connection.m_recvTasks.push_back(nextTask);
+                    }
+                }
+
+                // send until the socket would block
+                if (!ioDone && !connection.m_sendBlocked)
+                {
+                    const auto sendStatus = ctsWSAPollSendTasks(
+                        connection.m_sendTasks,
+                        connection.m_partialSendBytes,
+                        budget,
+                        [&](const char* buffer, uint32_t length) noexcept {
+                            g_configSettings->WSAPollSyscallCount.Increment();
+                            ctsNonBlockingSendResult result;
+                            const auto sent = ::send(socket, buffer, static_cast<int>(length), 0);
+                            if (SOCKET_ERROR == sent)
+                            {
+                                const auto gle = WSAGetLastError();
+                                if (WSAEWOULDBLOCK == gle)
+                                {
+                                    result.m_wouldBlock = true;
+                                }
+                                else
+                                {
+                                    PRINT_DEBUG_INFO(L"\t\tIO Failed: send (%d) [ctsWSAPoll]\n", gle);
+                                    result.m_error = gle;
+                                }
+                            }
+                            else
+                            {
+                                result.m_bytesSent = static_cast<uint32_t>(sent);
+                            }
+                            return result;
+                        },
+                        completeQueuedTask);
+                    if (ctsWSAPollSendStatus::WouldBlock == sendStatus)
+                    {
+                        connection.m_sendBlocked = true;
+                    }
+                }
+
+                // recv until the socket would block
+                while (!ioDone && !connection.m_recvBlocked && !connection.m_recvTasks.empty() && budget > 0)
+                {
+                    --budget;
+                    const ctsTask task = connection.m_recvTasks.front();
+                    g_configSettings->WSAPollSyscallCount.Increment();
+                    // MSG_WAITALL is not supported on non-blocking sockets:
+                    // partial reads are completed as-is, as with an overlapped WSARecv
+                    const auto received = ::recv(socket, task.m_buffer + task.m_bufferOffset, static_cast<int>(task.m_bufferLength), 0);
+                    if (SOCKET_ERROR == received)
+                    {
+                        const auto gle = WSAGetLastError();
+                        if (WSAEWOULDBLOCK == gle)
+                        {
+                            connection.m_recvBlocked = true;
+                            break;
+                        }
+
+                        PRINT_DEBUG_INFO(L"\t\tIO Failed: recv (%d) [ctsWSAPoll]\n", gle);
+                        connection.m_recvTasks.pop_front();
+                        completeQueuedTask(task, 0, gle);
+                    }
+                    else
+                    {
+                        connection.m_recvTasks.pop_front();
+                        completeQueuedTask(task, static_cast<uint32_t>(received), NO_ERROR);
+                    }
+                }
+            }
+
+            if (!ioDone && 0 == budget)
+            {
+                // IO may still be ready to run: continue on the next pass, after the other connections
+                connection.m_ready = true;
+                g_configSettings->WSAPollBudgetYields.Increment();
+            }
+            else if (!ioDone && connection.m_sendTasks.empty() && connection.m_recvTasks.empty() && connection.m_timedTasks.empty())
+            {
+                // no IO is pending and the pattern has no more IO to offer
+                // - as with the other IO functions, the socket is done once it has no IO outstanding
+                ioDone = true;
+            }
+
+            if (ioDone)
+            {
+                // the pattern counts every queued task as in-flight: complete each back to it
+                // - as with an overlapped IO canceled when its socket is closed
+                if (lockedPattern)
+                {
+                    for (const auto& task : connection.m_sendTasks)
+                    {
+                        lockedPattern->CompleteIo(task, 0, WSA_OPERATION_ABORTED);
+                    }
+                    for (const auto& task : connection.m_recvTasks)
+                    {
+                        lockedPattern->CompleteIo(task, 0, WSA_OPERATION_ABORTED);
+                    }
+                    for (const auto& timedTask : connection.m_timedTasks)
+                    {
+                        lockedPattern->CompleteIo(timedTask.second, 0, WSA_OPERATION_ABORTED);
+                    }
+                }
+                connection.m_sendTasks.clear();
+                connection.m_recvTasks.clear();
+                connection.m_timedTasks.clear();
+                connection.m_partialSendBytes = 0;
+
+                // release the IO count taken when the socket was added to the loop
+                if (0 == sharedSocket->DecrementIo())
+                {
+                    sharedSocket->CompleteState(error);
+                }
+            }
+            return ioDone;
+        }
+
+        //
+        // The event loops are created once and live for the lifetime of the process
+        //
+        // ReSharper disable once CppZeroConstantCanBeReplacedWithNullptr
+        static INIT_ONCE g_loopInitializer = INIT_ONCE_STATIC_INIT;
+        static std::vector<std::unique_ptr<WSAPollLoop>>* g_pLoops = nullptr;
+        static std::atomic<uint32_t> g_nextLoop{0};
+
+        static BOOL CALLBACK InitOnceWSAPoll(PINIT_ONCE, PVOID, PVOID*) noexcept
+        {
+            try
+            {
+                SYSTEM_INFO systemInfo;
+                GetSystemInfo(&systemInfo);
+
+                auto loops = std::make_unique<std::vector<std::unique_ptr<WSAPollLoop>>>();
+                for (auto loopCount = 0ul; loopCount < systemInfo.dwNumberOfProcessors; ++loopCount)
+                {
+                    loops->emplace_back(std::make_unique<WSAPollLoop>());
+                }
+                g_pLoops = loops.release();
+                return TRUE;
+            }
+            catch (...)
+            {
+                SetLastError(ctsConfig::PrintThrownException());
+                return FALSE;
+            }
+        }
+    }
+
+    // The function registered with ctsConfig
+    // ReSharper disable once CppInconsistentNaming
+    void ctsWSAPoll(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        // attempt to get a reference to the socket
+        const auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        if (!InitOnceExecuteOnce(&Wsapoll::g_loopInitializer, Wsapoll::InitOnceWSAPoll, nullptr, nullptr))
+        {
+            auto gle = GetLastError();
+            if (0 == gle)
+            {
+                gle = WSAENOBUFS;
+            }
+            ctsConfig::PrintException(gle, L"InitOnceExecuteOnce", L"ctsWSAPoll");
+            sharedSocket->CompleteState(gle);
+            return;
+        }
+
+        // the loop holds an IO count on the socket until it completes all IO
+        sharedSocket->IncrementIo();
+        try
+        {
+            // pin the socket to the next loop
+            const auto loopIndex = Wsapoll::g_nextLoop.fetch_add(1) % Wsapoll::g_pLoops->size();
+            (*Wsapoll::g_pLoops)[loopIndex]->AddConnection(weakSocket);
+        }
+        catch (...)
+        {
+            const auto error = ctsConfig::PrintThrownException();
+            if (0 == sharedSocket->DecrementIo())
+            {
+                sharedSocket->CompleteState(error);
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+#pragma once
+// cpp headers
+#include <cstdint>
+#include <deque>
+
+// ** NOTE ** should not include any local project cts headers - to avoid circular references
+// - nor any OS headers: this header is portable, so partial sends can be tested on any platform
+
+namespace ctsTraffic
+{
+// the result of one non-blocking send call
+struct ctsNonBlockingSendResult
+{
+    uint32_t m_bytesSent = 0;
+    // the send failed: the task is completed with this error
+    uint32_t m_error = 0;
+    // the send would have blocked: nothing was sent
+    bool m_wouldBlock = false;
+};
+
+enum class ctsWSAPollSendStatus : std::uint8_t
+{
+    // every queued task was sent and completed
+    Drained,
+    // the socket would block: it must be polled for writability
+    WouldBlock,
+    // the connection used its share of this pass of the loop: it continues on the next pass
+    BudgetSpent,
+    // completing a task finished the connection
+    ConnectionDone
+};
+
+//
+// ctsWSAPollSendTasks
+//
+// Sends the queued tasks in order until the socket would block
+// - a non-blocking send can accept only part of a buffer: partialSendBytes tracks how much of the front task was sent,
+//   and the task is only completed once every byte was accepted, as with an overlapped WSASend
+// - each send call spends one unit of budget
+// - Task needs m_buffer, m_bufferOffset, and m_bufferLength
+// - sendFn(const char* buffer, uint32_t length) returns a ctsNonBlockingSendResult
+// - completeFn(const Task&, uint32_t transferred, uint32_t error) returns true once the connection is done
+//
+template <typename Task, typename SendFn, typename CompleteFn>
+ctsWSAPollSendStatus ctsWSAPollSendTasks(std::deque<Task>& tasks, uint32_t& partialSendBytes, uint32_t& budget, SendFn&& sendFn, CompleteFn&& completeFn)
+{
+    while (!tasks.empty())
+    {
+        if (0 == budget)
+        {
+            return ctsWSAPollSendStatus::BudgetSpent;
+        }
+        --budget;
+
+        const auto& task = tasks.front();
+        const auto result = sendFn(task.m_buffer + task.m_bufferOffset + partialSendBytes, task.m_bufferLength - partialSendBytes);
+        if (result.m_wouldBlock)
+        {
+            return ctsWSAPollSendStatus::WouldBlock;
+        }
+
+        if (result.m_error != 0)
+        {
+            const Task failedTask = task;
+            tasks.pop_front();
+            partialSendBytes = 0;
+            if (completeFn(failedTask, 0, result.m_error))
+            {
+                return ctsWSAPollSendStatus::ConnectionDone;
+            }
+            continue;
+        }
+
+        partialSendBytes += result.m_bytesSent;
+        if (partialSendBytes == task.m_bufferLength)
+        {
+            const Task completedTask = task;
+            tasks.pop_front();
+            partialSendBytes = 0;
+            if (completeFn(completedTask, completedTask.m_bufferLength, 0))
+            {
+                return ctsWSAPollSendStatus::ConnectionDone;
+            }
+        }
+    }
+    return ctsWSAPollSendStatus::Drained;
+}
+} // namespace ctsTraffic
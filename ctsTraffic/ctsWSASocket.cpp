@@ -1,197 +1,503 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// cpp headers
-#include <memory>
-// os headers
-#include <Windows.h>
-// project headers
-#include "ctsSocket.h"
-#include "ctsConfig.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-#include <wil/resource.h>
-
-using ctsTraffic::ctsConfig::g_configSettings;
-
-namespace ctsTraffic
-{
-    static std::atomic_signed_lock_free g_bindCounter{};
-    static std::atomic_signed_lock_free g_targetCounter{};
-    static std::atomic_signed_lock_free g_portCounter{};
-
-    // ReSharper disable once CppInconsistentNaming
-    void ctsWSASocket(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
-    {
-        auto sharedSocket(weakSocket.lock());
-        if (!sharedSocket)
-        {
-            return;
-        }
-
-        USHORT nextPort = 0;
-        if (g_configSettings->LocalPortHigh != 0 && g_configSettings->LocalPortLow != 0)
-        {
-            const auto portCounter = g_portCounter.fetch_add(1) + 1;
-            nextPort = static_cast<uint16_t>(portCounter % (g_configSettings->LocalPortHigh - g_configSettings->LocalPortLow + 1)) + g_configSettings->LocalPortLow;
-        }
-        else
-        {
-            nextPort = g_configSettings->LocalPortLow;
-        }
-
-        //
-        // Find a bind and target address by moving to the next address in the respective vectors
-        //
-        wil::network::socket_address localAddr;
-        if (g_configSettings->ListenAddresses.empty() && !g_configSettings->TargetAddressStrings.empty())
-        {
-            // if we are connecting by name, always bind to the ephemeral IPv6 address
-            localAddr.reset(AF_INET6);
-        }
-        else
-        {
-            const auto bindSize = g_configSettings->BindAddresses.size();
-            const auto socketCounter = g_bindCounter.fetch_add(1) + 1;
-            localAddr = g_configSettings->BindAddresses[socketCounter % bindSize];
-        }
-
-        localAddr.set_port(nextPort);
-
-        wil::network::socket_address targetAddr;
-        if (!g_configSettings->TargetAddresses.empty())
-        {
-            //
-            // the target address family must match the bind address family
-            // - ctsConfig guarantees that at least address families will match with at least one address in bind and target vectors
-            //
-            const auto targetSize = g_configSettings->TargetAddresses.size();
-            auto socketCounter = g_targetCounter.fetch_add(1) + 1;
-            targetAddr = g_configSettings->TargetAddresses[socketCounter % targetSize];
-            while (targetAddr.family() != localAddr.family())
-            {
-                socketCounter = g_targetCounter.fetch_add(1) + 1;
-                targetAddr = g_configSettings->TargetAddresses[socketCounter % targetSize];
-            }
-        }
-
-        auto socket = INVALID_SOCKET;
-        uint32_t gle = 0;
-        const auto* functionName = "CreateSocket";
-        try
-        {
-            switch (g_configSettings->Protocol)
-            {
-            case ctsConfig::ProtocolType::TCP:
-                socket = ctsConfig::CreateSocket(localAddr.family(), SOCK_STREAM, IPPROTO_TCP, g_configSettings->SocketFlags);
-                break;
-
-            case ctsConfig::ProtocolType::UDP:
-                socket = ctsConfig::CreateSocket(localAddr.family(), SOCK_DGRAM, IPPROTO_UDP, g_configSettings->SocketFlags);
-                break;
-
-            case ctsConfig::ProtocolType::NoProtocolSet:
-                [[fallthrough]];
-            default: // NOLINT(clang-diagnostic-covered-switch-default)
-                ctsConfig::PrintErrorInfo(
-                    L"Unknown socket protocol (%u)",
-                    static_cast<unsigned>(g_configSettings->Protocol));
-                gle = WSAEINVAL;
-            }
-        }
-        catch (const wil::ResultException& e)
-        {
-            gle = ctsConfig::Win32FromHresult(e.GetErrorCode());
-        }
-        catch (...)
-        {
-            gle = WSAENOBUFS;
-        }
-
-        if (NO_ERROR == gle)
-        {
-            functionName = "SetPreBindOptions";
-            gle = ctsConfig::SetPreBindOptions(socket, localAddr);
-        }
-
-        if (NO_ERROR == gle)
-        {
-            // setting the socket option to support dual-mode sockets must be done before calling bind
-            // must enable dual-mode sockets before calling WSAConnectByName, so it can connect to either IPv4 or IPv6 addresses
-            if (g_configSettings->ListenAddresses.empty() && !g_configSettings->TargetAddressStrings.empty())
-            {
-                PRINT_DEBUG_INFO(L"\t\tEnabling Dual-mode sockets\n");
-                constexpr DWORD ipv6_only = FALSE;
-                if (0 != setsockopt(socket, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<const char*>(&ipv6_only), sizeof ipv6_only))
-                {
-                    gle = WSAGetLastError();
-                    ctsConfig::PrintErrorIfFailed("setsockopt(IPV6_V6ONLY)", gle);
-                }
-            }
-        }
-
-        if (NO_ERROR == gle)
-        {
-            functionName = "bind";
-
-            if (0 == nextPort)
-            {
-                if (SOCKET_ERROR == bind(socket, localAddr.sockaddr(), localAddr.size()))
-                {
-                    gle = WSAGetLastError();
-                }
-            }
-            else
-            {
-                // sleep up to 5 seconds to allow TCP to clean up its internal state
-                constexpr auto bindRetryCount = 5;
-                for (auto bindRetry = 0; bindRetry < bindRetryCount; ++bindRetry)
-                {
-                    if (SOCKET_ERROR == bind(socket, localAddr.sockaddr(), localAddr.size()))
-                    {
-                        gle = WSAGetLastError();
-                        if (WSAEADDRINUSE == gle)
-                        {
-                            constexpr uint32_t bindRetrySleepMs = 1000;
-                            PRINT_DEBUG_INFO(L"\t\tctsWSASocket : bind failed on attempt %d, sleeping %u ms.\n", bindRetry + 1, bindRetrySleepMs);
-                            Sleep(bindRetrySleepMs);
-                        }
-                    }
-                    else
-                    {
-                        // succeeded - exit the loop
-                        gle = NO_ERROR;
-                        PRINT_DEBUG_INFO(L"\t\tctsWSASocket : bind succeeded on attempt %d\n", bindRetry + 1);
-                        break;
-                    }
-                }
-            }
-        }
-
-        // store whatever values we have: for accurate logging
-        sharedSocket->SetSocket(socket);
-        sharedSocket->SetLocalSockaddr(localAddr);
-        sharedSocket->SetRemoteSockaddr(targetAddr);
-
-        if (0 == gle)
-        {
-            sharedSocket->CompleteState(NO_ERROR);
-        }
-        else
-        {
-            ctsConfig::PrintErrorIfFailed(functionName, gle);
-            sharedSocket->CompleteState(gle);
-        }
-    }
-} // namespace
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <algorithm>
+#include <memory>
+#include <vector>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctTimer.hpp>
+// project headers
+#include "ctsSocket.h"
+#include "ctsConfig.h"
+#include "ctsLocalPortAllocator.hpp"
+#include "ctsTCPFunctions.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+#include <wil/resource.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+namespace ctsTraffic
+{
+    static std::atomic_signed_lock_free g_bindCounter{};
+    static std::atomic_signed_lock_free g_targetCounter{};
+
+    //
+    // -LocalPort:[low,high]
+    // - one allocator per bind address: each local address can bind every port in the range
+    // - ports are returned as sockets close, held back while a gracefully closed TCP connection is in TIME_WAIT
+    //
+    struct ctsLocalPorts
+    {
+        std::vector<std::unique_ptr<ctsLocalPortAllocator>> m_allocators;
+        int64_t m_timeWaitUsec = 0;
+    };
+    // never deleted: sockets can still be closing as the process exits
+    static ctsLocalPorts* g_localPorts = nullptr;
+
+    // the number of other ports tried when a port from the range turns out to be bound outside of ctsTraffic
+    constexpr uint32_t c_localPortBindAttempts = 8;
+
+    // a socket created and configured for the next connection, with the addresses it was created for
+    struct ctsCreatedSocket
+    {
+        wil::unique_socket m_socket;
+        wil::network::socket_address m_localAddr;
+        wil::network::socket_address m_targetAddr;
+        // -LocalPort:[low,high] - which allocator the port in m_localAddr came from
+        uint32_t m_localPortAllocator = 0;
+    };
+
+    // the time TCP holds a closed connection in TIME_WAIT on this machine
+    static int64_t ctsReadTimeWaitUsec() noexcept
+    {
+        // TcpTimedWaitDelay is in seconds - Windows uses 120 seconds when it isn't set
+        DWORD timedWaitDelay = 120;
+        DWORD valueSize = sizeof timedWaitDelay;
+        (void)RegGetValueW(
+            HKEY_LOCAL_MACHINE,
+            L"SYSTEM\\CurrentControlSet\\Services\\Tcpip\\Parameters",
+            L"TcpTimedWaitDelay",
+            RRF_RT_REG_DWORD,
+            nullptr,
+            &timedWaitDelay,
+            &valueSize);
+        return static_cast<int64_t>(timedWaitDelay) * 1000000LL;
+    }
+
+    // allocates a port from the range and binds to it
+    // - a port bound outside of ctsTraffic (or still in TIME_WAIT longer than expected) is held back and another is tried
+    static uint32_t ctsBindLocalPort(SOCKET socket, ctsCreatedSocket& created) noexcept
+    {
+        auto& allocator = *g_localPorts->m_allocators[created.m_localPortAllocator];
+        const auto startUsec = ctl::ctTimer::snap_qpc_as_usec();
+        for (uint32_t attempt = 0; attempt < c_localPortBindAttempts; ++attempt)
+        {
+            const auto nowUsec = ctl::ctTimer::snap_qpc_as_usec();
+            const auto port = allocator.Allocate(nowUsec);
+            if (0 == port)
+            {
+                g_configSettings->LocalPortExhausted.Increment();
+                created.m_localAddr.set_port(0);
+                return WSAEADDRINUSE;
+            }
+
+            created.m_localAddr.set_port(port);
+            if (SOCKET_ERROR != bind(socket, created.m_localAddr.sockaddr(), created.m_localAddr.size()))
+            {
+                g_configSettings->LocalPortAllocateUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - startUsec);
+                g_configSettings->LocalPortAllocations.Increment();
+                return NO_ERROR;
+            }
+
+            const auto gle = WSAGetLastError();
+            allocator.Release(port, WSAEADDRINUSE == gle ? nowUsec + g_localPorts->m_timeWaitUsec : nowUsec);
+            if (gle != WSAEADDRINUSE)
+            {
+                created.m_localAddr.set_port(0);
+                return gle;
+            }
+            g_configSettings->LocalPortBindConflicts.Increment();
+            PRINT_DEBUG_INFO(L"\t\tctsWSASocket : local port %u is already in use, trying another\n", port);
+        }
+
+        g_configSettings->LocalPortExhausted.Increment();
+        created.m_localAddr.set_port(0);
+        return WSAEADDRINUSE;
+    }
+
+    void ctsWSASocketLocalPortsStart()
+    {
+        g_localPorts = new ctsLocalPorts;
+        g_localPorts->m_timeWaitUsec = ctsReadTimeWaitUsec();
+        // connecting by name binds only the IPv6 wildcard address
+        const auto allocatorCount = std::max<size_t>(1, g_configSettings->BindAddresses.size());
+        for (size_t allocator = 0; allocator < allocatorCount; ++allocator)
+        {
+            g_localPorts->m_allocators.emplace_back(
+                std::make_unique<ctsLocalPortAllocator>(g_configSettings->LocalPortLow, g_configSettings->LocalPortHigh));
+        }
+    }
+
+    void ctsWSASocketReleaseLocalPort(uint32_t allocatorIndex, uint16_t port, bool timeWait) noexcept
+    {
+        const auto nowUsec = ctl::ctTimer::snap_qpc_as_usec();
+        g_localPorts->m_allocators[allocatorIndex]->Release(port, timeWait ? nowUsec + g_localPorts->m_timeWaitUsec : nowUsec);
+    }
+
+    // binds to localAddr, retrying while the explicit port is still held by TCP
+    static uint32_t ctsBindSocket(SOCKET socket, const wil::network::socket_address& localAddr) noexcept
+    {
+        if (0 == localAddr.port())
+        {
+            if (SOCKET_ERROR == bind(socket, localAddr.sockaddr(), localAddr.size()))
+            {
+                return WSAGetLastError();
+            }
+            return NO_ERROR;
+        }
+
+        // sleep up to 5 seconds to allow TCP to clean up its internal state
+        uint32_t gle = NO_ERROR;
+        constexpr auto bindRetryCount = 5;
+        for (auto bindRetry = 0; bindRetry < bindRetryCount; ++bindRetry)
+        {
+            if (SOCKET_ERROR == bind(socket, localAddr.sockaddr(), localAddr.size()))
+            {
+                gle = WSAGetLastError();
+                if (WSAEADDRINUSE == gle)
+                {
+                    constexpr uint32_t bindRetrySleepMs = 1000;
+                    PRINT_DEBUG_INFO(L"\t\tctsWSASocket : bind failed on attempt %d, sleeping %u ms.\n", bindRetry + 1, bindRetrySleepMs);
+                    Sleep(bindRetrySleepMs);
+                }
+            }
+            else
+            {
+                // succeeded - exit the loop
+                gle = NO_ERROR;
+                PRINT_DEBUG_INFO(L"\t\tctsWSASocket : bind succeeded on attempt %d\n", bindRetry + 1);
+                break;
+            }
+        }
+        return gle;
+    }
+
+    //
+    // Creates a socket for a connection of the given traffic class, sets all configured options, and binds it (if bindSocket)
+    // - requiredTarget, if given, is the target instead of the next target address, and a bind address of its family is used
+    // - on failure returns the error and the name of the function that failed
+    //   with whatever socket and addresses were created, for accurate logging
+    //
+    static uint32_t ctsCreateSocket(
+        uint32_t trafficClassId,
+        bool bindSocket,
+        ctsCreatedSocket& created,
+        const char*& functionName,
+        const wil::network::socket_address* requiredTarget = nullptr) noexcept
+    {
+        // a traffic class can override the target addresses for its connections
+        const auto* const trafficClass = g_configSettings->GetTrafficClass(trafficClassId);
+        const auto& targetAddresses = trafficClass && !trafficClass->TargetAddresses.empty()
+            ? trafficClass->TargetAddresses
+            : g_configSettings->TargetAddresses;
+
+        //
+        // Find a bind and target address by moving to the next address in the respective vectors
+        //
+        auto& localAddr = created.m_localAddr;
+        if (g_configSettings->ListenAddresses.empty() && !g_configSettings->TargetAddressStrings.empty())
+        {
+            // if we are connecting by name, always bind to the ephemeral IPv6 address
+            localAddr.reset(AF_INET6);
+        }
+        else
+        {
+            const auto bindSize = g_configSettings->BindAddresses.size();
+            auto socketCounter = g_bindCounter.fetch_add(1) + 1;
+            localAddr = g_configSettings->BindAddresses[socketCounter % bindSize];
+            if (requiredTarget)
+            {
+                // callers only require targets of a family with a bind address
+                while (localAddr.family() != requiredTarget->family())
+                {
+                    socketCounter = g_bindCounter.fetch_add(1) + 1;
+                    localAddr = g_configSettings->BindAddresses[socketCounter % bindSize];
+                }
+            }
+            else if (&targetAddresses != &g_configSettings->TargetAddresses)
+            {
+                // the traffic class targets may not cover every bound address family
+                // - ctsConfig guarantees each traffic class target has at least one bind address of the same family
+                while (std::ranges::none_of(targetAddresses, [&](const wil::network::socket_address& target) noexcept { return target.family() == localAddr.family(); }))
+                {
+                    socketCounter = g_bindCounter.fetch_add(1) + 1;
+                    localAddr = g_configSettings->BindAddresses[socketCounter % bindSize];
+                }
+            }
+            created.m_localPortAllocator = static_cast<uint32_t>(socketCounter % bindSize);
+        }
+
+        // a range of local ports is allocated as the socket is bound
+        localAddr.set_port(g_localPorts ? 0 : g_configSettings->LocalPortLow);
+
+        auto& targetAddr = created.m_targetAddr;
+        if (requiredTarget)
+        {
+            targetAddr = *requiredTarget;
+        }
+        else if (!targetAddresses.empty())
+        {
+            //
+            // the target address family must match the bind address family
+            // - ctsConfig guarantees that at least address families will match with at least one address in bind and target vectors
+            //
+            const auto targetSize = targetAddresses.size();
+            auto socketCounter = g_targetCounter.fetch_add(1) + 1;
+            targetAddr = targetAddresses[socketCounter % targetSize];
+            while (targetAddr.family() != localAddr.family())
+            {
+                socketCounter = g_targetCounter.fetch_add(1) + 1;
+                targetAddr = targetAddresses[socketCounter % targetSize];
+            }
+        }
+
+        uint32_t gle = 0;
+        functionName = "CreateSocket";
+        try
+        {
+            switch (g_configSettings->Protocol)
+            {
+            case ctsConfig::ProtocolType::TCP:
+                created.m_socket.reset(ctsConfig::CreateSocket(localAddr.family(), SOCK_STREAM, IPPROTO_TCP, g_configSettings->SocketFlags));
+                break;
+
+            case ctsConfig::ProtocolType::UDP:
+                created.m_socket.reset(ctsConfig::CreateSocket(localAddr.family(), SOCK_DGRAM, IPPROTO_UDP, g_configSettings->SocketFlags));
+                break;
+
+            case ctsConfig::ProtocolType::NoProtocolSet:
+                [[fallthrough]];
+            default: // NOLINT(clang-diagnostic-covered-switch-default)
+                ctsConfig::PrintErrorInfo(
+                    L"Unknown socket protocol (%u)",
+                    static_cast<unsigned>(g_configSettings->Protocol));
+                gle = WSAEINVAL;
+            }
+        }
+        catch (const wil::ResultException& e)
+        {
+            gle = ctsConfig::Win32FromHresult(e.GetErrorCode());
+        }
+        catch (...)
+        {
+            gle = WSAENOBUFS;
+        }
+
+        const auto socket = created.m_socket.get();
+        if (NO_ERROR == gle)
+        {
+            functionName = "SetPreBindOptions";
+            gle = ctsConfig::SetPreBindOptions(socket, localAddr);
+        }
+
+        if (NO_ERROR == gle)
+        {
+            // setting the socket option to support dual-mode sockets must be done before calling bind
+            // must enable dual-mode sockets for -conn:ConnectByName, so it can connect to either the IPv4 or IPv6 addresses a name resolves to
+            if (g_configSettings->ListenAddresses.empty() && !g_configSettings->TargetAddressStrings.empty())
+            {
+                PRINT_DEBUG_INFO(L"\t\tEnabling Dual-mode sockets\n");
+                constexpr DWORD ipv6_only = FALSE;
+                if (0 != setsockopt(socket, IPPROTO_IPV6, IPV6_V6ONLY, reinterpret_cast<const char*>(&ipv6_only), sizeof ipv6_only))
+                {
+                    gle = WSAGetLastError();
+                    ctsConfig::PrintErrorIfFailed("setsockopt(IPV6_V6ONLY)", gle);
+                }
+            }
+        }
+
+        if (NO_ERROR == gle && bindSocket)
+        {
+            functionName = "bind";
+            gle = g_localPorts ? ctsBindLocalPort(socket, created) : ctsBindSocket(socket, localAddr);
+        }
+
+        return gle;
+    }
+
+    // hands the created socket to the ctsSocket and completes the Creating state
+    static void ctsCompleteCreate(const std::shared_ptr<ctsSocket>& sharedSocket, ctsCreatedSocket& created, uint32_t gle, const char* functionName) noexcept
+    {
+        // store whatever values we have: for accurate logging
+        sharedSocket->SetSocket(created.m_socket.release());
+        sharedSocket->SetLocalSockaddr(created.m_localAddr);
+        sharedSocket->SetRemoteSockaddr(created.m_targetAddr);
+        if (g_localPorts && created.m_localAddr.port() != 0)
+        {
+            // the port is returned when the ctsSocket closes
+            sharedSocket->SetLocalPortLease(created.m_localPortAllocator, created.m_localAddr.port());
+        }
+
+        if (0 == gle)
+        {
+            sharedSocket->CompleteState(NO_ERROR);
+        }
+        else
+        {
+            ctsConfig::PrintErrorIfFailed(functionName, gle);
+            sharedSocket->CompleteState(gle);
+        }
+    }
+
+    // ReSharper disable once CppInconsistentNaming
+    void ctsWSASocket(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        ctsCreatedSocket created;
+        const char* functionName{};
+        const auto gle = ctsCreateSocket(sharedSocket->GetTrafficClass(), true, created, functionName);
+        ctsCompleteCreate(sharedSocket, created, gle, functionName);
+    }
+
+    uint32_t ctsWSASocketCreateForTarget(
+        uint32_t trafficClassId,
+        const wil::network::socket_address& targetAddr,
+        ctsRaceSocket& raceSocket,
+        const char*& functionName) noexcept
+    {
+        ctsCreatedSocket created;
+        const auto gle = ctsCreateSocket(trafficClassId, true, created, functionName, &targetAddr);
+        raceSocket.Socket = std::move(created.m_socket);
+        raceSocket.LocalAddress = created.m_localAddr;
+        raceSocket.LocalPortAllocator = created.m_localPortAllocator;
+        // the port is only leased when bound from the -LocalPort range
+        raceSocket.LocalPort = g_localPorts ? created.m_localAddr.port() : 0;
+        return gle;
+    }
+
+    //
+    // -SocketPool
+    // - one pool per traffic class, as each class can have its own target addresses
+    // - a single threadpool work item fills the pools back to SocketPoolHigh in the background
+    //
+    struct ctsSocketPool
+    {
+        wil::critical_section m_lock{ctsConfig::ctsConfigSettings::c_CriticalSectionSpinlock};
+        _Guarded_by_(m_lock) std::vector<std::vector<ctsCreatedSocket>> m_pools;
+        _Guarded_by_(m_lock) bool m_filling = false;
+        wil::unique_threadpool_work_nowait m_fillWork;
+    };
+    // never deleted: the fill work can still be running as the process exits
+    static ctsSocketPool* g_socketPool = nullptr;
+
+    static uint32_t ctsSocketPoolIndex(uint32_t trafficClassId) noexcept
+    {
+        return trafficClassId < g_socketPool->m_pools.size() ? trafficClassId : 0;
+    }
+
+    // creates one socket for the first pool below SocketPoolHigh - returns false once all are full, or on failure
+    static bool ctsFillSocketPool() noexcept
+    {
+        uint32_t trafficClassId{};
+        {
+            const auto lock = g_socketPool->m_lock.lock();
+            const auto notFull = std::ranges::find_if(g_socketPool->m_pools, [](const std::vector<ctsCreatedSocket>& pool) noexcept { return pool.size() < g_configSettings->SocketPoolHigh; });
+            if (notFull == g_socketPool->m_pools.end())
+            {
+                return false;
+            }
+            trafficClassId = static_cast<uint32_t>(notFull - g_socketPool->m_pools.begin());
+        }
+
+        // create outside the lock: connections keep taking sockets while the pool fills
+        ctsCreatedSocket created;
+        const char* functionName{};
+        const auto gle = ctsCreateSocket(trafficClassId, g_configSettings->SocketPoolBind, created, functionName);
+        if (gle != NO_ERROR)
+        {
+            // stop filling: connections finding the pool empty create their own sockets, and report the error
+            PRINT_DEBUG_INFO(L"\t\tctsWSASocket : filling the socket pool failed in %hs (%u)\n", functionName, gle);
+            return false;
+        }
+
+        // cannot throw: each pool reserved room for SocketPoolHigh sockets, and only this fill adds to them
+        const auto lock = g_socketPool->m_lock.lock();
+        g_socketPool->m_pools[trafficClassId].emplace_back(std::move(created));
+        return true;
+    }
+
+    static VOID NTAPI ctsFillSocketPoolCallback(PTP_CALLBACK_INSTANCE, PVOID, PTP_WORK) noexcept
+    {
+        // stop filling once the user has asked to exit
+        while (WAIT_OBJECT_0 != WaitForSingleObject(g_configSettings->CtrlCHandle, 0) && ctsFillSocketPool())
+        {
+        }
+
+        const auto lock = g_socketPool->m_lock.lock();
+        g_socketPool->m_filling = false;
+    }
+
+    void ctsWSASocketPoolStart()
+    {
+        g_socketPool = new ctsSocketPool;
+        g_socketPool->m_pools.resize(std::max<size_t>(1, g_configSettings->TrafficClasses.size()));
+        for (auto& pool : g_socketPool->m_pools)
+        {
+            pool.reserve(g_configSettings->SocketPoolHigh);
+        }
+        g_socketPool->m_fillWork.reset(CreateThreadpoolWork(ctsFillSocketPoolCallback, nullptr, g_configSettings->pTpEnvironment));
+        THROW_LAST_ERROR_IF_NULL(g_socketPool->m_fillWork.get());
+
+        // fill the pools before the first connection is made
+        while (ctsFillSocketPool())
+        {
+        }
+    }
+
+    void ctsWSASocketPooled(const std::weak_ptr<ctsSocket>& weakSocket) noexcept
+    {
+        auto sharedSocket(weakSocket.lock());
+        if (!sharedSocket)
+        {
+            return;
+        }
+
+        ctsCreatedSocket created;
+        auto lock = g_socketPool->m_lock.lock();
+        auto& pool = g_socketPool->m_pools[ctsSocketPoolIndex(sharedSocket->GetTrafficClass())];
+        const auto poolWasEmpty = pool.empty();
+        if (!poolWasEmpty)
+        {
+            created = std::move(pool.back());
+            pool.pop_back();
+        }
+        if (pool.size() < g_configSettings->SocketPoolLow && !g_socketPool->m_filling)
+        {
+            g_socketPool->m_filling = true;
+            SubmitThreadpoolWork(g_socketPool->m_fillWork.get());
+        }
+        lock.reset();
+
+        uint32_t gle = NO_ERROR;
+        const char* functionName{};
+        if (poolWasEmpty)
+        {
+            // stalled: this connection pays for creating its own socket
+            const auto startUsec = ctl::ctTimer::snap_qpc_as_usec();
+            gle = ctsCreateSocket(sharedSocket->GetTrafficClass(), true, created, functionName);
+            g_configSettings->SocketPoolStallUsec.Add(ctl::ctTimer::snap_qpc_as_usec() - startUsec);
+            g_configSettings->SocketPoolStalls.Increment();
+        }
+        else
+        {
+            g_configSettings->SocketPoolHits.Increment();
+            if (!g_configSettings->SocketPoolBind)
+            {
+                functionName = "bind";
+                gle = g_localPorts ? ctsBindLocalPort(created.m_socket.get(), created) : ctsBindSocket(created.m_socket.get(), created.m_localAddr);
+            }
+        }
+
+        ctsCompleteCreate(sharedSocket, created, gle, functionName);
+    }
+} // namespace
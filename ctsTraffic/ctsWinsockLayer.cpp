@@ -1,181 +1,263 @@
-/*
-
-Copyright (c) Microsoft Corporation
-All rights reserved.
-
-Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
-
-THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
-
-See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
-
-*/
-
-// cpp headers
-#include <exception>
-#include <memory>
-// os headers
-#include <Windows.h>
-// ctl headers
-#include <ctThreadIocp.hpp>
-// project headers
-#include "ctsWinsockLayer.h"
-#include "ctsIOTask.hpp"
-#include "ctsConfig.h"
-#include "ctsSocket.h"
-// wil headers always included last
-#include <wil/stl.h>
-#include <wil/network.h>
-
-using ctsTraffic::ctsConfig::g_configSettings;
-
-//
-// These functions encapsulate making Winsock API calls
-// - primarily facilitating unit testing of interface logic that calls through Winsock
-//   but also simplifying the logic behind the code to make reasoning over the code more straight forward
-//
-namespace ctsTraffic
-{
-	// ReSharper disable once CppInconsistentNaming
-	wsIOResult ctsWSARecvFrom(
-		const std::shared_ptr<ctsSocket>& sharedSocket,
-		SOCKET socket,
-		const ctsTask& task,
-		std::function<void(OVERLAPPED*)>&& callback) noexcept
-	{
-		if (INVALID_SOCKET == socket)
-		{
-			return wsIOResult(WSAECONNABORTED);
-		}
-
-		wsIOResult returnResult{ ERROR_SUCCESS };
-		try
-		{
-			const auto& ioThreadPool = sharedSocket->GetIocpThreadpool();
-			OVERLAPPED* pOverlapped = ioThreadPool->new_request(std::move(callback));
-
-			WSABUF wsaBuffer{
-				.len = task.m_bufferLength,
-				.buf = task.m_buffer + task.m_bufferOffset };
-
-			DWORD flags = 0;
-			if (WSARecvFrom(socket, &wsaBuffer, 1, nullptr, &flags, nullptr, nullptr, pOverlapped, nullptr) != 0)
-			{
-				returnResult.m_errorCode = WSAGetLastError();
-				// IO pended == successfully initiating the IO
-				if (returnResult.m_errorCode != WSA_IO_PENDING)
-				{
-					// must cancel the IOCP TP if the IO call fails
-					ioThreadPool->cancel_request(pOverlapped);
-				}
-				// will return WSA_IO_PENDING transparently to the caller
-			}
-			else
-			{
-				if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
-				{
-					returnResult.m_errorCode = ERROR_SUCCESS;
-					// OVERLAPPED.InternalHigh == the number of bytes transferred for the I/O request.
-					// - this member is set when the request is completed inline
-					returnResult.m_bytesTransferred = static_cast<uint32_t>(pOverlapped->InternalHigh);
-					// completed inline, so the TP won't be notified
-					ioThreadPool->cancel_request(pOverlapped);
-				}
-				else
-				{
-					// WSARecvFrom returned success, but inline completions is not enabled
-					// so the IOCP callback will be invoked - thus will return WSA_IO_PENDING
-					returnResult.m_errorCode = WSA_IO_PENDING;
-				}
-			}
-		}
-		catch (...)
-		{
-			const auto error = ctsConfig::PrintThrownException();
-			returnResult.m_errorCode = error;
-		}
-
-		return returnResult;
-	}
-
-	// ReSharper disable once CppInconsistentNaming
-	wsIOResult ctsWSASendTo(
-		const std::shared_ptr<ctsSocket>& sharedSocket,
-		SOCKET socket,
-		const ctsTask& task,
-		std::function<void(OVERLAPPED*)>&& callback) noexcept
-	{
-		if (INVALID_SOCKET == socket)
-		{
-			return wsIOResult(WSAECONNABORTED);
-		}
-
-		wsIOResult returnResult{ ERROR_SUCCESS };
-		try
-		{
-			const auto& targetAddress = sharedSocket->GetRemoteSockaddr();
-			const auto& ioThreadPool = sharedSocket->GetIocpThreadpool();
-			OVERLAPPED* pOverlapped = ioThreadPool->new_request(std::move(callback));
-
-			WSABUF wsaBuffer{
-				.len = task.m_bufferLength,
-				.buf = task.m_buffer + task.m_bufferOffset };
-
-			if (WSASendTo(socket, &wsaBuffer, 1, nullptr, 0, targetAddress.sockaddr(), targetAddress.size(), pOverlapped, nullptr) != 0)
-			{
-				returnResult.m_errorCode = WSAGetLastError();
-				// IO pended == successfully initiating the IO
-				if (returnResult.m_errorCode != WSA_IO_PENDING)
-				{
-					// must cancel the IOCP TP if the IO call fails
-					ioThreadPool->cancel_request(pOverlapped);
-				}
-				// will return WSA_IO_PENDING transparently to the caller
-			}
-			else
-			{
-				if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
-				{
-					returnResult.m_errorCode = ERROR_SUCCESS;
-					// OVERLAPPED.InternalHigh == the number of bytes transferred for the I/O request.
-					// - this member is set when the request is completed inline
-					returnResult.m_bytesTransferred = static_cast<uint32_t>(pOverlapped->InternalHigh);
-					// completed inline, so the TP won't be notified
-					ioThreadPool->cancel_request(pOverlapped);
-				}
-				else
-				{
-					// WSARecvFrom returned success, but inline completions is not enabled
-					// so the IOCP callback will be invoked - thus will return WSA_IO_PENDING
-					returnResult.m_errorCode = WSA_IO_PENDING;
-				}
-			}
-		}
-		catch (...)
-		{
-			const auto error = ctsConfig::PrintThrownException();
-			returnResult.m_errorCode = error;
-		}
-
-		return returnResult;
-	}
-
-	wsIOResult ctsSetLingerToResetSocket(SOCKET socket) noexcept
-	{
-		wsIOResult returnResult{ ERROR_SUCCESS };
-		constexpr linger lingerOption{
-			.l_onoff = 1,
-			.l_linger = 0 };
-		if (setsockopt(socket, SOL_SOCKET, SO_LINGER, reinterpret_cast<const char*>(&lingerOption), sizeof lingerOption) != 0)
-		{
-			returnResult.m_errorCode = WSAGetLastError();
-			PRINT_DEBUG_INFO(L"\t\tIO Failed: setsockopt(SO_LINGER) (%d)\n", returnResult.m_errorCode);
-		}
-		else
-		{
-			PRINT_DEBUG_INFO(L"\t\tIO successfully called setsockopt(SO_LINGER) (%d)\n", returnResult.m_errorCode);
-		}
-
-		return returnResult;
-	}
-}
+/*
+
+Copyright (c) Microsoft Corporation
+All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the ""License""); you may not use this file except in compliance with the License. You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+
+THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+
+See the Apache Version 2.0 License for specific language governing permissions and limitations under the License.
+
+*/
+
+// cpp headers
+#include <exception>
+#include <memory>
+// os headers
+#include <Windows.h>
+// ctl headers
+#include <ctThreadIocp.hpp>
+// project headers
+#include "ctsWinsockLayer.h"
+#include "ctsIOTask.hpp"
+#include "ctsConfig.h"
+#include "ctsSocket.h"
+// wil headers always included last
+#include <wil/stl.h>
+#include <wil/network.h>
+
+using ctsTraffic::ctsConfig::g_configSettings;
+
+//
+// These functions encapsulate making Winsock API calls
+// - primarily facilitating unit testing of interface logic that calls through Winsock
+//   but also simplifying the logic behind the code to make reasoning over the code more straight forward
+//
+namespace ctsTraffic
+{
+	// ReSharper disable once CppInconsistentNaming
+	wsIOResult ctsWSARecvFrom(
+		const std::shared_ptr<ctsSocket>& sharedSocket,
+		SOCKET socket,
+		const ctsTask& task,
+		std::function<void(OVERLAPPED*)>&& callback) noexcept
+	{
+		if (INVALID_SOCKET == socket)
+		{
+			return wsIOResult(WSAECONNABORTED);
+		}
+
+		wsIOResult returnResult{ ERROR_SUCCESS };
+		try
+		{
+			const auto& ioThreadPool = sharedSocket->GetIocpThreadpool();
+			OVERLAPPED* pOverlapped = ioThreadPool->new_request(std::move(callback));
+
+			WSABUF wsaBuffer{
+				.len = task.m_bufferLength,
+				.buf = task.m_buffer + task.m_bufferOffset };
+
+			DWORD flags = 0;
+			if (WSARecvFrom(socket, &wsaBuffer, 1, nullptr, &flags, nullptr, nullptr, pOverlapped, nullptr) != 0)
+			{
+				returnResult.m_errorCode = WSAGetLastError();
+				// IO pended == successfully initiating the IO
+				if (returnResult.m_errorCode != WSA_IO_PENDING)
+				{
+					// must cancel the IOCP TP if the IO call fails
+					ioThreadPool->cancel_request(pOverlapped);
+				}
+				// will return WSA_IO_PENDING transparently to the caller
+			}
+			else
+			{
+				if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
+				{
+					returnResult.m_errorCode = ERROR_SUCCESS;
+					// OVERLAPPED.InternalHigh == the number of bytes transferred for the I/O request.
+					// - this member is set when the request is completed inline
+					returnResult.m_bytesTransferred = static_cast<uint32_t>(pOverlapped->InternalHigh);
+					// completed inline, so the TP won't be notified
+					ioThreadPool->cancel_request(pOverlapped);
+				}
+				else
+				{
+					// WSARecvFrom returned success, but inline completions is not enabled
+					// so the IOCP callback will be invoked - thus will return WSA_IO_PENDING
+					returnResult.m_errorCode = WSA_IO_PENDING;
+				}
+			}
+		}
+		catch (...)
+		{
+			const auto error = ctsConfig::PrintThrownException();
+			returnResult.m_errorCode = error;
+		}
+
+		return returnResult;
+	}
+
+	uint32_t ctsRecvMsgContext::GetCoalescedSegmentSize() const noexcept
+	{
+		// the control buffer is only written when the stack coalesced datagrams into this receive
+		auto* const message = const_cast<WSAMSG*>(&m_message);
+		for (auto* controlMessage = WSA_CMSG_FIRSTHDR(message);
+			controlMessage != nullptr;
+			controlMessage = WSA_CMSG_NXTHDR(message, controlMessage))
+		{
+			if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_COALESCED_INFO)
+			{
+				return *reinterpret_cast<const DWORD*>(WSA_CMSG_DATA(controlMessage));
+			}
+		}
+		return 0;
+	}
+
+	// ReSharper disable once CppInconsistentNaming
+	wsIOResult ctsWSARecvMsg(
+		const std::shared_ptr<ctsSocket>& sharedSocket,
+		SOCKET socket,
+		const ctsTask& task,
+		ctsRecvMsgContext& recvMsgContext,
+		std::function<void(OVERLAPPED*)>&& callback) noexcept
+	{
+		if (INVALID_SOCKET == socket)
+		{
+			return wsIOResult(WSAECONNABORTED);
+		}
+
+		wsIOResult returnResult{ ERROR_SUCCESS };
+		try
+		{
+			const auto& ioThreadPool = sharedSocket->GetIocpThreadpool();
+			OVERLAPPED* pOverlapped = ioThreadPool->new_request(std::move(callback));
+
+			recvMsgContext.m_dataBuffer.len = task.m_bufferLength;
+			recvMsgContext.m_dataBuffer.buf = task.m_buffer + task.m_bufferOffset;
+			recvMsgContext.m_message.lpBuffers = &recvMsgContext.m_dataBuffer;
+			recvMsgContext.m_message.dwBufferCount = 1;
+			recvMsgContext.m_message.Control.buf = recvMsgContext.m_controlBuffer.data();
+			recvMsgContext.m_message.Control.len = static_cast<ULONG>(recvMsgContext.m_controlBuffer.size());
+			recvMsgContext.m_message.dwFlags = 0;
+
+			if (g_configSettings->winsockFunctions->WSARecvMsg(socket, &recvMsgContext.m_message, nullptr, pOverlapped, nullptr) != 0)
+			{
+				returnResult.m_errorCode = WSAGetLastError();
+				// IO pended == successfully initiating the IO
+				if (returnResult.m_errorCode != WSA_IO_PENDING)
+				{
+					// must cancel the IOCP TP if the IO call fails
+					ioThreadPool->cancel_request(pOverlapped);
+				}
+				// will return WSA_IO_PENDING transparently to the caller
+			}
+			else
+			{
+				if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
+				{
+					returnResult.m_errorCode = ERROR_SUCCESS;
+					// OVERLAPPED.InternalHigh == the number of bytes transferred for the I/O request.
+					// - this member is set when the request is completed inline
+					returnResult.m_bytesTransferred = static_cast<uint32_t>(pOverlapped->InternalHigh);
+					// completed inline, so the TP won't be notified
+					ioThreadPool->cancel_request(pOverlapped);
+				}
+				else
+				{
+					// WSARecvMsg returned success, but inline completions is not enabled
+					// so the IOCP callback will be invoked - thus will return WSA_IO_PENDING
+					returnResult.m_errorCode = WSA_IO_PENDING;
+				}
+			}
+		}
+		catch (...)
+		{
+			const auto error = ctsConfig::PrintThrownException();
+			returnResult.m_errorCode = error;
+		}
+
+		return returnResult;
+	}
+
+	// ReSharper disable once CppInconsistentNaming
+	wsIOResult ctsWSASendTo(
+		const std::shared_ptr<ctsSocket>& sharedSocket,
+		SOCKET socket,
+		const ctsTask& task,
+		std::function<void(OVERLAPPED*)>&& callback) noexcept
+	{
+		if (INVALID_SOCKET == socket)
+		{
+			return wsIOResult(WSAECONNABORTED);
+		}
+
+		wsIOResult returnResult{ ERROR_SUCCESS };
+		try
+		{
+			const auto& targetAddress = sharedSocket->GetRemoteSockaddr();
+			const auto& ioThreadPool = sharedSocket->GetIocpThreadpool();
+			OVERLAPPED* pOverlapped = ioThreadPool->new_request(std::move(callback));
+
+			WSABUF wsaBuffer{
+				.len = task.m_bufferLength,
+				.buf = task.m_buffer + task.m_bufferOffset };
+
+			if (WSASendTo(socket, &wsaBuffer, 1, nullptr, 0, targetAddress.sockaddr(), targetAddress.size(), pOverlapped, nullptr) != 0)
+			{
+				returnResult.m_errorCode = WSAGetLastError();
+				// IO pended == successfully initiating the IO
+				if (returnResult.m_errorCode != WSA_IO_PENDING)
+				{
+					// must cancel the IOCP TP if the IO call fails
+					ioThreadPool->cancel_request(pOverlapped);
+				}
+				// will return WSA_IO_PENDING transparently to the caller
+			}
+			else
+			{
+				if (g_configSettings->Options & ctsConfig::OptionType::HandleInlineIocp)
+				{
+					returnResult.m_errorCode = ERROR_SUCCESS;
+					// OVERLAPPED.InternalHigh == the number of bytes transferred for the I/O request.
+					// - this member is set when the request is completed inline
+					returnResult.m_bytesTransferred = static_cast<uint32_t>(pOverlapped->InternalHigh);
+					// completed inline, so the TP won't be notified
+					ioThreadPool->cancel_request(pOverlapped);
+				}
+				else
+				{
+					// WSARecvFrom returned success, but inline completions is not enabled
+					// so the IOCP callback will be invoked - thus will return WSA_IO_PENDING
+					returnResult.m_errorCode = WSA_IO_PENDING;
+				}
+			}
+		}
+		catch (...)
+		{
+			const auto error = ctsConfig::PrintThrownException();
+			returnResult.m_errorCode = error;
+		}
+
+		return returnResult;
+	}
+
+	wsIOResult ctsSetLingerToResetSocket(SOCKET socket) noexcept
+	{
+		wsIOResult returnResult{ ERROR_SUCCESS };
+		constexpr linger lingerOption{
+			.l_onoff = 1,
+			.l_linger = 0 };
+		if (setsockopt(socket, SOL_SOCKET, SO_LINGER, reinterpret_cast<const char*>(&lingerOption), sizeof lingerOption) != 0)
+		{
+			returnResult.m_errorCode = WSAGetLastError();
+			PRINT_DEBUG_INFO(L"\t\tIO Failed: setsockopt(SO_LINGER) (%d)\n", returnResult.m_errorCode);
+		}
+		else
+		{
+			PRINT_DEBUG_INFO(L"\t\tIO successfully called setsockopt(SO_LINGER) (%d)\n", returnResult.m_errorCode);
+		}
+
+		return returnResult;
+	}
+}
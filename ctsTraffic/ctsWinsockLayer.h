@@ -14,6 +14,7 @@ See the Apache Version 2.0 License for specific language governing permissions a
 #pragma once
 
 // cpp headers
+#include <array>
 #include <memory>
 #include <functional>
 // os headers
@@ -38,6 +39,17 @@ See the Apache Version 2.0 License for specific language governing permissions a
 #define SIO_TCP_INFO _WSAIORW(IOC_VENDOR,39)
 #endif
 
+// these are only defined in the public header for Windows 10 20H1 (USO) and Windows 11 (URO) and later
+#ifndef UDP_SEND_MSG_SIZE
+#define UDP_SEND_MSG_SIZE 2
+#endif
+#ifndef UDP_RECV_MAX_COALESCED_SIZE
+#define UDP_RECV_MAX_COALESCED_SIZE 3
+#endif
+#ifndef UDP_COALESCED_INFO
+#define UDP_COALESCED_INFO 3
+#endif
+
 namespace ctsTraffic
 {
 // this is only defined in the public header for Windows 10 RS2 and later
@@ -149,6 +161,28 @@ wsIOResult ctsWSARecvFrom(
     const ctsTask& task,
     std::function<void(OVERLAPPED*)>&& callback) noexcept;
 
+//
+// Holds the WSAMSG and its control buffer for the lifetime of a WSARecvMsg request
+// - the control buffer receives the UDP_COALESCED_INFO message when the stack coalesced datagrams (URO)
+//
+struct ctsRecvMsgContext
+{
+    WSAMSG m_message{};
+    WSABUF m_dataBuffer{};
+    std::array<char, WSA_CMSG_SPACE(sizeof(DWORD))> m_controlBuffer{};
+
+    // returns the size of each datagram coalesced into the completed receive
+    // - returns zero if the receive holds a single datagram
+    [[nodiscard]] uint32_t GetCoalescedSegmentSize() const noexcept;
+};
+
+wsIOResult ctsWSARecvMsg(
+    const std::shared_ptr<ctsSocket>& sharedSocket,
+    SOCKET socket,
+    const ctsTask& task,
+    ctsRecvMsgContext& recvMsgContext,
+    std::function<void(OVERLAPPED*)>&& callback) noexcept;
+
 wsIOResult ctsWSASendTo(
     const std::shared_ptr<ctsSocket>& sharedSocket,
     SOCKET socket,